@@ -298,5 +298,14 @@ void DMA2_Stream4_IRQHandler(void) {
     HAL_DMA_IRQHandler(haudio_out_sai.hdmatx);
 }
 
+/**
+* @brief  This function handles EXTI lines 10 to 15 interrupt request, the touch panel interrupt on PI13.
+* @param  None
+* @retval None
+*/
+void EXTI15_10_IRQHandler(void) {
+    HAL_GPIO_EXTI_IRQHandler(LCD_INT_Pin);
+}
+
 /* USER CODE END 1 */
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,224 @@
+#include <stdbool.h>
+#include <string.h>
+#include "cmsis_os.h"
+
+#include "block_cache.h"
+#include "logger.h"
+#include "sd_async.h"
+#include "sdram.h"
+
+#define SECTOR_SIZE 512
+#define NONE 0xFFFF
+
+#if (BLOCK_CACHE_SECTORS & (BLOCK_CACHE_SECTORS - 1)) != 0 || BLOCK_CACHE_SECTORS >= NONE
+#error "BLOCK_CACHE_SECTORS must be a power of two below 65535"
+#endif
+
+typedef struct {
+    uint32_t sector;
+    // Least recently used list and hash bucket chain, as entry indices
+    uint16_t newer;
+    uint16_t older;
+    uint16_t next_in_bucket;
+    bool valid;
+    bool read_ahead;
+} BlockCacheEntry;
+
+static BlockCacheEntry *entries;
+static uint8_t *data;
+static uint8_t *read_ahead_buffer;
+static uint16_t buckets[BLOCK_CACHE_SECTORS];
+static uint16_t newest = NONE;
+static uint16_t oldest = NONE;
+static uint32_t disk_sectors;
+static BlockCacheStats stats;
+
+// FatFs holds its volume mutex, but raw file reads of a last sector come from the stream cache task
+static osSemaphoreId lock;
+osSemaphoreDef(block_cache_lock);
+
+static unsigned bucket_of(uint32_t sector) {
+    return sector & (BLOCK_CACHE_SECTORS - 1);
+}
+
+static uint16_t find(uint32_t sector) {
+    for (uint16_t i = buckets[bucket_of(sector)]; i != NONE; i = entries[i].next_in_bucket) {
+        if (entries[i].sector == sector) {
+            return i;
+        }
+    }
+    return NONE;
+}
+
+static void unlink_lru(uint16_t i) {
+    BlockCacheEntry *entry = &entries[i];
+    if (entry->newer != NONE) entries[entry->newer].older = entry->older; else newest = entry->older;
+    if (entry->older != NONE) entries[entry->older].newer = entry->newer; else oldest = entry->newer;
+}
+
+static void make_newest(uint16_t i) {
+    entries[i].newer = NONE;
+    entries[i].older = newest;
+    if (newest != NONE) entries[newest].newer = i;
+    newest = i;
+    if (oldest == NONE) oldest = i;
+}
+
+static void touch(uint16_t i) {
+    if (newest != i) {
+        unlink_lru(i);
+        make_newest(i);
+    }
+}
+
+static void remove_from_bucket(uint16_t i) {
+    uint16_t *link = &buckets[bucket_of(entries[i].sector)];
+    while (*link != i) {
+        link = &entries[*link].next_in_bucket;
+    }
+    *link = entries[i].next_in_bucket;
+}
+
+// The entry becomes the next one reused
+static void drop(uint16_t i) {
+    remove_from_bucket(i);
+    entries[i].valid = false;
+    unlink_lru(i);
+    entries[i].older = NONE;
+    entries[i].newer = oldest;
+    if (oldest != NONE) entries[oldest].older = i;
+    oldest = i;
+    if (newest == NONE) newest = i;
+}
+
+// Takes the least recently used entry for the sector, the caller fills its data
+static uint16_t insert(uint32_t sector, bool read_ahead) {
+    const uint16_t i = oldest;
+    BlockCacheEntry *entry = &entries[i];
+    if (entry->valid) {
+        remove_from_bucket(i);
+        stats.evictions++;
+    }
+    entry->sector = sector;
+    entry->valid = true;
+    entry->read_ahead = read_ahead;
+    entry->next_in_bucket = buckets[bucket_of(sector)];
+    buckets[bucket_of(sector)] = i;
+    touch(i);
+    return i;
+}
+
+static DRESULT read_miss(uint8_t *buffer, uint32_t sector) {
+    uint32_t count = BLOCK_CACHE_READ_AHEAD;
+    if (sector + count > disk_sectors) {
+        count = disk_sectors > sector ? disk_sectors - sector : 1;
+    }
+    const DRESULT result = sd_async_transfer(SD_REQUEST_READ, read_ahead_buffer, sector, count);
+    if (result != RES_OK) {
+        return result;
+    }
+    memcpy(buffer, read_ahead_buffer, SECTOR_SIZE);
+    memcpy(data + insert(sector, false) * SECTOR_SIZE, read_ahead_buffer, SECTOR_SIZE);
+    // Sectors already cached may be newer than the card after a write, so they are kept
+    for (uint32_t i = 1; i < count; i++) {
+        if (find(sector + i) == NONE) {
+            const uint16_t entry = insert(sector + i, true);
+            memcpy(data + entry * SECTOR_SIZE, read_ahead_buffer + i * SECTOR_SIZE, SECTOR_SIZE);
+            stats.read_ahead++;
+        }
+    }
+    // Read-ahead entries go in newest first, the requested sector must stay ahead of them
+    touch(find(sector));
+    return RES_OK;
+}
+
+int block_cache_init(uint32_t sector_count) {
+    disk_sectors = sector_count;
+    if (entries != NULL) {
+        block_cache_invalidate();
+        return 0;
+    }
+    entries = sdram_alloc(BLOCK_CACHE_SECTORS * sizeof(BlockCacheEntry));
+    data = sdram_alloc(BLOCK_CACHE_SECTORS * SECTOR_SIZE);
+    read_ahead_buffer = sdram_alloc(BLOCK_CACHE_READ_AHEAD * SECTOR_SIZE);
+    lock = osSemaphoreCreate(osSemaphore(block_cache_lock), 1);
+    if (entries == NULL || data == NULL || read_ahead_buffer == NULL || lock == NULL) {
+        entries = NULL;
+        return 1;
+    }
+    block_cache_invalidate();
+    return 0;
+}
+
+DRESULT block_cache_read(uint8_t *buffer, uint32_t sector, uint32_t count) {
+    if (entries == NULL || count != 1) {
+        stats.bypassed++;
+        return sd_async_transfer(SD_REQUEST_READ, buffer, sector, count);
+    }
+
+    osSemaphoreWait(lock, osWaitForever);
+    DRESULT result = RES_OK;
+    const uint16_t i = find(sector);
+    if (i != NONE) {
+        stats.hits++;
+        if (entries[i].read_ahead) {
+            entries[i].read_ahead = false;
+            stats.read_ahead_used++;
+        }
+        memcpy(buffer, data + i * SECTOR_SIZE, SECTOR_SIZE);
+        touch(i);
+    } else {
+        stats.misses++;
+        result = read_miss(buffer, sector);
+    }
+    osSemaphoreRelease(lock);
+    return result;
+}
+
+// Write-through, cached copies of the written sectors are updated rather than dropped
+DRESULT block_cache_write(const uint8_t *buffer, uint32_t sector, uint32_t count) {
+    const DRESULT result = sd_async_transfer(SD_REQUEST_WRITE, (uint8_t *) buffer, sector, count);
+    if (entries == NULL) {
+        return result;
+    }
+
+    osSemaphoreWait(lock, osWaitForever);
+    for (uint32_t n = 0; n < count; n++) {
+        const uint16_t i = find(sector + n);
+        if (i == NONE) {
+            continue;
+        }
+        if (result == RES_OK) {
+            memcpy(data + i * SECTOR_SIZE, buffer + n * SECTOR_SIZE, SECTOR_SIZE);
+        } else {
+            // The card may hold the old or the new data now
+            drop(i);
+        }
+    }
+    osSemaphoreRelease(lock);
+    return result;
+}
+
+void block_cache_invalidate(void) {
+    memset(buckets, 0xFF, sizeof(buckets));
+    newest = NONE;
+    oldest = NONE;
+    for (uint16_t i = 0; i < BLOCK_CACHE_SECTORS; i++) {
+        entries[i].valid = false;
+        make_newest(i);
+    }
+}
+
+void block_cache_get_stats(BlockCacheStats *result) {
+    *result = stats;
+}
+
+void block_cache_print_stats(void) {
+    const uint32_t lookups = stats.hits + stats.misses;
+    log_info("Block cache: %lu hits, %lu misses (%lu%% hit rate), %lu of %lu read-ahead sectors used, "
+             "%lu evictions, %lu reads bypassed",
+             (unsigned long) stats.hits, (unsigned long) stats.misses,
+             (unsigned long) (lookups != 0 ? (uint64_t) stats.hits * 100 / lookups : 0),
+             (unsigned long) stats.read_ahead_used, (unsigned long) stats.read_ahead,
+             (unsigned long) stats.evictions, (unsigned long) stats.bypassed);
+}
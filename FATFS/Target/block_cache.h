@@ -0,0 +1,35 @@
+#ifndef STM32_FLAC_PLAYER_BLOCK_CACHE_H
+#define STM32_FLAC_PLAYER_BLOCK_CACHE_H
+
+#include <stdint.h>
+#include "diskio.h"
+
+// Sectors kept in SDRAM, a power of two; 512 sectors are 256 KB
+#ifndef BLOCK_CACHE_SECTORS
+#define BLOCK_CACHE_SECTORS 512
+#endif
+// A missed single-sector read fetches this many sectors in one transfer, for FAT runs and directory clusters
+#define BLOCK_CACHE_READ_AHEAD 8
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    // Sectors brought in by read-ahead and how many of them were read before eviction
+    uint32_t read_ahead;
+    uint32_t read_ahead_used;
+    uint32_t evictions;
+    // Multi-sector reads, file data FatFs moves straight into the caller's buffer
+    uint32_t bypassed;
+} BlockCacheStats;
+
+// LRU cache of the single-sector reads FatFs makes through its window: FAT, directory and metadata sectors.
+// Longer reads are audio data and go to the card without touching the cache, writes go through it.
+int block_cache_init(uint32_t sector_count);
+DRESULT block_cache_read(uint8_t *buffer, uint32_t sector, uint32_t count);
+DRESULT block_cache_write(const uint8_t *buffer, uint32_t sector, uint32_t count);
+void block_cache_invalidate(void);
+
+void block_cache_get_stats(BlockCacheStats *stats);
+void block_cache_print_stats(void);
+
+#endif //STM32_FLAC_PLAYER_BLOCK_CACHE_H
@@ -0,0 +1,424 @@
+#include "main.h"
+#include "bsp_driver_sd.h"
+#include "logger.h"
+#include "sd_async.h"
+#include "sd_bus.h"
+
+#define SD_TASK_STACK_WORDS 256
+#define SECTOR_SIZE 512
+#define BACKGROUND_BURST_BYTES (SD_ASYNC_BACKGROUND_BURST_KB * 1024)
+
+// Orders the request fields before done, which the submitter may poll without a semaphore
+#define MEMORY_BARRIER() __sync_synchronize()
+
+// Requests of one class, in submission order
+typedef struct {
+    SdRequest *requests[SD_ASYNC_QUEUE_LENGTH];
+    unsigned count;
+} SdQueue;
+
+typedef struct {
+    osThreadId thread;
+    SdClass priority_class;
+} ThreadClass;
+
+static const SdClass class_order[SD_CLASS_COUNT] = {SD_CLASS_AUDIO, SD_CLASS_INTERACTIVE, SD_CLASS_BACKGROUND};
+static const char *const class_names[SD_CLASS_COUNT] = {"interactive", "audio", "background"};
+
+static SdQueue queues[SD_CLASS_COUNT];
+// A background request between two slices, it goes on before the rest of its queue
+static SdRequest *sliced_request;
+static ThreadClass thread_classes[SD_ASYNC_MAX_CLASSED_THREADS];
+static volatile unsigned thread_classes_count;
+static bool started = false;
+static volatile bool transfer_failed;
+static volatile uint32_t transfer_error;
+static SdAsyncStats stats;
+
+// Token bucket of the background class in bytes, charged by the SD task while audio is streaming
+static int32_t background_tokens = BACKGROUND_BURST_BYTES;
+static uint32_t bucket_ms;
+static uint32_t last_audio_ms;
+static bool audio_seen;
+
+// Binary semaphores: queue_lock and the sync locks are mutexes, work wakes the SD task, transfer is given by the DMA ISR
+static osSemaphoreId queue_lock;
+static osSemaphoreId work_semaphore;
+static osSemaphoreId transfer_semaphore;
+// One synchronous transfer per class, so an audio f_read does not wait behind a background one to be queued
+static osSemaphoreId sync_locks[SD_CLASS_COUNT];
+static osSemaphoreId sync_done_semaphores[SD_CLASS_COUNT];
+
+osSemaphoreDef(sd_queue_lock);
+osSemaphoreDef(sd_work);
+osSemaphoreDef(sd_transfer);
+osSemaphoreDef(sd_sync_lock);
+osSemaphoreDef(sd_sync_done);
+
+static uint32_t sd_task_stack[SD_TASK_STACK_WORDS];
+static osStaticThreadDef_t sd_task_control;
+
+// Unsigned differences survive the tick counter wrap
+static bool is_before(uint32_t time, uint32_t other) {
+    return (int32_t) (time - other) < 0;
+}
+
+// Earliest deadline first, then submission order
+static unsigned next_in_queue(const SdQueue *queue) {
+    unsigned next = 0;
+    for (unsigned i = 1; i < queue->count; i++) {
+        const SdRequest *request = queue->requests[i];
+        const SdRequest *best = queue->requests[next];
+        if (request->deadline_ms != 0 &&
+            (best->deadline_ms == 0 ||
+             is_before(request->submit_ms + request->deadline_ms, best->submit_ms + best->deadline_ms))) {
+            next = i;
+        }
+    }
+    return next;
+}
+
+static SdRequest *pop_request(void) {
+    SdRequest *request = NULL;
+    osSemaphoreWait(queue_lock, osWaitForever);
+    for (unsigned i = 0; i < SD_CLASS_COUNT && request == NULL; i++) {
+        const SdClass priority_class = class_order[i];
+        SdQueue *queue = &queues[priority_class];
+        if (priority_class == SD_CLASS_BACKGROUND && sliced_request != NULL) {
+            request = sliced_request;
+            sliced_request = NULL;
+        } else if (queue->count != 0) {
+            const unsigned next = next_in_queue(queue);
+            request = queue->requests[next];
+            queue->count--;
+            for (unsigned j = next; j < queue->count; j++) {
+                queue->requests[j] = queue->requests[j + 1];
+            }
+        }
+    }
+    osSemaphoreRelease(queue_lock);
+    return request;
+}
+
+static bool is_audio_active(uint32_t now) {
+    return audio_seen && now - last_audio_ms < SD_ASYNC_AUDIO_ACTIVE_MS;
+}
+
+// Called with queue_lock held
+static void refill_bucket(uint32_t now) {
+    const int64_t tokens = background_tokens + (int64_t) (now - bucket_ms) * SD_ASYNC_BACKGROUND_RATE_KBPS * 1024 / 1000;
+    background_tokens = tokens > BACKGROUND_BURST_BYTES ? BACKGROUND_BURST_BYTES : (int32_t) tokens;
+    bucket_ms = now;
+}
+
+static void charge_background(uint32_t sectors) {
+    const uint32_t now = osKernelSysTick();
+    osSemaphoreWait(queue_lock, osWaitForever);
+    refill_bucket(now);
+    if (is_audio_active(now)) {
+        background_tokens -= (int32_t) (sectors * SECTOR_SIZE);
+    }
+    osSemaphoreRelease(queue_lock);
+}
+
+// Reads leave the card in the transfer state at once, writes keep it busy while it programs,
+// so only the first check spins and later ones give the CPU away
+static int wait_for_card(void) {
+    const uint32_t start = osKernelSysTick();
+    while (BSP_SD_GetCardState() != SD_TRANSFER_OK) {
+        if (osKernelSysTick() - start >= SD_ASYNC_TIMEOUT_MS) {
+            return 1;
+        }
+        osDelay(1);
+    }
+    return 0;
+}
+
+static DRESULT transfer(const SdRequest *request, uint32_t count) {
+    if (wait_for_card() != 0) {
+        return RES_ERROR;
+    }
+    transfer_failed = false;
+    transfer_error = 0;
+    uint32_t *buffer = (uint32_t *) (request->buffer + request->transferred * SECTOR_SIZE);
+    const uint32_t sector = request->sector + request->transferred;
+    const uint8_t status = request->type == SD_REQUEST_READ
+                           ? BSP_SD_ReadBlocks_DMA(buffer, sector, count)
+                           : BSP_SD_WriteBlocks_DMA(buffer, sector, count);
+    if (status != MSD_OK || osSemaphoreWait(transfer_semaphore, SD_ASYNC_TIMEOUT_MS) != osOK || transfer_failed ||
+        wait_for_card() != 0) {
+        return RES_ERROR;
+    }
+    return RES_OK;
+}
+
+static void finish_request(SdRequest *request, DRESULT result) {
+    SdClassStats *class_stats = &stats.classes[request->priority_class];
+    const uint32_t latency = request->end_ms - request->submit_ms;
+    stats.requests++;
+    class_stats->requests++;
+    class_stats->sectors += request->transferred;
+    if (latency > class_stats->max_latency_ms) {
+        class_stats->max_latency_ms = latency;
+    }
+    if (request->deadline_ms != 0 && latency > request->deadline_ms) {
+        class_stats->deadline_misses++;
+    }
+    if (result != RES_OK) {
+        stats.errors++;
+    }
+    osSemaphoreWait(queue_lock, osWaitForever);
+    class_stats->queued--;
+    osSemaphoreRelease(queue_lock);
+
+    request->result = result;
+    MEMORY_BARRIER();
+    request->done = true;
+    if (request->done_semaphore != NULL) {
+        osSemaphoreRelease(request->done_semaphore);
+    }
+}
+
+static void run_request(SdRequest *request) {
+    const uint32_t start = osKernelSysTick();
+    if (request->transferred == 0) {
+        SdClassStats *class_stats = &stats.classes[request->priority_class];
+        const uint32_t wait = start - request->submit_ms;
+        request->start_ms = start;
+        class_stats->wait_ms += wait;
+        if (wait > class_stats->max_wait_ms) {
+            class_stats->max_wait_ms = wait;
+        }
+    }
+
+    uint32_t count = request->count - request->transferred;
+    if (request->priority_class == SD_CLASS_BACKGROUND && count > SD_ASYNC_BACKGROUND_SLICE_SECTORS) {
+        count = SD_ASYNC_BACKGROUND_SLICE_SECTORS;
+    }
+    DRESULT result = transfer(request, count);
+    for (int retry = 0; result != RES_OK && retry < SD_ASYNC_RETRIES; retry++) {
+        // CRC errors and timeouts mostly come from a clock the card or the wiring cannot take, nothing is left
+        // to try when they come at the slowest one
+        if (sd_bus_fall_back(transfer_error) != 0) {
+            break;
+        }
+        stats.retries++;
+        result = transfer(request, count);
+    }
+    if (result == RES_OK) {
+        sd_bus_transfer_done();
+    }
+    request->end_ms = osKernelSysTick();
+    stats.busy_ms += request->end_ms - start;
+    if (request->priority_class == SD_CLASS_BACKGROUND) {
+        charge_background(count);
+    }
+
+    if (result == RES_OK) {
+        request->transferred += count;
+        if (request->transferred < request->count) {
+            // Requests of the other classes queued meanwhile go first
+            sliced_request = request;
+            return;
+        }
+    }
+    finish_request(request, result);
+}
+
+static void sd_task(void const *argument) {
+    while (true) {
+        SdRequest *request = pop_request();
+        if (request != NULL) {
+            run_request(request);
+        } else {
+            // Between requests, so trying a faster bus mode delays none of them
+            sd_bus_recover();
+            osSemaphoreWait(work_semaphore, osWaitForever);
+        }
+    }
+}
+
+static osSemaphoreId create_semaphore(const osSemaphoreDef_t *definition, bool given) {
+    osSemaphoreId semaphore = osSemaphoreCreate(definition, 1);
+    if (semaphore != NULL && !given) {
+        osSemaphoreWait(semaphore, 0);
+    }
+    return semaphore;
+}
+
+int sd_async_init(void) {
+    if (started) {
+        return 0;
+    }
+    queue_lock = create_semaphore(osSemaphore(sd_queue_lock), true);
+    work_semaphore = create_semaphore(osSemaphore(sd_work), false);
+    transfer_semaphore = create_semaphore(osSemaphore(sd_transfer), false);
+    if (queue_lock == NULL || work_semaphore == NULL || transfer_semaphore == NULL) {
+        return 1;
+    }
+    for (int i = 0; i < SD_CLASS_COUNT; i++) {
+        sync_locks[i] = create_semaphore(osSemaphore(sd_sync_lock), true);
+        sync_done_semaphores[i] = create_semaphore(osSemaphore(sd_sync_done), false);
+        if (sync_locks[i] == NULL || sync_done_semaphores[i] == NULL) {
+            return 1;
+        }
+    }
+    bucket_ms = osKernelSysTick();
+
+    // Above every client, it only arms transfers and hands completions back
+    osThreadStaticDef(sd_io, sd_task, osPriorityHigh, 0, SD_TASK_STACK_WORDS, sd_task_stack, &sd_task_control);
+    if (osThreadCreate(osThread(sd_io), NULL) == NULL) {
+        return 1;
+    }
+    started = true;
+    return 0;
+}
+
+int sd_async_submit(SdRequest *request) {
+    const uint32_t now = osKernelSysTick();
+    const SdClass priority_class = request->priority_class < SD_CLASS_COUNT ? request->priority_class
+                                                                           : SD_CLASS_INTERACTIVE;
+    SdQueue *queue = &queues[priority_class];
+    SdClassStats *class_stats = &stats.classes[priority_class];
+    request->priority_class = priority_class;
+    request->done = false;
+    request->result = RES_ERROR;
+    request->submit_ms = now;
+    request->transferred = 0;
+    osSemaphoreWait(queue_lock, osWaitForever);
+    if (queue->count == SD_ASYNC_QUEUE_LENGTH) {
+        osSemaphoreRelease(queue_lock);
+        return 1;
+    }
+    queue->requests[queue->count++] = request;
+    if (++class_stats->queued > class_stats->max_queued) {
+        class_stats->max_queued = class_stats->queued;
+    }
+    if (priority_class == SD_CLASS_AUDIO) {
+        last_audio_ms = now;
+        audio_seen = true;
+    }
+    osSemaphoreRelease(queue_lock);
+    osSemaphoreRelease(work_semaphore);
+    return 0;
+}
+
+DRESULT sd_async_wait(SdRequest *request) {
+    while (!request->done) {
+        if (request->done_semaphore != NULL) {
+            osSemaphoreWait(request->done_semaphore, SD_ASYNC_TIMEOUT_MS);
+        } else {
+            osDelay(1);
+        }
+    }
+    MEMORY_BARRIER();
+    return request->result;
+}
+
+static SdClass thread_class(void) {
+    const osThreadId thread = osThreadGetId();
+    for (unsigned i = 0; i < thread_classes_count; i++) {
+        if (thread_classes[i].thread == thread) {
+            return thread_classes[i].priority_class;
+        }
+    }
+    return SD_CLASS_INTERACTIVE;
+}
+
+DRESULT sd_async_transfer(SdRequestType type, uint8_t *buffer, uint32_t sector, uint32_t count) {
+    const SdClass priority_class = thread_class();
+    SdRequest request = {
+            .type = type,
+            .priority_class = priority_class,
+            .buffer = buffer,
+            .sector = sector,
+            .count = count,
+            .done_semaphore = sync_done_semaphores[priority_class]
+    };
+    osSemaphoreWait(sync_locks[priority_class], osWaitForever);
+    while (sd_async_submit(&request) != 0) {
+        osDelay(1);
+    }
+    const DRESULT result = sd_async_wait(&request);
+    osSemaphoreRelease(sync_locks[priority_class]);
+    return result;
+}
+
+int sd_async_set_thread_class(SdClass priority_class) {
+    const osThreadId thread = osThreadGetId();
+    int result = 1;
+    if (!started || priority_class >= SD_CLASS_COUNT) {
+        return 1;
+    }
+    osSemaphoreWait(queue_lock, osWaitForever);
+    for (unsigned i = 0; i < thread_classes_count; i++) {
+        if (thread_classes[i].thread == thread) {
+            thread_classes[i].priority_class = priority_class;
+            result = 0;
+        }
+    }
+    if (result != 0 && thread_classes_count < SD_ASYNC_MAX_CLASSED_THREADS) {
+        thread_classes[thread_classes_count].thread = thread;
+        thread_classes[thread_classes_count].priority_class = priority_class;
+        MEMORY_BARRIER();
+        thread_classes_count++;
+        result = 0;
+    }
+    osSemaphoreRelease(queue_lock);
+    return result;
+}
+
+// Bytes the background class is in debt, 0 when it may transfer
+static int32_t background_debt(void) {
+    const uint32_t now = osKernelSysTick();
+    osSemaphoreWait(queue_lock, osWaitForever);
+    refill_bucket(now);
+    const int32_t debt = is_audio_active(now) ? -background_tokens : 0;
+    osSemaphoreRelease(queue_lock);
+    return debt > 0 ? debt : 0;
+}
+
+void sd_async_throttle(void) {
+    const uint32_t start = osKernelSysTick();
+    int32_t debt;
+    while ((debt = background_debt()) != 0) {
+        osDelay((uint32_t) debt * 1000 / (SD_ASYNC_BACKGROUND_RATE_KBPS * 1024) + 1);
+    }
+    stats.classes[thread_class()].throttled_ms += osKernelSysTick() - start;
+}
+
+bool sd_async_is_throttled(void) {
+    return background_debt() != 0;
+}
+
+void sd_async_complete_from_isr(void) {
+    osSemaphoreRelease(transfer_semaphore);
+}
+
+void sd_async_error_from_isr(uint32_t error) {
+    transfer_error = error;
+    transfer_failed = true;
+    osSemaphoreRelease(transfer_semaphore);
+}
+
+void sd_async_get_stats(SdAsyncStats *result) {
+    *result = stats;
+}
+
+void sd_async_print_stats(void) {
+    SdAsyncStats current;
+    sd_async_get_stats(&current);
+    log_info("SD task: %lu requests, %lu errors, %lu retries, card busy %lu ms",
+             (unsigned long) current.requests, (unsigned long) current.errors, (unsigned long) current.retries,
+             (unsigned long) current.busy_ms);
+    for (int i = 0; i < SD_CLASS_COUNT; i++) {
+        const SdClassStats *class_stats = &current.classes[class_order[i]];
+        log_info("  %s: %lu requests, %lu KB, queued %lu (max %lu), wait %lu ms (max %lu ms), "
+                 "latency max %lu ms, %lu deadlines missed, throttled %lu ms",
+                 class_names[class_order[i]], (unsigned long) class_stats->requests,
+                 (unsigned long) (class_stats->sectors * SECTOR_SIZE / 1024), (unsigned long) class_stats->queued,
+                 (unsigned long) class_stats->max_queued, (unsigned long) class_stats->wait_ms,
+                 (unsigned long) class_stats->max_wait_ms, (unsigned long) class_stats->max_latency_ms,
+                 (unsigned long) class_stats->deadline_misses, (unsigned long) class_stats->throttled_ms);
+    }
+}
@@ -0,0 +1,108 @@
+#ifndef STM32_FLAC_PLAYER_SD_ASYNC_H
+#define STM32_FLAC_PLAYER_SD_ASYNC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cmsis_os.h"
+#include "diskio.h"
+
+// Requests of one class waiting for the card, on top of the one being transferred
+#define SD_ASYNC_QUEUE_LENGTH 8
+#define SD_ASYNC_TIMEOUT_MS (30 * 1000)
+// A failed transfer is tried again this many times, after a CRC error or a timeout in the next slower bus mode
+#define SD_ASYNC_RETRIES 2
+// Background requests are transferred in slices of this many sectors, so an audio read waits for one slice at most
+#define SD_ASYNC_BACKGROUND_SLICE_SECTORS 16
+// Background throughput while audio is streaming, and the burst the token bucket allows on top of it
+#define SD_ASYNC_BACKGROUND_RATE_KBPS 512
+#define SD_ASYNC_BACKGROUND_BURST_KB 64
+// Audio is considered streaming for this long after its last request
+#define SD_ASYNC_AUDIO_ACTIVE_MS 1000
+// Threads whose synchronous transfers are not interactive
+#define SD_ASYNC_MAX_CLASSED_THREADS 4
+
+typedef enum {
+    SD_REQUEST_READ,
+    SD_REQUEST_WRITE
+} SdRequestType;
+
+// The SD task always runs the audio queue first, then interactive, then background requests.
+// Interactive is 0, so zeroed requests and unregistered threads get it.
+typedef enum {
+    SD_CLASS_INTERACTIVE,
+    SD_CLASS_AUDIO,
+    SD_CLASS_BACKGROUND,
+    SD_CLASS_COUNT
+} SdClass;
+
+// Owned by the SD task from sd_async_submit until done is set, the submitter keeps it alive until then
+typedef struct {
+    SdRequestType type;
+    SdClass priority_class;
+    uint8_t *buffer;
+    uint32_t sector;
+    uint32_t count;
+    // Milliseconds after submission the data is needed by, 0 for none. Within a class the earliest deadline
+    // goes first, requests without one follow in submission order.
+    uint32_t deadline_ms;
+    // Released once the request is done, may be NULL to poll done instead
+    osSemaphoreId done_semaphore;
+    volatile bool done;
+    volatile DRESULT result;
+    // When the card started and finished this transfer, so queueing is not counted as card latency
+    uint32_t start_ms;
+    uint32_t end_ms;
+    // Owned by the SD task
+    uint32_t submit_ms;
+    uint32_t transferred;
+} SdRequest;
+
+typedef struct {
+    uint32_t requests;
+    uint64_t sectors;
+    uint32_t queued;
+    uint32_t max_queued;
+    // Time spent in the queue before the first sector moved, and from submission to completion
+    uint32_t wait_ms;
+    uint32_t max_wait_ms;
+    uint32_t max_latency_ms;
+    uint32_t deadline_misses;
+    // Time threads of the class spent in sd_async_throttle
+    uint32_t throttled_ms;
+} SdClassStats;
+
+typedef struct {
+    uint32_t requests;
+    uint32_t errors;
+    uint32_t retries;
+    uint32_t busy_ms;
+    SdClassStats classes[SD_CLASS_COUNT];
+} SdAsyncStats;
+
+// Starts the SD task, called again it does nothing
+int sd_async_init(void);
+
+// Queues a DMA transfer and returns at once, 1 when the queue of its class is full.
+// The next request is armed as soon as the card is free.
+int sd_async_submit(SdRequest *request);
+DRESULT sd_async_wait(SdRequest *request);
+
+// Synchronous transfer through the queue, what the diskio driver calls; the class is the calling thread's
+DRESULT sd_async_transfer(SdRequestType type, uint8_t *buffer, uint32_t sector, uint32_t count);
+
+// Sets the class of the synchronous transfers the calling thread makes, FatFs calls included
+int sd_async_set_thread_class(SdClass priority_class);
+// Background threads call this between file operations, never while FatFs holds the volume: while audio is
+// streaming it blocks until the background token bucket is out of debt
+void sd_async_throttle(void);
+// Whether sd_async_throttle would block now
+bool sd_async_is_throttled(void);
+
+// Called by the BSP DMA completion and HAL error callbacks, from the interrupt, error is the HAL error code
+void sd_async_complete_from_isr(void);
+void sd_async_error_from_isr(uint32_t error);
+
+void sd_async_get_stats(SdAsyncStats *stats);
+void sd_async_print_stats(void);
+
+#endif //STM32_FLAC_PLAYER_SD_ASYNC_H
@@ -0,0 +1,251 @@
+#include <stdbool.h>
+#include <string.h>
+#include "main.h"
+#include "bsp_driver_sd.h"
+
+#include "logger.h"
+#include "sd_async.h"
+#include "sd_bus.h"
+
+// CSD command class 10: switch functions (CMD6)
+#define CARD_CLASS_SWITCH (1u << 10)
+// CMD6 argument: function group 1 (access mode) set to 1 (high speed), other groups unchanged
+#define SWITCH_CHECK_HIGH_SPEED 0x00FFFFF1u
+#define SWITCH_SET_HIGH_SPEED 0x80FFFFF1u
+#define SWITCH_STATUS_SIZE 64
+#define SWITCH_TIMEOUT_MS 100
+#define VALIDATE_TIMEOUT_MS 1000
+// What a clock the card or the wiring cannot take produces
+#define CLOCK_ERRORS (HAL_SD_ERROR_CMD_CRC_FAIL | HAL_SD_ERROR_DATA_CRC_FAIL | HAL_SD_ERROR_CMD_RSP_TIMEOUT | \
+                      HAL_SD_ERROR_DATA_TIMEOUT)
+
+extern SD_HandleTypeDef hsd1;
+
+typedef struct {
+    const char *name;
+    uint32_t bus_wide;
+    uint32_t clock_bypass;
+    uint32_t clock_div;
+    uint32_t clock_khz;
+    // The card must be switched to high speed timing first
+    bool high_speed;
+} SdBusMode;
+
+// SDMMC_CK is the 48 MHz CLK48 divided by ClockDiv + 2, or CLK48 itself with the bypass
+static const SdBusMode modes[] = {
+        {"4-bit high speed 48 MHz", SDMMC_BUS_WIDE_4B, SDMMC_CLOCK_BYPASS_ENABLE, 0, 48000, true},
+        {"4-bit 24 MHz", SDMMC_BUS_WIDE_4B, SDMMC_CLOCK_BYPASS_DISABLE, 0, 24000, false},
+        {"4-bit 12 MHz", SDMMC_BUS_WIDE_4B, SDMMC_CLOCK_BYPASS_DISABLE, 2, 12000, false},
+        {"1-bit 12 MHz", SDMMC_BUS_WIDE_1B, SDMMC_CLOCK_BYPASS_DISABLE, 2, 12000, false},
+};
+#define MODES_COUNT (sizeof(modes) / sizeof(modes[0]))
+
+static const SdBusMode initial_mode = {"1-bit 24 MHz", SDMMC_BUS_WIDE_1B, SDMMC_CLOCK_BYPASS_DISABLE, 0, 24000, false};
+
+static const SdBusMode *current_mode = &initial_mode;
+static unsigned selected_mode = MODES_COUNT - 1;
+// The mode BSP_SD_Init settled on, a fallen back bus recovers up to it
+static unsigned negotiated_mode = MODES_COUNT - 1;
+static bool card_high_speed = false;
+static uint32_t clean_transfers;
+static uint32_t errors;
+static uint32_t fallbacks;
+static uint32_t recoveries;
+
+static uint32_t reference[SD_BUS_VALIDATE_BLOCKS * BLOCKSIZE / 4];
+static uint32_t readback[SD_BUS_VALIDATE_BLOCKS * BLOCKSIZE / 4];
+
+// CMD6 answers with a 512-bit status block on the data lines, most significant byte first
+static int switch_function(uint32_t argument, uint8_t *status) {
+    SDMMC_TypeDef *sdmmc = hsd1.Instance;
+    uint32_t words[SWITCH_STATUS_SIZE / 4];
+    unsigned count = 0;
+
+    sdmmc->DCTRL = 0;
+    if (SDMMC_CmdBlockLength(sdmmc, SWITCH_STATUS_SIZE) != HAL_SD_ERROR_NONE) {
+        return 1;
+    }
+    SDMMC_DataInitTypeDef config = {
+            .DataTimeOut = SDMMC_DATATIMEOUT,
+            .DataLength = SWITCH_STATUS_SIZE,
+            .DataBlockSize = SDMMC_DATABLOCK_SIZE_64B,
+            .TransferDir = SDMMC_TRANSFER_DIR_TO_SDMMC,
+            .TransferMode = SDMMC_TRANSFER_MODE_BLOCK,
+            .DPSM = SDMMC_DPSM_ENABLE
+    };
+    SDMMC_ConfigData(sdmmc, &config);
+    if (SDMMC_CmdSwitch(sdmmc, argument) != HAL_SD_ERROR_NONE) {
+        SDMMC_CmdBlockLength(sdmmc, BLOCKSIZE);
+        return 1;
+    }
+
+    const uint32_t start = HAL_GetTick();
+    while (!__HAL_SD_GET_FLAG(&hsd1, SDMMC_FLAG_RXOVERR | SDMMC_FLAG_DCRCFAIL | SDMMC_FLAG_DTIMEOUT |
+                                     SDMMC_FLAG_DBCKEND)) {
+        if (__HAL_SD_GET_FLAG(&hsd1, SDMMC_FLAG_RXFIFOHF) && count + 8 <= SWITCH_STATUS_SIZE / 4) {
+            for (int i = 0; i < 8; i++) {
+                words[count++] = SDMMC_ReadFIFO(sdmmc);
+            }
+        }
+        if (HAL_GetTick() - start > SWITCH_TIMEOUT_MS) {
+            break;
+        }
+    }
+    const bool failed = __HAL_SD_GET_FLAG(&hsd1, SDMMC_FLAG_RXOVERR | SDMMC_FLAG_DCRCFAIL | SDMMC_FLAG_DTIMEOUT) ||
+                        !__HAL_SD_GET_FLAG(&hsd1, SDMMC_FLAG_DBCKEND);
+    while (__HAL_SD_GET_FLAG(&hsd1, SDMMC_FLAG_RXDAVL) && count < SWITCH_STATUS_SIZE / 4) {
+        words[count++] = SDMMC_ReadFIFO(sdmmc);
+    }
+    __HAL_SD_CLEAR_FLAG(&hsd1, SDMMC_STATIC_FLAGS);
+    SDMMC_CmdBlockLength(sdmmc, BLOCKSIZE);
+    if (failed || count != SWITCH_STATUS_SIZE / 4) {
+        return 1;
+    }
+
+    for (unsigned i = 0; i < count; i++) {
+        const uint32_t word = __REV(words[i]);
+        memcpy(status + 4 * i, &word, sizeof(word));
+    }
+    return 0;
+}
+
+static int switch_to_high_speed(void) {
+    uint8_t status[SWITCH_STATUS_SIZE];
+    if ((hsd1.SdCard.Class & CARD_CLASS_SWITCH) == 0) {
+        return 1;
+    }
+    // Bits 401 (high speed supported) and 379:376 (function selected in group 1)
+    if (switch_function(SWITCH_CHECK_HIGH_SPEED, status) != 0 || (status[13] & 0x02) == 0) {
+        return 1;
+    }
+    if (switch_function(SWITCH_SET_HIGH_SPEED, status) != 0 || (status[16] & 0x0F) != 1) {
+        return 1;
+    }
+    // The card switches timing within 8 clocks after the status block, the host follows once it is in transfer state
+    HAL_Delay(1);
+    card_high_speed = true;
+    return 0;
+}
+
+static int apply_mode(const SdBusMode *mode) {
+    if (mode->high_speed && !card_high_speed && switch_to_high_speed() != 0) {
+        return 1;
+    }
+    hsd1.Init.ClockBypass = mode->clock_bypass;
+    hsd1.Init.ClockDiv = mode->clock_div;
+    if (mode->bus_wide != current_mode->bus_wide) {
+        // Sends ACMD6 and reprograms the peripheral with the clock set above
+        if (HAL_SD_ConfigWideBusOperation(&hsd1, mode->bus_wide) != HAL_OK) {
+            return 1;
+        }
+    } else {
+        SD_InitTypeDef init = hsd1.Init;
+        init.BusWide = mode->bus_wide;
+        SDMMC_Init(hsd1.Instance, init);
+    }
+    hsd1.Init.BusWide = mode->bus_wide;
+    current_mode = mode;
+    return 0;
+}
+
+static int read_blocks(uint32_t *buffer) {
+    if (HAL_SD_ReadBlocks(&hsd1, (uint8_t *) buffer, 0, SD_BUS_VALIDATE_BLOCKS, VALIDATE_TIMEOUT_MS) != HAL_OK) {
+        return 1;
+    }
+    const uint32_t start = HAL_GetTick();
+    while (HAL_SD_GetCardState(&hsd1) != HAL_SD_CARD_TRANSFER) {
+        if (HAL_GetTick() - start > VALIDATE_TIMEOUT_MS) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int try_mode(unsigned index) {
+    for (int attempt = 0; attempt < SD_BUS_ATTEMPTS; attempt++) {
+        if (apply_mode(&modes[index]) == 0 && read_blocks(readback) == 0 &&
+            memcmp(reference, readback, sizeof(reference)) == 0) {
+            return 0;
+        }
+        HAL_SD_Abort(&hsd1);
+    }
+    log_warn("SD bus mode %s failed", modes[index].name);
+    return 1;
+}
+
+// Replaces the weak one in bsp_driver_sd.c, which only switches to 4-bit. Every call negotiates from the
+// fastest mode again, whatever the bus fell back to before.
+uint8_t BSP_SD_Init(void) {
+    if (BSP_SD_IsDetected() != SD_PRESENT) {
+        return MSD_ERROR_SD_NOT_PRESENT;
+    }
+    current_mode = &initial_mode;
+    card_high_speed = false;
+    if (HAL_SD_Init(&hsd1) != HAL_OK || read_blocks(reference) != 0) {
+        return MSD_ERROR;
+    }
+
+    for (unsigned i = 0; i < MODES_COUNT; i++) {
+        if (try_mode(i) == 0) {
+            selected_mode = i;
+            negotiated_mode = i;
+            clean_transfers = 0;
+            log_info("SD bus: %s", modes[i].name);
+            return MSD_OK;
+        }
+    }
+    return MSD_ERROR;
+}
+
+static int fall_back(void) {
+    while (selected_mode + 1 < MODES_COUNT) {
+        selected_mode++;
+        if (try_mode(selected_mode) == 0) {
+            fallbacks++;
+            log_warn("SD bus fell back to %s", modes[selected_mode].name);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int sd_bus_fall_back(uint32_t error) {
+    errors++;
+    clean_transfers = 0;
+    HAL_SD_Abort(&hsd1);
+    // A card that stays busy or a DMA error says nothing about the clock, the transfer is tried again as it was
+    if ((error & CLOCK_ERRORS) == 0) {
+        return 0;
+    }
+    return fall_back();
+}
+
+void sd_bus_transfer_done(void) {
+    clean_transfers++;
+}
+
+void sd_bus_recover(void) {
+    if (selected_mode <= negotiated_mode || clean_transfers < SD_BUS_RECOVER_TRANSFERS) {
+        return;
+    }
+    clean_transfers = 0;
+    if (try_mode(selected_mode - 1) == 0) {
+        selected_mode--;
+        recoveries++;
+        log_info("SD bus back to %s", modes[selected_mode].name);
+    } else if (try_mode(selected_mode) != 0) {
+        fall_back();
+    }
+}
+
+void sd_bus_get_info(SdBusInfo *info) {
+    info->mode = current_mode->name;
+    info->clock_khz = current_mode->clock_khz;
+    info->errors = errors;
+    info->fallbacks = fallbacks;
+    info->recoveries = recoveries;
+}
+
+void HAL_SD_ErrorCallback(SD_HandleTypeDef *hsd) {
+    sd_async_error_from_isr(hsd->ErrorCode);
+}
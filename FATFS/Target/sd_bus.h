@@ -0,0 +1,35 @@
+#ifndef STM32_FLAC_PLAYER_SD_BUS_H
+#define STM32_FLAC_PLAYER_SD_BUS_H
+
+#include <stdint.h>
+
+// Attempts per bus mode before the next slower one is tried
+#define SD_BUS_ATTEMPTS 2
+// Blocks read back in every candidate mode and compared with the same blocks read in 1-bit mode
+#define SD_BUS_VALIDATE_BLOCKS 4
+// Clean transfers in a mode slower than the negotiated one before the next faster mode is tried again
+#define SD_BUS_RECOVER_TRANSFERS 1000
+
+typedef struct {
+    const char *mode;
+    uint32_t clock_khz;
+    // Failed transfers, the times they made the bus fall back to a slower mode and the times it went back up
+    uint32_t errors;
+    uint32_t fallbacks;
+    uint32_t recoveries;
+} SdBusInfo;
+
+// BSP_SD_Init negotiates the fastest mode: CMD6 high speed with the 48 MHz clock bypass when the card
+// supports it, then 4-bit at 24 and 12 MHz, then 1-bit. Every mode is validated with a read-back.
+
+// Called by the SD task after a failed transfer with the error the HAL reported, 0 when it reported none. Only
+// a CRC error or a timeout makes the bus fall back to the next slower mode, 1 when it came at the slowest one
+// and retrying is pointless.
+int sd_bus_fall_back(uint32_t error);
+// Called by the SD task after a transfer that went through, and when it has nothing to do: after
+// SD_BUS_RECOVER_TRANSFERS clean transfers a bus that fell back tries the next faster mode again
+void sd_bus_transfer_done(void);
+void sd_bus_recover(void);
+void sd_bus_get_info(SdBusInfo *info);
+
+#endif //STM32_FLAC_PLAYER_SD_BUS_H
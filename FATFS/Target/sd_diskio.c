@@ -28,6 +28,8 @@
 /* Includes ------------------------------------------------------------------*/
 #include "ff_gen_drv.h"
 #include "sd_diskio.h"
+#include "sd_async.h"
+#include "block_cache.h"
 
 #include <string.h>
 #include <stdio.h>
@@ -35,9 +37,6 @@
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
 
-#define QUEUE_SIZE         (uint32_t) 10
-#define READ_CPLT_MSG      (uint32_t) 1
-#define WRITE_CPLT_MSG     (uint32_t) 2
 /*
 ==================================================================
 enable the defines below to send custom rtos messages
@@ -99,11 +98,6 @@ __ALIGN_BEGIN static uint8_t scratch[BLOCKSIZE] __ALIGN_END;
 /* Disk status */
 static volatile DSTATUS Stat = STA_NOINIT;
 
-#if (osCMSIS <= 0x20000U)
-static osMessageQId SDQueueID = NULL;
-#else
-static osMessageQueueId_t SDQueueID = NULL;
-#endif
 /* Private function prototypes -----------------------------------------------*/
 static DSTATUS SD_CheckStatus(BYTE lun);
 DSTATUS SD_initialize (BYTE);
@@ -136,27 +130,6 @@ const Diskio_drvTypeDef  SD_Driver =
 
 /* Private functions ---------------------------------------------------------*/
 
-static int SD_CheckStatusWithTimeout(uint32_t timeout)
-{
-  uint32_t timer;
-  /* block until SDIO peripheral is ready again or a timeout occur */
-#if (osCMSIS <= 0x20000U)
-  timer = osKernelSysTick();
-  while( osKernelSysTick() - timer < timeout)
-#else
-  timer = osKernelGetTickCount();
-  while( osKernelGetTickCount() - timer < timeout)
-#endif
-  {
-    if (BSP_SD_GetCardState() == SD_TRANSFER_OK)
-    {
-      return 0;
-    }
-  }
-
-  return -1;
-}
-
 static DSTATUS SD_CheckStatus(BYTE lun)
 {
   Stat = STA_NOINIT;
@@ -206,17 +179,10 @@ Stat = STA_NOINIT;
 
     if (Stat != STA_NOINIT)
     {
-      if (SDQueueID == NULL)
-      {
- #if (osCMSIS <= 0x20000U)
-      osMessageQDef(SD_Queue, QUEUE_SIZE, uint16_t);
-      SDQueueID = osMessageCreate (osMessageQ(SD_Queue), NULL);
-#else
-      SDQueueID = osMessageQueueNew(QUEUE_SIZE, 2, NULL);
-#endif
-      }
-
-      if (SDQueueID == NULL)
+      /* The SD task replaces the completion message queue */
+      BSP_SD_CardInfo CardInfo;
+      BSP_SD_GetCardInfo(&CardInfo);
+      if (sd_async_init() != 0 || block_cache_init(CardInfo.LogBlockNbr) != 0)
       {
         Stat |= STA_NOINIT;
       }
@@ -233,7 +199,14 @@ Stat = STA_NOINIT;
   */
 DSTATUS SD_status(BYTE lun)
 {
-  return SD_CheckStatus(lun);
+  /* FatFs asks on every file operation, from the calling thread. A CMD13 from there would race the SD task and a
+     DMA transfer in flight, during which the card is not in the transfer state, so the status of the last
+     initialization is returned; the SD task waits for the transfer state before every transfer itself */
+  if (BSP_SD_IsDetected() != SD_PRESENT)
+  {
+    Stat |= STA_NOINIT;
+  }
+  return Stat;
 }
 
 /* USER CODE BEGIN beforeReadSection */
@@ -250,150 +223,8 @@ DSTATUS SD_status(BYTE lun)
 
 DRESULT SD_read(BYTE lun, BYTE *buff, DWORD sector, UINT count)
 {
-  uint8_t ret;
-  DRESULT res = RES_ERROR;
-  uint32_t timer;
-#if (osCMSIS < 0x20000U)
-  osEvent event;
-#else
-  uint16_t event;
-  osStatus_t status;
-#endif
-#if (ENABLE_SD_DMA_CACHE_MAINTENANCE == 1)
-  uint32_t alignedAddr;
-#endif
-  /*
-  * ensure the SDCard is ready for a new operation
-  */
-
-  if (SD_CheckStatusWithTimeout(SD_TIMEOUT) < 0)
-  {
-    return res;
-  }
-
-#if defined(ENABLE_SCRATCH_BUFFER)
-  if (!((uint32_t)buff & 0x3))
-  {
-#endif
-    /* Fast path cause destination buffer is correctly aligned */
-    ret = BSP_SD_ReadBlocks_DMA((uint32_t*)buff, (uint32_t)(sector), count);
-
-    if (ret == MSD_OK) {
-#if (osCMSIS < 0x20000U)
-    /* wait for a message from the queue or a timeout */
-    event = osMessageGet(SDQueueID, SD_TIMEOUT);
-
-    if (event.status == osEventMessage)
-    {
-      if (event.value.v == READ_CPLT_MSG)
-      {
-        timer = osKernelSysTick();
-        /* block until SDIO IP is ready or a timeout occur */
-        while(osKernelSysTick() - timer <SD_TIMEOUT)
-#else
-          status = osMessageQueueGet(SDQueueID, (void *)&event, NULL, SD_TIMEOUT);
-          if ((status == osOK) && (event == READ_CPLT_MSG))
-          {
-            timer = osKernelGetTickCount();
-            /* block until SDIO IP is ready or a timeout occur */
-            while(osKernelGetTickCount() - timer <SD_TIMEOUT)
-#endif
-            {
-              if (BSP_SD_GetCardState() == SD_TRANSFER_OK)
-              {
-                res = RES_OK;
-#if (ENABLE_SD_DMA_CACHE_MAINTENANCE == 1)
-                /*
-                the SCB_InvalidateDCache_by_Addr() requires a 32-Byte aligned address,
-                adjust the address and the D-Cache size to invalidate accordingly.
-                */
-                alignedAddr = (uint32_t)buff & ~0x1F;
-                SCB_InvalidateDCache_by_Addr((uint32_t*)alignedAddr, count*BLOCKSIZE + ((uint32_t)buff - alignedAddr));
-#endif
-                break;
-              }
-            }
-#if (osCMSIS < 0x20000U)
-          }
-        }
-#else
-      }
-#endif
-    }
-
-#if defined(ENABLE_SCRATCH_BUFFER)
-    }
-    else
-    {
-      /* Slow path, fetch each sector a part and memcpy to destination buffer */
-      int i;
-
-      for (i = 0; i < count; i++)
-      {
-        ret = BSP_SD_ReadBlocks_DMA((uint32_t*)scratch, (uint32_t)sector++, 1);
-        if (ret == MSD_OK )
-        {
-          /* wait until the read is successful or a timeout occurs */
-#if (osCMSIS < 0x20000U)
-          /* wait for a message from the queue or a timeout */
-          event = osMessageGet(SDQueueID, SD_TIMEOUT);
-
-          if (event.status == osEventMessage)
-          {
-            if (event.value.v == READ_CPLT_MSG)
-            {
-              timer = osKernelSysTick();
-              /* block until SDIO IP is ready or a timeout occur */
-              while(osKernelSysTick() - timer <SD_TIMEOUT)
-#else
-                status = osMessageQueueGet(SDQueueID, (void *)&event, NULL, SD_TIMEOUT);
-              if ((status == osOK) && (event == READ_CPLT_MSG))
-              {
-                timer = osKernelGetTickCount();
-                /* block until SDIO IP is ready or a timeout occur */
-                ret = MSD_ERROR;
-                while(osKernelGetTickCount() - timer < SD_TIMEOUT)
-#endif
-                {
-                  ret = BSP_SD_GetCardState();
-
-                  if (ret == MSD_OK)
-                  {
-                    break;
-                  }
-                }
-
-                if (ret != MSD_OK)
-                {
-                  break;
-                }
-#if (osCMSIS < 0x20000U)
-              }
-            }
-#else
-          }
-#endif
-#if (ENABLE_SD_DMA_CACHE_MAINTENANCE == 1)
-          /*
-          *
-          * invalidate the scratch buffer before the next read to get the actual data instead of the cached one
-          */
-          SCB_InvalidateDCache_by_Addr((uint32_t*)scratch, BLOCKSIZE);
-#endif
-          memcpy(buff, scratch, BLOCKSIZE);
-          buff += BLOCKSIZE;
-        }
-        else
-        {
-          break;
-        }
-      }
-
-      if ((i == count) && (ret == MSD_OK ))
-        res = RES_OK;
-    }
-#endif
-  return res;
+  /* Single sectors go through the SDRAM block cache, asynchronous clients use sd_async_submit() directly */
+  return block_cache_read(buff, sector, count);
 }
 
 /* USER CODE BEGIN beforeWriteSection */
@@ -411,157 +242,8 @@ DRESULT SD_read(BYTE lun, BYTE *buff, DWORD sector, UINT count)
 
 DRESULT SD_write(BYTE lun, const BYTE *buff, DWORD sector, UINT count)
 {
-  DRESULT res = RES_ERROR;
-  uint32_t timer;
-
-#if (osCMSIS < 0x20000U)
-  osEvent event;
-#else
-  uint16_t event;
-  osStatus_t status;
-#endif
-
-#if defined(ENABLE_SCRATCH_BUFFER)
-  int32_t ret;
-#endif
-
-  /*
-  * ensure the SDCard is ready for a new operation
-  */
-
-  if (SD_CheckStatusWithTimeout(SD_TIMEOUT) < 0)
-  {
-    return res;
-  }
-
-#if defined(ENABLE_SCRATCH_BUFFER)
-  if (!((uint32_t)buff & 0x3))
-  {
-#endif
-#if (ENABLE_SD_DMA_CACHE_MAINTENANCE == 1)
-  uint32_t alignedAddr;
-  /*
-    the SCB_CleanDCache_by_Addr() requires a 32-Byte aligned address
-    adjust the address and the D-Cache size to clean accordingly.
-  */
-  alignedAddr = (uint32_t)buff & ~0x1F;
-  SCB_CleanDCache_by_Addr((uint32_t*)alignedAddr, count*BLOCKSIZE + ((uint32_t)buff - alignedAddr));
-#endif
-
-  if(BSP_SD_WriteBlocks_DMA((uint32_t*)buff,
-                           (uint32_t) (sector),
-                           count) == MSD_OK)
-  {
-#if (osCMSIS < 0x20000U)
-    /* Get the message from the queue */
-    event = osMessageGet(SDQueueID, SD_TIMEOUT);
-
-    if (event.status == osEventMessage)
-    {
-      if (event.value.v == WRITE_CPLT_MSG)
-      {
-#else
-    status = osMessageQueueGet(SDQueueID, (void *)&event, NULL, SD_TIMEOUT);
-    if ((status == osOK) && (event == WRITE_CPLT_MSG))
-    {
-#endif
- #if (osCMSIS < 0x20000U)
-        timer = osKernelSysTick();
-        /* block until SDIO IP is ready or a timeout occur */
-        while(osKernelSysTick() - timer  < SD_TIMEOUT)
-#else
-        timer = osKernelGetTickCount();
-        /* block until SDIO IP is ready or a timeout occur */
-        while(osKernelGetTickCount() - timer  < SD_TIMEOUT)
-#endif
-        {
-          if (BSP_SD_GetCardState() == SD_TRANSFER_OK)
-          {
-            res = RES_OK;
-            break;
-          }
-        }
-#if (osCMSIS < 0x20000U)
-      }
-    }
-#else
-    }
-#endif
-  }
-#if defined(ENABLE_SCRATCH_BUFFER)
-  else {
-    /* Slow path, fetch each sector a part and memcpy to destination buffer */
-    int i;
-
-#if (ENABLE_SD_DMA_CACHE_MAINTENANCE == 1)
-    /*
-     * invalidate the scratch buffer before the next write to get the actual data instead of the cached one
-     */
-     SCB_InvalidateDCache_by_Addr((uint32_t*)scratch, BLOCKSIZE);
-#endif
-      for (i = 0; i < count; i++)
-      {
-        memcpy((void *)scratch, buff, BLOCKSIZE);
-        buff += BLOCKSIZE;
-
-        ret = BSP_SD_WriteBlocks_DMA((uint32_t*)scratch, (uint32_t)sector++, 1);
-        if (ret == MSD_OK )
-        {
-          /* wait until the read is successful or a timeout occurs */
-#if (osCMSIS < 0x20000U)
-          /* wait for a message from the queue or a timeout */
-          event = osMessageGet(SDQueueID, SD_TIMEOUT);
-
-          if (event.status == osEventMessage)
-          {
-            if (event.value.v == READ_CPLT_MSG)
-            {
-              timer = osKernelSysTick();
-              /* block until SDIO IP is ready or a timeout occur */
-              while(osKernelSysTick() - timer <SD_TIMEOUT)
-#else
-                status = osMessageQueueGet(SDQueueID, (void *)&event, NULL, SD_TIMEOUT);
-              if ((status == osOK) && (event == READ_CPLT_MSG))
-              {
-                timer = osKernelGetTickCount();
-                /* block until SDIO IP is ready or a timeout occur */
-                ret = MSD_ERROR;
-                while(osKernelGetTickCount() - timer < SD_TIMEOUT)
-#endif
-                {
-                  ret = BSP_SD_GetCardState();
-
-                  if (ret == MSD_OK)
-                  {
-                    break;
-                  }
-                }
-
-                if (ret != MSD_OK)
-                {
-                  break;
-                }
-#if (osCMSIS < 0x20000U)
-              }
-            }
-#else
-          }
-#endif
-        }
-        else
-        {
-          break;
-        }
-      }
-
-      if ((i == count) && (ret == MSD_OK ))
-        res = RES_OK;
-    }
-
-  }
-#endif
-
-  return res;
+  /* Written through the block cache and queued behind any pending transfer, see sd_async.c */
+  return block_cache_write(buff, sector, count);
 }
  #endif /* _USE_WRITE == 1 */
 
@@ -638,12 +320,7 @@ void BSP_SD_WriteCpltCallback(void)
    * No need to add an "osKernelRunning()" check here, as the SD_initialize()
    * is always called before any SD_Read()/SD_Write() call
    */
-#if (osCMSIS < 0x20000U)
-   osMessagePut(SDQueueID, WRITE_CPLT_MSG, 0);
-#else
-   const uint16_t msg = WRITE_CPLT_MSG;
-   osMessageQueuePut(SDQueueID, (const void *)&msg, NULL, 0);
-#endif
+   sd_async_complete_from_isr();
 }
 
 /**
@@ -657,12 +334,7 @@ void BSP_SD_ReadCpltCallback(void)
    * No need to add an "osKernelRunning()" check here, as the SD_initialize()
    * is always called before any SD_Read()/SD_Write() call
    */
-#if (osCMSIS < 0x20000U)
-   osMessagePut(SDQueueID, READ_CPLT_MSG, 0);
-#else
-   const uint16_t msg = READ_CPLT_MSG;
-   osMessageQueuePut(SDQueueID, (const void *)&msg, NULL, 0);
-#endif
+   sd_async_complete_from_isr();
 }
 
 /* USER CODE BEGIN ErrorAbortCallbacks */
@@ -0,0 +1,48 @@
+#ifndef STM32_FLAC_PLAYER_HOST_CORPUS_H
+#define STM32_FLAC_PLAYER_HOST_CORPUS_H
+
+#include <stdint.h>
+#include "FLAC/format.h"
+
+#define CORPUS_MAX_CASES 128
+#define CORPUS_NAME_LENGTH 48
+
+typedef enum {
+    PREDICTOR_CONSTANT,
+    PREDICTOR_VERBATIM,
+    PREDICTOR_FIXED,
+    PREDICTOR_LPC
+} CorpusPredictor;
+
+typedef enum {
+    // Per-partition parameter closest to the residual magnitude
+    RICE_OPTIMAL,
+    // Highest partition order the blocksize and predictor order allow (up to 15)
+    RICE_MAX_PARTITIONS,
+    // Every partition stored as raw escaped samples
+    RICE_ESCAPED,
+    // Extended (5-bit) parameters far above the residual magnitude
+    RICE_WIDE_PARAMETER,
+    // Parameters far below the residual magnitude, producing long unary runs
+    RICE_LONG_UNARY
+} CorpusRiceMode;
+
+typedef struct {
+    char name[CORPUS_NAME_LENGTH];
+    unsigned channels;
+    unsigned bits_per_sample;
+    unsigned sample_rate;
+    unsigned blocksize;
+    CorpusPredictor predictor;
+    unsigned order;
+    CorpusRiceMode rice_mode;
+    FLAC__ChannelAssignment channel_assignment;
+    unsigned total_samples;
+} CorpusCase;
+
+unsigned corpus_build_cases(CorpusCase *cases, unsigned max_cases, double seconds);
+
+// Writes the case as a FLAC stream and stores the MD5 of its interleaved little-endian PCM in golden_md5
+int corpus_write_case(const CorpusCase *corpus_case, const char *path, uint8_t golden_md5[16]);
+
+#endif //STM32_FLAC_PLAYER_HOST_CORPUS_H
@@ -0,0 +1,40 @@
+#ifndef STM32_FLAC_PLAYER_HOST_FF_H
+#define STM32_FLAC_PLAYER_HOST_FF_H
+
+// Minimal stand-in for the FatFs API backed by stdio, just enough for the decoder sources
+
+#include <stdint.h>
+#include <stdio.h>
+
+typedef unsigned int UINT;
+typedef unsigned char BYTE;
+typedef uint32_t DWORD;
+typedef uint64_t FSIZE_t;
+
+typedef enum {
+    FR_OK = 0,
+    FR_DISK_ERR,
+    FR_INT_ERR,
+    FR_NOT_READY,
+    FR_NO_FILE,
+    FR_INVALID_OBJECT = 9,
+    FR_INVALID_PARAMETER = 19
+} FRESULT;
+
+typedef struct {
+    FILE *stream;
+    FSIZE_t size;
+} FIL;
+
+#define FA_READ 0x01
+
+FRESULT f_open(FIL *fp, const char *path, BYTE mode);
+FRESULT f_close(FIL *fp);
+FRESULT f_read(FIL *fp, void *buff, UINT btr, UINT *br);
+FRESULT f_lseek(FIL *fp, FSIZE_t ofs);
+
+#define f_size(fp) ((fp)->size)
+#define f_tell(fp) ((FSIZE_t) ftell((fp)->stream))
+#define f_eof(fp) (f_tell(fp) == f_size(fp))
+
+#endif //STM32_FLAC_PLAYER_HOST_FF_H
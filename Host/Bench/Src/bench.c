@@ -0,0 +1,275 @@
+#include <getopt.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "corpus.h"
+#include "flac_reader.h"
+#include "profiler.h"
+#include "private/md5.h"
+
+// Same chunk the player requests per half of its DMA buffer
+#define READ_CHUNK_SIZE 16384
+#define M7_CLOCK_MHZ 216.0
+
+typedef struct {
+    const char *corpus_dir;
+    const char *filter;
+    unsigned iterations;
+    double seconds;
+    double host_mhz;
+    double m7_mhz;
+    double m7_ratio;
+} BenchOptions;
+
+typedef struct {
+    uint64_t samples;
+    unsigned sample_rate;
+    double total_ns;
+    double zone_ns[PROFILER_ZONES_COUNT];
+    bool md5_ok;
+} BenchResult;
+
+static uint8_t chunk[READ_CHUNK_SIZE];
+static FLAC__int32 chunk_bytes[READ_CHUNK_SIZE];
+
+static void md5_accumulate_bytes(FLAC__MD5Context *md5, const uint8_t *bytes, unsigned size) {
+    // FLAC__MD5Accumulate with one channel of one-byte samples hashes the raw byte stream
+    for (unsigned i = 0; i < size; i++) {
+        chunk_bytes[i] = bytes[i];
+    }
+    const FLAC__int32 *const signal[1] = {chunk_bytes};
+    FLAC__MD5Accumulate(md5, signal, 1, size, 1);
+}
+
+// A whole decode can outlast the 4.29 s the 32-bit profiler counter spans on the host
+static uint64_t now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec;
+}
+
+// Decodes the whole file through flac_reader, optionally hashing the PCM it produces
+static int decode_file(const char *path, FlacMetaData *metadata, uint8_t md5_out[16], double *elapsed_ns) {
+    FIL file;
+    if (f_open(&file, path, FA_READ) != FR_OK) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return 1;
+    }
+
+    FLAC__MD5Context md5;
+    if (md5_out != NULL) FLAC__MD5Init(&md5);
+
+    const uint64_t start = now_ns();
+    Flac *flac = create_flac(&file);
+    FlacReader *reader = create_flac_reader(flac);
+    int result = read_metadata(flac, metadata);
+
+    unsigned bytes_read = READ_CHUNK_SIZE;
+    while (result == 0 && bytes_read == READ_CHUNK_SIZE) {
+        bytes_read = read_flac(reader, chunk, READ_CHUNK_SIZE);
+        if (md5_out != NULL) md5_accumulate_bytes(&md5, chunk, bytes_read);
+    }
+
+    free_flac_reader(reader);
+    destroy_flac(flac);
+    *elapsed_ns = (double) (now_ns() - start);
+    f_close(&file);
+
+    if (md5_out != NULL) FLAC__MD5Final(md5_out, &md5);
+    return result;
+}
+
+static int run_case(const char *name, const char *path, const uint8_t golden_md5[16], const BenchOptions *options,
+                    BenchResult *result) {
+    FlacMetaData metadata;
+    uint8_t md5[16];
+    double elapsed_ns;
+
+    // First pass checks the output bit-exactly, timed passes skip hashing
+    if (decode_file(path, &metadata, md5, &elapsed_ns) != 0) {
+        fprintf(stderr, "%s: decoding failed\n", name);
+        return 1;
+    }
+    *result = (BenchResult) {
+            .samples = metadata.total_samples,
+            .sample_rate = metadata.sample_rate,
+            .total_ns = -1,
+            .md5_ok = memcmp(md5, golden_md5, 16) == 0
+    };
+
+    for (unsigned i = 0; i < options->iterations; i++) {
+        profiler_reset();
+        if (decode_file(path, &metadata, NULL, &elapsed_ns) != 0) return 1;
+        if (result->total_ns >= 0 && elapsed_ns >= result->total_ns) continue;
+
+        result->total_ns = elapsed_ns;
+        for (int zone = 0; zone < PROFILER_ZONES_COUNT; zone++) {
+            result->zone_ns[zone] = (double) profiler_get_zone(zone)->total;
+        }
+    }
+    return 0;
+}
+
+// Reads the MD5 the encoder stored in STREAMINFO, which must be the first metadata block
+static int read_stream_md5(const char *path, uint8_t md5[16]) {
+    FIL file;
+    uint8_t header[8 + FLAC__STREAM_METADATA_STREAMINFO_LENGTH];
+    UINT bytes_read = 0;
+    if (f_open(&file, path, FA_READ) != FR_OK) return 1;
+    f_read(&file, header, sizeof(header), &bytes_read);
+    f_close(&file);
+
+    if (bytes_read != sizeof(header) || memcmp(header, "fLaC", 4) != 0 ||
+        (header[4] & 0x7F) != FLAC__METADATA_TYPE_STREAMINFO) {
+        return 1;
+    }
+    memcpy(md5, header + sizeof(header) - 16, 16);
+    return 0;
+}
+
+static void print_header(void) {
+    printf("%-30s %9s %8s %8s %8s %8s %8s %8s %9s %9s %8s %s\n",
+           "case", "samples", "total", "frame", "rice", "lpc", "intrlv", "f_read",
+           "m7_cyc", "budget", "margin", "md5");
+}
+
+static void print_result(const char *name, const BenchResult *result, const BenchOptions *options) {
+    const double samples = result->samples ? (double) result->samples : 1.0;
+    const double ns_per_sample = result->total_ns / samples;
+    // Host nanoseconds -> host cycles -> M7 cycles, compared with what the M7 has per sample at this rate
+    const double m7_cycles = ns_per_sample * options->host_mhz / 1000.0 * options->m7_ratio;
+    const double budget = options->m7_mhz * 1e6 / result->sample_rate;
+
+    printf("%-30s %9llu %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f %9.0f %9.0f %7.1f%% %s\n",
+           name, (unsigned long long) result->samples, ns_per_sample,
+           result->zone_ns[PROFILER_ZONE_READ_FRAME] / samples,
+           result->zone_ns[PROFILER_ZONE_RICE] / samples,
+           result->zone_ns[PROFILER_ZONE_LPC] / samples,
+           result->zone_ns[PROFILER_ZONE_INTERLEAVE] / samples,
+           result->zone_ns[PROFILER_ZONE_F_READ] / samples,
+           m7_cycles, budget, 100.0 * (1.0 - m7_cycles / budget),
+           result->md5_ok ? "ok" : "MISMATCH");
+}
+
+static double detect_host_mhz(void) {
+    FILE *cpuinfo = fopen("/proc/cpuinfo", "r");
+    double mhz = 0;
+    char line[256];
+    while (cpuinfo != NULL && fgets(line, sizeof(line), cpuinfo) != NULL) {
+        if (sscanf(line, "cpu MHz : %lf", &mhz) == 1) break;
+    }
+    if (cpuinfo != NULL) fclose(cpuinfo);
+    return mhz;
+}
+
+static void print_usage(const char *program) {
+    printf("Usage: %s [options] [file.flac ...]\n"
+           "Decodes a generated worst-case corpus (or the given files) with the firmware decoder\n"
+           "and reports ns per sample frame for each profiler zone.\n\n"
+           "  -d DIR     corpus directory (default: bench_corpus)\n"
+           "  -f TEXT    only run cases whose name contains TEXT\n"
+           "  -n N       timed iterations per case, the fastest is reported (default: 3)\n"
+           "  -s SEC     seconds of audio per generated case (default: 1)\n"
+           "  -c MHZ     host clock used to convert ns into cycles (default: /proc/cpuinfo)\n"
+           "  -m MHZ     target core clock (default: %.0f)\n"
+           "  -r RATIO   M7 cycles needed per host cycle (default: 2.5)\n"
+           "             calibrate it by comparing the on-target 'read_frame' zone with this report\n",
+           program, M7_CLOCK_MHZ);
+}
+
+int main(int argc, char **argv) {
+    BenchOptions options = {
+            .corpus_dir = "bench_corpus",
+            .iterations = 3,
+            .seconds = 1.0,
+            .host_mhz = 0,
+            .m7_mhz = M7_CLOCK_MHZ,
+            .m7_ratio = 2.5
+    };
+
+    int option;
+    while ((option = getopt(argc, argv, "d:f:n:s:c:m:r:h")) != -1) {
+        switch (option) {
+            case 'd': options.corpus_dir = optarg; break;
+            case 'f': options.filter = optarg; break;
+            case 'n': options.iterations = (unsigned) atoi(optarg); break;
+            case 's': options.seconds = atof(optarg); break;
+            case 'c': options.host_mhz = atof(optarg); break;
+            case 'm': options.m7_mhz = atof(optarg); break;
+            case 'r': options.m7_ratio = atof(optarg); break;
+            default:
+                print_usage(argv[0]);
+                return option == 'h' ? 0 : 2;
+        }
+    }
+    if (options.iterations == 0) options.iterations = 1;
+    if (options.host_mhz <= 0) options.host_mhz = detect_host_mhz();
+    if (options.host_mhz <= 0) {
+        fprintf(stderr, "Host clock unknown, assuming 3000 MHz (override with -c)\n");
+        options.host_mhz = 3000;
+    }
+
+    profiler_init();
+    printf("Host %.0f MHz, target %.0f MHz, M7/host cycle ratio %.2f, ns per sample frame\n",
+           options.host_mhz, options.m7_mhz, options.m7_ratio);
+    print_header();
+
+    unsigned failures = 0;
+    BenchResult result;
+
+    if (optind < argc) {
+        // Real files: the golden digest is the one the encoder stored in STREAMINFO
+        for (int i = optind; i < argc; i++) {
+            uint8_t golden_md5[16];
+            if (read_stream_md5(argv[i], golden_md5) != 0) {
+                fprintf(stderr, "%s: no STREAMINFO\n", argv[i]);
+                failures++;
+                continue;
+            }
+            if (run_case(argv[i], argv[i], golden_md5, &options, &result) != 0) {
+                failures++;
+                continue;
+            }
+            print_result(argv[i], &result, &options);
+            failures += !result.md5_ok;
+        }
+        return failures ? 1 : 0;
+    }
+
+    static CorpusCase cases[CORPUS_MAX_CASES];
+    const unsigned count = corpus_build_cases(cases, CORPUS_MAX_CASES, options.seconds);
+    mkdir(options.corpus_dir, 0755);
+
+    for (unsigned i = 0; i < count; i++) {
+        if (options.filter != NULL && strstr(cases[i].name, options.filter) == NULL) continue;
+
+        char path[512];
+        uint8_t golden_md5[16];
+        const int length = snprintf(path, sizeof(path), "%s/%s.flac", options.corpus_dir, cases[i].name);
+        if (length < 0 || (size_t) length >= sizeof(path)) {
+            fprintf(stderr, "%s: corpus path too long\n", cases[i].name);
+            failures++;
+            continue;
+        }
+        if (corpus_write_case(&cases[i], path, golden_md5) != 0) {
+            fprintf(stderr, "%s: cannot generate %s\n", cases[i].name, path);
+            failures++;
+            continue;
+        }
+        if (run_case(cases[i].name, path, golden_md5, &options, &result) != 0) {
+            failures++;
+            continue;
+        }
+        print_result(cases[i].name, &result, &options);
+        failures += !result.md5_ok;
+    }
+
+    if (failures) {
+        printf("%u case(s) failed\n", failures);
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,480 @@
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "corpus.h"
+#include "private/bitmath.h"
+#include "private/bitwriter.h"
+#include "private/fixed.h"
+#include "private/lpc.h"
+#include "private/md5.h"
+#include "private/stream_encoder_framing.h"
+
+// format.c in this tree leaves the vendor string out, the framing code still references it
+const char *FLAC__VENDOR_STRING = "stm32-flac-player bench";
+
+#define MAX_PARTITION_ORDER 15
+#define LPC_PRECISION 15
+
+static FLAC__int32 residual[FLAC__MAX_BLOCK_SIZE];
+static FLAC__real real_data[FLAC__MAX_BLOCK_SIZE];
+static unsigned rice_parameters[1u << MAX_PARTITION_ORDER];
+static unsigned rice_raw_bits[1u << MAX_PARTITION_ORDER];
+
+static void add_case(CorpusCase *cases, unsigned *count, unsigned max_cases, CorpusCase corpus_case,
+                     double seconds) {
+    if (*count >= max_cases) return;
+    // Whole blocks plus a short tail frame, so the last-frame path is always exercised
+    unsigned blocks = (unsigned) (seconds * corpus_case.sample_rate) / corpus_case.blocksize;
+    if (blocks == 0) blocks = 1;
+    unsigned tail = corpus_case.blocksize / 3;
+    if (tail < 64) tail = 64;
+    corpus_case.total_samples = blocks * corpus_case.blocksize + tail;
+    cases[(*count)++] = corpus_case;
+}
+
+unsigned corpus_build_cases(CorpusCase *cases, unsigned max_cases, double seconds) {
+    unsigned count = 0;
+    const CorpusCase base = {
+            .channels = 2,
+            .bits_per_sample = 16,
+            .sample_rate = 44100,
+            .blocksize = 4096,
+            .predictor = PREDICTOR_LPC,
+            .order = 8,
+            .rice_mode = RICE_OPTIMAL,
+            .channel_assignment = FLAC__CHANNEL_ASSIGNMENT_INDEPENDENT
+    };
+
+    static const unsigned blocksizes[] = {192, 576, 1152, 2304, 4096, 4608, 8192, 16384, 32768, 65535};
+    for (unsigned i = 0; i < sizeof(blocksizes) / sizeof(blocksizes[0]); i++) {
+        CorpusCase c = base;
+        c.blocksize = blocksizes[i];
+        snprintf(c.name, sizeof(c.name), "blocksize_%u", c.blocksize);
+        add_case(cases, &count, max_cases, c, seconds);
+    }
+
+    for (unsigned order = 1; order <= FLAC__MAX_LPC_ORDER; order++) {
+        CorpusCase c = base;
+        c.order = order;
+        snprintf(c.name, sizeof(c.name), "lpc_order_%02u", order);
+        add_case(cases, &count, max_cases, c, seconds);
+    }
+
+    static const unsigned bit_depths[] = {8, 16, 24};
+    for (unsigned i = 0; i < sizeof(bit_depths) / sizeof(bit_depths[0]); i++) {
+        for (unsigned channels = 1; channels <= FLAC__MAX_CHANNELS; channels++) {
+            CorpusCase c = base;
+            c.bits_per_sample = bit_depths[i];
+            c.channels = channels;
+            c.order = 12;
+            snprintf(c.name, sizeof(c.name), "format_%ubit_%uch", c.bits_per_sample, channels);
+            add_case(cases, &count, max_cases, c, seconds);
+        }
+    }
+
+    static const unsigned sample_rates[] = {48000, 96000, 192000};
+    for (unsigned i = 0; i < sizeof(sample_rates) / sizeof(sample_rates[0]); i++) {
+        CorpusCase c = base;
+        c.bits_per_sample = 24;
+        c.sample_rate = sample_rates[i];
+        snprintf(c.name, sizeof(c.name), "rate_%u_24bit", c.sample_rate);
+        add_case(cases, &count, max_cases, c, seconds);
+    }
+
+    static const struct {
+        FLAC__ChannelAssignment assignment;
+        const char *name;
+    } assignments[] = {
+            {FLAC__CHANNEL_ASSIGNMENT_LEFT_SIDE,  "left_side"},
+            {FLAC__CHANNEL_ASSIGNMENT_RIGHT_SIDE, "right_side"},
+            {FLAC__CHANNEL_ASSIGNMENT_MID_SIDE,   "mid_side"}
+    };
+    for (unsigned i = 0; i < sizeof(assignments) / sizeof(assignments[0]); i++) {
+        for (unsigned b = 0; b < 2; b++) {
+            CorpusCase c = base;
+            c.channel_assignment = assignments[i].assignment;
+            c.bits_per_sample = b ? 24 : 16;
+            snprintf(c.name, sizeof(c.name), "%s_%ubit", assignments[i].name, c.bits_per_sample);
+            add_case(cases, &count, max_cases, c, seconds);
+        }
+    }
+
+    for (unsigned order = 0; order <= FLAC__MAX_FIXED_ORDER; order++) {
+        CorpusCase c = base;
+        c.predictor = PREDICTOR_FIXED;
+        c.order = order;
+        snprintf(c.name, sizeof(c.name), "fixed_order_%u", order);
+        add_case(cases, &count, max_cases, c, seconds);
+    }
+
+    CorpusCase verbatim = base;
+    verbatim.predictor = PREDICTOR_VERBATIM;
+    verbatim.order = 0;
+    snprintf(verbatim.name, sizeof(verbatim.name), "verbatim_noise");
+    add_case(cases, &count, max_cases, verbatim, seconds);
+
+    CorpusCase constant = base;
+    constant.predictor = PREDICTOR_CONSTANT;
+    constant.order = 0;
+    snprintf(constant.name, sizeof(constant.name), "constant_silence");
+    add_case(cases, &count, max_cases, constant, seconds);
+
+    // Pathological residual coding
+    static const struct {
+        CorpusRiceMode mode;
+        unsigned blocksize;
+        unsigned order;
+        const char *name;
+    } rice_cases[] = {
+            {RICE_MAX_PARTITIONS, 32768, 1,  "rice_32768_partitions"},
+            {RICE_MAX_PARTITIONS, 4096,  8,  "rice_max_partitions_order_8"},
+            {RICE_MAX_PARTITIONS, 4096,  32, "rice_max_partitions_order_32"},
+            {RICE_ESCAPED,        4096,  8,  "rice_escaped"},
+            {RICE_WIDE_PARAMETER, 4096,  8,  "rice_wide_parameter"},
+            {RICE_LONG_UNARY,     4096,  8,  "rice_long_unary"},
+            {RICE_LONG_UNARY,     192,   32, "rice_long_unary_192_order_32"}
+    };
+    for (unsigned i = 0; i < sizeof(rice_cases) / sizeof(rice_cases[0]); i++) {
+        CorpusCase c = base;
+        c.rice_mode = rice_cases[i].mode;
+        c.blocksize = rice_cases[i].blocksize;
+        c.order = rice_cases[i].order;
+        snprintf(c.name, sizeof(c.name), "%s", rice_cases[i].name);
+        add_case(cases, &count, max_cases, c, seconds);
+    }
+
+    return count;
+}
+
+static uint32_t next_random(uint32_t *state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+static bool is_noisy(const CorpusCase *c) {
+    return c->predictor == PREDICTOR_VERBATIM || c->rice_mode == RICE_ESCAPED || c->rice_mode == RICE_LONG_UNARY;
+}
+
+static void generate_signal(const CorpusCase *c, FLAC__int32 *const signal[]) {
+    const double full_scale = (double) (1u << (c->bits_per_sample - 1));
+    const double noise_level = is_noisy(c) ? 0.2 : 0.01;
+
+    for (unsigned channel = 0; channel < c->channels; channel++) {
+        uint32_t seed = 0x9E3779B9u ^ (channel * 0x85EBCA6Bu) ^ (c->order << 20) ^ c->blocksize;
+        const double f1 = 110.0 * (channel + 1);
+        const double f2 = 2900.0 + 450.0 * channel;
+
+        for (unsigned n = 0; n < c->total_samples; n++) {
+            if (c->predictor == PREDICTOR_CONSTANT) {
+                signal[channel][n] = channel % 2 ? -1 : 0;
+                continue;
+            }
+            const double t = (double) n / c->sample_rate;
+            const double noise = (double) next_random(&seed) / 4294967296.0 * 2.0 - 1.0;
+            const double value = 0.55 * sin(2.0 * M_PI * f1 * t + channel) + 0.2 * sin(2.0 * M_PI * f2 * t) +
+                                 noise_level * noise;
+            long sample = lround(value * full_scale);
+            if (sample > (long) full_scale - 1) sample = (long) full_scale - 1;
+            if (sample < -(long) full_scale) sample = -(long) full_scale;
+            signal[channel][n] = (FLAC__int32) sample;
+        }
+    }
+}
+
+static unsigned max_partition_order(unsigned blocksize, unsigned order) {
+    unsigned partition_order = 0;
+    while (partition_order < MAX_PARTITION_ORDER &&
+           blocksize % (2u << partition_order) == 0 &&
+           (blocksize >> (partition_order + 1)) >= order) {
+        partition_order++;
+    }
+    return partition_order;
+}
+
+static unsigned optimal_rice_parameter(const FLAC__int32 *values, unsigned count) {
+    if (count == 0) return 0;
+    uint64_t sum = 0;
+    for (unsigned i = 0; i < count; i++) {
+        sum += (uint64_t) llabs(values[i]);
+    }
+    const uint64_t mean = sum / count;
+    unsigned parameter = 0;
+    while (parameter < 30 && (2ull << parameter) <= mean) parameter++;
+    return parameter;
+}
+
+static unsigned raw_bits_needed(const FLAC__int32 *values, unsigned count) {
+    unsigned bits = 1;
+    for (unsigned i = 0; i < count; i++) {
+        const int64_t v = values[i];
+        while (v > ((int64_t) 1 << (bits - 1)) - 1 || v < -((int64_t) 1 << (bits - 1))) bits++;
+    }
+    return bits;
+}
+
+// Picks partitioning and parameters for the residual; returns false if it cannot be represented
+static bool choose_entropy_coding(const CorpusCase *c, const FLAC__int32 *values, unsigned blocksize,
+                                  unsigned order, FLAC__EntropyCodingMethod *method,
+                                  FLAC__EntropyCodingMethod_PartitionedRiceContents *contents) {
+    unsigned partition_order = max_partition_order(blocksize, order);
+    if (c->rice_mode != RICE_MAX_PARTITIONS && partition_order > 4) {
+        partition_order = 4;
+    }
+
+    bool extended = c->rice_mode == RICE_WIDE_PARAMETER;
+    const unsigned partitions = 1u << partition_order;
+    unsigned offset = 0;
+    for (unsigned p = 0; p < partitions; p++) {
+        unsigned count = partition_order ? blocksize >> partition_order : blocksize;
+        if (p == 0) count -= order;
+
+        const unsigned optimal = optimal_rice_parameter(values + offset, count);
+        rice_raw_bits[p] = 0;
+        switch (c->rice_mode) {
+            case RICE_ESCAPED:
+                rice_parameters[p] = 0;
+                rice_raw_bits[p] = raw_bits_needed(values + offset, count);
+                if (rice_raw_bits[p] > 31) return false;
+                break;
+            case RICE_WIDE_PARAMETER:
+                rice_parameters[p] = optimal + 12 > 30 ? 30 : (optimal + 12 < 15 ? 15 : optimal + 12);
+                break;
+            case RICE_LONG_UNARY:
+                rice_parameters[p] = optimal > 5 ? optimal - 5 : 0;
+                break;
+            default:
+                rice_parameters[p] = optimal;
+                break;
+        }
+        if (rice_parameters[p] >= FLAC__ENTROPY_CODING_METHOD_PARTITIONED_RICE_ESCAPE_PARAMETER) {
+            extended = true;
+        }
+        offset += count;
+    }
+
+    contents->parameters = rice_parameters;
+    contents->raw_bits = rice_raw_bits;
+    contents->capacity_by_order = MAX_PARTITION_ORDER;
+    method->type = extended ? FLAC__ENTROPY_CODING_METHOD_PARTITIONED_RICE2
+                            : FLAC__ENTROPY_CODING_METHOD_PARTITIONED_RICE;
+    method->data.partitioned_rice.order = partition_order;
+    method->data.partitioned_rice.contents = contents;
+    return true;
+}
+
+static bool residual_fits(unsigned count) {
+    for (unsigned i = 0; i < count; i++) {
+        if (residual[i] > (1 << 30) || residual[i] < -(1 << 30)) return false;
+    }
+    return true;
+}
+
+static bool quantize_lpc(const FLAC__int32 *data, unsigned blocksize, unsigned order, FLAC__int32 qlp_coeff[],
+                         unsigned *precision, int *shift) {
+    FLAC__real autoc[FLAC__MAX_LPC_ORDER + 1];
+    FLAC__real lp_coeff[FLAC__MAX_LPC_ORDER][FLAC__MAX_LPC_ORDER];
+    double error[FLAC__MAX_LPC_ORDER];
+
+    for (unsigned i = 0; i < blocksize; i++) {
+        real_data[i] = (FLAC__real) data[i];
+    }
+    FLAC__lpc_compute_autocorrelation(real_data, blocksize, order + 1, autoc);
+    unsigned max_order = order;
+    if (autoc[0] != 0.0f) {
+        FLAC__lpc_compute_lp_coefficients(autoc, &max_order, lp_coeff, error);
+        *precision = LPC_PRECISION;
+        if (max_order == order &&
+            FLAC__lpc_quantize_coefficients(lp_coeff[order - 1], order, *precision, qlp_coeff, shift) == 0 &&
+            *shift >= 0) {
+            return true;
+        }
+    }
+
+    // Degenerate input: predict each sample from the previous one, still an order-N LPC subframe
+    memset(qlp_coeff, 0, sizeof(FLAC__int32) * order);
+    qlp_coeff[0] = 1;
+    *precision = 2;
+    *shift = 0;
+    return true;
+}
+
+static FLAC__bool write_subframe(FLAC__BitWriter *bw, const CorpusCase *c, const FLAC__int32 *data,
+                                 unsigned blocksize, unsigned bps) {
+    FLAC__EntropyCodingMethod_PartitionedRiceContents contents;
+
+    if (c->predictor == PREDICTOR_CONSTANT) {
+        const FLAC__Subframe_Constant subframe = {.value = data[0]};
+        return FLAC__subframe_add_constant(&subframe, bps, 0, bw);
+    }
+
+    if (c->predictor == PREDICTOR_FIXED) {
+        FLAC__Subframe_Fixed subframe = {.order = c->order, .residual = residual};
+        memcpy(subframe.warmup, data, sizeof(FLAC__int32) * c->order);
+        FLAC__fixed_compute_residual(data + c->order, blocksize - c->order, c->order, residual);
+        if (residual_fits(blocksize - c->order) &&
+            choose_entropy_coding(c, residual, blocksize, c->order, &subframe.entropy_coding_method, &contents)) {
+            return FLAC__subframe_add_fixed(&subframe, blocksize - c->order, bps, 0, bw);
+        }
+    }
+
+    if (c->predictor == PREDICTOR_LPC) {
+        FLAC__Subframe_LPC subframe = {.order = c->order, .residual = residual};
+        memcpy(subframe.warmup, data, sizeof(FLAC__int32) * c->order);
+        quantize_lpc(data, blocksize, c->order, subframe.qlp_coeff, &subframe.qlp_coeff_precision,
+                     &subframe.quantization_level);
+        // Same threshold the decoder uses to pick the 64-bit restore path
+        if (bps + subframe.qlp_coeff_precision + FLAC__bitmath_ilog2(c->order) <= 32) {
+            FLAC__lpc_compute_residual_from_qlp_coefficients(data + c->order, blocksize - c->order,
+                                                            subframe.qlp_coeff, c->order,
+                                                            subframe.quantization_level, residual);
+        } else {
+            FLAC__lpc_compute_residual_from_qlp_coefficients_wide(data + c->order, blocksize - c->order,
+                                                                 subframe.qlp_coeff, c->order,
+                                                                 subframe.quantization_level, residual);
+        }
+        if (residual_fits(blocksize - c->order) &&
+            choose_entropy_coding(c, residual, blocksize, c->order, &subframe.entropy_coding_method, &contents)) {
+            return FLAC__subframe_add_lpc(&subframe, blocksize - c->order, bps, 0, bw);
+        }
+    }
+
+    const FLAC__Subframe_Verbatim subframe = {.data = data};
+    return FLAC__subframe_add_verbatim(&subframe, blocksize, bps, 0, bw);
+}
+
+static bool flush_writer(FLAC__BitWriter *bw, FILE *output) {
+    const FLAC__byte *buffer;
+    size_t bytes;
+    if (!FLAC__bitwriter_get_buffer(bw, &buffer, &bytes)) return false;
+    bool ok = fwrite(buffer, 1, bytes, output) == bytes;
+    FLAC__bitwriter_release_buffer(bw);
+    FLAC__bitwriter_clear(bw);
+    return ok;
+}
+
+static bool write_frame(FLAC__BitWriter *bw, const CorpusCase *c, FLAC__int32 *const signal[], unsigned offset,
+                        unsigned blocksize, unsigned frame_number, FLAC__int32 *const side[2]) {
+    FLAC__FrameHeader header = {
+            .blocksize = blocksize,
+            .sample_rate = c->sample_rate,
+            .channels = c->channels,
+            .channel_assignment = c->channel_assignment,
+            .bits_per_sample = c->bits_per_sample,
+            .number_type = FLAC__FRAME_NUMBER_TYPE_FRAME_NUMBER,
+            .number.frame_number = frame_number
+    };
+    if (!FLAC__frame_add_header(&header, bw)) return false;
+
+    if (c->channel_assignment == FLAC__CHANNEL_ASSIGNMENT_INDEPENDENT) {
+        for (unsigned channel = 0; channel < c->channels; channel++) {
+            if (!write_subframe(bw, c, signal[channel] + offset, blocksize, c->bits_per_sample)) return false;
+        }
+    } else {
+        // Stereo decorrelation, the side channel needs one extra bit
+        const FLAC__int32 *left = signal[0] + offset;
+        const FLAC__int32 *right = signal[1] + offset;
+        for (unsigned i = 0; i < blocksize; i++) {
+            side[1][i] = left[i] - right[i];
+            side[0][i] = (left[i] + right[i]) >> 1;
+        }
+        const unsigned bps = c->bits_per_sample;
+        bool ok;
+        switch (c->channel_assignment) {
+            case FLAC__CHANNEL_ASSIGNMENT_LEFT_SIDE:
+                ok = write_subframe(bw, c, left, blocksize, bps) &&
+                     write_subframe(bw, c, side[1], blocksize, bps + 1);
+                break;
+            case FLAC__CHANNEL_ASSIGNMENT_RIGHT_SIDE:
+                ok = write_subframe(bw, c, side[1], blocksize, bps + 1) &&
+                     write_subframe(bw, c, right, blocksize, bps);
+                break;
+            default:
+                ok = write_subframe(bw, c, side[0], blocksize, bps) &&
+                     write_subframe(bw, c, side[1], blocksize, bps + 1);
+                break;
+        }
+        if (!ok) return false;
+    }
+
+    FLAC__uint16 crc;
+    return FLAC__bitwriter_zero_pad_to_byte_boundary(bw) &&
+           FLAC__bitwriter_get_write_crc16(bw, &crc) &&
+           FLAC__bitwriter_write_raw_uint32(bw, crc, FLAC__FRAME_FOOTER_CRC_LEN);
+}
+
+int corpus_write_case(const CorpusCase *corpus_case, const char *path, uint8_t golden_md5[16]) {
+    const CorpusCase *c = corpus_case;
+    int result = 1;
+
+    FLAC__int32 *signal[FLAC__MAX_CHANNELS] = {0};
+    FLAC__int32 *side[2] = {
+            malloc(sizeof(FLAC__int32) * c->blocksize),
+            malloc(sizeof(FLAC__int32) * c->blocksize)
+    };
+    FLAC__BitWriter *bw = FLAC__bitwriter_new();
+    FILE *output = fopen(path, "wb");
+
+    if (output == NULL || bw == NULL || !FLAC__bitwriter_init(bw) || side[0] == NULL || side[1] == NULL) {
+        goto cleanup;
+    }
+    for (unsigned channel = 0; channel < c->channels; channel++) {
+        signal[channel] = malloc(sizeof(FLAC__int32) * c->total_samples);
+        if (signal[channel] == NULL) goto cleanup;
+    }
+
+    generate_signal(c, signal);
+
+    // The golden digest follows the STREAMINFO definition: interleaved, little-endian, signed samples
+    FLAC__MD5Context md5;
+    FLAC__MD5Init(&md5);
+    if (!FLAC__MD5Accumulate(&md5, (const FLAC__int32 *const *) signal, c->channels, c->total_samples,
+                             c->bits_per_sample / 8)) {
+        goto cleanup;
+    }
+    FLAC__MD5Final(golden_md5, &md5);
+
+    FLAC__StreamMetadata stream_info = {
+            .type = FLAC__METADATA_TYPE_STREAMINFO,
+            .is_last = true,
+            .length = FLAC__STREAM_METADATA_STREAMINFO_LENGTH,
+            .data.stream_info = {
+                    .min_blocksize = c->blocksize,
+                    .max_blocksize = c->blocksize,
+                    .sample_rate = c->sample_rate,
+                    .channels = c->channels,
+                    .bits_per_sample = c->bits_per_sample,
+                    .total_samples = c->total_samples
+            }
+    };
+    memcpy(stream_info.data.stream_info.md5sum, golden_md5, 16);
+
+    if (!FLAC__bitwriter_write_raw_uint32(bw, 0x664C6143, 32) ||
+        !FLAC__add_metadata_block(&stream_info, bw) ||
+        !flush_writer(bw, output)) {
+        goto cleanup;
+    }
+
+    unsigned frame_number = 0;
+    for (unsigned offset = 0; offset < c->total_samples; offset += c->blocksize, frame_number++) {
+        unsigned blocksize = c->total_samples - offset;
+        if (blocksize > c->blocksize) blocksize = c->blocksize;
+        if (!write_frame(bw, c, signal, offset, blocksize, frame_number, side) || !flush_writer(bw, output)) {
+            goto cleanup;
+        }
+    }
+    result = 0;
+
+cleanup:
+    if (output != NULL && fclose(output) != 0) result = 1;
+    if (bw != NULL) FLAC__bitwriter_delete(bw);
+    for (unsigned channel = 0; channel < FLAC__MAX_CHANNELS; channel++) free(signal[channel]);
+    free(side[0]);
+    free(side[1]);
+    return result;
+}
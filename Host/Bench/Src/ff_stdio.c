@@ -0,0 +1,33 @@
+#include "ff.h"
+
+FRESULT f_open(FIL *fp, const char *path, BYTE mode) {
+    if (mode != FA_READ) {
+        return FR_INVALID_PARAMETER;
+    }
+    fp->stream = fopen(path, "rb");
+    if (fp->stream == NULL) {
+        return FR_NO_FILE;
+    }
+    fseek(fp->stream, 0, SEEK_END);
+    fp->size = (FSIZE_t) ftell(fp->stream);
+    fseek(fp->stream, 0, SEEK_SET);
+    return FR_OK;
+}
+
+FRESULT f_close(FIL *fp) {
+    if (fp->stream == NULL) {
+        return FR_INVALID_OBJECT;
+    }
+    fclose(fp->stream);
+    fp->stream = NULL;
+    return FR_OK;
+}
+
+FRESULT f_read(FIL *fp, void *buff, UINT btr, UINT *br) {
+    *br = (UINT) fread(buff, 1, btr, fp->stream);
+    return ferror(fp->stream) ? FR_DISK_ERR : FR_OK;
+}
+
+FRESULT f_lseek(FIL *fp, FSIZE_t ofs) {
+    return fseek(fp->stream, (long) ofs, SEEK_SET) == 0 ? FR_OK : FR_DISK_ERR;
+}
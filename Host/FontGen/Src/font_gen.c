@@ -0,0 +1,131 @@
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "font.h"
+
+// Writes a font atlas source for Lib/Player: the glyphs of the code points below rendered anti-aliased by
+// FreeType at one pixel size, as A4 bitmaps with their metrics, sorted by code point for the lookup.
+//   font_gen <font file> <pixel size> <name> <output .c>
+
+typedef struct {
+    uint32_t first;
+    uint32_t last;
+} Range;
+
+// ASCII, Latin-1 and Latin Extended-A (Polish, Czech, Hungarian...), and the typographic punctuation
+// tags often carry
+static const Range ranges[] = {
+        {0x0020, 0x007E},
+        {0x00A0, 0x017F},
+        {0x2013, 0x2014},
+        {0x2018, 0x2019},
+        {0x201C, 0x201D},
+        {0x2026, 0x2026}
+};
+
+#define COUNT(x) (sizeof(x)/sizeof(x[0]))
+
+static int fail(const char *message, const char *detail) {
+    fprintf(stderr, "font_gen: %s %s\n", message, detail);
+    return 1;
+}
+
+static unsigned to_a4(unsigned char gray) {
+    return (gray * 15 + 127) / 255;
+}
+
+// A4 rows of whole bytes, the left pixel in the high nibble
+static unsigned write_bitmap(FILE *out, const FT_Bitmap *bitmap, unsigned *column) {
+    unsigned bytes = 0;
+    for (unsigned y = 0; y < bitmap->rows; y++) {
+        const unsigned char *row = &bitmap->buffer[y * bitmap->pitch];
+        for (unsigned x = 0; x < bitmap->width; x += 2) {
+            const unsigned high = to_a4(row[x]);
+            const unsigned low = x + 1 < bitmap->width ? to_a4(row[x + 1]) : 0;
+            fprintf(out, "%s0x%02X,", *column == 0 ? "        " : " ", high << 4 | low);
+            if (++*column == 16) {
+                fputc('\n', out);
+                *column = 0;
+            }
+            bytes++;
+        }
+    }
+    return bytes;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 5) {
+        fprintf(stderr, "Usage: %s <font file> <pixel size> <name> <output .c>\n", argv[0]);
+        return 2;
+    }
+    const char *font_path = argv[1];
+    const unsigned size = (unsigned) atoi(argv[2]);
+    const char *name = argv[3];
+
+    FT_Library library;
+    FT_Face face;
+    if (FT_Init_FreeType(&library) != 0) {
+        return fail("cannot initialize FreeType", "");
+    }
+    if (FT_New_Face(library, font_path, 0, &face) != 0) {
+        return fail("cannot open", font_path);
+    }
+    if (size == 0 || FT_Set_Pixel_Sizes(face, 0, size) != 0) {
+        return fail("cannot use the pixel size", argv[2]);
+    }
+    FILE *out = fopen(argv[4], "w");
+    if (out == NULL) {
+        return fail("cannot write", argv[4]);
+    }
+
+    const char *base_name = strrchr(font_path, '/') != NULL ? strrchr(font_path, '/') + 1 : font_path;
+    const int ascent = (int) ((face->size->metrics.ascender + 63) >> 6);
+    const int descent = (int) ((-face->size->metrics.descender + 63) >> 6);
+    fprintf(out, "// Generated by Host/FontGen from %s at %u px, do not edit\n", base_name, size);
+    fprintf(out, "// DejaVu fonts are free, see https://dejavu-fonts.github.io/License.html\n");
+    fprintf(out, "#include \"font.h\"\n\nstatic const uint8_t bitmaps[] = {\n");
+
+    FontGlyph glyphs[1024];
+    unsigned glyph_count = 0;
+    unsigned offset = 0;
+    unsigned column = 0;
+    for (unsigned r = 0; r < COUNT(ranges); r++) {
+        for (uint32_t codepoint = ranges[r].first; codepoint <= ranges[r].last; codepoint++) {
+            const FT_UInt index = FT_Get_Char_Index(face, codepoint);
+            if (index == 0 || FT_Load_Glyph(face, index, FT_LOAD_RENDER | FT_LOAD_TARGET_LIGHT) != 0) {
+                continue;
+            }
+            const FT_GlyphSlot slot = face->glyph;
+            glyphs[glyph_count++] = (FontGlyph) {
+                    .codepoint = (uint16_t) codepoint,
+                    .width = (uint8_t) slot->bitmap.width,
+                    .height = (uint8_t) slot->bitmap.rows,
+                    .left = (int8_t) slot->bitmap_left,
+                    .top = (int8_t) slot->bitmap_top,
+                    .advance = (uint8_t) ((slot->advance.x + 32) >> 6),
+                    .offset = offset
+            };
+            offset += write_bitmap(out, &slot->bitmap, &column);
+        }
+    }
+    fprintf(out, "%s};\n\nstatic const FontGlyph glyphs[] = {\n", column != 0 ? "\n" : "");
+    for (unsigned i = 0; i < glyph_count; i++) {
+        const FontGlyph *glyph = &glyphs[i];
+        fprintf(out, "        {0x%04X, %u, %u, %d, %d, %u, %u},\n", glyph->codepoint, glyph->width, glyph->height,
+                glyph->left, glyph->top, glyph->advance, (unsigned) glyph->offset);
+    }
+    fprintf(out, "};\n\nconst Font %s = {\n", name);
+    fprintf(out, "        .ascent = %d,\n        .height = %d,\n", ascent, ascent + descent);
+    fprintf(out, "        .glyph_count = %u,\n        .glyphs = glyphs,\n        .bitmaps = bitmaps\n};\n",
+            glyph_count);
+    fclose(out);
+
+    printf("%s: %u glyphs, %u bytes of bitmaps, %d px lines\n", name, glyph_count, offset, ascent + descent);
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+    return 0;
+}
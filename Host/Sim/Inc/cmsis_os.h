@@ -0,0 +1,91 @@
+#ifndef STM32_FLAC_PLAYER_HOST_CMSIS_OS_H
+#define STM32_FLAC_PLAYER_HOST_CMSIS_OS_H
+
+// CMSIS-RTOS v1 subset used by the player and FatFs (option/syscall.c), implemented with pthreads
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define osCMSIS 0x10002
+#define osWaitForever 0xFFFFFFFF
+
+typedef enum {
+    osOK = 0,
+    osEventTimeout = 0x40,
+    osErrorParameter = 0x80,
+    osErrorOS = 0xFF
+} osStatus;
+
+typedef enum {
+    osPriorityIdle = -3,
+    osPriorityLow = -2,
+    osPriorityBelowNormal = -1,
+    osPriorityNormal = 0,
+    osPriorityAboveNormal = +1,
+    osPriorityHigh = +2,
+    osPriorityRealtime = +3
+} osPriority;
+
+typedef void (*os_pthread)(void const *argument);
+
+typedef struct {
+    uint32_t dummy;
+} osStaticThreadDef_t;
+
+// Priorities, stack sizes and static buffers are ignored, every thread is a plain pthread. The buffers are kept in
+// the definition as on the target, so the statics declared for them count as used.
+typedef struct {
+    const char *name;
+    os_pthread pthread;
+    osPriority tpriority;
+    uint32_t instances;
+    uint32_t stacksize;
+    uint32_t *buffer;
+    osStaticThreadDef_t *controlblock;
+} osThreadDef_t;
+
+typedef struct SimThread *osThreadId;
+
+#define osThreadDef(name, thread, priority, instances, stacksz) \
+const osThreadDef_t os_thread_def_##name = {#name, (thread), (priority), (instances), (stacksz), NULL, NULL}
+#define osThreadStaticDef(name, thread, priority, instances, stacksz, buffer, control) \
+const osThreadDef_t os_thread_def_##name = {#name, (thread), (priority), (instances), (stacksz), (buffer), (control)}
+#define osThread(name) &os_thread_def_##name
+
+osThreadId osThreadCreate(const osThreadDef_t *thread_def, void *argument);
+osThreadId osThreadGetId(void);
+
+typedef struct {
+    uint32_t dummy;
+} osSemaphoreDef_t;
+
+typedef struct SimSemaphore *osSemaphoreId;
+
+#define osSemaphoreDef(name) const osSemaphoreDef_t os_semaphore_def_##name = {0}
+#define osSemaphore(name) &os_semaphore_def_##name
+
+osSemaphoreId osSemaphoreCreate(const osSemaphoreDef_t *semaphore_def, int32_t count);
+int32_t osSemaphoreWait(osSemaphoreId semaphore_id, uint32_t millisec);
+osStatus osSemaphoreRelease(osSemaphoreId semaphore_id);
+osStatus osSemaphoreDelete(osSemaphoreId semaphore_id);
+
+typedef struct {
+    uint32_t dummy;
+} osMutexDef_t;
+
+typedef struct SimMutex *osMutexId;
+
+#define osMutexDef(name) const osMutexDef_t os_mutex_def_##name = {0}
+#define osMutex(name) &os_mutex_def_##name
+
+osMutexId osMutexCreate(const osMutexDef_t *mutex_def);
+osStatus osMutexWait(osMutexId mutex_id, uint32_t millisec);
+osStatus osMutexRelease(osMutexId mutex_id);
+
+uint32_t osKernelSysTick(void);
+osStatus osDelay(uint32_t millisec);
+
+void *pvPortMalloc(size_t size);
+void vPortFree(void *pointer);
+
+#endif //STM32_FLAC_PLAYER_HOST_CMSIS_OS_H
@@ -0,0 +1,8 @@
+#ifndef STM32_FLAC_PLAYER_HOST_DBGU_H
+#define STM32_FLAC_PLAYER_HOST_DBGU_H
+
+// Console keys come from the simulation script instead of the UART
+
+char debug_inkey(void);
+
+#endif //STM32_FLAC_PLAYER_HOST_DBGU_H
@@ -0,0 +1,9 @@
+#ifndef STM32_FLAC_PLAYER_HOST_MAIN_H
+#define STM32_FLAC_PLAYER_HOST_MAIN_H
+
+// Stands in for Core/Inc/main.h, which ffconf.h includes before bsp_driver_sd.h
+
+#include "stm32f7xx_hal.h"
+#include "bsp_driver_sd.h"
+
+#endif //STM32_FLAC_PLAYER_HOST_MAIN_H
@@ -0,0 +1,9 @@
+#ifndef STM32_FLAC_PLAYER_HOST_PNG_H
+#define STM32_FLAC_PLAYER_HOST_PNG_H
+
+#include <stdint.h>
+
+// Writes an 8-bit RGB PNG with uncompressed deflate blocks, the alpha channel is dropped
+int png_write_argb8888(const char *path, const uint32_t *pixels, unsigned width, unsigned height);
+
+#endif //STM32_FLAC_PLAYER_HOST_PNG_H
@@ -0,0 +1,73 @@
+#ifndef STM32_FLAC_PLAYER_HOST_SIM_H
+#define STM32_FLAC_PLAYER_HOST_SIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "ff_gen_drv.h"
+
+// Simulated refresh of the RK043FN48H panel and the share of it spent in vertical sync
+#define SIM_LCD_REFRESH_HZ 60
+#define SIM_LCD_VSYNC_US 600
+
+// Timer wakeups later than this are host scheduling jitter, reported apart from player deadline misses
+#define SIM_AUDIO_LATE_WAKEUP_US 1000
+// The emulated DMA sends a half in this many slices, each captured as it starts, about 6 ms at 44.1 kHz
+#define SIM_AUDIO_SLICES 16
+
+typedef struct {
+    unsigned half_transfers;
+    unsigned late_wakeups;
+    uint64_t max_wakeup_delay_ns;
+} SimAudioStats;
+
+// Clock shared by the HAL tick, the SAI timer and the script, starting at zero when the simulation starts
+uint64_t sim_time_ns(void);
+void sim_sleep_until_ns(uint64_t time_ns);
+
+// FreeRTOS runs its idle hook whenever no task is ready; the host always has spare CPU, so a thread runs it every tick
+void sim_idle_start(void);
+void vApplicationIdleHook(void);
+
+extern const Diskio_drvTypeDef SIM_Driver;
+
+typedef struct {
+    unsigned reads;
+    unsigned writes;
+    uint64_t sectors_read;
+    uint64_t sectors_written;
+} SimDiskStats;
+
+int sim_disk_open(const char *image_path);
+void sim_disk_get_stats(SimDiskStats *disk_stats);
+// Card timing model: a fixed cost per read/write command plus a transfer time per sector
+void sim_disk_set_latency(unsigned command_us, unsigned sector_us);
+// Every period-th read command stalls, like an aging card busy with wear leveling
+void sim_disk_set_stalls(unsigned stall_ms, unsigned period);
+int sim_make_image(const char *image_path, unsigned size_mb, char *const *files, int files_count);
+
+void sim_lcd_start(void);
+int sim_lcd_dump_png(const char *path);
+
+int sim_audio_start(const char *wav_path);
+void sim_audio_finish(SimAudioStats *stats);
+
+// A hold time of zero releases the touch after the player has read it once
+void sim_touch_press(uint16_t x, uint16_t y, unsigned hold_ms);
+// Moves the finger from x, y to end_x, end_y at a constant speed over hold_ms, then lifts it
+void sim_touch_swipe(uint16_t x, uint16_t y, uint16_t end_x, uint16_t end_y, unsigned hold_ms);
+void sim_console_key(char key);
+
+int sim_script_start(const char *script_path, const char *dump_path);
+
+#define SIM_BACKGROUND_MAX_CHUNK_KB 64
+
+// Starts a background-class thread reading the whole card over and over, chunk_kb at a time
+int sim_background_start(unsigned chunk_kb);
+
+// Walks the image like a library scan does and prints files per second, 1 when the walk failed
+int sim_walk_benchmark(const char *pattern, unsigned memory_size);
+
+// Prints the report and exits, with status 1 when the player missed an audio deadline
+void sim_finish(void);
+
+#endif //STM32_FLAC_PLAYER_HOST_SIM_H
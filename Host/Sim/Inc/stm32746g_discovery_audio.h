@@ -0,0 +1,50 @@
+#ifndef STM32_FLAC_PLAYER_HOST_STM32746G_DISCOVERY_AUDIO_H
+#define STM32_FLAC_PLAYER_HOST_STM32746G_DISCOVERY_AUDIO_H
+
+// SAI output emulated by a timer thread: the buffer is consumed as 16-bit stereo at the configured
+// frequency and the half/complete callbacks fire at the same points the DMA would raise them
+
+#include <stdint.h>
+#include "stm32f7xx_hal.h"
+
+#define OUTPUT_DEVICE_SPEAKER ((uint16_t)0x0001)
+#define OUTPUT_DEVICE_HEADPHONE ((uint16_t)0x0002)
+#define OUTPUT_DEVICE_BOTH ((uint16_t)0x0003)
+#define OUTPUT_DEVICE_AUTO ((uint16_t)0x0004)
+#define OUTPUT_DEVICE_HEADPHONE1 OUTPUT_DEVICE_HEADPHONE
+#define OUTPUT_DEVICE_HEADPHONE2 OUTPUT_DEVICE_SPEAKER
+
+#define CODEC_PDWN_HW 1
+#define CODEC_PDWN_SW 2
+
+#define AUDIO_FREQUENCY_192K ((uint32_t)192000)
+#define AUDIO_FREQUENCY_96K ((uint32_t)96000)
+#define AUDIO_FREQUENCY_48K ((uint32_t)48000)
+#define AUDIO_FREQUENCY_44K ((uint32_t)44100)
+#define AUDIO_FREQUENCY_32K ((uint32_t)32000)
+#define AUDIO_FREQUENCY_22K ((uint32_t)22050)
+#define AUDIO_FREQUENCY_16K ((uint32_t)16000)
+#define AUDIO_FREQUENCY_11K ((uint32_t)11025)
+#define AUDIO_FREQUENCY_8K ((uint32_t)8000)
+
+#define CODEC_AUDIOFRAME_SLOT_0123 0x0F
+#define CODEC_AUDIOFRAME_SLOT_02 0x05
+#define CODEC_AUDIOFRAME_SLOT_13 0x0A
+
+#define AUDIODATA_SIZE ((uint16_t)2)
+#define AUDIO_OK ((uint8_t)0)
+#define AUDIO_ERROR ((uint8_t)1)
+
+uint8_t BSP_AUDIO_OUT_Init(uint16_t OutputDevice, uint8_t Volume, uint32_t AudioFreq);
+uint8_t BSP_AUDIO_OUT_Play(uint16_t *pBuffer, uint32_t Size);
+uint8_t BSP_AUDIO_OUT_Pause(void);
+uint8_t BSP_AUDIO_OUT_Resume(void);
+uint8_t BSP_AUDIO_OUT_Stop(uint32_t Option);
+uint8_t BSP_AUDIO_OUT_SetVolume(uint8_t Volume);
+void BSP_AUDIO_OUT_SetFrequency(uint32_t AudioFreq);
+void BSP_AUDIO_OUT_SetAudioFrameSlot(uint32_t AudioFrameSlot);
+
+void BSP_AUDIO_OUT_TransferComplete_CallBack(void);
+void BSP_AUDIO_OUT_HalfTransfer_CallBack(void);
+
+#endif //STM32_FLAC_PLAYER_HOST_STM32746G_DISCOVERY_AUDIO_H
@@ -0,0 +1,98 @@
+#ifndef STM32_FLAC_PLAYER_HOST_STM32746G_DISCOVERY_LCD_H
+#define STM32_FLAC_PLAYER_HOST_STM32746G_DISCOVERY_LCD_H
+
+// LCD drawn by the CPU into the layer frame buffers with the BSP algorithms, ARGB8888 and RGB565.
+// Layers of other formats are set up with the HAL LTDC calls and drawn by the player itself.
+
+#include <stdint.h>
+#include "stm32f7xx_hal.h"
+#include "fonts.h"
+
+#define RK043FN48H_WIDTH ((uint16_t)480)
+#define RK043FN48H_HEIGHT ((uint16_t)272)
+
+#define MAX_LAYER_NUMBER ((uint32_t)2)
+
+#define LCD_OK ((uint8_t)0x00)
+#define LCD_ERROR ((uint8_t)0x01)
+
+#define LCD_RELOAD_IMMEDIATE ((uint32_t)LTDC_SRCR_IMR)
+#define LCD_RELOAD_VERTICAL_BLANKING ((uint32_t)LTDC_SRCR_VBR)
+
+typedef struct {
+    int16_t X;
+    int16_t Y;
+} Point, *pPoint;
+
+typedef enum {
+    CENTER_MODE = 0x01,
+    RIGHT_MODE = 0x02,
+    LEFT_MODE = 0x03
+} Text_AlignModeTypdef;
+
+#define LCD_COLOR_BLUE ((uint32_t)0xFF0000FF)
+#define LCD_COLOR_GREEN ((uint32_t)0xFF00FF00)
+#define LCD_COLOR_RED ((uint32_t)0xFFFF0000)
+#define LCD_COLOR_CYAN ((uint32_t)0xFF00FFFF)
+#define LCD_COLOR_MAGENTA ((uint32_t)0xFFFF00FF)
+#define LCD_COLOR_YELLOW ((uint32_t)0xFFFFFF00)
+#define LCD_COLOR_LIGHTBLUE ((uint32_t)0xFF8080FF)
+#define LCD_COLOR_LIGHTGREEN ((uint32_t)0xFF80FF80)
+#define LCD_COLOR_LIGHTRED ((uint32_t)0xFFFF8080)
+#define LCD_COLOR_LIGHTCYAN ((uint32_t)0xFF80FFFF)
+#define LCD_COLOR_LIGHTMAGENTA ((uint32_t)0xFFFF80FF)
+#define LCD_COLOR_LIGHTYELLOW ((uint32_t)0xFFFFFF80)
+#define LCD_COLOR_DARKBLUE ((uint32_t)0xFF000080)
+#define LCD_COLOR_DARKGREEN ((uint32_t)0xFF008000)
+#define LCD_COLOR_DARKRED ((uint32_t)0xFF800000)
+#define LCD_COLOR_DARKCYAN ((uint32_t)0xFF008080)
+#define LCD_COLOR_DARKMAGENTA ((uint32_t)0xFF800080)
+#define LCD_COLOR_DARKYELLOW ((uint32_t)0xFF808000)
+#define LCD_COLOR_WHITE ((uint32_t)0xFFFFFFFF)
+#define LCD_COLOR_LIGHTGRAY ((uint32_t)0xFFD3D3D3)
+#define LCD_COLOR_GRAY ((uint32_t)0xFF808080)
+#define LCD_COLOR_DARKGRAY ((uint32_t)0xFF404040)
+#define LCD_COLOR_BLACK ((uint32_t)0xFF000000)
+#define LCD_COLOR_BROWN ((uint32_t)0xFFA52A2A)
+#define LCD_COLOR_ORANGE ((uint32_t)0xFFFFA500)
+#define LCD_COLOR_TRANSPARENT ((uint32_t)0xFF000000)
+
+uint8_t BSP_LCD_Init(void);
+uint32_t BSP_LCD_GetXSize(void);
+uint32_t BSP_LCD_GetYSize(void);
+
+void BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FrameBuffer);
+void BSP_LCD_LayerRgb565Init(uint16_t LayerIndex, uint32_t FB_Address);
+void BSP_LCD_SelectLayer(uint32_t LayerIndex);
+void BSP_LCD_SetLayerVisible(uint32_t LayerIndex, FunctionalState State);
+void BSP_LCD_SetTransparency(uint32_t LayerIndex, uint8_t Transparency);
+void BSP_LCD_SetLayerAddress(uint32_t LayerIndex, uint32_t Address);
+void BSP_LCD_SetLayerWindow(uint16_t LayerIndex, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void BSP_LCD_SetLayerVisible_NoReload(uint32_t LayerIndex, FunctionalState State);
+void BSP_LCD_SetTransparency_NoReload(uint32_t LayerIndex, uint8_t Transparency);
+void BSP_LCD_SetLayerAddress_NoReload(uint32_t LayerIndex, uint32_t Address);
+void BSP_LCD_Reload(uint32_t ReloadType);
+
+void BSP_LCD_SetTextColor(uint32_t Color);
+uint32_t BSP_LCD_GetTextColor(void);
+void BSP_LCD_SetBackColor(uint32_t Color);
+uint32_t BSP_LCD_GetBackColor(void);
+void BSP_LCD_SetFont(sFONT *fonts);
+sFONT *BSP_LCD_GetFont(void);
+
+uint32_t BSP_LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos);
+void BSP_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t pixel);
+void BSP_LCD_Clear(uint32_t Color);
+void BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode);
+void BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii);
+
+void BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length);
+void BSP_LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+void BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void BSP_LCD_FillPolygon(pPoint Points, uint16_t PointCount);
+void BSP_LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius);
+
+void BSP_LCD_DisplayOff(void);
+void BSP_LCD_DisplayOn(void);
+
+#endif //STM32_FLAC_PLAYER_HOST_STM32746G_DISCOVERY_LCD_H
@@ -0,0 +1,34 @@
+#ifndef STM32_FLAC_PLAYER_HOST_STM32746G_DISCOVERY_TS_H
+#define STM32_FLAC_PLAYER_HOST_STM32746G_DISCOVERY_TS_H
+
+// Touch screen driven by the simulation script
+
+#include <stdint.h>
+
+#define TS_MAX_NB_TOUCH ((uint32_t) 5)
+// The EXTI line of the panel interrupt, passed to HAL_GPIO_EXTI_Callback
+#define TS_INT_PIN ((uint16_t) 0x2000)
+
+typedef struct {
+    uint8_t touchDetected;
+    uint16_t touchX[TS_MAX_NB_TOUCH];
+    uint16_t touchY[TS_MAX_NB_TOUCH];
+    uint8_t touchWeight[TS_MAX_NB_TOUCH];
+    uint8_t touchEventId[TS_MAX_NB_TOUCH];
+    uint8_t touchArea[TS_MAX_NB_TOUCH];
+    uint32_t gestureId;
+} TS_StateTypeDef;
+
+typedef enum {
+    TS_OK = 0x00,
+    TS_ERROR = 0x01,
+    TS_TIMEOUT = 0x02,
+    TS_DEVICE_NOT_FOUND = 0x03
+} TS_StatusTypeDef;
+
+uint8_t BSP_TS_Init(uint16_t ts_SizeX, uint16_t ts_SizeY);
+uint8_t BSP_TS_GetState(TS_StateTypeDef *TS_State);
+// From then on every touch the script starts raises the panel interrupt
+uint8_t BSP_TS_ITConfig(void);
+
+#endif //STM32_FLAC_PLAYER_HOST_STM32746G_DISCOVERY_TS_H
@@ -0,0 +1,156 @@
+#ifndef STM32_FLAC_PLAYER_HOST_STM32F7XX_HAL_H
+#define STM32_FLAC_PLAYER_HOST_STM32F7XX_HAL_H
+
+// The part of the HAL the player sources touch, backed by the simulator clock
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define __IO volatile
+#define __weak __attribute__((weak))
+
+typedef enum {
+    DISABLE = 0,
+    ENABLE = !DISABLE
+} FunctionalState;
+
+typedef enum {
+    HAL_OK = 0x00,
+    HAL_ERROR = 0x01,
+    HAL_BUSY = 0x02,
+    HAL_TIMEOUT = 0x03
+} HAL_StatusTypeDef;
+
+// Only the status register is modelled, the simulated panel raises VSYNCS once per refresh
+typedef struct {
+    __IO uint32_t CDSR;
+} LTDC_TypeDef;
+
+#define LTDC_CDSR_VSYNCS (1u << 2)
+#define LTDC_SRCR_IMR (1u << 0)
+#define LTDC_SRCR_VBR (1u << 1)
+
+extern LTDC_TypeDef sim_ltdc;
+#define LTDC (&sim_ltdc)
+
+// Layer configuration through the HAL, for what the BSP has no call for
+#define LTDC_PIXEL_FORMAT_ARGB8888 0x00000000u
+#define LTDC_PIXEL_FORMAT_RGB565 0x00000002u
+#define LTDC_PIXEL_FORMAT_L8 0x00000005u
+
+#define LTDC_BLENDING_FACTOR1_CA 0x00000400u
+#define LTDC_BLENDING_FACTOR1_PAxCA 0x00000600u
+#define LTDC_BLENDING_FACTOR2_CA 0x00000005u
+#define LTDC_BLENDING_FACTOR2_PAxCA 0x00000007u
+
+#define LTDC_RELOAD_IMMEDIATE LTDC_SRCR_IMR
+#define LTDC_RELOAD_VERTICAL_BLANKING LTDC_SRCR_VBR
+
+#define MAX_LTDC_LAYER 2u
+
+typedef struct {
+    uint8_t Blue;
+    uint8_t Green;
+    uint8_t Red;
+} LTDC_ColorTypeDef;
+
+typedef struct {
+    uint32_t WindowX0;
+    uint32_t WindowX1;
+    uint32_t WindowY0;
+    uint32_t WindowY1;
+    uint32_t PixelFormat;
+    uint32_t Alpha;
+    uint32_t Alpha0;
+    uint32_t BlendingFactor1;
+    uint32_t BlendingFactor2;
+    uint32_t FBStartAdress;
+    uint32_t ImageWidth;
+    uint32_t ImageHeight;
+    LTDC_ColorTypeDef Backcolor;
+} LTDC_LayerCfgTypeDef;
+
+// Only the timing the player reads back
+typedef struct {
+    uint32_t AccumulatedActiveH;
+} LTDC_InitTypeDef;
+
+typedef struct {
+    LTDC_InitTypeDef Init;
+    LTDC_LayerCfgTypeDef LayerCfg[MAX_LTDC_LAYER];
+} LTDC_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_LTDC_ConfigLayer(LTDC_HandleTypeDef *hltdc, LTDC_LayerCfgTypeDef *pLayerCfg, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_ConfigCLUT(LTDC_HandleTypeDef *hltdc, uint32_t *pCLUT, uint32_t CLUTSize, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_EnableCLUT(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx);
+
+// Layer changes made without a reload stay in the shadow registers until one; a reload at vertical blanking
+// and the line event are delivered by the emulated panel at the start of its blanking period
+HAL_StatusTypeDef HAL_LTDC_Reload(LTDC_HandleTypeDef *hltdc, uint32_t ReloadType);
+HAL_StatusTypeDef HAL_LTDC_ProgramLineEvent(LTDC_HandleTypeDef *hltdc, uint32_t Line);
+void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc);
+void HAL_LTDC_ReloadEventCallback(LTDC_HandleTypeDef *hltdc);
+
+// The SAI transmit DMA, only its item counter is modelled, by the emulated SAI
+typedef struct {
+    uint32_t stream;
+} DMA_HandleTypeDef;
+
+typedef struct {
+    DMA_HandleTypeDef *hdmatx;
+} SAI_HandleTypeDef;
+
+uint32_t sim_dma_get_counter(const DMA_HandleTypeDef *hdma);
+#define __HAL_DMA_GET_COUNTER(__HANDLE__) sim_dma_get_counter(__HANDLE__)
+
+// The DMA2D with the modes and formats the player uses, emulated by a thread that calls the completion callback
+#define DMA2D_M2M 0x00000000u
+#define DMA2D_M2M_PFC 0x00010000u
+#define DMA2D_M2M_BLEND 0x00020000u
+#define DMA2D_R2M 0x00030000u
+
+#define DMA2D_OUTPUT_ARGB8888 0x00000000u
+#define DMA2D_OUTPUT_RGB565 0x00000002u
+#define DMA2D_INPUT_ARGB8888 0x00000000u
+#define DMA2D_INPUT_RGB565 0x00000002u
+#define DMA2D_INPUT_A8 0x00000009u
+
+#define DMA2D_NO_MODIF_ALPHA 0x00000000u
+
+#define MAX_DMA2D_LAYER 2u
+
+typedef struct {
+    uint32_t Mode;
+    uint32_t ColorMode;
+    uint32_t OutputOffset;
+} DMA2D_InitTypeDef;
+
+typedef struct {
+    uint32_t InputOffset;
+    uint32_t InputColorMode;
+    uint32_t AlphaMode;
+    uint32_t InputAlpha;
+} DMA2D_LayerCfgTypeDef;
+
+typedef struct __DMA2D_HandleTypeDef {
+    DMA2D_InitTypeDef Init;
+    void (*XferCpltCallback)(struct __DMA2D_HandleTypeDef *hdma2d);
+    void (*XferErrorCallback)(struct __DMA2D_HandleTypeDef *hdma2d);
+    DMA2D_LayerCfgTypeDef LayerCfg[MAX_DMA2D_LAYER];
+} DMA2D_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_DMA2D_Init(DMA2D_HandleTypeDef *hdma2d);
+HAL_StatusTypeDef HAL_DMA2D_ConfigLayer(DMA2D_HandleTypeDef *hdma2d, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_DMA2D_Start_IT(DMA2D_HandleTypeDef *hdma2d, uint32_t pdata, uint32_t DstAddress, uint32_t Width,
+                                     uint32_t Height);
+HAL_StatusTypeDef HAL_DMA2D_BlendingStart_IT(DMA2D_HandleTypeDef *hdma2d, uint32_t SrcAddress1, uint32_t SrcAddress2,
+                                             uint32_t DstAddress, uint32_t Width, uint32_t Height);
+HAL_StatusTypeDef HAL_DMA2D_Abort(DMA2D_HandleTypeDef *hdma2d);
+
+// Called by the emulated touch panel when a touch starts, from the script thread as from an interrupt
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
+
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+
+#endif //STM32_FLAC_PLAYER_HOST_STM32F7XX_HAL_H
@@ -0,0 +1,115 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "png.h"
+
+// Stored deflate blocks hold at most 65535 bytes each
+#define DEFLATE_STORED_BLOCK 65535
+
+static uint32_t crc_table[256];
+
+static void init_crc_table(void) {
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        crc_table[n] = c;
+    }
+}
+
+static uint32_t crc_update(uint32_t crc, const uint8_t *data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        crc = crc_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+static void put_u32(uint8_t *out, uint32_t value) {
+    out[0] = value >> 24;
+    out[1] = value >> 16;
+    out[2] = value >> 8;
+    out[3] = value;
+}
+
+static void write_chunk(FILE *file, const char *type, const uint8_t *data, uint32_t size) {
+    uint8_t header[8];
+    put_u32(header, size);
+    for (int i = 0; i < 4; i++) header[4 + i] = type[i];
+    fwrite(header, 1, 8, file);
+    if (size != 0) {
+        fwrite(data, 1, size, file);
+    }
+
+    uint8_t crc[4];
+    put_u32(crc, crc_update(crc_update(0xFFFFFFFFu, header + 4, 4), data, size) ^ 0xFFFFFFFFu);
+    fwrite(crc, 1, 4, file);
+}
+
+int png_write_argb8888(const char *path, const uint32_t *pixels, unsigned width, unsigned height) {
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    if (crc_table[1] == 0) init_crc_table();
+
+    // Each scanline is a filter byte (none) followed by RGB triples
+    const size_t raw_size = (size_t) height * (1 + width * 3);
+    const size_t blocks = (raw_size + DEFLATE_STORED_BLOCK - 1) / DEFLATE_STORED_BLOCK;
+    const size_t zlib_size = 2 + blocks * 5 + raw_size + 4;
+    uint8_t *raw = malloc(raw_size);
+    uint8_t *zlib = malloc(zlib_size);
+    FILE *file = fopen(path, "wb");
+    if (raw == NULL || zlib == NULL || file == NULL) {
+        free(raw);
+        free(zlib);
+        if (file != NULL) fclose(file);
+        return 1;
+    }
+
+    uint8_t *out = raw;
+    for (unsigned y = 0; y < height; y++) {
+        *out++ = 0;
+        for (unsigned x = 0; x < width; x++) {
+            uint32_t pixel = pixels[y * width + x];
+            *out++ = pixel >> 16;
+            *out++ = pixel >> 8;
+            *out++ = pixel;
+        }
+    }
+
+    uint32_t adler_a = 1, adler_b = 0;
+    for (size_t i = 0; i < raw_size; i++) {
+        adler_a = (adler_a + raw[i]) % 65521;
+        adler_b = (adler_b + adler_a) % 65521;
+    }
+
+    out = zlib;
+    *out++ = 0x78;
+    *out++ = 0x01;
+    for (size_t offset = 0; offset < raw_size; offset += DEFLATE_STORED_BLOCK) {
+        uint16_t length = raw_size - offset < DEFLATE_STORED_BLOCK ? raw_size - offset : DEFLATE_STORED_BLOCK;
+        *out++ = offset + length == raw_size;
+        *out++ = length;
+        *out++ = length >> 8;
+        *out++ = ~length;
+        *out++ = (uint16_t) ~length >> 8;
+        for (uint16_t i = 0; i < length; i++) *out++ = raw[offset + i];
+    }
+    put_u32(out, adler_b << 16 | adler_a);
+
+    uint8_t header[13];
+    put_u32(header, width);
+    put_u32(header + 4, height);
+    header[8] = 8;  // bit depth
+    header[9] = 2;  // RGB
+    header[10] = header[11] = header[12] = 0;
+
+    fwrite(signature, 1, sizeof(signature), file);
+    write_chunk(file, "IHDR", header, sizeof(header));
+    write_chunk(file, "IDAT", zlib, zlib_size);
+    write_chunk(file, "IEND", NULL, 0);
+
+    int result = ferror(file) ? 1 : 0;
+    fclose(file);
+    free(raw);
+    free(zlib);
+    return result;
+}
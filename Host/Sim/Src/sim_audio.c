@@ -0,0 +1,234 @@
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "logger.h"
+#include "sim.h"
+#include "stm32746g_discovery_audio.h"
+
+// The codec is set up for 16-bit stereo, which is what the SAI slots carry
+#define AUDIO_FRAME_BYTES (2 * AUDIODATA_SIZE)
+#define WAV_HEADER_SIZE 44
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t state_changed = PTHREAD_COND_INITIALIZER;
+
+static uint32_t frequency = AUDIO_FREQUENCY_44K;
+static const uint8_t *buffer;
+static uint32_t buffer_size;
+static bool running = false;
+// Which half the emulated DMA is reading, when it started it, and the next slice of it to send
+static unsigned current_half;
+static uint64_t half_start_ns;
+static unsigned next_slice;
+static uint64_t paused_at_ns;
+static unsigned generation = 0;
+
+static DMA_HandleTypeDef sai_dma;
+SAI_HandleTypeDef haudio_out_sai = {.hdmatx = &sai_dma};
+
+static SimAudioStats stats;
+static FILE *wav;
+static uint32_t wav_data_size;
+
+static uint64_t half_period_ns(void) {
+    return (uint64_t) (buffer_size / 2) * 1000000000ull / ((uint64_t) frequency * AUDIO_FRAME_BYTES);
+}
+
+static unsigned slice_size(void) {
+    return buffer_size / 2 / SIM_AUDIO_SLICES;
+}
+
+static void put_u16(uint8_t *out, uint16_t value) {
+    out[0] = value;
+    out[1] = value >> 8;
+}
+
+static void put_u32(uint8_t *out, uint32_t value) {
+    put_u16(out, value);
+    put_u16(out + 2, value >> 16);
+}
+
+static void write_wav_header(void) {
+    uint8_t header[WAV_HEADER_SIZE];
+    memcpy(header, "RIFF", 4);
+    put_u32(header + 4, 36 + wav_data_size);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    put_u32(header + 16, 16);
+    put_u16(header + 20, 1);
+    put_u16(header + 22, 2);
+    put_u32(header + 24, frequency);
+    put_u32(header + 28, frequency * AUDIO_FRAME_BYTES);
+    put_u16(header + 32, AUDIO_FRAME_BYTES);
+    put_u16(header + 34, 16);
+    memcpy(header + 36, "data", 4);
+    put_u32(header + 40, wav_data_size);
+
+    fseek(wav, 0, SEEK_SET);
+    fwrite(header, 1, sizeof(header), wav);
+    fseek(wav, 0, SEEK_END);
+}
+
+// Captures a slice as the DMA starts sending it, so data written after that point is heard as a glitch
+static void capture_slice(unsigned half, unsigned slice) {
+    if (wav == NULL) return;
+    fwrite(buffer + half * (buffer_size / 2) + slice * slice_size(), 1, slice_size(), wav);
+    wav_data_size += slice_size();
+}
+
+static void *sai_thread(void *argument) {
+    pthread_mutex_lock(&lock);
+    while (true) {
+        while (!running) {
+            pthread_cond_wait(&state_changed, &lock);
+        }
+
+        const unsigned waited_generation = generation;
+        const uint64_t deadline = half_start_ns + half_period_ns() * next_slice / SIM_AUDIO_SLICES;
+        pthread_mutex_unlock(&lock);
+        sim_sleep_until_ns(deadline);
+        pthread_mutex_lock(&lock);
+
+        // Paused, stopped or restarted while sleeping
+        if (!running || generation != waited_generation) continue;
+
+        if (next_slice < SIM_AUDIO_SLICES) {
+            capture_slice(current_half, next_slice++);
+            continue;
+        }
+
+        const uint64_t delay = sim_time_ns() - deadline;
+        if (delay > stats.max_wakeup_delay_ns) stats.max_wakeup_delay_ns = delay;
+        if (delay > SIM_AUDIO_LATE_WAKEUP_US * 1000ull) stats.late_wakeups++;
+        stats.half_transfers++;
+
+        const unsigned finished_half = current_half;
+        current_half ^= 1;
+        half_start_ns = deadline;
+        capture_slice(current_half, 0);
+        next_slice = 1;
+
+        pthread_mutex_unlock(&lock);
+        if (finished_half == 0) {
+            BSP_AUDIO_OUT_HalfTransfer_CallBack();
+        } else {
+            BSP_AUDIO_OUT_TransferComplete_CallBack();
+        }
+        pthread_mutex_lock(&lock);
+    }
+    return NULL;
+}
+
+// Half-words left to the end of the buffer, the DMA moves one frame at a time at the sample rate
+uint32_t sim_dma_get_counter(const DMA_HandleTypeDef *hdma) {
+    pthread_mutex_lock(&lock);
+    uint32_t counter = 0;
+    if (buffer != NULL) {
+        const uint64_t now = running ? sim_time_ns() : paused_at_ns;
+        uint64_t elapsed = now > half_start_ns ? now - half_start_ns : 0;
+        if (elapsed > half_period_ns()) elapsed = half_period_ns();
+        uint32_t position = (uint32_t) ((uint64_t) frequency * elapsed / 1000000000ull) * AUDIO_FRAME_BYTES;
+        position += current_half * (buffer_size / 2);
+        counter = (buffer_size - position) / AUDIODATA_SIZE;
+    }
+    pthread_mutex_unlock(&lock);
+    return counter;
+}
+
+uint8_t BSP_AUDIO_OUT_Init(uint16_t OutputDevice, uint8_t Volume, uint32_t AudioFreq) {
+    pthread_mutex_lock(&lock);
+    frequency = AudioFreq;
+    pthread_mutex_unlock(&lock);
+    return AUDIO_OK;
+}
+
+uint8_t BSP_AUDIO_OUT_Play(uint16_t *pBuffer, uint32_t Size) {
+    pthread_mutex_lock(&lock);
+    buffer = (const uint8_t *) pBuffer;
+    buffer_size = Size;
+    current_half = 0;
+    half_start_ns = sim_time_ns();
+    running = true;
+    generation++;
+    capture_slice(0, 0);
+    next_slice = 1;
+    pthread_cond_signal(&state_changed);
+    pthread_mutex_unlock(&lock);
+    return AUDIO_OK;
+}
+
+uint8_t BSP_AUDIO_OUT_Pause(void) {
+    pthread_mutex_lock(&lock);
+    if (running) {
+        paused_at_ns = sim_time_ns();
+        running = false;
+        generation++;
+    }
+    pthread_mutex_unlock(&lock);
+    return AUDIO_OK;
+}
+
+uint8_t BSP_AUDIO_OUT_Resume(void) {
+    pthread_mutex_lock(&lock);
+    // Play already starts the transfer, resuming a running stream does nothing like on the board
+    if (!running && buffer != NULL) {
+        half_start_ns += sim_time_ns() - paused_at_ns;
+        running = true;
+        generation++;
+        pthread_cond_signal(&state_changed);
+    }
+    pthread_mutex_unlock(&lock);
+    return AUDIO_OK;
+}
+
+uint8_t BSP_AUDIO_OUT_Stop(uint32_t Option) {
+    pthread_mutex_lock(&lock);
+    running = false;
+    buffer = NULL;
+    generation++;
+    pthread_mutex_unlock(&lock);
+    return AUDIO_OK;
+}
+
+uint8_t BSP_AUDIO_OUT_SetVolume(uint8_t Volume) {
+    return AUDIO_OK;
+}
+
+void BSP_AUDIO_OUT_SetFrequency(uint32_t AudioFreq) {
+    pthread_mutex_lock(&lock);
+    frequency = AudioFreq;
+    pthread_mutex_unlock(&lock);
+}
+
+void BSP_AUDIO_OUT_SetAudioFrameSlot(uint32_t AudioFrameSlot) {
+}
+
+int sim_audio_start(const char *wav_path) {
+    if (wav_path != NULL) {
+        wav = fopen(wav_path, "wb");
+        if (wav == NULL) {
+            log_error("Cannot create %s", wav_path);
+            return 1;
+        }
+        write_wav_header();
+    }
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, sai_thread, NULL);
+    pthread_detach(thread);
+    return 0;
+}
+
+void sim_audio_finish(SimAudioStats *result) {
+    pthread_mutex_lock(&lock);
+    running = false;
+    generation++;
+    *result = stats;
+    if (wav != NULL) {
+        write_wav_header();
+        fclose(wav);
+        wav = NULL;
+    }
+    pthread_mutex_unlock(&lock);
+}
@@ -0,0 +1,47 @@
+#include "cmsis_os.h"
+#include "diskio.h"
+
+#include "logger.h"
+#include "sd_async.h"
+#include "sim.h"
+
+// Background maintenance stand-in: sweeps the card like an integrity check would, as fast as the scheduler lets it
+
+#define SECTOR_SIZE 512
+
+static unsigned chunk_sectors;
+
+static void background_task(void const *argument) {
+    static uint8_t buffer[SIM_BACKGROUND_MAX_CHUNK_KB * 1024];
+    DWORD sector_count = 0;
+
+    // The SD task starts with the first mount
+    while (sd_async_set_thread_class(SD_CLASS_BACKGROUND) != 0) {
+        osDelay(100);
+    }
+    disk_ioctl(0, GET_SECTOR_COUNT, &sector_count);
+    log_info("Background load: reading %u KB at a time", chunk_sectors * SECTOR_SIZE / 1024);
+
+    DWORD sector = 0;
+    while (true) {
+        sd_async_throttle();
+        if (sector + chunk_sectors > sector_count) {
+            sector = 0;
+        }
+        if (disk_read(0, buffer, sector, chunk_sectors) != RES_OK) {
+            log_error("Background read of sector %lu failed", (unsigned long) sector);
+            return;
+        }
+        sector += chunk_sectors;
+    }
+}
+
+int sim_background_start(unsigned chunk_kb) {
+    if (chunk_kb == 0 || chunk_kb > SIM_BACKGROUND_MAX_CHUNK_KB) {
+        log_error("Background chunk must be 1 to %d KB", SIM_BACKGROUND_MAX_CHUNK_KB);
+        return 1;
+    }
+    chunk_sectors = chunk_kb * 1024 / SECTOR_SIZE;
+    osThreadDef(sim_background, background_task, osPriorityBelowNormal, 0, 1024);
+    return osThreadCreate(osThread(sim_background), NULL) != NULL ? 0 : 1;
+}
@@ -0,0 +1,286 @@
+#include <glob.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "block_cache.h"
+#include "bsp_driver_sd.h"
+#include "logger.h"
+#include "sd_async.h"
+#include "sd_bus.h"
+#include "sim.h"
+
+// Diskio driver over an image file, laid out like FATFS/Target/sd_diskio.c: the card side is the BSP SD API,
+// driven by the same SD task as on the board
+
+#define SIM_SECTOR_SIZE 512
+#define SIM_BLOCK_SIZE 512
+#define COPY_CHUNK_SIZE 32768
+
+static FILE *image;
+static DWORD sector_count;
+static volatile DSTATUS Stat = STA_NOINIT;
+static SimDiskStats stats;
+static unsigned latency_command_us;
+static unsigned latency_sector_us;
+static unsigned stall_ms;
+static unsigned stall_period;
+
+static DSTATUS SIM_initialize(BYTE lun);
+static DSTATUS SIM_status(BYTE lun);
+static DRESULT SIM_read(BYTE lun, BYTE *buff, DWORD sector, UINT count);
+static DRESULT SIM_write(BYTE lun, const BYTE *buff, DWORD sector, UINT count);
+static DRESULT SIM_ioctl(BYTE lun, BYTE cmd, void *buff);
+
+const Diskio_drvTypeDef SIM_Driver = {
+        SIM_initialize,
+        SIM_status,
+        SIM_read,
+        SIM_write,
+        SIM_ioctl,
+};
+
+static DSTATUS SIM_initialize(BYTE lun) {
+    Stat = image != NULL ? 0 : STA_NOINIT | STA_NODISK;
+    if (Stat == 0 && (sd_async_init() != 0 || block_cache_init(sector_count) != 0)) {
+        Stat |= STA_NOINIT;
+    }
+    return Stat;
+}
+
+static DSTATUS SIM_status(BYTE lun) {
+    return Stat;
+}
+
+static void wait_for_card(UINT count) {
+    if (latency_command_us != 0 || latency_sector_us != 0) {
+        sim_sleep_until_ns(sim_time_ns() + 1000ull * (latency_command_us + latency_sector_us * count));
+    }
+}
+
+static DRESULT SIM_read(BYTE lun, BYTE *buff, DWORD sector, UINT count) {
+    return block_cache_read(buff, sector, count);
+}
+
+static DRESULT SIM_write(BYTE lun, const BYTE *buff, DWORD sector, UINT count) {
+    return block_cache_write(buff, sector, count);
+}
+
+uint8_t BSP_SD_ReadBlocks_DMA(uint32_t *pData, uint32_t ReadAddr, uint32_t NumOfBlocks) {
+    wait_for_card(NumOfBlocks);
+    if (stall_period != 0 && (stats.reads + 1) % stall_period == 0) {
+        sim_sleep_until_ns(sim_time_ns() + 1000000ull * stall_ms);
+    }
+    if (ReadAddr + NumOfBlocks > sector_count ||
+        fseek(image, (long) ReadAddr * SIM_SECTOR_SIZE, SEEK_SET) != 0 ||
+        fread(pData, SIM_SECTOR_SIZE, NumOfBlocks, image) != NumOfBlocks) {
+        return MSD_ERROR;
+    }
+    stats.reads++;
+    stats.sectors_read += NumOfBlocks;
+    BSP_SD_ReadCpltCallback();
+    return MSD_OK;
+}
+
+uint8_t BSP_SD_WriteBlocks_DMA(uint32_t *pData, uint32_t WriteAddr, uint32_t NumOfBlocks) {
+    wait_for_card(NumOfBlocks);
+    if (WriteAddr + NumOfBlocks > sector_count ||
+        fseek(image, (long) WriteAddr * SIM_SECTOR_SIZE, SEEK_SET) != 0 ||
+        fwrite(pData, SIM_SECTOR_SIZE, NumOfBlocks, image) != NumOfBlocks) {
+        return MSD_ERROR;
+    }
+    stats.writes++;
+    stats.sectors_written += NumOfBlocks;
+    BSP_SD_WriteCpltCallback();
+    return MSD_OK;
+}
+
+// The image has a single bus mode and reports no CRC errors or timeouts, a failed transfer is simply retried
+int sd_bus_fall_back(uint32_t error) {
+    return 0;
+}
+
+void sd_bus_transfer_done(void) {
+}
+
+void sd_bus_recover(void) {
+}
+
+void sd_bus_get_info(SdBusInfo *info) {
+    info->mode = "simulated";
+    info->clock_khz = 0;
+    info->errors = 0;
+    info->fallbacks = 0;
+    info->recoveries = 0;
+}
+
+uint8_t BSP_SD_GetCardState(void) {
+    return SD_TRANSFER_OK;
+}
+
+void BSP_SD_WriteCpltCallback(void) {
+    sd_async_complete_from_isr();
+}
+
+void BSP_SD_ReadCpltCallback(void) {
+    sd_async_complete_from_isr();
+}
+
+static DRESULT SIM_ioctl(BYTE lun, BYTE cmd, void *buff) {
+    if (Stat & STA_NOINIT) return RES_NOTRDY;
+
+    switch (cmd) {
+        case CTRL_SYNC:
+            return fflush(image) == 0 ? RES_OK : RES_ERROR;
+        case GET_SECTOR_COUNT:
+            *(DWORD *) buff = sector_count;
+            return RES_OK;
+        case GET_SECTOR_SIZE:
+            *(WORD *) buff = SIM_SECTOR_SIZE;
+            return RES_OK;
+        case GET_BLOCK_SIZE:
+            *(DWORD *) buff = SIM_BLOCK_SIZE / SIM_SECTOR_SIZE;
+            return RES_OK;
+        default:
+            return RES_PARERR;
+    }
+}
+
+uint8_t BSP_SD_IsDetected(void) {
+    return image != NULL ? SD_PRESENT : SD_NOT_PRESENT;
+}
+
+DWORD get_fattime(void) {
+    time_t now = time(NULL);
+    struct tm *local = localtime(&now);
+    return (DWORD) (local->tm_year - 80) << 25 | (DWORD) (local->tm_mon + 1) << 21 |
+           (DWORD) local->tm_mday << 16 | (DWORD) local->tm_hour << 11 |
+           (DWORD) local->tm_min << 5 | (DWORD) local->tm_sec >> 1;
+}
+
+void sim_disk_set_latency(unsigned command_us, unsigned sector_us) {
+    latency_command_us = command_us;
+    latency_sector_us = sector_us;
+}
+
+void sim_disk_set_stalls(unsigned new_stall_ms, unsigned period) {
+    stall_ms = new_stall_ms;
+    stall_period = period;
+}
+
+void sim_disk_get_stats(SimDiskStats *disk_stats) {
+    *disk_stats = stats;
+}
+
+int sim_disk_open(const char *image_path) {
+    image = fopen(image_path, "r+b");
+    if (image == NULL) {
+        log_error("Cannot open image %s", image_path);
+        return 1;
+    }
+    fseek(image, 0, SEEK_END);
+    sector_count = (DWORD) (ftell(image) / SIM_SECTOR_SIZE);
+    return 0;
+}
+
+static int copy_into_image(const char *source_path, const char *image_directory);
+
+// Directories are copied with everything inside them, to build cards with a real library layout
+static int copy_directory_into_image(const char *source_path, const char *name) {
+    char pattern[1024];
+    glob_t entries;
+    if (f_mkdir(name) != FR_OK) {
+        log_error("Cannot create directory %s in the image", name);
+        return 1;
+    }
+
+    // glob() instead of readdir(), <dirent.h> clashes with the FatFs DIR type
+    snprintf(pattern, sizeof(pattern), "%s/*", source_path);
+    if (glob(pattern, 0, NULL, &entries) != 0) {
+        return 0;
+    }
+    int result = 0;
+    for (size_t i = 0; i < entries.gl_pathc && result == 0; i++) {
+        result = copy_into_image(entries.gl_pathv[i], name);
+    }
+    globfree(&entries);
+    return result;
+}
+
+static int copy_into_image(const char *source_path, const char *image_directory) {
+    static BYTE chunk[COPY_CHUNK_SIZE];
+    const char *base_name = strrchr(source_path, '/');
+    base_name = base_name != NULL ? base_name + 1 : source_path;
+    char name[512];
+    snprintf(name, sizeof(name), "%s/%s", image_directory, base_name);
+
+    struct stat source_stat;
+    if (stat(source_path, &source_stat) == 0 && S_ISDIR(source_stat.st_mode)) {
+        return copy_directory_into_image(source_path, name);
+    }
+
+    FILE *source = fopen(source_path, "rb");
+    if (source == NULL) {
+        log_error("Cannot open %s", source_path);
+        return 1;
+    }
+
+    FIL file;
+    if (f_open(&file, name, FA_CREATE_ALWAYS | FA_WRITE) != FR_OK) {
+        log_error("Cannot create %s in the image", name);
+        fclose(source);
+        return 1;
+    }
+
+    int result = 0;
+    size_t bytes_read;
+    while (result == 0 && (bytes_read = fread(chunk, 1, sizeof(chunk), source)) > 0) {
+        UINT bytes_written;
+        if (f_write(&file, chunk, (UINT) bytes_read, &bytes_written) != FR_OK || bytes_written != bytes_read) {
+            log_error("Image is full while copying %s", name);
+            result = 1;
+        }
+    }
+
+    f_close(&file);
+    fclose(source);
+    if (result == 0) log_debug("Added %s", name);
+    return result;
+}
+
+// Creates a FAT volume with f_mkfs, the same code path the firmware links, and copies the files to its root
+int sim_make_image(const char *image_path, unsigned size_mb, char *const *files, int files_count) {
+    static BYTE work[_MAX_SS];
+    static FATFS fs;
+    char path[4];
+
+    image = fopen(image_path, "w+b");
+    if (image == NULL) {
+        log_error("Cannot create image %s", image_path);
+        return 1;
+    }
+    sector_count = (DWORD) ((uint64_t) size_mb * 1024 * 1024 / SIM_SECTOR_SIZE);
+    if (fseek(image, (long) sector_count * SIM_SECTOR_SIZE - 1, SEEK_SET) != 0 || fputc(0, image) == EOF) {
+        log_error("Cannot size image %s", image_path);
+        return 1;
+    }
+
+    if (FATFS_LinkDriver(&SIM_Driver, path) != 0 ||
+        f_mkfs(path, FM_ANY, 0, work, sizeof(work)) != FR_OK ||
+        f_mount(&fs, path, 1) != FR_OK) {
+        log_error("Cannot format image %s", image_path);
+        return 1;
+    }
+
+    int result = 0;
+    for (int i = 0; i < files_count && result == 0; i++) {
+        result = copy_into_image(files[i], "");
+    }
+
+    f_mount(NULL, path, 0);
+    FATFS_UnLinkDriver(path);
+    fclose(image);
+    image = NULL;
+    return result;
+}
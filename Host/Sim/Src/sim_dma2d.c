@@ -0,0 +1,181 @@
+#include <pthread.h>
+#include <stdbool.h>
+
+#include "stm32f7xx_hal.h"
+
+// Defined by main.c on the board
+DMA2D_HandleTypeDef hdma2d;
+
+// What the registers hold once a transfer starts, later changes to the handle do not affect it
+typedef struct {
+    DMA2D_HandleTypeDef *handle;
+    DMA2D_InitTypeDef init;
+    DMA2D_LayerCfgTypeDef layers[MAX_DMA2D_LAYER];
+    uint32_t foreground;
+    uint32_t background;
+    uint32_t destination;
+    uint32_t width;
+    uint32_t height;
+} SimTransfer;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t state_changed = PTHREAD_COND_INITIALIZER;
+static pthread_once_t start_once = PTHREAD_ONCE_INIT;
+static SimTransfer transfer;
+static bool busy = false;
+
+// Channels widen by repeating their top bits, as the pixel format converter does
+static uint32_t rgb565_to_argb8888(uint16_t pixel) {
+    const uint32_t red = pixel >> 11, green = (pixel >> 5) & 0x3F, blue = pixel & 0x1F;
+    return 0xFF000000 | (red << 3 | red >> 2) << 16 | (green << 2 | green >> 4) << 8 | (blue << 3 | blue >> 2);
+}
+
+static uint16_t argb8888_to_rgb565(uint32_t pixel) {
+    return (pixel >> 8 & 0xF800) | (pixel >> 5 & 0x07E0) | (pixel >> 3 & 0x001F);
+}
+
+static uint32_t read_pixel(const DMA2D_LayerCfgTypeDef *layer, uint32_t address, uint32_t x, uint32_t y,
+                           uint32_t width) {
+    const uint32_t index = y * (width + layer->InputOffset) + x;
+    if (layer->InputColorMode == DMA2D_INPUT_A8) {
+        const uint8_t alpha = ((const uint8_t *) (uintptr_t) address)[index];
+        return (uint32_t) alpha << 24 | (layer->InputAlpha & 0x00FFFFFF);
+    }
+    if (layer->InputColorMode == DMA2D_INPUT_RGB565) {
+        return rgb565_to_argb8888(((const uint16_t *) (uintptr_t) address)[index]);
+    }
+    return ((const uint32_t *) (uintptr_t) address)[index];
+}
+
+static void write_pixel(const DMA2D_InitTypeDef *init, uint32_t address, uint32_t index, uint32_t pixel) {
+    if (init->ColorMode == DMA2D_OUTPUT_RGB565) {
+        ((uint16_t *) (uintptr_t) address)[index] = argb8888_to_rgb565(pixel);
+    } else {
+        ((uint32_t *) (uintptr_t) address)[index] = pixel;
+    }
+}
+
+// Porter-Duff over, the formula of the reference manual
+static uint32_t blend(uint32_t foreground, uint32_t background) {
+    const uint32_t alpha_foreground = foreground >> 24;
+    const uint32_t alpha_background = background >> 24;
+    const uint32_t alpha_mult = alpha_foreground * alpha_background / 255;
+    const uint32_t alpha = alpha_foreground + alpha_background - alpha_mult;
+    if (alpha == 0) {
+        return 0;
+    }
+    uint32_t result = alpha << 24;
+    for (int shift = 0; shift < 24; shift += 8) {
+        const uint32_t color_foreground = (foreground >> shift) & 0xFF;
+        const uint32_t color_background = (background >> shift) & 0xFF;
+        const uint32_t color = (color_foreground * alpha_foreground + color_background * alpha_background -
+                                color_background * alpha_mult) / alpha;
+        result |= color << shift;
+    }
+    return result;
+}
+
+static void run(const SimTransfer *t) {
+    for (uint32_t y = 0; y < t->height; y++) {
+        const uint32_t line = y * (t->width + t->init.OutputOffset);
+        for (uint32_t x = 0; x < t->width; x++) {
+            uint32_t pixel;
+            switch (t->init.Mode) {
+                case DMA2D_R2M:
+                    pixel = t->foreground;
+                    break;
+                case DMA2D_M2M_BLEND:
+                    pixel = blend(read_pixel(&t->layers[1], t->foreground, x, y, t->width),
+                                  read_pixel(&t->layers[0], t->background, x, y, t->width));
+                    break;
+                default:
+                    pixel = read_pixel(&t->layers[1], t->foreground, x, y, t->width);
+                    break;
+            }
+            write_pixel(&t->init, t->destination, line + x, pixel);
+        }
+    }
+}
+
+static void *dma2d_thread(void *argument) {
+    pthread_mutex_lock(&lock);
+    while (true) {
+        while (!busy) {
+            pthread_cond_wait(&state_changed, &lock);
+        }
+        const SimTransfer current = transfer;
+        pthread_mutex_unlock(&lock);
+        run(&current);
+
+        pthread_mutex_lock(&lock);
+        busy = false;
+        pthread_cond_broadcast(&state_changed);
+        pthread_mutex_unlock(&lock);
+        // The transfer complete interrupt
+        if (current.handle->XferCpltCallback != NULL) {
+            current.handle->XferCpltCallback(current.handle);
+        }
+        pthread_mutex_lock(&lock);
+    }
+    return NULL;
+}
+
+static void start_thread(void) {
+    pthread_t thread;
+    pthread_create(&thread, NULL, dma2d_thread, NULL);
+    pthread_detach(thread);
+}
+
+static HAL_StatusTypeDef start(DMA2D_HandleTypeDef *hdma2d, uint32_t foreground, uint32_t background,
+                               uint32_t destination, uint32_t width, uint32_t height) {
+    pthread_once(&start_once, start_thread);
+    pthread_mutex_lock(&lock);
+    if (busy) {
+        pthread_mutex_unlock(&lock);
+        return HAL_BUSY;
+    }
+    transfer = (SimTransfer) {
+            .handle = hdma2d,
+            .init = hdma2d->Init,
+            .foreground = foreground,
+            .background = background,
+            .destination = destination,
+            .width = width,
+            .height = height
+    };
+    for (uint32_t i = 0; i < MAX_DMA2D_LAYER; i++) {
+        transfer.layers[i] = hdma2d->LayerCfg[i];
+    }
+    busy = true;
+    pthread_cond_broadcast(&state_changed);
+    pthread_mutex_unlock(&lock);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA2D_Init(DMA2D_HandleTypeDef *hdma2d) {
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA2D_ConfigLayer(DMA2D_HandleTypeDef *hdma2d, uint32_t LayerIdx) {
+    return LayerIdx < MAX_DMA2D_LAYER ? HAL_OK : HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_DMA2D_Start_IT(DMA2D_HandleTypeDef *hdma2d, uint32_t pdata, uint32_t DstAddress, uint32_t Width,
+                                     uint32_t Height) {
+    return start(hdma2d, pdata, 0, DstAddress, Width, Height);
+}
+
+HAL_StatusTypeDef HAL_DMA2D_BlendingStart_IT(DMA2D_HandleTypeDef *hdma2d, uint32_t SrcAddress1, uint32_t SrcAddress2,
+                                             uint32_t DstAddress, uint32_t Width, uint32_t Height) {
+    return start(hdma2d, SrcAddress1, SrcAddress2, DstAddress, Width, Height);
+}
+
+// The emulated transfer cannot be stopped halfway, it is waited for
+HAL_StatusTypeDef HAL_DMA2D_Abort(DMA2D_HandleTypeDef *hdma2d) {
+    pthread_mutex_lock(&lock);
+    while (busy) {
+        pthread_cond_wait(&state_changed, &lock);
+    }
+    pthread_mutex_unlock(&lock);
+    return HAL_OK;
+}
@@ -0,0 +1,100 @@
+#include <pthread.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "dbgu.h"
+#include "sim.h"
+#include "stm32746g_discovery_ts.h"
+#include "stm32f7xx_hal.h"
+
+#define KEY_QUEUE_SIZE 64
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+// The finger moves in a straight line from the start to the end position while it is down
+static uint16_t touch_x, touch_y, touch_end_x, touch_end_y;
+static uint64_t touch_start_ns = 0, touch_release_ns = 0;
+// A tap without a hold time lasts until the player has sampled it once
+static bool touch_single_sample = false;
+static bool interrupt_enabled = false;
+
+static char key_queue[KEY_QUEUE_SIZE];
+static unsigned key_head = 0, key_tail = 0;
+
+uint8_t BSP_TS_Init(uint16_t ts_SizeX, uint16_t ts_SizeY) {
+    return TS_OK;
+}
+
+uint8_t BSP_TS_ITConfig(void) {
+    pthread_mutex_lock(&lock);
+    interrupt_enabled = true;
+    pthread_mutex_unlock(&lock);
+    return TS_OK;
+}
+
+__weak void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
+}
+
+static uint16_t interpolate(uint16_t start, uint16_t end, uint64_t now_ns) {
+    if (now_ns >= touch_release_ns || touch_release_ns == touch_start_ns) {
+        return end;
+    }
+    const double done = (double) (now_ns - touch_start_ns) / (double) (touch_release_ns - touch_start_ns);
+    return (uint16_t) (start + (end - start) * done);
+}
+
+// Coordinates read as zero while nothing touches the panel, instead of whatever the caller's stack held
+uint8_t BSP_TS_GetState(TS_StateTypeDef *TS_State) {
+    memset(TS_State, 0, sizeof(*TS_State));
+    pthread_mutex_lock(&lock);
+    const uint64_t now_ns = sim_time_ns();
+    if (touch_single_sample || now_ns < touch_release_ns) {
+        TS_State->touchDetected = 1;
+        TS_State->touchX[0] = interpolate(touch_x, touch_end_x, now_ns);
+        TS_State->touchY[0] = interpolate(touch_y, touch_end_y, now_ns);
+        touch_single_sample = false;
+    }
+    pthread_mutex_unlock(&lock);
+    return TS_OK;
+}
+
+void sim_touch_swipe(uint16_t x, uint16_t y, uint16_t end_x, uint16_t end_y, unsigned hold_ms) {
+    pthread_mutex_lock(&lock);
+    touch_x = x;
+    touch_y = y;
+    touch_end_x = end_x;
+    touch_end_y = end_y;
+    touch_start_ns = sim_time_ns();
+    touch_release_ns = touch_start_ns + (uint64_t) hold_ms * 1000000;
+    touch_single_sample = hold_ms == 0;
+    const bool interrupt = interrupt_enabled;
+    pthread_mutex_unlock(&lock);
+    // The panel raises its interrupt when a touch starts, the player reads it on from there
+    if (interrupt) {
+        HAL_GPIO_EXTI_Callback(TS_INT_PIN);
+    }
+}
+
+void sim_touch_press(uint16_t x, uint16_t y, unsigned hold_ms) {
+    sim_touch_swipe(x, y, x, y, hold_ms);
+}
+
+char debug_inkey(void) {
+    char key = 0;
+    pthread_mutex_lock(&lock);
+    if (key_head != key_tail) {
+        key = key_queue[key_tail];
+        key_tail = (key_tail + 1) % KEY_QUEUE_SIZE;
+    }
+    pthread_mutex_unlock(&lock);
+    return key;
+}
+
+void sim_console_key(char key) {
+    pthread_mutex_lock(&lock);
+    if ((key_head + 1) % KEY_QUEUE_SIZE != key_tail) {
+        key_queue[key_head] = key;
+        key_head = (key_head + 1) % KEY_QUEUE_SIZE;
+    }
+    pthread_mutex_unlock(&lock);
+}
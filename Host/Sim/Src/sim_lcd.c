@@ -0,0 +1,538 @@
+#include <pthread.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "png.h"
+#include "sim.h"
+#include "stm32746g_discovery_lcd.h"
+
+#define ABS(x) ((x) > 0 ? (x) : -(x))
+
+typedef struct {
+    uint8_t *frame_buffer;
+    uint32_t format;
+    // Window on the panel, the frame buffer holds its width times height pixels
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    // Constant alpha, multiplied with the pixel alpha when the layers are blended
+    uint8_t alpha;
+    bool clut_enabled;
+    uint32_t clut[256];
+    bool visible;
+    uint32_t text_color;
+    uint32_t back_color;
+    sFONT *font;
+} SimLayer;
+
+LTDC_TypeDef sim_ltdc;
+LTDC_HandleTypeDef hLtdcHandler;
+
+// The layers as the BSP and the HAL configure them, the shadow registers, and as the panel scans them
+// out, the registers they are loaded into by a reload
+static SimLayer layers[MAX_LAYER_NUMBER];
+static SimLayer shown[MAX_LAYER_NUMBER];
+static pthread_mutex_t shown_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t active_layer = 0;
+static volatile bool reload_pending = false;
+static volatile bool line_event_armed = false;
+
+// Walks a Bresenham line the way the BSP does, used by lines and triangle fills alike
+typedef struct {
+    int16_t x, y;
+    int16_t xinc1, xinc2, yinc1, yinc2;
+    int16_t den, num, num_add, num_pixels;
+} LineWalker;
+
+static LineWalker line_walker(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    int16_t deltax = ABS(x2 - x1);
+    int16_t deltay = ABS(y2 - y1);
+    LineWalker walker = {
+            .x = x1,
+            .y = y1,
+            .xinc1 = x2 >= x1 ? 1 : -1,
+            .yinc1 = y2 >= y1 ? 1 : -1
+    };
+    walker.xinc2 = walker.xinc1;
+    walker.yinc2 = walker.yinc1;
+
+    if (deltax >= deltay) {
+        walker.xinc1 = 0;
+        walker.yinc2 = 0;
+        walker.den = deltax;
+        walker.num = deltax / 2;
+        walker.num_add = deltay;
+        walker.num_pixels = deltax;
+    } else {
+        walker.xinc2 = 0;
+        walker.yinc1 = 0;
+        walker.den = deltay;
+        walker.num = deltay / 2;
+        walker.num_add = deltax;
+        walker.num_pixels = deltay;
+    }
+    return walker;
+}
+
+static void line_walker_step(LineWalker *walker) {
+    walker->num += walker->num_add;
+    if (walker->num >= walker->den) {
+        walker->num -= walker->den;
+        walker->x += walker->xinc1;
+        walker->y += walker->yinc1;
+    }
+    walker->x += walker->xinc2;
+    walker->y += walker->yinc2;
+}
+
+static unsigned bytes_per_pixel(uint32_t format) {
+    switch (format) {
+        case LTDC_PIXEL_FORMAT_RGB565:
+            return 2;
+        case LTDC_PIXEL_FORMAT_L8:
+            return 1;
+        default:
+            return 4;
+    }
+}
+
+// Channels widen by repeating their top bits, as the LTDC does
+static uint32_t read_argb8888(const SimLayer *layer, unsigned index) {
+    switch (layer->format) {
+        case LTDC_PIXEL_FORMAT_RGB565: {
+            const uint16_t pixel = ((const uint16_t *) layer->frame_buffer)[index];
+            const uint32_t red = pixel >> 11, green = (pixel >> 5) & 0x3F, blue = pixel & 0x1F;
+            return 0xFF000000 | (red << 3 | red >> 2) << 16 | (green << 2 | green >> 4) << 8 | (blue << 3 | blue >> 2);
+        }
+        case LTDC_PIXEL_FORMAT_L8: {
+            const uint8_t pixel = layer->frame_buffer[index];
+            return 0xFF000000 | (layer->clut_enabled ? layer->clut[pixel] : pixel * 0x010101u);
+        }
+        default:
+            return ((const uint32_t *) layer->frame_buffer)[index];
+    }
+}
+
+// The DMA2D on the board does not clip, writes outside the layer are dropped here instead. The value is
+// written as BSP_LCD_DrawPixel does: whole, or cut to 16 bits on an RGB565 layer.
+static inline void put_pixel(int x, int y, uint32_t value) {
+    SimLayer *layer = &layers[active_layer];
+    if (x < 0 || y < 0 || x >= layer->width || y >= layer->height || layer->frame_buffer == NULL) return;
+    const unsigned index = y * layer->width + x;
+    switch (bytes_per_pixel(layer->format)) {
+        case 2:
+            ((uint16_t *) layer->frame_buffer)[index] = (uint16_t) value;
+            break;
+        case 1:
+            layer->frame_buffer[index] = (uint8_t) value;
+            break;
+        default:
+            ((uint32_t *) layer->frame_buffer)[index] = value;
+            break;
+    }
+}
+
+// Fills go through the DMA2D, which converts the color to the layer format
+static void fill_area(int x, int y, int width, int height, uint32_t color) {
+    if (layers[active_layer].format == LTDC_PIXEL_FORMAT_RGB565) {
+        color = (color >> 8 & 0xF800) | (color >> 5 & 0x07E0) | (color >> 3 & 0x001F);
+    }
+    for (int row = y; row < y + height; row++) {
+        for (int column = x; column < x + width; column++) {
+            put_pixel(column, row, color);
+        }
+    }
+}
+
+static void reload(void) {
+    pthread_mutex_lock(&shown_lock);
+    memcpy(shown, layers, sizeof(shown));
+    pthread_mutex_unlock(&shown_lock);
+}
+
+static void fill_triangle(uint16_t x1, uint16_t x2, uint16_t x3, uint16_t y1, uint16_t y2, uint16_t y3) {
+    LineWalker walker = line_walker(x1, y1, x2, y2);
+    for (int16_t pixel = 0; pixel <= walker.num_pixels; pixel++) {
+        BSP_LCD_DrawLine(walker.x, walker.y, x3, y3);
+        line_walker_step(&walker);
+    }
+}
+
+static void draw_char(uint16_t x, uint16_t y, const uint8_t *c) {
+    const SimLayer *layer = &layers[active_layer];
+    const uint16_t height = layer->font->Height;
+    const uint16_t width = layer->font->Width;
+    const unsigned bytes_per_line = (width + 7) / 8;
+    const uint8_t offset = 8 * bytes_per_line - width;
+
+    for (uint16_t i = 0; i < height; i++) {
+        const uint8_t *pchar = c + bytes_per_line * i;
+        uint32_t line = 0;
+        for (unsigned byte = 0; byte < bytes_per_line && byte < 3; byte++) {
+            line = line << 8 | pchar[byte];
+        }
+        for (uint16_t j = 0; j < width; j++) {
+            bool set = line & (1u << (width - j + offset - 1));
+            put_pixel(x + j, y + i, set ? layer->text_color : layer->back_color);
+        }
+    }
+}
+
+uint8_t BSP_LCD_Init(void) {
+    for (uint32_t i = 0; i < MAX_LAYER_NUMBER; i++) {
+        layers[i] = (SimLayer) {
+                .width = RK043FN48H_WIDTH,
+                .height = RK043FN48H_HEIGHT,
+                .alpha = 255,
+                .text_color = LCD_COLOR_BLACK,
+                .back_color = LCD_COLOR_WHITE,
+                .font = &Font24
+        };
+    }
+    hLtdcHandler.Init.AccumulatedActiveH = RK043FN48H_HEIGHT + 10 + 2 - 1;
+    reload();
+    return LCD_OK;
+}
+
+// The size of the active layer, like the BSP reads it from the layer configuration
+uint32_t BSP_LCD_GetXSize(void) {
+    return layers[active_layer].width;
+}
+
+uint32_t BSP_LCD_GetYSize(void) {
+    return layers[active_layer].height;
+}
+
+// Frame buffer addresses travel as uint32_t like on the board, the simulator is linked without PIE
+static void init_layer(uint16_t index, uint32_t frame_buffer, uint32_t format) {
+    layers[index] = (SimLayer) {
+            .frame_buffer = (uint8_t *) (uintptr_t) frame_buffer,
+            .format = format,
+            .width = RK043FN48H_WIDTH,
+            .height = RK043FN48H_HEIGHT,
+            .alpha = 255,
+            .visible = true,
+            .text_color = LCD_COLOR_BLACK,
+            .back_color = LCD_COLOR_WHITE,
+            .font = &Font24
+    };
+    reload();
+}
+
+void BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FrameBuffer) {
+    init_layer(LayerIndex, FrameBuffer, LTDC_PIXEL_FORMAT_ARGB8888);
+}
+
+void BSP_LCD_LayerRgb565Init(uint16_t LayerIndex, uint32_t FB_Address) {
+    init_layer(LayerIndex, FB_Address, LTDC_PIXEL_FORMAT_RGB565);
+}
+
+void BSP_LCD_SetTransparency_NoReload(uint32_t LayerIndex, uint8_t Transparency) {
+    layers[LayerIndex].alpha = Transparency;
+}
+
+void BSP_LCD_SetTransparency(uint32_t LayerIndex, uint8_t Transparency) {
+    BSP_LCD_SetTransparency_NoReload(LayerIndex, Transparency);
+    reload();
+}
+
+void BSP_LCD_SetLayerAddress_NoReload(uint32_t LayerIndex, uint32_t Address) {
+    layers[LayerIndex].frame_buffer = (uint8_t *) (uintptr_t) Address;
+}
+
+void BSP_LCD_SetLayerAddress(uint32_t LayerIndex, uint32_t Address) {
+    BSP_LCD_SetLayerAddress_NoReload(LayerIndex, Address);
+    reload();
+}
+
+// The frame buffer line becomes the window width, as with HAL_LTDC_SetWindowSize
+void BSP_LCD_SetLayerWindow(uint16_t LayerIndex, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height) {
+    SimLayer *layer = &layers[LayerIndex];
+    layer->x = Xpos;
+    layer->y = Ypos;
+    layer->width = Width;
+    layer->height = Height;
+    reload();
+}
+
+HAL_StatusTypeDef HAL_LTDC_ConfigLayer(LTDC_HandleTypeDef *hltdc, LTDC_LayerCfgTypeDef *pLayerCfg, uint32_t LayerIdx) {
+    hltdc->LayerCfg[LayerIdx] = *pLayerCfg;
+    init_layer(LayerIdx, pLayerCfg->FBStartAdress, pLayerCfg->PixelFormat);
+    SimLayer *layer = &layers[LayerIdx];
+    layer->x = pLayerCfg->WindowX0;
+    layer->y = pLayerCfg->WindowY0;
+    layer->width = pLayerCfg->ImageWidth;
+    layer->height = pLayerCfg->ImageHeight;
+    layer->alpha = pLayerCfg->Alpha;
+    reload();
+    return HAL_OK;
+}
+
+// Entries are 0x00RRGGBB
+HAL_StatusTypeDef HAL_LTDC_ConfigCLUT(LTDC_HandleTypeDef *hltdc, uint32_t *pCLUT, uint32_t CLUTSize, uint32_t LayerIdx) {
+    for (uint32_t i = 0; i < CLUTSize && i < 256; i++) {
+        layers[LayerIdx].clut[i] = pCLUT[i] & 0x00FFFFFF;
+    }
+    reload();
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_EnableCLUT(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx) {
+    layers[LayerIdx].clut_enabled = true;
+    reload();
+    return HAL_OK;
+}
+
+// Both kinds of reload raise the reload interrupt once done
+HAL_StatusTypeDef HAL_LTDC_Reload(LTDC_HandleTypeDef *hltdc, uint32_t ReloadType) {
+    if (ReloadType == LTDC_RELOAD_VERTICAL_BLANKING) {
+        reload_pending = true;
+        return HAL_OK;
+    }
+    reload();
+    HAL_LTDC_ReloadEventCallback(hltdc);
+    return HAL_OK;
+}
+
+// Every line event fires at the start of the vertical blanking, it is one-shot like on the board
+HAL_StatusTypeDef HAL_LTDC_ProgramLineEvent(LTDC_HandleTypeDef *hltdc, uint32_t Line) {
+    line_event_armed = true;
+    return HAL_OK;
+}
+
+__weak void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc) {
+}
+
+__weak void HAL_LTDC_ReloadEventCallback(LTDC_HandleTypeDef *hltdc) {
+}
+
+void BSP_LCD_Reload(uint32_t ReloadType) {
+    HAL_LTDC_Reload(&hLtdcHandler, ReloadType);
+}
+
+void BSP_LCD_SelectLayer(uint32_t LayerIndex) {
+    active_layer = LayerIndex;
+}
+
+void BSP_LCD_SetLayerVisible_NoReload(uint32_t LayerIndex, FunctionalState State) {
+    layers[LayerIndex].visible = State == ENABLE;
+}
+
+void BSP_LCD_SetLayerVisible(uint32_t LayerIndex, FunctionalState State) {
+    BSP_LCD_SetLayerVisible_NoReload(LayerIndex, State);
+    reload();
+}
+
+void BSP_LCD_SetTextColor(uint32_t Color) {
+    layers[active_layer].text_color = Color;
+}
+
+uint32_t BSP_LCD_GetTextColor(void) {
+    return layers[active_layer].text_color;
+}
+
+void BSP_LCD_SetBackColor(uint32_t Color) {
+    layers[active_layer].back_color = Color;
+}
+
+uint32_t BSP_LCD_GetBackColor(void) {
+    return layers[active_layer].back_color;
+}
+
+void BSP_LCD_SetFont(sFONT *fonts) {
+    layers[active_layer].font = fonts;
+}
+
+sFONT *BSP_LCD_GetFont(void) {
+    return layers[active_layer].font;
+}
+
+uint32_t BSP_LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos) {
+    const SimLayer *layer = &layers[active_layer];
+    if (Xpos >= layer->width || Ypos >= layer->height || layer->frame_buffer == NULL) return 0;
+    const unsigned index = Ypos * layer->width + Xpos;
+    switch (bytes_per_pixel(layer->format)) {
+        case 2:
+            return ((const uint16_t *) layer->frame_buffer)[index];
+        case 1:
+            return layer->frame_buffer[index];
+        default:
+            return ((const uint32_t *) layer->frame_buffer)[index];
+    }
+}
+
+void BSP_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t pixel) {
+    put_pixel(Xpos, Ypos, pixel);
+}
+
+void BSP_LCD_Clear(uint32_t Color) {
+    fill_area(0, 0, layers[active_layer].width, layers[active_layer].height, Color);
+}
+
+void BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii) {
+    const sFONT *font = layers[active_layer].font;
+    draw_char(Xpos, Ypos, &font->table[(Ascii - ' ') * font->Height * ((font->Width + 7) / 8)]);
+}
+
+void BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode) {
+    const sFONT *font = layers[active_layer].font;
+    const uint32_t size = strlen((const char *) Text);
+    const uint32_t xsize = BSP_LCD_GetXSize() / font->Width;
+    uint16_t ref_column;
+
+    switch (Mode) {
+        case CENTER_MODE:
+            ref_column = Xpos + ((xsize - size) * font->Width) / 2;
+            break;
+        case RIGHT_MODE:
+            ref_column = -Xpos + ((xsize - size) * font->Width);
+            break;
+        default:
+            ref_column = Xpos;
+            break;
+    }
+    if (ref_column < 1 || ref_column >= 0x8000) {
+        ref_column = 1;
+    }
+
+    // Same cut-off as the BSP: characters stop once the remaining width is narrower than one glyph
+    for (uint32_t i = 0; *Text != 0 && ((BSP_LCD_GetXSize() - i * font->Width) & 0xFFFF) >= font->Width; i++) {
+        BSP_LCD_DisplayChar(ref_column, Ypos, *Text++);
+        ref_column += font->Width;
+    }
+}
+
+void BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length) {
+    fill_area(Xpos, Ypos, Length, 1, layers[active_layer].text_color);
+}
+
+void BSP_LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    LineWalker walker = line_walker(x1, y1, x2, y2);
+    for (int16_t pixel = 0; pixel <= walker.num_pixels; pixel++) {
+        put_pixel((uint16_t) walker.x, (uint16_t) walker.y, layers[active_layer].text_color);
+        line_walker_step(&walker);
+    }
+}
+
+void BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height) {
+    fill_area(Xpos, Ypos, Width, Height, layers[active_layer].text_color);
+}
+
+void BSP_LCD_FillPolygon(pPoint Points, uint16_t PointCount) {
+    if (PointCount < 2) return;
+
+    uint16_t left = Points->X, right = Points->X, top = Points->Y, bottom = Points->Y;
+    for (uint16_t i = 1; i < PointCount; i++) {
+        if (Points[i].X < left) left = Points[i].X;
+        if (Points[i].X > right) right = Points[i].X;
+        if (Points[i].Y < top) top = Points[i].Y;
+        if (Points[i].Y > bottom) bottom = Points[i].Y;
+    }
+
+    // Fan of triangles around the bounding box center, as the BSP draws it
+    const int16_t x_center = (left + right) / 2;
+    const int16_t y_center = (bottom + top) / 2;
+    const int16_t x_first = Points->X;
+    const int16_t y_first = Points->Y;
+    int16_t x, y, x2 = 0, y2 = 0;
+
+    while (--PointCount) {
+        x = Points->X;
+        y = Points->Y;
+        Points++;
+        x2 = Points->X;
+        y2 = Points->Y;
+
+        fill_triangle(x, x2, x_center, y, y2, y_center);
+        fill_triangle(x, x_center, x2, y, y_center, y2);
+        fill_triangle(x_center, x2, x, y_center, y2, y);
+    }
+
+    fill_triangle(x_first, x2, x_center, y_first, y2, y_center);
+    fill_triangle(x_first, x_center, x2, y_first, y_center, y2);
+    fill_triangle(x_center, x2, x_first, y_center, y2, y_first);
+}
+
+void BSP_LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius) {
+    int x = 0, y = -YRadius, err = 2 - 2 * XRadius, e2;
+    float k = (float) YRadius / (float) XRadius;
+
+    do {
+        BSP_LCD_DrawHLine(Xpos - (uint16_t) (x / k), Ypos + y, 2 * (uint16_t) (x / k) + 1);
+        BSP_LCD_DrawHLine(Xpos - (uint16_t) (x / k), Ypos - y, 2 * (uint16_t) (x / k) + 1);
+
+        e2 = err;
+        if (e2 <= x) {
+            err += ++x * 2 + 1;
+            if (-y == x && e2 <= y) e2 = 0;
+        }
+        if (e2 > y) err += ++y * 2 + 1;
+    } while (y <= 0);
+}
+
+void BSP_LCD_DisplayOff(void) {
+}
+
+void BSP_LCD_DisplayOn(void) {
+}
+
+static void *vsync_thread(void *argument) {
+    const uint64_t frame_ns = 1000000000ull / SIM_LCD_REFRESH_HZ;
+    uint64_t frame_start = sim_time_ns();
+
+    while (true) {
+        sim_sleep_until_ns(frame_start);
+        sim_ltdc.CDSR |= LTDC_CDSR_VSYNCS;
+        if (reload_pending) {
+            reload_pending = false;
+            reload();
+            HAL_LTDC_ReloadEventCallback(&hLtdcHandler);
+        }
+        if (line_event_armed) {
+            line_event_armed = false;
+            HAL_LTDC_LineEventCallback(&hLtdcHandler);
+        }
+        sim_sleep_until_ns(frame_start + SIM_LCD_VSYNC_US * 1000ull);
+        sim_ltdc.CDSR &= ~LTDC_CDSR_VSYNCS;
+        frame_start += frame_ns;
+    }
+    return NULL;
+}
+
+void sim_lcd_start(void) {
+    pthread_t thread;
+    pthread_create(&thread, NULL, vsync_thread, NULL);
+    pthread_detach(thread);
+}
+
+// Blends the visible layers inside their windows the way the LTDC does, over its black background color
+int sim_lcd_dump_png(const char *path) {
+    static uint32_t screen[RK043FN48H_HEIGHT * RK043FN48H_WIDTH];
+
+    pthread_mutex_lock(&shown_lock);
+    for (unsigned i = 0; i < RK043FN48H_HEIGHT * RK043FN48H_WIDTH; i++) {
+        const unsigned x = i % RK043FN48H_WIDTH;
+        const unsigned y = i / RK043FN48H_WIDTH;
+        uint32_t out = 0xFF000000;
+        for (uint32_t index = 0; index < MAX_LAYER_NUMBER; index++) {
+            const SimLayer *layer = &shown[index];
+            if (!layer->visible || layer->frame_buffer == NULL || x < layer->x || y < layer->y ||
+                x >= layer->x + layer->width || y >= layer->y + layer->height) {
+                continue;
+            }
+            uint32_t pixel = read_argb8888(layer, (y - layer->y) * layer->width + x - layer->x);
+            uint32_t alpha = (pixel >> 24) * layer->alpha / 255;
+            uint32_t blended = 0xFF000000;
+            for (int shift = 0; shift < 24; shift += 8) {
+                uint32_t top = (pixel >> shift) & 0xFF;
+                uint32_t bottom = (out >> shift) & 0xFF;
+                blended |= ((top * alpha + bottom * (255 - alpha)) / 255) << shift;
+            }
+            out = blended;
+        }
+        screen[i] = out;
+    }
+    pthread_mutex_unlock(&shown_lock);
+    return png_write_argb8888(path, screen, RK043FN48H_WIDTH, RK043FN48H_HEIGHT);
+}
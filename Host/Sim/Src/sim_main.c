@@ -0,0 +1,158 @@
+#include <getopt.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "controller.h"
+#include "disk_benchmark.h"
+#include "display.h"
+#include "block_cache.h"
+#include "jobs.h"
+#include "logger.h"
+#include "player.h"
+#include "profiler.h"
+#include "raw_file.h"
+#include "sd_async.h"
+#include "sim.h"
+#include "stream_cache.h"
+
+#define DEFAULT_IMAGE_SIZE_MB 64
+#define DEFAULT_WALK_MEMORY_SIZE (64 * 1024)
+#define READ_BENCHMARK_CHUNK_SIZE STREAM_CACHE_CHUNK_SIZE
+
+// Same globals FATFS/App/fatfs.c provides on the board
+char SDPath[4];
+FATFS SDFatFS;
+
+static void print_usage(const char *program) {
+    printf("Usage: %s [-s script] [-o dump_dir] [-w capture.wav] [-L cmd_us,sector_us] [-X ms,period] [-B kb] image.img\n"
+           "       %s -W [-L cmd_us,sector_us] [-M bytes] image.img\n"
+           "       %s -R path [-L cmd_us,sector_us] image.img\n"
+           "       %s -D [-L cmd_us,sector_us] image.img\n"
+           "       %s -m image.img [-S size_mb] file.flac|directory...\n"
+           "Runs the player on a FAT image in real time with the board peripherals simulated.\n\n"
+           "  -s FILE    timed touch/key/dump/quit commands, see Host/Sim/Src/sim_script.c\n"
+           "  -o DIR     where the script dumps screens to relative paths (default: %s)\n"
+           "  -w FILE    record what the emulated SAI sent to the codec\n"
+           "  -m FILE    create a FAT image holding the given files and exit\n"
+           "  -S MB      size of the created image (default: %d)\n"
+           "  -L US,US   SD card latency per command and per sector (default: none)\n"
+           "  -X MS,N    stall every Nth SD read for MS milliseconds\n"
+           "  -B KB      background-class thread sweeping the card KB at a time, throttled while audio streams\n"
+           "  -W         walk every *.flac file of the image, print files/s and exit\n"
+           "  -M BYTES   memory given to the directory walker (default: %d)\n"
+           "  -R PATH    read a file of the image with f_read and raw disk_read, print both and exit\n"
+           "  -D         sequential and random sector reads at several sizes, print MB/s and latencies and exit\n",
+           program, program, program, program, program, SIM_DUMP_DIRECTORY, DEFAULT_IMAGE_SIZE_MB,
+           DEFAULT_WALK_MEMORY_SIZE);
+}
+
+// Same hook Core/Src/freertos.c installs on the board
+void vApplicationIdleHook(void) {
+    jobs_idle_hook();
+}
+
+void sim_finish(void) {
+    SimAudioStats stats;
+    SimDiskStats disk_stats;
+    sim_audio_finish(&stats);
+    sim_disk_get_stats(&disk_stats);
+    const unsigned underruns = get_underrun_count();
+
+    log_info("Simulation finished after %.3f s", sim_time_ns() / 1e9);
+    profiler_print();
+    stream_cache_print_stats();
+    print_skip_latency();
+    block_cache_print_stats();
+    sd_async_print_stats();
+    jobs_print_stats();
+    print_display_stats();
+    log_info("SAI: %u half transfers, %u late timer wakeups (max %.3f ms)",
+             stats.half_transfers, stats.late_wakeups, stats.max_wakeup_delay_ns / 1e6);
+    log_info("SD: %u reads (%llu sectors), %u writes (%llu sectors)",
+             disk_stats.reads, (unsigned long long) disk_stats.sectors_read,
+             disk_stats.writes, (unsigned long long) disk_stats.sectors_written);
+    if (underruns != 0) {
+        log_error("Player missed %u audio deadlines", underruns);
+    } else {
+        log_success("Player met every audio deadline");
+    }
+    fflush(stdout);
+    exit(underruns != 0 ? 1 : 0);
+}
+
+int main(int argc, char **argv) {
+    const char *script_path = NULL;
+    const char *dump_path = SIM_DUMP_DIRECTORY;
+    const char *wav_path = NULL;
+    const char *make_image_path = NULL;
+    unsigned image_size_mb = DEFAULT_IMAGE_SIZE_MB;
+    unsigned walk_memory_size = DEFAULT_WALK_MEMORY_SIZE;
+    bool walk_benchmark = false;
+    const char *read_benchmark_path = NULL;
+    bool disk_benchmark_requested = false;
+    unsigned command_us = 0, sector_us = 0;
+    unsigned stall_ms = 0, stall_period = 0;
+    unsigned background_kb = 0;
+
+    int option;
+    while ((option = getopt(argc, argv, "s:o:w:m:S:L:X:B:WM:R:Dh")) != -1) {
+        switch (option) {
+            case 's': script_path = optarg; break;
+            case 'o': dump_path = optarg; break;
+            case 'w': wav_path = optarg; break;
+            case 'm': make_image_path = optarg; break;
+            case 'S': image_size_mb = (unsigned) atoi(optarg); break;
+            case 'L': sscanf(optarg, "%u,%u", &command_us, &sector_us); break;
+            case 'X': sscanf(optarg, "%u,%u", &stall_ms, &stall_period); break;
+            case 'B': background_kb = (unsigned) atoi(optarg); break;
+            case 'W': walk_benchmark = true; break;
+            case 'R': read_benchmark_path = optarg; break;
+            case 'D': disk_benchmark_requested = true; break;
+            case 'M': walk_memory_size = (unsigned) atoi(optarg); break;
+            default:
+                print_usage(argv[0]);
+                return option == 'h' ? 0 : 2;
+        }
+    }
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    if (make_image_path != NULL) {
+        return sim_make_image(make_image_path, image_size_mb, argv + optind, argc - optind);
+    }
+    if (optind != argc - 1) {
+        print_usage(argv[0]);
+        return 2;
+    }
+
+    // Mirrors MX_FATFS_Init, with the image file in place of the SD card
+    if (sim_disk_open(argv[optind]) != 0) return 2;
+    FATFS_LinkDriver(&SIM_Driver, SDPath);
+    f_mount(&SDFatFS, SDPath, 0);
+    sim_disk_set_latency(command_us, sector_us);
+    sim_disk_set_stalls(stall_ms, stall_period);
+    if (walk_benchmark) {
+        return sim_walk_benchmark("*.flac", walk_memory_size);
+    }
+    if (disk_benchmark_requested) {
+        profiler_init();
+        disk_initialize(0);
+        return disk_benchmark();
+    }
+    if (read_benchmark_path != NULL) {
+        static uint8_t buffer[2 * READ_BENCHMARK_CHUNK_SIZE];
+        return raw_file_benchmark(read_benchmark_path, buffer, READ_BENCHMARK_CHUNK_SIZE);
+    }
+
+    sim_lcd_start();
+    sim_idle_start();
+    if (sim_audio_start(wav_path) != 0) return 2;
+    if (script_path != NULL && sim_script_start(script_path, dump_path) != 0) return 2;
+    if (background_kb != 0 && sim_background_start(background_kb) != 0) return 2;
+
+    controller_task();
+
+    log_error("Controller task returned");
+    sim_finish();
+    return 1;
+}
@@ -0,0 +1,196 @@
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "cmsis_os.h"
+#include "sim.h"
+#include "stm32f7xx_hal.h"
+
+struct SimSemaphore {
+    sem_t semaphore;
+};
+
+struct SimMutex {
+    pthread_mutex_t mutex;
+};
+
+struct SimThread {
+    pthread_t thread;
+    os_pthread function;
+    void *argument;
+};
+
+static uint64_t monotonic_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000ull + now.tv_nsec;
+}
+
+static pthread_once_t start_once = PTHREAD_ONCE_INIT;
+static uint64_t start;
+
+static void init_start(void) {
+    start = monotonic_ns();
+}
+
+static uint64_t start_ns(void) {
+    pthread_once(&start_once, init_start);
+    return start;
+}
+
+uint64_t sim_time_ns(void) {
+    // The origin is set before reading the clock, so the very first call cannot go negative
+    const uint64_t origin = start_ns();
+    return monotonic_ns() - origin;
+}
+
+void sim_sleep_until_ns(uint64_t time_ns) {
+    uint64_t target = start_ns() + time_ns;
+    struct timespec deadline = {
+            .tv_sec = (time_t) (target / 1000000000ull),
+            .tv_nsec = (long) (target % 1000000000ull)
+    };
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR);
+}
+
+uint32_t HAL_GetTick(void) {
+    return (uint32_t) (sim_time_ns() / 1000000);
+}
+
+void HAL_Delay(uint32_t Delay) {
+    sim_sleep_until_ns(sim_time_ns() + (uint64_t) Delay * 1000000);
+}
+
+uint32_t osKernelSysTick(void) {
+    return HAL_GetTick();
+}
+
+osStatus osDelay(uint32_t millisec) {
+    HAL_Delay(millisec);
+    return osOK;
+}
+
+// Threads not started by osThreadCreate, the main one included, get an id on their first call
+static __thread osThreadId current_thread;
+
+static void *run_thread(void *context) {
+    osThreadId thread = context;
+    current_thread = thread;
+    thread->function(thread->argument);
+    return NULL;
+}
+
+osThreadId osThreadCreate(const osThreadDef_t *thread_def, void *argument) {
+    osThreadId thread = malloc(sizeof(struct SimThread));
+    if (thread == NULL) {
+        return NULL;
+    }
+    thread->function = thread_def->pthread;
+    thread->argument = argument;
+    if (pthread_create(&thread->thread, NULL, run_thread, thread) != 0) {
+        free(thread);
+        return NULL;
+    }
+    pthread_detach(thread->thread);
+    return thread;
+}
+
+osThreadId osThreadGetId(void) {
+    if (current_thread == NULL) {
+        current_thread = calloc(1, sizeof(struct SimThread));
+        if (current_thread != NULL) {
+            current_thread->thread = pthread_self();
+        }
+    }
+    return current_thread;
+}
+
+static void idle_task(void const *argument) {
+    while (true) {
+        osDelay(1);
+        vApplicationIdleHook();
+    }
+}
+
+void sim_idle_start(void) {
+    osThreadDef(sim_idle, idle_task, osPriorityIdle, 0, 128);
+    osThreadCreate(osThread(sim_idle), NULL);
+}
+
+osSemaphoreId osSemaphoreCreate(const osSemaphoreDef_t *semaphore_def, int32_t count) {
+    osSemaphoreId semaphore = malloc(sizeof(struct SimSemaphore));
+    if (semaphore == NULL || sem_init(&semaphore->semaphore, 0, (unsigned) count) != 0) {
+        free(semaphore);
+        return NULL;
+    }
+    return semaphore;
+}
+
+int32_t osSemaphoreWait(osSemaphoreId semaphore_id, uint32_t millisec) {
+    if (millisec == osWaitForever) {
+        while (sem_wait(&semaphore_id->semaphore) == -1 && errno == EINTR);
+        return osOK;
+    }
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += millisec / 1000;
+    deadline.tv_nsec += (long) (millisec % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+    int result;
+    while ((result = sem_timedwait(&semaphore_id->semaphore, &deadline)) == -1 && errno == EINTR);
+    return result == 0 ? osOK : osEventTimeout;
+}
+
+osStatus osSemaphoreRelease(osSemaphoreId semaphore_id) {
+    return sem_post(&semaphore_id->semaphore) == 0 ? osOK : osErrorOS;
+}
+
+osStatus osSemaphoreDelete(osSemaphoreId semaphore_id) {
+    sem_destroy(&semaphore_id->semaphore);
+    free(semaphore_id);
+    return osOK;
+}
+
+osMutexId osMutexCreate(const osMutexDef_t *mutex_def) {
+    osMutexId mutex = malloc(sizeof(struct SimMutex));
+    if (mutex == NULL || pthread_mutex_init(&mutex->mutex, NULL) != 0) {
+        free(mutex);
+        return NULL;
+    }
+    return mutex;
+}
+
+osStatus osMutexWait(osMutexId mutex_id, uint32_t millisec) {
+    if (millisec == osWaitForever) {
+        return pthread_mutex_lock(&mutex_id->mutex) == 0 ? osOK : osErrorOS;
+    }
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += millisec / 1000;
+    deadline.tv_nsec += (long) (millisec % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+    return pthread_mutex_timedlock(&mutex_id->mutex, &deadline) == 0 ? osOK : osEventTimeout;
+}
+
+osStatus osMutexRelease(osMutexId mutex_id) {
+    return pthread_mutex_unlock(&mutex_id->mutex) == 0 ? osOK : osErrorOS;
+}
+
+void *pvPortMalloc(size_t size) {
+    return malloc(size);
+}
+
+void vPortFree(void *pointer) {
+    free(pointer);
+}
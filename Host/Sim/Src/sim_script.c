@@ -0,0 +1,96 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "logger.h"
+#include "sim.h"
+
+// Script lines are "<time_ms> <command> [arguments]", run when the simulated clock reaches time_ms:
+//   touch X Y [HOLD_MS]   press the panel at X,Y for HOLD_MS, or for a single touch sample when omitted
+//   swipe X Y X2 Y2 MS    move a finger from X,Y to X2,Y2 over MS, then lift it
+//   key C                 send console key C
+//   dump FILE.png         save the visible screen, a relative path is taken in the dump directory
+//   quit                  print the report and exit
+// Empty lines and lines starting with '#' are ignored.
+
+#define SCRIPT_LINE_LENGTH 256
+
+static FILE *script;
+static const char *script_name;
+static const char *dump_directory;
+
+static int run_command(unsigned line_number, const char *command, const char *arguments) {
+    if (strcmp(command, "touch") == 0) {
+        unsigned x, y, hold_ms = 0;
+        if (sscanf(arguments, "%u %u %u", &x, &y, &hold_ms) < 2) goto invalid;
+        sim_touch_press((uint16_t) x, (uint16_t) y, hold_ms);
+    } else if (strcmp(command, "swipe") == 0) {
+        unsigned x, y, end_x, end_y, hold_ms;
+        if (sscanf(arguments, "%u %u %u %u %u", &x, &y, &end_x, &end_y, &hold_ms) != 5) goto invalid;
+        sim_touch_swipe((uint16_t) x, (uint16_t) y, (uint16_t) end_x, (uint16_t) end_y, hold_ms);
+    } else if (strcmp(command, "key") == 0) {
+        char key;
+        if (sscanf(arguments, " %c", &key) != 1) goto invalid;
+        sim_console_key(key);
+    } else if (strcmp(command, "dump") == 0) {
+        char name[SCRIPT_LINE_LENGTH];
+        char path[2 * SCRIPT_LINE_LENGTH];
+        if (sscanf(arguments, "%255s", name) != 1) goto invalid;
+        snprintf(path, sizeof(path), "%s%s%s", name[0] == '/' ? "" : dump_directory, name[0] == '/' ? "" : "/",
+                 name);
+        if (sim_lcd_dump_png(path) != 0) {
+            log_error("%s:%u: cannot write %s", script_name, line_number, path);
+            return 1;
+        }
+        log_info("Screen saved to %s", path);
+    } else if (strcmp(command, "quit") == 0) {
+        sim_finish();
+    } else {
+        log_error("%s:%u: unknown command '%s'", script_name, line_number, command);
+        return 1;
+    }
+    return 0;
+
+invalid:
+    log_error("%s:%u: invalid arguments for '%s'", script_name, line_number, command);
+    return 1;
+}
+
+static void *script_thread(void *argument) {
+    char line[SCRIPT_LINE_LENGTH];
+    unsigned line_number = 0;
+
+    while (fgets(line, sizeof(line), script) != NULL) {
+        line_number++;
+        unsigned long time_ms;
+        char command[16];
+        int consumed;
+        if (line[strspn(line, " \t\r\n")] == '\0' || line[strspn(line, " \t")] == '#') continue;
+        if (sscanf(line, "%lu %15s %n", &time_ms, command, &consumed) < 2) {
+            log_error("%s:%u: expected '<time_ms> <command>'", script_name, line_number);
+            exit(2);
+        }
+
+        sim_sleep_until_ns((uint64_t) time_ms * 1000000);
+        if (run_command(line_number, command, line + consumed) != 0) exit(2);
+    }
+
+    fclose(script);
+    return NULL;
+}
+
+int sim_script_start(const char *script_path, const char *dump_path) {
+    script = fopen(script_path, "r");
+    if (script == NULL) {
+        log_error("Cannot open script %s", script_path);
+        return 1;
+    }
+    script_name = script_path;
+    dump_directory = dump_path;
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, script_thread, NULL);
+    pthread_detach(thread);
+    return 0;
+}
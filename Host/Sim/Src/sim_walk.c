@@ -0,0 +1,42 @@
+#include <stdlib.h>
+
+#include "block_cache.h"
+#include "dir_walker.h"
+#include "logger.h"
+#include "sim.h"
+
+static void print_progress(const DirWalkerStats *stats, const char *directory, void *context) {
+    log_info("  %u files in %u folders, now in %s", stats->files, stats->directories,
+             directory[0] != '\0' ? directory : "/");
+}
+
+int sim_walk_benchmark(const char *pattern, unsigned memory_size) {
+    static DirWalker walker;
+    const DirWalkerCallbacks callbacks = {
+            .progress = print_progress,
+            .cancelled = NULL,
+            .context = NULL,
+            .progress_interval_ms = 1000
+    };
+    SimDiskStats before, after;
+    void *memory = malloc(memory_size);
+
+    sim_disk_get_stats(&before);
+    const uint64_t start = sim_time_ns();
+    walker_init(&walker, "", pattern, memory, memory_size, &callbacks);
+    DirWalkerEvent event;
+    while ((event = walker_step(&walker)) == DIR_WALKER_DIRECTORY || event == DIR_WALKER_FILE) {
+    }
+    const double seconds = (sim_time_ns() - start) / 1e9;
+    sim_disk_get_stats(&after);
+    free(memory);
+
+    log_info("Walked %u files matching %s in %u folders in %.3f s: %.0f files/s",
+             walker.stats.files, pattern, walker.stats.directories, seconds,
+             seconds > 0 ? walker.stats.files / seconds : 0.0);
+    log_info("SD: %u reads (%llu sectors), stack memory %u of %u bytes, %u folders skipped",
+             after.reads - before.reads, (unsigned long long) (after.sectors_read - before.sectors_read),
+             (unsigned) walker.stats.peak_memory, memory_size, walker.stats.skipped);
+    block_cache_print_stats();
+    return event == DIR_WALKER_DONE ? 0 : 1;
+}
@@ -0,0 +1,6 @@
+#ifndef STM32_FLAC_PLAYER_CONSOLE_H
+#define STM32_FLAC_PLAYER_CONSOLE_H
+
+void handle_console(void);
+
+#endif //STM32_FLAC_PLAYER_CONSOLE_H
@@ -1,6 +1,14 @@
 #ifndef STM32_FLAC_PLAYER_CONTROLLER_H
 
 void controller_task(void);
+// Full library rescan, run by the controller loop between two player updates
+void request_library_rescan(void);
+// Goes back PLAYER_REWIND_SECONDS in the current track, replayed from SDRAM; holding the back button does it too
+void rewind_current_track(void);
+// Reads the current track with f_read and with raw disk_read and prints both throughputs
+void benchmark_current_track(void);
+// Time from a next/previous press to the new track's first audio, and how many skips started from warm heads
+void print_skip_latency(void);
 
 #define STM32_FLAC_PLAYER_CONTROLLER_H
 #endif //STM32_FLAC_PLAYER_CONTROLLER_H
@@ -0,0 +1,79 @@
+#ifndef STM32_FLAC_PLAYER_DIR_WALKER_H
+#define STM32_FLAC_PLAYER_DIR_WALKER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ff.h"
+
+#define DIR_WALKER_MAX_PATH_LENGTH 255
+
+typedef enum {
+    // walker->path is the directory about to be read, walker->date/time its timestamp (0 for the root)
+    DIR_WALKER_DIRECTORY,
+    // walker->file_path and walker->info describe a file matching the pattern
+    DIR_WALKER_FILE,
+    DIR_WALKER_DONE,
+    DIR_WALKER_CANCELLED,
+    // A directory could not be opened or read, the walk stops there
+    DIR_WALKER_ERROR
+} DirWalkerEvent;
+
+typedef struct {
+    uint32_t directories;
+    uint32_t files;
+    // Directories not visited because the pending stack was full or the path too long
+    uint32_t skipped;
+    uint32_t elapsed_ms;
+    // Most of the stack memory used at once
+    size_t peak_memory;
+} DirWalkerStats;
+
+typedef struct {
+    void (*progress)(const DirWalkerStats *stats, const char *directory, void *context);
+    bool (*cancelled)(void *context);
+    void *context;
+    uint32_t progress_interval_ms;
+} DirWalkerCallbacks;
+
+typedef enum {
+    DIR_WALKER_STATE_NEXT_DIRECTORY,
+    DIR_WALKER_STATE_FIRST_FILE,
+    DIR_WALKER_STATE_NEXT_FILE,
+    DIR_WALKER_STATE_FIRST_SUBDIRECTORY,
+    DIR_WALKER_STATE_NEXT_SUBDIRECTORY,
+    DIR_WALKER_STATE_DONE
+} DirWalkerState;
+
+// Depth first walk with an explicit stack of pending directory paths in caller-provided memory.
+// Only one directory is open at a time and nothing is allocated, so memory does not depend on the tree.
+typedef struct {
+    DirWalkerState state;
+    const char *pattern;
+    const DirWalkerCallbacks *callbacks;
+    uint8_t *stack;
+    size_t stack_size;
+    size_t stack_used;
+    uint32_t start_ms;
+    uint32_t last_progress_ms;
+    DIR dir;
+    FILINFO info;
+    uint16_t date;
+    uint16_t time;
+    char path[DIR_WALKER_MAX_PATH_LENGTH + 1];
+    char file_path[DIR_WALKER_MAX_PATH_LENGTH + 1];
+    DirWalkerStats stats;
+} DirWalker;
+
+int walker_init(DirWalker *walker, const char *root, const char *pattern, void *memory, size_t memory_size,
+                const DirWalkerCallbacks *callbacks);
+DirWalkerEvent walker_step(DirWalker *walker);
+
+// Called after DIR_WALKER_DIRECTORY: skip its files but still descend / skip it entirely
+void walker_skip_files(DirWalker *walker);
+void walker_skip_directory(DirWalker *walker);
+
+// Closes the open directory when the walk is abandoned before DIR_WALKER_DONE
+void walker_close(DirWalker *walker);
+
+#endif //STM32_FLAC_PLAYER_DIR_WALKER_H
@@ -0,0 +1,13 @@
+#ifndef STM32_FLAC_PLAYER_DISK_BENCHMARK_H
+#define STM32_FLAC_PLAYER_DISK_BENCHMARK_H
+
+// Largest request measured, the buffer is taken from SDRAM on the first run
+#define DISK_BENCHMARK_MAX_REQUEST_SIZE (64u * 1024u)
+// Requests per test and request size
+#define DISK_BENCHMARK_REQUESTS 256
+
+// Sequential and random raw sector reads at several request sizes, printed as MB/s and latency percentiles.
+// Goes through the SD task only, FatFs is not involved.
+int disk_benchmark(void);
+
+#endif //STM32_FLAC_PLAYER_DISK_BENCHMARK_H
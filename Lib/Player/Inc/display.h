@@ -3,6 +3,11 @@
 
 #ifndef STM32_FLAC_PLAYER_DISPLAY_H
 #define STM32_FLAC_PLAYER_DISPLAY_H
+
+// Frames per second the display task draws at most, a divisor of the panel refresh rate
+#define DISPLAY_FRAME_RATE 30
+// Longer texts are cut when they are handed to the display task
+#define DISPLAY_TEXT_SIZE 128
 typedef struct {
     int x1;
     int y1;
@@ -29,12 +34,47 @@ typedef struct {
     const Point center_position;
     const uint16_t radius;
     const Icon icon;
+    // Buttons are active on release of a tap; those with a hold time only when it was shorter, a longer
+    // one holds them once every hold time
+    const unsigned hold_ms;
+    // When the button was last activated
     unsigned last_changed_state;
+    unsigned pressed_at;
+    unsigned holds;
     bool is_touched;
     bool active;
+    bool held;
     bool disabled;
 } Button;
 
+typedef struct {
+    // Vertical blankings the display task woke at
+    uint32_t refreshes;
+    // Frames swapped in, those that started from a cleared buffer, and frame slots with nothing to draw
+    uint32_t frames;
+    uint32_t full_redraws;
+    uint32_t frames_skipped;
+    // Bounding boxes of what was drawn or copied between the buffers, per frame and in total
+    uint32_t last_pixels;
+    uint32_t max_pixels;
+    uint64_t pixels;
+    uint64_t copied_pixels;
+    // Texts too wide for the screen rendered into their scroll strip, and drawn by copying out of it
+    uint32_t marquee_strips;
+    uint32_t marquee_frames;
+    // Peak overviews of the progress bar drawn into its strip
+    uint32_t peaks_strips;
+    // Library browser rows read as they scrolled into the window and rendered, and frames scrolled by
+    // copying the rows already drawn
+    uint32_t browser_rows_read;
+    uint32_t browser_rows;
+    uint32_t browser_scrolls;
+    // CPU time of the frames drawn, waits for the DMA2D and VSYNC left out
+    uint64_t draw_cycles;
+    // What the LTDC reads from the SDRAM per refresh with the layers shown at the time of the call
+    uint32_t fetch_bytes;
+} DisplayStats;
+
 void initialize_screen();
 
 void render_text(const char *text, int x, int y, sFONT *font, uint32_t color, uint32_t background_color,
@@ -51,12 +91,35 @@ transform_points(Point center_position, const Point *icon_points, uint16_t point
 
 void render_info_screen(const char *info, const char *sub_info);
 
-void render_track_screen(const char *track_name, const char *artist_name, int total_files_count, int current_file_index,
-                         double progress, double duration, bool is_playing);
+void render_track_screen(const char *track_name, const char *artist_name, double progress, bool is_playing);
+
+// Fills the title and the artist and album line of the browser row of the track, at most size bytes each
+typedef void (*BrowserRowReader)(uint32_t index, char *title, char *detail, size_t size);
+
+// The library browser, opened by a tap on the title or the artist of the track screen; it reads the rows it
+// shows through read_row
+void render_browser_screen(uint32_t track_count, uint32_t current_track, BrowserRowReader read_row);
+
+void get_display_stats(DisplayStats *stats);
+void print_display_stats(void);
 
+// Drops the touches not handled yet, and the rest of the one in progress
+void discard_touches(void);
+// A finger is on the panel; touches not handled yet are discarded, so one that cancels a wait never reaches a button
+bool is_screen_touched(void);
 bool is_back_button_active(void);
+bool is_back_button_held(void);
 bool is_next_button_active(void);
 bool is_play_button_active(void);
 bool is_pause_button_active(void);
+// Where on the progress bar a drag was let go, from 0 to 1, reported once
+bool get_seek_request(double *progress);
+bool is_browser_open(void);
+// Back to the track screen, also after a track was picked in the browser or it was swiped away
+void close_browser(void);
+// The track picked in the browser, reported once
+bool get_browser_selection(uint32_t *index);
+// profiler_cycles of the touch that activated the last button or asked for the last seek
+uint32_t get_input_cycles(void);
 
 #endif //STM32_FLAC_PLAYER_DISPLAY_H
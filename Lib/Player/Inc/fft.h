@@ -0,0 +1,18 @@
+#ifndef STM32_FLAC_PLAYER_FFT_H
+#define STM32_FLAC_PLAYER_FFT_H
+
+#include <stdint.h>
+
+// Fixed-point FFT of a real Q15 block through a Hann window: the samples are taken as FFT_SIZE / 2 complex
+// pairs and go through a radix-4 decimation in frequency, scaled down by 4 per stage so nothing overflows,
+// then split into the spectrum of the real block. FFT_SIZE / 2 must be a power of 4.
+#define FFT_SIZE 512
+#define FFT_BINS (FFT_SIZE / 2)
+
+// Fills the twiddle, window and digit reversal tables
+void fft_init(void);
+
+// Power of bins 0 to FFT_BINS - 1 of the block, in units of the scaled output squared
+void fft_real_power(const int16_t samples[FFT_SIZE], uint32_t power[FFT_BINS]);
+
+#endif //STM32_FLAC_PLAYER_FFT_H
@@ -16,19 +16,35 @@ typedef struct {
 } FlacMetaData;
 
 typedef struct {
+    // Of the first sample in the frame, counted from the start of the stream
+    uint64_t sample_number;
     unsigned samples;
     unsigned size;
     uint8_t *buffer;
+    // Lowest and highest sample of all channels, 0 included
+    int32_t min;
+    int32_t max;
 } FlacFrame;
 
+// Supplies the compressed stream, bytes_read is 0 at its end
+typedef int (*FlacReadCallback)(void *context, uint8_t *buffer, unsigned size, unsigned *bytes_read);
+
 typedef struct {
     FLAC__StreamDecoder *decoder;
     FlacMetaData metadata;
     FlacFrame *frame;
-    FIL *file;
+    FlacReadCallback read;
+    void *read_context;
+    // Bytes of the stream handed to the decoder so far, and where the first frame starts once the metadata is read
+    uint64_t stream_position;
+    uint64_t audio_offset;
+    // The decoder searches for a frame after a seek, the lost sync it reports on the way is expected
+    bool resyncing;
 } Flac;
 
+// Decodes straight from an open file
 Flac *create_flac(FIL *input);
+Flac *create_flac_stream(FlacReadCallback read, void *context);
 
 void destroy_flac(Flac *flac);
 
@@ -36,6 +52,10 @@ int read_metadata(Flac *flac, FlacMetaData *metadata);
 
 int read_frame(Flac *flac, FlacFrame *frame);
 
+// The read callback goes on from position, a byte offset in the stream; the decoder drops what it buffered
+// and resumes at the first frame found there
+int seek_flac(Flac *flac, uint64_t position);
+
 void free_frame(FlacFrame *frame);
 
 void free_metadata(FlacMetaData *metadata);
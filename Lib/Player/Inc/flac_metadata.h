@@ -0,0 +1,24 @@
+#ifndef STM32_FLAC_PLAYER_FLAC_METADATA_H
+#define STM32_FLAC_PLAYER_FLAC_METADATA_H
+
+#include <stdint.h>
+#include "ff.h"
+
+#define FLAC_TAG_LENGTH 63
+
+typedef struct {
+    uint64_t total_samples;
+    unsigned sample_rate;
+    unsigned bits_per_sample;
+    unsigned channels;
+    unsigned track_number;
+    char title[FLAC_TAG_LENGTH + 1];
+    char artist[FLAC_TAG_LENGTH + 1];
+    char album[FLAC_TAG_LENGTH + 1];
+} FlacFileInfo;
+
+// Reads STREAMINFO and the TITLE/ARTIST/ALBUM/TRACKNUMBER comments without creating a decoder.
+// Stops after the VORBIS_COMMENT block, so large pictures at the end of the metadata are never read.
+int probe_flac_file(FIL *file, FlacFileInfo *info);
+
+#endif //STM32_FLAC_PLAYER_FLAC_METADATA_H
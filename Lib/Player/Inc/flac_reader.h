@@ -3,14 +3,23 @@
 
 #include "flac_decoder.h"
 
+// Sees every frame the reader decodes, before its samples are read out
+typedef void (*FlacFrameCallback)(const FlacFrame *frame, void *context);
+
 typedef struct {
     Flac* flac;
     FlacFrame *frame;
     unsigned buffer_index;
+    FlacFrameCallback frame_callback;
+    void *frame_context;
 } FlacReader;
 
 FlacReader *create_flac_reader(Flac *flac);
 void free_flac_reader(FlacReader *reader);
+void set_flac_frame_callback(FlacReader *reader, FlacFrameCallback callback, void *context);
 unsigned read_flac(FlacReader *reader, uint8_t  *buffer, unsigned size);
+// Drops what is left of the frame being read, after the decoder was moved with seek_flac, and decodes the
+// first frame at the new position; sample_number is where it starts
+int restart_flac_reader(FlacReader *reader, uint64_t *sample_number);
 
 #endif //STM32_FLAC_PLAYER_FLAC_READER_H
@@ -0,0 +1,36 @@
+#ifndef STM32_FLAC_PLAYER_FONT_H
+#define STM32_FLAC_PLAYER_FONT_H
+
+#include <stdint.h>
+
+// Anti-aliased font atlases in flash, generated by Host/FontGen. A glyph is an A4 bitmap, rows of whole
+// bytes with the left pixel in the high nibble, placed relative to the pen on the baseline.
+
+typedef struct {
+    uint16_t codepoint;
+    uint8_t width;
+    uint8_t height;
+    // From the pen to the left column, and from the baseline up to the top row
+    int8_t left;
+    int8_t top;
+    uint8_t advance;
+    // Into the bitmaps of the font
+    uint32_t offset;
+} FontGlyph;
+
+typedef struct {
+    // Pixels above the baseline, and of a whole line
+    uint8_t ascent;
+    uint8_t height;
+    uint16_t glyph_count;
+    // Sorted by code point
+    const FontGlyph *glyphs;
+    const uint8_t *bitmaps;
+} Font;
+
+// DejaVu Sans
+extern const Font font_sans_13;
+extern const Font font_sans_17;
+extern const Font font_sans_22;
+
+#endif //STM32_FLAC_PLAYER_FONT_H
@@ -0,0 +1,59 @@
+#ifndef STM32_FLAC_PLAYER_GESTURE_H
+#define STM32_FLAC_PLAYER_GESTURE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "touch.h"
+
+// A touch that strays further than this from where it went down is no longer a tap
+#define GESTURE_TAP_SLOP_PX 16
+// A swipe covers this much horizontally within the time, mostly sideways
+#define GESTURE_SWIPE_MIN_PX 80
+#define GESTURE_SWIPE_MAX_MS 600
+
+typedef enum {
+    GESTURE_NONE,
+    // A finger went down outside the drag area
+    GESTURE_PRESS,
+    // It was lifted without straying, at the position it went down
+    GESTURE_TAP,
+    // It strayed without making a swipe, the press is off
+    GESTURE_CANCEL,
+    // A fast sideways stroke, named by the direction the finger moved
+    GESTURE_SWIPE_LEFT,
+    GESTURE_SWIPE_RIGHT,
+    // A finger that went down in the drag area is there or moved, and was lifted
+    GESTURE_DRAG,
+    GESTURE_DRAG_END
+} GestureType;
+
+typedef struct {
+    GestureType type;
+    int16_t x;
+    int16_t y;
+    // Of the touch event that completed the gesture
+    uint32_t cycles;
+    uint32_t tick;
+} Gesture;
+
+typedef struct {
+    // Touches that go down inside the rectangle drag from the start
+    int16_t drag_x1;
+    int16_t drag_y1;
+    int16_t drag_x2;
+    int16_t drag_y2;
+    bool down;
+    bool dragging;
+    bool strayed;
+    TouchEvent start;
+    TouchEvent last;
+} GestureRecognizer;
+
+void gesture_init(GestureRecognizer *recognizer, int drag_x1, int drag_y1, int drag_x2, int drag_y2);
+// Forgets the touch in progress, its further events are ignored until the next one goes down
+void gesture_reset(GestureRecognizer *recognizer);
+// Returns true and fills gesture when the event makes one
+bool gesture_feed(GestureRecognizer *recognizer, const TouchEvent *event, Gesture *gesture);
+
+#endif //STM32_FLAC_PLAYER_GESTURE_H
@@ -0,0 +1,61 @@
+#ifndef STM32_FLAC_PLAYER_GFX_H
+#define STM32_FLAC_PLAYER_GFX_H
+
+#include <stdint.h>
+
+// A transfer still running after this long is aborted
+#define GFX_TIMEOUT_MS 100
+
+// Drawing on frame buffers with the DMA2D. Every call starts one transfer with the completion interrupt
+// and returns, after waiting for the transfer before it, so the CPU sets up the next transfer while the
+// current one moves pixels. Coordinates are screen coordinates, rectangles are clipped to the surface.
+
+typedef enum {
+    GFX_FORMAT_ARGB8888,
+    GFX_FORMAT_RGB565
+} GfxFormat;
+
+typedef struct {
+    void *pixels;
+    GfxFormat format;
+    // Where the top left pixel shows on the screen, for a layer with a window smaller than the screen
+    int16_t x;
+    int16_t y;
+    // Pixels per line, also the line stride
+    uint16_t width;
+    uint16_t height;
+} GfxSurface;
+
+// A8 coverage mask, blended in one color
+typedef struct {
+    const uint8_t *alpha;
+    uint16_t width;
+    uint16_t height;
+} GfxMask;
+
+typedef struct {
+    uint32_t transfers;
+    uint32_t errors;
+    uint64_t pixels;
+    // Time callers were blocked on a transfer still running
+    uint64_t wait_cycles;
+} GfxStats;
+
+int gfx_init(void);
+
+void gfx_fill(const GfxSurface *target, int x, int y, int width, int height, uint32_t color);
+// Copies the rectangle to the same place in another surface of the same geometry and format
+void gfx_copy(const GfxSurface *source, const GfxSurface *target, int x, int y, int width, int height);
+// Copies the rectangle at source_x, source_y of the source to x, y of a target in the same format; the
+// source must hold all of it
+void gfx_blit(const GfxSurface *source, int source_x, int source_y, const GfxSurface *target, int x, int y,
+              int width, int height);
+// Blends the mask in the color over the target, the top left corner of the mask at x, y
+void gfx_draw_mask(const GfxSurface *target, const GfxMask *mask, int x, int y, uint32_t color);
+
+// Blocks until the last transfer is done, before the CPU or the LTDC touches what was drawn
+void gfx_wait(void);
+
+void gfx_get_stats(GfxStats *stats);
+
+#endif //STM32_FLAC_PLAYER_GFX_H
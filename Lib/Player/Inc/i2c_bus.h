@@ -0,0 +1,13 @@
+#ifndef STM32_FLAC_PLAYER_I2C_BUS_H
+#define STM32_FLAC_PLAYER_I2C_BUS_H
+
+// The touch panel and the audio codec sit on the same I2C bus and the BSP calls to them are not reentrant.
+// The touch task and the controller hold the bus around every call that talks to either.
+
+// Creates the lock on the first call, later calls do nothing
+int i2c_bus_init(void);
+
+void i2c_bus_lock(void);
+void i2c_bus_unlock(void);
+
+#endif //STM32_FLAC_PLAYER_I2C_BUS_H
@@ -0,0 +1,58 @@
+#ifndef STM32_FLAC_PLAYER_JOBS_H
+#define STM32_FLAC_PLAYER_JOBS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define JOBS_MAX 8
+// CPU time one wakeup of the jobs task may take, measured with the cycle counter
+#define JOBS_SLICE_US 2000
+// Progress of unfinished jobs is written this often, finished jobs are written at once
+#define JOBS_SAVE_INTERVAL_MS (60 * 1000)
+
+#define JOBS_STATE_PATH "/flac_jobs.dat"
+#define JOBS_STATE_TEMP_PATH "/flac_jobs.tmp"
+
+typedef enum {
+    JOB_STEP_MORE,
+    JOB_STEP_DONE,
+    JOB_STEP_FAILED
+} JobStepResult;
+
+// Maintenance work split into small steps, run by a low priority task when the CPU would otherwise idle.
+// A step takes a few milliseconds at most and may use FatFs; the jobs task throttles it as SD background work.
+typedef struct {
+    const char *name;
+    // Key of the saved progress, a job whose id changes starts over
+    uint32_t id;
+    // Continues from progress, 0 on the first run, and advances it; the value is saved across reboots
+    JobStepResult (*step)(uint32_t *progress, void *context);
+    void *context;
+    // Restarted whenever there is new work for it, its finishing and restarts do not make the state be written
+    bool transient;
+} Job;
+
+typedef struct {
+    // Idle hook wakeups that ran job steps / that were skipped because the stream cache was below its depth
+    uint32_t slices;
+    uint32_t deferred;
+    uint32_t steps;
+    uint32_t max_slice_us;
+    uint32_t saves;
+} JobsStats;
+
+// Loads the saved progress and starts the jobs task, after the card is mounted
+int jobs_init(void);
+
+// The job picks up its saved progress, or starts from 0; finished jobs stay finished until restarted
+int jobs_add(const Job *job);
+void jobs_restart(uint32_t id);
+bool jobs_is_done(uint32_t id);
+
+// Called by vApplicationIdleHook, must not block
+void jobs_idle_hook(void);
+
+void jobs_get_stats(JobsStats *stats);
+void jobs_print_stats(void);
+
+#endif //STM32_FLAC_PLAYER_JOBS_H
@@ -0,0 +1,87 @@
+#ifndef STM32_FLAC_PLAYER_LIBRARY_H
+#define STM32_FLAC_PLAYER_LIBRARY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "dir_walker.h"
+
+#define LIBRARY_MAX_TRACKS 24576
+#define LIBRARY_MAX_DIRECTORIES 4096
+// Names, titles, artists and albums of every track; artists and albums repeated within a directory are stored once
+#define LIBRARY_STRINGS_SIZE (1280u * 1024u)
+#define LIBRARY_MAX_PATH_LENGTH DIR_WALKER_MAX_PATH_LENGTH
+// Pending directories of a scan, enough for about a thousand unvisited sibling folders
+#define LIBRARY_WALKER_MEMORY_SIZE (64u * 1024u)
+// Directory paths of the previous index during a scan, an index whose paths do not fit is not reused
+#define LIBRARY_PREVIOUS_PATHS_SIZE (256u * 1024u)
+// Cached pages of the index file, tracks and strings of the previous index are read through them during a scan
+#define LIBRARY_PAGE_SIZE 4096u
+#define LIBRARY_PAGE_COUNT 32
+
+#define LIBRARY_INDEX_PATH "/flac_library.idx"
+#define LIBRARY_INDEX_TEMP_PATH "/flac_library.tmp"
+
+typedef enum {
+    // Directories whose timestamp did not change are taken from the previous index without being read
+    LIBRARY_SCAN_INCREMENTAL,
+    // Every directory is read and every file probed again
+    LIBRARY_SCAN_FULL
+} LibraryScanMode;
+
+// Strings are offsets into the string pool, 0 is the empty string
+typedef struct {
+    uint32_t path;
+    uint32_t first_track;
+    uint32_t track_count;
+    // FAT timestamp of the directory entry, the root has none
+    uint16_t date;
+    uint16_t time;
+} LibraryDirectory;
+
+typedef struct {
+    uint32_t name;
+    uint32_t title;
+    uint32_t artist;
+    uint32_t album;
+    uint32_t file_size;
+    uint32_t duration_ms;
+    uint32_t sample_rate;
+    uint32_t directory;
+    uint16_t date;
+    uint16_t time;
+    uint8_t bits_per_sample;
+    uint8_t channels;
+    uint16_t track_number;
+} LibraryTrack;
+
+typedef struct {
+    uint32_t directories_read;
+    uint32_t directories_reused;
+    uint32_t tracks_probed;
+    uint32_t tracks_reused;
+    uint32_t elapsed_ms;
+} LibraryScanStats;
+
+// Allocates the index in SDRAM
+int library_init(void);
+
+// Loads the index stored on the card, rescans incrementally and writes the index back if anything changed. Fails
+// only when neither the scan nor the index file gave an index.
+int open_library(const DirWalkerCallbacks *callbacks);
+
+// Rebuilds the index from the card, the result is compared with the index file to tell whether it changed.
+// The index is rebuilt in place, a cancelled or failed scan restores it from the index file.
+int scan_library(LibraryScanMode mode, const DirWalkerCallbacks *callbacks, LibraryScanStats *stats);
+bool library_changed(void);
+int load_library(void);
+int save_library(void);
+
+// Tracks are ordered by directory path and then by file name
+uint32_t library_track_count(void);
+const LibraryTrack *library_get_track(uint32_t index);
+const char *library_string(uint32_t offset);
+int library_get_path(uint32_t index, char *path, size_t size);
+bool library_find(const char *path, uint32_t *index);
+
+#endif //STM32_FLAC_PLAYER_LIBRARY_H
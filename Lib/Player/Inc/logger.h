@@ -1,4 +1,5 @@
 #ifndef STM32_FLAC_PLAYER_LOGGER_H
+#define STM32_FLAC_PLAYER_LOGGER_H
 
 typedef enum {
     LOG_ERROR,
@@ -17,14 +17,47 @@ typedef enum {
 } BufferState;
 
 #define AUDIO_BUFFER_SIZE 32768
+// How far back a rewind goes, replayed from the rewind buffer as far as it reaches
+#define PLAYER_REWIND_SECONDS 10
+// A track started while the output runs is written this far ahead of the DMA, 12 ms at 44.1 kHz, which
+// must cover decoding its first frame
+#define PLAYER_START_MARGIN 2048
+
+typedef struct {
+    // Tracks started ahead of the running DMA, and those the DMA caught up with before their first samples
+    uint32_t joined_starts;
+    uint32_t late_joins;
+    // Times the DMA was started, the first track and every sample rate change, and codec setups
+    uint32_t output_starts;
+    uint32_t codec_reconfigurations;
+    // Event (a button press) to the first non-silent sample sent out by the DMA
+    uint32_t probes;
+    uint32_t last_latency_us;
+    uint32_t max_latency_us;
+    uint64_t total_latency_us;
+} PlayerOutputStats;
 
 void initialize_codec(void);
 void start_player(const char* file_path);
+// Lets the stream cache read the start of the next track while the current one plays
+void prefetch_next_track(const char *file_path);
 void pause_player(void);
 void resume_player(void);
 void stop_player(void);
+// Replays the last seconds of the current track from the rewind buffer, as far back as it goes.
+// The half of the audio buffer already queued still plays first.
+int rewind_player(unsigned seconds);
+// Goes on from the frame nearest to progress (0 to 1) of the current track, estimated from its file size.
+// The stream cache drops the prefetched next track, it has to be asked for again.
+int seek_player(double progress);
+// Times the next track start from event_cycles (profiler_cycles) to its first non-silent sample leaving the DMA
+void arm_latency_probe(uint32_t event_cycles);
+void get_output_stats(PlayerOutputStats *stats);
+void print_output_stats(void);
 void update_player(void);
 double get_playing_progress(void);
 PlayerState get_player_state(void);
+// Number of times the DMA reached a half of the buffer that had not been refilled
+unsigned get_underrun_count(void);
 
 #endif //STM32_FLAC_PLAYER_PLAYER_H
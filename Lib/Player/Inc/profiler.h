@@ -0,0 +1,107 @@
+#ifndef STM32_FLAC_PLAYER_PROFILER_H
+#define STM32_FLAC_PLAYER_PROFILER_H
+
+#include <stdint.h>
+
+// Set to 0 (e.g. -DPROFILER_ENABLED=0) to compile every zone out of the build
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+// One bin per power of two of the measured cycle count
+#define PROFILER_HISTOGRAM_BINS 32
+
+typedef enum {
+    PROFILER_ZONE_READ_FRAME,
+    PROFILER_ZONE_RICE,
+    PROFILER_ZONE_LPC,
+    PROFILER_ZONE_INTERLEAVE,
+    PROFILER_ZONE_F_READ,
+    PROFILER_ZONE_RENDER,
+    PROFILER_ZONE_JOB_SLICE,
+    PROFILER_ZONE_VISUALIZER,
+    PROFILER_ZONES_COUNT
+} ProfilerZoneId;
+
+typedef struct {
+    const char *name;
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t histogram[PROFILER_HISTOGRAM_BINS];
+} ProfilerZone;
+
+typedef struct {
+    ProfilerZoneId zone;
+    uint32_t start;
+} ProfilerScope;
+
+// Differences of two readings are right for spans shorter than 2^32 cycles: 19.9 s at the 216 MHz core
+// clock, 4.29 s on the host. Longer ones, like a whole decode in the benchmark, need another clock.
+#if defined(STM32F746xx)
+#include "stm32f7xx.h"
+
+// DWT cycle counter, runs at the core clock
+static inline uint32_t profiler_cycles(void) {
+    return DWT->CYCCNT;
+}
+#else
+#include <time.h>
+
+// Host builds have no DWT, so nanoseconds of the monotonic clock are used as "cycles"
+static inline uint32_t profiler_cycles(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t) ((uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec);
+}
+#endif
+
+// Starts the cycle counter, which is kept running with the zones compiled out
+void profiler_init(void);
+uint32_t profiler_clock_hz(void);
+
+#if PROFILER_ENABLED
+
+void profiler_reset(void);
+void profiler_record(ProfilerZoneId zone, uint32_t cycles);
+const ProfilerZone *profiler_get_zone(ProfilerZoneId zone);
+void profiler_print(void);
+
+static inline ProfilerScope profiler_scope_begin(ProfilerZoneId zone) {
+    return (ProfilerScope) {.zone = zone, .start = profiler_cycles()};
+}
+
+static inline void profiler_scope_end(ProfilerScope *scope) {
+    profiler_record(scope->zone, profiler_cycles() - scope->start);
+}
+
+#define PROFILER_CONCAT_(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT_(a, b)
+
+// Measures from this line to the end of the enclosing block, whichever way the block is left
+#define PROFILER_ZONE(zone) \
+    ProfilerScope PROFILER_CONCAT(profiler_scope_, __LINE__) \
+    __attribute__((cleanup(profiler_scope_end), unused)) = profiler_scope_begin(zone)
+
+#define PROFILER_BEGIN(zone) ProfilerScope profiler_scope_##zone = profiler_scope_begin(zone)
+#define PROFILER_END(zone) profiler_scope_end(&profiler_scope_##zone)
+
+#else
+
+static inline void profiler_reset(void) {}
+static inline void profiler_print(void) {}
+
+// Every zone reads as empty
+static inline const ProfilerZone *profiler_get_zone(ProfilerZoneId zone) {
+    static const ProfilerZone empty = {.name = ""};
+    return &empty;
+}
+
+#define PROFILER_ZONE(zone)
+#define PROFILER_BEGIN(zone)
+#define PROFILER_END(zone)
+
+#endif
+
+#endif //STM32_FLAC_PLAYER_PROFILER_H
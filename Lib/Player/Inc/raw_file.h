@@ -0,0 +1,34 @@
+#ifndef STM32_FLAC_PLAYER_RAW_FILE_H
+#define STM32_FLAC_PLAYER_RAW_FILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "ff.h"
+#include "sd_async.h"
+
+// Room for the link map of a file in one fragment: table size, cluster count, first cluster and terminator
+#define RAW_FILE_LINK_MAP_SIZE 4
+
+// A file stored in one run of clusters, read with multi-block transfers past the FatFs sector window
+typedef struct {
+    FATFS *fs;
+    DWORD first_sector;
+    FSIZE_t size;
+    bool contiguous;
+} RawFile;
+
+// Looks at the cluster map of an open file, contiguous is false for fragmented or empty files
+int raw_file_probe(RawFile *raw, FIL *file);
+
+// Offset and size are multiples of the sector size, the last sector is read whole so the buffer
+// must have room for size bytes even at the end of the file
+int raw_file_read(const RawFile *raw, FSIZE_t offset, uint8_t *buffer, unsigned size, unsigned *bytes_read);
+// Same as raw_file_read but only queued at the SD task, length is the file data the request will hold
+int raw_file_submit(const RawFile *raw, FSIZE_t offset, uint8_t *buffer, unsigned size, SdRequest *request,
+                    unsigned *length);
+
+// Reads the whole file through f_read and, when it is contiguous, through raw_file_read and with two
+// raw_file_submit requests in flight, chunk bytes per call; the buffer holds two chunks
+int raw_file_benchmark(const char *path, uint8_t *buffer, unsigned chunk);
+
+#endif //STM32_FLAC_PLAYER_RAW_FILE_H
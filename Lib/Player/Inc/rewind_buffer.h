@@ -0,0 +1,27 @@
+#ifndef STM32_FLAC_PLAYER_REWIND_BUFFER_H
+#define STM32_FLAC_PLAYER_REWIND_BUFFER_H
+
+#include <stdint.h>
+
+// Decoded PCM of the current track kept in SDRAM, so a rewind replays it without SD reads or decoding.
+// Sized for 16-bit stereo 44.1 kHz, 172 KB a second: the 10 s default takes 1.7 MB of the about 2.6 MB the
+// library and caches leave. Faster tracks get proportionally less, a rewind past it seeks.
+// 0 disables the buffer.
+#define REWIND_BUFFER_SECONDS 10
+#define REWIND_BUFFER_BYTES_PER_SECOND (44100u * 2 * 2)
+#define REWIND_BUFFER_SIZE (REWIND_BUFFER_SECONDS * REWIND_BUFFER_BYTES_PER_SECOND)
+
+// Positions are bytes of PCM since the start of the track
+
+// Allocates the buffer and logs what it costs, 1 when SDRAM is short; rewinding is unavailable then
+int rewind_buffer_init(void);
+// Forgets the previous track
+void rewind_buffer_reset(void);
+void rewind_buffer_append(const uint8_t *data, unsigned size);
+// Oldest position still kept, and the position the next appended byte will get
+uint64_t rewind_buffer_start(void);
+uint64_t rewind_buffer_end(void);
+// Copies kept PCM from position on, returns the bytes copied, fewer than size when it reaches the end
+unsigned rewind_buffer_read(uint64_t position, uint8_t *buffer, unsigned size);
+
+#endif //STM32_FLAC_PLAYER_REWIND_BUFFER_H
@@ -0,0 +1,50 @@
+#ifndef STM32_FLAC_PLAYER_SCROLLER_H
+#define STM32_FLAC_PLAYER_SCROLLER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Kinetic vertical scrolling of a list taller than its viewport. The content follows the finger while it is
+// down and keeps the speed it was let go at, which friction takes away over about SCROLLER_DECAY_MS; it
+// stops at either end. Positions are in 1/256 pixels and speeds in 1/256 pixels per second, so slow
+// scrolls move smoothly without floating point.
+#define SCROLLER_DECAY_MS 256
+// Moves of the finger closer in time than this are taken together for its speed
+#define SCROLLER_SAMPLE_MS 10
+// A finger that rested this long before it was lifted does not fling the list
+#define SCROLLER_REST_MS 80
+// Flings are capped at this speed and end below the stop one, in pixels per second
+#define SCROLLER_MAX_SPEED 6000
+#define SCROLLER_STOP_SPEED 20
+// Time a single update catches up with, a longer gap only makes the fling slower
+#define SCROLLER_MAX_STEP_MS 100
+
+typedef struct {
+    int32_t content_height;
+    int32_t viewport_height;
+    int32_t position;
+    int32_t velocity;
+    bool held;
+    int16_t last_y;
+    // Where the finger was when its speed was last taken
+    int16_t sample_y;
+    uint32_t sample_tick;
+    uint32_t update_tick;
+} Scroller;
+
+void scroller_init(Scroller *scroller, int32_t content_height, int32_t viewport_height, uint32_t tick);
+// Keeps the position within the new content
+void scroller_set_content(Scroller *scroller, int32_t content_height);
+// Moves the viewport to start at offset pixels, stopping a fling
+void scroller_jump(Scroller *scroller, int32_t offset);
+// A finger went down at y, which stops a fling; it moved to y; it was lifted
+void scroller_press(Scroller *scroller, int y, uint32_t tick);
+void scroller_drag(Scroller *scroller, int y, uint32_t tick);
+void scroller_release(Scroller *scroller, uint32_t tick);
+// Moves a fling on to the tick
+void scroller_update(Scroller *scroller, uint32_t tick);
+bool scroller_is_moving(const Scroller *scroller);
+// Pixels of the content above the viewport
+int32_t scroller_get_offset(const Scroller *scroller);
+
+#endif //STM32_FLAC_PLAYER_SCROLLER_H
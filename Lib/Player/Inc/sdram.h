@@ -0,0 +1,27 @@
+#ifndef STM32_FLAC_PLAYER_SDRAM_H
+#define STM32_FLAC_PLAYER_SDRAM_H
+
+#include <stddef.h>
+
+// Places a static buffer in the external 8 MB SDRAM (the NOLOAD .sdram section), plain .bss on the host
+#if defined(STM32F746xx)
+#define SDRAM __attribute__((section(".sdram")))
+#else
+#define SDRAM
+#endif
+
+// Part of the SDRAM handed out by sdram_alloc, the rest holds the LCD frame buffers
+#define SDRAM_HEAP_SIZE (7552u * 1024u)
+
+// Left free by the initialization for what is allocated on first use: the expanded glyphs of the fonts, about
+// 160 KB, and the benchmark buffers
+#define SDRAM_RESERVE_SIZE (320u * 1024u)
+
+// Bump allocator for buffers that live as long as the firmware, there is no free
+void *sdram_alloc(size_t size);
+size_t sdram_used(void);
+// Called once everything is initialized: 1 and an error when an allocation failed or the reserve is not free,
+// so a buffer that no longer fits stops the boot instead of disabling a feature quietly
+int sdram_check(void);
+
+#endif //STM32_FLAC_PLAYER_SDRAM_H
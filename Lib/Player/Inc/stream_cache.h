@@ -0,0 +1,75 @@
+#ifndef STM32_FLAC_PLAYER_STREAM_CACHE_H
+#define STM32_FLAC_PLAYER_STREAM_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Ring of compressed FLAC data in SDRAM, about 10 s of CD audio
+#define STREAM_CACHE_SIZE (1024u * 1024u)
+// Every read asks for one chunk at a chunk-aligned file offset, a multiple of the cluster size up to 32 KB,
+// so FatFs transfers whole clusters straight into the ring and contiguous files take one multi-block disk_read
+#define STREAM_CACHE_CHUNK_SIZE (32u * 1024u)
+// The I/O task stops reading when less than a chunk is free (high watermark) and starts again
+// when the fill level drops below the prefetch depth (low watermark)
+#define STREAM_CACHE_MIN_DEPTH (128u * 1024u)
+// Reads of a contiguous file kept queued at the SD task, the next one is armed while the last completes
+#define STREAM_CACHE_QUEUED_READS 2
+// The prefetch depth covers this many of the slowest (99th percentile) reads seen recently
+#define STREAM_CACHE_DEPTH_FACTOR 4
+#define STREAM_CACHE_LATENCY_BINS 12
+// Heads of the previous, current and next tracks kept in SDRAM, so a skip starts from memory; 128 KB is
+// over a second of CD audio, longer than the I/O task takes to get the rest of the ring going
+#define STREAM_CACHE_WARM_SLOTS 3
+#define STREAM_CACHE_WARM_SIZE (128u * 1024u)
+
+typedef struct {
+    // Decoder reads served from the ring without waiting / that had to wait for the I/O task
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t wait_ms;
+    uint32_t max_wait_ms;
+    // Tracks that started from data prefetched while the previous one was playing
+    uint32_t prefetched_tracks;
+    // Tracks opened from a warm head, and heads read in the background
+    uint32_t warm_hits;
+    uint32_t warm_fills;
+    uint32_t sd_reads;
+    // Reads of contiguous files that went straight to disk_read, past f_read
+    uint32_t raw_reads;
+    uint32_t contiguous_files;
+    uint64_t sd_bytes;
+    // Upper bounds of the f_read latency percentiles, in ms
+    uint32_t latency_p50_ms;
+    uint32_t latency_p90_ms;
+    uint32_t latency_p99_ms;
+    uint32_t latency_max_ms;
+    uint32_t depth;
+    uint32_t level;
+} StreamCacheStats;
+
+// Allocates the ring and starts the I/O task
+int stream_cache_init(void);
+
+// Starts streaming a file, reusing the data of the prefetched next track when the path matches
+int stream_cache_open(const char *path);
+// Streams the start of the file that is likely to be played next once the current one is fully read
+void stream_cache_prefetch(const char *path);
+void stream_cache_close(void);
+// Restarts the current track from the chunk holding offset, start tells where that chunk begins; the
+// prefetched next track is dropped and has to be asked for again
+int stream_cache_seek(uint32_t offset, uint32_t *start);
+// Size of the file being decoded
+uint32_t stream_cache_file_size(void);
+// Replaces the set of tracks whose heads are kept warm, the I/O task reads missing ones when it has nothing to do
+void stream_cache_warm(const char *const *paths, unsigned count);
+
+// Blocks until size bytes are available or the file ends, bytes_read is 0 at the end of the file
+int stream_cache_read(void *context, uint8_t *buffer, unsigned size, unsigned *bytes_read);
+
+// True when the ring holds at least the prefetch depth or there is nothing left to read, so idle work may run
+bool stream_cache_is_ahead(void);
+
+void stream_cache_get_stats(StreamCacheStats *stats);
+void stream_cache_print_stats(void);
+
+#endif //STM32_FLAC_PLAYER_STREAM_CACHE_H
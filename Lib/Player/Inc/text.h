@@ -0,0 +1,50 @@
+#ifndef STM32_FLAC_PLAYER_TEXT_H
+#define STM32_FLAC_PLAYER_TEXT_H
+
+#include <stdint.h>
+
+#include "font.h"
+#include "gfx.h"
+
+// One line of UTF-8 text rendered into an A8 mask, so a string is drawn by a single DMA2D blend. Glyphs
+// are expanded from the A4 atlases in flash into an SDRAM cache the first time they are used, and whole
+// runs are kept in an LRU cache, so text that did not change since it was last shown is not rendered again.
+// Bytes that are not UTF-8, like those of file names, are taken in the FatFs code page.
+// Every slot takes TEXT_RUN_MAX_WIDTH * TEXT_RUN_MAX_HEIGHT bytes of the SDRAM heap, which the rewind
+// buffer needs most of; the track screen shows four texts at most, the library browser renders its rows
+// one after the other as they scroll in
+#define TEXT_RUN_CACHE_SIZE 6
+// Bytes of text a cached run is looked up by, longer ones are rendered every time
+#define TEXT_RUN_TEXT_SIZE 128
+// Runs are cut at the last whole glyph that fits, and fonts taller than a run are not rendered. The
+// widest is about a title of TEXT_RUN_TEXT_SIZE bytes, the tallest font 27 pixels.
+#define TEXT_RUN_MAX_WIDTH 1280
+#define TEXT_RUN_MAX_HEIGHT 28
+// Fonts the glyph cache keeps track of
+#define TEXT_MAX_FONTS 4
+
+typedef struct {
+    // Runs taken from the cache and rendered
+    uint32_t run_hits;
+    uint32_t runs_rendered;
+    // Glyphs copied into runs, and how many of them were first expanded from the atlas
+    uint32_t glyphs_drawn;
+    uint32_t glyphs_expanded;
+    // Render time of a run, with its glyphs
+    uint32_t last_render_us;
+    uint32_t max_render_us;
+    uint64_t total_render_us;
+    uint32_t sdram_bytes;
+} TextStats;
+
+// Allocates the run cache in the SDRAM, returns 1 when it does not fit
+int text_init(void);
+
+// The mask of the text in the font, at most max_width wide, with the baseline font->ascent from its top.
+// It stays valid until TEXT_RUN_CACHE_SIZE other runs were rendered, NULL when there is no memory.
+const GfxMask *text_render(const Font *font, const char *text, int max_width);
+
+void text_get_stats(TextStats *stats);
+void text_print_stats(void);
+
+#endif //STM32_FLAC_PLAYER_TEXT_H
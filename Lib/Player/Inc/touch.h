@@ -0,0 +1,58 @@
+#ifndef STM32_FLAC_PLAYER_TOUCH_H
+#define STM32_FLAC_PLAYER_TOUCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Touch panel reads driven by the FT5336 interrupt. A task sleeps until the panel raises it, then reads the
+// panel on every interrupt and at least every TOUCH_POLL_MS while a finger is down, so the lift is seen even
+// without one, and queues what changed. Nothing is read over I2C while the panel is not touched.
+#define TOUCH_POLL_MS 10
+// Events waiting for the controller, once full the newest are dropped
+#define TOUCH_QUEUE_SIZE 32
+#define TOUCH_TASK_STACK_WORDS 512
+
+typedef enum {
+    TOUCH_DOWN,
+    TOUCH_MOVE,
+    TOUCH_UP
+} TouchEventType;
+
+typedef struct {
+    TouchEventType type;
+    // Where the finger is, or was last seen for TOUCH_UP
+    uint16_t x;
+    uint16_t y;
+    // profiler_cycles of the interrupt that led to the read, or of the read itself when it was polled
+    uint32_t cycles;
+    // osKernelSysTick of the same moment, for gesture timing
+    uint32_t tick;
+} TouchEvent;
+
+typedef struct {
+    uint32_t interrupts;
+    uint32_t reads;
+    uint32_t read_errors;
+    uint32_t events;
+    uint32_t dropped;
+    // Interrupt to the controller taking the event from the queue
+    uint32_t taken;
+    uint32_t last_latency_us;
+    uint32_t max_latency_us;
+    uint64_t total_latency_us;
+} TouchStats;
+
+// Sets the panel up in interrupt mode and starts the touch task
+int touch_init(uint16_t width, uint16_t height);
+
+// Takes the oldest queued event, false when there is none
+bool touch_get_event(TouchEvent *event);
+// Drops the queued events
+void touch_flush(void);
+// A finger was on the panel at the last read
+bool touch_is_down(void);
+
+void touch_get_stats(TouchStats *stats);
+void touch_print_stats(void);
+
+#endif //STM32_FLAC_PLAYER_TOUCH_H
@@ -0,0 +1,64 @@
+#ifndef STM32_FLAC_PLAYER_VISUALIZER_H
+#define STM32_FLAC_PLAYER_VISUALIZER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "fft.h"
+
+// Spectrum and level meters of what is played. The player taps every refill of the audio buffer: the last
+// FFT_SIZE frames are copied into the one block slot when the analysis task has left it empty, otherwise
+// the refill is not analyzed. The task runs below everything else, and after an analysis that took t it
+// takes no block for t * 100 / VISUALIZER_CPU_PERCENT, so its share of the CPU stays below that however
+// long an analysis takes.
+#define VISUALIZER_BANDS 16
+#define VISUALIZER_CPU_PERCENT 5
+// Levels go from 0 at VISUALIZER_RANGE_DB below full scale to VISUALIZER_LEVEL_MAX at full scale
+#define VISUALIZER_RANGE_DB 60
+#define VISUALIZER_LEVEL_MAX 255
+// Levels falling faster than this per analysis are held, so bars and meters drop smoothly
+#define VISUALIZER_DECAY 24
+// A frame older than this is not shown, the bars fall back to nothing while the player is paused
+#define VISUALIZER_STALE_MS 500
+#define VISUALIZER_TASK_STACK_WORDS 512
+
+typedef struct {
+    // Bumped by every analysis
+    uint32_t sequence;
+    uint32_t tick;
+    // Log spaced from the lowest bin above DC to the top one, of the mix of both channels
+    uint8_t bands[VISUALIZER_BANDS];
+    // Left and right
+    uint8_t peak[2];
+    uint8_t rms[2];
+} VisualizerFrame;
+
+typedef struct {
+    // Refills tapped, those whose block was analyzed, and those left out because the slot was still in
+    // use, because of the CPU budget, or because the samples are not 16-bit
+    uint32_t tapped;
+    uint32_t analyzed;
+    uint32_t dropped_busy;
+    uint32_t dropped_budget;
+    uint32_t unsupported;
+    uint32_t last_analysis_us;
+    uint32_t max_analysis_us;
+    uint64_t total_analysis_us;
+    // Time the player spent copying blocks into the slot
+    uint64_t tap_cycles;
+} VisualizerStats;
+
+int visualizer_init(void);
+void visualizer_set_enabled(bool enabled);
+bool visualizer_is_enabled(void);
+
+// Called by the player with the PCM it just wrote to the audio buffer; never blocks
+void visualizer_tap(const uint8_t *pcm, unsigned bytes, unsigned channels, unsigned bytes_per_sample);
+
+// The latest analysis, false when it is disabled or there is none recent enough
+bool visualizer_get_frame(VisualizerFrame *frame);
+
+void visualizer_get_stats(VisualizerStats *stats);
+void visualizer_print_stats(void);
+
+#endif //STM32_FLAC_PLAYER_VISUALIZER_H
@@ -0,0 +1,51 @@
+#ifndef STM32_FLAC_PLAYER_WAVEFORM_H
+#define STM32_FLAC_PLAYER_WAVEFORM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Peak overview of the selected track for the progress bar. It is taken from the cache file of the track
+// when there is one, otherwise built while the track plays out of the lowest and highest sample of every
+// decoded frame, which the decoder finds while interleaving; once every bucket was played it is written
+// to the cache. The files are read and written by an idle job.
+#define WAVEFORM_BUCKETS 384
+#define WAVEFORM_CACHE_DIRECTORY "/flac_peaks"
+
+typedef struct {
+    // Bumped whenever a bucket gets its first peaks, and when the track changes or the peaks are loaded
+    uint32_t version;
+    uint16_t filled;
+    // The lowest and highest sample of each bucket scaled to 8 bits, min above max where nothing is known
+    int8_t min[WAVEFORM_BUCKETS];
+    int8_t max[WAVEFORM_BUCKETS];
+} WaveformPeaks;
+
+typedef struct {
+    uint32_t frames;
+    // Overviews taken from the cache, looked for there in vain, built by playing and written to the cache
+    uint32_t loaded;
+    uint32_t missed;
+    uint32_t built;
+    uint32_t saved;
+    uint32_t save_errors;
+    // Time the player spent putting frame peaks into buckets
+    uint64_t add_cycles;
+} WaveformStats;
+
+int waveform_init(void);
+
+// The track the overview is of, its cache file is looked for when it changes; called by the controller for
+// the track shown
+void waveform_select(const char *path, uint32_t file_size);
+// The player starts decoding the track, frames added from now on are of it
+void waveform_start(const char *path, uint32_t file_size, uint64_t total_samples, unsigned bits_per_sample);
+// Called by the player for every decoded frame, never blocks on the card
+void waveform_add_frame(uint64_t sample_number, unsigned samples, int32_t min, int32_t max);
+
+uint32_t waveform_get_version(void);
+void waveform_get_peaks(WaveformPeaks *peaks);
+
+void waveform_get_stats(WaveformStats *stats);
+void waveform_print_stats(void);
+
+#endif //STM32_FLAC_PLAYER_WAVEFORM_H
@@ -0,0 +1,82 @@
+#include "block_cache.h"
+#include "console.h"
+#include "controller.h"
+#include "dbgu.h"
+#include "disk_benchmark.h"
+#include "display.h"
+#include "jobs.h"
+#include "logger.h"
+#include "profiler.h"
+#include "sd_async.h"
+#include "stream_cache.h"
+#include "text.h"
+#include "touch.h"
+#include "visualizer.h"
+#include "waveform.h"
+
+static void print_help(void) {
+    log_info("Console commands:");
+    log_info("  p - print profiler zones");
+    log_info("  r - reset profiler zones");
+    log_info("  c - print stream cache, block cache and SD queue statistics");
+    log_info("  b - benchmark reading the current track");
+    log_info("  d - benchmark the SD card");
+    log_info("  l - rescan the whole library");
+    log_info("  j - print idle job progress");
+    log_info("  w - rewind the current track");
+    log_info("  g - print display redraw, touch input, text rendering, visualizer and waveform statistics");
+    log_info("  v - show or hide the spectrum and level meters");
+}
+
+void handle_console(void) {
+    char key = debug_inkey();
+    switch (key) {
+        case 0:
+            break;
+        case 'p':
+            profiler_print();
+            break;
+        case 'r':
+            profiler_reset();
+            log_info("Profiler zones reset");
+            break;
+        case 'c':
+            stream_cache_print_stats();
+            block_cache_print_stats();
+            sd_async_print_stats();
+            print_skip_latency();
+            break;
+        case 'b':
+            benchmark_current_track();
+            break;
+        case 'd':
+            disk_benchmark();
+            break;
+        case 'l':
+            request_library_rescan();
+            break;
+        case 'j':
+            jobs_print_stats();
+            break;
+        case 'w':
+            rewind_current_track();
+            break;
+        case 'g':
+            print_display_stats();
+            touch_print_stats();
+            text_print_stats();
+            visualizer_print_stats();
+            waveform_print_stats();
+            break;
+        case 'v':
+            visualizer_set_enabled(!visualizer_is_enabled());
+            log_info("Visualizer %s", visualizer_is_enabled() ? "on" : "off");
+            break;
+        case '?':
+            print_help();
+            break;
+        default:
+            log_warn("Unknown console command '%c', press '?' for help", key);
+            break;
+    }
+}
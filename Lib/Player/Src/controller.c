@@ -1,33 +1,85 @@
+#include <string.h>
+
 #include "controller.h"
+#include "console.h"
 #include "display.h"
 #include "files.h"
+#include "jobs.h"
 #include "flac_reader.h"
+#include "library.h"
 #include "player.h"
+#include "profiler.h"
+#include "raw_file.h"
+#include "rewind_buffer.h"
+#include "sdram.h"
+#include "stream_cache.h"
 #include "utils.h"
+#include "visualizer.h"
+#include "waveform.h"
 
-static FileList file_list;
-static uint8_t current_file_index = 0;
+static uint32_t current_file_index = 0;
+// Picked in the library browser
+static uint32_t selected_file_index;
+static volatile bool library_rescan_requested = false;
 
 static char track_author[64];
 static char track_name[128];
 
+// Button press to the start of the new track written to the audio buffer, for skips during playback
+static uint32_t skip_count;
+static uint32_t skip_warm_count;
+static uint32_t skip_last_us;
+static uint32_t skip_max_us;
+static uint64_t skip_total_us;
+
 static const char *get_current_file_path(void) {
-    static char path[MAX_FILE_PATH_LENGTH + 1];
-    snprintf(path, MAX_FILE_PATH_LENGTH + 1, "%s", file_list.files[current_file_index].path);
+    static char path[LIBRARY_MAX_PATH_LENGTH + 1];
+    if (library_get_path(current_file_index, path, sizeof(path)) != 0) {
+        path[0] = '\0';
+    }
     return path;
 }
 
+static void prefetch_following(void) {
+    static char next_path[LIBRARY_MAX_PATH_LENGTH + 1];
+    if (library_get_path((current_file_index + 1) % library_track_count(), next_path, sizeof(next_path)) == 0) {
+        prefetch_next_track(next_path);
+    }
+}
+
+static void play_current(void) {
+    start_player(get_current_file_path());
+    prefetch_following();
+}
+
+// Keeps the heads of the tracks next and previous buttons lead to in SDRAM, and of the current one,
+// which is the previous track after a skip forward
+static void warm_neighbours(void) {
+    static char paths[3][LIBRARY_MAX_PATH_LENGTH + 1];
+    const char *warm_paths[3];
+    const uint32_t count = library_track_count();
+    const uint32_t indexes[3] = {current_file_index, (current_file_index + 1) % count,
+                                 (current_file_index + count - 1) % count};
+    for (int i = 0; i < 3; i++) {
+        if (library_get_path(indexes[i], paths[i], sizeof(paths[i])) != 0) {
+            paths[i][0] = '\0';
+        }
+        warm_paths[i] = paths[i];
+    }
+    stream_cache_warm(warm_paths, 3);
+}
+
 static void play_next() {
     PlayerState prev_state = get_player_state();
     if (prev_state != STOPPED) {
         stop_player();
     }
 
-    current_file_index = (current_file_index + 1) % file_list.count;
+    current_file_index = (current_file_index + 1) % library_track_count();
     if (prev_state == PLAYING) {
-        start_player(get_current_file_path());
+        play_current();
     }
-    log_debug("Current file index: %d", current_file_index);
+    log_debug("Current file index: %lu", (unsigned long) current_file_index);
 }
 
 static void play_previous() {
@@ -37,18 +89,29 @@ static void play_previous() {
     }
 
     if (get_playing_progress() <= 0.1) {
-        current_file_index = (file_list.count + current_file_index - 1) % file_list.count;
-        log_debug("Current file index: %d", current_file_index);
+        current_file_index = (library_track_count() + current_file_index - 1) % library_track_count();
+        log_debug("Current file index: %lu", (unsigned long) current_file_index);
     }
     if (prev_state == PLAYING) {
-        start_player(get_current_file_path());
+        play_current();
     }
 }
 
+// A track picked in the browser plays at once
+static void play_selected(void) {
+    if (get_player_state() != STOPPED) {
+        stop_player();
+    }
+    current_file_index = selected_file_index;
+    log_debug("Current file index: %lu", (unsigned long) current_file_index);
+    play_current();
+}
+
 static void start() {
     PlayerState state = get_player_state();
     if (state == STOPPED) {
-        start_player(get_current_file_path());
+        arm_latency_probe(get_input_cycles());
+        play_current();
     } else if (state == PAUSED) {
         resume_player();
     }
@@ -58,12 +121,181 @@ static void pause() {
     pause_player();
 }
 
+// The "NN - Artist - Title.flac" naming, with parts that fit the buffers get_author_and_track_name fills
+// without checking; it complains about any other name
+static bool is_author_and_track_name(const char *name) {
+    const char *author = strstr(name, " - ");
+    const char *title = author != NULL ? strstr(author + 3, " - ") : NULL;
+    const char *extension = title != NULL ? strstr(title + 3, ".flac") : NULL;
+    return extension != NULL && (size_t) (title - (author + 3)) < sizeof(track_author) &&
+           (size_t) (extension - (title + 3)) < sizeof(track_name);
+}
+
 void update_track_info(void) {
-    get_author_and_track_name(get_current_file_path(), track_author, track_name);
+    const LibraryTrack *track = library_get_track(current_file_index);
+    const char *title = library_string(track->title);
+    const char *artist = library_string(track->artist);
+
+    if (title[0] != '\0') {
+        snprintf(track_name, sizeof(track_name), "%s", title);
+        snprintf(track_author, sizeof(track_author), "%s", artist);
+    } else {
+        // Untagged files fall back to the "NN - Artist - Title.flac" naming
+        snprintf(track_name, sizeof(track_name), "%s", library_string(track->name));
+        track_author[0] = '\0';
+        if (is_author_and_track_name(library_string(track->name))) {
+            get_author_and_track_name(library_string(track->name), track_author, track_name);
+        }
+    }
+    waveform_select(get_current_file_path(), track->file_size);
+}
+
+// Title with artist and album, or the file name in its folder for untagged files
+static void read_browser_row(uint32_t index, char *title, char *detail, size_t size) {
+    static char path[LIBRARY_MAX_PATH_LENGTH + 1];
+    const LibraryTrack *track = library_get_track(index);
+    const char *artist = library_string(track->artist);
+    const char *album = library_string(track->album);
+    if (library_string(track->title)[0] != '\0') {
+        snprintf(title, size, "%s", library_string(track->title));
+        snprintf(detail, size, "%s%s%s", artist, artist[0] != '\0' && album[0] != '\0' ? " - " : "", album);
+        return;
+    }
+    snprintf(title, size, "%s", library_string(track->name));
+    if (library_get_path(index, path, sizeof(path)) != 0 || strrchr(path, '/') == NULL) {
+        path[0] = '\0';
+    } else {
+        *strrchr(path, '/') = '\0';
+    }
+    snprintf(detail, size, "%s", path[0] != '\0' ? path : "/");
+}
+
+static void record_skip_latency(uint32_t start, uint32_t warm_hits_before) {
+    StreamCacheStats cache_stats;
+    const uint32_t elapsed_us = (profiler_cycles() - start) / (profiler_clock_hz() / 1000000);
+    stream_cache_get_stats(&cache_stats);
+    const bool warm = cache_stats.warm_hits != warm_hits_before;
+    skip_count++;
+    skip_warm_count += warm;
+    skip_last_us = elapsed_us;
+    skip_total_us += elapsed_us;
+    if (elapsed_us > skip_max_us) {
+        skip_max_us = elapsed_us;
+    }
+    log_info("Skip to audio in %lu us%s", (unsigned long) elapsed_us, warm ? " from a warm head" : "");
+}
+
+// Timed from the touch interrupt, so the wait in the touch queue counts too
+static void skip(void (*action)(void)) {
+    StreamCacheStats cache_stats;
+    const uint32_t start = get_input_cycles();
+    const bool was_playing = get_player_state() == PLAYING;
+    stream_cache_get_stats(&cache_stats);
+    if (was_playing) {
+        arm_latency_probe(start);
+    }
+    action();
+    if (was_playing && get_player_state() == PLAYING) {
+        record_skip_latency(start, cache_stats.warm_hits);
+    }
+    warm_neighbours();
+    update_track_info();
+}
+
+void print_skip_latency(void) {
+    log_info("Skips: %lu, %lu from warm heads, tap to audio last %lu us, mean %lu us, max %lu us",
+             (unsigned long) skip_count, (unsigned long) skip_warm_count, (unsigned long) skip_last_us,
+             (unsigned long) (skip_count != 0 ? skip_total_us / skip_count : 0), (unsigned long) skip_max_us);
+    print_output_stats();
+}
+
+static void seek(double progress) {
+    if (get_player_state() == STOPPED) {
+        return;
+    }
+    if (get_player_state() == PLAYING) {
+        arm_latency_probe(get_input_cycles());
+    }
+    log_info("Seeking to %lu%%", (unsigned long) (progress * 100));
+    if (seek_player(progress) == 0) {
+        prefetch_following();
+    }
+}
+
+void rewind_current_track(void) {
+    if (get_player_state() != STOPPED) {
+        rewind_player(PLAYER_REWIND_SECONDS);
+    }
+}
+
+void request_library_rescan(void) {
+    library_rescan_requested = true;
+}
+
+void benchmark_current_track(void) {
+    static uint8_t *buffer = NULL;
+    if (buffer == NULL) {
+        buffer = sdram_alloc(2 * STREAM_CACHE_CHUNK_SIZE);
+    }
+    if (buffer == NULL || library_track_count() == 0) {
+        return;
+    }
+    raw_file_benchmark(get_current_file_path(), buffer, STREAM_CACHE_CHUNK_SIZE);
+}
+
+static void render_scan_progress(const DirWalkerStats *stats, const char *directory, void *context) {
+    char progress[64];
+    snprintf(progress, sizeof(progress), "%lu files in %lu folders",
+             (unsigned long) stats->files, (unsigned long) stats->directories);
+    render_info_screen((const char *) context, progress);
+}
+
+static bool is_scan_cancelled(void *context) {
+    return is_screen_touched();
+}
+
+static void rescan_library(void) {
+    const DirWalkerCallbacks callbacks = {
+            .progress = render_scan_progress,
+            .cancelled = is_scan_cancelled,
+            .context = (void *) "Rescanning, touch to cancel",
+            .progress_interval_ms = 250
+    };
+    LibraryScanStats stats;
+    char current_path[LIBRARY_MAX_PATH_LENGTH + 1];
+
+    library_rescan_requested = false;
+    close_browser();
+    if (get_player_state() != STOPPED) {
+        stop_player();
+    }
+    snprintf(current_path, sizeof(current_path), "%s", get_current_file_path());
+
+    render_info_screen("Library", "Rescanning the card...");
+    if (scan_library(LIBRARY_SCAN_FULL, &callbacks, &stats) == 0) {
+        if (library_changed()) {
+            save_library();
+        }
+    } else {
+        // The touch that cancelled the scan must not reach the buttons
+        discard_touches();
+    }
+    if (library_track_count() == 0) {
+        render_info_screen("Library", "No FLAC files found");
+        while (true) {
+            osDelay(1000);
+        }
+    }
+    if (!library_find(current_path, &current_file_index)) {
+        current_file_index = 0;
+    }
+    warm_neighbours();
+    update_track_info();
 }
 
 void controller_task(void) {
     set_debug_mode(false);
+    profiler_init();
     log_info("FLAC player starts");
 
     initialize_screen();
@@ -71,29 +303,69 @@ void controller_task(void) {
 
     wait_for_sd_card();
 
-    render_info_screen("Initialization", "Searching for FLAC files...");
-    if (find_FLAC_files("", &file_list) == 1) {
+    const DirWalkerCallbacks callbacks = {
+            .progress = render_scan_progress,
+            .cancelled = NULL,
+            .context = (void *) "Loading library...",
+            .progress_interval_ms = 250
+    };
+    render_info_screen("Initialization", "Loading library...");
+    if (library_init() != 0 || open_library(&callbacks) != 0) {
+        render_info_screen("Initialization", "Cannot read the library");
+        return;
+    }
+    if (library_track_count() == 0) {
+        render_info_screen("Initialization", "No FLAC files found");
         return;
     }
 
     render_info_screen("Initialization", "Setting up codec...");
     initialize_codec();
+    if (stream_cache_init() != 0) {
+        return;
+    }
+    jobs_init();
+    visualizer_init();
+    waveform_init();
+    rewind_buffer_init();
+    if (sdram_check() != 0) {
+        render_info_screen("Initialization", "Out of SDRAM");
+        return;
+    }
+    warm_neighbours();
     update_track_info();
+    // Touches made while the library loaded are not meant for the track screen
+    discard_touches();
 
+    double seek_progress;
     while (true) {
+        handle_console();
         handle_touch();
-        render_track_screen(track_name, track_author, 3, 0, get_playing_progress(), 182.42, get_player_state() == PLAYING);
-        if (is_next_button_active()) {
-            play_next();
-            update_track_info();
+        if (is_browser_open()) {
+            render_browser_screen(library_track_count(), current_file_index, read_browser_row);
+        } else {
+            render_track_screen(track_name, track_author, get_playing_progress(), get_player_state() == PLAYING);
+        }
+        if (get_browser_selection(&selected_file_index)) {
+            skip(play_selected);
+        } else if (is_next_button_active()) {
+            skip(play_next);
         } else if (is_back_button_active()) {
-            play_previous();
-            update_track_info();
+            skip(play_previous);
+        } else if (is_back_button_held()) {
+            rewind_current_track();
         } else if (is_play_button_active()) {
             start();
         } else if (is_pause_button_active()) {
             pause();
+        } else if (get_seek_request(&seek_progress)) {
+            seek(seek_progress);
         }
         update_player();
+        if (library_rescan_requested) {
+            rescan_library();
+        }
+        // The only point where the loop blocks, it gives the idle task and the jobs behind it a slot every frame
+        osDelay(1);
     }
 }
@@ -0,0 +1,196 @@
+#include <string.h>
+#include "cmsis_os.h"
+
+#include "dir_walker.h"
+#include "logger.h"
+
+// Every pending directory is stored as its path, '\0', date, time and the path length, so the stack pops from the end
+#define STACK_ENTRY_TRAILER (3 * sizeof(uint16_t))
+
+static int push_directory(DirWalker *walker, const char *path, uint16_t date, uint16_t time) {
+    const size_t length = strlen(path);
+    const size_t entry_size = length + 1 + STACK_ENTRY_TRAILER;
+    if (walker->stack_used + entry_size > walker->stack_size) {
+        log_warn("Directory walker memory is full, skipping %s", path);
+        walker->stats.skipped++;
+        return 1;
+    }
+
+    uint8_t *entry = walker->stack + walker->stack_used;
+    const uint16_t trailer[3] = {date, time, (uint16_t) length};
+    memcpy(entry, path, length + 1);
+    memcpy(entry + length + 1, trailer, sizeof(trailer));
+    walker->stack_used += entry_size;
+    if (walker->stack_used > walker->stats.peak_memory) {
+        walker->stats.peak_memory = walker->stack_used;
+    }
+    return 0;
+}
+
+static void pop_directory(DirWalker *walker) {
+    uint16_t trailer[3];
+    memcpy(trailer, walker->stack + walker->stack_used - sizeof(trailer), sizeof(trailer));
+    const size_t length = trailer[2];
+    walker->stack_used -= length + 1 + STACK_ENTRY_TRAILER;
+
+    memcpy(walker->path, walker->stack + walker->stack_used, length + 1);
+    walker->date = trailer[0];
+    walker->time = trailer[1];
+}
+
+static int join_path(char *path, const char *directory, const char *name) {
+    const size_t directory_length = strlen(directory);
+    const size_t name_length = strlen(name);
+    if (directory_length + 1 + name_length > DIR_WALKER_MAX_PATH_LENGTH) {
+        log_warn("Path too long, skipping %s/%s", directory, name);
+        return 1;
+    }
+    memcpy(path, directory, directory_length);
+    path[directory_length] = '/';
+    memcpy(path + directory_length + 1, name, name_length + 1);
+    return 0;
+}
+
+// Skips "System Volume Information", dot files and macOS "._" resource forks
+static bool is_visible(const FILINFO *info) {
+    return !(info->fattrib & (AM_HID | AM_SYS)) && info->fname[0] != '.';
+}
+
+int walker_init(DirWalker *walker, const char *root, const char *pattern, void *memory, size_t memory_size,
+                const DirWalkerCallbacks *callbacks) {
+    memset(&walker->stats, 0, sizeof(DirWalkerStats));
+    walker->state = DIR_WALKER_STATE_NEXT_DIRECTORY;
+    walker->pattern = pattern;
+    walker->callbacks = callbacks;
+    walker->stack = memory;
+    walker->stack_size = memory_size;
+    walker->stack_used = 0;
+    walker->start_ms = osKernelSysTick();
+    walker->last_progress_ms = walker->start_ms;
+    // FAT stores no timestamp for the root
+    return push_directory(walker, root, 0, 0);
+}
+
+void walker_skip_files(DirWalker *walker) {
+    if (walker->state == DIR_WALKER_STATE_FIRST_FILE) {
+        walker->state = DIR_WALKER_STATE_FIRST_SUBDIRECTORY;
+    }
+}
+
+void walker_skip_directory(DirWalker *walker) {
+    if (walker->state == DIR_WALKER_STATE_FIRST_FILE) {
+        walker->state = DIR_WALKER_STATE_NEXT_DIRECTORY;
+    }
+}
+
+void walker_close(DirWalker *walker) {
+    if (walker->state == DIR_WALKER_STATE_NEXT_FILE || walker->state == DIR_WALKER_STATE_NEXT_SUBDIRECTORY) {
+        f_closedir(&walker->dir);
+    }
+    walker->state = DIR_WALKER_STATE_DONE;
+}
+
+static void report_progress(DirWalker *walker) {
+    const DirWalkerCallbacks *callbacks = walker->callbacks;
+    const uint32_t now = osKernelSysTick();
+    walker->stats.elapsed_ms = now - walker->start_ms;
+    if (callbacks != NULL && callbacks->progress != NULL &&
+        now - walker->last_progress_ms >= callbacks->progress_interval_ms) {
+        walker->last_progress_ms = now;
+        callbacks->progress(&walker->stats, walker->path, callbacks->context);
+    }
+}
+
+static bool is_cancelled(DirWalker *walker) {
+    const DirWalkerCallbacks *callbacks = walker->callbacks;
+    return callbacks != NULL && callbacks->cancelled != NULL && callbacks->cancelled(callbacks->context);
+}
+
+// An unreadable directory ends the walk, the caller must not take a partial walk for the whole tree
+static DirWalkerEvent fail(DirWalker *walker, const char *operation, FRESULT result) {
+    log_error("Failed to %s directory %s (%d)", operation, walker->path, (int) result);
+    walker_close(walker);
+    return DIR_WALKER_ERROR;
+}
+
+// Files are found with the FatFs pattern match, subdirectories with a second plain pass over the rewound directory
+DirWalkerEvent walker_step(DirWalker *walker) {
+    FRESULT result;
+
+    while (true) {
+        report_progress(walker);
+
+        switch (walker->state) {
+            case DIR_WALKER_STATE_NEXT_DIRECTORY:
+                if (is_cancelled(walker)) {
+                    walker->state = DIR_WALKER_STATE_DONE;
+                    return DIR_WALKER_CANCELLED;
+                }
+                if (walker->stack_used == 0) {
+                    walker->state = DIR_WALKER_STATE_DONE;
+                    return DIR_WALKER_DONE;
+                }
+                pop_directory(walker);
+                walker->stats.directories++;
+                walker->state = DIR_WALKER_STATE_FIRST_FILE;
+                return DIR_WALKER_DIRECTORY;
+
+            case DIR_WALKER_STATE_FIRST_FILE:
+            case DIR_WALKER_STATE_NEXT_FILE:
+                if (walker->state == DIR_WALKER_STATE_FIRST_FILE) {
+                    result = f_findfirst(&walker->dir, &walker->info, walker->path, walker->pattern);
+                    walker->state = DIR_WALKER_STATE_NEXT_FILE;
+                } else {
+                    result = f_findnext(&walker->dir, &walker->info);
+                }
+                if (result == FR_OK && walker->info.fname[0] == '\0') {
+                    // Rewinding is cheaper than opening the path again, which walks every parent directory
+                    result = f_readdir(&walker->dir, NULL);
+                    if (result == FR_OK) {
+                        walker->state = DIR_WALKER_STATE_NEXT_SUBDIRECTORY;
+                        break;
+                    }
+                }
+                if (result != FR_OK) {
+                    return fail(walker, "read", result);
+                }
+                if ((walker->info.fattrib & AM_DIR) || !is_visible(&walker->info) ||
+                    join_path(walker->file_path, walker->path, walker->info.fname) != 0) {
+                    break;
+                }
+                walker->stats.files++;
+                return DIR_WALKER_FILE;
+
+            case DIR_WALKER_STATE_FIRST_SUBDIRECTORY:
+                result = f_opendir(&walker->dir, walker->path);
+                if (result != FR_OK) {
+                    return fail(walker, "open", result);
+                }
+                walker->state = DIR_WALKER_STATE_NEXT_SUBDIRECTORY;
+                break;
+
+            case DIR_WALKER_STATE_NEXT_SUBDIRECTORY:
+                result = f_readdir(&walker->dir, &walker->info);
+                if (result != FR_OK) {
+                    return fail(walker, "read", result);
+                }
+                if (walker->info.fname[0] == '\0') {
+                    f_closedir(&walker->dir);
+                    walker->state = DIR_WALKER_STATE_NEXT_DIRECTORY;
+                    break;
+                }
+                if ((walker->info.fattrib & AM_DIR) && is_visible(&walker->info)) {
+                    if (join_path(walker->file_path, walker->path, walker->info.fname) != 0) {
+                        walker->stats.skipped++;
+                    } else {
+                        push_directory(walker, walker->file_path, walker->info.fdate, walker->info.ftime);
+                    }
+                }
+                break;
+
+            case DIR_WALKER_STATE_DONE:
+            default:
+                return DIR_WALKER_DONE;
+        }
+    }
+}
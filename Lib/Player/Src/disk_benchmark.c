@@ -0,0 +1,90 @@
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "disk_benchmark.h"
+#include "logger.h"
+#include "profiler.h"
+#include "sd_async.h"
+#include "sd_bus.h"
+#include "sdram.h"
+
+#define SECTOR_SIZE 512
+
+static const unsigned request_sizes[] = {512, 4 * 1024, 16 * 1024, DISK_BENCHMARK_MAX_REQUEST_SIZE};
+
+static uint8_t *buffer;
+static uint32_t latencies_us[DISK_BENCHMARK_REQUESTS];
+
+static int compare_latencies(const void *a, const void *b) {
+    const uint32_t left = *(const uint32_t *) a;
+    const uint32_t right = *(const uint32_t *) b;
+    return left < right ? -1 : left > right;
+}
+
+// Same generator on every run, so two cards or two bus modes are compared on the same sectors
+static uint32_t next_random(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state;
+}
+
+static int run_test(unsigned size, bool random, uint32_t sector_count) {
+    const uint32_t count = size / SECTOR_SIZE;
+    const uint32_t cycles_per_us = profiler_clock_hz() / 1000000;
+    // Sequential reads cover the middle of the card, away from the FAT
+    uint32_t sector = (sector_count - count * DISK_BENCHMARK_REQUESTS) / 2;
+    sector -= sector % count;
+    uint32_t random_state = 1;
+    uint64_t total_cycles = 0;
+
+    for (int i = 0; i < DISK_BENCHMARK_REQUESTS; i++) {
+        if (random) {
+            sector = next_random(&random_state) % (sector_count - count);
+            sector -= sector % count;
+        }
+        const uint32_t start = profiler_cycles();
+        if (sd_async_transfer(SD_REQUEST_READ, buffer, sector, count) != RES_OK) {
+            log_error("Benchmark read of sector %lu failed", (unsigned long) sector);
+            return 1;
+        }
+        const uint32_t cycles = profiler_cycles() - start;
+        total_cycles += cycles;
+        latencies_us[i] = cycles / cycles_per_us;
+        sector += count;
+    }
+
+    qsort(latencies_us, DISK_BENCHMARK_REQUESTS, sizeof(latencies_us[0]), compare_latencies);
+    const uint64_t total_us = total_cycles / cycles_per_us;
+    const uint64_t kb_per_s = total_us != 0 ? (uint64_t) size * DISK_BENCHMARK_REQUESTS * 1000000 / 1024 / total_us : 0;
+    log_info("  %5u B %-10s %4lu.%02lu MB/s, latency p50 %lu us, p90 %lu us, p99 %lu us, max %lu us",
+             size, random ? "random" : "sequential", (unsigned long) (kb_per_s / 1024),
+             (unsigned long) (kb_per_s % 1024 * 100 / 1024),
+             (unsigned long) latencies_us[DISK_BENCHMARK_REQUESTS * 50 / 100],
+             (unsigned long) latencies_us[DISK_BENCHMARK_REQUESTS * 90 / 100],
+             (unsigned long) latencies_us[DISK_BENCHMARK_REQUESTS * 99 / 100],
+             (unsigned long) latencies_us[DISK_BENCHMARK_REQUESTS - 1]);
+    return 0;
+}
+
+int disk_benchmark(void) {
+    DWORD sector_count = 0;
+    SdBusInfo bus;
+    if (buffer == NULL) {
+        buffer = sdram_alloc(DISK_BENCHMARK_MAX_REQUEST_SIZE);
+    }
+    if (buffer == NULL || disk_ioctl(0, GET_SECTOR_COUNT, &sector_count) != RES_OK ||
+        sector_count < DISK_BENCHMARK_REQUESTS * (DISK_BENCHMARK_MAX_REQUEST_SIZE / SECTOR_SIZE)) {
+        log_error("Cannot benchmark the card");
+        return 1;
+    }
+
+    sd_bus_get_info(&bus);
+    log_info("SD benchmark, %lu MB card, bus %s, %lu errors, %lu fallbacks, %lu recoveries",
+             (unsigned long) (sector_count / (1024 * 1024 / SECTOR_SIZE)), bus.mode,
+             (unsigned long) bus.errors, (unsigned long) bus.fallbacks, (unsigned long) bus.recoveries);
+    for (unsigned i = 0; i < sizeof(request_sizes) / sizeof(request_sizes[0]); i++) {
+        if (run_test(request_sizes[i], false, sector_count) != 0 || run_test(request_sizes[i], true, sector_count) != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -1,9 +1,21 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "stm32746g_discovery_lcd.h"
-#include "stm32746g_discovery_ts.h"
 #include "cmsis_os.h"
 
 #include "display.h"
+#include "gesture.h"
+#include "gfx.h"
+#include "logger.h"
 #include "player.h"
+#include "profiler.h"
+#include "scroller.h"
+#include "sdram.h"
+#include "text.h"
+#include "touch.h"
+#include "visualizer.h"
+#include "waveform.h"
 
 #define LCD_LAYER_FG 1
 #define LCD_LAYER_BG 0
@@ -16,10 +28,212 @@
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 #define COUNT(x) (sizeof(x)/sizeof(x[0]))
 
-static int current_layer = LCD_LAYER_FG;
+// The foreground layer is an RGB565 window over the band of the track screen widgets, from the title to
+// the bottom of the play button. The background layer is L8 and only holds the info screen: under the
+// track screen it is off and the LTDC shows its black background color, so only the window is fetched
+// from the SDRAM. Both are double buffered by switching their address.
+#define WINDOW_TOP VH_TO_PX(20)
+#define WINDOW_HEIGHT (VH_TO_PX(80) + 36 - WINDOW_TOP)
+#define FOREGROUND_BUFFERS 2
+#define BACKGROUND_BUFFERS 2
+// The track screen fades in over the info screen by the foreground layer alpha
+#define FADE_MS 200
+// Refresh rate the panel timings give, for the fetch bandwidth and the frame pacing
+#define REFRESH_HZ 60
+#define REFRESHES_PER_FRAME MAX(1, REFRESH_HZ / DISPLAY_FRAME_RATE)
+#define DISPLAY_TASK_STACK_WORDS 1024
+// Pixels around the progress bar where a touch still drags it
+#define DRAG_MARGIN 8
 
-static volatile uint32_t lcd_image_fg[DISPLAY_HEIGHT][DISPLAY_WIDTH] __attribute__((section(".sdram")));
-static volatile uint32_t lcd_image_bg[DISPLAY_HEIGHT][DISPLAY_WIDTH] __attribute__((section(".sdram")));
+extern LTDC_HandleTypeDef hLtdcHandler;
+
+static int current_buffer = 0;
+static int current_background = 0;
+
+static volatile uint16_t foreground_images[FOREGROUND_BUFFERS][WINDOW_HEIGHT][DISPLAY_WIDTH] SDRAM;
+static volatile uint8_t background_images[BACKGROUND_BUFFERS][DISPLAY_HEIGHT][DISPLAY_WIDTH] SDRAM;
+
+// What the DMA2D draws into, the buffer being drawn is always the hidden one
+static const GfxSurface foreground_surfaces[FOREGROUND_BUFFERS] = {
+        {(void *) foreground_images[0], GFX_FORMAT_RGB565, 0, WINDOW_TOP, DISPLAY_WIDTH, WINDOW_HEIGHT},
+        {(void *) foreground_images[1], GFX_FORMAT_RGB565, 0, WINDOW_TOP, DISPLAY_WIDTH, WINDOW_HEIGHT}
+};
+
+// Colors of the info screen: grey levels from black to white, one per level of the A4 glyphs, for its
+// anti-aliased text. The background layer CLUT takes 0x00RRGGBB.
+#define BACKGROUND_COLORS 16
+#define BACKGROUND_BLACK 0
+#define BACKGROUND_WHITE (BACKGROUND_COLORS - 1)
+
+static uint32_t background_clut[BACKGROUND_COLORS];
+
+typedef enum {
+    SCREEN_NONE,
+    SCREEN_INFO,
+    SCREEN_TRACK,
+    SCREEN_BROWSER
+} Screen;
+
+// The library browser lists every track in a row of its title over its artist and album, scrolled by the
+// finger with a fling. Rows are read from the library by the controller as they scroll into the window,
+// into a window of BROWSER_ROWS rows handed over with the request, so neither side holds more than those
+// whatever the size of the library. A frame copies the rows still shown from the visible buffer moved by
+// the scroll and renders only the rows that came in.
+#define ROW_HEIGHT 44
+#define ROW_TITLE_Y 3
+#define ROW_DETAIL_Y 25
+// Rows the window shows parts of at most
+#define BROWSER_ROWS (WINDOW_HEIGHT / ROW_HEIGHT + 2)
+
+typedef struct {
+    char title[DISPLAY_TEXT_SIZE];
+    char detail[DISPLAY_TEXT_SIZE];
+} BrowserRow;
+
+// What the controller last asked for, drawn by the display task at its next frame
+typedef struct {
+    Screen screen;
+    // Bumped by every info screen asked for, it is drawn once
+    uint32_t info_version;
+    char info[DISPLAY_TEXT_SIZE];
+    char sub_info[DISPLAY_TEXT_SIZE];
+    char track_name[DISPLAY_TEXT_SIZE];
+    char artist_name[DISPLAY_TEXT_SIZE];
+    double progress;
+    bool is_playing;
+    // Bumped every time the browser opens, its rows are read again
+    uint32_t browser_version;
+    uint32_t track_count;
+    uint32_t current_track;
+    int32_t browser_offset;
+    // Index of the first of the rows
+    uint32_t first_row;
+    BrowserRow rows[BROWSER_ROWS];
+} ScreenRequest;
+
+// request_lock guards the request, written by the controller while the display task reads it
+static ScreenRequest request;
+static osSemaphoreId request_lock;
+// Given at the start of every vertical blanking by the line event
+static osSemaphoreId vsync_semaphore;
+
+osSemaphoreDef(display_request_lock);
+osSemaphoreDef(display_vsync);
+
+static uint32_t display_task_stack[DISPLAY_TASK_STACK_WORDS];
+static osStaticThreadDef_t display_task_control;
+
+// Only the display task touches the layers after initialization. Their changes are made in the shadow
+// registers and latched together at the vertical blanking, until then the buffers shown before stay in use.
+static Screen screen = SCREEN_NONE;
+static bool layer_visible[MAX_LAYER_NUMBER];
+static bool layers_changed;
+static volatile bool reload_pending;
+static bool fading;
+static unsigned fade_start;
+
+// Texts are drawn by the text engine, from these fonts
+static const Font *const title_font = &font_sans_17;
+static const Font *const artist_font = &font_sans_13;
+static const Font *const info_font = &font_sans_22;
+static const Font *const sub_info_font = &font_sans_17;
+// Where the texts of both screens start, track screen texts wider than the margins allow scroll
+#define TEXT_X VW_TO_PX(5)
+#define TEXT_WIDTH (DISPLAY_WIDTH - 2 * TEXT_X)
+#define INFO_TEXT_X VW_TO_PX(10)
+
+// A text that scrolls is rendered once into a strip: the text, a gap and its start again, as wide as the
+// widget. A frame copies the widget out of the strip from the scroll offset with one DMA2D transfer. It
+// stands still at the start for a while every round.
+#define MARQUEE_GAP 48
+#define MARQUEE_SPEED_PX_PER_S 30
+#define MARQUEE_PAUSE_MS 2000
+#define MARQUEE_STRIP_WIDTH (TEXT_RUN_MAX_WIDTH + MARQUEE_GAP + TEXT_WIDTH)
+
+typedef struct {
+    bool valid;
+    // Of the text last asked for, whose run is text_width wide; the strip is drawn when it scrolls
+    uint32_t hash;
+    int text_width;
+    bool strip_drawn;
+    uint32_t start;
+    int offset;
+    GfxSurface strip;
+} Marquee;
+
+static Marquee title_marquee;
+static Marquee artist_marquee;
+
+// Spectrum bars and the left and right level meters, between the artist and the progress bar. A meter
+// fills to the RMS level with a mark at the peak.
+#define VISUALIZER_TOP 104
+#define VISUALIZER_HEIGHT 40
+#define METER_WIDTH 12
+#define METER_GAP 4
+#define SPECTRUM_WIDTH (TEXT_WIDTH - 2 * METER_WIDTH - 4 * METER_GAP)
+#define BAR_PITCH (SPECTRUM_WIDTH / VISUALIZER_BANDS)
+#define BAR_GAP 4
+
+// The analysis the frame being drawn shows, when there is one
+static VisualizerFrame visualizer_frame;
+static bool visualizer_shown;
+
+// The progress bar is the peak overview of the track, played part white and the rest grey. Both looks are
+// drawn into a strip, the played one above the other, whenever the peaks change; a frame copies the bar
+// out of it, and while only the progress moves just the columns it passed. Buckets not known yet are a
+// thin line through the middle.
+#define PROGRESS_X 10
+#define PROGRESS_Y 148
+#define PROGRESS_WIDTH (DISPLAY_WIDTH - 2 * PROGRESS_X)
+#define PROGRESS_HEIGHT 24
+// Peaks are at least this tall, so silence still shows as a line
+#define PEAK_MIN_HEIGHT 2
+
+static WaveformPeaks peaks;
+static GfxSurface peaks_strip;
+static GfxMask peaks_mask;
+static bool peaks_strip_drawn;
+
+// Retained scene of the track screen: what every widget shows in each layer. A frame redraws the widgets
+// that changed, copies from the visible layer those that changed in the frame before, and is skipped
+// altogether when the visible layer already shows the scene.
+typedef enum {
+    WIDGET_TITLE,
+    WIDGET_ARTIST,
+    WIDGET_PROGRESS,
+    WIDGET_BACK,
+    WIDGET_NEXT,
+    WIDGET_PLAY,
+    WIDGET_VISUALIZER,
+    WIDGET_COUNT
+} WidgetId;
+
+typedef struct {
+    bool valid;
+    // Hash of the text mixed with its scroll offset, filled width of the progress bar with the version of its
+    // peaks, look of a button, or the analysis shown by the visualizer
+    uint32_t value;
+} WidgetState;
+
+// Indexed by foreground buffer, a buffer is invalid until it was cleared once
+static WidgetState scene[FOREGROUND_BUFFERS][WIDGET_COUNT];
+static bool scene_valid[FOREGROUND_BUFFERS];
+
+// What the browser shows in each foreground buffer, only valid while the buffer holds it
+typedef struct {
+    bool valid;
+    uint32_t version;
+    uint32_t track_count;
+    uint32_t current_track;
+    int32_t offset;
+} BrowserView;
+
+static BrowserView browser_views[FOREGROUND_BUFFERS];
+static DisplayStats display_stats;
+static uint32_t frame_pixels;
+// When drawing of the frame started, and the DMA2D wait time by then, to tell the CPU time apart
+static uint32_t frame_start;
+static uint64_t frame_start_wait_cycles;
 
 // SHAPES
 // Rectangle
@@ -78,6 +292,7 @@ static Button back_button = {
                 .shapes = chevron_left_icon_shapes,
                 .shapes_count = 1,
         },
+        .hold_ms = 600,
         .last_changed_state = 0,
         .is_touched = false,
         .active = false
@@ -164,29 +379,134 @@ static Button *buttons[] = {
         &pause_button
 };
 
+// Circle and icon of every button, in the order of buttons, rasterized once by the BSP as A8 masks
+// of the button's bounding square
+typedef struct {
+    GfxMask background;
+    GfxMask icon;
+} ButtonSprites;
+
+static ButtonSprites button_sprites[COUNT(buttons)];
+
+// Touch input, owned by the controller task
+static GestureRecognizer recognizer;
+static bool dragging;
+static double drag_progress;
+static bool seek_requested;
+static double seek_progress;
+static uint32_t input_cycles;
+
+// The browser, also owned by the controller task. Its touches all drag the list: one that did not stray
+// is a tap on a row, unless it stopped a fling, and a sideways swipe closes the browser.
+static GestureRecognizer list_recognizer;
+static bool browsing;
+static bool browser_opening;
+static uint32_t browser_version;
+static uint32_t browser_track_count;
+static Scroller scroller;
+static bool list_touched;
+static bool list_touch_strayed;
+static bool list_touch_stopped;
+static Gesture list_touch_start;
+static bool browser_selected;
+static uint32_t browser_selection;
+// Rows read for the window last asked for
+static BrowserRow browser_rows[BROWSER_ROWS];
+static bool browser_rows_valid;
+static uint32_t browser_first_row;
+
 // Progress bar
 static const Point progress_bar_boundaries[] = {
-        {10, 150},
-        {DISPLAY_WIDTH - 10, 160}
+        {PROGRESS_X, PROGRESS_Y},
+        {PROGRESS_X + PROGRESS_WIDTH, PROGRESS_Y + PROGRESS_HEIGHT}
 };
 
+static void rasterize_sprites(void);
+static void start_display_task(void);
+static BoundingRect get_widget_rect(WidgetId widget);
+
+static void set_layer_visible(int layer, bool visible) {
+    if (layer_visible[layer] != visible) {
+        BSP_LCD_SetLayerVisible_NoReload(layer, visible ? ENABLE : DISABLE);
+        layer_visible[layer] = visible;
+        layers_changed = true;
+    }
+}
+
+static void latch_layer_changes(void) {
+    if (layers_changed) {
+        layers_changed = false;
+        reload_pending = true;
+        BSP_LCD_Reload(LCD_RELOAD_VERTICAL_BLANKING);
+    }
+}
+
+// The first line of the vertical blanking
+static uint32_t get_vsync_line(void) {
+    return hLtdcHandler.Init.AccumulatedActiveH + 1;
+}
+
+void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc) {
+    osSemaphoreRelease(vsync_semaphore);
+}
+
+void HAL_LTDC_ReloadEventCallback(LTDC_HandleTypeDef *hltdc) {
+    reload_pending = false;
+}
+
+// The BSP has no L8 layers
+static void init_background_layer(void) {
+    for (unsigned i = 0; i < BACKGROUND_COLORS; i++) {
+        const uint32_t level = i * 255 / (BACKGROUND_COLORS - 1);
+        background_clut[i] = level << 16 | level << 8 | level;
+    }
+    LTDC_LayerCfgTypeDef config = {
+            .WindowX0 = 0,
+            .WindowX1 = DISPLAY_WIDTH,
+            .WindowY0 = 0,
+            .WindowY1 = DISPLAY_HEIGHT,
+            .PixelFormat = LTDC_PIXEL_FORMAT_L8,
+            .Alpha = 255,
+            .Alpha0 = 0,
+            .BlendingFactor1 = LTDC_BLENDING_FACTOR1_CA,
+            .BlendingFactor2 = LTDC_BLENDING_FACTOR2_CA,
+            .FBStartAdress = (uint32_t) (uintptr_t) background_images[current_background],
+            .ImageWidth = DISPLAY_WIDTH,
+            .ImageHeight = DISPLAY_HEIGHT
+    };
+    HAL_LTDC_ConfigLayer(&hLtdcHandler, &config, LCD_LAYER_BG);
+    HAL_LTDC_ConfigCLUT(&hLtdcHandler, background_clut, BACKGROUND_COLORS, LCD_LAYER_BG);
+    HAL_LTDC_EnableCLUT(&hLtdcHandler, LCD_LAYER_BG);
+}
+
 void initialize_screen() {
     // Initialize screen
     BSP_LCD_Init();
 
-    BSP_LCD_LayerDefaultInit(LCD_LAYER_FG, (uint32_t) lcd_image_fg);
-    BSP_LCD_LayerDefaultInit(LCD_LAYER_BG, (uint32_t) lcd_image_bg);
+    // The BSP sizes a new layer after the active one, which must still be the full screen
+    BSP_LCD_LayerRgb565Init(LCD_LAYER_FG, (uint32_t) (uintptr_t) foreground_images[current_buffer]);
+    BSP_LCD_SetLayerWindow(LCD_LAYER_FG, 0, WINDOW_TOP, DISPLAY_WIDTH, WINDOW_HEIGHT);
+    init_background_layer();
 
-    BSP_LCD_SelectLayer(LCD_LAYER_BG);
-    BSP_LCD_Clear(LCD_COLOR_BLACK);
+    BSP_LCD_SetLayerVisible(LCD_LAYER_FG, DISABLE);
+    BSP_LCD_SetLayerVisible(LCD_LAYER_BG, DISABLE);
+    BSP_LCD_DisplayOn();
 
+    // The sprites are rasterized by the BSP in the foreground layer before it is first shown
     BSP_LCD_SelectLayer(LCD_LAYER_FG);
-    BSP_LCD_Clear(LCD_COLOR_BLACK);
-
-    BSP_LCD_SetLayerVisible(current_layer, ENABLE);
-    BSP_LCD_DisplayOn();
+    if (gfx_init() != 0) {
+        log_error("Failed to initialize DMA2D drawing");
+    }
+    rasterize_sprites();
 
-    BSP_TS_Init(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    // A drag on the progress bar may start a little off it, short of the play button below
+    gesture_init(&recognizer, progress_bar_boundaries[0].X - DRAG_MARGIN, progress_bar_boundaries[0].Y - DRAG_MARGIN,
+                 progress_bar_boundaries[1].X + DRAG_MARGIN, progress_bar_boundaries[1].Y + DRAG_MARGIN);
+    gesture_init(&list_recognizer, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    if (touch_init(DISPLAY_WIDTH, DISPLAY_HEIGHT) != 0) {
+        log_error("Touch input is not available");
+    }
+    start_display_task();
 }
 
 void render_text(const char *text, int x, int y, sFONT *font, uint32_t color, uint32_t background_color,
@@ -248,40 +568,215 @@ void transform_points(const Point center_position, const Point *icon_points, uin
     }
 }
 
-bool is_button_touched(Button button, TS_StateTypeDef touch_state) {
-    return touch_state.touchX[0] > button.center_position.X - button.radius &&
-           touch_state.touchX[0] < button.center_position.X + button.radius &&
-           touch_state.touchY[0] > button.center_position.Y - button.radius &&
-           touch_state.touchY[0] < button.center_position.Y + button.radius;
+static bool is_on_button(const Button *button, int x, int y) {
+    return x > button->center_position.X - button->radius && x < button->center_position.X + button->radius &&
+           y > button->center_position.Y - button->radius && y < button->center_position.Y + button->radius;
 }
 
-void handle_touch() {
-    unsigned current_tick = osKernelSysTick();
-    TS_StateTypeDef touch_state;
-    BSP_TS_GetState(&touch_state);
+static void activate(Button *button, const Gesture *gesture) {
+    button->active = true;
+    button->last_changed_state = gesture->tick;
+    input_cycles = gesture->cycles;
+}
 
-    for (int i = 0; i < COUNT(buttons); i++) {
-        Button *button = buttons[i];
-        if (button->disabled) continue;
-        bool is_touched = is_button_touched(*button, touch_state);
-        if (is_touched != button->is_touched) {
-            if (current_tick - button->last_changed_state >= 100) {
-                if (!button->is_touched && is_touched) {
-                    button->active = true;
+static void release_buttons(void) {
+    for (unsigned i = 0; i < COUNT(buttons); i++) {
+        buttons[i]->is_touched = false;
+    }
+}
+
+static double get_drag_progress(int x) {
+    const int left = progress_bar_boundaries[0].X;
+    const int right = progress_bar_boundaries[1].X;
+    return x <= left ? 0 : x >= right ? 1 : (double) (x - left) / (right - left);
+}
+
+static bool is_on_track_texts(const Gesture *gesture) {
+    return gesture->y >= get_widget_rect(WIDGET_TITLE).y1 && gesture->y < get_widget_rect(WIDGET_ARTIST).y2;
+}
+
+// The list is centered on the current track at the next render
+static void open_browser(void) {
+    browsing = true;
+    browser_opening = true;
+    list_touched = false;
+    gesture_reset(&list_recognizer);
+}
+
+// Buttons are pressed by a touch going down on them and active once it is lifted without straying, so a
+// swipe starting on one does not set it off. Buttons with a hold time are held once every hold time
+// of a longer press instead.
+static void handle_gesture(const Gesture *gesture) {
+    switch (gesture->type) {
+        case GESTURE_PRESS:
+            for (unsigned i = 0; i < COUNT(buttons); i++) {
+                Button *button = buttons[i];
+                if (!button->disabled && is_on_button(button, gesture->x, gesture->y)) {
+                    button->is_touched = true;
+                    button->pressed_at = gesture->tick;
+                    button->holds = 0;
+                }
+            }
+            break;
+        case GESTURE_TAP:
+            for (unsigned i = 0; i < COUNT(buttons); i++) {
+                Button *button = buttons[i];
+                if (button->is_touched && !button->disabled && button->holds == 0) {
+                    activate(button, gesture);
                 }
-                button->is_touched = is_touched;
             }
-            button->last_changed_state = current_tick;
+            if (is_on_track_texts(gesture)) {
+                open_browser();
+            }
+            release_buttons();
+            break;
+        case GESTURE_SWIPE_LEFT:
+            release_buttons();
+            activate(&next_button, gesture);
+            break;
+        case GESTURE_SWIPE_RIGHT:
+            release_buttons();
+            activate(&back_button, gesture);
+            break;
+        case GESTURE_DRAG:
+            dragging = true;
+            drag_progress = get_drag_progress(gesture->x);
+            break;
+        case GESTURE_DRAG_END:
+            dragging = false;
+            seek_progress = get_drag_progress(gesture->x);
+            seek_requested = true;
+            input_cycles = gesture->cycles;
+            break;
+        default:
+            release_buttons();
+            break;
+    }
+}
+
+static void select_row(const Gesture *gesture) {
+    if (gesture->y < WINDOW_TOP || gesture->y >= WINDOW_TOP + WINDOW_HEIGHT) {
+        return;
+    }
+    const uint32_t row = (uint32_t) (scroller_get_offset(&scroller) + gesture->y - WINDOW_TOP) / ROW_HEIGHT;
+    if (row < browser_track_count) {
+        browser_selection = row;
+        browser_selected = true;
+        input_cycles = gesture->cycles;
+        close_browser();
+    }
+}
+
+static bool is_swipe(const Gesture *start, const Gesture *end) {
+    const int dx = end->x - start->x;
+    const int dy = end->y - start->y;
+    return abs(dx) >= GESTURE_SWIPE_MIN_PX && abs(dx) > 2 * abs(dy) && end->tick - start->tick <= GESTURE_SWIPE_MAX_MS;
+}
+
+static void handle_list_gesture(const Gesture *gesture) {
+    if (gesture->type == GESTURE_DRAG && !list_touched) {
+        list_touched = true;
+        list_touch_strayed = false;
+        list_touch_stopped = scroller_is_moving(&scroller);
+        list_touch_start = *gesture;
+        scroller_press(&scroller, gesture->y, gesture->tick);
+    } else if (gesture->type == GESTURE_DRAG) {
+        list_touch_strayed |= abs(gesture->x - list_touch_start.x) > GESTURE_TAP_SLOP_PX ||
+                              abs(gesture->y - list_touch_start.y) > GESTURE_TAP_SLOP_PX;
+        scroller_drag(&scroller, gesture->y, gesture->tick);
+    } else if (gesture->type == GESTURE_DRAG_END && list_touched) {
+        list_touched = false;
+        scroller_release(&scroller, gesture->tick);
+        if (!list_touch_strayed && !list_touch_stopped) {
+            select_row(&list_touch_start);
+        } else if (is_swipe(&list_touch_start, gesture)) {
+            close_browser();
+        }
+    }
+}
+
+void handle_touch() {
+    TouchEvent event;
+    Gesture gesture;
+    while (touch_get_event(&event)) {
+        if (browsing) {
+            if (gesture_feed(&list_recognizer, &event, &gesture)) {
+                handle_list_gesture(&gesture);
+            }
+        } else if (gesture_feed(&recognizer, &event, &gesture)) {
+            handle_gesture(&gesture);
+        }
+    }
+
+    const unsigned current_tick = osKernelSysTick();
+    for (unsigned i = 0; i < COUNT(buttons); i++) {
+        Button *button = buttons[i];
+        if (button->is_touched && button->hold_ms != 0 &&
+            current_tick - button->pressed_at >= (button->holds + 1) * button->hold_ms) {
+            button->holds++;
+            button->held = true;
         }
     }
 }
 
+void discard_touches(void) {
+    touch_flush();
+    gesture_reset(&recognizer);
+    gesture_reset(&list_recognizer);
+    release_buttons();
+    dragging = false;
+    list_touched = false;
+}
+
+bool is_screen_touched(void) {
+    discard_touches();
+    return touch_is_down();
+}
+
+bool get_seek_request(double *progress) {
+    if (!seek_requested) {
+        return false;
+    }
+    seek_requested = false;
+    *progress = seek_progress;
+    return true;
+}
+
+bool is_browser_open(void) {
+    return browsing;
+}
+
+void close_browser(void) {
+    browsing = false;
+    list_touched = false;
+    gesture_reset(&recognizer);
+}
+
+bool get_browser_selection(uint32_t *index) {
+    if (!browser_selected) {
+        return false;
+    }
+    browser_selected = false;
+    *index = browser_selection;
+    return true;
+}
+
+uint32_t get_input_cycles(void) {
+    return input_cycles;
+}
+
 bool is_back_button_active() {
     bool active = back_button.active;
     back_button.active = false;
     return active;
 }
 
+bool is_back_button_held(void) {
+    bool held = back_button.held;
+    back_button.held = false;
+    return held;
+}
+
 bool is_next_button_active() {
     bool active = next_button.active;
     next_button.active = false;
@@ -300,36 +795,147 @@ bool is_pause_button_active() {
     return active;
 }
 
-void swap_screen_layers() {
-    // Wait for VSYNC
-    while (!(LTDC->CDSR & LTDC_CDSR_VSYNCS));
+static void swap_screen_buffers(void) {
+    current_buffer = !current_buffer;
+    BSP_LCD_SetLayerAddress_NoReload(LCD_LAYER_FG, (uint32_t) (uintptr_t) foreground_images[current_buffer]);
+    layers_changed = true;
+}
+
+static void begin_frame(void) {
+    GfxStats gfx_stats;
+    gfx_get_stats(&gfx_stats);
+    frame_start = profiler_cycles();
+    frame_start_wait_cycles = gfx_stats.wait_cycles;
+}
+
+// The DMA2D must be done before the buffer is shown
+static void finish_frame(void) {
+    gfx_wait();
+    GfxStats gfx_stats;
+    gfx_get_stats(&gfx_stats);
+    display_stats.draw_cycles += profiler_cycles() - frame_start - (gfx_stats.wait_cycles - frame_start_wait_cycles);
+    display_stats.frames++;
+    display_stats.pixels += frame_pixels;
+    display_stats.last_pixels = frame_pixels;
+    display_stats.max_pixels = MAX(display_stats.max_pixels, frame_pixels);
+    frame_pixels = 0;
+}
+
+static void fill_rect(int x, int y, int width, int height, uint32_t color) {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    gfx_fill(&foreground_surfaces[!current_buffer], x, y, width, height, color);
+    frame_pixels += width * height;
+}
+
+// The run in grey levels on a cleared background buffer
+static void draw_background_text(volatile uint8_t image[][DISPLAY_WIDTH], const char *text, int x, int y,
+                                 const Font *font) {
+    const GfxMask *mask = text_render(font, text, DISPLAY_WIDTH - x);
+    if (mask == NULL) {
+        return;
+    }
+    for (unsigned row = 0; row < mask->height && y + row < DISPLAY_HEIGHT; row++) {
+        for (unsigned column = 0; column < mask->width; column++) {
+            // A4 levels expanded to A8 map back exactly
+            image[y + row][x + column] = mask->alpha[row * mask->width + column] >> 4;
+        }
+    }
+}
+
+// Drawn by the CPU into the hidden background buffer, then shown in place of the track screen, whose
+// buffers are left as they are
+static void draw_info_screen(const char *info, const char *sub_info) {
+    const int drawing = !current_background;
+    begin_frame();
+    memset((void *) background_images[drawing], BACKGROUND_BLACK, sizeof(background_images[drawing]));
+    draw_background_text(background_images[drawing], info, INFO_TEXT_X, VH_TO_PX(40), info_font);
+    draw_background_text(background_images[drawing], sub_info, INFO_TEXT_X, VH_TO_PX(60), sub_info_font);
+    frame_pixels += DISPLAY_WIDTH * DISPLAY_HEIGHT;
+    display_stats.full_redraws++;
+    finish_frame();
 
-    current_layer = !current_layer;
-    BSP_LCD_SetLayerVisible(current_layer, ENABLE);
-    BSP_LCD_SetLayerVisible(!current_layer, DISABLE);
-    BSP_LCD_SelectLayer(!current_layer);
+    current_background = drawing;
+    BSP_LCD_SetLayerAddress_NoReload(LCD_LAYER_BG, (uint32_t) (uintptr_t) background_images[current_background]);
+    layers_changed = true;
+    set_layer_visible(LCD_LAYER_BG, true);
+    set_layer_visible(LCD_LAYER_FG, false);
+    screen = SCREEN_INFO;
+    fading = false;
 }
 
 void render_info_screen(const char *info, const char *sub_info) {
-    BSP_LCD_Clear(LCD_COLOR_BLACK);
+    osSemaphoreWait(request_lock, osWaitForever);
+    request.screen = SCREEN_INFO;
+    request.info_version++;
+    snprintf(request.info, sizeof(request.info), "%s", info);
+    snprintf(request.sub_info, sizeof(request.sub_info), "%s", sub_info);
+    osSemaphoreRelease(request_lock);
+}
+
+static int get_progress_width(double progress) {
+    return (int) (progress * PROGRESS_WIDTH);
+}
+
+// Played width in the low half, the version of the peaks drawn in the high one
+static uint32_t get_progress_look(double progress, uint32_t peaks_version) {
+    return (uint32_t) get_progress_width(progress) | peaks_version << 16;
+}
 
-    render_h1(info, VW_TO_PX(10), VH_TO_PX(40));
-    render_h2(sub_info, VW_TO_PX(10), VH_TO_PX(60));
+// The column of every bucket, from its lowest to its highest sample around the middle line
+static void draw_peaks_strip(void) {
+    const int middle = PROGRESS_HEIGHT / 2;
+    uint8_t *alpha = (uint8_t *) peaks_mask.alpha;
+    memset(alpha, 0, PROGRESS_WIDTH * PROGRESS_HEIGHT);
+    for (int column = 0; column < PROGRESS_WIDTH; column++) {
+        const int bucket = column * WAVEFORM_BUCKETS / PROGRESS_WIDTH;
+        int top = middle - PEAK_MIN_HEIGHT / 2;
+        int bottom = top + PEAK_MIN_HEIGHT;
+        if (peaks.min[bucket] <= peaks.max[bucket]) {
+            top = MIN(top, middle - peaks.max[bucket] * middle / 128);
+            bottom = MAX(bottom, middle - peaks.min[bucket] * middle / 128);
+        }
+        for (int y = MAX(0, top); y < MIN(PROGRESS_HEIGHT, bottom); y++) {
+            alpha[y * PROGRESS_WIDTH + column] = 0xFF;
+        }
+    }
+    gfx_fill(&peaks_strip, 0, 0, PROGRESS_WIDTH, 2 * PROGRESS_HEIGHT, LCD_COLOR_BLACK);
+    gfx_draw_mask(&peaks_strip, &peaks_mask, 0, 0, LCD_COLOR_WHITE);
+    gfx_draw_mask(&peaks_strip, &peaks_mask, 0, PROGRESS_HEIGHT, LCD_COLOR_GRAY);
+    peaks_strip_drawn = true;
+    display_stats.peaks_strips++;
+}
 
-    swap_screen_layers();
+static void copy_peaks(int from, int to, bool played) {
+    if (to > from) {
+        gfx_blit(&peaks_strip, from, played ? 0 : PROGRESS_HEIGHT, &foreground_surfaces[!current_buffer],
+                 PROGRESS_X + from, PROGRESS_Y, to - from, PROGRESS_HEIGHT);
+        frame_pixels += (to - from) * PROGRESS_HEIGHT;
+    }
 }
 
-void draw_progress_bar(double progress) {
-    // Create the outer rectangle
-    BSP_LCD_SetTextColor(LCD_COLOR_GRAY);
-    BSP_LCD_FillRect(progress_bar_boundaries[0].X, progress_bar_boundaries[0].Y,
-                     progress_bar_boundaries[1].X - progress_bar_boundaries[0].X,
-                     progress_bar_boundaries[1].Y - progress_bar_boundaries[0].Y);
-    // Create the inner rectangle
-    BSP_LCD_SetTextColor(LCD_COLOR_WHITE);
-    BSP_LCD_FillRect(progress_bar_boundaries[0].X + 2, progress_bar_boundaries[0].Y + 2,
-                     (int) (progress * (progress_bar_boundaries[1].X - progress_bar_boundaries[0].X - 4)),
-                     progress_bar_boundaries[1].Y - progress_bar_boundaries[0].Y - 4);
+// Only the columns between the old and the new width are copied, when the peaks drawn did not change
+static void draw_progress_bar(double progress, uint32_t peaks_version, const WidgetState *drawn) {
+    const int width = get_progress_width(progress);
+    if (peaks_strip.pixels == NULL) {
+        fill_rect(PROGRESS_X, PROGRESS_Y, PROGRESS_WIDTH, PROGRESS_HEIGHT, LCD_COLOR_GRAY);
+        fill_rect(PROGRESS_X, PROGRESS_Y, width, PROGRESS_HEIGHT, LCD_COLOR_WHITE);
+        return;
+    }
+    if (!peaks_strip_drawn || peaks.version != peaks_version) {
+        waveform_get_peaks(&peaks);
+        draw_peaks_strip();
+    }
+    const uint32_t look = get_progress_look(progress, peaks.version);
+    if (drawn->valid && drawn->value >> 16 == look >> 16) {
+        const int drawn_width = (int) (drawn->value & 0xFFFF);
+        copy_peaks(drawn_width, width, true);
+        copy_peaks(width, drawn_width, false);
+        return;
+    }
+    copy_peaks(0, width, true);
+    copy_peaks(width, PROGRESS_WIDTH, false);
 }
 
 void draw_shape(Shape shape, Point position, uint32_t color) {
@@ -355,48 +961,625 @@ void draw_icon(const Icon icon, Point position, uint32_t color) {
     }
 }
 
-void draw_button(const Button button, uint32_t background_color, uint32_t icon_color, uint32_t active_background_color,
-                 uint32_t active_icon_color) {
+// The active background color shows while the button is pressed and for 300 ms after it was activated
+static bool is_button_highlighted(const Button *button) {
+    return button->is_touched || osKernelSysTick() - button->last_changed_state < 300;
+}
+
+static const ButtonSprites *get_button_sprites(const Button *button) {
+    for (unsigned i = 0; i < COUNT(buttons); i++) {
+        if (buttons[i] == button) {
+            return &button_sprites[i];
+        }
+    }
+    return NULL;
+}
+
+// Rasterizes the circle or the icon of the button in white on black in the foreground layer, at its
+// place in the window, and keeps the blue channel of its bounding square
+static int rasterize_button_mask(const Button *button, bool icon, GfxMask *mask) {
+    const int size = 2 * button->radius + 1;
+    const Point center = {button->center_position.X, button->center_position.Y - WINDOW_TOP};
+    const int left = center.X - button->radius;
+    const int top = center.Y - button->radius;
+    uint8_t *alpha = sdram_alloc(size * size);
+    if (alpha == NULL) {
+        return 1;
+    }
+
+    BSP_LCD_SetTextColor(LCD_COLOR_BLACK);
+    BSP_LCD_FillRect(left, top, size, size);
+    if (icon) {
+        draw_icon(button->icon, center, LCD_COLOR_WHITE);
+    } else {
+        BSP_LCD_SetTextColor(LCD_COLOR_WHITE);
+        BSP_LCD_FillEllipse(center.X, center.Y, button->radius, button->radius);
+    }
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            alpha[y * size + x] = (foreground_images[current_buffer][top + y][left + x] & 0x1F) * 255 / 0x1F;
+        }
+    }
+    *mask = (GfxMask) {.alpha = alpha, .width = size, .height = size};
+    return 0;
+}
+
+static int allocate_strip(Marquee *marquee, const Font *font) {
+    void *pixels = sdram_alloc(MARQUEE_STRIP_WIDTH * font->height * sizeof(foreground_images[0][0][0]));
+    marquee->strip = (GfxSurface) {pixels, GFX_FORMAT_RGB565, 0, 0, MARQUEE_STRIP_WIDTH, font->height};
+    return pixels == NULL;
+}
+
+static int allocate_peaks_strip(void) {
+    uint8_t *alpha = sdram_alloc(PROGRESS_WIDTH * PROGRESS_HEIGHT);
+    void *pixels = sdram_alloc(PROGRESS_WIDTH * 2 * PROGRESS_HEIGHT * sizeof(foreground_images[0][0][0]));
+    if (alpha == NULL || pixels == NULL) {
+        return 1;
+    }
+    peaks_mask = (GfxMask) {alpha, PROGRESS_WIDTH, PROGRESS_HEIGHT};
+    peaks_strip = (GfxSurface) {pixels, GFX_FORMAT_RGB565, 0, 0, PROGRESS_WIDTH, 2 * PROGRESS_HEIGHT};
+    return 0;
+}
+
+// The foreground is only drawn by the DMA2D, a widget without its sprite or text run is left out
+static void rasterize_sprites(void) {
+    int failed = 0;
+    for (unsigned i = 0; i < COUNT(buttons); i++) {
+        failed |= rasterize_button_mask(buttons[i], false, &button_sprites[i].background);
+        failed |= rasterize_button_mask(buttons[i], true, &button_sprites[i].icon);
+    }
+    failed |= text_init();
+    failed |= allocate_strip(&title_marquee, title_font);
+    failed |= allocate_strip(&artist_marquee, artist_font);
+    failed |= allocate_peaks_strip();
+    for (int i = 0; i < FOREGROUND_BUFFERS; i++) {
+        gfx_fill(&foreground_surfaces[i], 0, WINDOW_TOP, DISPLAY_WIDTH, WINDOW_HEIGHT, LCD_COLOR_BLACK);
+        scene_valid[i] = true;
+    }
+    gfx_wait();
+    if (failed) {
+        log_error("Failed to allocate sprites, some widgets will not be drawn");
+    }
+}
+
+void draw_button(const Button *button, uint32_t background_color, uint32_t icon_color,
+                 uint32_t active_background_color, uint32_t active_icon_color) {
     // Draw circular button background with button radius on the target center position
-    // Display the active background color if the time after last active state change is less than 300ms
     uint32_t bg_color;
     uint32_t i_color;
-    if (button.active && osKernelSysTick() - button.last_changed_state < 300) {
+    if (is_button_highlighted(button)) {
         bg_color = active_background_color;
         i_color = active_icon_color;
     } else {
         bg_color = background_color;
         i_color = icon_color;
     }
-    BSP_LCD_SetTextColor(bg_color);
-    BSP_LCD_FillEllipse(button.center_position.X, button.center_position.Y, button.radius, button.radius);
-    // Draw button icon
-    draw_icon(button.icon, button.center_position, i_color);
+    frame_pixels += (2 * button->radius + 1) * (2 * button->radius + 1);
+    const ButtonSprites *sprites = get_button_sprites(button);
+    if (sprites == NULL || sprites->background.alpha == NULL || sprites->icon.alpha == NULL) {
+        return;
+    }
+    const GfxSurface *target = &foreground_surfaces[!current_buffer];
+    const int left = button->center_position.X - button->radius;
+    const int top = button->center_position.Y - button->radius;
+    gfx_draw_mask(target, &sprites->background, left, top, bg_color);
+    // Draw button icon, inside the circle
+    gfx_draw_mask(target, &sprites->icon, left, top, i_color);
+}
+
+static uint32_t hash_text(const char *text) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    while (*text != '\0') {
+        hash = (hash ^ (uint8_t) *text++) * 16777619u;
+    }
+    return hash;
+}
+
+static BoundingRect get_text_rect(int y, const Font *font) {
+    return (BoundingRect) {0, y, DISPLAY_WIDTH, y + font->height};
+}
+
+static BoundingRect get_button_rect(const Button *button) {
+    return (BoundingRect) {button->center_position.X - button->radius, button->center_position.Y - button->radius,
+                           button->center_position.X + button->radius + 1,
+                           button->center_position.Y + button->radius + 1};
+}
+
+static BoundingRect get_widget_rect(WidgetId widget) {
+    switch (widget) {
+        case WIDGET_TITLE:
+            return get_text_rect(VH_TO_PX(20), title_font);
+        case WIDGET_ARTIST:
+            return get_text_rect(VH_TO_PX(30), artist_font);
+        case WIDGET_PROGRESS:
+            return (BoundingRect) {progress_bar_boundaries[0].X, progress_bar_boundaries[0].Y,
+                                   progress_bar_boundaries[1].X, progress_bar_boundaries[1].Y};
+        case WIDGET_BACK:
+            return get_button_rect(&back_button);
+        case WIDGET_NEXT:
+            return get_button_rect(&next_button);
+        case WIDGET_VISUALIZER:
+            return (BoundingRect) {TEXT_X, VISUALIZER_TOP, TEXT_X + TEXT_WIDTH, VISUALIZER_TOP + VISUALIZER_HEIGHT};
+        default:
+            return get_button_rect(&play_button);
+    }
+}
+
+static uint32_t get_button_look(const Button *button, bool is_pause) {
+    return is_button_highlighted(button) | is_pause << 1;
+}
+
+static void copy_rect(BoundingRect rect, int from_buffer, int to_buffer) {
+    gfx_copy(&foreground_surfaces[from_buffer], &foreground_surfaces[to_buffer], rect.x1, rect.y1, rect.x2 - rect.x1,
+             rect.y2 - rect.y1);
+    const uint32_t pixels = (rect.x2 - rect.x1) * (rect.y2 - rect.y1);
+    frame_pixels += pixels;
+    display_stats.copied_pixels += pixels;
+}
+
+// Where the text is in its round, a new text starts it over
+static uint32_t get_text_look(Marquee *marquee, const char *text, const Font *font) {
+    const uint32_t hash = hash_text(text);
+    if (!marquee->valid || marquee->hash != hash) {
+        const GfxMask *mask = text_render(font, text, TEXT_RUN_MAX_WIDTH);
+        marquee->valid = true;
+        marquee->hash = hash;
+        marquee->text_width = mask != NULL ? mask->width : 0;
+        marquee->strip_drawn = false;
+        marquee->start = osKernelSysTick();
+    }
+    marquee->offset = 0;
+    if (marquee->text_width > TEXT_WIDTH) {
+        const uint32_t distance = marquee->text_width + MARQUEE_GAP;
+        const uint32_t round_ms = MARQUEE_PAUSE_MS + distance * 1000 / MARQUEE_SPEED_PX_PER_S;
+        const uint32_t elapsed = (osKernelSysTick() - marquee->start) % round_ms;
+        if (elapsed > MARQUEE_PAUSE_MS) {
+            marquee->offset = (int) MIN(distance - 1, (elapsed - MARQUEE_PAUSE_MS) * MARQUEE_SPEED_PX_PER_S / 1000);
+        }
+    }
+    return hash ^ (uint32_t) marquee->offset * 2654435761u;
+}
+
+// The text and its start again after the gap, white on black
+static void draw_strip(Marquee *marquee, const char *text, const Font *font) {
+    const GfxMask *mask = text_render(font, text, TEXT_RUN_MAX_WIDTH);
+    if (mask == NULL) {
+        return;
+    }
+    marquee->strip.width = mask->width + MARQUEE_GAP + TEXT_WIDTH;
+    gfx_fill(&marquee->strip, 0, 0, marquee->strip.width, marquee->strip.height, LCD_COLOR_BLACK);
+    gfx_draw_mask(&marquee->strip, mask, 0, 0, LCD_COLOR_WHITE);
+    gfx_draw_mask(&marquee->strip, mask, mask->width + MARQUEE_GAP, 0, LCD_COLOR_WHITE);
+    marquee->strip_drawn = true;
+    display_stats.marquee_strips++;
+}
+
+// One blend of the whole run over the cleared rectangle, or one copy out of the strip of a scrolling text.
+// Texts stay between the margins, which are left black.
+static void draw_text_widget(const char *text, BoundingRect rect, const Font *font, Marquee *marquee) {
+    const GfxSurface *target = &foreground_surfaces[!current_buffer];
+    if (marquee->text_width > TEXT_WIDTH && marquee->strip.pixels != NULL) {
+        if (!marquee->strip_drawn) {
+            draw_strip(marquee, text, font);
+        }
+        gfx_blit(&marquee->strip, marquee->offset, 0, target, TEXT_X, rect.y1, TEXT_WIDTH, font->height);
+        frame_pixels += TEXT_WIDTH * font->height;
+        display_stats.marquee_frames++;
+        return;
+    }
+    fill_rect(rect.x1, rect.y1, rect.x2 - rect.x1, rect.y2 - rect.y1, LCD_COLOR_BLACK);
+    const GfxMask *mask = text_render(font, text, TEXT_RUN_MAX_WIDTH);
+    if (mask == NULL) {
+        return;
+    }
+    gfx_draw_mask(target, mask, TEXT_X, rect.y1, LCD_COLOR_WHITE);
+}
+
+static int get_level_height(uint8_t level) {
+    return level * VISUALIZER_HEIGHT / VISUALIZER_LEVEL_MAX;
+}
+
+// Bars grow up from the bottom of the rectangle, nothing is drawn without a recent analysis
+static void draw_visualizer(BoundingRect rect) {
+    fill_rect(rect.x1, rect.y1, rect.x2 - rect.x1, rect.y2 - rect.y1, LCD_COLOR_BLACK);
+    if (!visualizer_shown) {
+        return;
+    }
+    for (int band = 0; band < VISUALIZER_BANDS; band++) {
+        const int height = get_level_height(visualizer_frame.bands[band]);
+        fill_rect(rect.x1 + band * BAR_PITCH, rect.y2 - height, BAR_PITCH - BAR_GAP, height, LCD_COLOR_WHITE);
+    }
+    for (int channel = 0; channel < 2; channel++) {
+        const int x = rect.x2 - (2 - channel) * (METER_WIDTH + METER_GAP) + METER_GAP;
+        const int rms = get_level_height(visualizer_frame.rms[channel]);
+        const int peak = get_level_height(visualizer_frame.peak[channel]);
+        fill_rect(x, rect.y2 - rms, METER_WIDTH, rms, LCD_COLOR_WHITE);
+        if (peak > 0) {
+            fill_rect(x, rect.y2 - peak, METER_WIDTH, 2, LCD_COLOR_GRAY);
+        }
+    }
+}
+
+static void draw_widget(WidgetId widget, const WidgetState *drawn, const char *track_name, const char *artist_name,
+                        double progress, uint32_t peaks_version, bool is_playing) {
+    switch (widget) {
+        case WIDGET_TITLE:
+            draw_text_widget(track_name, get_widget_rect(widget), title_font, &title_marquee);
+            break;
+        case WIDGET_ARTIST:
+            draw_text_widget(artist_name, get_widget_rect(widget), artist_font, &artist_marquee);
+            break;
+        case WIDGET_PROGRESS:
+            draw_progress_bar(progress, peaks_version, drawn);
+            break;
+        case WIDGET_BACK:
+            draw_button(&back_button, LCD_COLOR_GRAY, LCD_COLOR_WHITE, LCD_COLOR_WHITE, LCD_COLOR_BLACK);
+            break;
+        case WIDGET_NEXT:
+            draw_button(&next_button, LCD_COLOR_GRAY, LCD_COLOR_WHITE, LCD_COLOR_WHITE, LCD_COLOR_BLACK);
+            break;
+        case WIDGET_VISUALIZER:
+            draw_visualizer(get_widget_rect(widget));
+            break;
+        default:
+            if (is_playing) {
+                draw_button(&pause_button, LCD_COLOR_WHITE, LCD_COLOR_BLACK, LCD_COLOR_GRAY, LCD_COLOR_WHITE);
+            } else {
+                draw_button(&play_button, LCD_COLOR_WHITE, LCD_COLOR_BLACK, LCD_COLOR_GRAY, LCD_COLOR_WHITE);
+            }
+            break;
+    }
+}
+
+// The track screen comes in over the info screen, which stays on the background layer until the
+// foreground is opaque; it is then switched off, the LTDC background color is black like it
+static void update_fade(void) {
+    if (!fading) {
+        return;
+    }
+    const unsigned elapsed = osKernelSysTick() - fade_start;
+    layers_changed = true;
+    if (elapsed >= FADE_MS) {
+        BSP_LCD_SetTransparency_NoReload(LCD_LAYER_FG, 255);
+        set_layer_visible(LCD_LAYER_BG, false);
+        fading = false;
+        return;
+    }
+    BSP_LCD_SetTransparency_NoReload(LCD_LAYER_FG, elapsed * 255 / FADE_MS);
+    set_layer_visible(LCD_LAYER_FG, true);
+}
+
+// Both foreground screens share the buffers, only coming from the info screen fades
+static void show_foreground_screen(Screen next) {
+    if (screen != SCREEN_TRACK && screen != SCREEN_BROWSER) {
+        fading = true;
+        fade_start = osKernelSysTick();
+    }
+    screen = next;
+    update_fade();
+}
+
+static bool is_same_state(const WidgetState *a, const WidgetState *b) {
+    return a->valid && b->valid && a->value == b->value;
+}
+
+static void draw_track_screen(const ScreenRequest *frame) {
+    PROFILER_ZONE(PROFILER_ZONE_RENDER);
+
+    const char *track_name = frame->track_name;
+    const char *artist_name = frame->artist_name;
+    const double progress = frame->progress;
+    const bool is_playing = frame->is_playing;
+    visualizer_shown = visualizer_get_frame(&visualizer_frame);
+    const uint32_t peaks_version = waveform_get_version();
+    const WidgetState next[WIDGET_COUNT] = {
+            [WIDGET_TITLE] = {true, get_text_look(&title_marquee, track_name, title_font)},
+            [WIDGET_ARTIST] = {true, get_text_look(&artist_marquee, artist_name, artist_font)},
+            [WIDGET_PROGRESS] = {true, get_progress_look(progress, peaks_version)},
+            [WIDGET_BACK] = {true, get_button_look(&back_button, false)},
+            [WIDGET_NEXT] = {true, get_button_look(&next_button, false)},
+            [WIDGET_PLAY] = {true, get_button_look(is_playing ? &pause_button : &play_button, is_playing)},
+            [WIDGET_VISUALIZER] = {true, visualizer_shown ? visualizer_frame.sequence : 0},
+    };
+
+    show_foreground_screen(SCREEN_TRACK);
+
+    const int visible = current_buffer;
+    const int drawing = !current_buffer;
+    bool changed = false;
+    for (int i = 0; i < WIDGET_COUNT; i++) {
+        changed |= !scene_valid[visible] || !is_same_state(&scene[visible][i], &next[i]);
+    }
+    if (!changed) {
+        display_stats.frames_skipped++;
+        return;
+    }
+
+    begin_frame();
+    if (!scene_valid[drawing]) {
+        fill_rect(0, WINDOW_TOP, DISPLAY_WIDTH, WINDOW_HEIGHT, LCD_COLOR_BLACK);
+        display_stats.full_redraws++;
+        for (int i = 0; i < WIDGET_COUNT; i++) {
+            scene[drawing][i].valid = false;
+        }
+        scene_valid[drawing] = true;
+    }
+    for (int i = 0; i < WIDGET_COUNT; i++) {
+        if (is_same_state(&scene[drawing][i], &next[i])) {
+            continue;
+        }
+        if (scene_valid[visible] && is_same_state(&scene[visible][i], &next[i])) {
+            copy_rect(get_widget_rect(i), visible, drawing);
+        } else {
+            draw_widget(i, &scene[drawing][i], track_name, artist_name, progress, peaks_version, is_playing);
+        }
+        scene[drawing][i] = next[i];
+    }
+    browser_views[drawing].valid = false;
+
+    finish_frame();
+    swap_screen_buffers();
 }
 
-void render_track_screen(const char *track_name, const char *artist_name, int total_files_count, int current_file_index,
-                         double progress, double duration, bool is_playing) {
-    BSP_LCD_Clear(LCD_COLOR_BLACK);
+void render_track_screen(const char *track_name, const char *artist_name, double progress, bool is_playing) {
+    // Read by the touch handling of the controller
+    play_button.disabled = is_playing;
+    pause_button.disabled = !is_playing;
 
-    render_h3(track_name, VW_TO_PX(5), VH_TO_PX(20));
-    render_h4(artist_name, VW_TO_PX(5), VH_TO_PX(30));
+    osSemaphoreWait(request_lock, osWaitForever);
+    request.screen = SCREEN_TRACK;
+    snprintf(request.track_name, sizeof(request.track_name), "%s", track_name);
+    snprintf(request.artist_name, sizeof(request.artist_name), "%s", artist_name);
+    // The bar follows a drag before the seek it asks for is done
+    request.progress = dragging ? drag_progress : progress;
+    request.is_playing = is_playing;
+    osSemaphoreRelease(request_lock);
+}
 
-    draw_progress_bar(progress);
+// Title over artist and album, the current track on grey. Rows are drawn whole, the texts outside the
+// window are clipped by the DMA2D.
+static void draw_browser_row(const ScreenRequest *frame, uint32_t index, int y) {
+    const GfxSurface *target = &foreground_surfaces[!current_buffer];
+    const BrowserRow *row = &frame->rows[index - frame->first_row];
+    const int top = MAX(y, WINDOW_TOP);
+    const int bottom = MIN(y + ROW_HEIGHT, WINDOW_TOP + WINDOW_HEIGHT);
+    fill_rect(0, top, DISPLAY_WIDTH, bottom - top,
+              index == frame->current_track ? LCD_COLOR_DARKGRAY : LCD_COLOR_BLACK);
+    if (y + ROW_HEIGHT <= bottom) {
+        fill_rect(TEXT_X, y + ROW_HEIGHT - 1, TEXT_WIDTH, 1, LCD_COLOR_DARKGRAY);
+    }
+    const GfxMask *title = text_render(title_font, row->title, TEXT_WIDTH);
+    if (title != NULL) {
+        gfx_draw_mask(target, title, TEXT_X, y + ROW_TITLE_Y, LCD_COLOR_WHITE);
+    }
+    const GfxMask *detail = text_render(artist_font, row->detail, TEXT_WIDTH);
+    if (detail != NULL) {
+        gfx_draw_mask(target, detail, TEXT_X, y + ROW_DETAIL_Y, LCD_COLOR_LIGHTGRAY);
+    }
+    display_stats.browser_rows++;
+}
 
-    // Back button
-    draw_button(back_button, LCD_COLOR_GRAY, LCD_COLOR_WHITE, LCD_COLOR_WHITE, LCD_COLOR_BLACK);
-    // Next button
-    draw_button(next_button, LCD_COLOR_GRAY, LCD_COLOR_WHITE, LCD_COLOR_WHITE, LCD_COLOR_BLACK);
-    // Play button
-    if (is_playing) {
-        draw_button(pause_button, LCD_COLOR_WHITE, LCD_COLOR_BLACK, LCD_COLOR_GRAY, LCD_COLOR_WHITE);
-        play_button.disabled = true;
-        pause_button.disabled = false;
+// Clears the band of the window and draws every row it touches
+static void draw_browser_band(const ScreenRequest *frame, int top, int height) {
+    fill_rect(0, top, DISPLAY_WIDTH, height, LCD_COLOR_BLACK);
+    const int32_t content_top = frame->browser_offset + top - WINDOW_TOP;
+    const uint32_t first = (uint32_t) content_top / ROW_HEIGHT;
+    const uint32_t last = (uint32_t) (content_top + height - 1) / ROW_HEIGHT;
+    for (uint32_t index = first; index <= last && index < frame->track_count; index++) {
+        if (index >= frame->first_row && index < frame->first_row + BROWSER_ROWS) {
+            draw_browser_row(frame, index, WINDOW_TOP + (int32_t) index * ROW_HEIGHT - frame->browser_offset);
+        }
+    }
+}
+
+static bool is_same_list(const BrowserView *a, const BrowserView *b) {
+    return a->valid && b->valid && a->version == b->version && a->track_count == b->track_count &&
+           a->current_track == b->current_track;
+}
+
+// A scroll by less than the window copies what stays of the visible buffer, moved up or down, and draws the
+// band it uncovered; anything else draws the window again
+static void draw_browser_screen(const ScreenRequest *frame) {
+    PROFILER_ZONE(PROFILER_ZONE_RENDER);
+
+    const BrowserView next = {true, frame->browser_version, frame->track_count, frame->current_track,
+                              frame->browser_offset};
+    show_foreground_screen(SCREEN_BROWSER);
+
+    const int visible = current_buffer;
+    const int drawing = !current_buffer;
+    const BrowserView *shown = &browser_views[visible];
+    if (is_same_list(shown, &next) && shown->offset == next.offset) {
+        display_stats.frames_skipped++;
+        return;
+    }
+
+    begin_frame();
+    const int32_t delta = next.offset - shown->offset;
+    if (is_same_list(shown, &next) && abs(delta) < WINDOW_HEIGHT) {
+        const int kept = WINDOW_HEIGHT - abs(delta);
+        gfx_blit(&foreground_surfaces[visible], 0, WINDOW_TOP + MAX(0, delta), &foreground_surfaces[drawing], 0,
+                 WINDOW_TOP + MAX(0, -delta), DISPLAY_WIDTH, kept);
+        frame_pixels += DISPLAY_WIDTH * kept;
+        display_stats.copied_pixels += DISPLAY_WIDTH * kept;
+        display_stats.browser_scrolls++;
+        draw_browser_band(frame, delta > 0 ? WINDOW_TOP + kept : WINDOW_TOP, abs(delta));
     } else {
-        draw_button(play_button, LCD_COLOR_WHITE, LCD_COLOR_BLACK, LCD_COLOR_GRAY, LCD_COLOR_WHITE);
-        play_button.disabled = false;
-        pause_button.disabled = true;
+        draw_browser_band(frame, WINDOW_TOP, WINDOW_HEIGHT);
+        display_stats.full_redraws++;
     }
+    browser_views[drawing] = next;
+    scene_valid[drawing] = false;
+
+    finish_frame();
+    swap_screen_buffers();
+}
+
+// Reads the rows of the window starting at first, keeping those it shares with the window read before
+static void read_browser_rows(uint32_t first, uint32_t track_count, BrowserRowReader read_row) {
+    const uint32_t previous = browser_first_row;
+    const bool overlaps = browser_rows_valid && first < previous + BROWSER_ROWS && previous < first + BROWSER_ROWS;
+    if (overlaps && first > previous) {
+        const uint32_t shift = first - previous;
+        memmove(&browser_rows[0], &browser_rows[shift], (BROWSER_ROWS - shift) * sizeof(BrowserRow));
+    } else if (overlaps && first < previous) {
+        const uint32_t shift = previous - first;
+        memmove(&browser_rows[shift], &browser_rows[0], (BROWSER_ROWS - shift) * sizeof(BrowserRow));
+    }
+    for (uint32_t i = 0; i < BROWSER_ROWS; i++) {
+        const uint32_t index = first + i;
+        if (overlaps && index >= previous && index < previous + BROWSER_ROWS) {
+            continue;
+        }
+        BrowserRow *row = &browser_rows[i];
+        if (index < track_count) {
+            read_row(index, row->title, row->detail, sizeof(row->title));
+            display_stats.browser_rows_read++;
+        } else {
+            row->title[0] = '\0';
+            row->detail[0] = '\0';
+        }
+    }
+    browser_first_row = first;
+    browser_rows_valid = true;
+}
+
+void render_browser_screen(uint32_t track_count, uint32_t current_track, BrowserRowReader read_row) {
+    const uint32_t tick = osKernelSysTick();
+    const int32_t content_height = (int32_t) (track_count * ROW_HEIGHT);
+    if (browser_opening) {
+        browser_opening = false;
+        browser_version++;
+        browser_rows_valid = false;
+        scroller_init(&scroller, content_height, WINDOW_HEIGHT, tick);
+        scroller_jump(&scroller, (int32_t) (current_track * ROW_HEIGHT) - (WINDOW_HEIGHT - ROW_HEIGHT) / 2);
+    }
+    scroller_set_content(&scroller, content_height);
+    scroller_update(&scroller, tick);
+    browser_track_count = track_count;
+
+    const int32_t offset = scroller_get_offset(&scroller);
+    const uint32_t first = (uint32_t) offset / ROW_HEIGHT;
+    const bool rows_changed = !browser_rows_valid || first != browser_first_row;
+    if (rows_changed) {
+        read_browser_rows(first, track_count, read_row);
+    }
+
+    osSemaphoreWait(request_lock, osWaitForever);
+    request.screen = SCREEN_BROWSER;
+    request.browser_version = browser_version;
+    request.track_count = track_count;
+    request.current_track = current_track;
+    request.browser_offset = offset;
+    if (rows_changed) {
+        request.first_row = first;
+        memcpy(request.rows, browser_rows, sizeof(request.rows));
+    }
+    osSemaphoreRelease(request_lock);
+}
+
+// Wakes at every vertical blanking and draws a frame every REFRESHES_PER_FRAME of them, when the request
+// changed anything on the screen; in between the CPU is free for the decoder
+static void display_task(void const *argument) {
+    static ScreenRequest frame;
+    uint32_t drawn_info_version = 0;
+    unsigned refreshes = 0;
+
+    while (true) {
+        osSemaphoreWait(vsync_semaphore, osWaitForever);
+        // The line event is one-shot
+        HAL_LTDC_ProgramLineEvent(&hLtdcHandler, get_vsync_line());
+        display_stats.refreshes++;
+        // Until the changes of the last frame are latched, the buffers it replaces are still shown
+        if (reload_pending || ++refreshes < REFRESHES_PER_FRAME) {
+            continue;
+        }
+        refreshes = 0;
+
+        osSemaphoreWait(request_lock, osWaitForever);
+        frame = request;
+        osSemaphoreRelease(request_lock);
+
+        if (frame.screen == SCREEN_INFO && frame.info_version != drawn_info_version) {
+            draw_info_screen(frame.info, frame.sub_info);
+            drawn_info_version = frame.info_version;
+        } else if (frame.screen == SCREEN_TRACK) {
+            draw_track_screen(&frame);
+        } else if (frame.screen == SCREEN_BROWSER) {
+            draw_browser_screen(&frame);
+        }
+        latch_layer_changes();
+    }
+}
+
+// CMSIS-RTOS creates binary semaphores already given, the first wait of the task arms the line event
+static void start_display_task(void) {
+    request_lock = osSemaphoreCreate(osSemaphore(display_request_lock), 1);
+    vsync_semaphore = osSemaphoreCreate(osSemaphore(display_vsync), 1);
+    if (request_lock == NULL || vsync_semaphore == NULL) {
+        log_error("Failed to initialize the display task");
+        return;
+    }
+
+    // Below the controller, drawing takes the CPU the decoder leaves
+    osThreadStaticDef(display, display_task, osPriorityBelowNormal, 0, DISPLAY_TASK_STACK_WORDS, display_task_stack,
+                      &display_task_control);
+    if (osThreadCreate(osThread(display), NULL) == NULL) {
+        log_error("Failed to start the display task");
+    }
+}
+
+// Bytes the LTDC fetches from the SDRAM per refresh, with the layers shown now
+static uint32_t get_fetch_bytes(void) {
+    uint32_t bytes = 0;
+    if (layer_visible[LCD_LAYER_FG]) {
+        bytes += DISPLAY_WIDTH * WINDOW_HEIGHT * sizeof(foreground_images[0][0][0]);
+    }
+    if (layer_visible[LCD_LAYER_BG]) {
+        bytes += DISPLAY_WIDTH * DISPLAY_HEIGHT * sizeof(background_images[0][0][0]);
+    }
+    return bytes;
+}
+
+void get_display_stats(DisplayStats *stats) {
+    *stats = display_stats;
+    stats->fetch_bytes = get_fetch_bytes();
+}
 
-    swap_screen_layers();
+void print_display_stats(void) {
+    const uint32_t frame_size = DISPLAY_WIDTH * DISPLAY_HEIGHT;
+    const uint32_t cycles_per_us = profiler_clock_hz() / 1000000;
+    GfxStats gfx_stats;
+    gfx_get_stats(&gfx_stats);
+    log_info("Display: %lu refreshes, at most %d fps, %lu frames drawn (%lu full), %lu skipped unchanged, "
+             "pixels per frame mean %lu, max %lu, last %lu of %lu, %lu%% of them copied between buffers",
+             (unsigned long) display_stats.refreshes, REFRESH_HZ / REFRESHES_PER_FRAME,
+             (unsigned long) display_stats.frames, (unsigned long) display_stats.full_redraws,
+             (unsigned long) display_stats.frames_skipped,
+             (unsigned long) (display_stats.frames != 0 ? display_stats.pixels / display_stats.frames : 0),
+             (unsigned long) display_stats.max_pixels, (unsigned long) display_stats.last_pixels,
+             (unsigned long) frame_size,
+             (unsigned long) (display_stats.pixels != 0 ? display_stats.copied_pixels * 100 / display_stats.pixels : 0));
+    const uint64_t draw_tenths_us = display_stats.frames != 0 ?
+                                    display_stats.draw_cycles * 10 / display_stats.frames / cycles_per_us : 0;
+    log_info("Display: CPU time per frame drawn mean %lu.%lu us, DMA2D %lu transfers of %llu pixels, %lu errors, "
+             "%lu us waited for it",
+             (unsigned long) (draw_tenths_us / 10), (unsigned long) (draw_tenths_us % 10),
+             (unsigned long) gfx_stats.transfers, (unsigned long long) gfx_stats.pixels,
+             (unsigned long) gfx_stats.errors, (unsigned long) (gfx_stats.wait_cycles / cycles_per_us));
+    log_info("Display: %lu scrolling text strips rendered, %lu text frames scrolled by a copy out of them, "
+             "%lu peak overviews drawn",
+             (unsigned long) display_stats.marquee_strips, (unsigned long) display_stats.marquee_frames,
+             (unsigned long) display_stats.peaks_strips);
+    log_info("Display: browser %lu rows read from the library, %lu rows rendered, %lu frames scrolled by a copy "
+             "of the rows shown before",
+             (unsigned long) display_stats.browser_rows_read, (unsigned long) display_stats.browser_rows,
+             (unsigned long) display_stats.browser_scrolls);
+    // Against the full screen ARGB8888 layer each screen was shown in before
+    const uint32_t fetch_bytes = get_fetch_bytes();
+    const uint32_t full_bytes = frame_size * sizeof(uint32_t);
+    log_info("Display: LTDC fetches %lu KB per refresh, %lu KB/s at %d Hz, %lu%% less than a full screen ARGB8888 layer",
+             (unsigned long) (fetch_bytes / 1024), (unsigned long) (fetch_bytes * REFRESH_HZ / 1024), REFRESH_HZ,
+             (unsigned long) ((full_bytes - MIN(fetch_bytes, full_bytes)) * 100 / full_bytes));
 }
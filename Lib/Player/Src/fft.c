@@ -0,0 +1,125 @@
+#include "fft.h"
+
+#define COMPLEX_SIZE (FFT_SIZE / 2)
+#define PI 3.14159265358979323846
+
+typedef struct {
+    int16_t re;
+    int16_t im;
+} Complex;
+
+// e^(-2 pi i k / FFT_SIZE) in Q15; the complex transform uses every other entry
+static Complex twiddles[FFT_SIZE];
+// Hann window in Q15
+static int16_t window[FFT_SIZE];
+// Position of each output of the transform in frequency order, base 4 digits reversed
+static uint16_t reversed[COMPLEX_SIZE];
+static Complex data[COMPLEX_SIZE];
+
+// Taylor series after reducing the angle to [-pi, pi], precise enough for Q15 tables without libm
+static double sine(double x) {
+    while (x > PI) {
+        x -= 2 * PI;
+    }
+    while (x < -PI) {
+        x += 2 * PI;
+    }
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 14; n++) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+static int16_t to_q15(double value) {
+    const double scaled = value * 32768.0 + (value < 0 ? -0.5 : 0.5);
+    return (int16_t) (scaled > 32767 ? 32767 : scaled < -32768 ? -32768 : scaled);
+}
+
+void fft_init(void) {
+    for (int k = 0; k < FFT_SIZE; k++) {
+        const double angle = 2.0 * PI * k / FFT_SIZE;
+        twiddles[k] = (Complex) {to_q15(sine(PI / 2 - angle)), to_q15(-sine(angle))};
+        window[k] = to_q15(0.5 * (1.0 - sine(PI / 2 - angle)));
+    }
+    unsigned digits = 0;
+    while ((1u << 2 * digits) < COMPLEX_SIZE) {
+        digits++;
+    }
+    for (unsigned i = 0; i < COMPLEX_SIZE; i++) {
+        unsigned result = 0;
+        for (unsigned d = 0; d < digits; d++) {
+            result = result << 2 | (i >> 2 * d & 3);
+        }
+        reversed[i] = (uint16_t) result;
+    }
+}
+
+static Complex multiply(Complex a, Complex w) {
+    return (Complex) {
+            (int16_t) ((a.re * w.re >> 15) - (a.im * w.im >> 15)),
+            (int16_t) ((a.re * w.im >> 15) + (a.im * w.re >> 15))
+    };
+}
+
+// Twiddle k of the complex transform
+static Complex get_twiddle(unsigned k) {
+    return twiddles[2 * k % FFT_SIZE];
+}
+
+// In place, the output in digit reversed order; each butterfly divides its inputs by 4
+static void transform(void) {
+    for (unsigned length = COMPLEX_SIZE; length >= 4; length /= 4) {
+        const unsigned quarter = length / 4;
+        const unsigned step = COMPLEX_SIZE / length;
+        for (unsigned group = 0; group < COMPLEX_SIZE; group += length) {
+            for (unsigned j = 0; j < quarter; j++) {
+                Complex *x = &data[group + j];
+                const int32_t a_re = x[0].re >> 2, a_im = x[0].im >> 2;
+                const int32_t b_re = x[quarter].re >> 2, b_im = x[quarter].im >> 2;
+                const int32_t c_re = x[2 * quarter].re >> 2, c_im = x[2 * quarter].im >> 2;
+                const int32_t d_re = x[3 * quarter].re >> 2, d_im = x[3 * quarter].im >> 2;
+                const int32_t t0_re = a_re + c_re, t0_im = a_im + c_im;
+                const int32_t t1_re = a_re - c_re, t1_im = a_im - c_im;
+                const int32_t t2_re = b_re + d_re, t2_im = b_im + d_im;
+                const int32_t t3_re = b_re - d_re, t3_im = b_im - d_im;
+                x[0] = (Complex) {(int16_t) (t0_re + t2_re), (int16_t) (t0_im + t2_im)};
+                // t1 - j t3, t0 - t2 and t1 + j t3, then turned by their twiddles
+                const Complex y1 = {(int16_t) (t1_re + t3_im), (int16_t) (t1_im - t3_re)};
+                const Complex y2 = {(int16_t) (t0_re - t2_re), (int16_t) (t0_im - t2_im)};
+                const Complex y3 = {(int16_t) (t1_re - t3_im), (int16_t) (t1_im + t3_re)};
+                x[quarter] = multiply(y1, get_twiddle(j * step));
+                x[2 * quarter] = multiply(y2, get_twiddle(2 * j * step));
+                x[3 * quarter] = multiply(y3, get_twiddle(3 * j * step));
+            }
+        }
+    }
+}
+
+static Complex get_output(unsigned k) {
+    return data[reversed[k % COMPLEX_SIZE]];
+}
+
+void fft_real_power(const int16_t samples[FFT_SIZE], uint32_t power[FFT_BINS]) {
+    for (unsigned i = 0; i < COMPLEX_SIZE; i++) {
+        data[i] = (Complex) {(int16_t) (samples[2 * i] * window[2 * i] >> 15),
+                             (int16_t) (samples[2 * i + 1] * window[2 * i + 1] >> 15)};
+    }
+    transform();
+
+    // The even samples are the real part, the odd ones the imaginary part: X[k] = E[k] + W^k O[k], with
+    // E and O taken from Z[k] and the conjugate of Z[-k]
+    for (unsigned k = 0; k < FFT_BINS; k++) {
+        const Complex z = get_output(k);
+        const Complex mirror = get_output(COMPLEX_SIZE - k);
+        const Complex even = {(int16_t) ((z.re + mirror.re) >> 1), (int16_t) ((z.im - mirror.im) >> 1)};
+        const Complex odd = {(int16_t) ((z.im + mirror.im) >> 1), (int16_t) ((mirror.re - z.re) >> 1)};
+        const Complex turned = multiply(odd, twiddles[k]);
+        const int32_t re = even.re + turned.re;
+        const int32_t im = even.im + turned.im;
+        const int64_t squared = (int64_t) re * re + (int64_t) im * im;
+        power[k] = squared > UINT32_MAX ? UINT32_MAX : (uint32_t) squared;
+    }
+}
@@ -1,6 +1,12 @@
 #include <flac_decoder.h>
-#include "term_io.h"
-#include "stm32746g_discovery_lcd.h"
+#include "profiler.h"
+
+static int read_file(void *context, uint8_t *buffer, unsigned size, unsigned *bytes_read) {
+    UINT file_bytes_read;
+    FRESULT result = f_read((FIL *) context, buffer, size, &file_bytes_read);
+    *bytes_read = file_bytes_read;
+    return result != FR_OK;
+}
 
 static FLAC__StreamDecoderReadStatus decoder_read_callback(
         const FLAC__StreamDecoder *decoder,
@@ -15,13 +21,17 @@ static FLAC__StreamDecoderReadStatus decoder_read_callback(
 
     Flac *flac = (Flac *) client_data;
 
-    UINT bytes_read;
-    if (f_read(flac->file, buffer, *bytes, &bytes_read) != FR_OK) {
+    unsigned bytes_read;
+    PROFILER_BEGIN(PROFILER_ZONE_F_READ);
+    int result = flac->read(flac->read_context, buffer, *bytes, &bytes_read);
+    PROFILER_END(PROFILER_ZONE_F_READ);
+    if (result != 0) {
         log_error("Could not read from file");
         return FLAC__STREAM_DECODER_READ_STATUS_ABORT;
     }
 
     *bytes = bytes_read;
+    flac->stream_position += bytes_read;
 
     if (bytes_read == 0) {
         return FLAC__STREAM_DECODER_READ_STATUS_END_OF_STREAM;
@@ -32,6 +42,15 @@ static FLAC__StreamDecoderReadStatus decoder_read_callback(
     return FLAC__STREAM_DECODER_READ_STATUS_ABORT;
 }
 
+// Only for the decode position, the stream is never seeked through the decoder
+static FLAC__StreamDecoderTellStatus decoder_tell_callback(
+        const FLAC__StreamDecoder *decoder,
+        FLAC__uint64 *absolute_byte_offset,
+        void *client_data) {
+    *absolute_byte_offset = ((Flac *) client_data)->stream_position;
+    return FLAC__STREAM_DECODER_TELL_STATUS_OK;
+}
+
 static FLAC__StreamDecoderWriteStatus decoder_write_callback(
         const FLAC__StreamDecoder *decoder,
         const FLAC__Frame *frame,
@@ -52,8 +71,11 @@ static FLAC__StreamDecoderWriteStatus decoder_write_callback(
     unsigned bytes_per_sample = frame->header.bits_per_sample / 8;
     unsigned size = samples * channels * bytes_per_sample;
 
+    flac->resyncing = false;
     flac->frame = malloc(sizeof(FlacFrame));
     *flac->frame = (FlacFrame) {
+        .sample_number = frame->header.number.sample_number,
+        .samples = samples,
         .buffer = malloc(size),
         .size = size
     };
@@ -61,14 +83,24 @@ static FLAC__StreamDecoderWriteStatus decoder_write_callback(
     log_debug("samples: %d, channels: %d, bytes_per_sample: %d, buffer_size: %d\n",
               samples, channels, bytes_per_sample, size);
 
+    // The peaks are taken on the way, the samples are in registers already
+    PROFILER_BEGIN(PROFILER_ZONE_INTERLEAVE);
+    FLAC__int32 low = 0;
+    FLAC__int32 high = 0;
     for (int sample = 0; sample < samples; sample++) {
         for (int channel = 0; channel < channels; channel++) {
+            const FLAC__int32 value = buffer[channel][sample];
+            low = value < low ? value : low;
+            high = value > high ? value : high;
             for (int byte = 0; byte < bytes_per_sample; byte++) {
                 flac->frame->buffer[(sample * channels + channel) * bytes_per_sample + byte] =
-                        (uint8_t)((buffer[channel][sample] >> (byte * 8)) & 0xFF);
+                        (uint8_t)((value >> (byte * 8)) & 0xFF);
             }
         }
     }
+    flac->frame->min = low;
+    flac->frame->max = high;
+    PROFILER_END(PROFILER_ZONE_INTERLEAVE);
 
     return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
 }
@@ -101,13 +133,22 @@ static void decoder_error_callback(
         const FLAC__StreamDecoder *decoder,
         FLAC__StreamDecoderErrorStatus status,
         void *client_data) {
+    if (((Flac *) client_data)->resyncing && status == FLAC__STREAM_DECODER_ERROR_STATUS_LOST_SYNC) {
+        log_debug("Skipped to the first frame after a seek");
+        return;
+    }
     log_error("Error decoding FLAC: %s", FLAC__StreamDecoderErrorStatusString[status]);
 }
 
 Flac *create_flac(FIL *input) {
+    return create_flac_stream(read_file, input);
+}
+
+Flac *create_flac_stream(FlacReadCallback read, void *context) {
     Flac *flac = (Flac *) calloc(1, sizeof(Flac));
     *flac = (Flac) {
-            .file = input
+            .read = read,
+            .read_context = context
     };
 
     flac->decoder = FLAC__stream_decoder_new();
@@ -122,7 +163,7 @@ Flac *create_flac(FIL *input) {
             flac->decoder,
             &decoder_read_callback,
             NULL,
-            NULL,
+            &decoder_tell_callback,
             NULL,
             NULL,
             &decoder_write_callback,
@@ -152,6 +193,9 @@ void destroy_flac(Flac *flac) {
 int read_metadata(Flac *flac, FlacMetaData *metadata) {
     if (FLAC__stream_decoder_process_until_end_of_metadata(flac->decoder)) {
         *metadata = flac->metadata;
+        if (!FLAC__stream_decoder_get_decode_position(flac->decoder, &flac->audio_offset)) {
+            flac->audio_offset = 0;
+        }
         return 0;
     } else {
         log_error("Could not read metadata %s",
@@ -161,18 +205,28 @@ int read_metadata(Flac *flac, FlacMetaData *metadata) {
 }
 
 int read_frame(Flac *flac, FlacFrame *frame) {
-    unsigned int t = xTaskGetTickCount();
+    PROFILER_ZONE(PROFILER_ZONE_READ_FRAME);
 
-    if (FLAC__stream_decoder_process_single(flac->decoder)) {
+    bool processed = FLAC__stream_decoder_process_single(flac->decoder);
+    // A corrupt header, or a false sync pattern after a seek, leaves the decoder searching for the next frame
+    while (processed && flac->frame == NULL &&
+           FLAC__stream_decoder_get_state(flac->decoder) == FLAC__STREAM_DECODER_SEARCH_FOR_FRAME_SYNC) {
+        processed = FLAC__stream_decoder_process_single(flac->decoder);
+    }
+    if (processed) {
         if (flac->frame == NULL) {
+            if (FLAC__stream_decoder_get_state(flac->decoder) == FLAC__STREAM_DECODER_END_OF_STREAM) {
+                return 1;
+            }
             log_error("No frame read");
             return 1;
         }
+        // The caller owns the copy, only the temporary struct from the write callback is released
         *frame = *flac->frame;
+        free(flac->frame);
         flac->frame = NULL;
 
-        t = xTaskGetTickCount() - t;
-        log_debug("read_frame read frame with size %d in %d ms", frame->size, t);
+        log_debug("read_frame read frame with size %d", frame->size);
 
         return 0;
     } else {
@@ -182,6 +236,18 @@ int read_frame(Flac *flac, FlacFrame *frame) {
     }
 }
 
+int seek_flac(Flac *flac, uint64_t position) {
+    free_frame(flac->frame);
+    flac->frame = NULL;
+    if (!FLAC__stream_decoder_flush(flac->decoder)) {
+        log_error("Could not flush the decoder");
+        return 1;
+    }
+    flac->stream_position = position;
+    flac->resyncing = true;
+    return 0;
+}
+
 void free_frame(FlacFrame *frame) {
     if (frame != NULL) {
         free(frame->buffer);
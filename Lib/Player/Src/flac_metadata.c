@@ -0,0 +1,116 @@
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "flac_metadata.h"
+#include "logger.h"
+
+#define METADATA_TYPE_STREAMINFO 0
+#define METADATA_TYPE_VORBIS_COMMENT 4
+#define STREAMINFO_LENGTH 34
+// Longer comments (lyrics, embedded cue sheets) are skipped without being read
+#define MAX_COMMENT_LENGTH 160
+
+static int read_bytes(FIL *file, void *buffer, UINT size) {
+    UINT bytes_read;
+    return f_read(file, buffer, size, &bytes_read) != FR_OK || bytes_read != size;
+}
+
+static int skip_bytes(FIL *file, FSIZE_t size) {
+    return f_lseek(file, f_tell(file) + size) != FR_OK;
+}
+
+static uint32_t read_le32(const uint8_t *bytes) {
+    return bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint32_t) bytes[3] << 24;
+}
+
+static void parse_streaminfo(const uint8_t *block, FlacFileInfo *info) {
+    // 16+16 bit block sizes, 24+24 bit frame sizes, then 20 bit rate, 3 bit channels, 5 bit bps, 36 bit samples
+    info->sample_rate = block[10] << 12 | block[11] << 4 | block[12] >> 4;
+    info->channels = ((block[12] >> 1) & 0x07) + 1;
+    info->bits_per_sample = ((block[12] & 0x01) << 4 | block[13] >> 4) + 1;
+    info->total_samples = (uint64_t) (block[13] & 0x0F) << 32 |
+                          (uint32_t) block[14] << 24 | block[15] << 16 | block[16] << 8 | block[17];
+}
+
+// Field names are case-insensitive ASCII, the value is stored truncated to the tag buffer
+static bool match_tag(const char *comment, const char *name, char *value) {
+    size_t name_length = strlen(name);
+    for (size_t i = 0; i < name_length; i++) {
+        if (toupper((unsigned char) comment[i]) != name[i]) return false;
+    }
+    if (comment[name_length] != '=') return false;
+
+    strncpy(value, comment + name_length + 1, FLAC_TAG_LENGTH);
+    value[FLAC_TAG_LENGTH] = '\0';
+    return true;
+}
+
+static int parse_vorbis_comment(FIL *file, uint32_t block_length, FlacFileInfo *info) {
+    uint8_t length_bytes[4];
+    char comment[MAX_COMMENT_LENGTH + 1];
+    char track_number[FLAC_TAG_LENGTH + 1];
+
+    // Vendor string
+    if (read_bytes(file, length_bytes, 4) != 0) return 1;
+    uint32_t length = read_le32(length_bytes);
+    if (length > block_length || skip_bytes(file, length) != 0) return 1;
+
+    if (read_bytes(file, length_bytes, 4) != 0) return 1;
+    uint32_t comments_count = read_le32(length_bytes);
+
+    for (uint32_t i = 0; i < comments_count; i++) {
+        if (read_bytes(file, length_bytes, 4) != 0) return 1;
+        length = read_le32(length_bytes);
+        if (length > block_length) return 1;
+        if (length > MAX_COMMENT_LENGTH) {
+            if (skip_bytes(file, length) != 0) return 1;
+            continue;
+        }
+        if (read_bytes(file, comment, length) != 0) return 1;
+        comment[length] = '\0';
+
+        if (!match_tag(comment, "TITLE", info->title) &&
+            !match_tag(comment, "ARTIST", info->artist) &&
+            !match_tag(comment, "ALBUM", info->album) &&
+            match_tag(comment, "TRACKNUMBER", track_number)) {
+            // "3/12" is common, strtoul stops at the slash
+            info->track_number = (unsigned) strtoul(track_number, NULL, 10);
+        }
+    }
+    return 0;
+}
+
+int probe_flac_file(FIL *file, FlacFileInfo *info) {
+    uint8_t header[4];
+    uint8_t streaminfo[STREAMINFO_LENGTH];
+    bool has_streaminfo = false;
+
+    memset(info, 0, sizeof(FlacFileInfo));
+    if (read_bytes(file, header, 4) != 0 || memcmp(header, "fLaC", 4) != 0) {
+        return 1;
+    }
+
+    bool last_block = false;
+    while (!last_block) {
+        if (read_bytes(file, header, 4) != 0) return 1;
+        last_block = header[0] & 0x80;
+        const uint8_t type = header[0] & 0x7F;
+        const uint32_t length = header[1] << 16 | header[2] << 8 | header[3];
+        const FSIZE_t block_end = f_tell(file) + length;
+
+        if (type == METADATA_TYPE_STREAMINFO && length >= STREAMINFO_LENGTH) {
+            if (read_bytes(file, streaminfo, STREAMINFO_LENGTH) != 0) return 1;
+            parse_streaminfo(streaminfo, info);
+            has_streaminfo = true;
+        } else if (type == METADATA_TYPE_VORBIS_COMMENT) {
+            if (parse_vorbis_comment(file, length, info) != 0) {
+                log_warn("Malformed VORBIS_COMMENT block");
+            }
+            break;
+        }
+        if (f_lseek(file, block_end) != FR_OK) return 1;
+    }
+
+    return has_streaminfo ? 0 : 1;
+}
@@ -1,6 +1,5 @@
 #include <string.h>
 #include "flac_reader.h"
-#include "term_io.h"
 
 FlacReader *create_flac_reader(Flac *flac) {
     log_debug("Creating flac reader");
@@ -8,14 +7,27 @@ FlacReader *create_flac_reader(Flac *flac) {
     reader->flac = flac;
     reader->frame = NULL;
     reader->buffer_index = 0;
+    reader->frame_callback = NULL;
+    reader->frame_context = NULL;
     return reader;
 }
 
 void free_flac_reader(FlacReader *reader) {
-    free(reader->frame);
+    free_frame(reader->frame);
     free(reader);
 }
 
+void set_flac_frame_callback(FlacReader *reader, FlacFrameCallback callback, void *context) {
+    reader->frame_callback = callback;
+    reader->frame_context = context;
+}
+
+static void notify_frame(FlacReader *reader) {
+    if (reader->frame_callback != NULL) {
+        reader->frame_callback(reader->frame, reader->frame_context);
+    }
+}
+
 unsigned read_flac(FlacReader *reader, uint8_t *buffer, unsigned size) {
     log_debug("Reading %d bytes from flac", size);
     unsigned bytes_read = 0;
@@ -25,10 +37,14 @@ unsigned read_flac(FlacReader *reader, uint8_t *buffer, unsigned size) {
 
         if (reader->frame == NULL) {
             log_debug("Reading frame");
+            reader->frame = malloc(sizeof(FlacFrame));
             if (read_frame(reader->flac, reader->frame)) {
+                free(reader->frame);
+                reader->frame = NULL;
                 return bytes_read;
             }
             reader->buffer_index = 0;
+            notify_frame(reader);
         }
 
         unsigned bytes_to_read = reader->frame->size - reader->buffer_index;
@@ -52,3 +68,17 @@ unsigned read_flac(FlacReader *reader, uint8_t *buffer, unsigned size) {
 
     return bytes_read;
 }
+
+int restart_flac_reader(FlacReader *reader, uint64_t *sample_number) {
+    free_frame(reader->frame);
+    reader->buffer_index = 0;
+    reader->frame = malloc(sizeof(FlacFrame));
+    if (read_frame(reader->flac, reader->frame)) {
+        free(reader->frame);
+        reader->frame = NULL;
+        return 1;
+    }
+    notify_frame(reader);
+    *sample_number = reader->frame->sample_number;
+    return 0;
+}
@@ -0,0 +1,1119 @@
+// Generated by Host/FontGen from DejaVuSans.ttf at 13 px, do not edit
+// DejaVu fonts are free, see https://dejavu-fonts.github.io/License.html
+#include "font.h"
+
+static const uint8_t bitmaps[] = {
+        0x0F, 0x40, 0x0F, 0x40, 0x0F, 0x40, 0x0F, 0x40, 0x0F, 0x30, 0x0E, 0x20, 0x02, 0x00, 0x08, 0x20,
+        0x0F, 0x40, 0xB5, 0x5B, 0xB5, 0x5B, 0xB5, 0x5B, 0x42, 0x24, 0x00, 0x07, 0x90, 0x87, 0x00, 0x00,
+        0x0A, 0x50, 0xC4, 0x00, 0x00, 0x0D, 0x20, 0xE1, 0x00, 0x4E, 0xEF, 0xEE, 0xFE, 0xD0, 0x00, 0x6A,
+        0x07, 0x80, 0x00, 0x00, 0x96, 0x0B, 0x40, 0x00, 0xEE, 0xFE, 0xEF, 0xEE, 0x20, 0x03, 0xD0, 0x5B,
+        0x00, 0x00, 0x07, 0x80, 0x96, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x2A,
+        0xDD, 0xC6, 0x00, 0xB8, 0x46, 0x13, 0x00, 0xD6, 0x46, 0x00, 0x00, 0x6E, 0xCA, 0x40, 0x00, 0x01,
+        0x7B, 0xDA, 0x00, 0x00, 0x46, 0x1F, 0x20, 0x61, 0x46, 0x5F, 0x10, 0x8D, 0xEE, 0xC5, 0x00, 0x00,
+        0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x07, 0xCC, 0x40, 0x00, 0xA5, 0x00, 0x2E, 0x12, 0xE0,
+        0x05, 0xA0, 0x00, 0x4B, 0x00, 0xE1, 0x1D, 0x10, 0x00, 0x1E, 0x13, 0xD0, 0xA5, 0x00, 0x00, 0x05,
+        0xBB, 0x35, 0xA1, 0x9B, 0x80, 0x00, 0x00, 0x1D, 0x18, 0x80, 0xA6, 0x00, 0x00, 0xA5, 0x0B, 0x40,
+        0x69, 0x00, 0x05, 0xB0, 0x09, 0x70, 0x97, 0x00, 0x1D, 0x20, 0x01, 0xBC, 0xA1, 0x00, 0x4D, 0xED,
+        0x60, 0x00, 0x00, 0xE6, 0x02, 0x30, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x20, 0x00,
+        0x00, 0x08, 0xB7, 0xD2, 0x00, 0xD2, 0x1F, 0x30, 0x6E, 0x33, 0xE0, 0x2F, 0x20, 0x06, 0xEC, 0x70,
+        0x0B, 0xA1, 0x01, 0xCF, 0x40, 0x01, 0x9D, 0xCC, 0x76, 0xE4, 0xB5, 0xB5, 0xB5, 0x42, 0x04, 0xB0,
+        0x0D, 0x40, 0x4D, 0x00, 0x99, 0x00, 0xC6, 0x00, 0xD6, 0x00, 0xC6, 0x00, 0x99, 0x00, 0x4D, 0x00,
+        0x0D, 0x40, 0x04, 0xB0, 0xA5, 0x00, 0x3D, 0x00, 0x0C, 0x50, 0x08, 0xA0, 0x05, 0xD0, 0x05, 0xE0,
+        0x05, 0xD0, 0x08, 0xA0, 0x0C, 0x50, 0x3D, 0x00, 0xA5, 0x00, 0x00, 0x29, 0x00, 0x00, 0x58, 0x29,
+        0x3A, 0x00, 0x04, 0xBE, 0x71, 0x00, 0x18, 0xAC, 0xA4, 0x00, 0x43, 0x29, 0x16, 0x00, 0x00, 0x16,
+        0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
+        0x00, 0x9E, 0xEE, 0xFE, 0xEE, 0x70, 0x12, 0x23, 0xF2, 0x22, 0x10, 0x00, 0x01, 0xF0, 0x00, 0x00,
+        0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7D, 0x99, 0xD2, 0x5F, 0xFF, 0x10,
+        0x56, 0x9B, 0x00, 0x0D, 0x30, 0x00, 0x3D, 0x00, 0x00, 0x79, 0x00, 0x00, 0xC4, 0x00, 0x02, 0xE0,
+        0x00, 0x06, 0xA0, 0x00, 0x0B, 0x50, 0x00, 0x1E, 0x10, 0x00, 0x6B, 0x00, 0x00, 0xA6, 0x00, 0x00,
+        0x71, 0x00, 0x00, 0x00, 0x8E, 0xEA, 0x10, 0x07, 0xD3, 0x1B, 0xB0, 0x0D, 0x60, 0x02, 0xF2, 0x1F,
+        0x30, 0x00, 0xE5, 0x2F, 0x20, 0x00, 0xD6, 0x1F, 0x30, 0x00, 0xE5, 0x0D, 0x60, 0x02, 0xF2, 0x07,
+        0xD2, 0x1A, 0xB0, 0x00, 0x8E, 0xEA, 0x10, 0x5C, 0xEF, 0x00, 0x00, 0x45, 0x6F, 0x00, 0x00, 0x00,
+        0x4F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00,
+        0x4F, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x10, 0x08, 0xCE, 0xD9, 0x10, 0x09,
+        0x41, 0x3D, 0x90, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x6E, 0x20, 0x00,
+        0x07, 0xD3, 0x00, 0x00, 0x7D, 0x20, 0x00, 0x08, 0xD2, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x07,
+        0xDF, 0xEA, 0x20, 0x03, 0x21, 0x29, 0xC0, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x5E, 0xFF, 0x70, 0x00,
+        0x11, 0x39, 0x40, 0x00, 0x00, 0x02, 0xE1, 0x00, 0x00, 0x02, 0xF3, 0x07, 0x21, 0x3B, 0xD0, 0x0A,
+        0xEF, 0xDA, 0x20, 0x00, 0x00, 0xBF, 0x30, 0x00, 0x06, 0xBF, 0x30, 0x00, 0x2D, 0x3F, 0x30, 0x00,
+        0xB5, 0x1F, 0x30, 0x06, 0xA0, 0x1F, 0x30, 0x2D, 0x20, 0x1F, 0x30, 0x5F, 0xEE, 0xEF, 0xE8, 0x12,
+        0x22, 0x3F, 0x41, 0x00, 0x00, 0x1F, 0x30, 0x9F, 0xFF, 0xF7, 0x00, 0x99, 0x00, 0x00, 0x00, 0x99,
+        0x00, 0x00, 0x00, 0x9E, 0xDC, 0x81, 0x00, 0x43, 0x24, 0xDA, 0x00, 0x00, 0x00, 0x4F, 0x10, 0x00,
+        0x00, 0x4F, 0x10, 0x62, 0x13, 0xCB, 0x00, 0xBE, 0xFD, 0x91, 0x00, 0x00, 0x4C, 0xFE, 0x90, 0x03,
+        0xE7, 0x22, 0x40, 0x0B, 0x90, 0x00, 0x00, 0x0F, 0x8C, 0xEC, 0x40, 0x1F, 0xD3, 0x17, 0xE2, 0x1F,
+        0x80, 0x00, 0xE6, 0x0D, 0x70, 0x00, 0xE5, 0x06, 0xD3, 0x07, 0xE1, 0x00, 0x7E, 0xEC, 0x30, 0xEF,
+        0xFF, 0xFF, 0x20, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x01, 0xE5, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00,
+        0x0C, 0x80, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x01, 0xE5, 0x00, 0x00, 0x06,
+        0xE0, 0x00, 0x00, 0x02, 0xAE, 0xEB, 0x30, 0x0A, 0xB2, 0x18, 0xE0, 0x0D, 0x60, 0x02, 0xF2, 0x06,
+        0xB1, 0x18, 0xC0, 0x02, 0xBF, 0xFD, 0x20, 0x0D, 0xA1, 0x16, 0xE2, 0x1F, 0x30, 0x00, 0xE5, 0x0D,
+        0x91, 0x06, 0xF2, 0x02, 0xBE, 0xEC, 0x50, 0x01, 0xAE, 0xEA, 0x10, 0x0C, 0xB1, 0x1B, 0xA0, 0x2F,
+        0x30, 0x03, 0xF2, 0x2F, 0x30, 0x03, 0xF4, 0x0C, 0xA1, 0x1B, 0xF5, 0x02, 0xAE, 0xD7, 0xF4, 0x00,
+        0x00, 0x05, 0xE1, 0x03, 0x21, 0x4D, 0x70, 0x06, 0xEF, 0xD6, 0x00, 0x47, 0x7D, 0x00, 0x00, 0x00,
+        0x47, 0x7D, 0x7D, 0x47, 0x00, 0x00, 0x00, 0x7D, 0x99, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+        0x00, 0x03, 0x8E, 0x70, 0x00, 0x28, 0xDD, 0x83, 0x00, 0x5C, 0xE9, 0x30, 0x00, 0x00, 0x7E, 0xB6,
+        0x10, 0x00, 0x00, 0x01, 0x5A, 0xEB, 0x61, 0x00, 0x00, 0x00, 0x16, 0xBE, 0x60, 0x00, 0x00, 0x00,
+        0x01, 0x30, 0x9E, 0xEE, 0xEE, 0xEE, 0x70, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9E, 0xEE, 0xEE, 0xEE, 0x70, 0x12, 0x22, 0x22, 0x22, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x9D, 0x83, 0x00, 0x00, 0x00, 0x03, 0x9E, 0xC7, 0x20, 0x00, 0x00, 0x00, 0x49, 0xEC, 0x40, 0x00,
+        0x00, 0x16, 0xCE, 0x50, 0x01, 0x6B, 0xEA, 0x40, 0x00, 0x7E, 0xA5, 0x10, 0x00, 0x00, 0x31, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0xDE, 0xC3, 0x18, 0x21, 0x9D, 0x00, 0x00, 0x6D, 0x00, 0x04, 0xE5, 0x00,
+        0x2E, 0x40, 0x00, 0x7B, 0x00, 0x00, 0x46, 0x00, 0x00, 0x46, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x02,
+        0x8C, 0xDD, 0xA3, 0x00, 0x00, 0x00, 0x5D, 0x72, 0x00, 0x4B, 0x80, 0x00, 0x03, 0xD2, 0x00, 0x00,
+        0x00, 0xA6, 0x00, 0x0B, 0x40, 0x4C, 0xD9, 0xB3, 0x1D, 0x00, 0x1D, 0x00, 0xE4, 0x04, 0xF3, 0x0D,
+        0x10, 0x2C, 0x02, 0xD0, 0x00, 0xD3, 0x1E, 0x00, 0x1D, 0x00, 0xE4, 0x04, 0xF4, 0x98, 0x00, 0x0B,
+        0x40, 0x4C, 0xD9, 0xAB, 0x60, 0x00, 0x03, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x61,
+        0x01, 0x7D, 0x10, 0x00, 0x00, 0x02, 0x8C, 0xDD, 0x92, 0x00, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00,
+        0x00, 0x0D, 0xEC, 0x00, 0x00, 0x00, 0x4F, 0x4F, 0x30, 0x00, 0x00, 0xAA, 0x0C, 0x90, 0x00, 0x02,
+        0xF5, 0x06, 0xE1, 0x00, 0x07, 0xE0, 0x01, 0xF6, 0x00, 0x0D, 0xFE, 0xEE, 0xFC, 0x00, 0x4F, 0x31,
+        0x11, 0x4F, 0x30, 0xAA, 0x00, 0x00, 0x0C, 0x90, 0xBF, 0xFF, 0xD8, 0x00, 0xB9, 0x00, 0x4E, 0x60,
+        0xB8, 0x00, 0x0B, 0x90, 0xB8, 0x00, 0x2E, 0x50, 0xBE, 0xEE, 0xFA, 0x00, 0xB9, 0x11, 0x3C, 0x90,
+        0xB8, 0x00, 0x06, 0xE0, 0xB9, 0x00, 0x2B, 0xC0, 0xBF, 0xFF, 0xEA, 0x20, 0x00, 0x3A, 0xEF, 0xD8,
+        0x10, 0x04, 0xF8, 0x21, 0x28, 0x50, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x00, 0x00,
+        0x4F, 0x20, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x04,
+        0xF8, 0x21, 0x28, 0x50, 0x00, 0x3A, 0xEF, 0xD8, 0x10, 0xBF, 0xFF, 0xDA, 0x30, 0x00, 0xB9, 0x01,
+        0x38, 0xF5, 0x00, 0xB8, 0x00, 0x00, 0x9D, 0x00, 0xB8, 0x00, 0x00, 0x4F, 0x20, 0xB8, 0x00, 0x00,
+        0x2F, 0x30, 0xB8, 0x00, 0x00, 0x4F, 0x20, 0xB8, 0x00, 0x00, 0x9D, 0x00, 0xB9, 0x01, 0x28, 0xF5,
+        0x00, 0xBF, 0xFF, 0xDA, 0x30, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0xB9, 0x00, 0x00, 0x00, 0xB8, 0x00,
+        0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xBF, 0xEE, 0xEE, 0x10, 0xB9, 0x22, 0x22, 0x00, 0xB8, 0x00,
+        0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x60, 0xBF, 0xFF, 0xFB, 0xB9, 0x00, 0x00,
+        0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0xEE, 0xE4, 0xB9, 0x22, 0x20, 0xB8, 0x00, 0x00, 0xB8,
+        0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3A, 0xEF, 0xDA, 0x30, 0x04, 0xF9, 0x31, 0x26, 0x90, 0x0D,
+        0x90, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x4F, 0x20, 0x05, 0xEE, 0xE0, 0x3F, 0x30,
+        0x00, 0x15, 0xF0, 0x0D, 0x90, 0x00, 0x04, 0xF0, 0x04, 0xF8, 0x21, 0x28, 0xF0, 0x00, 0x3A, 0xEF,
+        0xEA, 0x30, 0xB8, 0x00, 0x00, 0xC8, 0xB8, 0x00, 0x00, 0xC8, 0xB8, 0x00, 0x00, 0xC8, 0xB8, 0x00,
+        0x00, 0xC8, 0xBF, 0xEE, 0xEE, 0xF8, 0xB9, 0x22, 0x22, 0xC8, 0xB8, 0x00, 0x00, 0xC8, 0xB8, 0x00,
+        0x00, 0xC8, 0xB8, 0x00, 0x00, 0xC8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x00,
+        0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00,
+        0xB8, 0x00, 0xC7, 0x04, 0xF4, 0xAD, 0x80, 0xB8, 0x00, 0x1B, 0xC1, 0xB8, 0x01, 0xCB, 0x10, 0xB8,
+        0x2D, 0xA0, 0x00, 0xBB, 0xE8, 0x00, 0x00, 0xBE, 0xE3, 0x00, 0x00, 0xB9, 0x8E, 0x30, 0x00, 0xB8,
+        0x08, 0xE3, 0x00, 0xB8, 0x00, 0x7E, 0x40, 0xB8, 0x00, 0x06, 0xE5, 0xB8, 0x00, 0x00, 0x00, 0xB8,
+        0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8,
+        0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x30, 0xBF,
+        0x60, 0x00, 0x3F, 0xE0, 0xBD, 0xC0, 0x00, 0x8D, 0xE0, 0xB8, 0xE3, 0x00, 0xE7, 0xE0, 0xB8, 0x89,
+        0x05, 0xB4, 0xE0, 0xB8, 0x2E, 0x0B, 0x54, 0xE0, 0xB8, 0x0B, 0x8E, 0x04, 0xE0, 0xB8, 0x05, 0xF8,
+        0x04, 0xE0, 0xB8, 0x00, 0x41, 0x04, 0xE0, 0xB8, 0x00, 0x00, 0x04, 0xE0, 0xBF, 0x40, 0x00, 0xC7,
+        0xBE, 0xC0, 0x00, 0xC7, 0xB8, 0xD6, 0x00, 0xC7, 0xB8, 0x5E, 0x10, 0xC7, 0xB8, 0x0C, 0x80, 0xC7,
+        0xB8, 0x04, 0xE2, 0xC7, 0xB8, 0x00, 0xA9, 0xC7, 0xB8, 0x00, 0x2F, 0xE7, 0xB8, 0x00, 0x08, 0xF7,
+        0x00, 0x3B, 0xEF, 0xC5, 0x00, 0x04, 0xF8, 0x21, 0x6E, 0x70, 0x0D, 0x90, 0x00, 0x06, 0xF2, 0x2F,
+        0x30, 0x00, 0x00, 0xF6, 0x4F, 0x20, 0x00, 0x00, 0xD7, 0x2F, 0x30, 0x00, 0x00, 0xF6, 0x0D, 0x90,
+        0x00, 0x05, 0xF2, 0x05, 0xF8, 0x21, 0x5E, 0x80, 0x00, 0x4B, 0xEF, 0xC6, 0x00, 0xBF, 0xFE, 0xC5,
+        0x00, 0xB9, 0x01, 0x7F, 0x20, 0xB8, 0x00, 0x0F, 0x50, 0xB8, 0x00, 0x5F, 0x30, 0xBE, 0xEE, 0xE6,
+        0x00, 0xB9, 0x11, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
+        0x00, 0x00, 0x3B, 0xEF, 0xC5, 0x00, 0x04, 0xF8, 0x21, 0x6E, 0x70, 0x0D, 0x90, 0x00, 0x06, 0xF2,
+        0x2F, 0x30, 0x00, 0x00, 0xF6, 0x4F, 0x20, 0x00, 0x00, 0xD7, 0x2F, 0x30, 0x00, 0x00, 0xF6, 0x0D,
+        0x90, 0x00, 0x05, 0xF2, 0x05, 0xF8, 0x21, 0x5E, 0x80, 0x00, 0x4B, 0xEF, 0xF7, 0x00, 0x00, 0x00,
+        0x01, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0xBF, 0xFE, 0xC5, 0x00, 0xB9, 0x01, 0x7F, 0x20,
+        0xB8, 0x00, 0x0F, 0x50, 0xB8, 0x00, 0x5F, 0x30, 0xBE, 0xEE, 0xF6, 0x00, 0xB9, 0x13, 0xBA, 0x00,
+        0xB8, 0x00, 0x1E, 0x50, 0xB8, 0x00, 0x07, 0xD0, 0xB8, 0x00, 0x01, 0xE6, 0x02, 0xAE, 0xFD, 0x90,
+        0x0D, 0x92, 0x02, 0x70, 0x1F, 0x30, 0x00, 0x00, 0x0C, 0xB5, 0x20, 0x00, 0x01, 0x8C, 0xFD, 0x60,
+        0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0xD7, 0x18, 0x31, 0x16, 0xF4, 0x19, 0xDE, 0xEC, 0x50,
+        0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00,
+        0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00,
+        0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0xD6, 0x00, 0x00,
+        0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00,
+        0xE6, 0xD7, 0x00, 0x00, 0xE6, 0xB9, 0x00, 0x01, 0xF4, 0x5E, 0x41, 0x2A, 0xD0, 0x06, 0xCE, 0xEA,
+        0x20, 0xAA, 0x00, 0x00, 0x0B, 0x90, 0x4E, 0x10, 0x00, 0x2F, 0x30, 0x0D, 0x60, 0x00, 0x8C, 0x00,
+        0x07, 0xC0, 0x00, 0xE6, 0x00, 0x02, 0xF3, 0x05, 0xE1, 0x00, 0x00, 0xA9, 0x0B, 0x90, 0x00, 0x00,
+        0x4E, 0x3F, 0x30, 0x00, 0x00, 0x0D, 0xDC, 0x00, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x7D, 0x00,
+        0x06, 0xF4, 0x00, 0x1F, 0x40, 0x3F, 0x20, 0x0A, 0xC8, 0x00, 0x4F, 0x10, 0x0E, 0x60, 0x0E, 0x5C,
+        0x00, 0x8B, 0x00, 0x0A, 0xA0, 0x3D, 0x0E, 0x10, 0xC7, 0x00, 0x06, 0xE0, 0x79, 0x0B, 0x51, 0xF3,
+        0x00, 0x02, 0xF2, 0xB5, 0x07, 0x95, 0xE0, 0x00, 0x00, 0xD7, 0xE1, 0x03, 0xD9, 0xB0, 0x00, 0x00,
+        0x9E, 0xC0, 0x00, 0xEE, 0x70, 0x00, 0x00, 0x5F, 0x80, 0x00, 0xAF, 0x30, 0x00, 0x0C, 0x80, 0x00,
+        0x7D, 0x10, 0x03, 0xE4, 0x03, 0xE4, 0x00, 0x00, 0x7D, 0x1C, 0x80, 0x00, 0x00, 0x0B, 0xEC, 0x00,
+        0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x3E, 0x8E, 0x20, 0x00, 0x00, 0xC8, 0x09, 0xB0, 0x00,
+        0x08, 0xC0, 0x01, 0xD7, 0x00, 0x4E, 0x20, 0x00, 0x4E, 0x30, 0x0A, 0xB0, 0x00, 0x0B, 0x90, 0x01,
+        0xD6, 0x00, 0x7D, 0x10, 0x00, 0x4E, 0x23, 0xE3, 0x00, 0x00, 0x08, 0xCD, 0x70, 0x00, 0x00, 0x00,
+        0xDC, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9,
+        0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x01, 0xCA,
+        0x00, 0x00, 0x00, 0x0A, 0xC1, 0x00, 0x00, 0x00, 0x8D, 0x20, 0x00, 0x00, 0x06, 0xE3, 0x00, 0x00,
+        0x00, 0x4F, 0x40, 0x00, 0x00, 0x02, 0xE7, 0x00, 0x00, 0x00, 0x1D, 0x90, 0x00, 0x00, 0x00, 0x6F,
+        0xFF, 0xFF, 0xFF, 0x50, 0xDE, 0xB0, 0xD4, 0x00, 0xD4, 0x00, 0xD4, 0x00, 0xD4, 0x00, 0xD4, 0x00,
+        0xD4, 0x00, 0xD4, 0x00, 0xD4, 0x00, 0xD4, 0x00, 0xCD, 0xA0, 0xD3, 0x00, 0x00, 0x88, 0x00, 0x00,
+        0x3D, 0x00, 0x00, 0x0D, 0x30, 0x00, 0x09, 0x70, 0x00, 0x04, 0xC0, 0x00, 0x00, 0xE2, 0x00, 0x00,
+        0xA6, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x06, 0x20, 0xAE, 0xE0, 0x03, 0xE0, 0x03,
+        0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x9D,
+        0xD0, 0x00, 0x03, 0x82, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x20, 0x00, 0x03, 0xE5, 0x07, 0xD2, 0x00,
+        0x3D, 0x40, 0x00, 0x5D, 0x20, 0x2D, 0xDD, 0xDD, 0xD8, 0x54, 0x00, 0x2D, 0x20, 0x04, 0xB0, 0x06,
+        0xDE, 0xD8, 0x00, 0x05, 0x20, 0x2D, 0x70, 0x00, 0x00, 0x07, 0xA0, 0x04, 0xBD, 0xDE, 0xC0, 0x1F,
+        0x40, 0x07, 0xC0, 0x2F, 0x20, 0x1C, 0xC0, 0x07, 0xDC, 0xB8, 0xC0, 0xC5, 0x00, 0x00, 0x00, 0xC5,
+        0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC7, 0xCE, 0xC3, 0x00, 0xCE, 0x30, 0x6E, 0x10, 0xC8,
+        0x00, 0x0C, 0x60, 0xC6, 0x00, 0x0B, 0x80, 0xC8, 0x00, 0x0C, 0x60, 0xCE, 0x30, 0x6E, 0x10, 0xC7,
+        0xCE, 0xC4, 0x00, 0x01, 0x9D, 0xEC, 0x30, 0x0A, 0xB2, 0x02, 0x20, 0x2F, 0x20, 0x00, 0x00, 0x4F,
+        0x00, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x00, 0x0B, 0xB2, 0x02, 0x20, 0x01, 0x9D, 0xEC, 0x30, 0x00,
+        0x00, 0x01, 0xF1, 0x00, 0x00, 0x01, 0xF1, 0x00, 0x00, 0x01, 0xF1, 0x01, 0xBE, 0xD6, 0xF1, 0x0B,
+        0xA1, 0x1B, 0xF1, 0x2F, 0x10, 0x04, 0xF1, 0x4E, 0x00, 0x02, 0xF1, 0x2F, 0x10, 0x03, 0xF1, 0x0C,
+        0x80, 0x0A, 0xF1, 0x02, 0xBC, 0xB6, 0xF1, 0x01, 0x9D, 0xEB, 0x20, 0x0A, 0xB1, 0x08, 0xC0, 0x2F,
+        0x20, 0x00, 0xE3, 0x4F, 0xDD, 0xDD, 0xE4, 0x2F, 0x10, 0x00, 0x00, 0x0A, 0xA2, 0x01, 0x50, 0x01,
+        0x8D, 0xED, 0x90, 0x01, 0xBE, 0xC0, 0x07, 0xB0, 0x00, 0x08, 0x90, 0x00, 0x9E, 0xED, 0x70, 0x09,
+        0x90, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90,
+        0x00, 0x02, 0xBE, 0xD6, 0xF1, 0x0C, 0x91, 0x1B, 0xF1, 0x2F, 0x10, 0x04, 0xF1, 0x4E, 0x00, 0x02,
+        0xF1, 0x2F, 0x10, 0x04, 0xF1, 0x0C, 0x91, 0x1B, 0xF1, 0x02, 0xBE, 0xD6, 0xF1, 0x00, 0x00, 0x04,
+        0xE0, 0x03, 0x20, 0x2C, 0x90, 0x04, 0xDE, 0xD9, 0x10, 0xC5, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00,
+        0x00, 0xC5, 0x00, 0x00, 0x00, 0xC7, 0xBE, 0xD4, 0x00, 0xCD, 0x30, 0x8D, 0x00, 0xC7, 0x00, 0x1F,
+        0x10, 0xC5, 0x00, 0x0F, 0x20, 0xC5, 0x00, 0x0F, 0x20, 0xC5, 0x00, 0x0F, 0x20, 0xC5, 0x00, 0x0F,
+        0x20, 0xC6, 0x52, 0x00, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x00, 0xC6, 0x00, 0x52, 0x00,
+        0x00, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00,
+        0xC6, 0x01, 0xE3, 0x3E, 0x90, 0xC5, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00,
+        0x00, 0xC5, 0x01, 0xAB, 0x10, 0xC5, 0x1C, 0x90, 0x00, 0xC8, 0xD7, 0x00, 0x00, 0xCE, 0xC1, 0x00,
+        0x00, 0xC6, 0xAC, 0x10, 0x00, 0xC5, 0x09, 0xC1, 0x00, 0xC5, 0x00, 0x8D, 0x20, 0xC6, 0xC6, 0xC6,
+        0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC7, 0xBF, 0xC2, 0x6D, 0xE9, 0x00, 0xCD, 0x31, 0xAD,
+        0x91, 0x2E, 0x50, 0xC7, 0x00, 0x4F, 0x10, 0x0A, 0x80, 0xC5, 0x00, 0x3E, 0x00, 0x09, 0x80, 0xC5,
+        0x00, 0x3E, 0x00, 0x09, 0x80, 0xC5, 0x00, 0x3E, 0x00, 0x09, 0x80, 0xC5, 0x00, 0x3E, 0x00, 0x09,
+        0x80, 0xC8, 0xBC, 0xC4, 0x00, 0xCD, 0x10, 0x6D, 0x00, 0xC7, 0x00, 0x1F, 0x10, 0xC5, 0x00, 0x0F,
+        0x20, 0xC5, 0x00, 0x0F, 0x20, 0xC5, 0x00, 0x0F, 0x20, 0xC5, 0x00, 0x0F, 0x20, 0x01, 0xAE, 0xE9,
+        0x10, 0x0B, 0xA1, 0x1B, 0xB0, 0x2F, 0x20, 0x03, 0xF1, 0x4F, 0x00, 0x00, 0xF3, 0x2F, 0x20, 0x02,
+        0xF1, 0x0B, 0xA1, 0x1B, 0xB0, 0x01, 0xAE, 0xEA, 0x10, 0xC8, 0xBC, 0xC3, 0x00, 0xCD, 0x10, 0x4E,
+        0x10, 0xC7, 0x00, 0x0C, 0x60, 0xC6, 0x00, 0x0B, 0x80, 0xC8, 0x00, 0x0D, 0x60, 0xCE, 0x30, 0x6E,
+        0x10, 0xC7, 0xCE, 0xC4, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00,
+        0x00, 0x01, 0xBE, 0xD6, 0xF1, 0x0B, 0xA1, 0x1B, 0xF1, 0x2F, 0x10, 0x04, 0xF1, 0x4E, 0x00, 0x02,
+        0xF1, 0x2F, 0x10, 0x04, 0xF1, 0x0C, 0x91, 0x1B, 0xF1, 0x02, 0xBE, 0xD6, 0xF1, 0x00, 0x00, 0x01,
+        0xF1, 0x00, 0x00, 0x01, 0xF1, 0x00, 0x00, 0x01, 0xF1, 0x00, 0x00, 0x00, 0xC8, 0xBD, 0x50, 0xCD,
+        0x10, 0x00, 0xC7, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00,
+        0x00, 0x06, 0xDE, 0xE8, 0x00, 0x2F, 0x20, 0x13, 0x00, 0x2F, 0x51, 0x00, 0x00, 0x05, 0xBE, 0xC4,
+        0x00, 0x00, 0x00, 0x6F, 0x10, 0x24, 0x00, 0x5F, 0x10, 0x3C, 0xEE, 0xC4, 0x00, 0x0C, 0x60, 0x00,
+        0x0C, 0x60, 0x00, 0x8F, 0xED, 0xA0, 0x0C, 0x60, 0x00, 0x0C, 0x60, 0x00, 0x0C, 0x60, 0x00, 0x0C,
+        0x60, 0x00, 0x0A, 0x80, 0x00, 0x03, 0xDE, 0xB0, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10,
+        0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x3F, 0x10, 0xA9, 0x00, 0xAF, 0x10,
+        0x2B, 0xCB, 0x7F, 0x10, 0x6C, 0x00, 0x02, 0xF2, 0x1F, 0x30, 0x08, 0xB0, 0x0A, 0x90, 0x0D, 0x50,
+        0x04, 0xE0, 0x4E, 0x10, 0x00, 0xD5, 0xA9, 0x00, 0x00, 0x8B, 0xE3, 0x00, 0x00, 0x2F, 0xC0, 0x00,
+        0x5D, 0x00, 0x8F, 0x20, 0x3E, 0x00, 0x1F, 0x20, 0xCD, 0x60, 0x7A, 0x00, 0x0C, 0x61, 0xE6, 0xA0,
+        0xB6, 0x00, 0x08, 0xA5, 0xB1, 0xE1, 0xF2, 0x00, 0x04, 0xE9, 0x70, 0xC7, 0xD0, 0x00, 0x00, 0xEE,
+        0x30, 0x8E, 0x90, 0x00, 0x00, 0xBE, 0x00, 0x4F, 0x50, 0x00, 0x2E, 0x50, 0x09, 0xB0, 0x04, 0xE2,
+        0x6E, 0x10, 0x00, 0x8D, 0xE4, 0x00, 0x00, 0x1F, 0xB0, 0x00, 0x00, 0xBA, 0xE6, 0x00, 0x07, 0xD1,
+        0x4E, 0x30, 0x4E, 0x30, 0x07, 0xD1, 0x6C, 0x00, 0x02, 0xF2, 0x1E, 0x30, 0x08, 0xB0, 0x09, 0x90,
+        0x0D, 0x50, 0x03, 0xE1, 0x5E, 0x00, 0x00, 0xC6, 0xA8, 0x00, 0x00, 0x6C, 0xF2, 0x00, 0x00, 0x1E,
+        0xB0, 0x00, 0x00, 0x0D, 0x50, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x0E, 0xE4, 0x00, 0x00, 0x4D, 0xDD,
+        0xEF, 0x40, 0x00, 0x00, 0x9C, 0x10, 0x00, 0x07, 0xD1, 0x00, 0x00, 0x5E, 0x30, 0x00, 0x03, 0xE4,
+        0x00, 0x00, 0x2E, 0x60, 0x00, 0x00, 0x7F, 0xDD, 0xDD, 0x40, 0x00, 0x1B, 0xE8, 0x00, 0x5D, 0x00,
+        0x00, 0x6C, 0x00, 0x00, 0x6C, 0x00, 0x00, 0xAA, 0x00, 0x5F, 0xE2, 0x00, 0x00, 0xB9, 0x00, 0x00,
+        0x7B, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x4E, 0x10, 0x00, 0x09, 0xD8, 0x5B, 0x5B,
+        0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x36, 0x5D, 0xC3, 0x00, 0x00, 0xA9,
+        0x00, 0x00, 0x8A, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x6D, 0x10, 0x00, 0x0B, 0xF9, 0x00, 0x5E, 0x10,
+        0x00, 0x7A, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x8A, 0x00, 0x00, 0xB8, 0x00, 0x5D, 0xB2, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x19, 0xDC, 0x61, 0x05, 0x60, 0x96, 0x24, 0xAF, 0xEB, 0x20, 0x10, 0x00,
+        0x00, 0x00, 0x00, 0x0F, 0x40, 0x08, 0x20, 0x00, 0x00, 0x0E, 0x20, 0x0F, 0x30, 0x0F, 0x40, 0x0F,
+        0x40, 0x0F, 0x40, 0x0F, 0x40, 0x03, 0x10, 0x00, 0x06, 0x00, 0x00, 0x0A, 0x00, 0x05, 0xCF, 0xE8,
+        0x5E, 0x4A, 0x13, 0xB8, 0x0A, 0x00, 0xD5, 0x0A, 0x00, 0xC7, 0x0A, 0x00, 0x6D, 0x2A, 0x02, 0x08,
+        0xEE, 0xD9, 0x00, 0x0B, 0x20, 0x00, 0x09, 0x00, 0x00, 0x19, 0xEE, 0xC0, 0x00, 0x7D, 0x20, 0x40,
+        0x00, 0xAA, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x0D, 0xEE, 0xDD, 0x10, 0x00, 0xA9, 0x00, 0x00,
+        0x00, 0xA9, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF2, 0x18, 0x00, 0x00, 0x54,
+        0x1B, 0xBD, 0xEA, 0xD2, 0x04, 0xD2, 0x19, 0x90, 0x08, 0x70, 0x03, 0xC0, 0x04, 0xD2, 0x19, 0x80,
+        0x1B, 0xBD, 0xEA, 0xD3, 0x28, 0x00, 0x00, 0x54, 0x3E, 0x20, 0x00, 0xC6, 0x08, 0xA0, 0x06, 0xB0,
+        0x00, 0xD4, 0x2E, 0x20, 0x2B, 0xCD, 0xBD, 0xB4, 0x00, 0x0A, 0xE1, 0x00, 0x2B, 0xBD, 0xEB, 0xB4,
+        0x00, 0x08, 0xC0, 0x00, 0x00, 0x08, 0xC0, 0x00, 0x00, 0x08, 0xC0, 0x00, 0x5B, 0x5B, 0x5B, 0x5B,
+        0x37, 0x00, 0x37, 0x5B, 0x5B, 0x5B, 0x5B, 0x05, 0xDD, 0xD3, 0x0E, 0x50, 0x21, 0x0C, 0x90, 0x00,
+        0x09, 0xFC, 0x30, 0x4C, 0x17, 0xE5, 0x5C, 0x00, 0x5D, 0x0A, 0xC3, 0x6B, 0x00, 0x5E, 0xE1, 0x00,
+        0x01, 0xD5, 0x04, 0x01, 0xD5, 0x09, 0xDD, 0x90, 0x00, 0x00, 0x00, 0xAA, 0x2F, 0x20, 0x22, 0x03,
+        0x00, 0x00, 0x06, 0x99, 0x96, 0x00, 0x00, 0x01, 0xA7, 0xAB, 0xB8, 0xA1, 0x00, 0x09, 0x3D, 0x50,
+        0x01, 0x29, 0x00, 0x19, 0x3C, 0x00, 0x00, 0x09, 0x10, 0x37, 0x3C, 0x00, 0x00, 0x07, 0x30, 0x19,
+        0x0D, 0x50, 0x01, 0x09, 0x10, 0x09, 0x22, 0xAB, 0xB3, 0x29, 0x00, 0x01, 0xA5, 0x00, 0x05, 0xA1,
+        0x00, 0x00, 0x06, 0xA9, 0x96, 0x00, 0x00, 0x08, 0xAA, 0x70, 0x06, 0xBA, 0xE2, 0x2C, 0x10, 0xB3,
+        0x3C, 0x02, 0xF4, 0x0A, 0xBA, 0xC4, 0x1B, 0xBB, 0xB3, 0x00, 0x20, 0x02, 0x03, 0xD0, 0x6A, 0x5D,
+        0x38, 0xB1, 0xE6, 0x2E, 0x30, 0x2C, 0x74, 0xD4, 0x01, 0xA0, 0x29, 0x00, 0x00, 0x00, 0x9E, 0xEE,
+        0xEE, 0xEE, 0x70, 0x12, 0x22, 0x22, 0x29, 0x80, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00,
+        0x05, 0x50, 0x5F, 0xFF, 0x10, 0x00, 0x06, 0x99, 0x96, 0x00, 0x00, 0x01, 0xAA, 0xB9, 0x96, 0xA1,
+        0x00, 0x09, 0x37, 0x80, 0x87, 0x29, 0x00, 0x19, 0x07, 0x80, 0x87, 0x09, 0x10, 0x37, 0x07, 0xCB,
+        0xB1, 0x07, 0x30, 0x19, 0x07, 0x81, 0xD3, 0x09, 0x10, 0x09, 0x26, 0x70, 0x4A, 0x29, 0x00, 0x01,
+        0xA5, 0x00, 0x05, 0xA1, 0x00, 0x00, 0x06, 0xA9, 0x96, 0x00, 0x00, 0x9E, 0xEE, 0x20, 0x2A, 0xC6,
+        0x00, 0xA4, 0x0B, 0x20, 0xA4, 0x0B, 0x20, 0x2A, 0xC6, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x00,
+        0x01, 0xF0, 0x00, 0x00, 0x9E, 0xEE, 0xFE, 0xEE, 0x70, 0x12, 0x23, 0xF2, 0x22, 0x10, 0x00, 0x01,
+        0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF,
+        0xFF, 0x80, 0x4A, 0xBB, 0x10, 0x00, 0x0A, 0x40, 0x00, 0x5B, 0x00, 0x06, 0x90, 0x00, 0x5F, 0xBB,
+        0x40, 0x2A, 0xAB, 0x20, 0x00, 0x0A, 0x50, 0x03, 0xBC, 0x20, 0x00, 0x08, 0x70, 0x4A, 0xAB, 0x20,
+        0x01, 0x71, 0x09, 0x80, 0x4B, 0x00, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00,
+        0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD5, 0x00, 0x3F, 0x10, 0xDB, 0x11, 0xAF, 0x20, 0xD9, 0xDE,
+        0x7B, 0xD0, 0xD4, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0x1A, 0xEE,
+        0xBD, 0xBF, 0xFC, 0x0D, 0xEF, 0xFC, 0x0D, 0xCF, 0xFC, 0x0D, 0x2C, 0xFC, 0x0D, 0x00, 0x3C, 0x0D,
+        0x00, 0x2C, 0x0D, 0x00, 0x2C, 0x0D, 0x00, 0x2C, 0x0D, 0x00, 0x2C, 0x0D, 0x00, 0x13, 0x03, 0x56,
+        0x9B, 0x00, 0x70, 0x00, 0x86, 0x2B, 0xC3, 0x1A, 0xE3, 0x00, 0x00, 0xB3, 0x00, 0x00, 0xB3, 0x00,
+        0x00, 0xB3, 0x00, 0x0A, 0xEB, 0x50, 0x07, 0xCB, 0x80, 0x3D, 0x00, 0xB5, 0x59, 0x00, 0x87, 0x3D,
+        0x00, 0xB5, 0x07, 0xCB, 0x80, 0x1B, 0xBB, 0xB3, 0x20, 0x02, 0x00, 0xB6, 0x0D, 0x30, 0x1C, 0x83,
+        0xD5, 0x03, 0xE2, 0x6D, 0x4D, 0x37, 0xC1, 0x92, 0x0A, 0x10, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00,
+        0x00, 0x12, 0x00, 0x00, 0x1A, 0xD3, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x00, 0xB3, 0x00, 0x05, 0xA0,
+        0x00, 0x00, 0x00, 0xB3, 0x00, 0x1D, 0x10, 0x00, 0x00, 0x00, 0xB3, 0x00, 0xA5, 0x00, 0x21, 0x00,
+        0x0A, 0xCA, 0x55, 0xA0, 0x04, 0xE5, 0x00, 0x00, 0x00, 0x1D, 0x10, 0x19, 0x95, 0x00, 0x00, 0x00,
+        0xA6, 0x00, 0xA1, 0x95, 0x00, 0x00, 0x04, 0xB0, 0x03, 0xBA, 0xDC, 0x20, 0x00, 0x0B, 0x20, 0x00,
+        0x00, 0x74, 0x00, 0x01, 0x20, 0x00, 0x00, 0x12, 0x00, 0x18, 0xD3, 0x00, 0x00, 0xA5, 0x00, 0x00,
+        0xB3, 0x00, 0x05, 0xA0, 0x00, 0x00, 0xB3, 0x00, 0x1D, 0x10, 0x00, 0x00, 0xB3, 0x00, 0xA5, 0x6A,
+        0xA2, 0x0A, 0xCA, 0x55, 0xB0, 0x50, 0x5A, 0x00, 0x00, 0x1D, 0x20, 0x00, 0x87, 0x00, 0x00, 0x96,
+        0x00, 0x05, 0xB0, 0x00, 0x04, 0xB0, 0x00, 0x5B, 0x10, 0x00, 0x0B, 0x20, 0x00, 0xCB, 0xB8, 0x2A,
+        0xAA, 0x10, 0x00, 0x76, 0x00, 0x00, 0x00, 0x0A, 0x50, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xBC, 0x20,
+        0x0C, 0x30, 0x00, 0x00, 0x00, 0x08, 0x70, 0x87, 0x00, 0x21, 0x00, 0x3A, 0xA9, 0x13, 0xC0, 0x04,
+        0xD5, 0x00, 0x00, 0x00, 0x1C, 0x20, 0x18, 0x95, 0x00, 0x00, 0x00, 0x97, 0x00, 0x91, 0x95, 0x00,
+        0x00, 0x04, 0xB0, 0x03, 0xBA, 0xDC, 0x20, 0x00, 0x0A, 0x20, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0D,
+        0x60, 0x00, 0x07, 0x30, 0x00, 0x06, 0x30, 0x00, 0x0D, 0x50, 0x00, 0x2E, 0x30, 0x01, 0xCA, 0x00,
+        0x0B, 0xB0, 0x00, 0x1F, 0x40, 0x00, 0x0D, 0x91, 0x39, 0x03, 0xCF, 0xD8, 0x00, 0x06, 0x20, 0x00,
+        0x00, 0x00, 0x03, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00,
+        0x00, 0x0D, 0xEC, 0x00, 0x00, 0x00, 0x4F, 0x4F, 0x30, 0x00, 0x00, 0xAA, 0x0C, 0x90, 0x00, 0x02,
+        0xF5, 0x06, 0xE1, 0x00, 0x07, 0xE0, 0x01, 0xF6, 0x00, 0x0D, 0xFE, 0xEE, 0xFC, 0x00, 0x4F, 0x31,
+        0x11, 0x4F, 0x30, 0xAA, 0x00, 0x00, 0x0C, 0x90, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x02, 0xC2,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x0D, 0xEC, 0x00,
+        0x00, 0x00, 0x4F, 0x4F, 0x30, 0x00, 0x00, 0xAA, 0x0C, 0x90, 0x00, 0x02, 0xF5, 0x06, 0xE1, 0x00,
+        0x07, 0xE0, 0x01, 0xF6, 0x00, 0x0D, 0xFE, 0xEE, 0xFC, 0x00, 0x4F, 0x31, 0x11, 0x4F, 0x30, 0xAA,
+        0x00, 0x00, 0x0C, 0x90, 0x00, 0x03, 0x82, 0x00, 0x00, 0x00, 0x2B, 0x4B, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x0D, 0xEC, 0x00, 0x00, 0x00, 0x4F, 0x4F,
+        0x30, 0x00, 0x00, 0xAA, 0x0C, 0x90, 0x00, 0x02, 0xF5, 0x06, 0xE1, 0x00, 0x07, 0xE0, 0x01, 0xF6,
+        0x00, 0x0D, 0xFE, 0xEE, 0xFC, 0x00, 0x4F, 0x31, 0x11, 0x4F, 0x30, 0xAA, 0x00, 0x00, 0x0C, 0x90,
+        0x00, 0x3B, 0x64, 0x60, 0x00, 0x00, 0x83, 0x7B, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x07, 0xF6, 0x00, 0x00, 0x00, 0x0D, 0xEC, 0x00, 0x00, 0x00, 0x4F, 0x4F, 0x30, 0x00, 0x00, 0xAA,
+        0x0C, 0x90, 0x00, 0x02, 0xF5, 0x06, 0xE1, 0x00, 0x07, 0xE0, 0x01, 0xF6, 0x00, 0x0D, 0xFE, 0xEE,
+        0xFC, 0x00, 0x4F, 0x31, 0x11, 0x4F, 0x30, 0xAA, 0x00, 0x00, 0x0C, 0x90, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x7D, 0x0E, 0x50, 0x00, 0x00, 0x13, 0x03, 0x10, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00,
+        0x00, 0x0D, 0xEC, 0x00, 0x00, 0x00, 0x4F, 0x4F, 0x30, 0x00, 0x00, 0xAA, 0x0C, 0x90, 0x00, 0x02,
+        0xF5, 0x06, 0xE1, 0x00, 0x07, 0xE0, 0x01, 0xF6, 0x00, 0x0D, 0xFE, 0xEE, 0xFC, 0x00, 0x4F, 0x31,
+        0x11, 0x4F, 0x30, 0xAA, 0x00, 0x00, 0x0C, 0x90, 0x00, 0x08, 0xB7, 0x00, 0x00, 0x00, 0x39, 0x0B,
+        0x20, 0x00, 0x00, 0x2A, 0x1B, 0x10, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00, 0x1E, 0xED, 0x00,
+        0x00, 0x00, 0x6F, 0x5F, 0x40, 0x00, 0x00, 0xCB, 0x0C, 0xA0, 0x00, 0x02, 0xF5, 0x07, 0xF1, 0x00,
+        0x08, 0xE0, 0x01, 0xF6, 0x00, 0x0E, 0xFE, 0xEE, 0xFC, 0x00, 0x5F, 0x31, 0x11, 0x4F, 0x30, 0xBA,
+        0x00, 0x00, 0x0C, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x0A, 0xB5, 0xF1, 0x00, 0x00,
+        0x00, 0x2F, 0x44, 0xF0, 0x00, 0x00, 0x00, 0x8D, 0x04, 0xF0, 0x00, 0x00, 0x01, 0xE7, 0x04, 0xFE,
+        0xEE, 0xE7, 0x06, 0xF1, 0x04, 0xF2, 0x22, 0x21, 0x0D, 0xFE, 0xEE, 0xF0, 0x00, 0x00, 0x4F, 0x31,
+        0x15, 0xF1, 0x00, 0x00, 0xB9, 0x00, 0x04, 0xFF, 0xFF, 0xFC, 0x00, 0x3A, 0xEF, 0xD8, 0x10, 0x04,
+        0xF8, 0x21, 0x28, 0x50, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x4F, 0x20,
+        0x00, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x21,
+        0x28, 0x50, 0x00, 0x3A, 0xEF, 0xD8, 0x10, 0x00, 0x00, 0x0B, 0x20, 0x00, 0x00, 0x00, 0x09, 0x50,
+        0x00, 0x00, 0x03, 0xCD, 0x20, 0x00, 0x01, 0x71, 0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0xB9, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00,
+        0x00, 0x00, 0xBF, 0xEE, 0xEE, 0x10, 0xB9, 0x22, 0x22, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB9, 0x00,
+        0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x60, 0x00, 0x04, 0x40, 0x00, 0x00, 0x4B, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0xB9, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00,
+        0x00, 0x00, 0xBF, 0xEE, 0xEE, 0x10, 0xB9, 0x22, 0x22, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB9, 0x00,
+        0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x60, 0x00, 0x47, 0x10, 0x00, 0x04, 0xA4, 0xA0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0xB9, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00,
+        0x00, 0x00, 0xBF, 0xEE, 0xEE, 0x10, 0xB9, 0x22, 0x22, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB9, 0x00,
+        0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x09, 0xA2, 0xF2, 0x00, 0x02, 0x20,
+        0x30, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0xB9, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00,
+        0x00, 0x00, 0xBF, 0xEE, 0xEE, 0x10, 0xB9, 0x22, 0x22, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB9, 0x00,
+        0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x60, 0x36, 0x00, 0x0A, 0x60, 0x00, 0x00, 0x0B, 0x80, 0x0B, 0x80,
+        0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x07, 0x20,
+        0x87, 0x00, 0x00, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00,
+        0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x00, 0x76, 0x00, 0x08, 0x68, 0x60, 0x00, 0x00, 0x00, 0x00,
+        0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8,
+        0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF5, 0x7C, 0x31, 0x12,
+        0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80,
+        0x0B, 0x80, 0x0A, 0xFF, 0xFD, 0xA4, 0x00, 0x0A, 0x90, 0x12, 0x8F, 0x60, 0x0A, 0x90, 0x00, 0x08,
+        0xE0, 0x0A, 0x90, 0x00, 0x03, 0xF3, 0xCE, 0xED, 0xA0, 0x01, 0xF4, 0x0A, 0x90, 0x00, 0x03, 0xF3,
+        0x0A, 0x90, 0x00, 0x08, 0xE0, 0x0A, 0x90, 0x02, 0x8F, 0x60, 0x0A, 0xFF, 0xFD, 0xA4, 0x00, 0x00,
+        0xA9, 0x1A, 0x00, 0x02, 0x83, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xC7, 0xBE,
+        0xC0, 0x00, 0xC7, 0xB8, 0xD6, 0x00, 0xC7, 0xB8, 0x5E, 0x10, 0xC7, 0xB8, 0x0C, 0x80, 0xC7, 0xB8,
+        0x04, 0xE2, 0xC7, 0xB8, 0x00, 0xA9, 0xC7, 0xB8, 0x00, 0x2F, 0xE7, 0xB8, 0x00, 0x08, 0xF7, 0x00,
+        0x02, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B,
+        0xEF, 0xC5, 0x00, 0x04, 0xF8, 0x21, 0x6E, 0x70, 0x0D, 0x90, 0x00, 0x06, 0xF2, 0x2F, 0x30, 0x00,
+        0x00, 0xF6, 0x4F, 0x20, 0x00, 0x00, 0xD7, 0x2F, 0x30, 0x00, 0x00, 0xF6, 0x0D, 0x90, 0x00, 0x05,
+        0xF2, 0x05, 0xF8, 0x21, 0x5E, 0x80, 0x00, 0x4B, 0xEF, 0xC6, 0x00, 0x00, 0x00, 0x0C, 0x40, 0x00,
+        0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xEF, 0xC5, 0x00, 0x04,
+        0xF8, 0x21, 0x6E, 0x70, 0x0D, 0x90, 0x00, 0x06, 0xF2, 0x2F, 0x30, 0x00, 0x00, 0xF6, 0x4F, 0x20,
+        0x00, 0x00, 0xD7, 0x2F, 0x30, 0x00, 0x00, 0xF6, 0x0D, 0x90, 0x00, 0x05, 0xF2, 0x05, 0xF8, 0x21,
+        0x5E, 0x80, 0x00, 0x4B, 0xEF, 0xC6, 0x00, 0x00, 0x00, 0xCD, 0x20, 0x00, 0x00, 0x07, 0x74, 0xB0,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xEF, 0xC5, 0x00, 0x04, 0xF8, 0x21, 0x6E, 0x70,
+        0x0D, 0x90, 0x00, 0x06, 0xF2, 0x2F, 0x30, 0x00, 0x00, 0xF6, 0x4F, 0x20, 0x00, 0x00, 0xD7, 0x2F,
+        0x30, 0x00, 0x00, 0xF6, 0x0D, 0x90, 0x00, 0x05, 0xF2, 0x05, 0xF8, 0x21, 0x5E, 0x80, 0x00, 0x4B,
+        0xEF, 0xC6, 0x00, 0x00, 0x07, 0xB3, 0x82, 0x00, 0x00, 0x0B, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x3B, 0xEF, 0xC5, 0x00, 0x04, 0xF8, 0x21, 0x6E, 0x70, 0x0D, 0x90, 0x00, 0x06,
+        0xF2, 0x2F, 0x30, 0x00, 0x00, 0xF6, 0x4F, 0x20, 0x00, 0x00, 0xD7, 0x2F, 0x30, 0x00, 0x00, 0xF6,
+        0x0D, 0x90, 0x00, 0x05, 0xF2, 0x05, 0xF8, 0x21, 0x5E, 0x80, 0x00, 0x4B, 0xEF, 0xC6, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x84, 0xF0, 0x00, 0x00, 0x02, 0x21, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x3B, 0xEF, 0xC5, 0x00, 0x04, 0xF8, 0x21, 0x6E, 0x70, 0x0D, 0x90, 0x00,
+        0x06, 0xF2, 0x2F, 0x30, 0x00, 0x00, 0xF6, 0x4F, 0x20, 0x00, 0x00, 0xD7, 0x2F, 0x30, 0x00, 0x00,
+        0xF6, 0x0D, 0x90, 0x00, 0x05, 0xF2, 0x05, 0xF8, 0x21, 0x5E, 0x80, 0x00, 0x4B, 0xEF, 0xC6, 0x00,
+        0x03, 0x00, 0x00, 0x03, 0x00, 0x1D, 0x80, 0x00, 0x9C, 0x00, 0x02, 0xD8, 0x0A, 0xC1, 0x00, 0x00,
+        0x1D, 0xDC, 0x10, 0x00, 0x00, 0x1B, 0xEA, 0x00, 0x00, 0x01, 0xBB, 0x1C, 0xA0, 0x00, 0x1C, 0xA0,
+        0x01, 0xBA, 0x00, 0x05, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3B, 0xEE,
+        0xB5, 0xB5, 0x04, 0xF8, 0x21, 0x6F, 0xA0, 0x0D, 0x90, 0x00, 0x87, 0xE1, 0x2F, 0x30, 0x07, 0x60,
+        0xE5, 0x4F, 0x20, 0x78, 0x00, 0xD7, 0x2F, 0x36, 0xA0, 0x00, 0xF6, 0x0D, 0xBB, 0x00, 0x06, 0xF2,
+        0x07, 0xF8, 0x21, 0x6E, 0x80, 0x2C, 0x4A, 0xEF, 0xC6, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x6B, 0x00, 0x00, 0x00, 0x0A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0xE6, 0xD6,
+        0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD7,
+        0x00, 0x00, 0xE6, 0xB9, 0x00, 0x01, 0xF4, 0x5E, 0x41, 0x2A, 0xD0, 0x06, 0xCE, 0xEA, 0x20, 0x00,
+        0x03, 0xD1, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0xE6, 0xD6,
+        0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD7,
+        0x00, 0x00, 0xE6, 0xB9, 0x00, 0x01, 0xF4, 0x5E, 0x41, 0x2A, 0xD0, 0x06, 0xCE, 0xEA, 0x20, 0x00,
+        0x3D, 0xA0, 0x00, 0x00, 0xB2, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0xE6, 0xD6,
+        0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD7,
+        0x00, 0x00, 0xE6, 0xB9, 0x00, 0x01, 0xF4, 0x5E, 0x41, 0x2A, 0xD0, 0x06, 0xCE, 0xEA, 0x20, 0x00,
+        0x00, 0x00, 0x00, 0x02, 0xF3, 0xAA, 0x00, 0x00, 0x30, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6,
+        0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6,
+        0x00, 0x00, 0xE6, 0xD7, 0x00, 0x00, 0xE6, 0xB9, 0x00, 0x01, 0xF4, 0x5E, 0x41, 0x2A, 0xD0, 0x06,
+        0xCE, 0xEA, 0x20, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0xB0, 0x00, 0x0B, 0x90, 0x01, 0xD6, 0x00, 0x7D, 0x10, 0x00, 0x4E, 0x23, 0xE3,
+        0x00, 0x00, 0x08, 0xCD, 0x70, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00,
+        0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0xB8,
+        0x00, 0x00, 0x00, 0xBE, 0xED, 0xA3, 0x00, 0xB9, 0x12, 0xAE, 0x10, 0xB8, 0x00, 0x1F, 0x40, 0xB8,
+        0x00, 0x0F, 0x50, 0xB8, 0x00, 0x7F, 0x20, 0xBE, 0xEE, 0xD5, 0x00, 0xB9, 0x11, 0x00, 0x00, 0xB8,
+        0x00, 0x00, 0x00, 0x19, 0xEE, 0x91, 0x00, 0x8B, 0x11, 0xA8, 0x00, 0xC6, 0x03, 0xBA, 0x00, 0xC6,
+        0x2E, 0x30, 0x00, 0xC6, 0x5D, 0x00, 0x00, 0xC6, 0x1D, 0xB2, 0x00, 0xC6, 0x01, 0xAE, 0x20, 0xC6,
+        0x00, 0x0B, 0x80, 0xC6, 0x20, 0x1C, 0x60, 0xC6, 0xBE, 0xE9, 0x00, 0x01, 0xD3, 0x00, 0x00, 0x00,
+        0x3C, 0x10, 0x00, 0x00, 0x04, 0x30, 0x00, 0x06, 0xDE, 0xD8, 0x00, 0x05, 0x20, 0x2D, 0x70, 0x00,
+        0x00, 0x07, 0xA0, 0x04, 0xBD, 0xDE, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x2F, 0x20, 0x1C, 0xC0, 0x07,
+        0xDC, 0xB8, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x07, 0x10, 0x00, 0x06,
+        0xDE, 0xD8, 0x00, 0x05, 0x20, 0x2D, 0x70, 0x00, 0x00, 0x07, 0xA0, 0x04, 0xBD, 0xDE, 0xC0, 0x1F,
+        0x40, 0x07, 0xC0, 0x2F, 0x20, 0x1C, 0xC0, 0x07, 0xDC, 0xB8, 0xC0, 0x00, 0x1E, 0x80, 0x00, 0x00,
+        0x95, 0xB3, 0x00, 0x01, 0x60, 0x25, 0x00, 0x06, 0xDE, 0xD8, 0x00, 0x05, 0x20, 0x2D, 0x70, 0x00,
+        0x00, 0x07, 0xA0, 0x04, 0xBD, 0xDE, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x2F, 0x20, 0x1C, 0xC0, 0x07,
+        0xDC, 0xB8, 0xC0, 0x01, 0xCB, 0x1C, 0x00, 0x04, 0x73, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+        0xDE, 0xD8, 0x00, 0x05, 0x20, 0x2D, 0x70, 0x00, 0x00, 0x07, 0xA0, 0x04, 0xBD, 0xDE, 0xC0, 0x1F,
+        0x40, 0x07, 0xC0, 0x2F, 0x20, 0x1C, 0xC0, 0x07, 0xDC, 0xB8, 0xC0, 0x02, 0xF3, 0x9A, 0x00, 0x00,
+        0x41, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xDE, 0xD8, 0x00, 0x05, 0x20, 0x2D, 0x70, 0x00,
+        0x00, 0x07, 0xA0, 0x04, 0xBD, 0xDE, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x2F, 0x20, 0x1C, 0xC0, 0x07,
+        0xDC, 0xB8, 0xC0, 0x00, 0x6C, 0xA1, 0x00, 0x00, 0xC0, 0x67, 0x00, 0x00, 0x6C, 0xB1, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x06, 0xDE, 0xD8, 0x00, 0x05, 0x20, 0x2D, 0x70, 0x00, 0x00, 0x07, 0xA0, 0x04,
+        0xBD, 0xDE, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x2F, 0x20, 0x1C, 0xC0, 0x07, 0xDC, 0xB8, 0xC0, 0x06,
+        0xDE, 0xE8, 0x2A, 0xEE, 0x91, 0x00, 0x02, 0x10, 0x1A, 0xF8, 0x11, 0xB9, 0x00, 0x03, 0xAD, 0xDE,
+        0xD0, 0x00, 0x3E, 0x00, 0x0E, 0x60, 0x06, 0xED, 0xDD, 0xDE, 0x10, 0x3F, 0x00, 0x09, 0xD0, 0x00,
+        0x00, 0x00, 0x1F, 0x50, 0x4E, 0xE8, 0x10, 0x15, 0x00, 0x05, 0xDE, 0xC4, 0x2A, 0xEE, 0xD7, 0x00,
+        0x01, 0x9D, 0xEC, 0x30, 0x0A, 0xB2, 0x02, 0x20, 0x2F, 0x20, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00,
+        0x2F, 0x20, 0x00, 0x00, 0x0B, 0xB2, 0x02, 0x20, 0x01, 0x9D, 0xFC, 0x30, 0x00, 0x00, 0xB2, 0x00,
+        0x00, 0x00, 0x95, 0x00, 0x00, 0x3C, 0xD2, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xEB, 0x20, 0x0A, 0xB1, 0x08, 0xC0, 0x2F, 0x20, 0x00, 0xE3,
+        0x4F, 0xDD, 0xDD, 0xE4, 0x2F, 0x10, 0x00, 0x00, 0x0A, 0xA2, 0x01, 0x50, 0x01, 0x8D, 0xED, 0x90,
+        0x00, 0x00, 0x6B, 0x10, 0x00, 0x05, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xEB, 0x20,
+        0x0A, 0xB1, 0x08, 0xC0, 0x2F, 0x20, 0x00, 0xE3, 0x4F, 0xDD, 0xDD, 0xE4, 0x2F, 0x10, 0x00, 0x00,
+        0x0A, 0xA2, 0x01, 0x50, 0x01, 0x8D, 0xED, 0x90, 0x00, 0x0B, 0xD1, 0x00, 0x00, 0x86, 0x3B, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xEB, 0x20, 0x0A, 0xB1, 0x08, 0xC0, 0x2F, 0x20, 0x00, 0xE3,
+        0x4F, 0xDD, 0xDD, 0xE4, 0x2F, 0x10, 0x00, 0x00, 0x0A, 0xA2, 0x01, 0x50, 0x01, 0x8D, 0xED, 0x90,
+        0x00, 0xB8, 0x4F, 0x00, 0x00, 0x32, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xEB, 0x20,
+        0x0A, 0xB1, 0x08, 0xC0, 0x2F, 0x20, 0x00, 0xE3, 0x4F, 0xDD, 0xDD, 0xE4, 0x2F, 0x10, 0x00, 0x00,
+        0x0A, 0xA2, 0x01, 0x50, 0x01, 0x8D, 0xED, 0x90, 0x1D, 0x40, 0x03, 0xD1, 0x00, 0x44, 0x00, 0xC6,
+        0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xA8, 0x06, 0xB0,
+        0x07, 0x10, 0x0C, 0x60, 0x0C, 0x60, 0x0C, 0x60, 0x0C, 0x60, 0x0C, 0x60, 0x0C, 0x60, 0x0C, 0x60,
+        0x01, 0xD9, 0x00, 0x09, 0x6B, 0x30, 0x16, 0x02, 0x50, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00,
+        0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x1F, 0x39,
+        0xA0, 0x04, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00,
+        0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x9C, 0x37, 0x50,
+        0x02, 0x7F, 0xE3, 0x00, 0x04, 0x41, 0xD9, 0x00, 0x01, 0xAE, 0xEF, 0x50, 0x0B, 0xA1, 0x08, 0xD0,
+        0x2F, 0x20, 0x02, 0xF2, 0x4F, 0x00, 0x00, 0xF3, 0x2F, 0x20, 0x03, 0xF1, 0x0B, 0xA1, 0x1B, 0xA0,
+        0x01, 0x9E, 0xE9, 0x10, 0x07, 0xC5, 0x84, 0x00, 0x0A, 0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xC8, 0xBC, 0xC4, 0x00, 0xCD, 0x10, 0x6D, 0x00, 0xC7, 0x00, 0x1F, 0x10, 0xC5, 0x00, 0x0F, 0x20,
+        0xC5, 0x00, 0x0F, 0x20, 0xC5, 0x00, 0x0F, 0x20, 0xC5, 0x00, 0x0F, 0x20, 0x00, 0xA8, 0x00, 0x00,
+        0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAE, 0xE9, 0x10, 0x0B, 0xA1, 0x1B, 0xB0,
+        0x2F, 0x20, 0x03, 0xF1, 0x4F, 0x00, 0x00, 0xF3, 0x2F, 0x20, 0x02, 0xF1, 0x0B, 0xA1, 0x1B, 0xB0,
+        0x01, 0xAE, 0xEA, 0x10, 0x00, 0x00, 0x99, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0xAE, 0xE9, 0x10, 0x0B, 0xA1, 0x1B, 0xB0, 0x2F, 0x20, 0x03, 0xF1, 0x4F, 0x00, 0x00, 0xF3,
+        0x2F, 0x20, 0x02, 0xF1, 0x0B, 0xA1, 0x1B, 0xB0, 0x01, 0xAE, 0xEA, 0x10, 0x00, 0x1C, 0xC0, 0x00,
+        0x00, 0xA4, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAE, 0xE9, 0x10, 0x0B, 0xA1, 0x1B, 0xB0,
+        0x2F, 0x20, 0x03, 0xF1, 0x4F, 0x00, 0x00, 0xF3, 0x2F, 0x20, 0x02, 0xF1, 0x0B, 0xA1, 0x1B, 0xB0,
+        0x01, 0xAE, 0xEA, 0x10, 0x00, 0xAC, 0x2C, 0x00, 0x01, 0xA2, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0xAE, 0xE9, 0x10, 0x0B, 0xA1, 0x1B, 0xB0, 0x2F, 0x20, 0x03, 0xF1, 0x4F, 0x00, 0x00, 0xF3,
+        0x2F, 0x20, 0x02, 0xF1, 0x0B, 0xA1, 0x1B, 0xB0, 0x01, 0xAE, 0xEA, 0x10, 0x00, 0xE6, 0x6D, 0x00,
+        0x00, 0x31, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAE, 0xE9, 0x10, 0x0B, 0xA1, 0x1B, 0xB0,
+        0x2F, 0x20, 0x03, 0xF1, 0x4F, 0x00, 0x00, 0xF3, 0x2F, 0x20, 0x02, 0xF1, 0x0B, 0xA1, 0x1B, 0xB0,
+        0x01, 0xAE, 0xEA, 0x10, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x9E, 0xEE,
+        0xEE, 0xEE, 0x70, 0x12, 0x22, 0x22, 0x22, 0x10, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x05, 0xF4,
+        0x00, 0x00, 0x00, 0x02, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x01, 0xAE, 0xE9, 0xC3, 0x0B,
+        0xA1, 0x1E, 0xB0, 0x2F, 0x20, 0x96, 0xF2, 0x4F, 0x08, 0x60, 0xF3, 0x2F, 0x78, 0x03, 0xF1, 0x0C,
+        0xD1, 0x1B, 0xB0, 0x3B, 0xAE, 0xEA, 0x10, 0x11, 0x00, 0x00, 0x00, 0x0B, 0x70, 0x00, 0x00, 0x01,
+        0xC3, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4,
+        0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x3F, 0x10, 0xA9, 0x00, 0xAF, 0x10, 0x2B,
+        0xCB, 0x7F, 0x10, 0x00, 0x07, 0xB0, 0x00, 0x00, 0x3D, 0x10, 0x00, 0x00, 0x52, 0x00, 0x00, 0xD4,
+        0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4,
+        0x00, 0x3F, 0x10, 0xA9, 0x00, 0xAF, 0x10, 0x2B, 0xCB, 0x7F, 0x10, 0x00, 0xBC, 0x00, 0x00, 0x06,
+        0x98, 0x70, 0x00, 0x06, 0x10, 0x60, 0x00, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4,
+        0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x3F, 0x10, 0xA9, 0x00, 0xAF, 0x10, 0x2B,
+        0xCB, 0x7F, 0x10, 0x0D, 0x76, 0xE0, 0x00, 0x03, 0x21, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4,
+        0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4,
+        0x00, 0x3F, 0x10, 0xA9, 0x00, 0xAF, 0x10, 0x2B, 0xCB, 0x7F, 0x10, 0x00, 0x00, 0x46, 0x00, 0x00,
+        0x03, 0xC2, 0x00, 0x00, 0x06, 0x10, 0x00, 0x6C, 0x00, 0x02, 0xF2, 0x1E, 0x30, 0x08, 0xB0, 0x09,
+        0x90, 0x0D, 0x50, 0x03, 0xE1, 0x5E, 0x00, 0x00, 0xC6, 0xA8, 0x00, 0x00, 0x6C, 0xF2, 0x00, 0x00,
+        0x1E, 0xB0, 0x00, 0x00, 0x0D, 0x50, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x0E, 0xE4, 0x00, 0x00, 0xC5,
+        0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC7, 0xCE, 0xC3, 0x00, 0xCE,
+        0x30, 0x6E, 0x10, 0xC8, 0x00, 0x0C, 0x60, 0xC6, 0x00, 0x0B, 0x80, 0xC8, 0x00, 0x0C, 0x60, 0xCE,
+        0x30, 0x6E, 0x10, 0xC7, 0xCE, 0xC4, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC5,
+        0x00, 0x00, 0x00, 0x00, 0xF4, 0x8B, 0x00, 0x00, 0x41, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C,
+        0x00, 0x02, 0xF2, 0x1E, 0x30, 0x08, 0xB0, 0x09, 0x90, 0x0D, 0x50, 0x03, 0xE1, 0x5E, 0x00, 0x00,
+        0xC6, 0xA8, 0x00, 0x00, 0x6C, 0xF2, 0x00, 0x00, 0x1E, 0xB0, 0x00, 0x00, 0x0D, 0x50, 0x00, 0x00,
+        0x5D, 0x00, 0x00, 0x0E, 0xE4, 0x00, 0x00, 0x00, 0x6E, 0xEE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x0D, 0xEC, 0x00, 0x00, 0x00, 0x4F, 0x4F, 0x30, 0x00,
+        0x00, 0xAA, 0x0C, 0x90, 0x00, 0x02, 0xF5, 0x06, 0xE1, 0x00, 0x07, 0xE0, 0x01, 0xF6, 0x00, 0x0D,
+        0xFE, 0xEE, 0xFC, 0x00, 0x4F, 0x31, 0x11, 0x4F, 0x30, 0xAA, 0x00, 0x00, 0x0C, 0x90, 0x02, 0xEE,
+        0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xDE, 0xD8, 0x00, 0x05, 0x20,
+        0x2D, 0x70, 0x00, 0x00, 0x07, 0xA0, 0x04, 0xBD, 0xDE, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x2F, 0x20,
+        0x1C, 0xC0, 0x07, 0xDC, 0xB8, 0xC0, 0x00, 0x58, 0x06, 0x70, 0x00, 0x00, 0x09, 0xCA, 0x10, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x0D, 0xEC, 0x00, 0x00, 0x00,
+        0x4F, 0x4F, 0x30, 0x00, 0x00, 0xAA, 0x0C, 0x90, 0x00, 0x02, 0xF5, 0x06, 0xE1, 0x00, 0x07, 0xE0,
+        0x01, 0xF6, 0x00, 0x0D, 0xFE, 0xEE, 0xFC, 0x00, 0x4F, 0x31, 0x11, 0x4F, 0x30, 0xAA, 0x00, 0x00,
+        0x0C, 0x90, 0x02, 0xB0, 0x39, 0x00, 0x00, 0x7C, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xDE,
+        0xD8, 0x00, 0x05, 0x20, 0x2D, 0x70, 0x00, 0x00, 0x07, 0xA0, 0x04, 0xBD, 0xDE, 0xC0, 0x1F, 0x40,
+        0x07, 0xC0, 0x2F, 0x20, 0x1C, 0xC0, 0x07, 0xDC, 0xB8, 0xC0, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00,
+        0x0D, 0xEC, 0x00, 0x00, 0x00, 0x4F, 0x4F, 0x30, 0x00, 0x00, 0xAA, 0x0C, 0x90, 0x00, 0x02, 0xF5,
+        0x06, 0xE1, 0x00, 0x07, 0xE0, 0x01, 0xF6, 0x00, 0x0D, 0xFE, 0xEE, 0xFC, 0x00, 0x4F, 0x31, 0x11,
+        0x4F, 0x30, 0xAA, 0x00, 0x00, 0x0C, 0x90, 0x00, 0x00, 0x00, 0x0B, 0x10, 0x00, 0x00, 0x00, 0x2B,
+        0x00, 0x00, 0x00, 0x00, 0x1C, 0xC2, 0x06, 0xDE, 0xD8, 0x00, 0x05, 0x20, 0x2D, 0x70, 0x00, 0x00,
+        0x07, 0xA0, 0x04, 0xBD, 0xDE, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x2F, 0x20, 0x1C, 0xC0, 0x07, 0xDC,
+        0xB8, 0xC0, 0x00, 0x00, 0x0A, 0x20, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0B, 0xC4, 0x00, 0x00,
+        0x0C, 0x50, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xEF,
+        0xD8, 0x10, 0x04, 0xF8, 0x21, 0x28, 0x50, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x00,
+        0x00, 0x4F, 0x20, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x0D, 0x90, 0x00, 0x00, 0x00,
+        0x04, 0xF8, 0x21, 0x28, 0x50, 0x00, 0x3A, 0xEF, 0xD8, 0x10, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x05,
+        0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xEC, 0x30, 0x0A, 0xB2, 0x02, 0x20, 0x2F, 0x20,
+        0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x00, 0x0B, 0xB2, 0x02, 0x20, 0x01, 0x9D,
+        0xEC, 0x30, 0x00, 0x00, 0x9E, 0x40, 0x00, 0x00, 0x04, 0xA1, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x3A, 0xEF, 0xD8, 0x10, 0x04, 0xF8, 0x21, 0x28, 0x50, 0x0D, 0x90, 0x00, 0x00, 0x00,
+        0x2F, 0x30, 0x00, 0x00, 0x00, 0x4F, 0x20, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x0D,
+        0x90, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x21, 0x28, 0x50, 0x00, 0x3A, 0xEF, 0xD8, 0x10, 0x00, 0x09,
+        0xD3, 0x00, 0x00, 0x59, 0x2B, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xEC, 0x30, 0x0A, 0xB2,
+        0x02, 0x20, 0x2F, 0x20, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x00, 0x0B, 0xB2,
+        0x02, 0x20, 0x01, 0x9D, 0xEC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00,
+        0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xEF, 0xD8, 0x10, 0x04,
+        0xF8, 0x21, 0x28, 0x50, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x4F, 0x20,
+        0x00, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x21,
+        0x28, 0x50, 0x00, 0x3A, 0xEF, 0xD8, 0x10, 0x00, 0x05, 0xD0, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0x9D, 0xEC, 0x30, 0x0A, 0xB2, 0x02, 0x20, 0x2F, 0x20, 0x00, 0x00, 0x4F,
+        0x00, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x00, 0x0B, 0xB2, 0x02, 0x20, 0x01, 0x9D, 0xEC, 0x30, 0x00,
+        0x07, 0x73, 0xB0, 0x00, 0x00, 0x00, 0xBD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A,
+        0xEF, 0xD8, 0x10, 0x04, 0xF8, 0x21, 0x28, 0x50, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x00,
+        0x00, 0x00, 0x4F, 0x20, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x0D, 0x90, 0x00, 0x00,
+        0x00, 0x04, 0xF8, 0x21, 0x28, 0x50, 0x00, 0x3A, 0xEF, 0xD8, 0x10, 0x00, 0x86, 0x3B, 0x00, 0x00,
+        0x0B, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xEC, 0x30, 0x0A, 0xB2, 0x02, 0x20, 0x2F,
+        0x20, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x00, 0x0B, 0xB2, 0x02, 0x20, 0x01,
+        0x9D, 0xEC, 0x30, 0x00, 0x60, 0x33, 0x00, 0x00, 0x00, 0x5B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xBF, 0xFF, 0xDA, 0x30, 0x00, 0xB9, 0x01, 0x38, 0xF5, 0x00, 0xB8, 0x00, 0x00, 0x9D,
+        0x00, 0xB8, 0x00, 0x00, 0x4F, 0x20, 0xB8, 0x00, 0x00, 0x2F, 0x30, 0xB8, 0x00, 0x00, 0x4F, 0x20,
+        0xB8, 0x00, 0x00, 0x9D, 0x00, 0xB9, 0x01, 0x28, 0xF5, 0x00, 0xBF, 0xFF, 0xDA, 0x30, 0x00, 0x00,
+        0x00, 0x01, 0xF1, 0xD5, 0x00, 0x00, 0x01, 0xF2, 0xF1, 0x00, 0x00, 0x01, 0xF2, 0x40, 0x01, 0xBE,
+        0xD6, 0xF1, 0x00, 0x0B, 0xA1, 0x1B, 0xF1, 0x00, 0x2F, 0x10, 0x04, 0xF1, 0x00, 0x4E, 0x00, 0x02,
+        0xF1, 0x00, 0x2F, 0x10, 0x03, 0xF1, 0x00, 0x0C, 0x80, 0x0A, 0xF1, 0x00, 0x02, 0xBC, 0xB6, 0xF1,
+        0x00, 0x0A, 0xFF, 0xFD, 0xA4, 0x00, 0x0A, 0x90, 0x12, 0x8F, 0x60, 0x0A, 0x90, 0x00, 0x08, 0xE0,
+        0x0A, 0x90, 0x00, 0x03, 0xF3, 0xCE, 0xED, 0xA0, 0x01, 0xF4, 0x0A, 0x90, 0x00, 0x03, 0xF3, 0x0A,
+        0x90, 0x00, 0x08, 0xE0, 0x0A, 0x90, 0x02, 0x8F, 0x60, 0x0A, 0xFF, 0xFD, 0xA4, 0x00, 0x00, 0x00,
+        0x01, 0xF1, 0x00, 0x00, 0x02, 0xBC, 0xFC, 0x10, 0x00, 0x00, 0x01, 0xF1, 0x00, 0x01, 0xBE, 0xD6,
+        0xF1, 0x00, 0x0B, 0xA1, 0x1B, 0xF1, 0x00, 0x2F, 0x10, 0x04, 0xF1, 0x00, 0x4E, 0x00, 0x02, 0xF1,
+        0x00, 0x2F, 0x10, 0x03, 0xF1, 0x00, 0x0C, 0x80, 0x0A, 0xF1, 0x00, 0x02, 0xBC, 0xB6, 0xF1, 0x00,
+        0x09, 0xEE, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0xB9, 0x00, 0x00, 0x00,
+        0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xBF, 0xEE, 0xEE, 0x10, 0xB9, 0x22, 0x22, 0x00,
+        0xB8, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x60, 0x00, 0xAE, 0xEE, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xEB, 0x20, 0x0A, 0xB1, 0x08, 0xC0,
+        0x2F, 0x20, 0x00, 0xE3, 0x4F, 0xDD, 0xDD, 0xE4, 0x2F, 0x10, 0x00, 0x00, 0x0A, 0xA2, 0x01, 0x50,
+        0x01, 0x8D, 0xED, 0x90, 0x05, 0x20, 0x51, 0x00, 0x03, 0xCC, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xBF, 0xFF, 0xFF, 0x40, 0xB9, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
+        0xBF, 0xEE, 0xEE, 0x10, 0xB9, 0x22, 0x22, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00,
+        0xBF, 0xFF, 0xFF, 0x60, 0x00, 0xA5, 0x1C, 0x10, 0x00, 0x2B, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0x9D, 0xEB, 0x20, 0x0A, 0xB1, 0x08, 0xC0, 0x2F, 0x20, 0x00, 0xE3, 0x4F, 0xDD, 0xDD, 0xE4,
+        0x2F, 0x10, 0x00, 0x00, 0x0A, 0xA2, 0x01, 0x50, 0x01, 0x8D, 0xED, 0x90, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x6E, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0xB9, 0x00, 0x00, 0x00,
+        0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xBF, 0xEE, 0xEE, 0x10, 0xB9, 0x22, 0x22, 0x00,
+        0xB8, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x60, 0x00, 0x06, 0xC0, 0x00,
+        0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xEB, 0x20, 0x0A, 0xB1, 0x08, 0xC0,
+        0x2F, 0x20, 0x00, 0xE3, 0x4F, 0xDD, 0xDD, 0xE4, 0x2F, 0x10, 0x00, 0x00, 0x0A, 0xA2, 0x01, 0x50,
+        0x01, 0x8D, 0xED, 0x90, 0xBF, 0xFF, 0xFF, 0x40, 0xB9, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
+        0xB8, 0x00, 0x00, 0x00, 0xBF, 0xEE, 0xEE, 0x10, 0xB9, 0x22, 0x22, 0x00, 0xB8, 0x00, 0x00, 0x00,
+        0xB9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0xD0, 0x00,
+        0x00, 0x00, 0x9C, 0x50, 0x01, 0x9D, 0xEA, 0x10, 0x0A, 0xD2, 0x1A, 0x90, 0x2F, 0x50, 0x02, 0xF1,
+        0x4F, 0x10, 0x00, 0xE3, 0x2F, 0xDD, 0xDD, 0xE4, 0x0A, 0x61, 0x00, 0x20, 0x01, 0x8D, 0xEF, 0xA0,
+        0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x3D, 0xA0, 0x03, 0x40, 0x60, 0x00,
+        0x00, 0xAB, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0xB9, 0x00, 0x00, 0x00,
+        0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xBF, 0xEE, 0xEE, 0x10, 0xB9, 0x22, 0x22, 0x00,
+        0xB8, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x60, 0x00, 0x77, 0x3B, 0x00,
+        0x00, 0x0A, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xEB, 0x20, 0x0A, 0xB1, 0x08, 0xC0,
+        0x2F, 0x20, 0x00, 0xE3, 0x4F, 0xDD, 0xDD, 0xE4, 0x2F, 0x10, 0x00, 0x00, 0x0A, 0xA2, 0x01, 0x50,
+        0x01, 0x8D, 0xED, 0x90, 0x00, 0x00, 0x7E, 0x60, 0x00, 0x00, 0x03, 0xB1, 0xC2, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x3A, 0xEF, 0xDA, 0x30, 0x04, 0xF9, 0x31, 0x26, 0x90, 0x0D, 0x90, 0x00,
+        0x00, 0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x4F, 0x20, 0x05, 0xEE, 0xE0, 0x3F, 0x30, 0x00, 0x15,
+        0xF0, 0x0D, 0x90, 0x00, 0x04, 0xF0, 0x04, 0xF8, 0x21, 0x28, 0xF0, 0x00, 0x3A, 0xEF, 0xEA, 0x30,
+        0x00, 0x06, 0x40, 0x00, 0x00, 0x5A, 0xB3, 0x00, 0x00, 0x60, 0x16, 0x00, 0x02, 0xBE, 0xD6, 0xF1,
+        0x0C, 0x91, 0x1B, 0xF1, 0x2F, 0x10, 0x04, 0xF1, 0x4E, 0x00, 0x02, 0xF1, 0x2F, 0x10, 0x04, 0xF1,
+        0x0C, 0x91, 0x1B, 0xF1, 0x02, 0xBE, 0xD6, 0xF1, 0x00, 0x00, 0x04, 0xE0, 0x03, 0x20, 0x2C, 0x90,
+        0x04, 0xDE, 0xD9, 0x10, 0x00, 0x0C, 0x11, 0xC0, 0x00, 0x00, 0x04, 0xCC, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x3A, 0xEF, 0xDA, 0x30, 0x04, 0xF9, 0x31, 0x26, 0x90, 0x0D, 0x90, 0x00,
+        0x00, 0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x4F, 0x20, 0x05, 0xEE, 0xE0, 0x3F, 0x30, 0x00, 0x15,
+        0xF0, 0x0D, 0x90, 0x00, 0x04, 0xF0, 0x04, 0xF8, 0x21, 0x28, 0xF0, 0x00, 0x3A, 0xEF, 0xEA, 0x30,
+        0x00, 0x62, 0x17, 0x00, 0x00, 0x4B, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBE, 0xD6, 0xF1,
+        0x0C, 0x91, 0x1B, 0xF1, 0x2F, 0x10, 0x04, 0xF1, 0x4E, 0x00, 0x02, 0xF1, 0x2F, 0x10, 0x04, 0xF1,
+        0x0C, 0x91, 0x1B, 0xF1, 0x02, 0xBE, 0xD6, 0xF1, 0x00, 0x00, 0x04, 0xE0, 0x03, 0x20, 0x2C, 0x90,
+        0x04, 0xDE, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x00,
+        0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xEF, 0xDA, 0x30, 0x04, 0xF9, 0x31,
+        0x26, 0x90, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x4F, 0x20, 0x05, 0xEE,
+        0xE0, 0x3F, 0x30, 0x00, 0x15, 0xF0, 0x0D, 0x90, 0x00, 0x04, 0xF0, 0x04, 0xF8, 0x21, 0x28, 0xF0,
+        0x00, 0x3A, 0xEF, 0xEA, 0x30, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x02, 0xBE, 0xD6, 0xF1, 0x0C, 0x91, 0x1B, 0xF1, 0x2F, 0x10, 0x04, 0xF1, 0x4E, 0x00, 0x02,
+        0xF1, 0x2F, 0x10, 0x04, 0xF1, 0x0C, 0x91, 0x1B, 0xF1, 0x02, 0xBE, 0xD6, 0xF1, 0x00, 0x00, 0x04,
+        0xE0, 0x03, 0x20, 0x2C, 0x90, 0x04, 0xDE, 0xD9, 0x10, 0x00, 0x3A, 0xEF, 0xDA, 0x30, 0x04, 0xF9,
+        0x31, 0x26, 0x90, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x4F, 0x20, 0x05,
+        0xEE, 0xE0, 0x3F, 0x30, 0x00, 0x15, 0xF0, 0x0D, 0x90, 0x00, 0x04, 0xF0, 0x04, 0xF8, 0x21, 0x28,
+        0xF0, 0x00, 0x3A, 0xEF, 0xEA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x00,
+        0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x07, 0xA0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x02, 0xBE, 0xD6, 0xF1, 0x0C, 0x91, 0x1B, 0xF1, 0x2F, 0x10, 0x04, 0xF1, 0x4E, 0x00, 0x02,
+        0xF1, 0x2F, 0x10, 0x04, 0xF1, 0x0C, 0x91, 0x1B, 0xF1, 0x02, 0xBE, 0xD6, 0xF1, 0x00, 0x00, 0x04,
+        0xE0, 0x03, 0x20, 0x2C, 0x90, 0x04, 0xDE, 0xD9, 0x10, 0x00, 0x07, 0x50, 0x00, 0x00, 0x96, 0x96,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xC8, 0xB8, 0x00, 0x00, 0xC8, 0xB8, 0x00, 0x00,
+        0xC8, 0xB8, 0x00, 0x00, 0xC8, 0xBF, 0xEE, 0xEE, 0xF8, 0xB9, 0x22, 0x22, 0xC8, 0xB8, 0x00, 0x00,
+        0xC8, 0xB8, 0x00, 0x00, 0xC8, 0xB8, 0x00, 0x00, 0xC8, 0x01, 0x74, 0x00, 0x00, 0x00, 0x0A, 0x5A,
+        0x40, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x00,
+        0x00, 0x00, 0x00, 0xC7, 0xBE, 0xD4, 0x00, 0x00, 0xCD, 0x30, 0x8D, 0x00, 0x00, 0xC7, 0x00, 0x1F,
+        0x10, 0x00, 0xC5, 0x00, 0x0F, 0x20, 0x00, 0xC5, 0x00, 0x0F, 0x20, 0x00, 0xC5, 0x00, 0x0F, 0x20,
+        0x00, 0xC5, 0x00, 0x0F, 0x20, 0x0A, 0x90, 0x00, 0x0B, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xF9, 0x0A,
+        0x90, 0x00, 0x0B, 0x80, 0x0A, 0x90, 0x00, 0x0B, 0x80, 0x0A, 0xFE, 0xEE, 0xEF, 0x80, 0x0A, 0xA2,
+        0x22, 0x2B, 0x80, 0x0A, 0x90, 0x00, 0x0B, 0x80, 0x0A, 0x90, 0x00, 0x0B, 0x80, 0x0A, 0x90, 0x00,
+        0x0B, 0x80, 0x07, 0xB0, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x07, 0xB0, 0x00, 0x00, 0x07, 0xB8,
+        0xEE, 0x80, 0x07, 0xF7, 0x13, 0xE4, 0x07, 0xD0, 0x00, 0xB7, 0x07, 0xB0, 0x00, 0xA8, 0x07, 0xB0,
+        0x00, 0xA8, 0x07, 0xB0, 0x00, 0xA8, 0x07, 0xB0, 0x00, 0xA8, 0x09, 0xA1, 0xB0, 0x29, 0x2B, 0x70,
+        0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00,
+        0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x0B, 0xB1,
+        0xC0, 0x37, 0x3C, 0x60, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00,
+        0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0xDE, 0xEB, 0x00, 0x00,
+        0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80,
+        0x0B, 0x80, 0x1E, 0xEE, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6,
+        0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x06, 0x01, 0x60,
+        0x07, 0xCC, 0x50, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00,
+        0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8,
+        0x00, 0x1C, 0x14, 0xA0, 0x06, 0xCB, 0x20, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00,
+        0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0xB8,
+        0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8,
+        0x00, 0x75, 0x00, 0xC1, 0x00, 0x8C, 0x60, 0x0C, 0x60, 0x05, 0x20, 0x00, 0x00, 0x0C, 0x60, 0x0C,
+        0x60, 0x0C, 0x60, 0x0C, 0x60, 0x0C, 0x60, 0x0C, 0x60, 0x0C, 0x60, 0x0A, 0x20, 0x0D, 0x00, 0x0B,
+        0xC4, 0x00, 0xB9, 0x22, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xC6, 0xC6, 0xC6,
+        0xC6, 0xC6, 0xC6, 0xC6, 0xB8, 0x00, 0xD6, 0xB8, 0x00, 0xD6, 0xB8, 0x00, 0xD6, 0xB8, 0x00, 0xD6,
+        0xB8, 0x00, 0xD6, 0xB8, 0x00, 0xD6, 0xB8, 0x00, 0xD6, 0xB8, 0x00, 0xD6, 0xB8, 0x00, 0xD6, 0x00,
+        0x00, 0xE5, 0x00, 0x16, 0xF2, 0x00, 0xDD, 0x60, 0xC6, 0x03, 0xF0, 0x52, 0x01, 0x60, 0x00, 0x00,
+        0x00, 0xC6, 0x03, 0xF0, 0xC6, 0x03, 0xF0, 0xC6, 0x03, 0xF0, 0xC6, 0x03, 0xF0, 0xC6, 0x03, 0xF0,
+        0xC6, 0x03, 0xF0, 0xC6, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x06, 0xD0, 0x00, 0x9D, 0x40, 0x03,
+        0xCC, 0x10, 0x06, 0x12, 0x50, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8,
+        0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00,
+        0x00, 0xC7, 0x00, 0x04, 0xF4, 0x00, 0xAD, 0x80, 0x00, 0x00, 0x64, 0x00, 0x07, 0x9C, 0x20, 0x06,
+        0x02, 0x50, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6,
+        0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0x00, 0x01, 0xE3, 0x00, 0x3E, 0x90, 0x00,
+        0xB8, 0x00, 0x1B, 0xC1, 0xB8, 0x01, 0xCB, 0x10, 0xB8, 0x2D, 0xA0, 0x00, 0xBB, 0xE8, 0x00, 0x00,
+        0xBE, 0xE3, 0x00, 0x00, 0xB9, 0x8E, 0x30, 0x00, 0xB8, 0x08, 0xE3, 0x00, 0xB8, 0x00, 0x7E, 0x40,
+        0xB8, 0x00, 0x06, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xA0, 0x00, 0x00, 0x0B, 0x20, 0x00,
+        0xC5, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC5, 0x01, 0xAB, 0x10,
+        0xC5, 0x1C, 0x90, 0x00, 0xC8, 0xD7, 0x00, 0x00, 0xCE, 0xC1, 0x00, 0x00, 0xC6, 0xAC, 0x10, 0x00,
+        0xC5, 0x09, 0xC1, 0x00, 0xC5, 0x00, 0x8D, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x10, 0x00,
+        0x00, 0x77, 0x00, 0x00, 0xC5, 0x01, 0xAB, 0x10, 0xC5, 0x1C, 0x90, 0x00, 0xC8, 0xD7, 0x00, 0x00,
+        0xCE, 0xC1, 0x00, 0x00, 0xC6, 0xAC, 0x10, 0x00, 0xC5, 0x09, 0xC1, 0x00, 0xC5, 0x00, 0x8D, 0x20,
+        0x04, 0x50, 0x00, 0x00, 0x3C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
+        0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
+        0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x30,
+        0x05, 0x40, 0x4B, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00,
+        0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
+        0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
+        0xB8, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x5D, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x0C, 0x60, 0x0C, 0x60, 0x0C, 0x60, 0x0C, 0x60,
+        0x0C, 0x60, 0x0C, 0x60, 0x0C, 0x60, 0x0C, 0x60, 0x0C, 0x60, 0x0C, 0x60, 0x00, 0x00, 0x0B, 0x70,
+        0x1D, 0x00, 0xB8, 0x0D, 0x50, 0x00, 0xB8, 0x1E, 0x10, 0x00, 0xB8, 0x14, 0x00, 0x00, 0xB8, 0x00,
+        0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB9, 0x00,
+        0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x30, 0xC6, 0x7B, 0xC6, 0xA6, 0xC6, 0x41, 0xC6, 0x00, 0xC6, 0x00,
+        0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00,
+        0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x01, 0xF4, 0x00, 0xB8, 0x00, 0x82, 0x00, 0xB8, 0x00,
+        0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x30, 0xC6, 0x00,
+        0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xCA, 0xF1, 0xC8, 0x81, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00,
+        0xC6, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x06, 0x00,
+        0x00, 0x00, 0xAC, 0xC7, 0x00, 0x00, 0x00, 0xBD, 0x20, 0x00, 0x00, 0x0B, 0xD9, 0x00, 0x00, 0x00,
+        0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x40, 0x0B,
+        0x70, 0x0B, 0x70, 0x0B, 0x70, 0x0B, 0x95, 0x0C, 0xC2, 0xAE, 0x70, 0x1B, 0x70, 0x0B, 0x70, 0x0B,
+        0x70, 0x0B, 0x70, 0x00, 0x03, 0x60, 0x00, 0x00, 0x1C, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+        0x40, 0x00, 0xC7, 0xBE, 0xC0, 0x00, 0xC7, 0xB8, 0xD6, 0x00, 0xC7, 0xB8, 0x5E, 0x10, 0xC7, 0xB8,
+        0x0C, 0x80, 0xC7, 0xB8, 0x04, 0xE2, 0xC7, 0xB8, 0x00, 0xA9, 0xC7, 0xB8, 0x00, 0x2F, 0xE7, 0xB8,
+        0x00, 0x08, 0xF7, 0x00, 0x1C, 0x50, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8,
+        0xBC, 0xC4, 0x00, 0xCD, 0x10, 0x6D, 0x00, 0xC7, 0x00, 0x1F, 0x10, 0xC5, 0x00, 0x0F, 0x20, 0xC5,
+        0x00, 0x0F, 0x20, 0xC5, 0x00, 0x0F, 0x20, 0xC5, 0x00, 0x0F, 0x20, 0xBF, 0x40, 0x00, 0xC7, 0xBE,
+        0xC0, 0x00, 0xC7, 0xB8, 0xD6, 0x00, 0xC7, 0xB8, 0x5E, 0x10, 0xC7, 0xB8, 0x0C, 0x80, 0xC7, 0xB8,
+        0x04, 0xE2, 0xC7, 0xB8, 0x00, 0xA9, 0xC7, 0xB8, 0x00, 0x2F, 0xE7, 0xB8, 0x00, 0x08, 0xF7, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x0C, 0x10, 0x00, 0xC8, 0xBC, 0xC4, 0x00, 0xCD,
+        0x10, 0x6D, 0x00, 0xC7, 0x00, 0x1F, 0x10, 0xC5, 0x00, 0x0F, 0x20, 0xC5, 0x00, 0x0F, 0x20, 0xC5,
+        0x00, 0x0F, 0x20, 0xC5, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00,
+        0x94, 0x00, 0x00, 0x00, 0x61, 0x34, 0x00, 0x00, 0x4C, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+        0x40, 0x00, 0xC7, 0xBE, 0xC0, 0x00, 0xC7, 0xB8, 0xD6, 0x00, 0xC7, 0xB8, 0x5E, 0x10, 0xC7, 0xB8,
+        0x0C, 0x80, 0xC7, 0xB8, 0x04, 0xE2, 0xC7, 0xB8, 0x00, 0xA9, 0xC7, 0xB8, 0x00, 0x2F, 0xE7, 0xB8,
+        0x00, 0x08, 0xF7, 0x08, 0x63, 0xB0, 0x00, 0x00, 0xBD, 0x20, 0x00, 0x00, 0x12, 0x00, 0x00, 0xC8,
+        0xBC, 0xC4, 0x00, 0xCD, 0x10, 0x6D, 0x00, 0xC7, 0x00, 0x1F, 0x10, 0xC5, 0x00, 0x0F, 0x20, 0xC5,
+        0x00, 0x0F, 0x20, 0xC5, 0x00, 0x0F, 0x20, 0xC5, 0x00, 0x0F, 0x20, 0x3F, 0x20, 0x00, 0x00, 0x00,
+        0x5C, 0x00, 0x00, 0x00, 0x00, 0x84, 0xA9, 0xAC, 0xD5, 0x00, 0x00, 0xAE, 0x20, 0x3E, 0x10, 0x00,
+        0xA9, 0x00, 0x0E, 0x40, 0x00, 0xA8, 0x00, 0x0D, 0x40, 0x00, 0xA8, 0x00, 0x0D, 0x40, 0x00, 0xA8,
+        0x00, 0x0D, 0x40, 0x00, 0xA8, 0x00, 0x0D, 0x40, 0xB8, 0x7D, 0xEB, 0x20, 0xBE, 0x92, 0x2B, 0xC0,
+        0xBD, 0x00, 0x02, 0xF2, 0xB9, 0x00, 0x00, 0xF4, 0xB8, 0x00, 0x00, 0xF4, 0xB8, 0x00, 0x00, 0xF4,
+        0xB8, 0x00, 0x00, 0xF4, 0xB8, 0x00, 0x00, 0xF4, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4,
+        0x00, 0x00, 0x03, 0xF2, 0x00, 0x00, 0x6E, 0x80, 0xC8, 0xBC, 0xC3, 0x00, 0xCD, 0x10, 0x6D, 0x00,
+        0xC7, 0x00, 0x1F, 0x10, 0xC5, 0x00, 0x0F, 0x20, 0xC5, 0x00, 0x0F, 0x20, 0xC5, 0x00, 0x0F, 0x20,
+        0xC5, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x9E, 0xE6, 0x00,
+        0x00, 0x0B, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xEF, 0xC5, 0x00, 0x04,
+        0xF8, 0x21, 0x6E, 0x70, 0x0D, 0x90, 0x00, 0x06, 0xF2, 0x2F, 0x30, 0x00, 0x00, 0xF6, 0x4F, 0x20,
+        0x00, 0x00, 0xD7, 0x2F, 0x30, 0x00, 0x00, 0xF6, 0x0D, 0x90, 0x00, 0x05, 0xF2, 0x05, 0xF8, 0x21,
+        0x5E, 0x80, 0x00, 0x4B, 0xEF, 0xC6, 0x00, 0x00, 0xDE, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0xAE, 0xE9, 0x10, 0x0B, 0xA1, 0x1B, 0xB0, 0x2F, 0x20, 0x03, 0xF1, 0x4F, 0x00, 0x00, 0xF3, 0x2F,
+        0x20, 0x02, 0xF1, 0x0B, 0xA1, 0x1B, 0xB0, 0x01, 0xAE, 0xEA, 0x10, 0x00, 0x0B, 0x20, 0xC0, 0x00,
+        0x00, 0x03, 0xBC, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xEF, 0xC5, 0x00, 0x04,
+        0xF8, 0x21, 0x6E, 0x70, 0x0D, 0x90, 0x00, 0x06, 0xF2, 0x2F, 0x30, 0x00, 0x00, 0xF6, 0x4F, 0x20,
+        0x00, 0x00, 0xD7, 0x2F, 0x30, 0x00, 0x00, 0xF6, 0x0D, 0x90, 0x00, 0x05, 0xF2, 0x05, 0xF8, 0x21,
+        0x5E, 0x80, 0x00, 0x4B, 0xEF, 0xC6, 0x00, 0x00, 0xC2, 0x2C, 0x00, 0x00, 0x4B, 0xB4, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0xAE, 0xE9, 0x10, 0x0B, 0xA1, 0x1B, 0xB0, 0x2F, 0x20, 0x03, 0xF1, 0x4F,
+        0x00, 0x00, 0xF3, 0x2F, 0x20, 0x02, 0xF1, 0x0B, 0xA1, 0x1B, 0xB0, 0x01, 0xAE, 0xEA, 0x10, 0x00,
+        0x00, 0x64, 0x55, 0x00, 0x00, 0x04, 0xB3, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B,
+        0xEF, 0xC5, 0x00, 0x04, 0xF8, 0x21, 0x6E, 0x70, 0x0D, 0x90, 0x00, 0x06, 0xF2, 0x2F, 0x30, 0x00,
+        0x00, 0xF6, 0x4F, 0x20, 0x00, 0x00, 0xD7, 0x2F, 0x30, 0x00, 0x00, 0xF6, 0x0D, 0x90, 0x00, 0x05,
+        0xF2, 0x05, 0xF8, 0x21, 0x5E, 0x80, 0x00, 0x4B, 0xEF, 0xC6, 0x00, 0x00, 0x01, 0x31, 0x40, 0x00,
+        0x0A, 0x59, 0x70, 0x00, 0x3B, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAE, 0xE9, 0x10, 0x0B,
+        0xA1, 0x1B, 0xB0, 0x2F, 0x20, 0x03, 0xF1, 0x4F, 0x00, 0x00, 0xF3, 0x2F, 0x20, 0x02, 0xF1, 0x0B,
+        0xA1, 0x1B, 0xB0, 0x01, 0xAE, 0xEA, 0x10, 0x00, 0x28, 0xCE, 0xFF, 0xFF, 0xFF, 0xF0, 0x04, 0xEA,
+        0x31, 0x1F, 0x40, 0x00, 0x00, 0x0D, 0x90, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x0F,
+        0x40, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x0F, 0xEE, 0xEE, 0xB0, 0x2F, 0x30, 0x00, 0x0F, 0x52, 0x22,
+        0x10, 0x0D, 0x90, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x04, 0xEA, 0x31, 0x1F, 0x40, 0x00, 0x00, 0x00,
+        0x29, 0xDE, 0xFF, 0xFF, 0xFF, 0xF1, 0x01, 0xAE, 0xE9, 0x16, 0xDE, 0xC4, 0x00, 0x0B, 0xA1, 0x1B,
+        0xDD, 0x30, 0x4E, 0x20, 0x2F, 0x20, 0x03, 0xF6, 0x00, 0x0A, 0x70, 0x4F, 0x00, 0x00, 0xFD, 0xDD,
+        0xDD, 0x80, 0x2F, 0x20, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x0B, 0xA1, 0x1B, 0xED, 0x30, 0x03, 0x20,
+        0x01, 0xAE, 0xEA, 0x16, 0xDE, 0xEB, 0x30, 0x00, 0x05, 0x40, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0xFE, 0xC5, 0x00, 0xB9, 0x01, 0x7F, 0x20, 0xB8, 0x00, 0x0F, 0x50, 0xB8,
+        0x00, 0x5F, 0x30, 0xBE, 0xEE, 0xF6, 0x00, 0xB9, 0x13, 0xBA, 0x00, 0xB8, 0x00, 0x1E, 0x50, 0xB8,
+        0x00, 0x07, 0xD0, 0xB8, 0x00, 0x01, 0xE6, 0x00, 0x1C, 0x50, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00,
+        0xC8, 0xBD, 0x50, 0xCD, 0x10, 0x00, 0xC7, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5,
+        0x00, 0x00, 0xC5, 0x00, 0x00, 0xBF, 0xFE, 0xC5, 0x00, 0xB9, 0x01, 0x7F, 0x20, 0xB8, 0x00, 0x0F,
+        0x50, 0xB8, 0x00, 0x5F, 0x30, 0xBE, 0xEE, 0xF6, 0x00, 0xB9, 0x13, 0xBA, 0x00, 0xB8, 0x00, 0x1E,
+        0x50, 0xB8, 0x00, 0x07, 0xD0, 0xB8, 0x00, 0x01, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x90,
+        0x00, 0x00, 0x0C, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x8B, 0xD5, 0x0C, 0xD1, 0x00, 0x0C, 0x70,
+        0x00, 0x0C, 0x50, 0x00, 0x0C, 0x50, 0x00, 0x0C, 0x50, 0x00, 0x0C, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0x0C, 0x60, 0x00, 0x1C, 0x00, 0x00, 0x05, 0x21, 0x60, 0x00, 0x02, 0xCC, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xBF, 0xFE, 0xC5, 0x00, 0xB9, 0x01, 0x7F, 0x20, 0xB8, 0x00, 0x0F, 0x50, 0xB8, 0x00,
+        0x5F, 0x30, 0xBE, 0xEE, 0xF6, 0x00, 0xB9, 0x13, 0xBA, 0x00, 0xB8, 0x00, 0x1E, 0x50, 0xB8, 0x00,
+        0x07, 0xD0, 0xB8, 0x00, 0x01, 0xE6, 0x49, 0x0B, 0x20, 0x0A, 0xB8, 0x00, 0x02, 0x70, 0x00, 0xC8,
+        0xBD, 0x50, 0xCD, 0x10, 0x00, 0xC7, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00,
+        0x00, 0xC5, 0x00, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0xAE, 0xFD, 0x90, 0x0D, 0x92, 0x02, 0x70, 0x1F, 0x30, 0x00, 0x00, 0x0C, 0xB5, 0x20, 0x00,
+        0x01, 0x8C, 0xFD, 0x60, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0xD7, 0x18, 0x31, 0x16, 0xF4,
+        0x19, 0xDE, 0xEC, 0x50, 0x00, 0x01, 0xC5, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x06, 0xDE, 0xE8, 0x00, 0x2F, 0x20, 0x13, 0x00, 0x2F, 0x51, 0x00, 0x00, 0x05, 0xBE, 0xC4, 0x00,
+        0x00, 0x00, 0x6F, 0x10, 0x24, 0x00, 0x5F, 0x10, 0x3C, 0xEE, 0xC4, 0x00, 0x00, 0x0B, 0xD2, 0x00,
+        0x00, 0x68, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAE, 0xFD, 0x90, 0x0D, 0x92, 0x02, 0x70,
+        0x1F, 0x30, 0x00, 0x00, 0x0C, 0xB5, 0x20, 0x00, 0x01, 0x8C, 0xFD, 0x60, 0x00, 0x00, 0x06, 0xF4,
+        0x00, 0x00, 0x00, 0xD7, 0x18, 0x31, 0x16, 0xF4, 0x19, 0xDE, 0xEC, 0x50, 0x00, 0x6E, 0x50, 0x00,
+        0x03, 0xB1, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xDE, 0xE8, 0x00, 0x2F, 0x20, 0x13, 0x00,
+        0x2F, 0x51, 0x00, 0x00, 0x05, 0xBE, 0xC4, 0x00, 0x00, 0x00, 0x6F, 0x10, 0x24, 0x00, 0x5F, 0x10,
+        0x3C, 0xEE, 0xC4, 0x00, 0x02, 0xAE, 0xFD, 0x90, 0x0D, 0x92, 0x02, 0x70, 0x1F, 0x30, 0x00, 0x00,
+        0x0C, 0xB5, 0x20, 0x00, 0x01, 0x8C, 0xFD, 0x60, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0xD7,
+        0x18, 0x31, 0x16, 0xF4, 0x19, 0xDF, 0xFC, 0x50, 0x00, 0x00, 0xB1, 0x00, 0x00, 0x00, 0x95, 0x00,
+        0x00, 0x3C, 0xC2, 0x00, 0x06, 0xDE, 0xE8, 0x00, 0x2F, 0x20, 0x13, 0x00, 0x2F, 0x51, 0x00, 0x00,
+        0x05, 0xBE, 0xC4, 0x00, 0x00, 0x00, 0x6F, 0x10, 0x24, 0x00, 0x5F, 0x10, 0x3C, 0xEF, 0xC4, 0x00,
+        0x00, 0x08, 0x40, 0x00, 0x00, 0x05, 0x90, 0x00, 0x00, 0xCD, 0x40, 0x00, 0x00, 0x77, 0x3B, 0x00,
+        0x00, 0x0C, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAE, 0xFD, 0x90, 0x0D, 0x92, 0x02, 0x70,
+        0x1F, 0x30, 0x00, 0x00, 0x0C, 0xB5, 0x20, 0x00, 0x01, 0x8C, 0xFD, 0x60, 0x00, 0x00, 0x06, 0xF4,
+        0x00, 0x00, 0x00, 0xD7, 0x18, 0x31, 0x16, 0xF4, 0x19, 0xDE, 0xEC, 0x50, 0x02, 0xB1, 0xB3, 0x00,
+        0x00, 0x5E, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xDE, 0xE8, 0x00, 0x2F, 0x20, 0x13, 0x00,
+        0x2F, 0x51, 0x00, 0x00, 0x05, 0xBE, 0xC4, 0x00, 0x00, 0x00, 0x6F, 0x10, 0x24, 0x00, 0x5F, 0x10,
+        0x3C, 0xEE, 0xC4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00,
+        0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9,
+        0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00,
+        0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x08, 0xC9, 0x00, 0x00,
+        0x0C, 0x60, 0x00, 0x8F, 0xED, 0xA0, 0x0C, 0x60, 0x00, 0x0C, 0x60, 0x00, 0x0C, 0x60, 0x00, 0x0C,
+        0x60, 0x00, 0x0A, 0x80, 0x00, 0x03, 0xDE, 0xB0, 0x00, 0x0B, 0x00, 0x00, 0x0A, 0x30, 0x04, 0xCC,
+        0x10, 0x00, 0x05, 0x12, 0x50, 0x00, 0x00, 0x02, 0xCC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00,
+        0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00,
+        0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x02, 0x40,
+        0x00, 0x08, 0x90, 0x0B, 0x5B, 0x40, 0x0C, 0x60, 0x00, 0x8F, 0xED, 0xA0, 0x0C, 0x60, 0x00, 0x0C,
+        0x60, 0x00, 0x0C, 0x60, 0x00, 0x0C, 0x60, 0x00, 0x0A, 0x80, 0x00, 0x03, 0xDE, 0xB0, 0x0F, 0xFF,
+        0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9,
+        0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE4, 0x00, 0x00, 0x12, 0xBA, 0x20, 0x00, 0x00, 0x00, 0xA9, 0x00,
+        0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x0C, 0x60, 0x00, 0x0C, 0x60,
+        0x00, 0x8F, 0xED, 0xA0, 0x0C, 0x60, 0x00, 0x9F, 0xED, 0xA0, 0x0C, 0x60, 0x00, 0x0C, 0x60, 0x00,
+        0x0A, 0x80, 0x00, 0x03, 0xCE, 0xB0, 0x01, 0xA9, 0x1A, 0x00, 0x04, 0x74, 0xB5, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00,
+        0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD7, 0x00, 0x00, 0xE6, 0xB9, 0x00, 0x01, 0xF4, 0x5E, 0x41,
+        0x2A, 0xD0, 0x06, 0xCE, 0xEA, 0x20, 0x09, 0xC3, 0xA2, 0x00, 0x0B, 0x1B, 0x90, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00,
+        0x2F, 0x10, 0xD4, 0x00, 0x3F, 0x10, 0xA9, 0x00, 0xAF, 0x10, 0x2B, 0xCB, 0x7F, 0x10, 0x02, 0xEE,
+        0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00,
+        0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD7, 0x00, 0x00, 0xE6, 0xB9, 0x00,
+        0x01, 0xF4, 0x5E, 0x41, 0x2A, 0xD0, 0x06, 0xCE, 0xEA, 0x20, 0x0B, 0xEE, 0xD0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00,
+        0x2F, 0x10, 0xD4, 0x00, 0x3F, 0x10, 0xA9, 0x00, 0xAF, 0x10, 0x2B, 0xCB, 0x7F, 0x10, 0x02, 0xB0,
+        0x49, 0x00, 0x00, 0x7C, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00,
+        0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD7, 0x00,
+        0x00, 0xE6, 0xB9, 0x00, 0x01, 0xF4, 0x5E, 0x41, 0x2A, 0xD0, 0x06, 0xCE, 0xEA, 0x20, 0x0B, 0x32,
+        0xC0, 0x00, 0x03, 0xBC, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00,
+        0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x3F, 0x10, 0xA9, 0x00,
+        0xAF, 0x10, 0x2B, 0xCB, 0x7F, 0x10, 0x00, 0x4B, 0x90, 0x00, 0x00, 0xC1, 0x66, 0x00, 0x00, 0xC2,
+        0x76, 0x00, 0xD6, 0x4C, 0x90, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00,
+        0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD7, 0x00, 0x00, 0xE6, 0xB9, 0x00, 0x01, 0xF4, 0x5E, 0x41,
+        0x2A, 0xD0, 0x06, 0xCE, 0xEA, 0x20, 0x02, 0xBB, 0x20, 0x00, 0x09, 0x32, 0xA0, 0x00, 0x09, 0x32,
+        0xA0, 0x00, 0x02, 0xBB, 0x20, 0x00, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00,
+        0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x3F, 0x10, 0xA9, 0x00, 0xAF, 0x10, 0x2B, 0xCB,
+        0x7F, 0x10, 0x00, 0x18, 0x18, 0x20, 0x00, 0xA6, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x00,
+        0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00,
+        0x00, 0xE6, 0xD7, 0x00, 0x00, 0xE6, 0xB9, 0x00, 0x01, 0xF4, 0x5E, 0x41, 0x2A, 0xD0, 0x06, 0xCE,
+        0xEA, 0x20, 0x00, 0x69, 0x5B, 0x00, 0x01, 0xC1, 0xC2, 0x00, 0x01, 0x31, 0x30, 0x00, 0xD4, 0x00,
+        0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00,
+        0x3F, 0x10, 0xA9, 0x00, 0xAF, 0x10, 0x2B, 0xCB, 0x7F, 0x10, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00,
+        0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD6, 0x00, 0x00, 0xE6, 0xD7, 0x00,
+        0x00, 0xE6, 0xB9, 0x00, 0x01, 0xF4, 0x5E, 0x41, 0x2A, 0xD0, 0x06, 0xCF, 0xEA, 0x20, 0x00, 0x1B,
+        0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x1C, 0xC1, 0x00, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00,
+        0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x2F, 0x10, 0xD4, 0x00, 0x3F, 0x10, 0xA9, 0x00,
+        0xAF, 0x10, 0x2B, 0xCB, 0x7F, 0x10, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+        0x2D, 0xB0, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x4B, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x06, 0xF4, 0x00, 0x1F, 0x40, 0x3F, 0x20,
+        0x0A, 0xC8, 0x00, 0x4F, 0x10, 0x0E, 0x60, 0x0E, 0x5C, 0x00, 0x8B, 0x00, 0x0A, 0xA0, 0x3D, 0x0E,
+        0x10, 0xC7, 0x00, 0x06, 0xE0, 0x79, 0x0B, 0x51, 0xF3, 0x00, 0x02, 0xF2, 0xB5, 0x07, 0x95, 0xE0,
+        0x00, 0x00, 0xD7, 0xE1, 0x03, 0xD9, 0xB0, 0x00, 0x00, 0x9E, 0xC0, 0x00, 0xEE, 0x70, 0x00, 0x00,
+        0x5F, 0x80, 0x00, 0xAF, 0x30, 0x00, 0x00, 0x00, 0x8D, 0x30, 0x00, 0x00, 0x00, 0x05, 0x92, 0xB1,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x00, 0x8F, 0x20, 0x3E, 0x00, 0x1F, 0x20,
+        0xCD, 0x60, 0x7A, 0x00, 0x0C, 0x61, 0xE6, 0xA0, 0xB6, 0x00, 0x08, 0xA5, 0xB1, 0xE1, 0xF2, 0x00,
+        0x04, 0xE9, 0x70, 0xC7, 0xD0, 0x00, 0x00, 0xEE, 0x30, 0x8E, 0x90, 0x00, 0x00, 0xBE, 0x00, 0x4F,
+        0x50, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x08, 0x78, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0xB0, 0x00, 0x0B, 0x90, 0x01, 0xD6, 0x00, 0x7D, 0x10, 0x00, 0x4E, 0x23, 0xE3, 0x00,
+        0x00, 0x08, 0xCD, 0x70, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00,
+        0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x06,
+        0x40, 0x00, 0x00, 0x69, 0xC2, 0x00, 0x00, 0x60, 0x25, 0x00, 0x6C, 0x00, 0x02, 0xF2, 0x1E, 0x30,
+        0x08, 0xB0, 0x09, 0x90, 0x0D, 0x50, 0x03, 0xE1, 0x5E, 0x00, 0x00, 0xC6, 0xA8, 0x00, 0x00, 0x6C,
+        0xF2, 0x00, 0x00, 0x1E, 0xB0, 0x00, 0x00, 0x0D, 0x50, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x0E, 0xE4,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x66, 0xD0, 0x00, 0x00, 0x03, 0x11, 0x30,
+        0x00, 0x0A, 0xB0, 0x00, 0x0B, 0x90, 0x01, 0xD6, 0x00, 0x7D, 0x10, 0x00, 0x4E, 0x23, 0xE3, 0x00,
+        0x00, 0x08, 0xCD, 0x70, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00,
+        0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00,
+        0x54, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+        0xFF, 0x30, 0x00, 0x00, 0x01, 0xCA, 0x00, 0x00, 0x00, 0x0A, 0xC1, 0x00, 0x00, 0x00, 0x8D, 0x20,
+        0x00, 0x00, 0x06, 0xE3, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x02, 0xE7, 0x00, 0x00, 0x00,
+        0x1D, 0x90, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x01, 0xC5, 0x00, 0x00, 0x0B,
+        0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xDD, 0xEF, 0x40, 0x00, 0x00, 0x9C, 0x10, 0x00, 0x07,
+        0xD1, 0x00, 0x00, 0x5E, 0x30, 0x00, 0x03, 0xE4, 0x00, 0x00, 0x2E, 0x60, 0x00, 0x00, 0x7F, 0xDD,
+        0xDD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF2, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00,
+        0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x01, 0xCA, 0x00, 0x00, 0x00, 0x0A, 0xC1, 0x00,
+        0x00, 0x00, 0x8D, 0x20, 0x00, 0x00, 0x06, 0xE3, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x02,
+        0xE7, 0x00, 0x00, 0x00, 0x1D, 0x90, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x3F,
+        0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xDD, 0xEF, 0x40, 0x00, 0x00,
+        0x9C, 0x10, 0x00, 0x07, 0xD1, 0x00, 0x00, 0x5E, 0x30, 0x00, 0x03, 0xE4, 0x00, 0x00, 0x2E, 0x60,
+        0x00, 0x00, 0x7F, 0xDD, 0xDD, 0x40, 0x00, 0x25, 0x06, 0x10, 0x00, 0x00, 0x09, 0xB7, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x01, 0xCA, 0x00, 0x00,
+        0x00, 0x0A, 0xC1, 0x00, 0x00, 0x00, 0x8D, 0x20, 0x00, 0x00, 0x06, 0xE3, 0x00, 0x00, 0x00, 0x4F,
+        0x40, 0x00, 0x00, 0x02, 0xE7, 0x00, 0x00, 0x00, 0x1D, 0x90, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
+        0xFF, 0x50, 0x04, 0x90, 0xB2, 0x00, 0x00, 0xAB, 0x80, 0x00, 0x00, 0x27, 0x00, 0x00, 0x4D, 0xDD,
+        0xEF, 0x40, 0x00, 0x00, 0x9C, 0x10, 0x00, 0x07, 0xD1, 0x00, 0x00, 0x5E, 0x30, 0x00, 0x03, 0xE4,
+        0x00, 0x00, 0x2E, 0x60, 0x00, 0x00, 0x7F, 0xDD, 0xDD, 0x40, 0x01, 0xBE, 0xC0, 0x07, 0xB0, 0x00,
+        0x08, 0x90, 0x00, 0x9E, 0x90, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0x09,
+        0x90, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0x5D, 0xDD, 0xDB, 0x5D, 0xDD, 0xDD, 0xDD, 0xDD,
+        0xDD, 0x50, 0x2C, 0xA8, 0xD7, 0x5F, 0x8A, 0xA2, 0x2C, 0x08, 0x60, 0xA8, 0x1E, 0x20, 0xD7, 0x4F,
+        0x10, 0x6F, 0x0C, 0x80, 0x7B, 0x0D, 0x50, 0xB3, 0x2C, 0x00, 0x47, 0x00, 0x18, 0x10, 0x07, 0x40,
+        0x8D, 0x00, 0x3F, 0x30, 0x0D, 0x80,
+};
+
+static const FontGlyph glyphs[] = {
+        {0x0020, 0, 0, 0, 0, 4, 0},
+        {0x0021, 3, 9, 1, 9, 5, 0},
+        {0x0022, 4, 4, 1, 9, 6, 18},
+        {0x0023, 9, 9, 1, 9, 11, 26},
+        {0x0024, 7, 12, 1, 10, 8, 71},
+        {0x0025, 12, 9, 0, 9, 12, 119},
+        {0x0026, 10, 9, 0, 9, 10, 173},
+        {0x0027, 2, 4, 1, 9, 4, 218},
+        {0x0028, 4, 11, 1, 10, 5, 222},
+        {0x0029, 3, 11, 1, 10, 5, 244},
+        {0x002A, 7, 6, 0, 9, 7, 266},
+        {0x002B, 9, 8, 1, 8, 11, 290},
+        {0x002C, 2, 3, 1, 2, 4, 330},
+        {0x002D, 5, 1, 0, 4, 5, 333},
+        {0x002E, 2, 2, 1, 2, 4, 336},
+        {0x002F, 5, 11, 0, 9, 4, 338},
+        {0x0030, 8, 9, 0, 9, 8, 371},
+        {0x0031, 7, 9, 1, 9, 8, 407},
+        {0x0032, 7, 9, 0, 9, 8, 443},
+        {0x0033, 8, 9, 0, 9, 8, 479},
+        {0x0034, 8, 9, 0, 9, 8, 515},
+        {0x0035, 7, 9, 1, 9, 8, 551},
+        {0x0036, 8, 9, 0, 9, 8, 587},
+        {0x0037, 7, 9, 1, 9, 8, 623},
+        {0x0038, 8, 9, 0, 9, 8, 659},
+        {0x0039, 8, 9, 0, 9, 8, 695},
+        {0x003A, 2, 7, 1, 7, 4, 731},
+        {0x003B, 2, 8, 1, 7, 4, 738},
+        {0x003C, 9, 8, 1, 8, 11, 746},
+        {0x003D, 9, 5, 1, 6, 11, 786},
+        {0x003E, 9, 8, 1, 8, 11, 811},
+        {0x003F, 6, 9, 0, 9, 7, 851},
+        {0x0040, 13, 11, 0, 9, 13, 878},
+        {0x0041, 9, 9, 0, 9, 9, 955},
+        {0x0042, 7, 9, 1, 9, 9, 1000},
+        {0x0043, 9, 9, 0, 9, 9, 1036},
+        {0x0044, 9, 9, 1, 9, 10, 1081},
+        {0x0045, 7, 9, 1, 9, 8, 1126},
+        {0x0046, 6, 9, 1, 9, 7, 1162},
+        {0x0047, 9, 9, 0, 9, 10, 1189},
+        {0x0048, 8, 9, 1, 9, 10, 1234},
+        {0x0049, 2, 9, 1, 9, 4, 1270},
+        {0x004A, 4, 12, -1, 9, 4, 1279},
+        {0x004B, 8, 9, 1, 9, 9, 1303},
+        {0x004C, 7, 9, 1, 9, 7, 1339},
+        {0x004D, 9, 9, 1, 9, 11, 1375},
+        {0x004E, 8, 9, 1, 9, 10, 1420},
+        {0x004F, 10, 9, 0, 9, 10, 1456},
+        {0x0050, 7, 9, 1, 9, 8, 1501},
+        {0x0051, 10, 11, 0, 9, 10, 1537},
+        {0x0052, 8, 9, 1, 9, 9, 1592},
+        {0x0053, 8, 9, 0, 9, 8, 1628},
+        {0x0054, 9, 9, -1, 9, 8, 1664},
+        {0x0055, 8, 9, 1, 9, 10, 1709},
+        {0x0056, 9, 9, 0, 9, 9, 1745},
+        {0x0057, 13, 9, 0, 9, 13, 1790},
+        {0x0058, 9, 9, 0, 9, 9, 1853},
+        {0x0059, 9, 9, -1, 9, 8, 1898},
+        {0x005A, 9, 9, 0, 9, 9, 1943},
+        {0x005B, 3, 11, 1, 10, 5, 1988},
+        {0x005C, 5, 11, 0, 9, 4, 2010},
+        {0x005D, 3, 11, 1, 10, 5, 2043},
+        {0x005E, 9, 4, 1, 10, 11, 2065},
+        {0x005F, 8, 1, -1, -2, 7, 2085},
+        {0x0060, 4, 3, 1, 11, 7, 2089},
+        {0x0061, 7, 7, 0, 7, 8, 2095},
+        {0x0062, 7, 10, 1, 10, 8, 2123},
+        {0x0063, 7, 7, 0, 7, 7, 2163},
+        {0x0064, 8, 10, 0, 10, 8, 2191},
+        {0x0065, 8, 7, 0, 7, 8, 2231},
+        {0x0066, 5, 10, 0, 10, 5, 2259},
+        {0x0067, 8, 10, 0, 7, 8, 2289},
+        {0x0068, 7, 10, 1, 10, 8, 2329},
+        {0x0069, 2, 10, 1, 10, 4, 2369},
+        {0x006A, 4, 13, -1, 10, 4, 2379},
+        {0x006B, 7, 10, 1, 10, 8, 2405},
+        {0x006C, 2, 10, 1, 10, 4, 2445},
+        {0x006D, 11, 7, 1, 7, 13, 2455},
+        {0x006E, 7, 7, 1, 7, 8, 2497},
+        {0x006F, 8, 7, 0, 7, 8, 2525},
+        {0x0070, 7, 10, 1, 7, 8, 2553},
+        {0x0071, 8, 10, 0, 7, 8, 2593},
+        {0x0072, 5, 8, 1, 8, 5, 2633},
+        {0x0073, 7, 7, 0, 7, 7, 2657},
+        {0x0074, 5, 9, 0, 9, 5, 2685},
+        {0x0075, 7, 7, 1, 7, 8, 2712},
+        {0x0076, 8, 7, 0, 7, 8, 2740},
+        {0x0077, 11, 7, 0, 7, 11, 2768},
+        {0x0078, 8, 7, 0, 7, 8, 2810},
+        {0x0079, 8, 10, 0, 7, 8, 2838},
+        {0x007A, 7, 7, 0, 7, 7, 2878},
+        {0x007B, 6, 12, 1, 10, 8, 2906},
+        {0x007C, 2, 13, 1, 10, 4, 2942},
+        {0x007D, 6, 12, 1, 10, 8, 2955},
+        {0x007E, 9, 4, 1, 6, 11, 2991},
+        {0x00A0, 0, 0, 0, 0, 4, 3011},
+        {0x00A1, 3, 10, 1, 7, 5, 3011},
+        {0x00A2, 6, 11, 1, 9, 8, 3031},
+        {0x00A3, 8, 9, 0, 9, 8, 3064},
+        {0x00A4, 8, 7, 0, 7, 8, 3100},
+        {0x00A5, 8, 9, 0, 9, 8, 3128},
+        {0x00A6, 2, 11, 1, 9, 4, 3164},
+        {0x00A7, 6, 11, 0, 9, 7, 3175},
+        {0x00A8, 5, 3, 1, 10, 7, 3208},
+        {0x00A9, 11, 9, 1, 9, 13, 3217},
+        {0x00AA, 6, 6, 0, 9, 6, 3271},
+        {0x00AB, 6, 7, 1, 7, 8, 3289},
+        {0x00AC, 9, 4, 1, 5, 11, 3310},
+        {0x00AD, 5, 1, 0, 4, 5, 3330},
+        {0x00AE, 11, 9, 1, 9, 13, 3333},
+        {0x00AF, 5, 1, 1, 9, 7, 3387},
+        {0x00B0, 5, 4, 1, 9, 7, 3390},
+        {0x00B1, 9, 8, 1, 8, 11, 3402},
+        {0x00B2, 5, 5, 0, 9, 5, 3442},
+        {0x00B3, 5, 5, 0, 9, 5, 3457},
+        {0x00B4, 4, 3, 2, 11, 7, 3472},
+        {0x00B5, 7, 10, 1, 7, 8, 3478},
+        {0x00B6, 6, 11, 1, 9, 8, 3518},
+        {0x00B7, 2, 2, 1, 6, 4, 3551},
+        {0x00B8, 4, 3, 1, 0, 7, 3553},
+        {0x00B9, 5, 5, 0, 9, 5, 3559},
+        {0x00BA, 6, 6, 0, 9, 6, 3574},
+        {0x00BB, 6, 7, 1, 7, 8, 3592},
+        {0x00BC, 13, 10, 0, 10, 13, 3613},
+        {0x00BD, 12, 10, 0, 10, 13, 3683},
+        {0x00BE, 13, 9, 0, 9, 13, 3743},
+        {0x00BF, 6, 10, 0, 7, 7, 3806},
+        {0x00C0, 9, 12, 0, 12, 9, 3836},
+        {0x00C1, 9, 12, 0, 12, 9, 3896},
+        {0x00C2, 9, 12, 0, 12, 9, 3956},
+        {0x00C3, 9, 12, 0, 12, 9, 4016},
+        {0x00C4, 9, 12, 0, 12, 9, 4076},
+        {0x00C5, 9, 12, 0, 12, 9, 4136},
+        {0x00C6, 12, 9, 0, 9, 13, 4196},
+        {0x00C7, 9, 12, 0, 9, 9, 4250},
+        {0x00C8, 7, 12, 1, 12, 8, 4310},
+        {0x00C9, 7, 12, 1, 12, 8, 4358},
+        {0x00CA, 7, 12, 1, 12, 8, 4406},
+        {0x00CB, 7, 12, 1, 12, 8, 4454},
+        {0x00CC, 3, 12, 0, 12, 4, 4502},
+        {0x00CD, 3, 12, 1, 12, 4, 4526},
+        {0x00CE, 5, 12, -1, 12, 4, 4550},
+        {0x00CF, 4, 12, 0, 12, 4, 4586},
+        {0x00D0, 10, 9, 0, 9, 10, 4610},
+        {0x00D1, 8, 12, 1, 12, 10, 4655},
+        {0x00D2, 10, 12, 0, 12, 10, 4703},
+        {0x00D3, 10, 12, 0, 12, 10, 4763},
+        {0x00D4, 10, 12, 0, 12, 10, 4823},
+        {0x00D5, 10, 12, 0, 12, 10, 4883},
+        {0x00D6, 10, 13, 0, 13, 10, 4943},
+        {0x00D7, 9, 8, 1, 8, 11, 5008},
+        {0x00D8, 10, 11, 0, 10, 10, 5048},
+        {0x00D9, 8, 12, 1, 12, 10, 5103},
+        {0x00DA, 8, 12, 1, 12, 10, 5151},
+        {0x00DB, 8, 12, 1, 12, 10, 5199},
+        {0x00DC, 8, 13, 1, 13, 10, 5247},
+        {0x00DD, 9, 12, -1, 12, 8, 5299},
+        {0x00DE, 7, 9, 1, 9, 8, 5359},
+        {0x00DF, 7, 10, 1, 10, 8, 5395},
+        {0x00E0, 7, 10, 0, 10, 8, 5435},
+        {0x00E1, 7, 10, 0, 10, 8, 5475},
+        {0x00E2, 7, 10, 0, 10, 8, 5515},
+        {0x00E3, 7, 10, 0, 10, 8, 5555},
+        {0x00E4, 7, 10, 0, 10, 8, 5595},
+        {0x00E5, 7, 11, 0, 11, 8, 5635},
+        {0x00E6, 13, 7, 0, 7, 13, 5679},
+        {0x00E7, 7, 10, 0, 7, 7, 5728},
+        {0x00E8, 8, 10, 0, 10, 8, 5768},
+        {0x00E9, 8, 10, 0, 10, 8, 5808},
+        {0x00EA, 8, 10, 0, 10, 8, 5848},
+        {0x00EB, 8, 10, 0, 10, 8, 5888},
+        {0x00EC, 4, 10, -1, 10, 4, 5928},
+        {0x00ED, 4, 10, 0, 10, 4, 5948},
+        {0x00EE, 5, 10, -1, 10, 4, 5968},
+        {0x00EF, 5, 10, -1, 10, 4, 5998},
+        {0x00F0, 8, 10, 0, 10, 8, 6028},
+        {0x00F1, 7, 10, 1, 10, 8, 6068},
+        {0x00F2, 8, 10, 0, 10, 8, 6108},
+        {0x00F3, 8, 10, 0, 10, 8, 6148},
+        {0x00F4, 8, 10, 0, 10, 8, 6188},
+        {0x00F5, 8, 10, 0, 10, 8, 6228},
+        {0x00F6, 8, 10, 0, 10, 8, 6268},
+        {0x00F7, 9, 7, 1, 7, 11, 6308},
+        {0x00F8, 8, 9, 0, 8, 8, 6343},
+        {0x00F9, 7, 10, 1, 10, 8, 6379},
+        {0x00FA, 7, 10, 1, 10, 8, 6419},
+        {0x00FB, 7, 10, 1, 10, 8, 6459},
+        {0x00FC, 7, 10, 1, 10, 8, 6499},
+        {0x00FD, 8, 13, 0, 10, 8, 6539},
+        {0x00FE, 7, 13, 1, 10, 8, 6591},
+        {0x00FF, 8, 13, 0, 10, 8, 6643},
+        {0x0100, 9, 11, 0, 11, 9, 6695},
+        {0x0101, 7, 10, 0, 10, 8, 6750},
+        {0x0102, 9, 12, 0, 12, 9, 6790},
+        {0x0103, 7, 10, 0, 10, 8, 6850},
+        {0x0104, 10, 12, 0, 9, 9, 6890},
+        {0x0105, 8, 10, 0, 7, 8, 6950},
+        {0x0106, 9, 12, 0, 12, 9, 6990},
+        {0x0107, 7, 10, 0, 10, 7, 7050},
+        {0x0108, 9, 12, 0, 12, 9, 7090},
+        {0x0109, 7, 10, 0, 10, 7, 7150},
+        {0x010A, 9, 13, 0, 13, 9, 7190},
+        {0x010B, 7, 10, 0, 10, 7, 7255},
+        {0x010C, 9, 12, 0, 12, 9, 7295},
+        {0x010D, 7, 10, 0, 10, 7, 7355},
+        {0x010E, 9, 12, 1, 12, 10, 7395},
+        {0x010F, 10, 10, 0, 10, 8, 7455},
+        {0x0110, 10, 9, 0, 9, 10, 7505},
+        {0x0111, 9, 10, 0, 10, 8, 7550},
+        {0x0112, 7, 11, 1, 11, 8, 7600},
+        {0x0113, 8, 10, 0, 10, 8, 7644},
+        {0x0114, 7, 12, 1, 12, 8, 7684},
+        {0x0115, 8, 10, 0, 10, 8, 7732},
+        {0x0116, 7, 12, 1, 12, 8, 7772},
+        {0x0117, 8, 10, 0, 10, 8, 7820},
+        {0x0118, 7, 12, 1, 9, 8, 7860},
+        {0x0119, 8, 10, 0, 7, 8, 7908},
+        {0x011A, 7, 12, 1, 12, 8, 7948},
+        {0x011B, 8, 10, 0, 10, 8, 7996},
+        {0x011C, 9, 12, 0, 12, 10, 8036},
+        {0x011D, 8, 13, 0, 10, 8, 8096},
+        {0x011E, 9, 12, 0, 12, 10, 8148},
+        {0x011F, 8, 13, 0, 10, 8, 8208},
+        {0x0120, 9, 13, 0, 13, 10, 8260},
+        {0x0121, 8, 13, 0, 10, 8, 8325},
+        {0x0122, 9, 12, 0, 9, 10, 8377},
+        {0x0123, 8, 13, 0, 10, 8, 8437},
+        {0x0124, 8, 12, 1, 12, 10, 8489},
+        {0x0125, 9, 12, -1, 12, 8, 8537},
+        {0x0126, 10, 9, 1, 9, 12, 8597},
+        {0x0127, 8, 10, 0, 10, 9, 8642},
+        {0x0128, 6, 12, -1, 12, 4, 8682},
+        {0x0129, 5, 10, -1, 10, 4, 8718},
+        {0x012A, 4, 11, 0, 11, 4, 8748},
+        {0x012B, 5, 9, -1, 9, 4, 8770},
+        {0x012C, 5, 12, -1, 12, 4, 8797},
+        {0x012D, 5, 10, -1, 10, 4, 8833},
+        {0x012E, 3, 12, 1, 9, 4, 8863},
+        {0x012F, 4, 13, 0, 10, 4, 8887},
+        {0x0130, 2, 12, 1, 12, 4, 8913},
+        {0x0131, 2, 7, 1, 7, 4, 8925},
+        {0x0132, 6, 12, 1, 9, 8, 8932},
+        {0x0133, 5, 13, 1, 10, 7, 8968},
+        {0x0134, 5, 14, -1, 11, 4, 9007},
+        {0x0135, 5, 13, -1, 10, 4, 9049},
+        {0x0136, 8, 12, 1, 9, 9, 9088},
+        {0x0137, 7, 13, 1, 10, 8, 9136},
+        {0x0138, 7, 7, 1, 7, 8, 9188},
+        {0x0139, 7, 12, 1, 12, 7, 9216},
+        {0x013A, 3, 12, 1, 12, 4, 9264},
+        {0x013B, 7, 12, 1, 9, 7, 9288},
+        {0x013C, 3, 13, 0, 10, 4, 9336},
+        {0x013D, 7, 9, 1, 9, 7, 9362},
+        {0x013E, 4, 10, 1, 10, 5, 9398},
+        {0x013F, 7, 9, 1, 9, 7, 9418},
+        {0x0140, 4, 10, 1, 10, 4, 9454},
+        {0x0141, 9, 9, -1, 9, 7, 9474},
+        {0x0142, 4, 10, 0, 10, 4, 9519},
+        {0x0143, 8, 12, 1, 12, 10, 9539},
+        {0x0144, 7, 10, 1, 10, 8, 9587},
+        {0x0145, 8, 12, 1, 9, 10, 9627},
+        {0x0146, 7, 10, 1, 7, 8, 9675},
+        {0x0147, 8, 12, 1, 12, 10, 9715},
+        {0x0148, 7, 10, 1, 10, 8, 9763},
+        {0x0149, 9, 9, 1, 9, 11, 9803},
+        {0x014A, 8, 12, 1, 9, 10, 9848},
+        {0x014B, 7, 10, 1, 7, 8, 9896},
+        {0x014C, 10, 11, 0, 11, 10, 9936},
+        {0x014D, 8, 9, 0, 9, 8, 9991},
+        {0x014E, 10, 12, 0, 12, 10, 10027},
+        {0x014F, 8, 10, 0, 10, 8, 10087},
+        {0x0150, 10, 12, 0, 12, 10, 10127},
+        {0x0151, 8, 11, 0, 11, 8, 10187},
+        {0x0152, 14, 9, 0, 9, 14, 10231},
+        {0x0153, 13, 7, 0, 7, 13, 10294},
+        {0x0154, 8, 12, 1, 12, 9, 10343},
+        {0x0155, 5, 10, 1, 10, 5, 10391},
+        {0x0156, 8, 12, 1, 9, 9, 10421},
+        {0x0157, 6, 11, 0, 8, 5, 10469},
+        {0x0158, 8, 12, 1, 12, 9, 10502},
+        {0x0159, 5, 10, 1, 10, 5, 10550},
+        {0x015A, 8, 12, 0, 12, 8, 10580},
+        {0x015B, 7, 10, 0, 10, 7, 10628},
+        {0x015C, 8, 12, 0, 12, 8, 10668},
+        {0x015D, 7, 10, 0, 10, 7, 10716},
+        {0x015E, 8, 12, 0, 9, 8, 10756},
+        {0x015F, 7, 10, 0, 7, 7, 10804},
+        {0x0160, 8, 12, 0, 12, 8, 10844},
+        {0x0161, 7, 10, 0, 10, 7, 10892},
+        {0x0162, 9, 12, -1, 9, 8, 10932},
+        {0x0163, 5, 11, 0, 8, 5, 10992},
+        {0x0164, 9, 12, -1, 12, 8, 11025},
+        {0x0165, 5, 11, 0, 11, 5, 11085},
+        {0x0166, 9, 9, -1, 9, 8, 11118},
+        {0x0167, 5, 9, 0, 9, 5, 11163},
+        {0x0168, 8, 12, 1, 12, 10, 11190},
+        {0x0169, 7, 10, 1, 10, 8, 11238},
+        {0x016A, 8, 11, 1, 11, 10, 11278},
+        {0x016B, 7, 9, 1, 9, 8, 11322},
+        {0x016C, 8, 12, 1, 12, 10, 11358},
+        {0x016D, 7, 10, 1, 10, 8, 11406},
+        {0x016E, 8, 12, 1, 12, 10, 11446},
+        {0x016F, 7, 11, 1, 11, 8, 11494},
+        {0x0170, 8, 12, 1, 12, 10, 11538},
+        {0x0171, 7, 10, 1, 10, 8, 11586},
+        {0x0172, 8, 12, 1, 9, 10, 11626},
+        {0x0173, 7, 10, 1, 7, 8, 11674},
+        {0x0174, 13, 12, 0, 12, 13, 11714},
+        {0x0175, 11, 10, 0, 10, 11, 11798},
+        {0x0176, 9, 12, -1, 12, 8, 11858},
+        {0x0177, 8, 13, 0, 10, 8, 11918},
+        {0x0178, 9, 12, -1, 12, 8, 11970},
+        {0x0179, 9, 12, 0, 12, 9, 12030},
+        {0x017A, 7, 10, 0, 10, 7, 12090},
+        {0x017B, 9, 12, 0, 12, 9, 12130},
+        {0x017C, 7, 10, 0, 10, 7, 12190},
+        {0x017D, 9, 12, 0, 12, 9, 12230},
+        {0x017E, 7, 10, 0, 10, 7, 12290},
+        {0x017F, 5, 10, 0, 10, 5, 12330},
+        {0x2013, 6, 1, 0, 4, 7, 12360},
+        {0x2014, 13, 1, 0, 4, 13, 12363},
+        {0x2018, 2, 3, 1, 9, 4, 12370},
+        {0x2019, 2, 3, 1, 9, 4, 12373},
+        {0x201C, 5, 3, 1, 9, 7, 12376},
+        {0x201D, 5, 3, 1, 9, 7, 12385},
+        {0x2026, 11, 2, 1, 2, 13, 12394},
+};
+
+const Font font_sans_13 = {
+        .ascent = 13,
+        .height = 17,
+        .glyph_count = 326,
+        .glyphs = glyphs,
+        .bitmaps = bitmaps
+};
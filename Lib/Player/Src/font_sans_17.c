@@ -0,0 +1,1737 @@
+// Generated by Host/FontGen from DejaVuSans.ttf at 17 px, do not edit
+// DejaVu fonts are free, see https://dejavu-fonts.github.io/License.html
+#include "font.h"
+
+static const uint8_t bitmaps[] = {
+        0x7F, 0x40, 0x7F, 0x40, 0x7F, 0x40, 0x7F, 0x40, 0x7F, 0x40, 0x7F, 0x40, 0x6F, 0x30, 0x5F, 0x20,
+        0x4C, 0x10, 0x00, 0x00, 0x13, 0x10, 0x7F, 0x40, 0x7F, 0x40, 0x5F, 0x14, 0xF3, 0x5F, 0x14, 0xF3,
+        0x5F, 0x14, 0xF3, 0x5F, 0x14, 0xF3, 0x5D, 0x13, 0xD2, 0x00, 0x00, 0x1F, 0x50, 0x4F, 0x10, 0x00,
+        0x00, 0x3F, 0x20, 0x7D, 0x00, 0x00, 0x00, 0x7D, 0x00, 0xAA, 0x00, 0x01, 0x11, 0xAB, 0x11, 0xE7,
+        0x11, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0x46, 0xF6, 0x48, 0xE4, 0x44, 0x00, 0x06, 0xE0,
+        0x09, 0xB0, 0x00, 0x11, 0x1A, 0xB1, 0x1D, 0x81, 0x10, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x34,
+        0x6F, 0x64, 0x8E, 0x44, 0x40, 0x00, 0x5E, 0x00, 0x9B, 0x00, 0x00, 0x00, 0x9B, 0x00, 0xC7, 0x00,
+        0x00, 0x00, 0xC8, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xB0, 0x00,
+        0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x04, 0xCE, 0xFE, 0xC6, 0x00, 0x3F, 0xB5, 0xC4, 0x88, 0x00,
+        0x8F, 0x11, 0xB0, 0x00, 0x00, 0x8F, 0x21, 0xB0, 0x00, 0x00, 0x2E, 0xE9, 0xC1, 0x00, 0x00, 0x02,
+        0x9D, 0xFF, 0xB3, 0x00, 0x00, 0x01, 0xC6, 0xDE, 0x10, 0x00, 0x01, 0xB0, 0x4F, 0x50, 0x10, 0x01,
+        0xB0, 0x4F, 0x40, 0x9B, 0x65, 0xC7, 0xED, 0x10, 0x39, 0xDE, 0xFE, 0xA2, 0x00, 0x00, 0x01, 0xB0,
+        0x00, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x01, 0xAE, 0xD6, 0x00,
+        0x00, 0x1E, 0x50, 0x00, 0x0A, 0xC3, 0x5F, 0x40, 0x00, 0x9B, 0x00, 0x00, 0x0F, 0x50, 0x0B, 0x90,
+        0x03, 0xF2, 0x00, 0x00, 0x0F, 0x50, 0x0B, 0x90, 0x0C, 0x80, 0x00, 0x00, 0x0B, 0xB1, 0x3E, 0x50,
+        0x6D, 0x10, 0x00, 0x00, 0x02, 0xCF, 0xF9, 0x01, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09,
+        0xB0, 0x3C, 0xDA, 0x10, 0x00, 0x00, 0x00, 0x3F, 0x21, 0xE8, 0x3C, 0xB0, 0x00, 0x00, 0x00, 0xC8,
+        0x06, 0xE0, 0x04, 0xF1, 0x00, 0x00, 0x06, 0xD1, 0x07, 0xD0, 0x02, 0xF3, 0x00, 0x00, 0x1E, 0x50,
+        0x06, 0xE0, 0x04, 0xF1, 0x00, 0x00, 0x9B, 0x00, 0x01, 0xE8, 0x3B, 0xB0, 0x00, 0x03, 0xF3, 0x00,
+        0x00, 0x4C, 0xEB, 0x20, 0x00, 0x3B, 0xEE, 0xB4, 0x00, 0x00, 0x02, 0xED, 0x77, 0xB9, 0x00, 0x00,
+        0x06, 0xF3, 0x00, 0x01, 0x00, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0xEE, 0xA0, 0x00, 0x00, 0x00, 0x2E, 0x84, 0xFA, 0x00, 0x07, 0xF1, 0xAE, 0x00,
+        0x4F, 0xA0, 0x0A, 0xD0, 0xDB, 0x00, 0x05, 0xF9, 0x1E, 0x70, 0xDD, 0x00, 0x00, 0x6F, 0xDD, 0x10,
+        0x9F, 0x60, 0x00, 0x0B, 0xFA, 0x00, 0x1D, 0xFA, 0x77, 0xCF, 0xBF, 0x70, 0x01, 0x9D, 0xFE, 0xA3,
+        0x0B, 0xF5, 0x5F, 0x10, 0x5F, 0x10, 0x5F, 0x10, 0x5F, 0x10, 0x5D, 0x10, 0x00, 0x5E, 0x10, 0x00,
+        0xD8, 0x00, 0x05, 0xF2, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x4F, 0x50, 0x00, 0x6F, 0x30,
+        0x00, 0x7F, 0x20, 0x00, 0x7F, 0x20, 0x00, 0x6F, 0x30, 0x00, 0x4F, 0x50, 0x00, 0x1F, 0x80, 0x00,
+        0x0B, 0xC0, 0x00, 0x05, 0xF2, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x5E, 0x10, 0x6E, 0x10, 0x00, 0x0D,
+        0x70, 0x00, 0x08, 0xE0, 0x00, 0x03, 0xF5, 0x00, 0x00, 0xDA, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x8F,
+        0x10, 0x00, 0x7F, 0x20, 0x00, 0x7F, 0x20, 0x00, 0x8F, 0x10, 0x00, 0xAD, 0x00, 0x00, 0xEA, 0x00,
+        0x03, 0xF5, 0x00, 0x08, 0xE0, 0x00, 0x0D, 0x70, 0x00, 0x6E, 0x10, 0x00, 0x00, 0x03, 0xB0, 0x00,
+        0x13, 0x03, 0xB0, 0x03, 0x3D, 0x84, 0xB3, 0xC9, 0x01, 0x8D, 0xEC, 0x40, 0x00, 0x5D, 0xFA, 0x20,
+        0x2C, 0xA5, 0xB5, 0xD7, 0x25, 0x03, 0xB0, 0x15, 0x00, 0x03, 0xB0, 0x00, 0x00, 0x00, 0x20, 0x00,
+        0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xC0,
+        0x00, 0x00, 0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, 0x02, 0x22,
+        0x2A, 0xD2, 0x22, 0x21, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x15, 0x55, 0x5B, 0xD5, 0x55, 0x52,
+        0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xC0,
+        0x00, 0x00, 0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, 0x04, 0x30, 0x0F, 0xB0, 0x1F, 0x90, 0x5F, 0x20,
+        0x99, 0x00, 0x02, 0x22, 0x21, 0x3F, 0xFF, 0xF4, 0x15, 0x55, 0x51, 0x13, 0x20, 0x3F, 0x80, 0x3F,
+        0x80, 0x00, 0x00, 0xD9, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xA0, 0x00, 0x1F, 0x60,
+        0x00, 0x5F, 0x10, 0x00, 0x9C, 0x00, 0x00, 0xE7, 0x00, 0x03, 0xF3, 0x00, 0x08, 0xD0, 0x00, 0x0C,
+        0x90, 0x00, 0x2F, 0x50, 0x00, 0x6E, 0x10, 0x00, 0xBB, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x7D,
+        0xFD, 0x60, 0x00, 0x09, 0xFA, 0x7B, 0xF6, 0x00, 0x3F, 0x90, 0x00, 0xCE, 0x10, 0x8F, 0x20, 0x00,
+        0x5F, 0x50, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0xCD, 0x00, 0x00, 0x0F, 0xA0, 0xDC, 0x00, 0x00, 0x0F,
+        0xA0, 0xCD, 0x00, 0x00, 0x0F, 0xA0, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x8F, 0x20, 0x00, 0x5F, 0x50,
+        0x3F, 0x90, 0x00, 0xBE, 0x10, 0x09, 0xF9, 0x6B, 0xF6, 0x00, 0x00, 0x8D, 0xFD, 0x60, 0x00, 0x18,
+        0xBE, 0xF8, 0x00, 0x00, 0x2F, 0xDB, 0xF8, 0x00, 0x00, 0x01, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x02,
+        0xF8, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF8,
+        0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
+        0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x06, 0x78, 0xFB, 0x77, 0x20, 0x0D, 0xFF, 0xFF, 0xFF, 0x40,
+        0x38, 0xCE, 0xEB, 0x30, 0x00, 0xAF, 0xA8, 0x9E, 0xF5, 0x00, 0x41, 0x00, 0x02, 0xED, 0x00, 0x00,
+        0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00,
+        0x2E, 0xD1, 0x00, 0x00, 0x01, 0xCE, 0x20, 0x00, 0x00, 0x1C, 0xE3, 0x00, 0x00, 0x01, 0xCE, 0x30,
+        0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x9F, 0xB7, 0x77, 0x77, 0x10, 0xBF, 0xFF, 0xFF, 0xFF,
+        0x20, 0x29, 0xDE, 0xEC, 0x60, 0x00, 0x5C, 0x98, 0x8C, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x10,
+        0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x12, 0x36, 0xED, 0x00, 0x00, 0x8F, 0xFF, 0xB2, 0x00, 0x00,
+        0x35, 0x6B, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x10, 0x00, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x00,
+        0x00, 0x5F, 0x60, 0x20, 0x00, 0x00, 0xCF, 0x30, 0xBD, 0x98, 0x9D, 0xF9, 0x00, 0x5B, 0xDF, 0xEC,
+        0x60, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x10, 0x00, 0x00, 0x1D, 0xEF, 0x10, 0x00, 0x00, 0x8D, 0x9F,
+        0x10, 0x00, 0x02, 0xF5, 0x9F, 0x10, 0x00, 0x0B, 0xB0, 0x9F, 0x10, 0x00, 0x5F, 0x30, 0x9F, 0x10,
+        0x00, 0xD9, 0x00, 0x9F, 0x10, 0x08, 0xE1, 0x00, 0x9F, 0x10, 0x1F, 0x82, 0x22, 0x9F, 0x32, 0x3F,
+        0xFF, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0xBF, 0x64, 0x00, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x00,
+        0x00, 0x9F, 0x10, 0x3F, 0xFF, 0xFF, 0xF6, 0x00, 0x3F, 0xA7, 0x77, 0x73, 0x00, 0x3F, 0x60, 0x00,
+        0x00, 0x00, 0x3F, 0x62, 0x10, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x60, 0x00, 0x2B, 0x75, 0x7E, 0xF6,
+        0x00, 0x00, 0x00, 0x01, 0xEE, 0x10, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x6F, 0x50,
+        0x00, 0x00, 0x00, 0x8F, 0x30, 0x20, 0x00, 0x02, 0xEE, 0x00, 0xAD, 0x98, 0xAF, 0xF5, 0x00, 0x5B,
+        0xEF, 0xEB, 0x30, 0x00, 0x00, 0x2A, 0xEF, 0xD8, 0x00, 0x03, 0xEE, 0xA8, 0x9C, 0x00, 0x0D, 0xC2,
+        0x00, 0x00, 0x00, 0x5F, 0x40, 0x10, 0x00, 0x00, 0x9F, 0x4D, 0xFF, 0xB2, 0x00, 0xBE, 0xE9, 0x58,
+        0xFD, 0x10, 0xCF, 0xA0, 0x00, 0x6F, 0x60, 0xBF, 0x40, 0x00, 0x1F, 0xA0, 0xAF, 0x30, 0x00, 0x0F,
+        0xB0, 0x7F, 0x40, 0x00, 0x1F, 0xA0, 0x2F, 0xA0, 0x00, 0x7F, 0x60, 0x08, 0xFB, 0x79, 0xFC, 0x00,
+        0x00, 0x6D, 0xFE, 0x91, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0x50, 0x47, 0x77, 0x77, 0xDF, 0x10, 0x00,
+        0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x06, 0xF5, 0x00, 0x00, 0x00, 0x0C, 0xE1, 0x00, 0x00, 0x00,
+        0x2F, 0x90, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x04, 0xF8,
+        0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0x5F, 0x60, 0x00,
+        0x00, 0x00, 0xBF, 0x10, 0x00, 0x00, 0x02, 0x9D, 0xFD, 0x92, 0x00, 0x1E, 0xE8, 0x79, 0xFD, 0x10,
+        0x7F, 0x40, 0x00, 0x7F, 0x40, 0x8F, 0x30, 0x00, 0x6F, 0x40, 0x4F, 0xB3, 0x24, 0xDB, 0x00, 0x07,
+        0xEF, 0xFF, 0xA0, 0x00, 0x05, 0xB7, 0x58, 0xFA, 0x00, 0x5F, 0x30, 0x00, 0x6F, 0x50, 0xBE, 0x00,
+        0x00, 0x1F, 0x90, 0xCE, 0x00, 0x00, 0x2F, 0x90, 0xAF, 0x40, 0x00, 0x7F, 0x60, 0x3F, 0xE8, 0x6A,
+        0xFD, 0x10, 0x03, 0xAD, 0xFD, 0x91, 0x00, 0x02, 0xAE, 0xEC, 0x50, 0x00, 0x2E, 0xE8, 0x7C, 0xF5,
+        0x00, 0x9F, 0x30, 0x00, 0xCD, 0x00, 0xDD, 0x00, 0x00, 0x7F, 0x40, 0xDC, 0x00, 0x00, 0x6F, 0x70,
+        0xBE, 0x10, 0x00, 0xAF, 0x90, 0x5F, 0xB3, 0x27, 0xFF, 0x90, 0x07, 0xEF, 0xFE, 0x6F, 0x80, 0x00,
+        0x13, 0x41, 0x4F, 0x60, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x2D, 0x98,
+        0xAF, 0xD1, 0x00, 0x1A, 0xDF, 0xD9, 0x10, 0x00, 0x32, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x32,
+        0xFB, 0xFB, 0x03, 0x20, 0x0F, 0xB0, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0x30, 0x0F, 0xB0, 0x1F, 0x90, 0x5F, 0x20, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+        0x00, 0x00, 0x00, 0x00, 0x4A, 0xE7, 0x00, 0x00, 0x02, 0x7D, 0xFE, 0x82, 0x00, 0x15, 0xBF, 0xFA,
+        0x50, 0x00, 0x19, 0xEF, 0xC6, 0x10, 0x00, 0x00, 0x3F, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x06, 0xCF,
+        0xE9, 0x40, 0x00, 0x00, 0x00, 0x02, 0x8E, 0xFD, 0x72, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xB3,
+        0x00, 0x00, 0x00, 0x00, 0x17, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x22, 0x22, 0x22,
+        0x22, 0x21, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x15, 0x55, 0x55, 0x55, 0x55, 0x52, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x21, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+        0x15, 0x55, 0x55, 0x55, 0x55, 0x52, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xB5, 0x00, 0x00,
+        0x00, 0x00, 0x17, 0xDF, 0xE9, 0x30, 0x00, 0x00, 0x00, 0x03, 0x9E, 0xFC, 0x71, 0x00, 0x00, 0x00,
+        0x00, 0x5B, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xF7, 0x00, 0x00, 0x02, 0x8D, 0xFD, 0x71,
+        0x00, 0x16, 0xCF, 0xE9, 0x40, 0x00, 0x1A, 0xFF, 0xC6, 0x10, 0x00, 0x00, 0x3E, 0x82, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDE, 0xD6, 0x00, 0xCD, 0x87, 0xDF, 0x60,
+        0x40, 0x00, 0x1E, 0xB0, 0x00, 0x00, 0x0E, 0xB0, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x07, 0xF8, 0x00,
+        0x00, 0x4F, 0x90, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00,
+        0x00, 0x23, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xEF, 0xEC, 0x71, 0x00, 0x00, 0x00, 0x1B, 0xFA, 0x54,
+        0x47, 0xDE, 0x50, 0x00, 0x01, 0xDC, 0x20, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x0A, 0xC0, 0x00, 0x00,
+        0x00, 0x00, 0x6E, 0x10, 0x3F, 0x20, 0x08, 0xEF, 0xB5, 0xF0, 0x0C, 0x70, 0x8A, 0x00, 0x6F, 0x74,
+        0x7E, 0xF0, 0x07, 0xB0, 0xC6, 0x00, 0xC9, 0x00, 0x08, 0xF0, 0x06, 0xC0, 0xD5, 0x00, 0xE5, 0x00,
+        0x05, 0xF0, 0x08, 0xB0, 0xC6, 0x00, 0xD7, 0x00, 0x07, 0xF0, 0x0D, 0x60, 0xA9, 0x00, 0x8E, 0x41,
+        0x4E, 0xF3, 0xBC, 0x10, 0x5E, 0x10, 0x1A, 0xFF, 0xE7, 0xFF, 0x91, 0x00, 0x0D, 0x90, 0x00, 0x13,
+        0x00, 0x30, 0x00, 0x00, 0x03, 0xE8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x4E, 0xC6, 0x21,
+        0x26, 0xCE, 0x20, 0x00, 0x00, 0x01, 0x8D, 0xFF, 0xFE, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
+        0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xF5, 0x00, 0x00,
+        0x00, 0x01, 0xF6, 0xCA, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x7F, 0x10, 0x00, 0x00, 0x0C, 0xB0, 0x2F,
+        0x60, 0x00, 0x00, 0x2F, 0x50, 0x0B, 0xB0, 0x00, 0x00, 0x8E, 0x10, 0x06, 0xF2, 0x00, 0x00, 0xDB,
+        0x22, 0x23, 0xF7, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x09, 0xE5, 0x55, 0x55, 0x8F, 0x30,
+        0x0E, 0xA0, 0x00, 0x00, 0x1F, 0x90, 0x5F, 0x50, 0x00, 0x00, 0x0B, 0xE0, 0xAF, 0x10, 0x00, 0x00,
+        0x06, 0xF5, 0x5F, 0xFF, 0xFE, 0xC6, 0x00, 0x5F, 0xA7, 0x78, 0xCF, 0x80, 0x5F, 0x50, 0x00, 0x1D,
+        0xD0, 0x5F, 0x50, 0x00, 0x0C, 0xD0, 0x5F, 0x62, 0x23, 0x8F, 0x70, 0x5F, 0xFF, 0xFF, 0xF8, 0x00,
+        0x5F, 0x85, 0x56, 0xAF, 0x80, 0x5F, 0x50, 0x00, 0x0A, 0xF2, 0x5F, 0x50, 0x00, 0x06, 0xF6, 0x5F,
+        0x50, 0x00, 0x06, 0xF6, 0x5F, 0x50, 0x00, 0x0B, 0xF4, 0x5F, 0xA7, 0x78, 0xCF, 0xB0, 0x5F, 0xFF,
+        0xFF, 0xD8, 0x00, 0x00, 0x01, 0x8C, 0xEE, 0xC8, 0x10, 0x00, 0x3E, 0xFB, 0x87, 0xAE, 0xE0, 0x01,
+        0xEE, 0x30, 0x00, 0x01, 0x90, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00,
+        0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0xEE, 0x30, 0x00, 0x01, 0x90, 0x00, 0x3E, 0xFA, 0x77, 0xAE, 0xE0, 0x00, 0x01, 0x8D, 0xEF, 0xC8,
+        0x10, 0x5F, 0xFF, 0xFE, 0xB7, 0x10, 0x00, 0x5F, 0xA7, 0x78, 0xBF, 0xE5, 0x00, 0x5F, 0x50, 0x00,
+        0x03, 0xEE, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x90, 0x5F, 0x50, 0x00, 0x00, 0x0E, 0xD0, 0x5F,
+        0x50, 0x00, 0x00, 0x0B, 0xF0, 0x5F, 0x50, 0x00, 0x00, 0x0B, 0xF1, 0x5F, 0x50, 0x00, 0x00, 0x0B,
+        0xF0, 0x5F, 0x50, 0x00, 0x00, 0x0E, 0xD0, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x90, 0x5F, 0x50, 0x00,
+        0x03, 0xEE, 0x20, 0x5F, 0xA7, 0x78, 0xBF, 0xE4, 0x00, 0x5F, 0xFF, 0xFE, 0xB7, 0x10, 0x00, 0x5F,
+        0xFF, 0xFF, 0xFF, 0x80, 0x5F, 0xA7, 0x77, 0x77, 0x40, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50,
+        0x00, 0x00, 0x00, 0x5F, 0x72, 0x22, 0x22, 0x10, 0x5F, 0xFF, 0xFF, 0xFF, 0x40, 0x5F, 0x85, 0x55,
+        0x55, 0x10, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00,
+        0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0xA7, 0x77, 0x77, 0x50, 0x5F, 0xFF, 0xFF, 0xFF, 0xA0,
+        0x5F, 0xFF, 0xFF, 0xFC, 0x5F, 0xA7, 0x77, 0x76, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00,
+        0x5F, 0x72, 0x22, 0x21, 0x5F, 0xFF, 0xFF, 0xF4, 0x5F, 0x85, 0x55, 0x51, 0x5F, 0x50, 0x00, 0x00,
+        0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00,
+        0x5F, 0x50, 0x00, 0x00, 0x00, 0x01, 0x8C, 0xEF, 0xDA, 0x40, 0x00, 0x3E, 0xFB, 0x87, 0x9D, 0xF6,
+        0x01, 0xEE, 0x30, 0x00, 0x00, 0x55, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00,
+        0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0x22, 0x21, 0x0F, 0xB0, 0x00, 0x09, 0xFF, 0xFC, 0x0F, 0xC0,
+        0x00, 0x03, 0x55, 0xEC, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0xDC, 0x08, 0xF5, 0x00, 0x00, 0x00, 0xDC,
+        0x01, 0xEE, 0x30, 0x00, 0x00, 0xDC, 0x00, 0x3E, 0xFB, 0x77, 0x8D, 0xF9, 0x00, 0x01, 0x8C, 0xEF,
+        0xDA, 0x40, 0x5F, 0x50, 0x00, 0x00, 0x8F, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x8F, 0x20, 0x5F, 0x50,
+        0x00, 0x00, 0x8F, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x8F, 0x20, 0x5F, 0x72, 0x22, 0x22, 0x9F, 0x20,
+        0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x5F, 0x85, 0x55, 0x55, 0xBF, 0x20, 0x5F, 0x50, 0x00, 0x00,
+        0x8F, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x8F, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x8F, 0x20, 0x5F, 0x50,
+        0x00, 0x00, 0x8F, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x8F, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x8F, 0x20,
+        0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50,
+        0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x00, 0x5F, 0x50, 0x00, 0x5F, 0x50,
+        0x00, 0x5F, 0x50, 0x00, 0x5F, 0x50, 0x00, 0x5F, 0x50, 0x00, 0x5F, 0x50, 0x00, 0x5F, 0x50, 0x00,
+        0x5F, 0x50, 0x00, 0x5F, 0x50, 0x00, 0x5F, 0x50, 0x00, 0x5F, 0x50, 0x00, 0x5F, 0x50, 0x00, 0x5F,
+        0x50, 0x00, 0x6F, 0x40, 0x00, 0xAF, 0x20, 0x7A, 0xFB, 0x00, 0xDE, 0xA1, 0x00, 0x5F, 0x50, 0x00,
+        0x09, 0xF8, 0x00, 0x5F, 0x50, 0x00, 0x9F, 0x80, 0x00, 0x5F, 0x50, 0x09, 0xF8, 0x00, 0x00, 0x5F,
+        0x50, 0x9F, 0x80, 0x00, 0x00, 0x5F, 0x5A, 0xF8, 0x00, 0x00, 0x00, 0x5F, 0xDF, 0x70, 0x00, 0x00,
+        0x00, 0x5F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x6D, 0xF5, 0x00, 0x00, 0x00, 0x5F, 0x52, 0xDF,
+        0x40, 0x00, 0x00, 0x5F, 0x50, 0x2D, 0xE3, 0x00, 0x00, 0x5F, 0x50, 0x02, 0xEE, 0x30, 0x00, 0x5F,
+        0x50, 0x00, 0x3E, 0xE2, 0x00, 0x5F, 0x50, 0x00, 0x03, 0xED, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x00,
+        0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F,
+        0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50,
+        0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00,
+        0x00, 0x00, 0x5F, 0xA7, 0x77, 0x77, 0x30, 0x5F, 0xFF, 0xFF, 0xFF, 0x60, 0x5F, 0xF5, 0x00, 0x00,
+        0x0A, 0xFF, 0x5F, 0xFB, 0x00, 0x00, 0x1F, 0xFF, 0x5F, 0xAF, 0x10, 0x00, 0x6F, 0xAF, 0x5F, 0x5E,
+        0x60, 0x00, 0xBA, 0x9F, 0x5F, 0x4A, 0xC0, 0x02, 0xF5, 0x9F, 0x5F, 0x45, 0xF2, 0x07, 0xE0, 0x9F,
+        0x5F, 0x40, 0xE7, 0x0C, 0x90, 0x9F, 0x5F, 0x40, 0x9D, 0x3F, 0x40, 0x9F, 0x5F, 0x40, 0x3F, 0xBD,
+        0x00, 0x9F, 0x5F, 0x40, 0x0D, 0xF8, 0x00, 0x9F, 0x5F, 0x40, 0x05, 0x82, 0x00, 0x9F, 0x5F, 0x40,
+        0x00, 0x00, 0x00, 0x9F, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x9F, 0x5F, 0xF3, 0x00, 0x00, 0x9F, 0x10,
+        0x5F, 0xFA, 0x00, 0x00, 0x9F, 0x10, 0x5F, 0xCF, 0x30, 0x00, 0x9F, 0x10, 0x5F, 0x5E, 0xA0, 0x00,
+        0x9F, 0x10, 0x5F, 0x48, 0xF3, 0x00, 0x9F, 0x10, 0x5F, 0x41, 0xEB, 0x00, 0x9F, 0x10, 0x5F, 0x40,
+        0x7F, 0x30, 0x9F, 0x10, 0x5F, 0x40, 0x1E, 0xB0, 0x9F, 0x10, 0x5F, 0x40, 0x07, 0xF3, 0x9F, 0x10,
+        0x5F, 0x40, 0x01, 0xEB, 0x9F, 0x10, 0x5F, 0x40, 0x00, 0x7F, 0xCF, 0x10, 0x5F, 0x40, 0x00, 0x1E,
+        0xFF, 0x10, 0x5F, 0x40, 0x00, 0x07, 0xFF, 0x10, 0x00, 0x02, 0x9D, 0xFE, 0xB4, 0x00, 0x00, 0x00,
+        0x4E, 0xFA, 0x78, 0xDF, 0x80, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x0A, 0xF6, 0x00, 0x08, 0xF6, 0x00,
+        0x00, 0x01, 0xED, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x0F, 0xC0, 0x00, 0x00, 0x00,
+        0x6F, 0x50, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x5F, 0x60, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x50,
+        0x0C, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x08, 0xF5, 0x00, 0x00, 0x01, 0xED, 0x00, 0x01, 0xEE,
+        0x30, 0x00, 0x0A, 0xF6, 0x00, 0x00, 0x4E, 0xF9, 0x78, 0xDF, 0x80, 0x00, 0x00, 0x02, 0x9D, 0xFE,
+        0xB5, 0x00, 0x00, 0x5F, 0xFF, 0xFE, 0xA2, 0x00, 0x5F, 0xA7, 0x7A, 0xFE, 0x20, 0x5F, 0x50, 0x00,
+        0x6F, 0x80, 0x5F, 0x50, 0x00, 0x2F, 0xA0, 0x5F, 0x50, 0x00, 0x4F, 0x90, 0x5F, 0x62, 0x25, 0xDF,
+        0x40, 0x5F, 0xFF, 0xFF, 0xE6, 0x00, 0x5F, 0x85, 0x53, 0x10, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00,
+        0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F,
+        0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xB4, 0x00, 0x00, 0x00, 0x4E, 0xFA, 0x78, 0xDF,
+        0x80, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x0A, 0xF5, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x01, 0xED, 0x00,
+        0x0C, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x0F, 0xB0,
+        0x00, 0x00, 0x00, 0x5F, 0x60, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x0C, 0xE0, 0x00, 0x00,
+        0x00, 0x9F, 0x30, 0x08, 0xF5, 0x00, 0x00, 0x01, 0xED, 0x00, 0x01, 0xEE, 0x20, 0x00, 0x0A, 0xF5,
+        0x00, 0x00, 0x4E, 0xE9, 0x78, 0xDF, 0x80, 0x00, 0x00, 0x02, 0x9D, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0xEC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x5F, 0xFF, 0xFE,
+        0xA3, 0x00, 0x00, 0x5F, 0xA7, 0x7A, 0xFE, 0x20, 0x00, 0x5F, 0x50, 0x00, 0x6F, 0x80, 0x00, 0x5F,
+        0x50, 0x00, 0x2F, 0xA0, 0x00, 0x5F, 0x50, 0x00, 0x4F, 0x90, 0x00, 0x5F, 0x62, 0x25, 0xDF, 0x40,
+        0x00, 0x5F, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x5F, 0x85, 0x5A, 0xF5, 0x00, 0x00, 0x5F, 0x50, 0x00,
+        0xAE, 0x20, 0x00, 0x5F, 0x50, 0x00, 0x2F, 0xA0, 0x00, 0x5F, 0x50, 0x00, 0x09, 0xF2, 0x00, 0x5F,
+        0x50, 0x00, 0x03, 0xF9, 0x00, 0x5F, 0x50, 0x00, 0x00, 0xBF, 0x20, 0x02, 0xAD, 0xFE, 0xB7, 0x00,
+        0x3F, 0xE9, 0x78, 0xBF, 0x10, 0xBF, 0x20, 0x00, 0x02, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x00, 0xBF,
+        0x30, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x84, 0x00, 0x00, 0x03, 0xAE, 0xFF, 0xE6, 0x00, 0x00, 0x00,
+        0x26, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x50, 0x00, 0x00,
+        0x4F, 0xA0, 0xCE, 0xA7, 0x7A, 0xFE, 0x30, 0x49, 0xCE, 0xFD, 0xA2, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xF7, 0x07, 0x77, 0x7C, 0xF8, 0x77, 0x73, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00,
+        0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0,
+        0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00,
+        0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F,
+        0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20,
+        0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00,
+        0x00, 0xBF, 0x7F, 0x30, 0x00, 0x00, 0xBE, 0x5F, 0x50, 0x00, 0x00, 0xEC, 0x1F, 0xC1, 0x00, 0x06,
+        0xF8, 0x07, 0xFD, 0x87, 0xAF, 0xD1, 0x00, 0x5C, 0xEF, 0xD9, 0x10, 0xAF, 0x10, 0x00, 0x00, 0x07,
+        0xF5, 0x5F, 0x60, 0x00, 0x00, 0x0C, 0xE0, 0x0E, 0xC0, 0x00, 0x00, 0x2F, 0x90, 0x09, 0xF2, 0x00,
+        0x00, 0x8F, 0x30, 0x03, 0xF8, 0x00, 0x00, 0xDD, 0x00, 0x00, 0xDD, 0x00, 0x03, 0xF7, 0x00, 0x00,
+        0x8F, 0x30, 0x09, 0xF2, 0x00, 0x00, 0x2F, 0x90, 0x0E, 0xB0, 0x00, 0x00, 0x0C, 0xE0, 0x5F, 0x60,
+        0x00, 0x00, 0x06, 0xF4, 0xAF, 0x10, 0x00, 0x00, 0x01, 0xFB, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF,
+        0xF5, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x00, 0x00, 0x5F, 0x60, 0x00, 0x0A, 0xF7, 0x00, 0x00,
+        0x9F, 0x20, 0x1F, 0x90, 0x00, 0x0D, 0xFA, 0x00, 0x00, 0xCD, 0x00, 0x0D, 0xD0, 0x00, 0x2F, 0xAE,
+        0x00, 0x01, 0xFA, 0x00, 0x09, 0xF1, 0x00, 0x5F, 0x3F, 0x30, 0x04, 0xF6, 0x00, 0x05, 0xF5, 0x00,
+        0x9C, 0x0E, 0x60, 0x08, 0xF3, 0x00, 0x02, 0xF8, 0x00, 0xD8, 0x0B, 0xA0, 0x0B, 0xE0, 0x00, 0x00,
+        0xDC, 0x01, 0xF5, 0x07, 0xD0, 0x0E, 0xA0, 0x00, 0x00, 0xAF, 0x15, 0xF1, 0x04, 0xF2, 0x3F, 0x70,
+        0x00, 0x00, 0x6F, 0x48, 0xD0, 0x00, 0xF5, 0x7F, 0x30, 0x00, 0x00, 0x2F, 0x8C, 0x90, 0x00, 0xC9,
+        0xBE, 0x00, 0x00, 0x00, 0x0E, 0xCF, 0x50, 0x00, 0x8D, 0xEB, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x20,
+        0x00, 0x5F, 0xF7, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x09, 0xF3,
+        0x00, 0x00, 0x4F, 0x80, 0x01, 0xEC, 0x00, 0x01, 0xDD, 0x00, 0x00, 0x5F, 0x70, 0x08, 0xF4, 0x00,
+        0x00, 0x0A, 0xE2, 0x3F, 0x90, 0x00, 0x00, 0x02, 0xEB, 0xCE, 0x10, 0x00, 0x00, 0x00, 0x6F, 0xF5,
+        0x00, 0x00, 0x00, 0x00, 0x5F, 0xF1, 0x00, 0x00, 0x00, 0x01, 0xED, 0xFA, 0x00, 0x00, 0x00, 0x09,
+        0xF3, 0x8F, 0x40, 0x00, 0x00, 0x4F, 0x80, 0x0D, 0xD1, 0x00, 0x01, 0xDD, 0x10, 0x04, 0xF8, 0x00,
+        0x08, 0xF4, 0x00, 0x00, 0xAF, 0x30, 0x3F, 0x90, 0x00, 0x00, 0x1E, 0xC0, 0x0B, 0xE2, 0x00, 0x00,
+        0x0B, 0xE2, 0x02, 0xEB, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x6F, 0x60, 0x01, 0xEC, 0x00, 0x00, 0x0C,
+        0xE1, 0x09, 0xF3, 0x00, 0x00, 0x02, 0xFA, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xED, 0x00, 0x00,
+        0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0,
+        0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00,
+        0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+        0x07, 0x77, 0x77, 0x77, 0xCF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1D,
+        0xE2, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x00,
+        0x4F, 0xB0, 0x00, 0x00, 0x00, 0x02, 0xED, 0x10, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xF8, 0x77, 0x77,
+        0x77, 0x60, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x8F, 0xFF, 0x8F, 0x44, 0x8F, 0x00, 0x8F, 0x00,
+        0x8F, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x8F, 0x00,
+        0x8F, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x8F, 0xFF, 0x23, 0x33, 0xD8, 0x00, 0x00, 0x8D, 0x00, 0x00,
+        0x4F, 0x20, 0x00, 0x0E, 0x70, 0x00, 0x0A, 0xB0, 0x00, 0x06, 0xF1, 0x00, 0x01, 0xF5, 0x00, 0x00,
+        0xCA, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0D, 0x80, 0x00, 0x09, 0xD0, 0x00, 0x04,
+        0xF2, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x65, 0x5F, 0xFF, 0x30, 0x14, 0x8F, 0x30, 0x00, 0x5F, 0x30,
+        0x00, 0x5F, 0x30, 0x00, 0x5F, 0x30, 0x00, 0x5F, 0x30, 0x00, 0x5F, 0x30, 0x00, 0x5F, 0x30, 0x00,
+        0x5F, 0x30, 0x00, 0x5F, 0x30, 0x00, 0x5F, 0x30, 0x00, 0x5F, 0x30, 0x00, 0x5F, 0x30, 0x00, 0x5F,
+        0x30, 0x00, 0x6F, 0x30, 0x5F, 0xFF, 0x30, 0x13, 0x33, 0x10, 0x00, 0x00, 0x3E, 0xF6, 0x00, 0x00,
+        0x00, 0x02, 0xEE, 0xCF, 0x40, 0x00, 0x00, 0x1D, 0xD2, 0x1B, 0xE3, 0x00, 0x01, 0xCD, 0x20, 0x01,
+        0xBE, 0x20, 0x0B, 0xD2, 0x00, 0x00, 0x0B, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+        0xFF, 0xFA, 0x13, 0x33, 0x33, 0x33, 0x32, 0x38, 0x20, 0x00, 0x0C, 0xB0, 0x00, 0x02, 0xE6, 0x00,
+        0x00, 0x4E, 0x20, 0x29, 0xDE, 0xEB, 0x30, 0x4D, 0x86, 0x7D, 0xF3, 0x10, 0x00, 0x01, 0xE9, 0x00,
+        0x00, 0x00, 0xBC, 0x07, 0xDF, 0xFF, 0xFD, 0x9F, 0x84, 0x33, 0xBD, 0xEA, 0x00, 0x00, 0xCD, 0xEA,
+        0x00, 0x04, 0xFD, 0x9F, 0x96, 0x8E, 0xDD, 0x19, 0xEE, 0xC4, 0xAD, 0x7F, 0x10, 0x00, 0x00, 0x00,
+        0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F,
+        0x2A, 0xEE, 0xA1, 0x00, 0x7F, 0xCB, 0x68, 0xFC, 0x00, 0x7F, 0xB0, 0x00, 0x6F, 0x60, 0x7F, 0x40,
+        0x00, 0x0E, 0xB0, 0x7F, 0x20, 0x00, 0x0C, 0xC0, 0x7F, 0x20, 0x00, 0x0C, 0xC0, 0x7F, 0x40, 0x00,
+        0x0E, 0xB0, 0x7F, 0xB0, 0x00, 0x6F, 0x60, 0x7F, 0xCB, 0x68, 0xFC, 0x00, 0x7F, 0x2A, 0xEE, 0xA1,
+        0x00, 0x00, 0x18, 0xDF, 0xDA, 0x20, 0x01, 0xDF, 0x96, 0x7B, 0x40, 0x08, 0xF5, 0x00, 0x00, 0x00,
+        0x0D, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x0D,
+        0xC0, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x01, 0xDF, 0x96, 0x7B, 0x40, 0x00, 0x19,
+        0xDF, 0xDA, 0x20, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00,
+        0x04, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x3B, 0xEE, 0x85, 0xF4, 0x02, 0xEE, 0x77, 0xCC,
+        0xF4, 0x09, 0xF3, 0x00, 0x1D, 0xF4, 0x0E, 0xB0, 0x00, 0x07, 0xF4, 0x0F, 0x90, 0x00, 0x05, 0xF4,
+        0x1F, 0x90, 0x00, 0x05, 0xF4, 0x0E, 0xB0, 0x00, 0x07, 0xF4, 0x09, 0xF2, 0x00, 0x1D, 0xF4, 0x02,
+        0xEE, 0x76, 0xCC, 0xF4, 0x00, 0x3B, 0xFE, 0x85, 0xF4, 0x00, 0x19, 0xDF, 0xD8, 0x00, 0x01, 0xDE,
+        0x86, 0x9F, 0xA0, 0x08, 0xF3, 0x00, 0x06, 0xF3, 0x0D, 0xB0, 0x00, 0x01, 0xF7, 0x0F, 0xFF, 0xFF,
+        0xFF, 0xF8, 0x0F, 0xA3, 0x33, 0x33, 0x32, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00,
+        0x11, 0x01, 0xCF, 0xA6, 0x79, 0xE3, 0x00, 0x18, 0xDF, 0xEC, 0x71, 0x00, 0x2B, 0xEF, 0x50, 0x00,
+        0xCD, 0x65, 0x20, 0x01, 0xF7, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x9F, 0xFF, 0xFE, 0x00, 0x26,
+        0xF8, 0x43, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x02,
+        0xF6, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x02,
+        0xF6, 0x00, 0x00, 0x00, 0x3B, 0xFE, 0x85, 0xF4, 0x02, 0xEE, 0x76, 0xCC, 0xF4, 0x09, 0xF2, 0x00,
+        0x1D, 0xF4, 0x0E, 0xB0, 0x00, 0x07, 0xF4, 0x1F, 0x90, 0x00, 0x05, 0xF4, 0x1F, 0x90, 0x00, 0x05,
+        0xF4, 0x0E, 0xB0, 0x00, 0x07, 0xF4, 0x09, 0xF2, 0x00, 0x1D, 0xF4, 0x02, 0xEE, 0x76, 0xCC, 0xF4,
+        0x00, 0x3B, 0xFE, 0x85, 0xF3, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x1D, 0xD0, 0x00,
+        0xD8, 0x67, 0xDF, 0x50, 0x00, 0x9D, 0xEE, 0xC5, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10,
+        0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x29, 0xEE,
+        0xA1, 0x00, 0x7F, 0xCB, 0x79, 0xFB, 0x00, 0x7F, 0xA0, 0x00, 0x8F, 0x20, 0x7F, 0x30, 0x00, 0x4F,
+        0x40, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50,
+        0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x6F,
+        0x20, 0x6F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F,
+        0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F,
+        0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20,
+        0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00,
+        0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x8F, 0x10, 0x26, 0xEC, 0x00, 0x5E, 0xB2,
+        0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00,
+        0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x01, 0xCD, 0x20, 0x7F, 0x10, 0x2D, 0xD2, 0x00, 0x7F,
+        0x12, 0xDD, 0x20, 0x00, 0x7F, 0x4D, 0xC1, 0x00, 0x00, 0x7F, 0xED, 0x10, 0x00, 0x00, 0x7F, 0x9F,
+        0x70, 0x00, 0x00, 0x7F, 0x19, 0xF6, 0x00, 0x00, 0x7F, 0x10, 0x9F, 0x60, 0x00, 0x7F, 0x10, 0x0A,
+        0xF5, 0x00, 0x7F, 0x10, 0x00, 0xAF, 0x50, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F,
+        0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F,
+        0x20, 0x6F, 0x20, 0x7F, 0x29, 0xEE, 0x90, 0x19, 0xEE, 0x90, 0x00, 0x7F, 0xCB, 0x7A, 0xF8, 0xBB,
+        0x7A, 0xF8, 0x00, 0x7F, 0xA0, 0x00, 0xBF, 0xA0, 0x00, 0xBE, 0x00, 0x7F, 0x30, 0x00, 0x8F, 0x30,
+        0x00, 0x7F, 0x10, 0x7F, 0x10, 0x00, 0x7F, 0x20, 0x00, 0x6F, 0x20, 0x7F, 0x10, 0x00, 0x7F, 0x10,
+        0x00, 0x6F, 0x20, 0x7F, 0x10, 0x00, 0x7F, 0x10, 0x00, 0x6F, 0x20, 0x7F, 0x10, 0x00, 0x7F, 0x10,
+        0x00, 0x6F, 0x20, 0x7F, 0x10, 0x00, 0x7F, 0x10, 0x00, 0x6F, 0x20, 0x7F, 0x10, 0x00, 0x7F, 0x10,
+        0x00, 0x6F, 0x20, 0x7F, 0x3A, 0xEE, 0xA1, 0x00, 0x7F, 0xD8, 0x35, 0xEB, 0x00, 0x7F, 0x80, 0x00,
+        0x7F, 0x20, 0x7F, 0x30, 0x00, 0x4F, 0x40, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F,
+        0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50,
+        0x7F, 0x10, 0x00, 0x3F, 0x50, 0x00, 0x2A, 0xEF, 0xC5, 0x00, 0x02, 0xEE, 0x87, 0xCF, 0x60, 0x09,
+        0xF3, 0x00, 0x0C, 0xE1, 0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x0F, 0x90, 0x00, 0x03, 0xF7, 0x0F, 0x90,
+        0x00, 0x03, 0xF6, 0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x09, 0xF3, 0x00, 0x0C, 0xE1, 0x02, 0xEE, 0x87,
+        0xCF, 0x60, 0x00, 0x2A, 0xEF, 0xC5, 0x00, 0x7F, 0x3A, 0xEE, 0xA1, 0x00, 0x7F, 0xD7, 0x24, 0xDC,
+        0x00, 0x7F, 0x90, 0x00, 0x4F, 0x60, 0x7F, 0x40, 0x00, 0x0D, 0xB0, 0x7F, 0x20, 0x00, 0x0B, 0xC0,
+        0x7F, 0x20, 0x00, 0x0C, 0xC0, 0x7F, 0x50, 0x00, 0x0E, 0xB0, 0x7F, 0xB0, 0x00, 0x6F, 0x60, 0x7F,
+        0xCB, 0x68, 0xFC, 0x00, 0x7F, 0x2A, 0xEE, 0xA1, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10,
+        0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xEE,
+        0x85, 0xF4, 0x02, 0xEE, 0x77, 0xCC, 0xF4, 0x09, 0xF3, 0x00, 0x1D, 0xF4, 0x0E, 0xB0, 0x00, 0x07,
+        0xF4, 0x0F, 0x90, 0x00, 0x05, 0xF4, 0x1F, 0x90, 0x00, 0x05, 0xF4, 0x0E, 0xB0, 0x00, 0x07, 0xF4,
+        0x09, 0xF2, 0x00, 0x1D, 0xF4, 0x02, 0xEE, 0x76, 0xCC, 0xF4, 0x00, 0x3B, 0xFE, 0x85, 0xF4, 0x00,
+        0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00,
+        0x00, 0x04, 0xF4, 0x00, 0x00, 0x01, 0x7F, 0x3A, 0xEF, 0x7F, 0xD8, 0x45, 0x7F, 0x90, 0x00, 0x7F,
+        0x30, 0x00, 0x7F, 0x20, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x10,
+        0x00, 0x7F, 0x10, 0x00, 0x01, 0x8D, 0xFE, 0xC4, 0x00, 0x0A, 0xF8, 0x67, 0xA7, 0x00, 0x0E, 0x80,
+        0x00, 0x00, 0x00, 0x0D, 0xC2, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xC8, 0x30, 0x00, 0x00, 0x16, 0xAE,
+        0xF6, 0x00, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x01, 0x00, 0x00, 0xAF, 0x00, 0x1E, 0x97, 0x69, 0xFA,
+        0x00, 0x08, 0xCE, 0xED, 0x70, 0x00, 0x03, 0x81, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF2,
+        0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x40, 0x29, 0xF5, 0x44, 0x10, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF2,
+        0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF3,
+        0x00, 0x00, 0x03, 0xFB, 0x65, 0x10, 0x00, 0x7D, 0xFF, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F,
+        0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00,
+        0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x5F, 0x40, 0x7F, 0x10, 0x00, 0x7F, 0x40, 0x5F, 0x40, 0x01,
+        0xDF, 0x40, 0x1E, 0xE7, 0x7D, 0xCF, 0x40, 0x03, 0xCF, 0xD7, 0x5F, 0x40, 0x5F, 0x40, 0x00, 0x04,
+        0xF6, 0x0E, 0xA0, 0x00, 0x09, 0xF1, 0x09, 0xE1, 0x00, 0x0E, 0xA0, 0x04, 0xF5, 0x00, 0x4F, 0x50,
+        0x00, 0xEA, 0x00, 0x9E, 0x00, 0x00, 0x9F, 0x10, 0xE9, 0x00, 0x00, 0x3F, 0x65, 0xF4, 0x00, 0x00,
+        0x0D, 0xBA, 0xE0, 0x00, 0x00, 0x08, 0xFE, 0x90, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0x50,
+        0x01, 0xFE, 0x00, 0x07, 0xF1, 0x0E, 0x90, 0x05, 0xFF, 0x30, 0x0B, 0xC0, 0x0A, 0xD0, 0x08, 0xCD,
+        0x70, 0x0E, 0x90, 0x07, 0xF1, 0x0C, 0x8A, 0xB0, 0x3F, 0x50, 0x03, 0xF5, 0x1F, 0x46, 0xE0, 0x7F,
+        0x10, 0x00, 0xE9, 0x4F, 0x12, 0xF3, 0xAD, 0x00, 0x00, 0xBD, 0x8C, 0x00, 0xE7, 0xE9, 0x00, 0x00,
+        0x7F, 0xD8, 0x00, 0xAD, 0xF6, 0x00, 0x00, 0x3F, 0xF5, 0x00, 0x6F, 0xF2, 0x00, 0x00, 0x0E, 0xF1,
+        0x00, 0x3F, 0xD0, 0x00, 0x0C, 0xD1, 0x00, 0x0C, 0xE1, 0x03, 0xF9, 0x00, 0x8F, 0x40, 0x00, 0x7F,
+        0x53, 0xF9, 0x00, 0x00, 0x0C, 0xED, 0xD1, 0x00, 0x00, 0x02, 0xFF, 0x30, 0x00, 0x00, 0x06, 0xFF,
+        0x60, 0x00, 0x00, 0x2E, 0xBB, 0xE2, 0x00, 0x00, 0xCE, 0x11, 0xEC, 0x00, 0x07, 0xF5, 0x00, 0x5F,
+        0x70, 0x3F, 0xA0, 0x00, 0x0A, 0xF3, 0x5F, 0x50, 0x00, 0x04, 0xF5, 0x0E, 0xA0, 0x00, 0x09, 0xE1,
+        0x08, 0xF1, 0x00, 0x0E, 0x90, 0x03, 0xF6, 0x00, 0x5F, 0x40, 0x00, 0xCB, 0x00, 0xBD, 0x00, 0x00,
+        0x7F, 0x21, 0xF8, 0x00, 0x00, 0x1F, 0x77, 0xF2, 0x00, 0x00, 0x0A, 0xDC, 0xC0, 0x00, 0x00, 0x05,
+        0xFF, 0x60, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x05, 0xF5,
+        0x00, 0x00, 0x03, 0x6D, 0xD0, 0x00, 0x00, 0x0A, 0xFC, 0x30, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+        0x30, 0x04, 0x44, 0x44, 0xDF, 0x20, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x4F, 0x90, 0x00,
+        0x00, 0x02, 0xEC, 0x00, 0x00, 0x00, 0x1C, 0xE1, 0x00, 0x00, 0x00, 0xAF, 0x30, 0x00, 0x00, 0x07,
+        0xF6, 0x00, 0x00, 0x00, 0x3F, 0xC4, 0x44, 0x44, 0x10, 0x4F, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x05,
+        0xCF, 0xA0, 0x00, 0x1F, 0xC5, 0x30, 0x00, 0x4F, 0x50, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x4F,
+        0x40, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x13, 0xCD, 0x00, 0x00, 0xDF, 0xE3,
+        0x00, 0x00, 0x35, 0xDD, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x4F,
+        0x40, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x2F, 0x91, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00,
+        0x13, 0x20, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
+        0xD8, 0xD8, 0xD8, 0xD8, 0xDE, 0xC3, 0x00, 0x00, 0x35, 0xDD, 0x00, 0x00, 0x00, 0x8F, 0x10, 0x00,
+        0x00, 0x6F, 0x10, 0x00, 0x00, 0x6F, 0x10, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x5F, 0x30, 0x00,
+        0x00, 0x2F, 0xA2, 0x00, 0x00, 0x05, 0xFF, 0xA0, 0x00, 0x2E, 0xC5, 0x20, 0x00, 0x5F, 0x30, 0x00,
+        0x00, 0x6F, 0x10, 0x00, 0x00, 0x6F, 0x10, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x02, 0xBE, 0x00, 0x00,
+        0xDF, 0xF7, 0x00, 0x00, 0x33, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x01, 0x06, 0xDF,
+        0xFD, 0x84, 0x24, 0xB7, 0x3E, 0x95, 0x6A, 0xEF, 0xFF, 0xB2, 0x12, 0x00, 0x00, 0x03, 0x42, 0x00,
+        0x7F, 0x40, 0x7F, 0x40, 0x13, 0x10, 0x00, 0x00, 0x4C, 0x10, 0x5F, 0x20, 0x6F, 0x30, 0x7F, 0x40,
+        0x7F, 0x40, 0x7F, 0x40, 0x7F, 0x40, 0x7F, 0x40, 0x7F, 0x40, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+        0x67, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x5C, 0xFF, 0xD7, 0x06, 0xFC, 0xAA, 0x8B, 0x1F, 0xC0,
+        0x67, 0x00, 0x6F, 0x50, 0x67, 0x00, 0x8F, 0x20, 0x67, 0x00, 0x8F, 0x10, 0x67, 0x00, 0x7F, 0x30,
+        0x67, 0x00, 0x3F, 0x90, 0x67, 0x00, 0x0A, 0xF8, 0x78, 0x47, 0x00, 0x9F, 0xFF, 0xFA, 0x00, 0x01,
+        0x89, 0x20, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x07, 0xDF, 0xEA, 0x10, 0x00,
+        0x6F, 0xC7, 0x7C, 0x20, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x00, 0xFA,
+        0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xE0, 0x00, 0x23, 0xFB, 0x33,
+        0x30, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+        0x00, 0x77, 0xFD, 0x77, 0x77, 0x20, 0xEF, 0xFF, 0xFF, 0xFF, 0x50, 0x01, 0x00, 0x00, 0x00, 0x01,
+        0x00, 0x1D, 0x70, 0x01, 0x00, 0x9B, 0x00, 0x08, 0xF9, 0xEF, 0xDA, 0xF5, 0x00, 0x00, 0xAF, 0x85,
+        0x9F, 0x80, 0x00, 0x00, 0xD7, 0x00, 0x0A, 0xB0, 0x00, 0x01, 0xF3, 0x00, 0x06, 0xE0, 0x00, 0x00,
+        0xE6, 0x00, 0x09, 0xC0, 0x00, 0x00, 0xAE, 0x52, 0x6F, 0x70, 0x00, 0x05, 0xFC, 0xFF, 0xFC, 0xE3,
+        0x00, 0x1E, 0x90, 0x24, 0x10, 0xBC, 0x00, 0x03, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1E, 0x80, 0x00,
+        0x00, 0xBD, 0x00, 0x08, 0xE1, 0x00, 0x04, 0xF5, 0x00, 0x01, 0xE8, 0x00, 0x0B, 0xC0, 0x00, 0x00,
+        0x8F, 0x20, 0x4F, 0x40, 0x00, 0x00, 0x1E, 0x90, 0xCC, 0x00, 0x00, 0x0C, 0xEF, 0xF7, 0xFF, 0xE9,
+        0x00, 0x02, 0x22, 0xEF, 0xB2, 0x21, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x0C, 0xEE, 0xEF,
+        0xEE, 0xE9, 0x00, 0x02, 0x22, 0x7F, 0x52, 0x21, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x85, 0xD8, 0xD8, 0xD8, 0xD8,
+        0xD8, 0xD8, 0x00, 0x00, 0x85, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0x00, 0x7D, 0xFD, 0x80, 0x06,
+        0xF8, 0x57, 0xA0, 0x0A, 0xE0, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x01, 0xEF, 0x91, 0x00, 0x0B,
+        0xC7, 0xEE, 0x40, 0x2F, 0x30, 0x2C, 0xF3, 0x2F, 0x50, 0x01, 0xDA, 0x0C, 0xE4, 0x00, 0xAA, 0x01,
+        0xBF, 0x96, 0xF3, 0x00, 0x05, 0xEF, 0x70, 0x00, 0x00, 0x2D, 0xE0, 0x00, 0x00, 0x06, 0xF2, 0x05,
+        0x41, 0x2B, 0xE0, 0x07, 0xFF, 0xFE, 0x40, 0x00, 0x12, 0x20, 0x00, 0x2B, 0x50, 0xB8, 0x3F, 0x70,
+        0xFB, 0x00, 0x02, 0x8C, 0xDC, 0x82, 0x00, 0x00, 0x00, 0x5D, 0x61, 0x01, 0x6D, 0x50, 0x00, 0x04,
+        0xC1, 0x5B, 0xDD, 0x91, 0xC4, 0x00, 0x0D, 0x26, 0xF7, 0x33, 0x70, 0x1D, 0x00, 0x58, 0x0E, 0x80,
+        0x00, 0x00, 0x09, 0x50, 0x84, 0x2F, 0x40, 0x00, 0x00, 0x05, 0x80, 0xA3, 0x2F, 0x40, 0x00, 0x00,
+        0x03, 0xA0, 0x84, 0x0E, 0x70, 0x00, 0x00, 0x05, 0x80, 0x58, 0x07, 0xE5, 0x00, 0x40, 0x09, 0x50,
+        0x0D, 0x20, 0x7E, 0xFF, 0xB0, 0x2D, 0x00, 0x04, 0xC1, 0x00, 0x10, 0x01, 0xC4, 0x00, 0x00, 0x5D,
+        0x61, 0x01, 0x6D, 0x50, 0x00, 0x00, 0x02, 0x9D, 0xDD, 0x92, 0x00, 0x00, 0x05, 0xCE, 0xE9, 0x10,
+        0x05, 0x30, 0x2D, 0x70, 0x00, 0x00, 0x07, 0xB0, 0x03, 0xBE, 0xFF, 0xD0, 0x0E, 0x71, 0x07, 0xD0,
+        0x0E, 0x70, 0x3D, 0xD0, 0x05, 0xDF, 0xB7, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xD0,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x30, 0x2A, 0x00, 0xAE, 0x22, 0xDA, 0x0A, 0xD2, 0x3E, 0xA0,
+        0x9E, 0x21, 0xEA, 0x00, 0x5F, 0x70, 0xAE, 0x30, 0x04, 0xE8, 0x09, 0xE3, 0x00, 0x3E, 0x30, 0x8C,
+        0x00, 0x03, 0x20, 0x05, 0x02, 0x22, 0x22, 0x22, 0x22, 0x21, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+        0x15, 0x55, 0x55, 0x55, 0x55, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x02, 0x22, 0x21, 0x3F, 0xFF, 0xF4, 0x15, 0x55,
+        0x51, 0x00, 0x02, 0x8C, 0xDC, 0x82, 0x00, 0x00, 0x00, 0x5D, 0x61, 0x01, 0x6D, 0x50, 0x00, 0x04,
+        0xC1, 0x00, 0x00, 0x01, 0xC4, 0x00, 0x0D, 0x20, 0xED, 0xDC, 0x60, 0x1D, 0x00, 0x58, 0x00, 0xF4,
+        0x05, 0xF2, 0x09, 0x50, 0x84, 0x00, 0xF4, 0x04, 0xF2, 0x05, 0x80, 0xA3, 0x00, 0xFE, 0xEE, 0x50,
+        0x03, 0xA0, 0x84, 0x00, 0xF4, 0x3E, 0x50, 0x05, 0x80, 0x58, 0x00, 0xF4, 0x07, 0xE1, 0x09, 0x50,
+        0x0D, 0x20, 0xF4, 0x00, 0xD8, 0x2D, 0x00, 0x04, 0xC1, 0x00, 0x00, 0x01, 0xC4, 0x00, 0x00, 0x5D,
+        0x61, 0x01, 0x6D, 0x50, 0x00, 0x00, 0x02, 0x9D, 0xDD, 0x92, 0x00, 0x00, 0x01, 0x11, 0x11, 0x4F,
+        0xFF, 0xFB, 0x14, 0x44, 0x43, 0x04, 0xCE, 0x91, 0x2E, 0x63, 0xB9, 0x5B, 0x00, 0x3C, 0x3E, 0x30,
+        0x9A, 0x07, 0xFF, 0xC2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x00, 0x09,
+        0xC0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, 0x02, 0x22, 0x2A, 0xD2, 0x22, 0x21, 0x3F,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x15, 0x55, 0x5B, 0xD5, 0x55, 0x52, 0x00, 0x00, 0x09, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x17, 0x77, 0x77, 0x77, 0x77, 0x73, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x1B,
+        0xEE, 0xA1, 0x13, 0x01, 0xC9, 0x00, 0x00, 0xB8, 0x00, 0x07, 0xD1, 0x00, 0x7D, 0x20, 0x09, 0xC1,
+        0x00, 0x3F, 0xEE, 0xEB, 0x0B, 0xEE, 0xB2, 0x02, 0x00, 0xAB, 0x00, 0x01, 0xB7, 0x00, 0xBF, 0xD3,
+        0x00, 0x00, 0x9D, 0x11, 0x00, 0x9C, 0x2C, 0xEE, 0xB3, 0x00, 0x66, 0x00, 0x04, 0xF4, 0x00, 0x1D,
+        0x80, 0x00, 0x9B, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F,
+        0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00,
+        0x00, 0x5F, 0x40, 0x8F, 0x00, 0x00, 0x6F, 0x40, 0x8F, 0x50, 0x00, 0xBF, 0x40, 0x8F, 0xE8, 0x7B,
+        0xEF, 0xA3, 0x8F, 0x5D, 0xFB, 0x2C, 0xE4, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAE, 0xFF, 0xFF, 0x1E,
+        0xFF, 0xF4, 0x4F, 0x8F, 0xFF, 0xF3, 0x3F, 0xAF, 0xFF, 0xF3, 0x3F, 0x8F, 0xFF, 0xF3, 0x3F, 0x3F,
+        0xFF, 0xF3, 0x3F, 0x05, 0xDF, 0xF3, 0x3F, 0x00, 0x03, 0xF3, 0x3F, 0x00, 0x00, 0xE3, 0x3F, 0x00,
+        0x00, 0xE3, 0x3F, 0x00, 0x00, 0xE3, 0x3F, 0x00, 0x00, 0xE3, 0x3F, 0x00, 0x00, 0xE3, 0x3F, 0x00,
+        0x00, 0xE3, 0x3F, 0x00, 0x00, 0x82, 0x28, 0x13, 0x20, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x50, 0x00,
+        0x88, 0x10, 0x7C, 0x8F, 0xF7, 0x01, 0x10, 0xAD, 0xF3, 0x00, 0x31, 0xF3, 0x00, 0x00, 0xF3, 0x00,
+        0x00, 0xF3, 0x00, 0x00, 0xF3, 0x00, 0x00, 0xF3, 0x00, 0xAE, 0xFE, 0xC0, 0x01, 0x9E, 0xE9, 0x10,
+        0x0A, 0xC2, 0x1B, 0xA0, 0x1F, 0x40, 0x04, 0xF1, 0x2F, 0x20, 0x02, 0xF2, 0x1F, 0x40, 0x04, 0xF1,
+        0x0A, 0xC2, 0x2C, 0xA0, 0x01, 0x9E, 0xE9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xD0,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0xA2, 0x00, 0x00, 0x4F, 0x70, 0x9D, 0x20, 0x00, 0x04,
+        0xE8, 0x0A, 0xE3, 0x00, 0x00, 0x4F, 0x60, 0xAE, 0x10, 0x00, 0xAE, 0x33, 0xEA, 0x00, 0x1B, 0xD2,
+        0x3E, 0x90, 0x00, 0x6D, 0x20, 0xC8, 0x00, 0x00, 0x31, 0x00, 0x50, 0x00, 0x00, 0x36, 0x81, 0x00,
+        0x00, 0x00, 0x65, 0x00, 0x00, 0xA9, 0xF3, 0x00, 0x00, 0x03, 0xF3, 0x00, 0x00, 0x00, 0xF3, 0x00,
+        0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0x5E, 0x10, 0x00, 0x00, 0x00, 0xF3, 0x00,
+        0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x00,
+        0x1E, 0x50, 0x00, 0x66, 0x00, 0xAE, 0xFE, 0xD0, 0x9B, 0x00, 0x05, 0xEC, 0x00, 0x00, 0x00, 0x03,
+        0xF3, 0x00, 0x2C, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0xB3, 0x6C, 0x00, 0x00, 0x00, 0x5E,
+        0x10, 0x08, 0x60, 0x6C, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x0C, 0xEE, 0xFF, 0xD0, 0x00, 0x07, 0xD0,
+        0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x00, 0x00, 0x49, 0x00, 0x9D, 0xF3, 0x00,
+        0x00, 0x00, 0xD7, 0x00, 0x00, 0x53, 0xF3, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xF3, 0x00,
+        0x00, 0x1E, 0x40, 0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x00,
+        0x04, 0xE2, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x00, 0x0C, 0x70, 0x00, 0x00, 0x00, 0xAE, 0xFE, 0xD0,
+        0x6D, 0x07, 0xEE, 0xD7, 0x00, 0x00, 0x00, 0x01, 0xE5, 0x00, 0x00, 0x4F, 0x30, 0x00, 0x00, 0x09,
+        0xB0, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x01, 0xC8, 0x00, 0x00, 0x00, 0xC8,
+        0x00, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x06, 0xD1, 0x00, 0x02, 0xC7, 0x00, 0x00, 0x00, 0x1E, 0x50,
+        0x00, 0x08, 0xFF, 0xFF, 0x60, 0x0B, 0xEE, 0xA2, 0x00, 0x00, 0x0C, 0x70, 0x00, 0x03, 0x01, 0xAA,
+        0x00, 0x00, 0x6E, 0x10, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x01, 0xD6, 0x00, 0x00, 0x00, 0xCF, 0xD2,
+        0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xB8, 0x00, 0x1E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x5E,
+        0x00, 0x9B, 0x00, 0x00, 0x00, 0x13, 0x01, 0xBB, 0x02, 0xF3, 0x00, 0x09, 0x90, 0x2C, 0xEE, 0xA2,
+        0x0B, 0x90, 0x00, 0x6D, 0xC0, 0x00, 0x00, 0x00, 0x4E, 0x20, 0x02, 0xC6, 0xC0, 0x00, 0x00, 0x00,
+        0xC8, 0x00, 0x0C, 0x26, 0xC0, 0x00, 0x00, 0x06, 0xE1, 0x00, 0x86, 0x06, 0xC0, 0x00, 0x00, 0x1D,
+        0x60, 0x00, 0xCE, 0xEF, 0xFD, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x01, 0xE4,
+        0x00, 0x00, 0x00, 0x04, 0x90, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x03, 0x30,
+        0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x4F, 0x80,
+        0x00, 0x02, 0xED, 0x10, 0x00, 0x1D, 0xE3, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0xCE, 0x00, 0x00,
+        0x00, 0xAF, 0x10, 0x00, 0x50, 0x4F, 0xD7, 0x8D, 0xC0, 0x05, 0xCE, 0xD9, 0x20, 0x00, 0x00, 0x74,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x04, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xF5, 0x00,
+        0x00, 0x00, 0x01, 0xF6, 0xCA, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x7F, 0x10, 0x00, 0x00, 0x0C, 0xB0,
+        0x2F, 0x60, 0x00, 0x00, 0x2F, 0x50, 0x0B, 0xB0, 0x00, 0x00, 0x8E, 0x10, 0x06, 0xF2, 0x00, 0x00,
+        0xDB, 0x22, 0x23, 0xF7, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x09, 0xE5, 0x55, 0x55, 0x8F,
+        0x30, 0x0E, 0xA0, 0x00, 0x00, 0x1F, 0x90, 0x5F, 0x50, 0x00, 0x00, 0x0B, 0xE0, 0xAF, 0x10, 0x00,
+        0x00, 0x06, 0xF5, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x08, 0xC1, 0x00, 0x00, 0x00,
+        0x00, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x00,
+        0x00, 0x00, 0x00, 0xAD, 0xF5, 0x00, 0x00, 0x00, 0x01, 0xF6, 0xCA, 0x00, 0x00, 0x00, 0x06, 0xF1,
+        0x7F, 0x10, 0x00, 0x00, 0x0C, 0xB0, 0x2F, 0x60, 0x00, 0x00, 0x2F, 0x50, 0x0B, 0xB0, 0x00, 0x00,
+        0x8E, 0x10, 0x06, 0xF2, 0x00, 0x00, 0xDB, 0x22, 0x23, 0xF7, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD,
+        0x00, 0x09, 0xE5, 0x55, 0x55, 0x8F, 0x30, 0x0E, 0xA0, 0x00, 0x00, 0x1F, 0x90, 0x5F, 0x50, 0x00,
+        0x00, 0x0B, 0xE0, 0xAF, 0x10, 0x00, 0x00, 0x06, 0xF5, 0x00, 0x00, 0x17, 0x60, 0x00, 0x00, 0x00,
+        0x01, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x04, 0x50, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x5F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xF5, 0x00, 0x00, 0x00, 0x01, 0xF6,
+        0xCA, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x7F, 0x10, 0x00, 0x00, 0x0C, 0xB0, 0x2F, 0x60, 0x00, 0x00,
+        0x2F, 0x50, 0x0B, 0xB0, 0x00, 0x00, 0x8E, 0x10, 0x06, 0xF2, 0x00, 0x00, 0xDB, 0x22, 0x23, 0xF7,
+        0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x09, 0xE5, 0x55, 0x55, 0x8F, 0x30, 0x0E, 0xA0, 0x00,
+        0x00, 0x1F, 0x90, 0x5F, 0x50, 0x00, 0x00, 0x0B, 0xE0, 0xAF, 0x10, 0x00, 0x00, 0x06, 0xF5, 0x00,
+        0x05, 0xDA, 0x28, 0x70, 0x00, 0x00, 0x0D, 0x57, 0xEE, 0x20, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xAD,
+        0xF5, 0x00, 0x00, 0x00, 0x01, 0xF6, 0xCA, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x7F, 0x10, 0x00, 0x00,
+        0x0C, 0xB0, 0x2F, 0x60, 0x00, 0x00, 0x2F, 0x50, 0x0B, 0xB0, 0x00, 0x00, 0x8E, 0x10, 0x06, 0xF2,
+        0x00, 0x00, 0xDB, 0x22, 0x23, 0xF7, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x09, 0xE5, 0x55,
+        0x55, 0x8F, 0x30, 0x0E, 0xA0, 0x00, 0x00, 0x1F, 0x90, 0x5F, 0x50, 0x00, 0x00, 0x0B, 0xE0, 0xAF,
+        0x10, 0x00, 0x00, 0x06, 0xF5, 0x00, 0x0A, 0xF0, 0x6F, 0x40, 0x00, 0x00, 0x08, 0xC0, 0x5C, 0x30,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xAD,
+        0xF5, 0x00, 0x00, 0x00, 0x01, 0xF6, 0xCA, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x7F, 0x10, 0x00, 0x00,
+        0x0C, 0xB0, 0x2F, 0x60, 0x00, 0x00, 0x2F, 0x50, 0x0B, 0xB0, 0x00, 0x00, 0x8E, 0x10, 0x06, 0xF2,
+        0x00, 0x00, 0xDB, 0x22, 0x23, 0xF7, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x09, 0xE5, 0x55,
+        0x55, 0x8F, 0x30, 0x0E, 0xA0, 0x00, 0x00, 0x1F, 0x90, 0x5F, 0x50, 0x00, 0x00, 0x0B, 0xE0, 0xAF,
+        0x10, 0x00, 0x00, 0x06, 0xF5, 0x00, 0x00, 0x6D, 0xC3, 0x00, 0x00, 0x00, 0x03, 0xE3, 0x7D, 0x00,
+        0x00, 0x00, 0x06, 0x90, 0x0F, 0x10, 0x00, 0x00, 0x03, 0xD2, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x9F,
+        0xF4, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xF6, 0xCC, 0x00, 0x00, 0x00,
+        0x07, 0xF1, 0x7F, 0x20, 0x00, 0x00, 0x0D, 0xB0, 0x2F, 0x70, 0x00, 0x00, 0x3F, 0x60, 0x0B, 0xC0,
+        0x00, 0x00, 0x8F, 0x10, 0x06, 0xF3, 0x00, 0x00, 0xDB, 0x22, 0x23, 0xF8, 0x00, 0x04, 0xFF, 0xFF,
+        0xFF, 0xFD, 0x00, 0x09, 0xE5, 0x55, 0x55, 0x8F, 0x40, 0x0E, 0xA0, 0x00, 0x00, 0x1F, 0x90, 0x5F,
+        0x50, 0x00, 0x00, 0x0B, 0xE0, 0xAF, 0x10, 0x00, 0x00, 0x06, 0xF5, 0x00, 0x00, 0x0E, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x5F, 0xAB, 0xF9, 0x77, 0x77, 0x72, 0x00, 0x00, 0xBE, 0x18, 0xF3,
+        0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x08, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF2, 0x08, 0xF4,
+        0x22, 0x22, 0x20, 0x00, 0x0E, 0xA0, 0x08, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x5F, 0x40, 0x08, 0xF7,
+        0x55, 0x55, 0x50, 0x00, 0xBD, 0x22, 0x29, 0xF3, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF3,
+        0x00, 0x00, 0x00, 0x08, 0xF5, 0x55, 0x5A, 0xF3, 0x00, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x08, 0xF3,
+        0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x08, 0xF9, 0x77, 0x77, 0x73, 0xBE, 0x00, 0x00, 0x08, 0xFF,
+        0xFF, 0xFF, 0xF7, 0x00, 0x01, 0x8C, 0xEE, 0xC8, 0x10, 0x00, 0x3E, 0xFB, 0x87, 0xAE, 0xE0, 0x01,
+        0xEE, 0x30, 0x00, 0x01, 0x90, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00,
+        0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0xEE, 0x30, 0x00, 0x01, 0x90, 0x00, 0x3E, 0xFA, 0x77, 0xAE, 0xE0, 0x00, 0x01, 0x8D, 0xFF, 0xC8,
+        0x10, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x30, 0x00, 0x00, 0x00, 0x03,
+        0x3E, 0x40, 0x00, 0x00, 0x00, 0x1E, 0xFA, 0x00, 0x00, 0x00, 0x27, 0x20, 0x00, 0x00, 0x00, 0x08,
+        0xD1, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF,
+        0xFF, 0x80, 0x5F, 0xA7, 0x77, 0x77, 0x40, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00,
+        0x00, 0x5F, 0x72, 0x22, 0x22, 0x10, 0x5F, 0xFF, 0xFF, 0xFF, 0x40, 0x5F, 0x85, 0x55, 0x55, 0x10,
+        0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F,
+        0x50, 0x00, 0x00, 0x00, 0x5F, 0xA7, 0x77, 0x77, 0x50, 0x5F, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+        0x17, 0x20, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x80, 0x5F, 0xA7, 0x77, 0x77, 0x40, 0x5F, 0x50, 0x00, 0x00,
+        0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x72, 0x22, 0x22, 0x10, 0x5F, 0xFF, 0xFF, 0xFF, 0x40,
+        0x5F, 0x85, 0x55, 0x55, 0x10, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F,
+        0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0xA7, 0x77, 0x77, 0x50, 0x5F, 0xFF,
+        0xFF, 0xFF, 0xA0, 0x00, 0x03, 0x84, 0x00, 0x00, 0x00, 0x2D, 0x6D, 0x40, 0x00, 0x00, 0x63, 0x02,
+        0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x80, 0x5F, 0xA7, 0x77, 0x77,
+        0x40, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x72, 0x22, 0x22, 0x10,
+        0x5F, 0xFF, 0xFF, 0xFF, 0x40, 0x5F, 0x85, 0x55, 0x55, 0x10, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F,
+        0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0xA7,
+        0x77, 0x77, 0x50, 0x5F, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0xEC, 0x0A, 0xF0, 0x00, 0x00, 0xA9, 0x08,
+        0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x80, 0x5F, 0xA7, 0x77, 0x77,
+        0x40, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x72, 0x22, 0x22, 0x10,
+        0x5F, 0xFF, 0xFF, 0xFF, 0x40, 0x5F, 0x85, 0x55, 0x55, 0x10, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F,
+        0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0xA7,
+        0x77, 0x77, 0x50, 0x5F, 0xFF, 0xFF, 0xFF, 0xA0, 0x28, 0x20, 0x08, 0xC1, 0x00, 0x63, 0x00, 0x00,
+        0x05, 0xF5, 0x05, 0xF5, 0x05, 0xF5, 0x05, 0xF5, 0x05, 0xF5, 0x05, 0xF5, 0x05, 0xF5, 0x05, 0xF5,
+        0x05, 0xF5, 0x05, 0xF5, 0x05, 0xF5, 0x05, 0xF5, 0x05, 0xF5, 0x02, 0x82, 0x1C, 0x80, 0x36, 0x00,
+        0x00, 0x00, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50,
+        0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x00, 0x48, 0x40, 0x00,
+        0x03, 0xD6, 0xD3, 0x00, 0x06, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00,
+        0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00,
+        0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00,
+        0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00,
+        0xEB, 0x0B, 0xF0, 0xB8, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00, 0x05,
+        0xF5, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5,
+        0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00,
+        0x04, 0xFF, 0xFF, 0xEC, 0x82, 0x00, 0x00, 0x04, 0xFA, 0x77, 0x8B, 0xFE, 0x50, 0x00, 0x04, 0xF7,
+        0x00, 0x00, 0x3D, 0xF3, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x04, 0xF7, 0x00, 0x00,
+        0x00, 0xDE, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0xAF, 0x20, 0xEF, 0xFF, 0xFF, 0x30, 0x00, 0x9F,
+        0x20, 0x36, 0xF8, 0x33, 0x10, 0x00, 0xAF, 0x20, 0x04, 0xF7, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x04,
+        0xF7, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x3D, 0xF3, 0x00, 0x04, 0xFA, 0x77,
+        0x8B, 0xFE, 0x50, 0x00, 0x04, 0xFF, 0xFF, 0xEC, 0x82, 0x00, 0x00, 0x00, 0x0A, 0xD6, 0x1E, 0x00,
+        0x00, 0x00, 0x4C, 0x3B, 0xF9, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x5F, 0xF3, 0x00, 0x00, 0x9F, 0x10, 0x5F, 0xFA, 0x00, 0x00, 0x9F, 0x10, 0x5F,
+        0xCF, 0x30, 0x00, 0x9F, 0x10, 0x5F, 0x5E, 0xA0, 0x00, 0x9F, 0x10, 0x5F, 0x48, 0xF3, 0x00, 0x9F,
+        0x10, 0x5F, 0x41, 0xEB, 0x00, 0x9F, 0x10, 0x5F, 0x40, 0x7F, 0x30, 0x9F, 0x10, 0x5F, 0x40, 0x1E,
+        0xB0, 0x9F, 0x10, 0x5F, 0x40, 0x07, 0xF3, 0x9F, 0x10, 0x5F, 0x40, 0x01, 0xEB, 0x9F, 0x10, 0x5F,
+        0x40, 0x00, 0x7F, 0xCF, 0x10, 0x5F, 0x40, 0x00, 0x1E, 0xFF, 0x10, 0x5F, 0x40, 0x00, 0x07, 0xFF,
+        0x10, 0x00, 0x00, 0x1D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE3, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9D,
+        0xFE, 0xB4, 0x00, 0x00, 0x00, 0x4E, 0xFA, 0x78, 0xDF, 0x80, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x0A,
+        0xF6, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x01, 0xED, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0x30,
+        0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x5F, 0x60, 0x0F, 0xC0,
+        0x00, 0x00, 0x00, 0x6F, 0x50, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x08, 0xF5, 0x00, 0x00,
+        0x01, 0xED, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x0A, 0xF6, 0x00, 0x00, 0x4E, 0xF9, 0x78, 0xDF, 0x80,
+        0x00, 0x00, 0x02, 0x9D, 0xFE, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xB4, 0x00, 0x00, 0x00, 0x4E, 0xFA, 0x78, 0xDF,
+        0x80, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x0A, 0xF6, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x01, 0xED, 0x00,
+        0x0C, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x0F, 0xB0,
+        0x00, 0x00, 0x00, 0x5F, 0x60, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x0C, 0xE0, 0x00, 0x00,
+        0x00, 0x9F, 0x30, 0x08, 0xF5, 0x00, 0x00, 0x01, 0xED, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x0A, 0xF6,
+        0x00, 0x00, 0x4E, 0xF9, 0x78, 0xDF, 0x80, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xB5, 0x00, 0x00, 0x00,
+        0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x3B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x54,
+        0x01, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xB4,
+        0x00, 0x00, 0x00, 0x4E, 0xFA, 0x78, 0xDF, 0x80, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x0A, 0xF6, 0x00,
+        0x08, 0xF6, 0x00, 0x00, 0x01, 0xED, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x0F, 0xC0,
+        0x00, 0x00, 0x00, 0x6F, 0x50, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x5F, 0x60, 0x0F, 0xC0, 0x00, 0x00,
+        0x00, 0x6F, 0x50, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x08, 0xF5, 0x00, 0x00, 0x01, 0xED,
+        0x00, 0x01, 0xEE, 0x30, 0x00, 0x0A, 0xF6, 0x00, 0x00, 0x4E, 0xF9, 0x78, 0xDF, 0x80, 0x00, 0x00,
+        0x02, 0x9D, 0xFE, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x91, 0xA5, 0x00, 0x00, 0x00, 0x00, 0xE4,
+        0x8E, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xB4, 0x00, 0x00, 0x00, 0x4E, 0xFA, 0x78, 0xDF, 0x80, 0x00,
+        0x01, 0xEE, 0x30, 0x00, 0x0A, 0xF6, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x01, 0xED, 0x00, 0x0C, 0xE0,
+        0x00, 0x00, 0x00, 0x9F, 0x30, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x0F, 0xB0, 0x00, 0x00,
+        0x00, 0x5F, 0x60, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x9F,
+        0x30, 0x08, 0xF5, 0x00, 0x00, 0x01, 0xED, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x0A, 0xF6, 0x00, 0x00,
+        0x4E, 0xF9, 0x78, 0xDF, 0x80, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x9B,
+        0x06, 0xC2, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x08, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xB4, 0x00, 0x00,
+        0x00, 0x4E, 0xFA, 0x78, 0xDF, 0x80, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x0A, 0xF6, 0x00, 0x08, 0xF6,
+        0x00, 0x00, 0x01, 0xED, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x0F, 0xC0, 0x00, 0x00,
+        0x00, 0x6F, 0x50, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x5F, 0x60, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F,
+        0x50, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x08, 0xF5, 0x00, 0x00, 0x01, 0xED, 0x00, 0x01,
+        0xEE, 0x30, 0x00, 0x0A, 0xF6, 0x00, 0x00, 0x4E, 0xF9, 0x78, 0xDF, 0x80, 0x00, 0x00, 0x02, 0x9D,
+        0xFE, 0xB5, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x42, 0x6F, 0x60, 0x00, 0x03, 0xEA, 0x09, 0xF5,
+        0x00, 0x3E, 0xC1, 0x00, 0xAF, 0x52, 0xED, 0x10, 0x00, 0x0B, 0xFE, 0xD2, 0x00, 0x00, 0x02, 0xFF,
+        0x60, 0x00, 0x00, 0x1D, 0xEC, 0xE3, 0x00, 0x01, 0xCE, 0x31, 0xCE, 0x30, 0x1C, 0xE3, 0x00, 0x1D,
+        0xE2, 0x6F, 0x40, 0x00, 0x02, 0xDA, 0x03, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xA4, 0x1E, 0x40, 0x00, 0x4E, 0xFA, 0x78, 0xDF, 0xDA, 0x00,
+        0x01, 0xEE, 0x30, 0x00, 0x1D, 0xF5, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x8A, 0xDD, 0x00, 0x0C, 0xE0,
+        0x00, 0x05, 0xD1, 0x8F, 0x30, 0x0F, 0xC0, 0x00, 0x3E, 0x20, 0x6F, 0x50, 0x0F, 0xB0, 0x02, 0xE4,
+        0x00, 0x5F, 0x60, 0x0F, 0xC0, 0x1C, 0x70, 0x00, 0x6F, 0x50, 0x0C, 0xE1, 0xBA, 0x00, 0x00, 0x9F,
+        0x30, 0x08, 0xFC, 0xC1, 0x00, 0x01, 0xED, 0x00, 0x01, 0xEF, 0x50, 0x00, 0x0A, 0xF6, 0x00, 0x04,
+        0xEE, 0xFA, 0x78, 0xDF, 0x90, 0x00, 0x0D, 0x61, 0x8D, 0xFE, 0xB5, 0x00, 0x00, 0x02, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE2, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x00,
+        0x17, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00,
+        0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00,
+        0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF,
+        0x7F, 0x30, 0x00, 0x00, 0xBE, 0x5F, 0x50, 0x00, 0x00, 0xEC, 0x1F, 0xC1, 0x00, 0x06, 0xF8, 0x07,
+        0xFD, 0x87, 0xAF, 0xD1, 0x00, 0x5C, 0xEF, 0xD9, 0x10, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00,
+        0x4E, 0x20, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x20, 0x00,
+        0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00,
+        0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF,
+        0x8F, 0x20, 0x00, 0x00, 0xBF, 0x7F, 0x30, 0x00, 0x00, 0xBE, 0x5F, 0x50, 0x00, 0x00, 0xEC, 0x1F,
+        0xC1, 0x00, 0x06, 0xF8, 0x07, 0xFD, 0x87, 0xAF, 0xD1, 0x00, 0x5C, 0xEF, 0xD9, 0x10, 0x00, 0x01,
+        0xDF, 0x50, 0x00, 0x00, 0x09, 0xA4, 0xE2, 0x00, 0x00, 0x17, 0x10, 0x44, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00,
+        0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF,
+        0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x7F, 0x30, 0x00, 0x00, 0xBE, 0x5F,
+        0x50, 0x00, 0x00, 0xEC, 0x1F, 0xC1, 0x00, 0x06, 0xF8, 0x07, 0xFD, 0x87, 0xAF, 0xD1, 0x00, 0x5C,
+        0xEF, 0xD9, 0x10, 0x00, 0x3C, 0x50, 0xC8, 0x00, 0x00, 0x4F, 0x70, 0xFA, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00,
+        0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF,
+        0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x7F,
+        0x30, 0x00, 0x00, 0xBE, 0x5F, 0x50, 0x00, 0x00, 0xEC, 0x1F, 0xC1, 0x00, 0x06, 0xF8, 0x07, 0xFD,
+        0x87, 0xAF, 0xD1, 0x00, 0x5C, 0xEF, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00,
+        0x03, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0B, 0xE2, 0x00, 0x00, 0x0B, 0xE2, 0x02, 0xEB, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x6F, 0x60, 0x01,
+        0xEC, 0x00, 0x00, 0x0C, 0xE1, 0x09, 0xF3, 0x00, 0x00, 0x02, 0xFA, 0x4F, 0x80, 0x00, 0x00, 0x00,
+        0x8F, 0xED, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0,
+        0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x5F, 0x50,
+        0x00, 0x00, 0x00, 0x5F, 0x62, 0x21, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xB3, 0x00, 0x5F, 0x85, 0x58,
+        0xFE, 0x10, 0x5F, 0x50, 0x00, 0x7F, 0x70, 0x5F, 0x50, 0x00, 0x3F, 0x90, 0x5F, 0x50, 0x00, 0x2F,
+        0xA0, 0x5F, 0x50, 0x00, 0x6F, 0x70, 0x5F, 0x62, 0x26, 0xEF, 0x20, 0x5F, 0xFF, 0xFF, 0xE5, 0x00,
+        0x5F, 0x85, 0x53, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x01,
+        0x9D, 0xFD, 0x50, 0x00, 0x0C, 0xE8, 0x6A, 0xF3, 0x00, 0x4F, 0x60, 0x00, 0xCA, 0x00, 0x6F, 0x20,
+        0x06, 0xDC, 0x00, 0x7F, 0x10, 0xAE, 0x52, 0x00, 0x7F, 0x12, 0xF6, 0x00, 0x00, 0x7F, 0x13, 0xF7,
+        0x00, 0x00, 0x7F, 0x10, 0xDF, 0x60, 0x00, 0x7F, 0x10, 0x2C, 0xFA, 0x00, 0x7F, 0x10, 0x00, 0x8F,
+        0x80, 0x7F, 0x10, 0x00, 0x0B, 0xD0, 0x7F, 0x10, 0x00, 0x0B, 0xC0, 0x7F, 0x1A, 0x76, 0x9F, 0x70,
+        0x7F, 0x1C, 0xEF, 0xD7, 0x00, 0x05, 0x70, 0x00, 0x00, 0x02, 0xD8, 0x00, 0x00, 0x00, 0x3E, 0x40,
+        0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDE, 0xEB, 0x30, 0x4D, 0x86, 0x7D,
+        0xF3, 0x10, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xDF, 0xFF, 0xFD, 0x9F, 0x84, 0x33,
+        0xBD, 0xEA, 0x00, 0x00, 0xCD, 0xEA, 0x00, 0x04, 0xFD, 0x9F, 0x96, 0x8E, 0xDD, 0x19, 0xEE, 0xC4,
+        0xAD, 0x00, 0x00, 0x17, 0x40, 0x00, 0x00, 0xAC, 0x10, 0x00, 0x07, 0xD1, 0x00, 0x00, 0x17, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDE, 0xEB, 0x30, 0x4D, 0x86, 0x7D, 0xF3, 0x10, 0x00, 0x01,
+        0xE9, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xDF, 0xFF, 0xFD, 0x9F, 0x84, 0x33, 0xBD, 0xEA, 0x00, 0x00,
+        0xCD, 0xEA, 0x00, 0x04, 0xFD, 0x9F, 0x96, 0x8E, 0xDD, 0x19, 0xEE, 0xC4, 0xAD, 0x00, 0x06, 0x50,
+        0x00, 0x00, 0x6D, 0xE3, 0x00, 0x02, 0xE3, 0x5D, 0x10, 0x04, 0x50, 0x06, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x29, 0xDE, 0xEB, 0x30, 0x4D, 0x86, 0x7D, 0xF3, 0x10, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x00,
+        0xBC, 0x07, 0xDF, 0xFF, 0xFD, 0x9F, 0x84, 0x33, 0xBD, 0xEA, 0x00, 0x00, 0xCD, 0xEA, 0x00, 0x04,
+        0xFD, 0x9F, 0x96, 0x8E, 0xDD, 0x19, 0xEE, 0xC4, 0xAD, 0x04, 0xEC, 0x37, 0x90, 0x0B, 0x77, 0xEF,
+        0x40, 0x02, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDE, 0xEB, 0x30, 0x4D, 0x86, 0x7D,
+        0xF3, 0x10, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xDF, 0xFF, 0xFD, 0x9F, 0x84, 0x33,
+        0xBD, 0xEA, 0x00, 0x00, 0xCD, 0xEA, 0x00, 0x04, 0xFD, 0x9F, 0x96, 0x8E, 0xDD, 0x19, 0xEE, 0xC4,
+        0xAD, 0x08, 0xF2, 0x4F, 0x60, 0x06, 0xB2, 0x3B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x29, 0xDE, 0xEB, 0x30, 0x4D, 0x86, 0x7D, 0xF3, 0x10, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x00,
+        0xBC, 0x07, 0xDF, 0xFF, 0xFD, 0x9F, 0x84, 0x33, 0xBD, 0xEA, 0x00, 0x00, 0xCD, 0xEA, 0x00, 0x04,
+        0xFD, 0x9F, 0x96, 0x8E, 0xDD, 0x19, 0xEE, 0xC4, 0xAD, 0x00, 0x5D, 0xC4, 0x00, 0x02, 0xE4, 0x5E,
+        0x00, 0x05, 0xB0, 0x0D, 0x20, 0x02, 0xE1, 0x3E, 0x10, 0x00, 0x7F, 0xE6, 0x00, 0x00, 0x01, 0x00,
+        0x00, 0x29, 0xDE, 0xEB, 0x30, 0x4D, 0x86, 0x7D, 0xF3, 0x10, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x00,
+        0xBC, 0x07, 0xDF, 0xFF, 0xFD, 0x9F, 0x84, 0x33, 0xBD, 0xEA, 0x00, 0x00, 0xCD, 0xEA, 0x00, 0x04,
+        0xFD, 0x9F, 0x96, 0x8E, 0xDD, 0x19, 0xEE, 0xC4, 0xAD, 0x29, 0xDE, 0xEB, 0x30, 0x6C, 0xFE, 0x91,
+        0x00, 0x4D, 0x86, 0x7D, 0xFB, 0xF9, 0x68, 0xED, 0x10, 0x10, 0x00, 0x01, 0xEF, 0x60, 0x00, 0x3F,
+        0x70, 0x00, 0x00, 0x00, 0xBE, 0x10, 0x00, 0x0C, 0xB0, 0x07, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xC0, 0x9F, 0x84, 0x33, 0xBD, 0x33, 0x33, 0x33, 0x30, 0xEA, 0x00, 0x00, 0xCF, 0x10, 0x00, 0x00,
+        0x00, 0xEA, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x10, 0x9F, 0x96, 0x8E, 0x79, 0xFB, 0x76, 0x8D,
+        0x70, 0x19, 0xDF, 0xC6, 0x00, 0x6C, 0xEE, 0xD8, 0x20, 0x00, 0x18, 0xDF, 0xDA, 0x20, 0x01, 0xDF,
+        0x96, 0x7B, 0x40, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00,
+        0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00,
+        0x00, 0x01, 0xDF, 0x96, 0x7B, 0x40, 0x00, 0x19, 0xDF, 0xEA, 0x20, 0x00, 0x00, 0x08, 0x80, 0x00,
+        0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0x26, 0xF0, 0x00, 0x00, 0x05, 0xEE, 0x70, 0x00, 0x00,
+        0x27, 0x30, 0x00, 0x00, 0x00, 0x08, 0xD1, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x00,
+        0x07, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xDF, 0xD8, 0x00, 0x01, 0xDE, 0x86,
+        0x9F, 0xA0, 0x08, 0xF3, 0x00, 0x06, 0xF3, 0x0D, 0xB0, 0x00, 0x01, 0xF7, 0x0F, 0xFF, 0xFF, 0xFF,
+        0xF8, 0x0F, 0xA3, 0x33, 0x33, 0x32, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x11,
+        0x01, 0xCF, 0xA6, 0x79, 0xE3, 0x00, 0x18, 0xDF, 0xEC, 0x71, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00,
+        0x00, 0x03, 0xF5, 0x00, 0x00, 0x00, 0x1D, 0x60, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x19, 0xDF, 0xD8, 0x00, 0x01, 0xDE, 0x86, 0x9F, 0xA0, 0x08, 0xF3, 0x00,
+        0x06, 0xF3, 0x0D, 0xB0, 0x00, 0x01, 0xF7, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xA3, 0x33, 0x33,
+        0x32, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x11, 0x01, 0xCF, 0xA6, 0x79, 0xE3,
+        0x00, 0x18, 0xDF, 0xEC, 0x71, 0x00, 0x00, 0x38, 0x10, 0x00, 0x00, 0x01, 0xDD, 0xA0, 0x00, 0x00,
+        0x09, 0xA1, 0xC6, 0x00, 0x00, 0x17, 0x10, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+        0xDF, 0xD8, 0x00, 0x01, 0xDE, 0x86, 0x9F, 0xA0, 0x08, 0xF3, 0x00, 0x06, 0xF3, 0x0D, 0xB0, 0x00,
+        0x01, 0xF7, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xA3, 0x33, 0x33, 0x32, 0x0D, 0xC0, 0x00, 0x00,
+        0x00, 0x08, 0xF5, 0x00, 0x00, 0x11, 0x01, 0xCF, 0xA6, 0x79, 0xE3, 0x00, 0x18, 0xDF, 0xEC, 0x71,
+        0x00, 0x1F, 0x90, 0xCD, 0x00, 0x00, 0x1B, 0x70, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xDF, 0xD8, 0x00, 0x01, 0xDE, 0x86, 0x9F, 0xA0, 0x08, 0xF3,
+        0x00, 0x06, 0xF3, 0x0D, 0xB0, 0x00, 0x01, 0xF7, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xA3, 0x33,
+        0x33, 0x32, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x11, 0x01, 0xCF, 0xA6, 0x79,
+        0xE3, 0x00, 0x18, 0xDF, 0xEC, 0x71, 0x28, 0x20, 0x00, 0x0A, 0xC0, 0x00, 0x01, 0xD7, 0x00, 0x00,
+        0x3E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F,
+        0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20,
+        0x00, 0x6F, 0x20, 0x00, 0x57, 0x00, 0x03, 0xF6, 0x00, 0x0C, 0x90, 0x00, 0x7C, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20,
+        0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00,
+        0x00, 0x37, 0x10, 0x00, 0x00, 0xCE, 0x80, 0x00, 0x06, 0xC3, 0xE2, 0x00, 0x1E, 0x30, 0x7B, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00,
+        0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00,
+        0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x1F, 0x90, 0xDC, 0x1B,
+        0x70, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F,
+        0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20,
+        0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x2D, 0xC1, 0x16, 0x40, 0x00, 0x04, 0xFD, 0xD8, 0x20,
+        0x01, 0xAD, 0xAF, 0x80, 0x00, 0x00, 0x40, 0x08, 0xF5, 0x00, 0x00, 0x2A, 0xEE, 0xFE, 0x20, 0x01,
+        0xDE, 0x85, 0x7F, 0xA0, 0x09, 0xF4, 0x00, 0x09, 0xF1, 0x0D, 0xB0, 0x00, 0x05, 0xF5, 0x0F, 0x90,
+        0x00, 0x03, 0xF6, 0x0F, 0x90, 0x00, 0x03, 0xF6, 0x0D, 0xC0, 0x00, 0x06, 0xF4, 0x08, 0xF4, 0x00,
+        0x0C, 0xE1, 0x01, 0xDE, 0x87, 0xCF, 0x50, 0x00, 0x2A, 0xEF, 0xC4, 0x00, 0x00, 0x9E, 0x91, 0xD3,
+        0x00, 0x02, 0xE3, 0xBF, 0xC0, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x7F, 0x3A, 0xEE, 0xA1, 0x00, 0x7F, 0xD8, 0x35, 0xEB, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x20, 0x7F,
+        0x30, 0x00, 0x4F, 0x40, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10,
+        0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00,
+        0x3F, 0x50, 0x00, 0x38, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xC8, 0x00,
+        0x00, 0x00, 0x00, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEF, 0xC5, 0x00,
+        0x02, 0xEE, 0x87, 0xCF, 0x60, 0x09, 0xF3, 0x00, 0x0C, 0xE1, 0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x0F,
+        0x90, 0x00, 0x03, 0xF7, 0x0F, 0x90, 0x00, 0x03, 0xF6, 0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x09, 0xF3,
+        0x00, 0x0C, 0xE1, 0x02, 0xEE, 0x87, 0xCF, 0x60, 0x00, 0x2A, 0xEF, 0xC5, 0x00, 0x00, 0x00, 0x00,
+        0x66, 0x00, 0x00, 0x00, 0x06, 0xE3, 0x00, 0x00, 0x00, 0x3E, 0x40, 0x00, 0x00, 0x00, 0x64, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEF, 0xC5, 0x00, 0x02, 0xEE, 0x87, 0xCF, 0x60,
+        0x09, 0xF3, 0x00, 0x0C, 0xE1, 0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x0F, 0x90, 0x00, 0x03, 0xF7, 0x0F,
+        0x90, 0x00, 0x03, 0xF6, 0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x09, 0xF3, 0x00, 0x0C, 0xE1, 0x02, 0xEE,
+        0x87, 0xCF, 0x60, 0x00, 0x2A, 0xEF, 0xC5, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x02, 0xED,
+        0x70, 0x00, 0x00, 0x0B, 0x72, 0xE3, 0x00, 0x00, 0x27, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2A, 0xEF, 0xC5, 0x00, 0x02, 0xEE, 0x87, 0xCF, 0x60, 0x09, 0xF3, 0x00, 0x0C, 0xE1,
+        0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x0F, 0x90, 0x00, 0x03, 0xF7, 0x0F, 0x90, 0x00, 0x03, 0xF6, 0x0E,
+        0xB0, 0x00, 0x05, 0xF5, 0x09, 0xF3, 0x00, 0x0C, 0xE1, 0x02, 0xEE, 0x87, 0xCF, 0x60, 0x00, 0x2A,
+        0xEF, 0xC5, 0x00, 0x00, 0x1C, 0xE6, 0x3D, 0x00, 0x00, 0x7A, 0x4D, 0xF7, 0x00, 0x00, 0x11, 0x00,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEF, 0xC5, 0x00, 0x02, 0xEE, 0x87, 0xCF,
+        0x60, 0x09, 0xF3, 0x00, 0x0C, 0xE1, 0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x0F, 0x90, 0x00, 0x03, 0xF7,
+        0x0F, 0x90, 0x00, 0x03, 0xF6, 0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x09, 0xF3, 0x00, 0x0C, 0xE1, 0x02,
+        0xEE, 0x87, 0xCF, 0x60, 0x00, 0x2A, 0xEF, 0xC5, 0x00, 0x00, 0x4F, 0x60, 0xFA, 0x00, 0x00, 0x3B,
+        0x50, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEF,
+        0xC5, 0x00, 0x02, 0xEE, 0x87, 0xCF, 0x60, 0x09, 0xF3, 0x00, 0x0C, 0xE1, 0x0E, 0xB0, 0x00, 0x05,
+        0xF5, 0x0F, 0x90, 0x00, 0x03, 0xF7, 0x0F, 0x90, 0x00, 0x03, 0xF6, 0x0E, 0xB0, 0x00, 0x05, 0xF5,
+        0x09, 0xF3, 0x00, 0x0C, 0xE1, 0x02, 0xEE, 0x87, 0xCF, 0x60, 0x00, 0x2A, 0xEF, 0xC5, 0x00, 0x00,
+        0x00, 0x0E, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00,
+        0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x21, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x15, 0x55, 0x55,
+        0x55, 0x55, 0x52, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF2, 0x00, 0x00, 0x00,
+        0x00, 0x0E, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x2A, 0xEE, 0xC5, 0xC7, 0x02,
+        0xEE, 0x86, 0xCF, 0xC0, 0x09, 0xF3, 0x00, 0x7F, 0xE0, 0x0E, 0xC0, 0x04, 0xD6, 0xF4, 0x0F, 0x90,
+        0x2D, 0x33, 0xF6, 0x0F, 0x91, 0xC6, 0x03, 0xF7, 0x0D, 0xBA, 0x90, 0x06, 0xF5, 0x08, 0xFC, 0x00,
+        0x0C, 0xE1, 0x06, 0xFE, 0x76, 0xCF, 0x60, 0x2E, 0x5A, 0xEF, 0xC5, 0x00, 0x04, 0x00, 0x00, 0x00,
+        0x00, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00,
+        0x00, 0x01, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F,
+        0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00,
+        0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x5F, 0x40, 0x7F, 0x10, 0x00, 0x7F, 0x40, 0x5F, 0x40, 0x01,
+        0xDF, 0x40, 0x1E, 0xE7, 0x7D, 0xCF, 0x40, 0x03, 0xCF, 0xD7, 0x5F, 0x40, 0x00, 0x00, 0x06, 0x60,
+        0x00, 0x00, 0x00, 0x5E, 0x30, 0x00, 0x00, 0x03, 0xE4, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F,
+        0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00,
+        0x00, 0x5F, 0x40, 0x7F, 0x10, 0x00, 0x7F, 0x40, 0x5F, 0x40, 0x01, 0xDF, 0x40, 0x1E, 0xE7, 0x7D,
+        0xCF, 0x40, 0x03, 0xCF, 0xD7, 0x5F, 0x40, 0x00, 0x04, 0x71, 0x00, 0x00, 0x00, 0x1E, 0xD8, 0x00,
+        0x00, 0x00, 0xA8, 0x1E, 0x40, 0x00, 0x02, 0x70, 0x03, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F,
+        0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x5F, 0x40, 0x7F, 0x10,
+        0x00, 0x7F, 0x40, 0x5F, 0x40, 0x01, 0xDF, 0x40, 0x1E, 0xE7, 0x7D, 0xCF, 0x40, 0x03, 0xCF, 0xD7,
+        0x5F, 0x40, 0x03, 0xF7, 0x0E, 0xB0, 0x00, 0x02, 0xB5, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40,
+        0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F,
+        0x00, 0x00, 0x5F, 0x40, 0x7F, 0x10, 0x00, 0x7F, 0x40, 0x5F, 0x40, 0x01, 0xDF, 0x40, 0x1E, 0xE7,
+        0x7D, 0xCF, 0x40, 0x03, 0xCF, 0xD7, 0x5F, 0x40, 0x00, 0x00, 0x03, 0xF7, 0x00, 0x00, 0x00, 0x0C,
+        0xA0, 0x00, 0x00, 0x00, 0x7D, 0x10, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x04,
+        0xF5, 0x0E, 0xA0, 0x00, 0x09, 0xE1, 0x08, 0xF1, 0x00, 0x0E, 0x90, 0x03, 0xF6, 0x00, 0x5F, 0x40,
+        0x00, 0xCB, 0x00, 0xBD, 0x00, 0x00, 0x7F, 0x21, 0xF8, 0x00, 0x00, 0x1F, 0x77, 0xF2, 0x00, 0x00,
+        0x0A, 0xDC, 0xC0, 0x00, 0x00, 0x05, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0x00,
+        0xDA, 0x00, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x00, 0x03, 0x6D, 0xD0, 0x00, 0x00, 0x0A, 0xFC, 0x30,
+        0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00,
+        0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x2A, 0xEE, 0xA1, 0x00, 0x7F, 0xCB, 0x68, 0xFC, 0x00,
+        0x7F, 0xB0, 0x00, 0x6F, 0x60, 0x7F, 0x40, 0x00, 0x0E, 0xB0, 0x7F, 0x20, 0x00, 0x0C, 0xC0, 0x7F,
+        0x20, 0x00, 0x0C, 0xC0, 0x7F, 0x40, 0x00, 0x0E, 0xB0, 0x7F, 0xB0, 0x00, 0x6F, 0x60, 0x7F, 0xCB,
+        0x68, 0xFC, 0x00, 0x7F, 0x2A, 0xEE, 0xA1, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00,
+        0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x43, 0xF8,
+        0x00, 0x00, 0x5B, 0x32, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x5F, 0x50, 0x00, 0x04, 0xF5, 0x0E, 0xA0, 0x00, 0x09, 0xE1, 0x08, 0xF1, 0x00, 0x0E, 0x90, 0x03,
+        0xF6, 0x00, 0x5F, 0x40, 0x00, 0xCB, 0x00, 0xBD, 0x00, 0x00, 0x7F, 0x21, 0xF8, 0x00, 0x00, 0x1F,
+        0x77, 0xF2, 0x00, 0x00, 0x0A, 0xDC, 0xC0, 0x00, 0x00, 0x05, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xEF,
+        0x10, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x00, 0x03, 0x6D, 0xD0, 0x00,
+        0x00, 0x0A, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF,
+        0x40, 0x00, 0x00, 0x02, 0x44, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x5F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xF5, 0x00, 0x00, 0x00, 0x01, 0xF6, 0xCA, 0x00, 0x00,
+        0x00, 0x06, 0xF1, 0x7F, 0x10, 0x00, 0x00, 0x0C, 0xB0, 0x2F, 0x60, 0x00, 0x00, 0x2F, 0x50, 0x0B,
+        0xB0, 0x00, 0x00, 0x8E, 0x10, 0x06, 0xF2, 0x00, 0x00, 0xDB, 0x22, 0x23, 0xF7, 0x00, 0x03, 0xFF,
+        0xFF, 0xFF, 0xFD, 0x00, 0x09, 0xE5, 0x55, 0x55, 0x8F, 0x30, 0x0E, 0xA0, 0x00, 0x00, 0x1F, 0x90,
+        0x5F, 0x50, 0x00, 0x00, 0x0B, 0xE0, 0xAF, 0x10, 0x00, 0x00, 0x06, 0xF5, 0x09, 0xFF, 0xFF, 0x50,
+        0x03, 0x44, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDE, 0xEB, 0x30,
+        0x4D, 0x86, 0x7D, 0xF3, 0x10, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xDF, 0xFF, 0xFD,
+        0x9F, 0x84, 0x33, 0xBD, 0xEA, 0x00, 0x00, 0xCD, 0xEA, 0x00, 0x04, 0xFD, 0x9F, 0x96, 0x8E, 0xDD,
+        0x19, 0xEE, 0xC4, 0xAD, 0x00, 0x08, 0xA1, 0x1B, 0x70, 0x00, 0x00, 0x01, 0xDF, 0xFC, 0x10, 0x00,
+        0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0,
+        0x00, 0x00, 0x00, 0x00, 0xAD, 0xF5, 0x00, 0x00, 0x00, 0x01, 0xF6, 0xCA, 0x00, 0x00, 0x00, 0x06,
+        0xF1, 0x7F, 0x10, 0x00, 0x00, 0x0C, 0xB0, 0x2F, 0x60, 0x00, 0x00, 0x2F, 0x50, 0x0B, 0xB0, 0x00,
+        0x00, 0x8E, 0x10, 0x06, 0xF2, 0x00, 0x00, 0xDB, 0x22, 0x23, 0xF7, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+        0xFD, 0x00, 0x09, 0xE5, 0x55, 0x55, 0x8F, 0x30, 0x0E, 0xA0, 0x00, 0x00, 0x1F, 0x90, 0x5F, 0x50,
+        0x00, 0x00, 0x0B, 0xE0, 0xAF, 0x10, 0x00, 0x00, 0x06, 0xF5, 0x09, 0x91, 0x1B, 0x60, 0x02, 0xDF,
+        0xFB, 0x10, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDE, 0xEB, 0x30, 0x4D, 0x86,
+        0x7D, 0xF3, 0x10, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xDF, 0xFF, 0xFD, 0x9F, 0x84,
+        0x33, 0xBD, 0xEA, 0x00, 0x00, 0xCD, 0xEA, 0x00, 0x04, 0xFD, 0x9F, 0x96, 0x8E, 0xDD, 0x19, 0xEE,
+        0xC4, 0xAD, 0x00, 0x00, 0x5F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF5, 0x00, 0x00, 0x00, 0x01,
+        0xFD, 0xFA, 0x00, 0x00, 0x00, 0x06, 0xF6, 0xCF, 0x10, 0x00, 0x00, 0x0C, 0xF1, 0x7F, 0x60, 0x00,
+        0x00, 0x2F, 0xB0, 0x2F, 0xB0, 0x00, 0x00, 0x8F, 0x50, 0x0B, 0xF2, 0x00, 0x00, 0xDE, 0x10, 0x06,
+        0xF7, 0x00, 0x03, 0xFB, 0x22, 0x23, 0xFD, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x0E, 0xE5,
+        0x55, 0x55, 0x7F, 0x90, 0x5F, 0x80, 0x00, 0x00, 0x0D, 0xE0, 0xAF, 0x20, 0x00, 0x00, 0x07, 0xF5,
+        0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x20, 0x00, 0x00, 0x00, 0x00,
+        0x1F, 0x53, 0x00, 0x00, 0x00, 0x00, 0x08, 0xEE, 0x29, 0xDE, 0xEB, 0x30, 0x00, 0x4D, 0x86, 0x7D,
+        0xF3, 0x00, 0x10, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xDF, 0xFF, 0xFD,
+        0x00, 0x9F, 0x84, 0x33, 0xBD, 0x00, 0xEA, 0x00, 0x00, 0xCD, 0x00, 0xEA, 0x00, 0x04, 0xFD, 0x00,
+        0x9F, 0x96, 0x8E, 0xDD, 0x00, 0x19, 0xEE, 0xC4, 0xAD, 0x00, 0x00, 0x00, 0x01, 0xD2, 0x00, 0x00,
+        0x00, 0x06, 0xB0, 0x00, 0x00, 0x00, 0x07, 0xC2, 0x20, 0x00, 0x00, 0x02, 0xCF, 0x70, 0x00, 0x00,
+        0x00, 0x2F, 0x50, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8C, 0xEE, 0xC8, 0x10, 0x00, 0x3E, 0xFB, 0x87,
+        0xAE, 0xE0, 0x01, 0xEE, 0x30, 0x00, 0x01, 0x90, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE0,
+        0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x00,
+        0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x01, 0x90, 0x00, 0x3E, 0xFA, 0x77, 0xAE, 0xE0, 0x00, 0x01,
+        0x8D, 0xEF, 0xC8, 0x10, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x00,
+        0x1E, 0x60, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF,
+        0xDA, 0x20, 0x01, 0xDF, 0x96, 0x7B, 0x40, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00,
+        0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00,
+        0x08, 0xF5, 0x00, 0x00, 0x00, 0x01, 0xDF, 0x96, 0x7B, 0x40, 0x00, 0x19, 0xDF, 0xDA, 0x20, 0x00,
+        0x00, 0x02, 0xEE, 0x20, 0x00, 0x00, 0x00, 0x0C, 0x77, 0xC0, 0x00, 0x00, 0x00, 0x36, 0x00, 0x63,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8C, 0xEE, 0xC8, 0x10, 0x00, 0x3E, 0xFB,
+        0x87, 0xAE, 0xE0, 0x01, 0xEE, 0x30, 0x00, 0x01, 0x90, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0C,
+        0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00,
+        0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x01, 0x90, 0x00, 0x3E, 0xFA, 0x77, 0xAE, 0xE0, 0x00,
+        0x01, 0x8D, 0xEF, 0xC8, 0x10, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x00, 0xAD, 0xD1, 0x00, 0x00,
+        0x05, 0xD1, 0xA9, 0x00, 0x00, 0x06, 0x20, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+        0xDF, 0xDA, 0x20, 0x01, 0xDF, 0x96, 0x7B, 0x40, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00,
+        0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00,
+        0x00, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x01, 0xDF, 0x96, 0x7B, 0x40, 0x00, 0x19, 0xDF, 0xDA, 0x20,
+        0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8C, 0xEE, 0xC8, 0x10, 0x00, 0x3E,
+        0xFB, 0x87, 0xAE, 0xE0, 0x01, 0xEE, 0x30, 0x00, 0x01, 0x90, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00,
+        0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00,
+        0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF5,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x01, 0x90, 0x00, 0x3E, 0xFA, 0x77, 0xAE, 0xE0,
+        0x00, 0x01, 0x8D, 0xEF, 0xC8, 0x10, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xDA, 0x20, 0x01,
+        0xDF, 0x96, 0x7B, 0x40, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x90,
+        0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00,
+        0x00, 0x00, 0x01, 0xDF, 0x96, 0x7B, 0x40, 0x00, 0x19, 0xDF, 0xDA, 0x20, 0x00, 0x00, 0x7B, 0x04,
+        0xD1, 0x00, 0x00, 0x00, 0x0B, 0xAE, 0x40, 0x00, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8C, 0xEE, 0xC8, 0x10, 0x00, 0x3E, 0xFB, 0x87, 0xAE, 0xE0,
+        0x01, 0xEE, 0x30, 0x00, 0x01, 0x90, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00,
+        0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
+        0x00, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0xEE, 0x30, 0x00, 0x01, 0x90, 0x00, 0x3E, 0xFA, 0x77, 0xAE, 0xE0, 0x00, 0x01, 0x8D, 0xEF,
+        0xC8, 0x10, 0x00, 0x17, 0x10, 0x26, 0x00, 0x00, 0x09, 0xA1, 0xD5, 0x00, 0x00, 0x01, 0xDD, 0xA0,
+        0x00, 0x00, 0x00, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xDA, 0x20,
+        0x01, 0xDF, 0x96, 0x7B, 0x40, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x0F,
+        0x90, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xF5,
+        0x00, 0x00, 0x00, 0x01, 0xDF, 0x96, 0x7B, 0x40, 0x00, 0x19, 0xDF, 0xDA, 0x20, 0x00, 0x17, 0x10,
+        0x54, 0x00, 0x00, 0x00, 0x07, 0xC7, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x67, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFE, 0xB7, 0x10, 0x00, 0x5F, 0xA7, 0x78, 0xBF, 0xE5,
+        0x00, 0x5F, 0x50, 0x00, 0x03, 0xEE, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x90, 0x5F, 0x50, 0x00,
+        0x00, 0x0E, 0xD0, 0x5F, 0x50, 0x00, 0x00, 0x0B, 0xF0, 0x5F, 0x50, 0x00, 0x00, 0x0B, 0xF1, 0x5F,
+        0x50, 0x00, 0x00, 0x0B, 0xF0, 0x5F, 0x50, 0x00, 0x00, 0x0E, 0xD0, 0x5F, 0x50, 0x00, 0x00, 0x5F,
+        0x90, 0x5F, 0x50, 0x00, 0x03, 0xEE, 0x20, 0x5F, 0xA7, 0x78, 0xBF, 0xE4, 0x00, 0x5F, 0xFF, 0xFE,
+        0xB7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x7E,
+        0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x32, 0x00, 0x00,
+        0x3B, 0xEE, 0x85, 0xF4, 0x00, 0x00, 0x02, 0xEE, 0x77, 0xCC, 0xF4, 0x00, 0x00, 0x09, 0xF3, 0x00,
+        0x1D, 0xF4, 0x00, 0x00, 0x0E, 0xB0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x05, 0xF4,
+        0x00, 0x00, 0x1F, 0x90, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x0E, 0xB0, 0x00, 0x07, 0xF4, 0x00, 0x00,
+        0x09, 0xF2, 0x00, 0x1D, 0xF4, 0x00, 0x00, 0x02, 0xEE, 0x76, 0xCC, 0xF4, 0x00, 0x00, 0x00, 0x3B,
+        0xFE, 0x85, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xEC, 0x82, 0x00, 0x00, 0x04, 0xFA, 0x77, 0x8B,
+        0xFE, 0x50, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x3D, 0xF3, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x04, 0xFA,
+        0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0xAF, 0x20, 0xEF,
+        0xFF, 0xFF, 0x30, 0x00, 0x9F, 0x20, 0x36, 0xF8, 0x33, 0x10, 0x00, 0xAF, 0x20, 0x04, 0xF7, 0x00,
+        0x00, 0x00, 0xDE, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x3D,
+        0xF3, 0x00, 0x04, 0xFA, 0x77, 0x8B, 0xFE, 0x50, 0x00, 0x04, 0xFF, 0xFF, 0xEC, 0x82, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x0E, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0x26,
+        0xF5, 0x10, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x3B, 0xEE, 0x85, 0xF4, 0x00, 0x02, 0xEE,
+        0x77, 0xCC, 0xF4, 0x00, 0x09, 0xF3, 0x00, 0x1D, 0xF4, 0x00, 0x0E, 0xB0, 0x00, 0x07, 0xF4, 0x00,
+        0x0F, 0x90, 0x00, 0x05, 0xF4, 0x00, 0x1F, 0x90, 0x00, 0x05, 0xF4, 0x00, 0x0E, 0xB0, 0x00, 0x07,
+        0xF4, 0x00, 0x09, 0xF2, 0x00, 0x1D, 0xF4, 0x00, 0x02, 0xEE, 0x76, 0xCC, 0xF4, 0x00, 0x00, 0x3B,
+        0xFE, 0x85, 0xF4, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x34,
+        0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x80, 0x5F, 0xA7, 0x77,
+        0x77, 0x40, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x72, 0x22, 0x22,
+        0x10, 0x5F, 0xFF, 0xFF, 0xFF, 0x40, 0x5F, 0x85, 0x55, 0x55, 0x10, 0x5F, 0x50, 0x00, 0x00, 0x00,
+        0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F,
+        0xA7, 0x77, 0x77, 0x50, 0x5F, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x04,
+        0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xDF,
+        0xD8, 0x00, 0x01, 0xDE, 0x86, 0x9F, 0xA0, 0x08, 0xF3, 0x00, 0x06, 0xF3, 0x0D, 0xB0, 0x00, 0x01,
+        0xF7, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xA3, 0x33, 0x33, 0x32, 0x0D, 0xC0, 0x00, 0x00, 0x00,
+        0x08, 0xF5, 0x00, 0x00, 0x11, 0x01, 0xCF, 0xA6, 0x79, 0xE3, 0x00, 0x18, 0xDF, 0xEC, 0x71, 0x00,
+        0x72, 0x01, 0x71, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x80, 0x5F, 0xA7, 0x77, 0x77, 0x40, 0x5F, 0x50, 0x00,
+        0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x72, 0x22, 0x22, 0x10, 0x5F, 0xFF, 0xFF, 0xFF,
+        0x40, 0x5F, 0x85, 0x55, 0x55, 0x10, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00,
+        0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0xA7, 0x77, 0x77, 0x50, 0x5F,
+        0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x0D, 0x51, 0x6D, 0x00, 0x00, 0x05,
+        0xEF, 0xE5, 0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xDF,
+        0xD8, 0x00, 0x01, 0xDE, 0x86, 0x9F, 0xA0, 0x08, 0xF3, 0x00, 0x06, 0xF3, 0x0D, 0xB0, 0x00, 0x01,
+        0xF7, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xA3, 0x33, 0x33, 0x32, 0x0D, 0xC0, 0x00, 0x00, 0x00,
+        0x08, 0xF5, 0x00, 0x00, 0x11, 0x01, 0xCF, 0xA6, 0x79, 0xE3, 0x00, 0x18, 0xDF, 0xEC, 0x71, 0x00,
+        0x04, 0xF6, 0x00, 0x00, 0x00, 0x03, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+        0xFF, 0xFF, 0x80, 0x5F, 0xA7, 0x77, 0x77, 0x40, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00,
+        0x00, 0x00, 0x5F, 0x72, 0x22, 0x22, 0x10, 0x5F, 0xFF, 0xFF, 0xFF, 0x40, 0x5F, 0x85, 0x55, 0x55,
+        0x10, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00,
+        0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0xA7, 0x77, 0x77, 0x50, 0x5F, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+        0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x19, 0xDF, 0xD8, 0x00, 0x01, 0xDE, 0x86, 0x9F, 0xA0, 0x08, 0xF3, 0x00,
+        0x06, 0xF3, 0x0D, 0xB0, 0x00, 0x01, 0xF7, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xA3, 0x33, 0x33,
+        0x32, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x11, 0x01, 0xCF, 0xA6, 0x79, 0xE3,
+        0x00, 0x18, 0xDF, 0xEC, 0x71, 0x5F, 0xFF, 0xFF, 0xFF, 0x80, 0x5F, 0xA7, 0x77, 0x77, 0x40, 0x5F,
+        0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x72,
+        0x22, 0x22, 0x10, 0x5F, 0xFF, 0xFF, 0xFF, 0x40, 0x5F, 0x85, 0x55, 0x55, 0x10, 0x5F, 0x50, 0x00,
+        0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0xA7, 0x77, 0x77,
+        0x50, 0x5F, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x04, 0xC0, 0x00,
+        0x00, 0x00, 0x06, 0xE2, 0x20, 0x00, 0x00, 0x01, 0xCF, 0x90, 0x00, 0x19, 0xDF, 0xD6, 0x00, 0x01,
+        0xDF, 0x96, 0xAF, 0x70, 0x08, 0xF6, 0x00, 0x0A, 0xE1, 0x0D, 0xD0, 0x00, 0x03, 0xF5, 0x0F, 0xA0,
+        0x00, 0x01, 0xF7, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0D, 0xB3, 0x33, 0x33, 0x32, 0x08, 0xE2, 0x00,
+        0x00, 0x00, 0x01, 0xCE, 0x86, 0x68, 0xC3, 0x00, 0x18, 0xDF, 0xFF, 0x71, 0x00, 0x00, 0x00, 0xA6,
+        0x00, 0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x01, 0xF5, 0x30, 0x00, 0x00, 0x00, 0x8E, 0xD0,
+        0x00, 0x53, 0x02, 0x70, 0x00, 0x00, 0x3E, 0x3C, 0x70, 0x00, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x80, 0x5F, 0xA7, 0x77, 0x77, 0x40, 0x5F, 0x50,
+        0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x72, 0x22, 0x22, 0x10, 0x5F, 0xFF, 0xFF,
+        0xFF, 0x40, 0x5F, 0x85, 0x55, 0x55, 0x10, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00,
+        0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0xA7, 0x77, 0x77, 0x50,
+        0x5F, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x07, 0x10, 0x17, 0x00, 0x00, 0x09, 0xA0, 0xA8, 0x00, 0x00,
+        0x01, 0xE9, 0xE1, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+        0xDF, 0xD8, 0x00, 0x01, 0xDE, 0x86, 0x9F, 0xA0, 0x08, 0xF3, 0x00, 0x06, 0xF3, 0x0D, 0xB0, 0x00,
+        0x01, 0xF7, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xA3, 0x33, 0x33, 0x32, 0x0D, 0xC0, 0x00, 0x00,
+        0x00, 0x08, 0xF5, 0x00, 0x00, 0x11, 0x01, 0xCF, 0xA6, 0x79, 0xE3, 0x00, 0x18, 0xDF, 0xEC, 0x71,
+        0x00, 0x00, 0x01, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x0A, 0x95, 0xD1, 0x00, 0x00, 0x00, 0x27, 0x00,
+        0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8C, 0xEF, 0xDA, 0x40, 0x00, 0x3E,
+        0xFB, 0x87, 0x9D, 0xF6, 0x01, 0xEE, 0x30, 0x00, 0x00, 0x55, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x00,
+        0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0x22, 0x21, 0x0F, 0xB0, 0x00, 0x09,
+        0xFF, 0xFC, 0x0F, 0xC0, 0x00, 0x03, 0x55, 0xEC, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0xDC, 0x08, 0xF5,
+        0x00, 0x00, 0x00, 0xDC, 0x01, 0xEE, 0x30, 0x00, 0x00, 0xDC, 0x00, 0x3E, 0xFB, 0x77, 0x8D, 0xF9,
+        0x00, 0x01, 0x8C, 0xEF, 0xDA, 0x40, 0x00, 0x00, 0xCE, 0x10, 0x00, 0x00, 0x06, 0xDB, 0x90, 0x00,
+        0x00, 0x1E, 0x42, 0xE3, 0x00, 0x00, 0x36, 0x00, 0x45, 0x00, 0x00, 0x3B, 0xFE, 0x85, 0xF4, 0x02,
+        0xEE, 0x76, 0xCC, 0xF4, 0x09, 0xF2, 0x00, 0x1D, 0xF4, 0x0E, 0xB0, 0x00, 0x07, 0xF4, 0x1F, 0x90,
+        0x00, 0x05, 0xF4, 0x1F, 0x90, 0x00, 0x05, 0xF4, 0x0E, 0xB0, 0x00, 0x07, 0xF4, 0x09, 0xF2, 0x00,
+        0x1D, 0xF4, 0x02, 0xEE, 0x76, 0xCC, 0xF4, 0x00, 0x3B, 0xFE, 0x85, 0xF3, 0x00, 0x00, 0x00, 0x07,
+        0xF2, 0x00, 0x00, 0x00, 0x1D, 0xD0, 0x00, 0xD8, 0x67, 0xDF, 0x50, 0x00, 0x9D, 0xEE, 0xC5, 0x00,
+        0x00, 0x00, 0xD5, 0x03, 0xE1, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x21,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8C, 0xEF, 0xDA, 0x40, 0x00, 0x3E,
+        0xFB, 0x87, 0x9D, 0xF6, 0x01, 0xEE, 0x30, 0x00, 0x00, 0x55, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x00,
+        0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0x22, 0x21, 0x0F, 0xB0, 0x00, 0x09,
+        0xFF, 0xFC, 0x0F, 0xC0, 0x00, 0x03, 0x55, 0xEC, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0xDC, 0x08, 0xF5,
+        0x00, 0x00, 0x00, 0xDC, 0x01, 0xEE, 0x30, 0x00, 0x00, 0xDC, 0x00, 0x3E, 0xFB, 0x77, 0x8D, 0xF9,
+        0x00, 0x01, 0x8C, 0xEF, 0xDA, 0x40, 0x00, 0x1E, 0x30, 0x5D, 0x00, 0x00, 0x08, 0xFF, 0xE5, 0x00,
+        0x00, 0x00, 0x13, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFE, 0x85, 0xF4, 0x02,
+        0xEE, 0x76, 0xCC, 0xF4, 0x09, 0xF2, 0x00, 0x1D, 0xF4, 0x0E, 0xB0, 0x00, 0x07, 0xF4, 0x1F, 0x90,
+        0x00, 0x05, 0xF4, 0x1F, 0x90, 0x00, 0x05, 0xF4, 0x0E, 0xB0, 0x00, 0x07, 0xF4, 0x09, 0xF2, 0x00,
+        0x1D, 0xF4, 0x02, 0xEE, 0x76, 0xCC, 0xF4, 0x00, 0x3B, 0xFE, 0x85, 0xF3, 0x00, 0x00, 0x00, 0x07,
+        0xF2, 0x00, 0x00, 0x00, 0x1D, 0xD0, 0x00, 0xD8, 0x67, 0xDF, 0x50, 0x00, 0x9D, 0xEE, 0xC5, 0x00,
+        0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8C, 0xEF, 0xDA, 0x40, 0x00, 0x3E,
+        0xFB, 0x87, 0x9D, 0xF6, 0x01, 0xEE, 0x30, 0x00, 0x00, 0x55, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x00,
+        0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0x22, 0x21, 0x0F, 0xB0, 0x00, 0x09,
+        0xFF, 0xFC, 0x0F, 0xC0, 0x00, 0x03, 0x55, 0xEC, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0xDC, 0x08, 0xF5,
+        0x00, 0x00, 0x00, 0xDC, 0x01, 0xEE, 0x30, 0x00, 0x00, 0xDC, 0x00, 0x3E, 0xFB, 0x77, 0x8D, 0xF9,
+        0x00, 0x01, 0x8C, 0xEF, 0xDA, 0x40, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFE, 0x85, 0xF4, 0x02,
+        0xEE, 0x76, 0xCC, 0xF4, 0x09, 0xF2, 0x00, 0x1D, 0xF4, 0x0E, 0xB0, 0x00, 0x07, 0xF4, 0x1F, 0x90,
+        0x00, 0x05, 0xF4, 0x1F, 0x90, 0x00, 0x05, 0xF4, 0x0E, 0xB0, 0x00, 0x07, 0xF4, 0x09, 0xF2, 0x00,
+        0x1D, 0xF4, 0x02, 0xEE, 0x76, 0xCC, 0xF4, 0x00, 0x3B, 0xFE, 0x85, 0xF3, 0x00, 0x00, 0x00, 0x07,
+        0xF2, 0x00, 0x00, 0x00, 0x1D, 0xD0, 0x00, 0xD8, 0x67, 0xDF, 0x50, 0x00, 0x9D, 0xEE, 0xC5, 0x00,
+        0x00, 0x01, 0x8C, 0xEF, 0xDA, 0x40, 0x00, 0x3E, 0xFB, 0x87, 0x9D, 0xF6, 0x01, 0xEE, 0x30, 0x00,
+        0x00, 0x55, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
+        0x00, 0x01, 0x22, 0x21, 0x0F, 0xB0, 0x00, 0x09, 0xFF, 0xFC, 0x0F, 0xC0, 0x00, 0x03, 0x55, 0xEC,
+        0x0C, 0xE0, 0x00, 0x00, 0x00, 0xDC, 0x08, 0xF5, 0x00, 0x00, 0x00, 0xDC, 0x01, 0xEE, 0x30, 0x00,
+        0x00, 0xDC, 0x00, 0x3E, 0xFB, 0x77, 0x8D, 0xF9, 0x00, 0x01, 0x8C, 0xEF, 0xDA, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x20, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x50, 0x00,
+        0x00, 0x00, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFE, 0x85, 0xF4, 0x02,
+        0xEE, 0x76, 0xCC, 0xF4, 0x09, 0xF2, 0x00, 0x1D, 0xF4, 0x0E, 0xB0, 0x00, 0x07, 0xF4, 0x1F, 0x90,
+        0x00, 0x05, 0xF4, 0x1F, 0x90, 0x00, 0x05, 0xF4, 0x0E, 0xB0, 0x00, 0x07, 0xF4, 0x09, 0xF2, 0x00,
+        0x1D, 0xF4, 0x02, 0xEE, 0x76, 0xCC, 0xF4, 0x00, 0x3B, 0xFE, 0x85, 0xF3, 0x00, 0x00, 0x00, 0x07,
+        0xF2, 0x00, 0x00, 0x00, 0x1D, 0xD0, 0x00, 0xD8, 0x67, 0xDF, 0x50, 0x00, 0x9D, 0xEE, 0xC5, 0x00,
+        0x00, 0x00, 0x58, 0x30, 0x00, 0x00, 0x00, 0x04, 0xD6, 0xD2, 0x00, 0x00, 0x00, 0x07, 0x20, 0x45,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x8F, 0x20, 0x5F, 0x50,
+        0x00, 0x00, 0x8F, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x8F, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x8F, 0x20,
+        0x5F, 0x72, 0x22, 0x22, 0x9F, 0x20, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x5F, 0x85, 0x55, 0x55,
+        0xBF, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x8F, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x8F, 0x20, 0x5F, 0x50,
+        0x00, 0x00, 0x8F, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x8F, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x8F, 0x20,
+        0x5F, 0x50, 0x00, 0x00, 0x8F, 0x20, 0x00, 0x58, 0x20, 0x00, 0x00, 0x00, 0x05, 0xD7, 0xD1, 0x00,
+        0x00, 0x00, 0x07, 0x10, 0x45, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7F,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x7F, 0x29, 0xEE, 0xA1, 0x00, 0x00, 0x7F, 0xCB, 0x79, 0xFB, 0x00, 0x00, 0x7F, 0xA0, 0x00,
+        0x8F, 0x20, 0x00, 0x7F, 0x30, 0x00, 0x4F, 0x40, 0x00, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x00, 0x7F,
+        0x10, 0x00, 0x3F, 0x50, 0x00, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x00, 0x7F, 0x10, 0x00, 0x3F, 0x50,
+        0x00, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x00, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x00, 0xEB, 0x00, 0x00,
+        0x03, 0xF8, 0x00, 0x12, 0xEB, 0x22, 0x22, 0x24, 0xF9, 0x10, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xE0, 0x14, 0xEC, 0x44, 0x44, 0x46, 0xFA, 0x40, 0x00, 0xEC, 0x22, 0x22, 0x24, 0xF8, 0x00, 0x00,
+        0xEF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xEC, 0x55, 0x55, 0x57, 0xF8, 0x00, 0x00, 0xEB, 0x00,
+        0x00, 0x03, 0xF8, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x03,
+        0xF8, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x03, 0xF8, 0x00,
+        0x00, 0xEB, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x92, 0x21, 0x00,
+        0x00, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x5F, 0xB5, 0x52, 0x00, 0x00, 0x0F, 0x84, 0xCF, 0xD6, 0x00,
+        0x0F, 0xCE, 0x87, 0xCF, 0x30, 0x0F, 0xF2, 0x00, 0x1E, 0x90, 0x0F, 0xB0, 0x00, 0x0C, 0xB0, 0x0F,
+        0x90, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x0F, 0x80,
+        0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x09, 0xD7, 0x1D,
+        0x20, 0x2E, 0x3A, 0xFB, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x50,
+        0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50,
+        0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50,
+        0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50,
+        0x00, 0x0B, 0xE7, 0x1F, 0x10, 0x4C, 0x4C, 0xF9, 0x00, 0x11, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20,
+        0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20,
+        0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x11, 0x11, 0x10, 0xFF, 0xFF, 0xF0, 0x34,
+        0x44, 0x30, 0x00, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5,
+        0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00,
+        0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00, 0x05, 0xF5, 0x00, 0x2F, 0xFF, 0xFD, 0x04,
+        0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F,
+        0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20,
+        0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x07, 0x20, 0x27, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x12,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F,
+        0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F,
+        0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F,
+        0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x2E, 0x30, 0x5D, 0x08, 0xFF, 0xE5,
+        0x00, 0x13, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00,
+        0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F,
+        0x20, 0x00, 0x6F, 0x20, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50,
+        0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x1D, 0x20,
+        0x6B, 0x00, 0x7C, 0x22, 0x2C, 0xF7, 0x6F, 0x20, 0x6F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x20,
+        0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20,
+        0x6F, 0x20, 0x2D, 0x00, 0x98, 0x00, 0xAA, 0x22, 0x4D, 0xF4, 0x5F, 0x50, 0x4C, 0x40, 0x00, 0x00,
+        0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50,
+        0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x5F, 0x50, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20,
+        0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x5F, 0x50,
+        0x05, 0xF5, 0x5F, 0x50, 0x05, 0xF5, 0x5F, 0x50, 0x05, 0xF5, 0x5F, 0x50, 0x05, 0xF5, 0x5F, 0x50,
+        0x05, 0xF5, 0x5F, 0x50, 0x05, 0xF5, 0x5F, 0x50, 0x05, 0xF5, 0x5F, 0x50, 0x05, 0xF5, 0x5F, 0x50,
+        0x05, 0xF5, 0x5F, 0x50, 0x05, 0xF5, 0x5F, 0x50, 0x05, 0xF5, 0x5F, 0x50, 0x05, 0xF5, 0x5F, 0x50,
+        0x05, 0xF5, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x0A, 0xF2, 0x00, 0x06, 0xAF, 0xB0, 0x00, 0x0D,
+        0xEA, 0x10, 0x6F, 0x20, 0x0A, 0xD0, 0x6F, 0x20, 0x0A, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x6F, 0x20, 0x0A, 0xD0, 0x6F, 0x20, 0x0A, 0xD0, 0x6F, 0x20, 0x0A, 0xD0, 0x6F, 0x20,
+        0x0A, 0xD0, 0x6F, 0x20, 0x0A, 0xD0, 0x6F, 0x20, 0x0A, 0xD0, 0x6F, 0x20, 0x0A, 0xD0, 0x6F, 0x20,
+        0x0A, 0xD0, 0x6F, 0x20, 0x0A, 0xD0, 0x6F, 0x20, 0x0A, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
+        0x0C, 0xB0, 0x00, 0x03, 0x8F, 0x70, 0x00, 0x09, 0xE9, 0x10, 0x00, 0xAD, 0xB0, 0x00, 0x09, 0x90,
+        0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F,
+        0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F,
+        0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F,
+        0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00, 0xAF,
+        0x20, 0x00, 0x7A, 0xFB, 0x00, 0x00, 0xDE, 0xA1, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x02, 0xE9,
+        0xD0, 0x00, 0x0B, 0x80, 0xC7, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F,
+        0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F,
+        0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F,
+        0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x26, 0xEC, 0x00, 0x00, 0x5E, 0xB2,
+        0x00, 0x00, 0x5F, 0x50, 0x00, 0x09, 0xF8, 0x00, 0x5F, 0x50, 0x00, 0x9F, 0x80, 0x00, 0x5F, 0x50,
+        0x09, 0xF8, 0x00, 0x00, 0x5F, 0x50, 0x9F, 0x80, 0x00, 0x00, 0x5F, 0x5A, 0xF8, 0x00, 0x00, 0x00,
+        0x5F, 0xDF, 0x70, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x6D, 0xF5, 0x00,
+        0x00, 0x00, 0x5F, 0x52, 0xDF, 0x40, 0x00, 0x00, 0x5F, 0x50, 0x2D, 0xE3, 0x00, 0x00, 0x5F, 0x50,
+        0x02, 0xEE, 0x30, 0x00, 0x5F, 0x50, 0x00, 0x3E, 0xE2, 0x00, 0x5F, 0x50, 0x00, 0x03, 0xED, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00,
+        0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x01, 0xCD,
+        0x20, 0x7F, 0x10, 0x2D, 0xD2, 0x00, 0x7F, 0x12, 0xDD, 0x20, 0x00, 0x7F, 0x4D, 0xC1, 0x00, 0x00,
+        0x7F, 0xED, 0x10, 0x00, 0x00, 0x7F, 0x9F, 0x70, 0x00, 0x00, 0x7F, 0x19, 0xF6, 0x00, 0x00, 0x7F,
+        0x10, 0x9F, 0x60, 0x00, 0x7F, 0x10, 0x0A, 0xF5, 0x00, 0x7F, 0x10, 0x00, 0xAF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, 0x03, 0xF3, 0x00, 0x00, 0x00, 0x07, 0xB0,
+        0x00, 0x00, 0x7F, 0x10, 0x01, 0xCE, 0x20, 0x7F, 0x10, 0x2D, 0xD2, 0x00, 0x7F, 0x12, 0xDD, 0x20,
+        0x00, 0x7F, 0x4D, 0xC1, 0x00, 0x00, 0x7F, 0xED, 0x10, 0x00, 0x00, 0x7F, 0xAF, 0x60, 0x00, 0x00,
+        0x7F, 0x19, 0xF6, 0x00, 0x00, 0x7F, 0x10, 0x9F, 0x60, 0x00, 0x7F, 0x10, 0x0A, 0xF5, 0x00, 0x7F,
+        0x10, 0x00, 0xAF, 0x50, 0x00, 0x56, 0x00, 0x00, 0x00, 0x05, 0xE2, 0x00, 0x00, 0x00, 0x07, 0x30,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00,
+        0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00,
+        0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00,
+        0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F,
+        0xA7, 0x77, 0x77, 0x30, 0x5F, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x65, 0x07, 0xD1, 0x17, 0x20, 0x6F,
+        0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F,
+        0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x5F, 0x50, 0x00, 0x00, 0x00,
+        0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F,
+        0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50,
+        0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00,
+        0x00, 0x00, 0x5F, 0xA7, 0x77, 0x77, 0x30, 0x5F, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0xC6, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00,
+        0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20,
+        0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x6F, 0x20, 0x00, 0x00, 0x3C, 0x40,
+        0x8E, 0x00, 0xB7, 0x00, 0x5F, 0x50, 0x8F, 0x10, 0x00, 0x5F, 0x50, 0xBC, 0x00, 0x00, 0x5F, 0x50,
+        0xD7, 0x00, 0x00, 0x5F, 0x50, 0x41, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00,
+        0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00,
+        0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0xA7, 0x77, 0x77, 0x30,
+        0x5F, 0xFF, 0xFF, 0xFF, 0x60, 0x6F, 0x26, 0xF3, 0x6F, 0x28, 0xE0, 0x6F, 0x2B, 0xA0, 0x6F, 0x24,
+        0x20, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00,
+        0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x5F,
+        0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50,
+        0x00, 0x00, 0x00, 0x5F, 0x50, 0x02, 0x31, 0x00, 0x5F, 0x50, 0x08, 0xF3, 0x00, 0x5F, 0x50, 0x08,
+        0xF3, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00,
+        0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0xA7, 0x77, 0x77, 0x30, 0x5F, 0xFF, 0xFF, 0xFF, 0x60,
+        0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F,
+        0x33, 0x10, 0x6F, 0x8F, 0x50, 0x6F, 0x8F, 0x50, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20,
+        0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x00,
+        0x00, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x32,
+        0x00, 0x00, 0x00, 0x4F, 0x76, 0xF6, 0x00, 0x00, 0x00, 0x4F, 0xEE, 0x50, 0x00, 0x00, 0x00, 0x5F,
+        0xC2, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x0A, 0x7F, 0x70, 0x00, 0x00, 0x00,
+        0x00, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB7, 0x77,
+        0x77, 0x30, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x70, 0x05, 0xF3, 0x00, 0x05, 0xF3, 0x00, 0x05, 0xF3,
+        0x00, 0x05, 0xF3, 0x00, 0x05, 0xF3, 0x20, 0x05, 0xFD, 0x90, 0x07, 0xF9, 0x00, 0x8F, 0xF3, 0x00,
+        0x78, 0xF3, 0x00, 0x05, 0xF3, 0x00, 0x05, 0xF3, 0x00, 0x05, 0xF3, 0x00, 0x05, 0xF3, 0x00, 0x05,
+        0xF3, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x10, 0x00, 0x00, 0x00, 0x01,
+        0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF3, 0x00, 0x00, 0x9F, 0x10,
+        0x5F, 0xFA, 0x00, 0x00, 0x9F, 0x10, 0x5F, 0xCF, 0x30, 0x00, 0x9F, 0x10, 0x5F, 0x5E, 0xA0, 0x00,
+        0x9F, 0x10, 0x5F, 0x48, 0xF3, 0x00, 0x9F, 0x10, 0x5F, 0x41, 0xEB, 0x00, 0x9F, 0x10, 0x5F, 0x40,
+        0x7F, 0x30, 0x9F, 0x10, 0x5F, 0x40, 0x1E, 0xB0, 0x9F, 0x10, 0x5F, 0x40, 0x07, 0xF3, 0x9F, 0x10,
+        0x5F, 0x40, 0x01, 0xEB, 0x9F, 0x10, 0x5F, 0x40, 0x00, 0x7F, 0xCF, 0x10, 0x5F, 0x40, 0x00, 0x1E,
+        0xFF, 0x10, 0x5F, 0x40, 0x00, 0x07, 0xFF, 0x10, 0x00, 0x00, 0x28, 0x30, 0x00, 0x00, 0x00, 0xBC,
+        0x00, 0x00, 0x00, 0x06, 0xE2, 0x00, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x7F, 0x3A, 0xEE, 0xA1, 0x00, 0x7F, 0xD8, 0x35, 0xEB, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x20,
+        0x7F, 0x30, 0x00, 0x4F, 0x40, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F,
+        0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10,
+        0x00, 0x3F, 0x50, 0x5F, 0xF3, 0x00, 0x00, 0x9F, 0x10, 0x5F, 0xFA, 0x00, 0x00, 0x9F, 0x10, 0x5F,
+        0xCF, 0x30, 0x00, 0x9F, 0x10, 0x5F, 0x5E, 0xA0, 0x00, 0x9F, 0x10, 0x5F, 0x48, 0xF3, 0x00, 0x9F,
+        0x10, 0x5F, 0x41, 0xEB, 0x00, 0x9F, 0x10, 0x5F, 0x40, 0x7F, 0x30, 0x9F, 0x10, 0x5F, 0x40, 0x1E,
+        0xB0, 0x9F, 0x10, 0x5F, 0x40, 0x07, 0xF3, 0x9F, 0x10, 0x5F, 0x40, 0x01, 0xEB, 0x9F, 0x10, 0x5F,
+        0x40, 0x00, 0x7F, 0xCF, 0x10, 0x5F, 0x40, 0x00, 0x1E, 0xFF, 0x10, 0x5F, 0x40, 0x00, 0x07, 0xFF,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8E,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, 0x7F, 0x3A, 0xEE, 0xA1, 0x00, 0x7F, 0xD8,
+        0x35, 0xEB, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x20, 0x7F, 0x30, 0x00, 0x4F, 0x40, 0x7F, 0x10, 0x00,
+        0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F,
+        0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x03, 0xC5, 0x00, 0x00, 0x00, 0x07, 0xE1, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00,
+        0x17, 0x10, 0x45, 0x00, 0x00, 0x00, 0x08, 0xB3, 0xE2, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF3, 0x00, 0x00, 0x9F, 0x10, 0x5F, 0xFA, 0x00,
+        0x00, 0x9F, 0x10, 0x5F, 0xCF, 0x30, 0x00, 0x9F, 0x10, 0x5F, 0x5E, 0xA0, 0x00, 0x9F, 0x10, 0x5F,
+        0x48, 0xF3, 0x00, 0x9F, 0x10, 0x5F, 0x41, 0xEB, 0x00, 0x9F, 0x10, 0x5F, 0x40, 0x7F, 0x30, 0x9F,
+        0x10, 0x5F, 0x40, 0x1E, 0xB0, 0x9F, 0x10, 0x5F, 0x40, 0x07, 0xF3, 0x9F, 0x10, 0x5F, 0x40, 0x01,
+        0xEB, 0x9F, 0x10, 0x5F, 0x40, 0x00, 0x7F, 0xCF, 0x10, 0x5F, 0x40, 0x00, 0x1E, 0xFF, 0x10, 0x5F,
+        0x40, 0x00, 0x07, 0xFF, 0x10, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0xB8, 0x0A, 0x80, 0x00, 0x00,
+        0x2E, 0x9D, 0x10, 0x00, 0x00, 0x06, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x3A,
+        0xEE, 0xA1, 0x00, 0x7F, 0xD8, 0x35, 0xEB, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x20, 0x7F, 0x30, 0x00,
+        0x4F, 0x40, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F,
+        0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50,
+        0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x2F, 0x19, 0xE3, 0xBE, 0xE9, 0x10, 0x01, 0x09, 0xED, 0x63, 0x6F, 0x80, 0x00, 0x09,
+        0xF5, 0x00, 0x09, 0xE0, 0x00, 0x09, 0xF0, 0x00, 0x06, 0xF1, 0x00, 0x09, 0xE0, 0x00, 0x05, 0xF2,
+        0x00, 0x09, 0xE0, 0x00, 0x05, 0xF2, 0x00, 0x09, 0xE0, 0x00, 0x05, 0xF2, 0x00, 0x09, 0xE0, 0x00,
+        0x05, 0xF2, 0x00, 0x09, 0xE0, 0x00, 0x05, 0xF2, 0x00, 0x09, 0xE0, 0x00, 0x05, 0xF2, 0x5F, 0x53,
+        0xBE, 0xEA, 0x20, 0x5F, 0x8E, 0xB8, 0xBF, 0xD0, 0x5F, 0xF6, 0x00, 0x08, 0xF6, 0x5F, 0xC0, 0x00,
+        0x01, 0xFA, 0x5F, 0x70, 0x00, 0x00, 0xEC, 0x5F, 0x60, 0x00, 0x00, 0xCC, 0x5F, 0x50, 0x00, 0x00,
+        0xCC, 0x5F, 0x50, 0x00, 0x00, 0xCC, 0x5F, 0x50, 0x00, 0x00, 0xCC, 0x5F, 0x50, 0x00, 0x00, 0xCC,
+        0x5F, 0x50, 0x00, 0x00, 0xCC, 0x5F, 0x50, 0x00, 0x00, 0xCC, 0x5F, 0x50, 0x00, 0x00, 0xCC, 0x00,
+        0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x49, 0xF7, 0x00, 0x00,
+        0x00, 0xBE, 0x91, 0x7F, 0x3A, 0xEE, 0xA2, 0x00, 0x7F, 0xD8, 0x35, 0xEB, 0x00, 0x7F, 0x80, 0x00,
+        0x7F, 0x20, 0x7F, 0x30, 0x00, 0x4F, 0x40, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F,
+        0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50, 0x7F, 0x10, 0x00, 0x3F, 0x50,
+        0x7F, 0x10, 0x00, 0x3F, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00,
+        0x03, 0x56, 0xCE, 0x10, 0x00, 0x0A, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0xCF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x34, 0x44, 0x41, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xB4, 0x00, 0x00, 0x00, 0x4E, 0xFA, 0x78,
+        0xDF, 0x80, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x0A, 0xF6, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x01, 0xED,
+        0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x0F,
+        0xB0, 0x00, 0x00, 0x00, 0x5F, 0x60, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x0C, 0xE0, 0x00,
+        0x00, 0x00, 0x9F, 0x30, 0x08, 0xF5, 0x00, 0x00, 0x01, 0xED, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x0A,
+        0xF6, 0x00, 0x00, 0x4E, 0xF9, 0x78, 0xDF, 0x80, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xB5, 0x00, 0x00,
+        0x00, 0x4F, 0xFF, 0xFA, 0x00, 0x00, 0x14, 0x44, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEF, 0xC5, 0x00, 0x02, 0xEE, 0x87, 0xCF, 0x60, 0x09, 0xF3,
+        0x00, 0x0C, 0xE1, 0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x0F, 0x90, 0x00, 0x03, 0xF7, 0x0F, 0x90, 0x00,
+        0x03, 0xF6, 0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x09, 0xF3, 0x00, 0x0C, 0xE1, 0x02, 0xEE, 0x87, 0xCF,
+        0x60, 0x00, 0x2A, 0xEF, 0xC5, 0x00, 0x00, 0x00, 0xC6, 0x02, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x4E,
+        0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xB4, 0x00, 0x00, 0x00, 0x4E, 0xFA, 0x78, 0xDF, 0x80, 0x00,
+        0x01, 0xEE, 0x30, 0x00, 0x0A, 0xF6, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x01, 0xED, 0x00, 0x0C, 0xE0,
+        0x00, 0x00, 0x00, 0x9F, 0x30, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x0F, 0xB0, 0x00, 0x00,
+        0x00, 0x5F, 0x60, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x9F,
+        0x30, 0x08, 0xF5, 0x00, 0x00, 0x01, 0xED, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x0A, 0xF6, 0x00, 0x00,
+        0x4E, 0xF9, 0x78, 0xDF, 0x80, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xB5, 0x00, 0x00, 0x00, 0x35, 0x00,
+        0x26, 0x00, 0x00, 0x3E, 0x31, 0xA9, 0x00, 0x00, 0x09, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x12, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEF, 0xC5, 0x00, 0x02, 0xEE, 0x87, 0xCF, 0x60,
+        0x09, 0xF3, 0x00, 0x0C, 0xE1, 0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x0F, 0x90, 0x00, 0x03, 0xF7, 0x0F,
+        0x90, 0x00, 0x03, 0xF6, 0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x09, 0xF3, 0x00, 0x0C, 0xE1, 0x02, 0xEE,
+        0x87, 0xCF, 0x60, 0x00, 0x2A, 0xEF, 0xC5, 0x00, 0x00, 0x00, 0x06, 0xE2, 0x9D, 0x10, 0x00, 0x00,
+        0x00, 0x2E, 0x44, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x23, 0x03, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xB4, 0x00, 0x00, 0x00, 0x4E, 0xFA, 0x78, 0xDF,
+        0x80, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x0A, 0xF6, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x01, 0xED, 0x00,
+        0x0C, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x0F, 0xB0,
+        0x00, 0x00, 0x00, 0x5F, 0x60, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x0C, 0xE0, 0x00, 0x00,
+        0x00, 0x9F, 0x30, 0x08, 0xF5, 0x00, 0x00, 0x01, 0xED, 0x00, 0x01, 0xEE, 0x30, 0x00, 0x0A, 0xF6,
+        0x00, 0x00, 0x4E, 0xF9, 0x78, 0xDF, 0x80, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xB5, 0x00, 0x00, 0x00,
+        0x00, 0x14, 0x12, 0x40, 0x00, 0x00, 0x7D, 0x0B, 0xA0, 0x00, 0x01, 0xE5, 0x4E, 0x10, 0x00, 0x07,
+        0xB0, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEF, 0xC5, 0x00, 0x02, 0xEE, 0x87,
+        0xCF, 0x60, 0x09, 0xF3, 0x00, 0x0C, 0xE1, 0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x0F, 0x90, 0x00, 0x03,
+        0xF7, 0x0F, 0x90, 0x00, 0x03, 0xF6, 0x0E, 0xB0, 0x00, 0x05, 0xF5, 0x09, 0xF3, 0x00, 0x0C, 0xE1,
+        0x02, 0xEE, 0x87, 0xCF, 0x60, 0x00, 0x2A, 0xEF, 0xC5, 0x00, 0x00, 0x00, 0x5A, 0xDE, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xE0, 0x00, 0x2C, 0xFD, 0xA8, 0x7E, 0xD7, 0x77, 0x77, 0x70, 0x01, 0xDF, 0x60, 0x00,
+        0x0D, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x0C, 0xF1,
+        0x00, 0x00, 0x0D, 0xC2, 0x22, 0x22, 0x10, 0x0F, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xA0,
+        0x0F, 0xB0, 0x00, 0x00, 0x0D, 0xD5, 0x55, 0x55, 0x30, 0x0F, 0xC0, 0x00, 0x00, 0x0D, 0xC0, 0x00,
+        0x00, 0x00, 0x0C, 0xF1, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x0D,
+        0xC0, 0x00, 0x00, 0x00, 0x01, 0xDF, 0x60, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFD,
+        0x98, 0x7E, 0xD7, 0x77, 0x77, 0x71, 0x00, 0x00, 0x5A, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+        0x2A, 0xEE, 0xC5, 0x01, 0x9D, 0xFD, 0x70, 0x00, 0x02, 0xEE, 0x87, 0xCF, 0x7D, 0xE8, 0x69, 0xF9,
+        0x00, 0x09, 0xF3, 0x00, 0x0C, 0xFE, 0x20, 0x00, 0x7F, 0x20, 0x0E, 0xB0, 0x00, 0x05, 0xFA, 0x00,
+        0x00, 0x2F, 0x60, 0x0F, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x0F, 0x90, 0x00, 0x03,
+        0xFA, 0x33, 0x33, 0x33, 0x20, 0x0E, 0xB0, 0x00, 0x05, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF3,
+        0x00, 0x0C, 0xFF, 0x40, 0x00, 0x01, 0x10, 0x02, 0xEE, 0x87, 0xCF, 0x7D, 0xF9, 0x67, 0x9E, 0x20,
+        0x00, 0x2A, 0xEE, 0xC5, 0x01, 0x8D, 0xFE, 0xC7, 0x10, 0x00, 0x00, 0x28, 0x20, 0x00, 0x00, 0x00,
+        0x01, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x5F, 0xFF, 0xFE, 0xA3, 0x00, 0x00, 0x5F, 0xA7, 0x7A, 0xFE, 0x20, 0x00, 0x5F, 0x50, 0x00,
+        0x6F, 0x80, 0x00, 0x5F, 0x50, 0x00, 0x2F, 0xA0, 0x00, 0x5F, 0x50, 0x00, 0x4F, 0x90, 0x00, 0x5F,
+        0x62, 0x25, 0xDF, 0x40, 0x00, 0x5F, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x5F, 0x85, 0x5A, 0xF5, 0x00,
+        0x00, 0x5F, 0x50, 0x00, 0xAE, 0x20, 0x00, 0x5F, 0x50, 0x00, 0x2F, 0xA0, 0x00, 0x5F, 0x50, 0x00,
+        0x09, 0xF2, 0x00, 0x5F, 0x50, 0x00, 0x03, 0xF9, 0x00, 0x5F, 0x50, 0x00, 0x00, 0xBF, 0x20, 0x00,
+        0x00, 0x28, 0x30, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x06, 0xE2, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x7F, 0x3A, 0xEF, 0x00, 0x7F, 0xD8, 0x45, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x7F,
+        0x30, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F,
+        0x10, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x5F, 0xFF, 0xFE, 0xA3, 0x00,
+        0x00, 0x5F, 0xA7, 0x7A, 0xFE, 0x20, 0x00, 0x5F, 0x50, 0x00, 0x6F, 0x80, 0x00, 0x5F, 0x50, 0x00,
+        0x2F, 0xA0, 0x00, 0x5F, 0x50, 0x00, 0x4F, 0x90, 0x00, 0x5F, 0x62, 0x25, 0xDF, 0x40, 0x00, 0x5F,
+        0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x5F, 0x85, 0x5A, 0xF5, 0x00, 0x00, 0x5F, 0x50, 0x00, 0xAE, 0x20,
+        0x00, 0x5F, 0x50, 0x00, 0x2F, 0xA0, 0x00, 0x5F, 0x50, 0x00, 0x09, 0xF2, 0x00, 0x5F, 0x50, 0x00,
+        0x03, 0xF9, 0x00, 0x5F, 0x50, 0x00, 0x00, 0xBF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x2C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x10, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0x7F, 0x3A, 0xEF, 0x7F, 0xD8, 0x45, 0x7F, 0x90, 0x00, 0x7F, 0x30, 0x00,
+        0x7F, 0x20, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x10, 0x00, 0x7F, 0x10, 0x00, 0x7F,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x40, 0x00, 0x8D, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x01, 0x71,
+        0x04, 0x50, 0x00, 0x00, 0x00, 0x8B, 0x3E, 0x20, 0x00, 0x00, 0x00, 0x0C, 0xF6, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFE, 0xA3, 0x00, 0x00, 0x5F, 0xA7, 0x7A, 0xFE,
+        0x20, 0x00, 0x5F, 0x50, 0x00, 0x6F, 0x80, 0x00, 0x5F, 0x50, 0x00, 0x2F, 0xA0, 0x00, 0x5F, 0x50,
+        0x00, 0x4F, 0x90, 0x00, 0x5F, 0x62, 0x25, 0xDF, 0x40, 0x00, 0x5F, 0xFF, 0xFF, 0xE6, 0x00, 0x00,
+        0x5F, 0x85, 0x5A, 0xF5, 0x00, 0x00, 0x5F, 0x50, 0x00, 0xAE, 0x20, 0x00, 0x5F, 0x50, 0x00, 0x2F,
+        0xA0, 0x00, 0x5F, 0x50, 0x00, 0x09, 0xF2, 0x00, 0x5F, 0x50, 0x00, 0x03, 0xF9, 0x00, 0x5F, 0x50,
+        0x00, 0x00, 0xBF, 0x20, 0x07, 0x10, 0x17, 0x00, 0x09, 0xA0, 0xA8, 0x00, 0x01, 0xE9, 0xE1, 0x00,
+        0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x3A, 0xEF, 0x00, 0x7F, 0xD8, 0x45, 0x00,
+        0x7F, 0x90, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00,
+        0x7F, 0x10, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x7F, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x6E, 0x20, 0x00, 0x00, 0x01, 0xE5, 0x00, 0x00, 0x00, 0x04, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x02, 0xAD, 0xFE, 0xB7, 0x00, 0x3F, 0xE9, 0x78, 0xBF, 0x10, 0xBF, 0x20,
+        0x00, 0x02, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x30, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x84,
+        0x00, 0x00, 0x03, 0xAE, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x26, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x2F,
+        0xB0, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x50, 0x00, 0x00, 0x4F, 0xA0, 0xCE, 0xA7, 0x7A, 0xFE, 0x30,
+        0x49, 0xCE, 0xFD, 0xA2, 0x00, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x00, 0x0C, 0xA0, 0x00, 0x00,
+        0x00, 0x9B, 0x00, 0x00, 0x00, 0x01, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D,
+        0xFE, 0xC4, 0x00, 0x0A, 0xF8, 0x67, 0xA7, 0x00, 0x0E, 0x80, 0x00, 0x00, 0x00, 0x0D, 0xC2, 0x00,
+        0x00, 0x00, 0x05, 0xFF, 0xC8, 0x30, 0x00, 0x00, 0x16, 0xAE, 0xF6, 0x00, 0x00, 0x00, 0x01, 0xCE,
+        0x00, 0x01, 0x00, 0x00, 0xAF, 0x00, 0x1E, 0x97, 0x69, 0xFA, 0x00, 0x08, 0xCE, 0xED, 0x70, 0x00,
+        0x00, 0x0A, 0xF9, 0x00, 0x00, 0x00, 0x5D, 0x2D, 0x40, 0x00, 0x00, 0x72, 0x03, 0x60, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x02, 0xAD, 0xFE, 0xB7, 0x00, 0x3F, 0xE9, 0x78, 0xBF, 0x10, 0xBF, 0x20,
+        0x00, 0x02, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x30, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x84,
+        0x00, 0x00, 0x03, 0xAE, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x26, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x2F,
+        0xB0, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x50, 0x00, 0x00, 0x4F, 0xA0, 0xCE, 0xA7, 0x7A, 0xFE, 0x30,
+        0x49, 0xCE, 0xFD, 0xA2, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x00, 0x0B, 0xDC, 0x00, 0x00, 0x00,
+        0x6C, 0x1B, 0x80, 0x00, 0x00, 0x72, 0x01, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D,
+        0xFE, 0xC4, 0x00, 0x0A, 0xF8, 0x67, 0xA7, 0x00, 0x0E, 0x80, 0x00, 0x00, 0x00, 0x0D, 0xC2, 0x00,
+        0x00, 0x00, 0x05, 0xFF, 0xC8, 0x30, 0x00, 0x00, 0x16, 0xAE, 0xF6, 0x00, 0x00, 0x00, 0x01, 0xCE,
+        0x00, 0x01, 0x00, 0x00, 0xAF, 0x00, 0x1E, 0x97, 0x69, 0xFA, 0x00, 0x08, 0xCE, 0xED, 0x70, 0x00,
+        0x02, 0xAD, 0xFE, 0xB7, 0x00, 0x3F, 0xE9, 0x78, 0xBF, 0x10, 0xBF, 0x20, 0x00, 0x02, 0x00, 0xDD,
+        0x00, 0x00, 0x00, 0x00, 0xBF, 0x30, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x84, 0x00, 0x00, 0x03, 0xAE,
+        0xFF, 0xE6, 0x00, 0x00, 0x00, 0x26, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xB0, 0x00, 0x00, 0x00,
+        0x0E, 0xC0, 0x50, 0x00, 0x00, 0x4F, 0xA0, 0xCE, 0xA7, 0x7A, 0xFE, 0x30, 0x49, 0xCE, 0xFE, 0xA2,
+        0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x22, 0x6E, 0x00, 0x00,
+        0x00, 0x6E, 0xE6, 0x00, 0x00, 0x01, 0x8D, 0xFE, 0xC4, 0x00, 0x0A, 0xF8, 0x67, 0xA7, 0x00, 0x0E,
+        0x80, 0x00, 0x00, 0x00, 0x0D, 0xC2, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xC8, 0x30, 0x00, 0x00, 0x16,
+        0xAE, 0xF6, 0x00, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x01, 0x00, 0x00, 0xAF, 0x00, 0x1E, 0x97, 0x69,
+        0xFA, 0x00, 0x08, 0xCE, 0xFD, 0x70, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
+        0x00, 0x00, 0x22, 0x6F, 0x00, 0x00, 0x00, 0x5E, 0xE7, 0x00, 0x00, 0x00, 0xB7, 0x09, 0x90, 0x00,
+        0x00, 0x2E, 0xAD, 0x10, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+        0xAD, 0xFE, 0xB7, 0x00, 0x3F, 0xE9, 0x78, 0xBF, 0x10, 0xBF, 0x20, 0x00, 0x02, 0x00, 0xDD, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0x30, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x84, 0x00, 0x00, 0x03, 0xAE, 0xFF,
+        0xE6, 0x00, 0x00, 0x00, 0x26, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x0E,
+        0xC0, 0x50, 0x00, 0x00, 0x4F, 0xA0, 0xCE, 0xA7, 0x7A, 0xFE, 0x30, 0x49, 0xCE, 0xFD, 0xA2, 0x00,
+        0x00, 0x72, 0x01, 0x71, 0x00, 0x00, 0x6D, 0x1A, 0x90, 0x00, 0x00, 0x0A, 0xDD, 0x10, 0x00, 0x00,
+        0x01, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFE, 0xC4, 0x00, 0x0A, 0xF8,
+        0x67, 0xA7, 0x00, 0x0E, 0x80, 0x00, 0x00, 0x00, 0x0D, 0xC2, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xC8,
+        0x30, 0x00, 0x00, 0x16, 0xAE, 0xF6, 0x00, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x01, 0x00, 0x00, 0xAF,
+        0x00, 0x1E, 0x97, 0x69, 0xFA, 0x00, 0x08, 0xCE, 0xED, 0x70, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xF7, 0x07, 0x77, 0x7C, 0xF8, 0x77, 0x73, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A,
+        0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00,
+        0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A,
+        0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x32, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xC2, 0x00,
+        0x00, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x40, 0x29, 0xF5, 0x44,
+        0x10, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF2, 0x00,
+        0x00, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x03, 0xFB, 0x65, 0x10, 0x00, 0x7D, 0xFF,
+        0x40, 0x00, 0x01, 0xD1, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x32, 0xC8, 0x00, 0x00, 0xBF, 0xC2,
+        0x00, 0x00, 0x01, 0x70, 0x05, 0x40, 0x00, 0x00, 0x00, 0x9A, 0x4E, 0x20, 0x00, 0x00, 0x00, 0x1D,
+        0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x07,
+        0x77, 0x7C, 0xF8, 0x77, 0x73, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00,
+        0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A,
+        0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00,
+        0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x10, 0x00, 0x00, 0x7F, 0x20, 0x02,
+        0x40, 0x9D, 0x00, 0x06, 0xF2, 0xC8, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x40, 0x29,
+        0xF5, 0x44, 0x10, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x06,
+        0xF2, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x03, 0xFB, 0x65, 0x10, 0x00,
+        0x7D, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x07, 0x77, 0x7C, 0xF8, 0x77, 0x73, 0x00,
+        0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00,
+        0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x02, 0x2B, 0xF2, 0x20, 0x00, 0x00, 0x0D, 0xFF,
+        0xFF, 0xF4, 0x00, 0x00, 0x04, 0x5C, 0xF5, 0x51, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00,
+        0x00, 0x03, 0x81, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+        0x40, 0x29, 0xF5, 0x44, 0x10, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+        0x40, 0x28, 0xF4, 0x33, 0x10, 0x06, 0xF2, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x03, 0xFA, 0x55,
+        0x10, 0x00, 0x7D, 0xFF, 0x40, 0x00, 0x1B, 0xC5, 0x3C, 0x00, 0x00, 0x6B, 0x4D, 0xF7, 0x00, 0x00,
+        0x11, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20,
+        0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00,
+        0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00,
+        0xBF, 0x7F, 0x30, 0x00, 0x00, 0xBE, 0x5F, 0x50, 0x00, 0x00, 0xEC, 0x1F, 0xC1, 0x00, 0x06, 0xF8,
+        0x07, 0xFD, 0x87, 0xAF, 0xD1, 0x00, 0x5C, 0xEF, 0xD9, 0x10, 0x00, 0xBE, 0x71, 0xF0, 0x00, 0x05,
+        0xC4, 0xCF, 0x90, 0x00, 0x01, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00,
+        0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00,
+        0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x5F, 0x40, 0x7F, 0x10, 0x00, 0x7F,
+        0x40, 0x5F, 0x40, 0x01, 0xDF, 0x40, 0x1E, 0xE7, 0x7D, 0xCF, 0x40, 0x03, 0xCF, 0xD7, 0x5F, 0x40,
+        0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x14, 0x44, 0x42, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20,
+        0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00,
+        0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x7F, 0x30, 0x00, 0x00,
+        0xBE, 0x5F, 0x50, 0x00, 0x00, 0xEC, 0x1F, 0xC1, 0x00, 0x06, 0xF8, 0x07, 0xFD, 0x87, 0xAF, 0xD1,
+        0x00, 0x5C, 0xEF, 0xD9, 0x10, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0x44, 0x44, 0x30, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00,
+        0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00,
+        0x4F, 0x40, 0x8F, 0x00, 0x00, 0x5F, 0x40, 0x7F, 0x10, 0x00, 0x7F, 0x40, 0x5F, 0x40, 0x01, 0xDF,
+        0x40, 0x1E, 0xE7, 0x7D, 0xCF, 0x40, 0x03, 0xCF, 0xD7, 0x5F, 0x40, 0x00, 0x4D, 0x20, 0x7A, 0x00,
+        0x00, 0x09, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+        0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20,
+        0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00,
+        0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x7F, 0x30, 0x00, 0x00, 0xBE, 0x5F, 0x50, 0x00, 0x00,
+        0xEC, 0x1F, 0xC1, 0x00, 0x06, 0xF8, 0x07, 0xFD, 0x87, 0xAF, 0xD1, 0x00, 0x5C, 0xEF, 0xD9, 0x10,
+        0x02, 0x60, 0x01, 0x70, 0x00, 0x01, 0xE4, 0x18, 0xB0, 0x00, 0x00, 0x7F, 0xFE, 0x30, 0x00, 0x00,
+        0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00,
+        0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00,
+        0x4F, 0x40, 0x8F, 0x00, 0x00, 0x5F, 0x40, 0x7F, 0x10, 0x00, 0x7F, 0x40, 0x5F, 0x40, 0x01, 0xDF,
+        0x40, 0x1E, 0xE7, 0x7D, 0xCF, 0x40, 0x03, 0xCF, 0xD7, 0x5F, 0x40, 0x00, 0x02, 0xBD, 0x70, 0x00,
+        0x00, 0x0B, 0x73, 0xD4, 0x00, 0x00, 0x0F, 0x00, 0x87, 0x00, 0x00, 0x0D, 0x51, 0xC5, 0x00, 0x8F,
+        0x24, 0xEF, 0xB0, 0xBF, 0x8F, 0x20, 0x12, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20,
+        0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00,
+        0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x7F, 0x30, 0x00, 0x00, 0xBE, 0x5F, 0x50, 0x00, 0x00,
+        0xEC, 0x1F, 0xC1, 0x00, 0x06, 0xF8, 0x07, 0xFD, 0x87, 0xAF, 0xD1, 0x00, 0x5C, 0xEF, 0xD9, 0x10,
+        0x00, 0x3C, 0xD9, 0x00, 0x00, 0x00, 0xD6, 0x3B, 0x60, 0x00, 0x00, 0xE3, 0x0A, 0x70, 0x00, 0x00,
+        0x5E, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00,
+        0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00,
+        0x4F, 0x40, 0x8F, 0x00, 0x00, 0x5F, 0x40, 0x7F, 0x10, 0x00, 0x7F, 0x40, 0x5F, 0x40, 0x01, 0xDF,
+        0x40, 0x1E, 0xE7, 0x7D, 0xCF, 0x40, 0x03, 0xCF, 0xD7, 0x5F, 0x40, 0x00, 0x00, 0xCA, 0x2E, 0x60,
+        0x00, 0x08, 0xC1, 0xB9, 0x00, 0x00, 0x04, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+        0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20,
+        0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00,
+        0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x7F, 0x30, 0x00, 0x00, 0xBE, 0x5F, 0x50, 0x00, 0x00,
+        0xEC, 0x1F, 0xC1, 0x00, 0x06, 0xF8, 0x07, 0xFD, 0x87, 0xAF, 0xD1, 0x00, 0x5C, 0xEF, 0xD9, 0x10,
+        0x00, 0x00, 0x41, 0x14, 0x10, 0x00, 0x05, 0xE1, 0x9C, 0x00, 0x00, 0x0C, 0x72, 0xE3, 0x00, 0x00,
+        0x5D, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00,
+        0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00,
+        0x4F, 0x40, 0x8F, 0x00, 0x00, 0x5F, 0x40, 0x7F, 0x10, 0x00, 0x7F, 0x40, 0x5F, 0x40, 0x01, 0xDF,
+        0x40, 0x1E, 0xE7, 0x7D, 0xCF, 0x40, 0x03, 0xCF, 0xD7, 0x5F, 0x40, 0x8F, 0x20, 0x00, 0x00, 0xBF,
+        0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F,
+        0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20, 0x00, 0x00, 0xBF, 0x8F, 0x20,
+        0x00, 0x00, 0xBF, 0x7F, 0x30, 0x00, 0x00, 0xBE, 0x5F, 0x50, 0x00, 0x00, 0xEC, 0x1F, 0xC1, 0x00,
+        0x06, 0xF8, 0x07, 0xFD, 0x87, 0xAF, 0xD1, 0x00, 0x5C, 0xFF, 0xD9, 0x10, 0x00, 0x00, 0xA6, 0x00,
+        0x00, 0x00, 0x01, 0xF1, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x30, 0x00, 0x00, 0x00, 0x9E, 0xD0, 0x00,
+        0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F,
+        0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x5F, 0x40, 0x7F, 0x10,
+        0x00, 0x7F, 0x40, 0x5F, 0x40, 0x01, 0xDF, 0x40, 0x1E, 0xE7, 0x7D, 0xCF, 0x40, 0x03, 0xCF, 0xD7,
+        0x5F, 0x40, 0x00, 0x00, 0x00, 0x2D, 0x10, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x9B,
+        0x22, 0x00, 0x00, 0x00, 0x3D, 0xF6, 0x00, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x4D, 0x6D, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x04, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x60, 0x00, 0x0A, 0xF7, 0x00,
+        0x00, 0x9F, 0x20, 0x1F, 0x90, 0x00, 0x0D, 0xFA, 0x00, 0x00, 0xCD, 0x00, 0x0D, 0xD0, 0x00, 0x2F,
+        0xAE, 0x00, 0x01, 0xFA, 0x00, 0x09, 0xF1, 0x00, 0x5F, 0x3F, 0x30, 0x04, 0xF6, 0x00, 0x05, 0xF5,
+        0x00, 0x9C, 0x0E, 0x60, 0x08, 0xF3, 0x00, 0x02, 0xF8, 0x00, 0xD8, 0x0B, 0xA0, 0x0B, 0xE0, 0x00,
+        0x00, 0xDC, 0x01, 0xF5, 0x07, 0xD0, 0x0E, 0xA0, 0x00, 0x00, 0xAF, 0x15, 0xF1, 0x04, 0xF2, 0x3F,
+        0x70, 0x00, 0x00, 0x6F, 0x48, 0xD0, 0x00, 0xF5, 0x7F, 0x30, 0x00, 0x00, 0x2F, 0x8C, 0x90, 0x00,
+        0xC9, 0xBE, 0x00, 0x00, 0x00, 0x0E, 0xCF, 0x50, 0x00, 0x8D, 0xEB, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+        0x20, 0x00, 0x5F, 0xF7, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0C,
+        0x78, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x01, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2F, 0x50, 0x01, 0xFE, 0x00, 0x07, 0xF1, 0x0E, 0x90, 0x05, 0xFF, 0x30, 0x0B, 0xC0,
+        0x0A, 0xD0, 0x08, 0xCD, 0x70, 0x0E, 0x90, 0x07, 0xF1, 0x0C, 0x8A, 0xB0, 0x3F, 0x50, 0x03, 0xF5,
+        0x1F, 0x46, 0xE0, 0x7F, 0x10, 0x00, 0xE9, 0x4F, 0x12, 0xF3, 0xAD, 0x00, 0x00, 0xBD, 0x8C, 0x00,
+        0xE7, 0xE9, 0x00, 0x00, 0x7F, 0xD8, 0x00, 0xAD, 0xF6, 0x00, 0x00, 0x3F, 0xF5, 0x00, 0x6F, 0xF2,
+        0x00, 0x00, 0x0E, 0xF1, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x06, 0x71, 0x00, 0x00, 0x00, 0x00,
+        0x7C, 0x7C, 0x10, 0x00, 0x00, 0x01, 0x71, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0B, 0xE2, 0x00, 0x00, 0x0B, 0xE2, 0x02, 0xEB, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x6F, 0x60, 0x01,
+        0xEC, 0x00, 0x00, 0x0C, 0xE1, 0x09, 0xF3, 0x00, 0x00, 0x02, 0xFA, 0x4F, 0x80, 0x00, 0x00, 0x00,
+        0x8F, 0xED, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0,
+        0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x01,
+        0xDE, 0x10, 0x00, 0x00, 0x09, 0xA9, 0xA0, 0x00, 0x00, 0x4D, 0x11, 0xC5, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x5F, 0x50, 0x00, 0x04, 0xF5, 0x0E, 0xA0, 0x00, 0x09, 0xE1, 0x08, 0xF1, 0x00, 0x0E,
+        0x90, 0x03, 0xF6, 0x00, 0x5F, 0x40, 0x00, 0xCB, 0x00, 0xBD, 0x00, 0x00, 0x7F, 0x21, 0xF8, 0x00,
+        0x00, 0x1F, 0x77, 0xF2, 0x00, 0x00, 0x0A, 0xDC, 0xC0, 0x00, 0x00, 0x05, 0xFF, 0x60, 0x00, 0x00,
+        0x00, 0xEF, 0x10, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x00, 0x03, 0x6D,
+        0xD0, 0x00, 0x00, 0x0A, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x04, 0xF6, 0x0F, 0xA0, 0x00, 0x00, 0x03,
+        0xC5, 0x0C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE2, 0x00, 0x00, 0x0B, 0xE2,
+        0x02, 0xEB, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x6F, 0x60, 0x01, 0xEC, 0x00, 0x00, 0x0C, 0xE1, 0x09,
+        0xF3, 0x00, 0x00, 0x02, 0xFA, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xED, 0x00, 0x00, 0x00, 0x00,
+        0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0,
+        0x00, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x00, 0x00,
+        0x1C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x07, 0x77, 0x77, 0x77, 0xCF, 0x80, 0x00, 0x00, 0x00, 0x03,
+        0xFC, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xE2, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
+        0x07, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x02, 0xED, 0x10, 0x00, 0x00,
+        0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x05, 0xFA, 0x00, 0x00,
+        0x00, 0x00, 0x2E, 0xF8, 0x77, 0x77, 0x77, 0x60, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+        0x02, 0x83, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x6E, 0x20, 0x00, 0x00, 0x02, 0xE4,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x30, 0x04, 0x44, 0x44, 0xDF,
+        0x20, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x4F, 0x90, 0x00, 0x00, 0x02, 0xEC, 0x00, 0x00,
+        0x00, 0x1C, 0xE1, 0x00, 0x00, 0x00, 0xAF, 0x30, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x3F,
+        0xC4, 0x44, 0x44, 0x10, 0x4F, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00,
+        0x00, 0x0C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xA0, 0x07, 0x77, 0x77, 0x77, 0xCF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
+        0x1D, 0xE2, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x00,
+        0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x02, 0xED, 0x10, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xF8, 0x77,
+        0x77, 0x77, 0x60, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x05, 0xF3, 0x00, 0x00, 0x00, 0x05,
+        0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+        0xFF, 0x30, 0x04, 0x44, 0x44, 0xDF, 0x20, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x4F, 0x90,
+        0x00, 0x00, 0x02, 0xEC, 0x00, 0x00, 0x00, 0x1C, 0xE1, 0x00, 0x00, 0x00, 0xAF, 0x30, 0x00, 0x00,
+        0x07, 0xF6, 0x00, 0x00, 0x00, 0x3F, 0xC4, 0x44, 0x44, 0x10, 0x4F, 0xFF, 0xFF, 0xFF, 0x30, 0x00,
+        0x04, 0x50, 0x17, 0x10, 0x00, 0x00, 0x01, 0xC8, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x17, 0x60, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x07, 0x77, 0x77,
+        0x77, 0xCF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xE2, 0x00, 0x00,
+        0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00,
+        0x00, 0x00, 0x02, 0xED, 0x10, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x60,
+        0x00, 0x00, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xF8, 0x77, 0x77, 0x77, 0x60, 0x4F,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x71, 0x01, 0x70, 0x00, 0x00, 0x9A, 0x0A, 0x80, 0x00, 0x00,
+        0x1E, 0x9E, 0x10, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+        0xFF, 0xFF, 0x30, 0x04, 0x44, 0x44, 0xDF, 0x20, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x4F,
+        0x90, 0x00, 0x00, 0x02, 0xEC, 0x00, 0x00, 0x00, 0x1C, 0xE1, 0x00, 0x00, 0x00, 0xAF, 0x30, 0x00,
+        0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x3F, 0xC4, 0x44, 0x44, 0x10, 0x4F, 0xFF, 0xFF, 0xFF, 0x30,
+        0x00, 0x2B, 0xEF, 0x50, 0x00, 0xCD, 0x65, 0x20, 0x01, 0xF7, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00,
+        0x9F, 0xF6, 0x00, 0x00, 0x26, 0xF6, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00,
+        0x02, 0xF6, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00,
+        0x02, 0xF6, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFA,
+        0x13, 0x33, 0x33, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10, 0x07,
+        0xB0, 0x0D, 0x80, 0x6F, 0x40, 0x8F, 0x30, 0x24, 0x10, 0x0D, 0xE0, 0x0D, 0xC0, 0x2F, 0x50, 0x6D,
+        0x00, 0x11, 0x00, 0x07, 0xB0, 0x1E, 0x20, 0x0D, 0x80, 0x8E, 0x00, 0x6F, 0x41, 0xEA, 0x00, 0x8F,
+        0x32, 0xF9, 0x00, 0x24, 0x11, 0x43, 0x00, 0x0D, 0xD0, 0x7F, 0x40, 0x0E, 0xC0, 0x8F, 0x30, 0x2F,
+        0x60, 0xBC, 0x00, 0x6D, 0x00, 0xE5, 0x00, 0x23, 0x01, 0x40, 0x00, 0x03, 0x20, 0x00, 0x13, 0x10,
+        0x00, 0x23, 0x00, 0x1F, 0xB0, 0x00, 0x6F, 0x60, 0x00, 0xBF, 0x10, 0x1F, 0xB0, 0x00, 0x6F, 0x60,
+        0x00, 0xBF, 0x10,
+};
+
+static const FontGlyph glyphs[] = {
+        {0x0020, 0, 0, 0, 0, 5, 0},
+        {0x0021, 3, 13, 2, 13, 7, 0},
+        {0x0022, 6, 5, 1, 13, 8, 26},
+        {0x0023, 12, 13, 1, 13, 14, 41},
+        {0x0024, 9, 17, 1, 14, 11, 119},
+        {0x0025, 16, 13, 0, 13, 16, 204},
+        {0x0026, 12, 13, 1, 13, 13, 308},
+        {0x0027, 3, 5, 1, 13, 5, 386},
+        {0x0028, 5, 16, 1, 14, 7, 396},
+        {0x0029, 5, 16, 1, 14, 7, 444},
+        {0x002A, 8, 9, 0, 13, 9, 492},
+        {0x002B, 12, 12, 1, 12, 14, 528},
+        {0x002C, 3, 5, 1, 3, 5, 600},
+        {0x002D, 6, 3, 0, 6, 6, 610},
+        {0x002E, 3, 3, 1, 3, 5, 619},
+        {0x002F, 6, 15, 0, 13, 6, 625},
+        {0x0030, 9, 13, 1, 13, 11, 670},
+        {0x0031, 9, 13, 1, 13, 11, 735},
+        {0x0032, 9, 13, 1, 13, 11, 800},
+        {0x0033, 9, 13, 1, 13, 11, 865},
+        {0x0034, 10, 13, 0, 13, 11, 930},
+        {0x0035, 9, 13, 1, 13, 11, 995},
+        {0x0036, 9, 13, 1, 13, 11, 1060},
+        {0x0037, 9, 13, 1, 13, 11, 1125},
+        {0x0038, 9, 13, 1, 13, 11, 1190},
+        {0x0039, 9, 13, 1, 13, 11, 1255},
+        {0x003A, 2, 10, 2, 10, 6, 1320},
+        {0x003B, 3, 12, 1, 10, 6, 1330},
+        {0x003C, 12, 11, 1, 11, 14, 1354},
+        {0x003D, 12, 7, 1, 9, 14, 1420},
+        {0x003E, 12, 11, 1, 11, 14, 1462},
+        {0x003F, 7, 13, 1, 13, 9, 1528},
+        {0x0040, 15, 17, 1, 13, 17, 1580},
+        {0x0041, 12, 13, 0, 13, 12, 1716},
+        {0x0042, 10, 13, 1, 13, 12, 1794},
+        {0x0043, 11, 13, 0, 13, 12, 1859},
+        {0x0044, 12, 13, 1, 13, 13, 1937},
+        {0x0045, 9, 13, 1, 13, 11, 2015},
+        {0x0046, 8, 13, 1, 13, 10, 2080},
+        {0x0047, 12, 13, 0, 13, 13, 2132},
+        {0x0048, 11, 13, 1, 13, 13, 2210},
+        {0x0049, 3, 13, 1, 13, 5, 2288},
+        {0x004A, 5, 17, -1, 13, 5, 2314},
+        {0x004B, 11, 13, 1, 13, 11, 2365},
+        {0x004C, 9, 13, 1, 13, 9, 2443},
+        {0x004D, 12, 13, 1, 13, 15, 2508},
+        {0x004E, 11, 13, 1, 13, 13, 2586},
+        {0x004F, 13, 13, 0, 13, 13, 2664},
+        {0x0050, 9, 13, 1, 13, 10, 2755},
+        {0x0051, 13, 15, 0, 13, 13, 2820},
+        {0x0052, 11, 13, 1, 13, 12, 2925},
+        {0x0053, 9, 13, 1, 13, 11, 3003},
+        {0x0054, 12, 13, -1, 13, 10, 3068},
+        {0x0055, 10, 13, 1, 13, 12, 3146},
+        {0x0056, 12, 13, 0, 13, 12, 3211},
+        {0x0057, 17, 13, 0, 13, 17, 3289},
+        {0x0058, 12, 13, 0, 13, 12, 3406},
+        {0x0059, 12, 13, -1, 13, 10, 3484},
+        {0x005A, 11, 13, 0, 13, 12, 3562},
+        {0x005B, 4, 17, 1, 14, 7, 3640},
+        {0x005C, 6, 15, 0, 13, 6, 3674},
+        {0x005D, 5, 17, 1, 14, 7, 3719},
+        {0x005E, 12, 5, 1, 13, 14, 3770},
+        {0x005F, 10, 3, -1, -2, 9, 3800},
+        {0x0060, 5, 4, 1, 15, 9, 3815},
+        {0x0061, 8, 10, 1, 10, 10, 3827},
+        {0x0062, 9, 14, 1, 14, 11, 3867},
+        {0x0063, 9, 10, 0, 10, 9, 3937},
+        {0x0064, 10, 14, 0, 14, 11, 3987},
+        {0x0065, 10, 10, 0, 10, 10, 4057},
+        {0x0066, 7, 14, 0, 14, 6, 4107},
+        {0x0067, 10, 14, 0, 10, 11, 4163},
+        {0x0068, 9, 14, 1, 14, 11, 4233},
+        {0x0069, 3, 14, 1, 14, 5, 4303},
+        {0x006A, 5, 18, -1, 14, 5, 4331},
+        {0x006B, 9, 14, 1, 14, 10, 4385},
+        {0x006C, 3, 14, 1, 14, 5, 4455},
+        {0x006D, 15, 10, 1, 10, 17, 4483},
+        {0x006E, 9, 10, 1, 10, 11, 4563},
+        {0x006F, 10, 10, 0, 10, 10, 4613},
+        {0x0070, 9, 14, 1, 10, 11, 4663},
+        {0x0071, 10, 14, 0, 10, 11, 4733},
+        {0x0072, 6, 11, 1, 11, 7, 4803},
+        {0x0073, 9, 10, 0, 10, 9, 4836},
+        {0x0074, 7, 13, 0, 13, 7, 4886},
+        {0x0075, 9, 10, 1, 10, 11, 4938},
+        {0x0076, 10, 10, 0, 10, 10, 4988},
+        {0x0077, 14, 10, 0, 10, 14, 5038},
+        {0x0078, 10, 10, 0, 10, 10, 5108},
+        {0x0079, 10, 14, 0, 10, 10, 5158},
+        {0x007A, 9, 10, 0, 10, 9, 5228},
+        {0x007B, 7, 17, 2, 14, 11, 5278},
+        {0x007C, 2, 18, 2, 14, 6, 5346},
+        {0x007D, 7, 17, 2, 14, 11, 5364},
+        {0x007E, 12, 4, 1, 8, 14, 5432},
+        {0x00A0, 0, 0, 0, 0, 5, 5456},
+        {0x00A1, 3, 13, 2, 10, 7, 5456},
+        {0x00A2, 8, 16, 1, 13, 11, 5482},
+        {0x00A3, 9, 13, 1, 13, 11, 5546},
+        {0x00A4, 11, 11, 0, 11, 11, 5611},
+        {0x00A5, 11, 13, 0, 13, 11, 5677},
+        {0x00A6, 2, 16, 2, 13, 6, 5755},
+        {0x00A7, 8, 16, 0, 13, 9, 5771},
+        {0x00A8, 6, 2, 1, 14, 9, 5835},
+        {0x00A9, 13, 13, 2, 13, 17, 5841},
+        {0x00AA, 7, 9, 0, 13, 8, 5932},
+        {0x00AB, 8, 9, 1, 10, 10, 5968},
+        {0x00AC, 12, 6, 1, 8, 14, 6004},
+        {0x00AD, 6, 3, 0, 6, 6, 6040},
+        {0x00AE, 13, 13, 2, 13, 17, 6049},
+        {0x00AF, 6, 3, 1, 14, 9, 6140},
+        {0x00B0, 6, 6, 1, 13, 9, 6149},
+        {0x00B1, 12, 12, 1, 12, 14, 6167},
+        {0x00B2, 6, 7, 0, 13, 7, 6239},
+        {0x00B3, 6, 7, 0, 13, 7, 6260},
+        {0x00B4, 5, 4, 3, 15, 9, 6281},
+        {0x00B5, 10, 14, 1, 10, 11, 6293},
+        {0x00B6, 8, 15, 1, 13, 11, 6363},
+        {0x00B7, 3, 3, 1, 8, 5, 6423},
+        {0x00B8, 4, 5, 2, 1, 9, 6429},
+        {0x00B9, 5, 7, 1, 13, 7, 6439},
+        {0x00BA, 8, 9, 0, 13, 8, 6460},
+        {0x00BB, 9, 9, 1, 10, 10, 6496},
+        {0x00BC, 15, 14, 1, 14, 16, 6541},
+        {0x00BD, 15, 13, 1, 13, 16, 6653},
+        {0x00BE, 16, 14, 0, 14, 16, 6757},
+        {0x00BF, 7, 14, 1, 10, 9, 6869},
+        {0x00C0, 12, 17, 0, 17, 12, 6925},
+        {0x00C1, 12, 17, 0, 17, 12, 7027},
+        {0x00C2, 12, 17, 0, 17, 12, 7129},
+        {0x00C3, 12, 17, 0, 17, 12, 7231},
+        {0x00C4, 12, 16, 0, 16, 12, 7333},
+        {0x00C5, 12, 17, 0, 17, 12, 7429},
+        {0x00C6, 16, 13, 0, 13, 17, 7531},
+        {0x00C7, 11, 17, 0, 13, 12, 7635},
+        {0x00C8, 9, 17, 1, 17, 11, 7737},
+        {0x00C9, 9, 17, 1, 17, 11, 7822},
+        {0x00CA, 9, 17, 1, 17, 11, 7907},
+        {0x00CB, 9, 16, 1, 16, 11, 7992},
+        {0x00CC, 4, 17, 0, 17, 5, 8072},
+        {0x00CD, 4, 17, 1, 17, 5, 8106},
+        {0x00CE, 7, 17, -1, 17, 5, 8140},
+        {0x00CF, 5, 16, 0, 16, 5, 8208},
+        {0x00D0, 13, 13, 0, 13, 13, 8256},
+        {0x00D1, 11, 17, 1, 17, 13, 8347},
+        {0x00D2, 13, 17, 0, 17, 13, 8449},
+        {0x00D3, 13, 17, 0, 17, 13, 8568},
+        {0x00D4, 13, 17, 0, 17, 13, 8687},
+        {0x00D5, 13, 17, 0, 17, 13, 8806},
+        {0x00D6, 13, 17, 0, 17, 13, 8925},
+        {0x00D7, 10, 11, 2, 11, 14, 9044},
+        {0x00D8, 13, 15, 0, 14, 13, 9099},
+        {0x00D9, 10, 17, 1, 17, 12, 9204},
+        {0x00DA, 10, 17, 1, 17, 12, 9289},
+        {0x00DB, 10, 17, 1, 17, 12, 9374},
+        {0x00DC, 10, 17, 1, 17, 12, 9459},
+        {0x00DD, 12, 17, -1, 17, 10, 9544},
+        {0x00DE, 9, 13, 1, 13, 10, 9646},
+        {0x00DF, 9, 14, 1, 14, 11, 9711},
+        {0x00E0, 8, 15, 1, 15, 10, 9781},
+        {0x00E1, 8, 15, 1, 15, 10, 9841},
+        {0x00E2, 8, 15, 1, 15, 10, 9901},
+        {0x00E3, 8, 14, 1, 14, 10, 9961},
+        {0x00E4, 8, 14, 1, 14, 10, 10017},
+        {0x00E5, 8, 16, 1, 16, 10, 10073},
+        {0x00E6, 15, 10, 1, 10, 17, 10137},
+        {0x00E7, 9, 14, 0, 10, 9, 10217},
+        {0x00E8, 10, 15, 0, 15, 10, 10287},
+        {0x00E9, 10, 15, 0, 15, 10, 10362},
+        {0x00EA, 10, 15, 0, 15, 10, 10437},
+        {0x00EB, 10, 14, 0, 14, 10, 10512},
+        {0x00EC, 5, 15, -1, 15, 5, 10582},
+        {0x00ED, 5, 15, 1, 15, 5, 10627},
+        {0x00EE, 7, 15, -1, 15, 5, 10672},
+        {0x00EF, 6, 14, -1, 14, 5, 10732},
+        {0x00F0, 10, 14, 0, 14, 10, 10774},
+        {0x00F1, 9, 14, 1, 14, 11, 10844},
+        {0x00F2, 10, 15, 0, 15, 10, 10914},
+        {0x00F3, 10, 15, 0, 15, 10, 10989},
+        {0x00F4, 10, 15, 0, 15, 10, 11064},
+        {0x00F5, 10, 14, 0, 14, 10, 11139},
+        {0x00F6, 10, 14, 0, 14, 10, 11209},
+        {0x00F7, 12, 9, 1, 10, 14, 11279},
+        {0x00F8, 10, 12, 0, 11, 10, 11333},
+        {0x00F9, 9, 15, 1, 15, 11, 11393},
+        {0x00FA, 9, 15, 1, 15, 11, 11468},
+        {0x00FB, 9, 15, 1, 15, 11, 11543},
+        {0x00FC, 9, 14, 1, 14, 11, 11618},
+        {0x00FD, 10, 18, 0, 14, 10, 11688},
+        {0x00FE, 9, 18, 1, 14, 11, 11778},
+        {0x00FF, 10, 18, 0, 14, 10, 11868},
+        {0x0100, 12, 17, 0, 17, 12, 11958},
+        {0x0101, 8, 14, 1, 14, 10, 12060},
+        {0x0102, 12, 17, 0, 17, 12, 12116},
+        {0x0103, 8, 14, 1, 14, 10, 12218},
+        {0x0104, 12, 17, 0, 13, 12, 12274},
+        {0x0105, 9, 14, 1, 10, 10, 12376},
+        {0x0106, 11, 17, 0, 17, 12, 12446},
+        {0x0107, 9, 15, 0, 15, 9, 12548},
+        {0x0108, 11, 17, 0, 17, 12, 12623},
+        {0x0109, 9, 15, 0, 15, 9, 12725},
+        {0x010A, 11, 17, 0, 17, 12, 12800},
+        {0x010B, 9, 14, 0, 14, 9, 12902},
+        {0x010C, 11, 17, 0, 17, 12, 12972},
+        {0x010D, 9, 15, 0, 15, 9, 13074},
+        {0x010E, 12, 17, 1, 17, 13, 13149},
+        {0x010F, 13, 14, 0, 14, 11, 13251},
+        {0x0110, 13, 13, 0, 13, 13, 13349},
+        {0x0111, 11, 14, 0, 14, 11, 13440},
+        {0x0112, 9, 17, 1, 17, 11, 13524},
+        {0x0113, 10, 14, 0, 14, 10, 13609},
+        {0x0114, 9, 17, 1, 17, 11, 13679},
+        {0x0115, 10, 15, 0, 15, 10, 13764},
+        {0x0116, 9, 16, 1, 16, 11, 13839},
+        {0x0117, 10, 14, 0, 14, 10, 13919},
+        {0x0118, 9, 17, 1, 13, 11, 13989},
+        {0x0119, 10, 14, 0, 10, 10, 14074},
+        {0x011A, 9, 17, 1, 17, 11, 14144},
+        {0x011B, 10, 15, 0, 15, 10, 14229},
+        {0x011C, 12, 17, 0, 17, 13, 14304},
+        {0x011D, 10, 18, 0, 14, 11, 14406},
+        {0x011E, 12, 17, 0, 17, 13, 14496},
+        {0x011F, 10, 18, 0, 14, 11, 14598},
+        {0x0120, 12, 17, 0, 17, 13, 14688},
+        {0x0121, 10, 18, 0, 14, 11, 14790},
+        {0x0122, 12, 17, 0, 13, 13, 14880},
+        {0x0123, 10, 18, 0, 14, 11, 14982},
+        {0x0124, 11, 17, 1, 17, 13, 15072},
+        {0x0125, 11, 17, -1, 17, 11, 15174},
+        {0x0126, 13, 13, 1, 13, 16, 15276},
+        {0x0127, 9, 14, 1, 14, 12, 15367},
+        {0x0128, 7, 17, -1, 17, 5, 15437},
+        {0x0129, 7, 14, -1, 14, 5, 15505},
+        {0x012A, 5, 17, 0, 17, 5, 15561},
+        {0x012B, 6, 14, -1, 14, 5, 15612},
+        {0x012C, 7, 17, -1, 17, 5, 15654},
+        {0x012D, 6, 14, -1, 14, 5, 15722},
+        {0x012E, 4, 17, 1, 13, 5, 15764},
+        {0x012F, 4, 18, 1, 14, 5, 15798},
+        {0x0130, 3, 16, 1, 16, 5, 15834},
+        {0x0131, 3, 10, 1, 10, 5, 15866},
+        {0x0132, 8, 17, 1, 13, 10, 15886},
+        {0x0133, 7, 18, 1, 14, 9, 15954},
+        {0x0134, 7, 20, -1, 16, 5, 16026},
+        {0x0135, 7, 18, -1, 14, 5, 16106},
+        {0x0136, 11, 17, 1, 13, 11, 16178},
+        {0x0137, 9, 18, 1, 14, 10, 16280},
+        {0x0138, 9, 10, 1, 10, 10, 16370},
+        {0x0139, 9, 17, 1, 17, 9, 16420},
+        {0x013A, 4, 17, 1, 17, 5, 16505},
+        {0x013B, 9, 17, 1, 13, 9, 16539},
+        {0x013C, 3, 18, 1, 14, 5, 16624},
+        {0x013D, 9, 13, 1, 13, 9, 16660},
+        {0x013E, 6, 14, 1, 14, 6, 16725},
+        {0x013F, 9, 13, 1, 13, 9, 16767},
+        {0x0140, 5, 14, 1, 14, 6, 16832},
+        {0x0141, 11, 13, -1, 13, 10, 16874},
+        {0x0142, 5, 14, 0, 14, 5, 16952},
+        {0x0143, 11, 17, 1, 17, 13, 16994},
+        {0x0144, 9, 15, 1, 15, 11, 17096},
+        {0x0145, 11, 17, 1, 13, 13, 17171},
+        {0x0146, 9, 14, 1, 10, 11, 17273},
+        {0x0147, 11, 17, 1, 17, 13, 17343},
+        {0x0148, 9, 15, 1, 15, 11, 17445},
+        {0x0149, 12, 13, 1, 13, 14, 17520},
+        {0x014A, 10, 17, 1, 13, 13, 17598},
+        {0x014B, 9, 14, 1, 10, 11, 17683},
+        {0x014C, 13, 17, 0, 17, 13, 17753},
+        {0x014D, 10, 14, 0, 14, 10, 17872},
+        {0x014E, 13, 17, 0, 17, 13, 17942},
+        {0x014F, 10, 15, 0, 15, 10, 18061},
+        {0x0150, 13, 17, 0, 17, 13, 18136},
+        {0x0151, 10, 15, 0, 15, 10, 18255},
+        {0x0152, 18, 13, 0, 13, 18, 18330},
+        {0x0153, 17, 10, 0, 10, 17, 18447},
+        {0x0154, 11, 17, 1, 17, 12, 18537},
+        {0x0155, 7, 15, 1, 15, 7, 18639},
+        {0x0156, 11, 17, 1, 13, 12, 18699},
+        {0x0157, 6, 15, 1, 11, 7, 18801},
+        {0x0158, 11, 17, 1, 17, 12, 18846},
+        {0x0159, 7, 15, 1, 15, 7, 18948},
+        {0x015A, 9, 17, 1, 17, 11, 19008},
+        {0x015B, 9, 15, 0, 15, 9, 19093},
+        {0x015C, 9, 17, 1, 17, 11, 19168},
+        {0x015D, 9, 15, 0, 15, 9, 19253},
+        {0x015E, 9, 17, 1, 13, 11, 19328},
+        {0x015F, 9, 14, 0, 10, 9, 19413},
+        {0x0160, 9, 17, 1, 17, 11, 19483},
+        {0x0161, 9, 15, 0, 15, 9, 19568},
+        {0x0162, 12, 17, -1, 13, 10, 19643},
+        {0x0163, 7, 16, 0, 12, 7, 19745},
+        {0x0164, 12, 17, -1, 17, 10, 19809},
+        {0x0165, 7, 15, 0, 15, 7, 19911},
+        {0x0166, 12, 13, -1, 13, 10, 19971},
+        {0x0167, 7, 13, 0, 13, 7, 20049},
+        {0x0168, 10, 17, 1, 17, 12, 20101},
+        {0x0169, 9, 14, 1, 14, 11, 20186},
+        {0x016A, 10, 17, 1, 17, 12, 20256},
+        {0x016B, 9, 14, 1, 14, 11, 20341},
+        {0x016C, 10, 17, 1, 17, 12, 20411},
+        {0x016D, 9, 15, 1, 15, 11, 20496},
+        {0x016E, 10, 17, 1, 17, 12, 20571},
+        {0x016F, 9, 15, 1, 15, 11, 20656},
+        {0x0170, 10, 17, 1, 17, 12, 20731},
+        {0x0171, 9, 15, 1, 15, 11, 20816},
+        {0x0172, 10, 17, 1, 13, 12, 20891},
+        {0x0173, 10, 14, 1, 10, 11, 20976},
+        {0x0174, 17, 17, 0, 17, 17, 21046},
+        {0x0175, 14, 15, 0, 15, 14, 21199},
+        {0x0176, 12, 17, -1, 17, 10, 21304},
+        {0x0177, 10, 18, 0, 14, 10, 21406},
+        {0x0178, 12, 16, -1, 16, 10, 21496},
+        {0x0179, 11, 17, 0, 17, 12, 21592},
+        {0x017A, 9, 15, 0, 15, 9, 21694},
+        {0x017B, 11, 16, 0, 16, 12, 21769},
+        {0x017C, 9, 14, 0, 14, 9, 21865},
+        {0x017D, 11, 17, 0, 17, 12, 21935},
+        {0x017E, 9, 15, 0, 15, 9, 22037},
+        {0x017F, 7, 14, 0, 14, 6, 22112},
+        {0x2013, 8, 3, 0, 6, 9, 22168},
+        {0x2014, 17, 3, 0, 6, 17, 22180},
+        {0x2018, 3, 5, 1, 13, 5, 22207},
+        {0x2019, 3, 5, 1, 13, 5, 22217},
+        {0x201C, 7, 5, 1, 13, 9, 22227},
+        {0x201D, 7, 5, 1, 13, 9, 22247},
+        {0x2026, 15, 3, 1, 3, 17, 22267},
+};
+
+const Font font_sans_17 = {
+        .ascent = 16,
+        .height = 21,
+        .glyph_count = 326,
+        .glyphs = glyphs,
+        .bitmaps = bitmaps
+};
@@ -0,0 +1,2379 @@
+// Generated by Host/FontGen from DejaVuSans.ttf at 22 px, do not edit
+// DejaVu fonts are free, see https://dejavu-fonts.github.io/License.html
+#include "font.h"
+
+static const uint8_t bitmaps[] = {
+        0xAF, 0x80, 0xAF, 0x80, 0xAF, 0x80, 0xAF, 0x80, 0xAF, 0x80, 0xAF, 0x80, 0xAF, 0x70, 0xAF, 0x70,
+        0x9F, 0x60, 0x8F, 0x50, 0x49, 0x30, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x50, 0xAF, 0x80, 0xAF, 0x80,
+        0xDE, 0x00, 0xCF, 0xDE, 0x00, 0xCF, 0xDE, 0x00, 0xCF, 0xDE, 0x00, 0xCF, 0xDE, 0x00, 0xCF, 0xBB,
+        0x00, 0xAC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x05, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x08,
+        0xF2, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x10, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x0F,
+        0xB0, 0x00, 0x00, 0x00, 0x01, 0xF9, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFB, 0x01, 0x99, 0x9D, 0xFA, 0x99, 0xEF, 0x99, 0x97, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0xEB,
+        0x00, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x04, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x08, 0xF3,
+        0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x39, 0x99, 0xFD, 0x99, 0xAF, 0xD9,
+        0x99, 0x50, 0x00, 0x02, 0xF9, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x06, 0xF5, 0x00, 0x8F, 0x30,
+        0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x01, 0xFA, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x70, 0x00, 0x00, 0x00, 0x6D,
+        0xFF, 0xFF, 0xEB, 0x20, 0x07, 0xFE, 0x7B, 0x97, 0x9E, 0x30, 0x0E, 0xF2, 0x0A, 0x70, 0x01, 0x10,
+        0x2F, 0xD0, 0x0A, 0x70, 0x00, 0x00, 0x1F, 0xF2, 0x0A, 0x70, 0x00, 0x00, 0x0A, 0xFE, 0x8B, 0x70,
+        0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFD, 0x82, 0x00, 0x00, 0x02, 0x6D, 0xEF, 0xFE, 0x40, 0x00, 0x00,
+        0x0A, 0x72, 0xAF, 0xD0, 0x00, 0x00, 0x0A, 0x70, 0x0E, 0xF2, 0x00, 0x00, 0x0A, 0x70, 0x0D, 0xF2,
+        0x27, 0x10, 0x0A, 0x70, 0x6F, 0xD0, 0x3F, 0xEB, 0x8C, 0xBC, 0xFF, 0x50, 0x04, 0x9C, 0xEF, 0xFE,
+        0xA4, 0x00, 0x00, 0x00, 0x0A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x70, 0x00, 0x00, 0x00, 0x00,
+        0x0A, 0x70, 0x00, 0x00, 0x03, 0xBE, 0xEA, 0x20, 0x00, 0x00, 0x0B, 0xE1, 0x00, 0x00, 0x1E, 0xE6,
+        0x7F, 0xD0, 0x00, 0x00, 0x5F, 0x60, 0x00, 0x00, 0x8F, 0x40, 0x07, 0xF6, 0x00, 0x01, 0xEB, 0x00,
+        0x00, 0x00, 0xAF, 0x00, 0x03, 0xF9, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xF9,
+        0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x05, 0xF6, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x00,
+        0x3F, 0xB2, 0x3D, 0xE1, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEF, 0xFE, 0x40, 0x2E, 0x90,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x30, 0x00, 0xBE, 0x10, 0x3C, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+        0x00, 0x05, 0xF6, 0x01, 0xED, 0x66, 0xEE, 0x10, 0x00, 0x00, 0x00, 0x1E, 0xB0, 0x07, 0xF4, 0x00,
+        0x5F, 0x70, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x0A, 0xF1, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x03, 0xF7,
+        0x00, 0x0A, 0xF1, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x07, 0xF5, 0x00, 0x5F, 0x60,
+        0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xEE, 0x77, 0xED, 0x10, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00,
+        0x2B, 0xEE, 0xB2, 0x00, 0x00, 0x01, 0x9D, 0xFE, 0xB7, 0x10, 0x00, 0x00, 0x00, 0x1D, 0xFE, 0xBC,
+        0xEF, 0x20, 0x00, 0x00, 0x00, 0x8F, 0xB1, 0x00, 0x05, 0x10, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xE3, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDE, 0xAF, 0xE3,
+        0x00, 0x00, 0x26, 0x40, 0x0C, 0xF5, 0x08, 0xFE, 0x30, 0x00, 0x6F, 0x90, 0x4F, 0xB0, 0x00, 0x8F,
+        0xE3, 0x00, 0x9F, 0x40, 0x8F, 0x70, 0x00, 0x08, 0xFE, 0x31, 0xED, 0x00, 0x8F, 0x80, 0x00, 0x00,
+        0x8F, 0xEA, 0xF5, 0x00, 0x5F, 0xD1, 0x00, 0x00, 0x08, 0xFF, 0xB0, 0x00, 0x0D, 0xFC, 0x20, 0x00,
+        0x19, 0xFF, 0xE3, 0x00, 0x02, 0xDF, 0xFD, 0xBC, 0xFF, 0xA8, 0xFE, 0x20, 0x00, 0x17, 0xCE, 0xFD,
+        0xA4, 0x00, 0xAF, 0xD2, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xBB, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE1,
+        0x00, 0x5F, 0x80, 0x00, 0xBF, 0x20, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x0E,
+        0xF2, 0x00, 0x0F, 0xF1, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF1, 0x00, 0x0E, 0xF2, 0x00, 0x0B, 0xF4,
+        0x00, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x20, 0x00, 0x5F, 0x80, 0x00, 0x0B, 0xE1,
+        0x00, 0x03, 0xF8, 0x1E, 0xC0, 0x00, 0x07, 0xF5, 0x00, 0x00, 0xED, 0x00, 0x00, 0x9F, 0x50, 0x00,
+        0x3F, 0xB0, 0x00, 0x0E, 0xF1, 0x00, 0x0B, 0xF5, 0x00, 0x08, 0xF8, 0x00, 0x07, 0xF9, 0x00, 0x06,
+        0xFA, 0x00, 0x07, 0xF9, 0x00, 0x08, 0xF8, 0x00, 0x0B, 0xF5, 0x00, 0x0E, 0xF1, 0x00, 0x3F, 0xB0,
+        0x00, 0x9F, 0x50, 0x01, 0xED, 0x00, 0x07, 0xF5, 0x00, 0x1E, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x20,
+        0x00, 0x00, 0x01, 0x00, 0x2F, 0x20, 0x01, 0x00, 0x2E, 0x70, 0x2F, 0x20, 0x7E, 0x20, 0x05, 0xCD,
+        0x6F, 0x6D, 0xC5, 0x00, 0x00, 0x05, 0xDF, 0xD5, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xE9, 0x10, 0x00,
+        0x18, 0xEA, 0x3F, 0x3A, 0xE8, 0x10, 0x1B, 0x40, 0x2F, 0x20, 0x4B, 0x10, 0x00, 0x00, 0x2F, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x1C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0x8C, 0xCC, 0xCC, 0xEF, 0xCC, 0xCC, 0xCC, 0x10,
+        0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0x01, 0x22, 0x06, 0xFD, 0x07, 0xFC, 0x0A, 0xF6,
+        0x0E, 0xD0, 0x3F, 0x50, 0xAB, 0xBB, 0xB9, 0xEF, 0xFF, 0xFD, 0x6A, 0x60, 0xAF, 0x90, 0xAF, 0x90,
+        0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x0D, 0xE0, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x8F, 0x40,
+        0x00, 0x00, 0xDE, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x0C, 0xF1, 0x00,
+        0x00, 0x2F, 0xA0, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, 0xCF, 0x10, 0x00, 0x01, 0xFB, 0x00, 0x00,
+        0x06, 0xF6, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x00,
+        0xAF, 0x20, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x06, 0xCE, 0xEC, 0x60, 0x00, 0x00, 0x9F,
+        0xFB, 0xBF, 0xF9, 0x00, 0x06, 0xFE, 0x20, 0x02, 0xEF, 0x50, 0x0D, 0xF6, 0x00, 0x00, 0x6F, 0xC0,
+        0x2F, 0xF1, 0x00, 0x00, 0x1F, 0xF2, 0x5F, 0xC0, 0x00, 0x00, 0x0C, 0xF5, 0x7F, 0xA0, 0x00, 0x00,
+        0x0B, 0xF7, 0x8F, 0xA0, 0x00, 0x00, 0x0A, 0xF8, 0x8F, 0xA0, 0x00, 0x00, 0x0A, 0xF8, 0x7F, 0xA0,
+        0x00, 0x00, 0x0B, 0xF7, 0x5F, 0xC0, 0x00, 0x00, 0x0C, 0xF5, 0x2F, 0xF1, 0x00, 0x00, 0x1F, 0xF2,
+        0x0D, 0xF6, 0x00, 0x00, 0x6F, 0xC0, 0x06, 0xFE, 0x20, 0x02, 0xEF, 0x50, 0x00, 0xAF, 0xFB, 0xBF,
+        0xF9, 0x00, 0x00, 0x06, 0xCE, 0xEC, 0x60, 0x00, 0x27, 0xAD, 0xFF, 0x60, 0x00, 0x9F, 0xFF, 0xFF,
+        0x60, 0x00, 0x68, 0x52, 0xBF, 0x60, 0x00, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0xBF, 0x60,
+        0x00, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0xBF, 0x60, 0x00,
+        0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00,
+        0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x3C, 0xCC,
+        0xEF, 0xDC, 0xCB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x8C, 0xEF, 0xDA, 0x40, 0x00, 0x4F, 0xFF,
+        0xDC, 0xEF, 0xF7, 0x00, 0x4C, 0x61, 0x00, 0x18, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90,
+        0x00, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x90, 0x00, 0x00, 0x00, 0x02,
+        0xFF, 0x30, 0x00, 0x00, 0x00, 0x0C, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC1, 0x00, 0x00, 0x00,
+        0x0A, 0xFC, 0x10, 0x00, 0x00, 0x00, 0xAF, 0xD1, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00,
+        0x00, 0xAF, 0xD1, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x5F, 0xFD, 0xCC, 0xCC,
+        0xCC, 0x90, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x05, 0x9C, 0xEF, 0xEC, 0x60, 0x00, 0x0D, 0xFE,
+        0xDC, 0xEF, 0xFC, 0x10, 0x05, 0x30, 0x00, 0x04, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0,
+        0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xDF, 0x70, 0x00, 0x06, 0xBC, 0xDF,
+        0xFA, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFD, 0x30, 0x00, 0x00,
+        0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF3,
+        0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0x48, 0x20, 0x00, 0x05, 0xEF, 0xA0, 0x5F, 0xFD, 0xCD, 0xEF,
+        0xFC, 0x10, 0x17, 0xBD, 0xEF, 0xDB, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF7, 0x00, 0x00, 0x00,
+        0x04, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x1D, 0xDB, 0xF7, 0x00, 0x00, 0x00, 0x9F, 0x4A, 0xF7, 0x00,
+        0x00, 0x04, 0xF9, 0x0A, 0xF7, 0x00, 0x00, 0x1D, 0xD1, 0x0A, 0xF7, 0x00, 0x00, 0x9F, 0x40, 0x0A,
+        0xF7, 0x00, 0x04, 0xFA, 0x00, 0x0A, 0xF7, 0x00, 0x1D, 0xE1, 0x00, 0x0A, 0xF7, 0x00, 0x9F, 0x50,
+        0x00, 0x0A, 0xF7, 0x00, 0xEF, 0xBB, 0xBB, 0xBE, 0xFD, 0xB9, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+        0x00, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x0A,
+        0xF7, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x09, 0xFD,
+        0xCC, 0xCC, 0xCA, 0x00, 0x09, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF5, 0x00, 0x00, 0x00, 0x00,
+        0x09, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFB, 0xBB, 0xA7, 0x10, 0x00, 0x09, 0xFF, 0xFF, 0xFF,
+        0xE4, 0x00, 0x06, 0x62, 0x11, 0x4C, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xA0, 0x00, 0x00,
+        0x00, 0x00, 0x4F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
+        0x00, 0x00, 0x00, 0x00, 0x9F, 0xC0, 0x36, 0x10, 0x00, 0x18, 0xFF, 0x50, 0x4F, 0xFE, 0xCD, 0xFF,
+        0xF8, 0x00, 0x28, 0xBD, 0xFF, 0xDA, 0x30, 0x00, 0x00, 0x00, 0x7C, 0xEF, 0xDA, 0x40, 0x00, 0x2D,
+        0xFF, 0xDC, 0xEF, 0x80, 0x00, 0xDF, 0xA2, 0x00, 0x02, 0x30, 0x07, 0xFB, 0x00, 0x00, 0x00, 0x00,
+        0x0E, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x49, 0xA9, 0x50, 0x00, 0x6F, 0xC9, 0xFF, 0xFF,
+        0xFC, 0x10, 0x7F, 0xFF, 0x92, 0x14, 0xDF, 0xB0, 0x7F, 0xFA, 0x00, 0x00, 0x2F, 0xF4, 0x6F, 0xF4,
+        0x00, 0x00, 0x0B, 0xF7, 0x4F, 0xF2, 0x00, 0x00, 0x09, 0xF9, 0x1F, 0xF3, 0x00, 0x00, 0x0A, 0xF8,
+        0x0B, 0xF7, 0x00, 0x00, 0x1E, 0xF5, 0x04, 0xFE, 0x40, 0x01, 0xAF, 0xD0, 0x00, 0x7F, 0xFC, 0xBE,
+        0xFE, 0x30, 0x00, 0x04, 0xBE, 0xFD, 0x92, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x2C, 0xCC,
+        0xCC, 0xCC, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x20,
+        0x00, 0x00, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x5F,
+        0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x30, 0x00, 0x00, 0x00,
+        0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0x00, 0x00,
+        0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDF, 0xFD, 0x92, 0x00, 0x03, 0xEF,
+        0xEB, 0xBE, 0xFF, 0x40, 0x0C, 0xFA, 0x10, 0x01, 0xAF, 0xD0, 0x1F, 0xF2, 0x00, 0x00, 0x2F, 0xF1,
+        0x1F, 0xF2, 0x00, 0x00, 0x2F, 0xF0, 0x0C, 0xFA, 0x10, 0x01, 0xAF, 0x90, 0x02, 0xDF, 0xEB, 0xBE,
+        0xE8, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xC5, 0x00, 0x04, 0xED, 0x51, 0x15, 0xDF, 0x80, 0x1E, 0xF2,
+        0x00, 0x00, 0x2F, 0xF2, 0x5F, 0xC0, 0x00, 0x00, 0x0C, 0xF6, 0x7F, 0xB0, 0x00, 0x00, 0x0B, 0xF7,
+        0x6F, 0xE1, 0x00, 0x00, 0x1E, 0xF5, 0x1E, 0xFA, 0x10, 0x01, 0xAF, 0xE1, 0x06, 0xFF, 0xEB, 0xBE,
+        0xFF, 0x50, 0x00, 0x3A, 0xDF, 0xFD, 0x92, 0x00, 0x00, 0x29, 0xDF, 0xEB, 0x40, 0x00, 0x03, 0xEF,
+        0xEB, 0xCF, 0xF7, 0x00, 0x0D, 0xFA, 0x10, 0x04, 0xEF, 0x40, 0x5F, 0xE1, 0x00, 0x00, 0x7F, 0xB0,
+        0x8F, 0xA0, 0x00, 0x00, 0x3F, 0xF1, 0x9F, 0x90, 0x00, 0x00, 0x2F, 0xF4, 0x8F, 0xB0, 0x00, 0x00,
+        0x4F, 0xF6, 0x4F, 0xF2, 0x00, 0x00, 0xAF, 0xF6, 0x0B, 0xFD, 0x41, 0x29, 0xFF, 0xF6, 0x01, 0xCF,
+        0xFF, 0xFF, 0x9C, 0xF5, 0x00, 0x04, 0x89, 0x83, 0x0E, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xD0,
+        0x00, 0x00, 0x00, 0x00, 0xBF, 0x70, 0x03, 0x20, 0x00, 0x1A, 0xFD, 0x00, 0x09, 0xFE, 0xCD, 0xFF,
+        0xD2, 0x00, 0x04, 0xAD, 0xFE, 0xC7, 0x00, 0x00, 0x6F, 0xD0, 0x6F, 0xD0, 0x4A, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x80, 0x6F, 0xD0, 0x6F, 0xD0, 0x04, 0xA8,
+        0x06, 0xFD, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22,
+        0x06, 0xFD, 0x07, 0xFC, 0x0A, 0xF6, 0x0E, 0xD0, 0x3F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xDF, 0x20, 0x00, 0x00, 0x00, 0x02, 0x7C, 0xFF,
+        0xEA, 0x10, 0x00, 0x00, 0x16, 0xBF, 0xFF, 0xB5, 0x10, 0x00, 0x01, 0x5A, 0xFF, 0xFB, 0x61, 0x00,
+        0x00, 0x00, 0x7E, 0xFF, 0xC7, 0x10, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x39, 0xEF, 0xFD, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9E, 0xFF, 0xC7, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xFC, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xBF,
+        0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7C, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+        0xBB, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x8C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x10, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x20, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xA5, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x6D, 0xFF, 0xE9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xDF, 0xFD, 0x83, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x04, 0x9E, 0xFF, 0xD7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xEF,
+        0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x15, 0xBF, 0xFF,
+        0xB6, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xFC, 0x61, 0x00, 0x00, 0x04, 0xAE, 0xFF, 0xD7, 0x20, 0x00,
+        0x00, 0x00, 0xAF, 0xFD, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x40, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xAD, 0xFE, 0xB4, 0x00, 0x6F,
+        0xFD, 0xBE, 0xFF, 0x50, 0x69, 0x20, 0x00, 0x9F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00,
+        0x00, 0x3F, 0xF1, 0x00, 0x00, 0x01, 0xCF, 0x90, 0x00, 0x00, 0x1C, 0xFB, 0x00, 0x00, 0x00, 0xCF,
+        0xB0, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x0A, 0xF6, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x00,
+        0x00, 0x00, 0x09, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xA4, 0x00, 0x00,
+        0x00, 0x0C, 0xF6, 0x00, 0x00, 0x00, 0x0C, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0x76,
+        0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xCF, 0xFF, 0xFF, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x01,
+        0xBF, 0xD7, 0x31, 0x02, 0x49, 0xFE, 0x50, 0x00, 0x00, 0x1D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x2B,
+        0xF5, 0x00, 0x00, 0xCE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x30, 0x06, 0xF6, 0x00, 0x01,
+        0x68, 0x62, 0x08, 0x50, 0x1E, 0xB0, 0x0D, 0xC0, 0x00, 0x3D, 0xFF, 0xFF, 0x7E, 0x90, 0x07, 0xF2,
+        0x3F, 0x60, 0x00, 0xDF, 0x71, 0x16, 0xFF, 0x90, 0x03, 0xF5, 0x6F, 0x20, 0x05, 0xF8, 0x00, 0x00,
+        0x7F, 0x90, 0x02, 0xF7, 0x8F, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x90, 0x03, 0xF6, 0x7F, 0x00,
+        0x07, 0xF4, 0x00, 0x00, 0x3F, 0x90, 0x06, 0xF3, 0x6F, 0x20, 0x05, 0xF8, 0x00, 0x00, 0x7F, 0x90,
+        0x1D, 0xC0, 0x3F, 0x60, 0x00, 0xDF, 0x71, 0x16, 0xEF, 0x94, 0xDE, 0x30, 0x0D, 0xC0, 0x00, 0x3D,
+        0xFF, 0xFF, 0x7E, 0xFF, 0xB2, 0x00, 0x05, 0xF7, 0x00, 0x01, 0x57, 0x62, 0x07, 0x62, 0x00, 0x00,
+        0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF8, 0x10, 0x00, 0x00,
+        0x00, 0x7A, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xE9, 0x53, 0x34, 0x8E, 0xFB, 0x10, 0x00, 0x00, 0x00,
+        0x03, 0xAE, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x43, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x6F, 0xB0, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x5F, 0xD0,
+        0x00, 0x00, 0x00, 0x03, 0xFE, 0x10, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x09, 0xF9,
+        0x00, 0x00, 0x00, 0x0E, 0xF3, 0x00, 0x03, 0xFE, 0x10, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0xCF,
+        0x60, 0x00, 0x00, 0xBF, 0xEC, 0xCC, 0xCC, 0xEF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xF2, 0x00, 0x07, 0xFB, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x05,
+        0xFE, 0x00, 0x4F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+        0x9F, 0xA0, 0xDF, 0xFF, 0xFF, 0xEC, 0x71, 0x00, 0xDF, 0xCB, 0xBB, 0xDF, 0xFD, 0x10, 0xDF, 0x50,
+        0x00, 0x03, 0xEF, 0x80, 0xDF, 0x50, 0x00, 0x00, 0x7F, 0xC0, 0xDF, 0x50, 0x00, 0x00, 0x5F, 0xC0,
+        0xDF, 0x50, 0x00, 0x00, 0x8F, 0xA0, 0xDF, 0x50, 0x00, 0x27, 0xFF, 0x30, 0xDF, 0xFF, 0xFF, 0xFF,
+        0xB3, 0x00, 0xDF, 0xCB, 0xBB, 0xCE, 0xFB, 0x10, 0xDF, 0x50, 0x00, 0x01, 0x9F, 0xC0, 0xDF, 0x50,
+        0x00, 0x00, 0x0E, 0xF5, 0xDF, 0x50, 0x00, 0x00, 0x0C, 0xF7, 0xDF, 0x50, 0x00, 0x00, 0x0E, 0xF7,
+        0xDF, 0x50, 0x00, 0x01, 0x9F, 0xF2, 0xDF, 0xCB, 0xBB, 0xCE, 0xFF, 0x70, 0xDF, 0xFF, 0xFF, 0xFD,
+        0xA3, 0x00, 0x00, 0x00, 0x4A, 0xDE, 0xFD, 0xA5, 0x00, 0x00, 0x1B, 0xFF, 0xEC, 0xCD, 0xFF, 0xD1,
+        0x01, 0xDF, 0xD4, 0x00, 0x00, 0x28, 0xF3, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x32, 0x2F, 0xF4,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+        0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x32, 0x01, 0xDF, 0xD4,
+        0x00, 0x00, 0x28, 0xF3, 0x00, 0x2C, 0xFF, 0xEC, 0xBD, 0xFF, 0xD1, 0x00, 0x00, 0x5A, 0xDE, 0xFD,
+        0xA5, 0x00, 0xDF, 0xFF, 0xFE, 0xDB, 0x83, 0x00, 0x00, 0xDF, 0xCB, 0xBC, 0xDF, 0xFF, 0xB1, 0x00,
+        0xDF, 0x50, 0x00, 0x01, 0x6E, 0xFD, 0x10, 0xDF, 0x50, 0x00, 0x00, 0x02, 0xEF, 0xA0, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0x5F, 0xF2, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x0E, 0xF5, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x0B, 0xF8, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x0A,
+        0xF9, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x0E, 0xF5, 0xDF,
+        0x50, 0x00, 0x00, 0x00, 0x5F, 0xF2, 0xDF, 0x50, 0x00, 0x00, 0x02, 0xDF, 0xA0, 0xDF, 0x50, 0x00,
+        0x01, 0x6E, 0xFD, 0x10, 0xDF, 0xCB, 0xBC, 0xDF, 0xFF, 0xB1, 0x00, 0xDF, 0xFF, 0xFE, 0xDB, 0x83,
+        0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x30, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCB, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x60, 0xDF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x80, 0xDF, 0xFF, 0xFF, 0xFF, 0xF6, 0xDF, 0xDC, 0xCC, 0xCC, 0xC4, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xA0, 0xDF, 0xDC, 0xCC, 0xCC, 0x80, 0xDF,
+        0x50, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x49, 0xDE, 0xFE, 0xB8, 0x30, 0x00, 0x00, 0x1B, 0xFF, 0xEC, 0xBC, 0xFF,
+        0xF9, 0x00, 0x01, 0xDF, 0xD5, 0x00, 0x00, 0x15, 0xBC, 0x00, 0x0A, 0xFC, 0x10, 0x00, 0x00, 0x00,
+        0x04, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x5B, 0xBB,
+        0xBB, 0x30, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+        0xEF, 0x40, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00,
+        0xEF, 0x40, 0x0A, 0xFC, 0x10, 0x00, 0x00, 0x00, 0xEF, 0x40, 0x01, 0xDF, 0xD4, 0x00, 0x00, 0x05,
+        0xEF, 0x40, 0x00, 0x1B, 0xFF, 0xEC, 0xBC, 0xEF, 0xFA, 0x10, 0x00, 0x00, 0x49, 0xDE, 0xFE, 0xC8,
+        0x30, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0xCF, 0x60, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0xEF,
+        0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF,
+        0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00,
+        0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00,
+        0xCF, 0x60, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50,
+        0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50,
+        0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0xDF, 0x40, 0x00, 0x01, 0xFF, 0x20, 0x00, 0x09, 0xFD, 0x00, 0x2C, 0xEF, 0xF5, 0x00, 0x2F, 0xEB,
+        0x40, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x2D, 0xFB, 0x10, 0xDF, 0x50, 0x00, 0x03, 0xDF, 0xA0, 0x00,
+        0xDF, 0x50, 0x00, 0x3E, 0xF9, 0x00, 0x00, 0xDF, 0x50, 0x04, 0xEF, 0x90, 0x00, 0x00, 0xDF, 0x50,
+        0x4F, 0xF8, 0x00, 0x00, 0x00, 0xDF, 0x55, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xDF, 0xAF, 0xF6, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xBF, 0xF6, 0x00, 0x00, 0x00,
+        0x00, 0xDF, 0x57, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x7F, 0xF6, 0x00, 0x00, 0x00, 0xDF,
+        0x50, 0x07, 0xFF, 0x60, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x7F, 0xF6, 0x00, 0x00, 0xDF, 0x50, 0x00,
+        0x07, 0xFF, 0x60, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x7F, 0xF6, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x07,
+        0xFF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x20, 0xDF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x20, 0xDF, 0xF9, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xC0, 0xDF, 0xFE, 0x00, 0x00, 0x00, 0x0E,
+        0xFF, 0xC0, 0xDF, 0xCF, 0x50, 0x00, 0x00, 0x5F, 0xCF, 0xC0, 0xDF, 0x6F, 0xB0, 0x00, 0x00, 0xBF,
+        0x6F, 0xC0, 0xDF, 0x4C, 0xF1, 0x00, 0x02, 0xFB, 0x4F, 0xC0, 0xDF, 0x46, 0xF7, 0x00, 0x07, 0xF6,
+        0x4F, 0xC0, 0xDF, 0x41, 0xEC, 0x00, 0x0D, 0xE1, 0x4F, 0xC0, 0xDF, 0x40, 0xAF, 0x30, 0x4F, 0x90,
+        0x4F, 0xC0, 0xDF, 0x40, 0x4F, 0x90, 0x9F, 0x40, 0x4F, 0xC0, 0xDF, 0x40, 0x0D, 0xE1, 0xED, 0x00,
+        0x4F, 0xC0, 0xDF, 0x40, 0x08, 0xFB, 0xF7, 0x00, 0x4F, 0xC0, 0xDF, 0x40, 0x02, 0xFF, 0xF2, 0x00,
+        0x4F, 0xC0, 0xDF, 0x40, 0x00, 0xBE, 0xA0, 0x00, 0x4F, 0xC0, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00,
+        0x4F, 0xC0, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xC0, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00,
+        0x4F, 0xC0, 0xDF, 0xF5, 0x00, 0x00, 0x00, 0xCF, 0x40, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0xCF, 0x40,
+        0xDF, 0xEF, 0x60, 0x00, 0x00, 0xCF, 0x40, 0xDF, 0x8F, 0xD1, 0x00, 0x00, 0xCF, 0x40, 0xDF, 0x4B,
+        0xF7, 0x00, 0x00, 0xCF, 0x40, 0xDF, 0x43, 0xFE, 0x10, 0x00, 0xCF, 0x40, 0xDF, 0x40, 0xAF, 0x80,
+        0x00, 0xCF, 0x40, 0xDF, 0x40, 0x2F, 0xE1, 0x00, 0xCF, 0x40, 0xDF, 0x40, 0x09, 0xF9, 0x00, 0xCF,
+        0x40, 0xDF, 0x40, 0x02, 0xFF, 0x20, 0xCF, 0x40, 0xDF, 0x40, 0x00, 0x8F, 0xA0, 0xCF, 0x40, 0xDF,
+        0x40, 0x00, 0x1E, 0xF3, 0xCF, 0x40, 0xDF, 0x40, 0x00, 0x07, 0xFB, 0xCF, 0x40, 0xDF, 0x40, 0x00,
+        0x01, 0xEF, 0xEF, 0x40, 0xDF, 0x40, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0xDF, 0x40, 0x00, 0x00, 0x0D,
+        0xFF, 0x40, 0x00, 0x00, 0x6B, 0xEF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xDB, 0xCF, 0xFE,
+        0x50, 0x00, 0x01, 0xDF, 0xC3, 0x00, 0x01, 0x9F, 0xF4, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x08,
+        0xFE, 0x10, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x70, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
+        0x8F, 0xB0, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0x4F, 0xF1, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+        0x5F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x70, 0x0A, 0xFC, 0x10, 0x00, 0x00, 0x08, 0xFE, 0x10, 0x01, 0xEF, 0xC3, 0x00, 0x01, 0x9F,
+        0xF5, 0x00, 0x00, 0x2C, 0xFF, 0xDB, 0xCF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x6B, 0xEF, 0xEC, 0x81,
+        0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xDA, 0x30, 0x00, 0xDF, 0xCB, 0xBC, 0xEF, 0xF5, 0x00, 0xDF, 0x50,
+        0x00, 0x1B, 0xFE, 0x10, 0xDF, 0x50, 0x00, 0x01, 0xFF, 0x50, 0xDF, 0x50, 0x00, 0x00, 0xCF, 0x70,
+        0xDF, 0x50, 0x00, 0x00, 0xDF, 0x70, 0xDF, 0x50, 0x00, 0x03, 0xFF, 0x40, 0xDF, 0x50, 0x01, 0x4D,
+        0xFD, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0xDF, 0xCB, 0xBB, 0x96, 0x10, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x6B, 0xEF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xDB, 0xCF, 0xFE,
+        0x50, 0x00, 0x01, 0xDF, 0xC3, 0x00, 0x01, 0x9F, 0xF4, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x08,
+        0xFE, 0x10, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x70, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
+        0x8F, 0xB0, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0x4F, 0xF1, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+        0x5F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x70, 0x0A, 0xFC, 0x10, 0x00, 0x00, 0x08, 0xFE, 0x10, 0x01, 0xEF, 0xC3, 0x00, 0x01, 0x8F,
+        0xF5, 0x00, 0x00, 0x2C, 0xFF, 0xCB, 0xCF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x6B, 0xEF, 0xFF, 0xE2,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF,
+        0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x82, 0x00, 0xDF, 0xFF, 0xFF, 0xDA, 0x40, 0x00,
+        0x00, 0xDF, 0xCB, 0xBC, 0xEF, 0xF7, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x1A, 0xFF, 0x20, 0x00, 0xDF,
+        0x50, 0x00, 0x01, 0xFF, 0x60, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xCF, 0x70, 0x00, 0xDF, 0x50, 0x00,
+        0x00, 0xDF, 0x60, 0x00, 0xDF, 0x50, 0x00, 0x02, 0xFF, 0x20, 0x00, 0xDF, 0x50, 0x01, 0x4D, 0xF6,
+        0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xDF, 0xCB, 0xBC, 0xFF, 0xE2, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x2D, 0xFC, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x03, 0xFF, 0x60, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x9F, 0xD0, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x1E, 0xF6, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x07, 0xFD, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x01, 0xEF, 0x60, 0x00, 0x39, 0xDE, 0xED, 0xB8, 0x30,
+        0x06, 0xFF, 0xEC, 0xBC, 0xFF, 0xC0, 0x2F, 0xF8, 0x10, 0x00, 0x15, 0x80, 0x7F, 0xC0, 0x00, 0x00,
+        0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFE,
+        0xA6, 0x30, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x03, 0x7A, 0xEF, 0xFF, 0x90,
+        0x00, 0x00, 0x00, 0x03, 0xAF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF9, 0x00, 0x00, 0x00, 0x00,
+        0x09, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x7A, 0x40, 0x00, 0x01, 0x7F, 0xF4, 0x7F, 0xFE,
+        0xCB, 0xCE, 0xFF, 0x80, 0x14, 0x9C, 0xDF, 0xED, 0x93, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x80, 0x1C, 0xCC, 0xCC, 0xDF, 0xEC, 0xCC, 0xCC, 0x60, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F,
+        0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F,
+        0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00,
+        0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00,
+        0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3,
+        0x1F, 0xF2, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0x0A, 0xFA,
+        0x00, 0x00, 0x00, 0x8F, 0xC0, 0x03, 0xFF, 0x60, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x6F, 0xFE, 0xBB,
+        0xDF, 0xF8, 0x00, 0x00, 0x03, 0x9D, 0xEF, 0xDA, 0x40, 0x00, 0xAF, 0x90, 0x00, 0x00, 0x00, 0x00,
+        0x9F, 0xA0, 0x4F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x05,
+        0xFE, 0x00, 0x07, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x00, 0x2F,
+        0xF2, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0xDF,
+        0x60, 0x00, 0x00, 0x0E, 0xF4, 0x00, 0x03, 0xFE, 0x10, 0x00, 0x00, 0x09, 0xFA, 0x00, 0x09, 0xF9,
+        0x00, 0x00, 0x00, 0x03, 0xFE, 0x10, 0x1E, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x5F, 0xD0,
+        0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF1, 0x00, 0x00, 0x07, 0xFF,
+        0x30, 0x00, 0x00, 0x4F, 0xE0, 0x0D, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x70, 0x00, 0x00, 0x8F, 0xA0,
+        0x0A, 0xF8, 0x00, 0x00, 0x0E, 0xCF, 0xB0, 0x00, 0x00, 0xCF, 0x60, 0x06, 0xFC, 0x00, 0x00, 0x3F,
+        0x8C, 0xE0, 0x00, 0x01, 0xFF, 0x20, 0x02, 0xFF, 0x10, 0x00, 0x7F, 0x58, 0xF3, 0x00, 0x04, 0xFD,
+        0x00, 0x00, 0xDF, 0x40, 0x00, 0xBF, 0x14, 0xF7, 0x00, 0x08, 0xFA, 0x00, 0x00, 0xAF, 0x80, 0x00,
+        0xEC, 0x01, 0xFB, 0x00, 0x0C, 0xF6, 0x00, 0x00, 0x6F, 0xC0, 0x03, 0xF9, 0x00, 0xCE, 0x00, 0x1F,
+        0xF2, 0x00, 0x00, 0x2F, 0xF1, 0x07, 0xF5, 0x00, 0x8F, 0x30, 0x4F, 0xD0, 0x00, 0x00, 0x0D, 0xF4,
+        0x0B, 0xF1, 0x00, 0x5F, 0x70, 0x8F, 0xA0, 0x00, 0x00, 0x0A, 0xF8, 0x0E, 0xC0, 0x00, 0x1F, 0xB0,
+        0xCF, 0x60, 0x00, 0x00, 0x06, 0xFC, 0x3F, 0x90, 0x00, 0x0C, 0xE1, 0xFF, 0x20, 0x00, 0x00, 0x02,
+        0xFF, 0x8F, 0x50, 0x00, 0x09, 0xF7, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xEF, 0x10, 0x00, 0x05,
+        0xFE, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+        0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0xDF, 0xF2, 0x00, 0x00, 0x04, 0xFE, 0x20, 0x00, 0x00, 0x0A,
+        0xFB, 0x00, 0x00, 0x9F, 0xB0, 0x00, 0x00, 0x5F, 0xE2, 0x00, 0x00, 0x1D, 0xF6, 0x00, 0x01, 0xEF,
+        0x60, 0x00, 0x00, 0x04, 0xFE, 0x20, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xB0, 0x5F, 0xE1,
+        0x00, 0x00, 0x00, 0x00, 0x1D, 0xF7, 0xEF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFA, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF6, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x1E, 0xF9, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x9F, 0xB0,
+        0x00, 0x00, 0x00, 0x05, 0xFE, 0x10, 0x1D, 0xF6, 0x00, 0x00, 0x00, 0x1E, 0xF5, 0x00, 0x04, 0xFE,
+        0x20, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0x9F, 0xB0, 0x00, 0x05, 0xFE, 0x10, 0x00, 0x00, 0x1D,
+        0xF6, 0x00, 0x1E, 0xF5, 0x00, 0x00, 0x00, 0x04, 0xFE, 0x20, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x03,
+        0xFF, 0x30, 0x01, 0xEF, 0x40, 0x00, 0x00, 0x0C, 0xF7, 0x00, 0x00, 0x5F, 0xE1, 0x00, 0x00, 0x8F,
+        0xC0, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x03, 0xFE, 0x20, 0x00, 0x00, 0x01, 0xEF, 0x50, 0x0D, 0xF7,
+        0x00, 0x00, 0x00, 0x00, 0x5F, 0xE1, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFC, 0xFE, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFD, 0x00, 0x09, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+        0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xF8,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x2E, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xA0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE2, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x05, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFE, 0xCC, 0xCC, 0xCC, 0xCC,
+        0xCC, 0x10, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x2F, 0xFF, 0xF7, 0x2F, 0xE7, 0x73,
+        0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x2F,
+        0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xD0,
+        0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xE8, 0x83,
+        0x2F, 0xFF, 0xF7, 0xDE, 0x00, 0x00, 0x00, 0x8F, 0x50, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x0D,
+        0xE0, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x04, 0xF9, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00,
+        0x9F, 0x30, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, 0x0A, 0xF3, 0x00, 0x00,
+        0x05, 0xF7, 0x00, 0x00, 0x01, 0xEC, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x6F, 0x70, 0x00,
+        0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF1, 0x00, 0x00, 0x04, 0x82, 0xDF, 0xFF, 0xA0, 0x67, 0xAF,
+        0xA0, 0x00, 0x4F, 0xA0, 0x00, 0x4F, 0xA0, 0x00, 0x4F, 0xA0, 0x00, 0x4F, 0xA0, 0x00, 0x4F, 0xA0,
+        0x00, 0x4F, 0xA0, 0x00, 0x4F, 0xA0, 0x00, 0x4F, 0xA0, 0x00, 0x4F, 0xA0, 0x00, 0x4F, 0xA0, 0x00,
+        0x4F, 0xA0, 0x00, 0x4F, 0xA0, 0x00, 0x4F, 0xA0, 0x00, 0x4F, 0xA0, 0x00, 0x4F, 0xA0, 0x68, 0xAF,
+        0xA0, 0xDF, 0xFF, 0xA0, 0x00, 0x00, 0x05, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE,
+        0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x62, 0xDF, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xE5, 0x00,
+        0x1C, 0xFA, 0x00, 0x00, 0x04, 0xEE, 0x30, 0x00, 0x01, 0xAF, 0xA0, 0x00, 0x3E, 0xD2, 0x00, 0x00,
+        0x00, 0x09, 0xF9, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x30, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x10, 0x0B, 0xF5, 0x00, 0x01, 0xCE, 0x20, 0x00,
+        0x2D, 0xC0, 0x00, 0x03, 0xE9, 0x04, 0x8C, 0xEF, 0xDA, 0x30, 0x00, 0x0C, 0xFC, 0xBA, 0xDF, 0xF5,
+        0x00, 0x05, 0x10, 0x00, 0x05, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x04, 0x67,
+        0x88, 0xBF, 0x60, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0x70, 0x3F, 0xE6, 0x21, 0x00, 0x8F, 0x70, 0x8F,
+        0x70, 0x00, 0x00, 0xAF, 0x70, 0xAF, 0x50, 0x00, 0x01, 0xEF, 0x70, 0x8F, 0xB0, 0x00, 0x1B, 0xFF,
+        0x70, 0x1E, 0xFD, 0xAA, 0xEE, 0x9F, 0x70, 0x02, 0x9D, 0xFD, 0x91, 0x8F, 0x70, 0xFF, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x06, 0xCE, 0xEA, 0x30, 0x00, 0xFF, 0x9F, 0xBA, 0xCF, 0xE4,
+        0x00, 0xFF, 0xE3, 0x00, 0x07, 0xFD, 0x10, 0xFF, 0x80, 0x00, 0x00, 0xDF, 0x60, 0xFF, 0x30, 0x00,
+        0x00, 0x7F, 0x90, 0xFF, 0x10, 0x00, 0x00, 0x5F, 0xB0, 0xFF, 0x10, 0x00, 0x00, 0x5F, 0xB0, 0xFF,
+        0x30, 0x00, 0x00, 0x7F, 0x90, 0xFF, 0x80, 0x00, 0x00, 0xCF, 0x60, 0xFF, 0xE3, 0x00, 0x07, 0xFE,
+        0x10, 0xFF, 0x9F, 0xBA, 0xCF, 0xF4, 0x00, 0xFF, 0x06, 0xCE, 0xEA, 0x30, 0x00, 0x00, 0x17, 0xCE,
+        0xFD, 0xA4, 0x02, 0xDF, 0xEB, 0xAC, 0xFB, 0x0C, 0xFA, 0x10, 0x00, 0x14, 0x5F, 0xD0, 0x00, 0x00,
+        0x00, 0x9F, 0x70, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00,
+        0x9F, 0x70, 0x00, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xFA, 0x10, 0x00, 0x14, 0x02,
+        0xDF, 0xEB, 0xAC, 0xEB, 0x00, 0x17, 0xCE, 0xED, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+        0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
+        0xF0, 0x00, 0x3A, 0xEE, 0xC6, 0x0F, 0xF0, 0x04, 0xFF, 0xCA, 0xBF, 0x9F, 0xF0, 0x1E, 0xF7, 0x00,
+        0x04, 0xFF, 0xF0, 0x6F, 0xC0, 0x00, 0x00, 0x9F, 0xF0, 0xAF, 0x70, 0x00, 0x00, 0x3F, 0xF0, 0xBF,
+        0x50, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x50, 0x00, 0x00, 0x1F, 0xF0, 0xAF, 0x70, 0x00, 0x00, 0x3F,
+        0xF0, 0x6F, 0xC0, 0x00, 0x00, 0x8F, 0xF0, 0x1E, 0xF6, 0x00, 0x04, 0xEF, 0xF0, 0x04, 0xFF, 0xCA,
+        0xBF, 0x9F, 0xF0, 0x00, 0x3B, 0xEE, 0xC6, 0x0F, 0xF0, 0x00, 0x17, 0xCE, 0xFD, 0x81, 0x00, 0x02,
+        0xDF, 0xEB, 0xBE, 0xFC, 0x10, 0x0C, 0xF9, 0x10, 0x01, 0xAF, 0xA0, 0x5F, 0xC0, 0x00, 0x00, 0x1E,
+        0xF1, 0x9F, 0x70, 0x00, 0x00, 0x0B, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xBF, 0xA8, 0x88,
+        0x88, 0x88, 0x83, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x0C,
+        0xFA, 0x10, 0x00, 0x02, 0x70, 0x02, 0xDF, 0xEC, 0xAB, 0xDF, 0xE0, 0x00, 0x16, 0xBE, 0xFE, 0xC8,
+        0x30, 0x00, 0x05, 0xCE, 0xFF, 0x30, 0x00, 0x3F, 0xFA, 0x99, 0x20, 0x00, 0x7F, 0x80, 0x00, 0x00,
+        0x00, 0x9F, 0x60, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFA, 0x00, 0x48, 0xCF, 0xA8, 0x85, 0x00, 0x00,
+        0x9F, 0x60, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x9F,
+        0x60, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x9F, 0x60,
+        0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00,
+        0x00, 0x00, 0x3B, 0xEE, 0xC6, 0x0F, 0xF0, 0x04, 0xFF, 0xCA, 0xBF, 0x8F, 0xF0, 0x1E, 0xF6, 0x00,
+        0x04, 0xEF, 0xF0, 0x6F, 0xC0, 0x00, 0x00, 0x8F, 0xF0, 0xAF, 0x70, 0x00, 0x00, 0x3F, 0xF0, 0xBF,
+        0x50, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x50, 0x00, 0x00, 0x1F, 0xF0, 0xAF, 0x60, 0x00, 0x00, 0x3F,
+        0xF0, 0x6F, 0xC0, 0x00, 0x00, 0x8F, 0xF0, 0x1E, 0xF6, 0x00, 0x03, 0xEF, 0xF0, 0x04, 0xFF, 0xC9,
+        0xBF, 0x8F, 0xE0, 0x00, 0x3B, 0xEE, 0xC6, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA0, 0x01,
+        0x10, 0x00, 0x03, 0xEF, 0x40, 0x05, 0xFC, 0xAA, 0xCF, 0xF9, 0x00, 0x02, 0x9D, 0xEF, 0xEB, 0x50,
+        0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x05, 0xCE, 0xEB, 0x30, 0x00, 0xFF,
+        0x8F, 0xDB, 0xDF, 0xF3, 0x00, 0xFF, 0xE4, 0x00, 0x0A, 0xFA, 0x00, 0xFF, 0x60, 0x00, 0x02, 0xFE,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00,
+        0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF,
+        0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF,
+        0x10, 0xEF, 0x10, 0xEF, 0x10, 0x67, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF,
+        0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF,
+        0x10, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x06, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1,
+        0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00,
+        0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E,
+        0xF1, 0x00, 0x0E, 0xF0, 0x00, 0x3F, 0xD0, 0x4A, 0xEF, 0x70, 0x6F, 0xD8, 0x00, 0xFF, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0xFC, 0x10, 0xFF, 0x00, 0x01, 0xBF, 0xA0,
+        0x00, 0xFF, 0x00, 0x2D, 0xF8, 0x00, 0x00, 0xFF, 0x03, 0xEF, 0x70, 0x00, 0x00, 0xFF, 0x4E, 0xF5,
+        0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0xD2, 0x00, 0x00, 0x00, 0xFF,
+        0x09, 0xFD, 0x20, 0x00, 0x00, 0xFF, 0x00, 0x8F, 0xD2, 0x00, 0x00, 0xFF, 0x00, 0x08, 0xFE, 0x30,
+        0x00, 0xFF, 0x00, 0x00, 0x7F, 0xE3, 0x00, 0xFF, 0x00, 0x00, 0x06, 0xFE, 0x30, 0xEF, 0x10, 0xEF,
+        0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF,
+        0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xFF, 0x06, 0xCE,
+        0xE9, 0x10, 0x07, 0xDF, 0xD8, 0x00, 0xFF, 0x8F, 0xCB, 0xEF, 0xC1, 0xBF, 0xCB, 0xFF, 0xA0, 0xFF,
+        0xE4, 0x00, 0x1D, 0xFC, 0xC2, 0x00, 0x3E, 0xF3, 0xFF, 0x60, 0x00, 0x06, 0xFF, 0x30, 0x00, 0x09,
+        0xF6, 0xFF, 0x20, 0x00, 0x04, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00,
+        0x00, 0x06, 0xF8, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x06, 0xF8, 0xFF, 0x00, 0x00, 0x03,
+        0xFC, 0x00, 0x00, 0x06, 0xF8, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x06, 0xF8, 0xFF, 0x00,
+        0x00, 0x03, 0xFC, 0x00, 0x00, 0x06, 0xF8, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x06, 0xF8,
+        0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x06, 0xF8, 0xFF, 0x05, 0xCE, 0xEB, 0x30, 0x00, 0xFF,
+        0x8F, 0xDB, 0xDF, 0xF3, 0x00, 0xFF, 0xE4, 0x00, 0x0A, 0xFA, 0x00, 0xFF, 0x60, 0x00, 0x02, 0xFE,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00,
+        0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF,
+        0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF,
+        0x10, 0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00, 0x04, 0xEF, 0xDA, 0xBF, 0xFA, 0x00, 0x1E, 0xF8, 0x00,
+        0x03, 0xEF, 0x60, 0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xD0, 0xAF, 0x70, 0x00, 0x00, 0x1F, 0xF2, 0xBF,
+        0x50, 0x00, 0x00, 0x0E, 0xF3, 0xBF, 0x50, 0x00, 0x00, 0x0E, 0xF3, 0xAF, 0x70, 0x00, 0x00, 0x1F,
+        0xF2, 0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xD0, 0x1E, 0xF8, 0x00, 0x03, 0xEF, 0x60, 0x04, 0xEF, 0xDA,
+        0xBF, 0xFA, 0x00, 0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00, 0xFF, 0x06, 0xCE, 0xEA, 0x30, 0x00, 0xFF,
+        0x9F, 0xBA, 0xCF, 0xE4, 0x00, 0xFF, 0xE3, 0x00, 0x07, 0xFD, 0x10, 0xFF, 0x80, 0x00, 0x00, 0xDF,
+        0x60, 0xFF, 0x30, 0x00, 0x00, 0x7F, 0x90, 0xFF, 0x10, 0x00, 0x00, 0x5F, 0xB0, 0xFF, 0x10, 0x00,
+        0x00, 0x5F, 0xB0, 0xFF, 0x30, 0x00, 0x00, 0x7F, 0x90, 0xFF, 0x80, 0x00, 0x00, 0xCF, 0x60, 0xFF,
+        0xE3, 0x00, 0x07, 0xFE, 0x10, 0xFF, 0x9F, 0xBA, 0xCF, 0xF4, 0x00, 0xFF, 0x06, 0xCE, 0xEA, 0x30,
+        0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xEE, 0xC6, 0x0F, 0xF0, 0x04,
+        0xFF, 0xCA, 0xBF, 0x9F, 0xF0, 0x1E, 0xF7, 0x00, 0x04, 0xFF, 0xF0, 0x6F, 0xC0, 0x00, 0x00, 0x9F,
+        0xF0, 0xAF, 0x70, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0x50, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x50, 0x00,
+        0x00, 0x1F, 0xF0, 0xAF, 0x70, 0x00, 0x00, 0x3F, 0xF0, 0x6F, 0xC0, 0x00, 0x00, 0x8F, 0xF0, 0x1E,
+        0xF6, 0x00, 0x04, 0xEF, 0xF0, 0x04, 0xFF, 0xCA, 0xBF, 0x9F, 0xF0, 0x00, 0x3B, 0xEE, 0xC6, 0x0F,
+        0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+        0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x05, 0xCE, 0xF0, 0xFF, 0x8F, 0xDB,
+        0xD1, 0xFF, 0xE4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0xFF, 0x00, 0x00,
+        0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+        0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0x9D, 0xEE, 0xDB, 0x50, 0x2E, 0xFD,
+        0xAA, 0xBE, 0xB0, 0x9F, 0x80, 0x00, 0x01, 0x30, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xC4, 0x10,
+        0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x83, 0x00, 0x00, 0x38, 0xBE, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5F,
+        0xF3, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x62, 0x00, 0x00, 0x1D, 0xF3, 0xCF, 0xDA, 0x9B, 0xEF, 0xA0,
+        0x49, 0xCE, 0xFD, 0xB5, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00,
+        0xEF, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0x10, 0x38, 0xFF, 0x88, 0x88, 0x10, 0x00, 0xEF,
+        0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00,
+        0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00,
+        0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x8F, 0xEA, 0x99, 0x10, 0x00, 0x08, 0xDF, 0xFF, 0x10,
+        0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00,
+        0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0,
+        0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0,
+        0x0F, 0xF1, 0x00, 0x00, 0x7F, 0xE0, 0x0B, 0xF9, 0x00, 0x04, 0xEF, 0xE0, 0x04, 0xFF, 0xDB, 0xDF,
+        0x7F, 0xE0, 0x00, 0x4B, 0xEE, 0xC5, 0x0F, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x0C,
+        0xF5, 0x00, 0x00, 0x04, 0xFC, 0x00, 0x06, 0xFA, 0x00, 0x00, 0x0A, 0xF6, 0x00, 0x01, 0xFF, 0x10,
+        0x00, 0x1F, 0xF1, 0x00, 0x00, 0xAF, 0x60, 0x00, 0x6F, 0xA0, 0x00, 0x00, 0x4F, 0xC0, 0x00, 0xCF,
+        0x40, 0x00, 0x00, 0x0D, 0xF3, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x08, 0xF8, 0x00, 0x00,
+        0x00, 0x02, 0xFE, 0x0D, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+        0x6F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0x10, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x05,
+        0xFF, 0x40, 0x00, 0x1F, 0xE0, 0x0A, 0xF5, 0x00, 0x09, 0xFF, 0x80, 0x00, 0x5F, 0xA0, 0x06, 0xF8,
+        0x00, 0x0C, 0xEE, 0xC0, 0x00, 0x8F, 0x60, 0x02, 0xFC, 0x00, 0x1F, 0xAA, 0xF1, 0x00, 0xCF, 0x20,
+        0x00, 0xDF, 0x10, 0x5F, 0x66, 0xF5, 0x01, 0xFD, 0x00, 0x00, 0xAF, 0x50, 0x9F, 0x22, 0xF9, 0x05,
+        0xF9, 0x00, 0x00, 0x6F, 0x90, 0xDD, 0x00, 0xDD, 0x09, 0xF5, 0x00, 0x00, 0x2F, 0xD2, 0xF9, 0x00,
+        0x9F, 0x2D, 0xF1, 0x00, 0x00, 0x0D, 0xF8, 0xF5, 0x00, 0x5F, 0x8F, 0xD0, 0x00, 0x00, 0x09, 0xFF,
+        0xF1, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x05, 0xFF, 0xC0, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00,
+        0x01, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0x10, 0x00, 0x09, 0xFB, 0x00, 0x00, 0x09, 0xFB, 0x00, 0x00,
+        0xCF, 0x70, 0x00, 0x6F, 0xD1, 0x00, 0x00, 0x2E, 0xF3, 0x02, 0xEF, 0x30, 0x00, 0x00, 0x05, 0xFD,
+        0x2C, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFE, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x9F, 0xD1, 0x00, 0x00,
+        0x00, 0x0B, 0xF8, 0x09, 0xFA, 0x00, 0x00, 0x00, 0x8F, 0xC0, 0x01, 0xDF, 0x70, 0x00, 0x04, 0xFE,
+        0x20, 0x00, 0x3F, 0xF3, 0x00, 0x1E, 0xF5, 0x00, 0x00, 0x06, 0xFD, 0x10, 0x2F, 0xE0, 0x00, 0x00,
+        0x00, 0xEF, 0x20, 0x0B, 0xF6, 0x00, 0x00, 0x05, 0xFB, 0x00, 0x04, 0xFC, 0x00, 0x00, 0x0C, 0xF5,
+        0x00, 0x00, 0xDF, 0x30, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x9F, 0x70, 0x00, 0x00,
+        0x1E, 0xE1, 0x01, 0xEF, 0x10, 0x00, 0x00, 0x09, 0xF7, 0x06, 0xFA, 0x00, 0x00, 0x00, 0x02, 0xFD,
+        0x0D, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x60,
+        0x00, 0x00, 0x00, 0x00, 0x0D, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0E, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB0, 0x00, 0x00, 0x00, 0x02, 0x9B,
+        0xFF, 0x30, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x90, 0x06, 0x88, 0x88, 0x88, 0xEF, 0x90, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x20, 0x00, 0x00,
+        0x00, 0x5F, 0xE3, 0x00, 0x00, 0x00, 0x03, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x2D, 0xF6, 0x00, 0x00,
+        0x00, 0x01, 0xCF, 0x90, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xC1, 0x00,
+        0x00, 0x00, 0x06, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0x88, 0x88, 0x88, 0x50, 0x1F, 0xFF,
+        0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x08, 0xCE, 0xF4, 0x00, 0x00, 0x7F, 0xE9, 0x72, 0x00, 0x00,
+        0xCF, 0x40, 0x00, 0x00, 0x00, 0xDF, 0x10, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0x00, 0xEF,
+        0x10, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2A, 0xFA, 0x00,
+        0x00, 0x4F, 0xFF, 0x91, 0x00, 0x00, 0x28, 0xAF, 0xE4, 0x00, 0x00, 0x00, 0x04, 0xFC, 0x00, 0x00,
+        0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00,
+        0x00, 0xEF, 0x10, 0x00, 0x00, 0x00, 0xDF, 0x10, 0x00, 0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00,
+        0x7F, 0xE9, 0x82, 0x00, 0x00, 0x07, 0xCE, 0xF4, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90,
+        0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90,
+        0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90,
+        0x3F, 0x90, 0x28, 0x50, 0x4F, 0xEC, 0x80, 0x00, 0x00, 0x27, 0x9E, 0xF7, 0x00, 0x00, 0x00, 0x04,
+        0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFD,
+        0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xAF, 0xA2,
+        0x00, 0x00, 0x00, 0x19, 0xFF, 0xF4, 0x00, 0x00, 0x4E, 0xFA, 0x82, 0x00, 0x00, 0xCF, 0x40, 0x00,
+        0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
+        0x01, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x28, 0x9E,
+        0xF7, 0x00, 0x00, 0x4F, 0xEC, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0xAE, 0xFD, 0x95, 0x10, 0x00, 0x4C, 0x20, 0x8F, 0xFC, 0xCE, 0xFF, 0xFC, 0xBE, 0xFD, 0x10,
+        0xA8, 0x10, 0x00, 0x38, 0xCE, 0xEC, 0x71, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xAF, 0x80, 0xAF, 0x80, 0x7A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x8F, 0x50, 0x9F, 0x60,
+        0xAF, 0x70, 0xAF, 0x80, 0xAF, 0x80, 0xAF, 0x80, 0xAF, 0x80, 0xAF, 0x80, 0xAF, 0x80, 0x69, 0x40,
+        0x00, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6,
+        0x00, 0x00, 0x00, 0x03, 0x9D, 0xFF, 0xD9, 0x20, 0x00, 0x6F, 0xFD, 0xEC, 0xCF, 0x60, 0x04, 0xFF,
+        0x60, 0xB6, 0x02, 0x20, 0x0B, 0xF9, 0x00, 0xB6, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0xB6, 0x00, 0x00,
+        0x2F, 0xF0, 0x00, 0xB6, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0xB6, 0x00, 0x00, 0x1F, 0xF2, 0x00, 0xB6,
+        0x00, 0x00, 0x0B, 0xF7, 0x00, 0xB6, 0x00, 0x00, 0x05, 0xFE, 0x40, 0xB6, 0x01, 0x10, 0x00, 0x8F,
+        0xFB, 0xDA, 0xAE, 0x60, 0x00, 0x04, 0xBF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+        0x00, 0x00, 0x00, 0x00, 0x29, 0xDF, 0xEB, 0x60, 0x00, 0x02, 0xEF, 0xEB, 0xCE, 0xD0, 0x00, 0x09,
+        0xFB, 0x10, 0x01, 0x50, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00,
+        0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00,
+        0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x28, 0x8F, 0xF8, 0x88, 0x82, 0x00, 0x00, 0x1F,
+        0xF1, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00,
+        0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x7C, 0xCF, 0xFC, 0xCC, 0xCC, 0xC1, 0x9F, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xF1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x9E, 0x30, 0x00, 0x00, 0x03, 0xEA, 0x00,
+        0x5F, 0xE6, 0xAE, 0xEB, 0x6E, 0xF5, 0x00, 0x04, 0xFF, 0xFB, 0xBF, 0xFF, 0x50, 0x00, 0x01, 0xED,
+        0x20, 0x02, 0xDF, 0x10, 0x00, 0x06, 0xF5, 0x00, 0x00, 0x5F, 0x60, 0x00, 0x08, 0xF2, 0x00, 0x00,
+        0x2F, 0x80, 0x00, 0x06, 0xF5, 0x00, 0x00, 0x5F, 0x60, 0x00, 0x01, 0xED, 0x20, 0x02, 0xDE, 0x10,
+        0x00, 0x04, 0xFF, 0xFB, 0xBF, 0xFF, 0x40, 0x00, 0x5F, 0xE6, 0xAE, 0xEA, 0x5E, 0xF5, 0x00, 0xAE,
+        0x30, 0x00, 0x00, 0x03, 0xE9, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x0D, 0xF3, 0x00,
+        0x00, 0x00, 0x3F, 0xD0, 0x06, 0xFA, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0xDF, 0x30, 0x00, 0x03,
+        0xFD, 0x00, 0x00, 0x6F, 0xA0, 0x00, 0x0A, 0xF6, 0x00, 0x00, 0x0D, 0xF3, 0x00, 0x3F, 0xD0, 0x00,
+        0x00, 0x06, 0xFA, 0x00, 0xAF, 0x60, 0x00, 0x00, 0x11, 0xEF, 0x33, 0xFD, 0x11, 0x00, 0x08, 0xFF,
+        0xFF, 0xAA, 0xFF, 0xFF, 0x80, 0x02, 0x44, 0x4C, 0xFF, 0xB4, 0x44, 0x20, 0x00, 0x11, 0x13, 0xFF,
+        0x31, 0x11, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0x44, 0x44, 0xFF, 0x44, 0x44,
+        0x20, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x3E, 0x90, 0x3F,
+        0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x3E, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F, 0x90, 0x3F,
+        0x90, 0x3F, 0x90, 0x00, 0x18, 0xDF, 0xEB, 0x70, 0x00, 0xCF, 0xC8, 0x9C, 0xE0, 0x03, 0xFD, 0x00,
+        0x00, 0x20, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xA1, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x60,
+        0x00, 0x05, 0xFA, 0x6D, 0xFC, 0x30, 0x0D, 0xD0, 0x01, 0x8F, 0xE3, 0x0F, 0xD0, 0x00, 0x05, 0xFC,
+        0x0B, 0xF7, 0x00, 0x00, 0xCE, 0x02, 0xDF, 0xB2, 0x01, 0xEB, 0x00, 0x19, 0xFF, 0x9C, 0xE3, 0x00,
+        0x00, 0x3C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x8F, 0xD0, 0x00, 0x00, 0x00, 0x0C, 0xF4, 0x01, 0x10,
+        0x00, 0x0D, 0xF3, 0x02, 0xFB, 0x98, 0xDF, 0xB0, 0x01, 0x8C, 0xEE, 0xD7, 0x10, 0x12, 0x10, 0x12,
+        0x10, 0xAF, 0x70, 0x7F, 0xA0, 0xAF, 0x70, 0x7F, 0xA0, 0x00, 0x00, 0x28, 0xCD, 0xDC, 0x82, 0x00,
+        0x00, 0x00, 0x09, 0xE9, 0x43, 0x34, 0x9E, 0x90, 0x00, 0x00, 0xBB, 0x10, 0x00, 0x00, 0x01, 0xBB,
+        0x00, 0x0A, 0xB0, 0x06, 0xCF, 0xFD, 0xA2, 0x0B, 0xA0, 0x4E, 0x10, 0xAF, 0xB5, 0x45, 0x93, 0x01,
+        0xE4, 0x98, 0x05, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x89, 0xD3, 0x09, 0xF3, 0x00, 0x00, 0x00, 0x00,
+        0x4D, 0xE2, 0x0B, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xD3, 0x0A, 0xF2, 0x00, 0x00, 0x00, 0x00,
+        0x3D, 0xA7, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x5D, 0x00, 0xCF, 0x83, 0x12, 0x62, 0x00,
+        0xD5, 0x0C, 0x90, 0x19, 0xEF, 0xFF, 0xD2, 0x09, 0xC0, 0x01, 0xD9, 0x00, 0x02, 0x31, 0x00, 0x9D,
+        0x10, 0x00, 0x1B, 0xD6, 0x20, 0x02, 0x6D, 0xB1, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xB5, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x19, 0xCE, 0xEC, 0x50, 0x1A, 0x64, 0x4A,
+        0xF4, 0x00, 0x00, 0x00, 0xDA, 0x05, 0xBE, 0xFF, 0xFC, 0x5F, 0xA5, 0x33, 0xCD, 0xAE, 0x00, 0x00,
+        0xDD, 0xBE, 0x00, 0x04, 0xFD, 0x6F, 0xA5, 0x7E, 0xED, 0x07, 0xDF, 0xC5, 0x9A, 0x25, 0x55, 0x55,
+        0x54, 0x8F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x05,
+        0x50, 0x00, 0x03, 0xDB, 0x00, 0x7F, 0x60, 0x00, 0x4E, 0xD3, 0x08, 0xFA, 0x10, 0x06, 0xFC, 0x21,
+        0xAF, 0x90, 0x00, 0x4F, 0xC1, 0x09, 0xF8, 0x00, 0x00, 0x1C, 0xF6, 0x04, 0xED, 0x30, 0x00, 0x01,
+        0xBF, 0x80, 0x3E, 0xE4, 0x00, 0x00, 0x09, 0xF9, 0x02, 0xCF, 0x40, 0x00, 0x00, 0x7B, 0x00, 0x1B,
+        0x60, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x8C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x10, 0xAF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x20, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x20, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x20, 0xAB, 0xBB, 0xB9, 0xEF, 0xFF, 0xFD, 0x00, 0x00, 0x28,
+        0xCD, 0xDC, 0x82, 0x00, 0x00, 0x00, 0x09, 0xE9, 0x43, 0x34, 0x9E, 0x90, 0x00, 0x00, 0xBB, 0x10,
+        0x00, 0x00, 0x01, 0xBB, 0x00, 0x0A, 0xB0, 0x4E, 0xEE, 0xDB, 0x40, 0x0B, 0xA0, 0x4E, 0x10, 0x4F,
+        0x72, 0x3A, 0xF4, 0x01, 0xE4, 0x98, 0x00, 0x4F, 0x60, 0x03, 0xF7, 0x00, 0x89, 0xD3, 0x00, 0x4F,
+        0x60, 0x08, 0xF5, 0x00, 0x4D, 0xE2, 0x00, 0x4F, 0xEE, 0xFD, 0x60, 0x00, 0x2E, 0xD3, 0x00, 0x4F,
+        0x73, 0xCE, 0x30, 0x00, 0x3D, 0xA7, 0x00, 0x4F, 0x60, 0x1E, 0xD1, 0x00, 0x7A, 0x5D, 0x00, 0x4F,
+        0x60, 0x05, 0xF8, 0x00, 0xD5, 0x0C, 0x90, 0x3A, 0x40, 0x00, 0x8A, 0x19, 0xC0, 0x01, 0xD9, 0x00,
+        0x00, 0x00, 0x00, 0x9D, 0x10, 0x00, 0x1B, 0xD6, 0x20, 0x02, 0x6D, 0xB1, 0x00, 0x00, 0x00, 0x5B,
+        0xFF, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x68, 0x88, 0x88,
+        0x60, 0xBF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xDF, 0xD6, 0x00, 0x6F, 0x85, 0x8F,
+        0x60, 0xC9, 0x00, 0x09, 0xC0, 0xC8, 0x00, 0x08, 0xC0, 0x8E, 0x52, 0x5E, 0x70, 0x09, 0xFF, 0xF9,
+        0x00, 0x00, 0x13, 0x10, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xAF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xAF, 0x20, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x8C, 0xCC, 0xCC,
+        0xEF, 0xCC, 0xCC, 0xCC, 0x10, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xAF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x9D, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xCC, 0xCC,
+        0xCC, 0xCC, 0xCC, 0xCC, 0x10, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x7C, 0xEE, 0xB3,
+        0x00, 0xA6, 0x34, 0xDE, 0x20, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x9E, 0x10, 0x00, 0x06, 0xF5,
+        0x00, 0x00, 0x6F, 0x70, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x9F, 0x73, 0x33, 0x10, 0xFF, 0xFF, 0xFF,
+        0x70, 0x7D, 0xEE, 0xC5, 0x00, 0x44, 0x33, 0x9F, 0x40, 0x00, 0x01, 0x7F, 0x60, 0x03, 0xFF, 0xFC,
+        0x10, 0x00, 0x34, 0xA8, 0x00, 0x00, 0x00, 0x1F, 0x70, 0x00, 0x00, 0x1F, 0xA0, 0x95, 0x34, 0xBF,
+        0x60, 0xAD, 0xFE, 0xC5, 0x00, 0x00, 0x06, 0xFA, 0x00, 0x00, 0x3E, 0xC1, 0x00, 0x01, 0xDD, 0x10,
+        0x00, 0x0A, 0xE2, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00,
+        0x0F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0,
+        0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F,
+        0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xF1, 0x00,
+        0x00, 0x5F, 0xE0, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xDF, 0xF0, 0x00, 0x2F, 0xEE, 0xDB, 0xCF, 0xDD,
+        0xFC, 0x60, 0x2F, 0xD3, 0xBE, 0xEA, 0x25, 0xED, 0x40, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDF, 0xFF, 0xFF, 0x90, 0x03, 0xEF, 0xFF, 0xF5, 0x4E,
+        0x90, 0x0D, 0xFF, 0xFF, 0xF1, 0x0E, 0x90, 0x3F, 0xFF, 0xFF, 0xF1, 0x0E, 0x90, 0x4F, 0xFF, 0xFF,
+        0xF1, 0x0E, 0x90, 0x2F, 0xFF, 0xFF, 0xF1, 0x0E, 0x90, 0x0C, 0xFF, 0xFF, 0xF1, 0x0E, 0x90, 0x02,
+        0xDF, 0xFF, 0xF1, 0x0E, 0x90, 0x00, 0x16, 0xBE, 0xF1, 0x0E, 0x90, 0x00, 0x00, 0x07, 0xF1, 0x0E,
+        0x90, 0x00, 0x00, 0x07, 0xF1, 0x0E, 0x90, 0x00, 0x00, 0x07, 0xF1, 0x0E, 0x90, 0x00, 0x00, 0x07,
+        0xF1, 0x0E, 0x90, 0x00, 0x00, 0x07, 0xF1, 0x0E, 0x90, 0x00, 0x00, 0x07, 0xF1, 0x0E, 0x90, 0x00,
+        0x00, 0x07, 0xF1, 0x0E, 0x90, 0x00, 0x00, 0x07, 0xF1, 0x0E, 0x90, 0x00, 0x00, 0x05, 0xC1, 0x0B,
+        0x70, 0x6A, 0x60, 0xAF, 0x90, 0xAF, 0x90, 0x00, 0x78, 0x00, 0x00, 0x2F, 0x50, 0x31, 0x3F, 0x80,
+        0xDF, 0xFE, 0x30, 0x13, 0x30, 0x00, 0x5B, 0xEF, 0x60, 0x00, 0x57, 0x6F, 0x60, 0x00, 0x00, 0x2F,
+        0x60, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x00, 0x2F,
+        0x60, 0x00, 0x13, 0x4F, 0x83, 0x20, 0x5F, 0xFF, 0xFF, 0x90, 0x02, 0xAE, 0xFC, 0x50, 0x00, 0x2E,
+        0xD6, 0x4A, 0xF6, 0x00, 0x9F, 0x30, 0x00, 0xCE, 0x10, 0xDC, 0x00, 0x00, 0x7F, 0x30, 0xEB, 0x00,
+        0x00, 0x6F, 0x50, 0xDD, 0x00, 0x00, 0x7F, 0x40, 0x9F, 0x30, 0x00, 0xDE, 0x10, 0x2E, 0xE6, 0x5B,
+        0xF6, 0x00, 0x02, 0xAE, 0xFC, 0x50, 0x00, 0x25, 0x55, 0x55, 0x54, 0x00, 0x8F, 0xFF, 0xFF, 0xFD,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x46, 0x00, 0x00, 0xEC, 0x10, 0x4F, 0x80, 0x00,
+        0x4E, 0xD2, 0x09, 0xFA, 0x00, 0x03, 0xEE, 0x40, 0x7F, 0xC1, 0x00, 0x2E, 0xF1, 0x06, 0xFB, 0x00,
+        0x9F, 0xA0, 0x2C, 0xF6, 0x1A, 0xF8, 0x03, 0xDE, 0x40, 0xBF, 0x60, 0x2E, 0xD3, 0x00, 0xD5, 0x00,
+        0x4C, 0x20, 0x00, 0x20, 0x00, 0x21, 0x00, 0x00, 0x49, 0xCD, 0x50, 0x00, 0x00, 0x00, 0x06, 0xD3,
+        0x00, 0x00, 0x69, 0x7F, 0x60, 0x00, 0x00, 0x00, 0x2E, 0xA0, 0x00, 0x00, 0x00, 0x2F, 0x60, 0x00,
+        0x00, 0x00, 0xAE, 0x20, 0x00, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x00, 0x04, 0xF6, 0x00, 0x00, 0x00,
+        0x00, 0x2F, 0x60, 0x00, 0x00, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x00, 0x8F,
+        0x30, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+        0x60, 0x00, 0x0C, 0xD1, 0x00, 0x01, 0xBD, 0x20, 0x5F, 0xFF, 0xFF, 0x90, 0x6F, 0x40, 0x00, 0x09,
+        0xEF, 0x30, 0x13, 0x33, 0x33, 0x22, 0xEA, 0x00, 0x00, 0x5E, 0x7F, 0x30, 0x00, 0x00, 0x00, 0x0A,
+        0xE2, 0x00, 0x02, 0xE4, 0x6F, 0x30, 0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x0C, 0x70, 0x6F, 0x30,
+        0x00, 0x00, 0x01, 0xDC, 0x00, 0x00, 0x8A, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x08, 0xF3, 0x00, 0x00,
+        0xCF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x22, 0x22, 0x7F, 0x51, 0x00, 0x00,
+        0xCD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x20, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x45, 0x20, 0x00, 0x00, 0x00, 0x01, 0x52, 0x00, 0x00, 0x8F, 0xDF, 0x60, 0x00,
+        0x00, 0x00, 0x0B, 0xE1, 0x00, 0x00, 0x11, 0x2F, 0x60, 0x00, 0x00, 0x00, 0x5F, 0x60, 0x00, 0x00,
+        0x00, 0x2F, 0x60, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x00, 0x09,
+        0xF2, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
+        0x60, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x07, 0xF4, 0x28, 0xCE,
+        0xC7, 0x00, 0x5F, 0xFF, 0xFF, 0x90, 0x2E, 0x90, 0x6A, 0x43, 0x8F, 0x80, 0x13, 0x33, 0x33, 0x20,
+        0xBE, 0x10, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x00, 0x2F, 0x90,
+        0x00, 0x00, 0x00, 0x1E, 0xB0, 0x00, 0x00, 0x01, 0xCD, 0x10, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00,
+        0x00, 0x1B, 0xE2, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xBD, 0x20, 0x00, 0x00, 0x00,
+        0x0C, 0xD0, 0x00, 0x00, 0x1C, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0xFF,
+        0xFF, 0xE0, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x13, 0x33, 0x33, 0x30, 0x6C, 0xEE, 0xC5, 0x00,
+        0x00, 0x00, 0x07, 0xE3, 0x00, 0x00, 0x55, 0x34, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00,
+        0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, 0xBE, 0x10, 0x00, 0x00, 0x00, 0x01, 0x9D, 0x10, 0x00, 0x05,
+        0xF5, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE7, 0x00, 0x00, 0x1E, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x24,
+        0x9F, 0x70, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x03, 0xF8, 0x00, 0x00,
+        0x00, 0x00, 0x51, 0x01, 0x7F, 0x70, 0x0C, 0xD0, 0x00, 0x00, 0x9A, 0x20, 0xCF, 0xFF, 0xE8, 0x00,
+        0x7F, 0x40, 0x00, 0x08, 0xEF, 0x30, 0x01, 0x21, 0x00, 0x02, 0xEA, 0x00, 0x00, 0x4D, 0x6F, 0x30,
+        0x00, 0x00, 0x00, 0x0A, 0xE1, 0x00, 0x02, 0xD3, 0x6F, 0x30, 0x00, 0x00, 0x00, 0x5F, 0x60, 0x00,
+        0x0B, 0x60, 0x6F, 0x30, 0x00, 0x00, 0x01, 0xDC, 0x00, 0x00, 0x8A, 0x00, 0x6F, 0x30, 0x00, 0x00,
+        0x08, 0xF3, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x22, 0x22,
+        0x7F, 0x51, 0x00, 0x00, 0xCD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x20, 0x00, 0x00, 0x21, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x70, 0x00, 0x00, 0x00, 0xAF, 0x70, 0x00,
+        0x00, 0x00, 0x7A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x50, 0x00, 0x00,
+        0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0xAF, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x00, 0x2D,
+        0xF7, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0x5F, 0xD0, 0x00,
+        0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x4F, 0xF5, 0x00, 0x04, 0xC1, 0x0A, 0xFF, 0xDB, 0xEF,
+        0xF1, 0x00, 0x7C, 0xFF, 0xD8, 0x20, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0xCD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x1F, 0xF4, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xB0, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x00,
+        0xCF, 0x60, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x10, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x09,
+        0xF9, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x0E, 0xF3, 0x00, 0x03, 0xFE, 0x10, 0x00, 0x00, 0x5F,
+        0xD0, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0xBF, 0xEC, 0xCC, 0xCC, 0xEF, 0xC0, 0x00, 0x02, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x07, 0xFB, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x0D, 0xF6,
+        0x00, 0x00, 0x00, 0x05, 0xFE, 0x00, 0x4F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0xAF, 0xA0,
+        0x00, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x1D, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x1F, 0xF4, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xB0, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x00,
+        0xCF, 0x60, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x10, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x09,
+        0xF9, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x0E, 0xF3, 0x00, 0x03, 0xFE, 0x10, 0x00, 0x00, 0x5F,
+        0xD0, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0xBF, 0xEC, 0xCC, 0xCC, 0xEF, 0xC0, 0x00, 0x02, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x07, 0xFB, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x0D, 0xF6,
+        0x00, 0x00, 0x00, 0x05, 0xFE, 0x00, 0x4F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0xAF, 0xA0,
+        0x00, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0x01, 0xCF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x09, 0xE4, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x30, 0x3E, 0x60, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x1F, 0xF4, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xB0, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x00,
+        0xCF, 0x60, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x10, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x09,
+        0xF9, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x0E, 0xF3, 0x00, 0x03, 0xFE, 0x10, 0x00, 0x00, 0x5F,
+        0xD0, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0xBF, 0xEC, 0xCC, 0xCC, 0xEF, 0xC0, 0x00, 0x02, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x07, 0xFB, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x0D, 0xF6,
+        0x00, 0x00, 0x00, 0x05, 0xFE, 0x00, 0x4F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0xAF, 0xA0,
+        0x00, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x5E, 0xE9, 0x27, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x5C, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+        0x31, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0A, 0xFD, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+        0x6F, 0xB0, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x03,
+        0xFE, 0x10, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x0E,
+        0xF3, 0x00, 0x03, 0xFE, 0x10, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0xBF,
+        0xEC, 0xCC, 0xCC, 0xEF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x07, 0xFB,
+        0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x05, 0xFE, 0x00, 0x4F, 0xE1,
+        0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00,
+        0x12, 0x10, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x80, 0x7F, 0xB0, 0x00, 0x00, 0x00, 0x00,
+        0xAF, 0x80, 0x7F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0A, 0xFD, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+        0x6F, 0xB0, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x03,
+        0xFE, 0x10, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x0E,
+        0xF3, 0x00, 0x03, 0xFE, 0x10, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0xBF,
+        0xEC, 0xCC, 0xCC, 0xEF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x07, 0xFB,
+        0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x05, 0xFE, 0x00, 0x4F, 0xE1,
+        0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xCF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x1E, 0x94, 0x9E, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x00, 0x0E, 0x60, 0x00, 0x00, 0x00, 0x00,
+        0x5F, 0x51, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFD, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x1E, 0xF4, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xB0, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x00,
+        0xBF, 0x60, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x10, 0x0E, 0xF3, 0x00, 0x00, 0x00, 0x08,
+        0xF9, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x0E, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x5F,
+        0xD0, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0xAF, 0xEC, 0xCC, 0xCC, 0xEF, 0xB0, 0x00, 0x01, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x07, 0xFB, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x0D, 0xF6,
+        0x00, 0x00, 0x00, 0x05, 0xFD, 0x00, 0x4F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0xAF, 0xA0,
+        0x00, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+        0x00, 0x00, 0x00, 0x00, 0xCF, 0xDD, 0xFF, 0xCC, 0xCC, 0xCC, 0xCA, 0x00, 0x00, 0x00, 0x04, 0xFE,
+        0x15, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0x05, 0xFD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x05, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+        0xB0, 0x05, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x50, 0x05, 0xFD, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x05, 0xFD, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0C,
+        0xF7, 0x00, 0x05, 0xFF, 0xCC, 0xCC, 0xCC, 0xC6, 0x00, 0x00, 0x3F, 0xF1, 0x00, 0x05, 0xFD, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xEC, 0xCC, 0xCD, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0xEF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x05, 0xFD,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x05, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x4F, 0xE0, 0x00, 0x00, 0x05, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0x00, 0xAF, 0x70, 0x00, 0x00, 0x05,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4A, 0xDE, 0xFD, 0xA5, 0x00, 0x00, 0x1B, 0xFF,
+        0xEC, 0xCD, 0xFF, 0xD1, 0x01, 0xDF, 0xD4, 0x00, 0x00, 0x28, 0xF3, 0x0A, 0xFD, 0x10, 0x00, 0x00,
+        0x00, 0x32, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00,
+        0x32, 0x01, 0xDF, 0xD4, 0x00, 0x00, 0x28, 0xF3, 0x00, 0x2C, 0xFF, 0xEC, 0xBD, 0xFF, 0xD1, 0x00,
+        0x00, 0x5A, 0xDF, 0xFD, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x05, 0x56, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x08, 0xEF, 0xC3,
+        0x00, 0x00, 0x00, 0x2E, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x6F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+        0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x30, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCB, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDC,
+        0xCC, 0xCC, 0xCC, 0x60, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x09, 0xF6, 0x00, 0x00,
+        0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x30, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCB, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x60, 0xDF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x80, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x1D, 0xB6, 0xF5, 0x00, 0x00, 0x00, 0xAC,
+        0x10, 0x7E, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+        0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x30, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCB, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDC,
+        0xCC, 0xCC, 0xCC, 0x60, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x22, 0x00, 0x12, 0x10, 0x00,
+        0x00, 0xFF, 0x30, 0xCF, 0x60, 0x00, 0x00, 0xFF, 0x30, 0xCF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x30, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCB, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x60, 0xDF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x80, 0x1D, 0xE1, 0x00, 0x03, 0xEA, 0x00, 0x00, 0x5F, 0x60, 0x00, 0x00, 0x00, 0x00, 0xDF,
+        0x50, 0x00, 0xDF, 0x50, 0x00, 0xDF, 0x50, 0x00, 0xDF, 0x50, 0x00, 0xDF, 0x50, 0x00, 0xDF, 0x50,
+        0x00, 0xDF, 0x50, 0x00, 0xDF, 0x50, 0x00, 0xDF, 0x50, 0x00, 0xDF, 0x50, 0x00, 0xDF, 0x50, 0x00,
+        0xDF, 0x50, 0x00, 0xDF, 0x50, 0x00, 0xDF, 0x50, 0x00, 0xDF, 0x50, 0x00, 0xDF, 0x50, 0x00, 0x8F,
+        0x60, 0x03, 0xF9, 0x00, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00,
+        0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D,
+        0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5,
+        0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x3E, 0xFA, 0x00, 0x01, 0xDC,
+        0x5F, 0x60, 0x0A, 0xD1, 0x06, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D,
+        0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D,
+        0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D,
+        0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D,
+        0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x22, 0x00, 0x12, 0x10, 0xEF, 0x40,
+        0xBF, 0x70, 0xEF, 0x40, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0xEB, 0x83,
+        0x00, 0x00, 0x00, 0xBF, 0xDB, 0xBB, 0xDF, 0xFF, 0xC2, 0x00, 0x00, 0xBF, 0x70, 0x00, 0x01, 0x5D,
+        0xFE, 0x20, 0x00, 0xBF, 0x70, 0x00, 0x00, 0x01, 0xDF, 0xB0, 0x00, 0xBF, 0x70, 0x00, 0x00, 0x00,
+        0x4F, 0xF3, 0x00, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x0D, 0xF7, 0x00, 0xBF, 0x70, 0x00, 0x00, 0x00,
+        0x0A, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x09, 0xFB, 0x78, 0xDF, 0xB8, 0x88, 0x00, 0x00,
+        0x09, 0xFB, 0x00, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0xBF, 0x70, 0x00, 0x00, 0x00,
+        0x0D, 0xF7, 0x00, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x4F, 0xF3, 0x00, 0xBF, 0x70, 0x00, 0x00, 0x01,
+        0xDF, 0xB0, 0x00, 0xBF, 0x70, 0x00, 0x01, 0x5D, 0xFE, 0x20, 0x00, 0xBF, 0xDB, 0xBB, 0xDF, 0xFF,
+        0xC2, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0xEB, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xED, 0x71, 0xBA, 0x00, 0x00, 0x00, 0x3F, 0x66, 0xDF, 0xE4, 0x00, 0x00, 0x00,
+        0x13, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF5, 0x00,
+        0x00, 0x00, 0xCF, 0x40, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0xCF, 0x40, 0xDF, 0xEF, 0x60, 0x00, 0x00,
+        0xCF, 0x40, 0xDF, 0x8F, 0xD1, 0x00, 0x00, 0xCF, 0x40, 0xDF, 0x4B, 0xF7, 0x00, 0x00, 0xCF, 0x40,
+        0xDF, 0x43, 0xFE, 0x10, 0x00, 0xCF, 0x40, 0xDF, 0x40, 0xAF, 0x80, 0x00, 0xCF, 0x40, 0xDF, 0x40,
+        0x2F, 0xE1, 0x00, 0xCF, 0x40, 0xDF, 0x40, 0x09, 0xF9, 0x00, 0xCF, 0x40, 0xDF, 0x40, 0x02, 0xFF,
+        0x20, 0xCF, 0x40, 0xDF, 0x40, 0x00, 0x8F, 0xA0, 0xCF, 0x40, 0xDF, 0x40, 0x00, 0x1E, 0xF3, 0xCF,
+        0x40, 0xDF, 0x40, 0x00, 0x07, 0xFB, 0xCF, 0x40, 0xDF, 0x40, 0x00, 0x01, 0xEF, 0xEF, 0x40, 0xDF,
+        0x40, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0xDF, 0x40, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x07,
+        0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x05, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B,
+        0xEF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xDB, 0xCF, 0xFE, 0x50, 0x00, 0x01, 0xDF, 0xC3,
+        0x00, 0x01, 0x9F, 0xF4, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x08, 0xFE, 0x10, 0x2F, 0xF4, 0x00,
+        0x00, 0x00, 0x00, 0xEF, 0x70, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0xAF, 0xA0, 0x00,
+        0x00, 0x00, 0x00, 0x5F, 0xE0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0xBF, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x4F, 0xF1, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x7F, 0xD0, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0xB0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x70, 0x0A, 0xFC, 0x10,
+        0x00, 0x00, 0x08, 0xFE, 0x10, 0x01, 0xEF, 0xC3, 0x00, 0x01, 0x9F, 0xF5, 0x00, 0x00, 0x2C, 0xFF,
+        0xDB, 0xCF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x6B, 0xEF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x03, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x57, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B,
+        0xEF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xDB, 0xCF, 0xFE, 0x50, 0x00, 0x01, 0xDF, 0xC3,
+        0x00, 0x01, 0x9F, 0xF4, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x08, 0xFE, 0x10, 0x2F, 0xF4, 0x00,
+        0x00, 0x00, 0x00, 0xEF, 0x70, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0xAF, 0xA0, 0x00,
+        0x00, 0x00, 0x00, 0x5F, 0xE0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0xBF, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x4F, 0xF1, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x7F, 0xD0, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0xB0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x70, 0x0A, 0xFC, 0x10,
+        0x00, 0x00, 0x08, 0xFE, 0x10, 0x01, 0xEF, 0xC3, 0x00, 0x01, 0x9F, 0xF5, 0x00, 0x00, 0x2C, 0xFF,
+        0xDB, 0xCF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x6B, 0xEF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xBF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD2, 0x9E, 0x20, 0x00, 0x00, 0x00, 0x00, 0x37,
+        0x10, 0x06, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B,
+        0xEF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xDB, 0xCF, 0xFE, 0x50, 0x00, 0x01, 0xDF, 0xC3,
+        0x00, 0x01, 0x9F, 0xF4, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x08, 0xFE, 0x10, 0x2F, 0xF4, 0x00,
+        0x00, 0x00, 0x00, 0xEF, 0x70, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0xAF, 0xA0, 0x00,
+        0x00, 0x00, 0x00, 0x5F, 0xE0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0xBF, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x4F, 0xF1, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x7F, 0xD0, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0xB0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x70, 0x0A, 0xFC, 0x10,
+        0x00, 0x00, 0x08, 0xFE, 0x10, 0x01, 0xEF, 0xC3, 0x00, 0x01, 0x9F, 0xF5, 0x00, 0x00, 0x2C, 0xFF,
+        0xDB, 0xCF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x6B, 0xEF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xEA, 0x35, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xBB,
+        0x4B, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xEF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x2C, 0xFF,
+        0xDB, 0xCF, 0xFE, 0x50, 0x00, 0x01, 0xDF, 0xC3, 0x00, 0x01, 0x9F, 0xF4, 0x00, 0x0A, 0xFD, 0x10,
+        0x00, 0x00, 0x08, 0xFE, 0x10, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x70, 0x7F, 0xD0, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0xB0, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0xBF, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x4F, 0xF1, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0xAF, 0xA0, 0x00,
+        0x00, 0x00, 0x00, 0x5F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x2F, 0xF4, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x70, 0x0A, 0xFC, 0x10, 0x00, 0x00, 0x08, 0xFE, 0x10, 0x01, 0xEF, 0xC3,
+        0x00, 0x01, 0x9F, 0xF5, 0x00, 0x00, 0x2C, 0xFF, 0xDB, 0xCF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x6B,
+        0xEF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F,
+        0xA0, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x12, 0x10, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xEF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x2C, 0xFF,
+        0xDB, 0xCF, 0xFE, 0x50, 0x00, 0x01, 0xDF, 0xC3, 0x00, 0x01, 0x9F, 0xF4, 0x00, 0x0A, 0xFD, 0x10,
+        0x00, 0x00, 0x08, 0xFE, 0x10, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x70, 0x7F, 0xD0, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0xB0, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0xBF, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x4F, 0xF1, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0xAF, 0xA0, 0x00,
+        0x00, 0x00, 0x00, 0x5F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x2F, 0xF4, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x70, 0x0A, 0xFC, 0x10, 0x00, 0x00, 0x08, 0xFE, 0x10, 0x01, 0xEF, 0xC3,
+        0x00, 0x01, 0x9F, 0xF5, 0x00, 0x00, 0x2C, 0xFF, 0xDB, 0xCF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x6B,
+        0xEF, 0xEC, 0x81, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0xBF, 0x90, 0x00, 0x00,
+        0x03, 0xEF, 0x30, 0x2D, 0xF9, 0x00, 0x00, 0x4E, 0xF6, 0x00, 0x01, 0xDF, 0x90, 0x04, 0xEF, 0x60,
+        0x00, 0x00, 0x1C, 0xFA, 0x4E, 0xF5, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x6F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xCF, 0xB0, 0x00, 0x00, 0x00, 0x5F, 0xE4,
+        0x1B, 0xFB, 0x10, 0x00, 0x06, 0xFE, 0x40, 0x01, 0xBF, 0xB1, 0x00, 0x6F, 0xE3, 0x00, 0x00, 0x0B,
+        0xFC, 0x10, 0x8E, 0x30, 0x00, 0x00, 0x00, 0xBD, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x6B, 0xEF, 0xEC, 0x71, 0x0A, 0xE1,
+        0x00, 0x2C, 0xFF, 0xDB, 0xCF, 0xFE, 0xAF, 0x50, 0x01, 0xDF, 0xC3, 0x00, 0x01, 0x9F, 0xF9, 0x00,
+        0x0A, 0xFD, 0x10, 0x00, 0x00, 0x5F, 0xFE, 0x10, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xF9, 0xDF, 0x60,
+        0x7F, 0xD0, 0x00, 0x00, 0x2E, 0xB0, 0x8F, 0xB0, 0xAF, 0xA0, 0x00, 0x01, 0xDC, 0x10, 0x5F, 0xE0,
+        0xBF, 0x80, 0x00, 0x1C, 0xD2, 0x00, 0x4F, 0xF1, 0xBF, 0x90, 0x00, 0xBE, 0x30, 0x00, 0x4F, 0xF1,
+        0xAF, 0xA0, 0x09, 0xF4, 0x00, 0x00, 0x5F, 0xE0, 0x7F, 0xD0, 0x7F, 0x60, 0x00, 0x00, 0x8F, 0xC0,
+        0x2F, 0xF9, 0xF8, 0x00, 0x00, 0x00, 0xEF, 0x70, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0x08, 0xFE, 0x10,
+        0x04, 0xFF, 0xC3, 0x00, 0x01, 0x9F, 0xF5, 0x00, 0x2D, 0xCC, 0xFF, 0xDB, 0xCF, 0xFE, 0x50, 0x00,
+        0xAE, 0x20, 0x5B, 0xEF, 0xEC, 0x81, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2E, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x38, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00,
+        0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F,
+        0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F,
+        0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00,
+        0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00,
+        0x0F, 0xF3, 0x1F, 0xF2, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF1,
+        0x0A, 0xFA, 0x00, 0x00, 0x00, 0x8F, 0xC0, 0x03, 0xFF, 0x60, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x6F,
+        0xFE, 0xBB, 0xDF, 0xF8, 0x00, 0x00, 0x03, 0x9D, 0xEF, 0xDA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B,
+        0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F,
+        0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00,
+        0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00,
+        0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3,
+        0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF2,
+        0x00, 0x00, 0x00, 0x1F, 0xF2, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0x0A, 0xFA, 0x00, 0x00,
+        0x00, 0x8F, 0xC0, 0x03, 0xFF, 0x60, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x6F, 0xFE, 0xBB, 0xDF, 0xF8,
+        0x00, 0x00, 0x03, 0x9D, 0xEF, 0xDA, 0x40, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x5F, 0x54, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x37, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00,
+        0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3,
+        0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1,
+        0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00,
+        0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF2, 0x00, 0x00, 0x00, 0x1F,
+        0xF2, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0x8F, 0xC0, 0x03,
+        0xFF, 0x60, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x6F, 0xFE, 0xBB, 0xDF, 0xF8, 0x00, 0x00, 0x03, 0x9D,
+        0xEF, 0xDA, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x10, 0xEF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x10, 0xEF,
+        0x40, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1,
+        0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00,
+        0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F,
+        0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F,
+        0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF2, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0x0E, 0xF4, 0x00,
+        0x00, 0x00, 0x3F, 0xF1, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0x8F, 0xC0, 0x03, 0xFF, 0x60, 0x00, 0x05,
+        0xFF, 0x50, 0x00, 0x6F, 0xFE, 0xBB, 0xDF, 0xF8, 0x00, 0x00, 0x03, 0x9D, 0xEF, 0xDA, 0x40, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0xED, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE2, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0B, 0xF9, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x30, 0x01, 0xEF, 0x40, 0x00, 0x00, 0x0C, 0xF7, 0x00,
+        0x00, 0x5F, 0xE1, 0x00, 0x00, 0x8F, 0xC0, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x03, 0xFE, 0x20, 0x00,
+        0x00, 0x01, 0xEF, 0x50, 0x0D, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE1, 0x8F, 0xB0, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0xFC, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xF6, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0xCB, 0xBB, 0x96, 0x10, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0xDF, 0x50,
+        0x01, 0x4D, 0xFD, 0x10, 0xDF, 0x50, 0x00, 0x02, 0xFF, 0x50, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x70,
+        0xDF, 0x50, 0x00, 0x00, 0xDF, 0x70, 0xDF, 0x50, 0x00, 0x02, 0xFF, 0x50, 0xDF, 0x50, 0x01, 0x4D,
+        0xFD, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0xDF, 0xCB, 0xBB, 0x96, 0x10, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x9D, 0xFE, 0xC6, 0x00, 0x00, 0x2E, 0xFD, 0xAA, 0xEF, 0x80, 0x00, 0xAF, 0xA0, 0x00, 0x1D,
+        0xF2, 0x00, 0xEF, 0x20, 0x00, 0x09, 0xF6, 0x00, 0xFF, 0x00, 0x06, 0xEF, 0xC5, 0x00, 0xFF, 0x00,
+        0x6F, 0xB1, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x30, 0x00, 0x00, 0xFF, 0x00, 0xCF, 0x50, 0x00, 0x00,
+        0xFF, 0x00, 0x6F, 0xE6, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0xC2, 0x00, 0xFF, 0x00, 0x00, 0x2A,
+        0xFE, 0x30, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x01,
+        0x00, 0x00, 0x8F, 0xA0, 0xFF, 0x0B, 0xDA, 0xAC, 0xFE, 0x30, 0xFF, 0x09, 0xEF, 0xFD, 0xA3, 0x00,
+        0x01, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xAE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x04, 0x8C, 0xEF, 0xDA, 0x30, 0x00, 0x0C, 0xFC, 0xBA, 0xDF, 0xF5, 0x00,
+        0x05, 0x10, 0x00, 0x05, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x04, 0x67, 0x88,
+        0xBF, 0x60, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0x70, 0x3F, 0xE6, 0x21, 0x00, 0x8F, 0x70, 0x8F, 0x70,
+        0x00, 0x00, 0xAF, 0x70, 0xAF, 0x50, 0x00, 0x01, 0xEF, 0x70, 0x8F, 0xB0, 0x00, 0x1B, 0xFF, 0x70,
+        0x1E, 0xFD, 0xAA, 0xEE, 0x9F, 0x70, 0x02, 0x9D, 0xFD, 0x91, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x28,
+        0x60, 0x00, 0x00, 0x00, 0x01, 0xDE, 0x30, 0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00,
+        0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0x8C, 0xEF, 0xDA, 0x30, 0x00, 0x0C, 0xFC, 0xBA, 0xDF, 0xF5, 0x00, 0x05, 0x10, 0x00, 0x05,
+        0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x04, 0x67, 0x88, 0xBF, 0x60, 0x05, 0xEF,
+        0xFF, 0xFF, 0xFF, 0x70, 0x3F, 0xE6, 0x21, 0x00, 0x8F, 0x70, 0x8F, 0x70, 0x00, 0x00, 0xAF, 0x70,
+        0xAF, 0x50, 0x00, 0x01, 0xEF, 0x70, 0x8F, 0xB0, 0x00, 0x1B, 0xFF, 0x70, 0x1E, 0xFD, 0xAA, 0xEE,
+        0x9F, 0x70, 0x02, 0x9D, 0xFD, 0x91, 0x8F, 0x70, 0x00, 0x00, 0x48, 0x30, 0x00, 0x00, 0x00, 0x02,
+        0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xD4, 0xF7, 0x00, 0x00, 0x00, 0x6F, 0x30, 0x7F, 0x30, 0x00,
+        0x00, 0x75, 0x00, 0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8C, 0xEF, 0xDA,
+        0x30, 0x00, 0x0C, 0xFC, 0xBA, 0xDF, 0xF5, 0x00, 0x05, 0x10, 0x00, 0x05, 0xFE, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xAF, 0x40, 0x00, 0x04, 0x67, 0x88, 0xBF, 0x60, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0x70,
+        0x3F, 0xE6, 0x21, 0x00, 0x8F, 0x70, 0x8F, 0x70, 0x00, 0x00, 0xAF, 0x70, 0xAF, 0x50, 0x00, 0x01,
+        0xEF, 0x70, 0x8F, 0xB0, 0x00, 0x1B, 0xFF, 0x70, 0x1E, 0xFD, 0xAA, 0xEE, 0x9F, 0x70, 0x02, 0x9D,
+        0xFD, 0x91, 0x8F, 0x70, 0x00, 0x6E, 0xE9, 0x29, 0xD0, 0x00, 0x01, 0xF9, 0x7E, 0xFF, 0x60, 0x00,
+        0x00, 0x41, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8C, 0xEF, 0xDA,
+        0x30, 0x00, 0x0C, 0xFC, 0xBA, 0xDF, 0xF5, 0x00, 0x05, 0x10, 0x00, 0x05, 0xFE, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xAF, 0x40, 0x00, 0x04, 0x67, 0x88, 0xBF, 0x60, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0x70,
+        0x3F, 0xE6, 0x21, 0x00, 0x8F, 0x70, 0x8F, 0x70, 0x00, 0x00, 0xAF, 0x70, 0xAF, 0x50, 0x00, 0x01,
+        0xEF, 0x70, 0x8F, 0xB0, 0x00, 0x1B, 0xFF, 0x70, 0x1E, 0xFD, 0xAA, 0xEE, 0x9F, 0x70, 0x02, 0x9D,
+        0xFD, 0x91, 0x8F, 0x70, 0x00, 0xCF, 0x60, 0x9F, 0x90, 0x00, 0x00, 0xCF, 0x60, 0x9F, 0x90, 0x00,
+        0x00, 0x22, 0x10, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8C, 0xEF, 0xDA,
+        0x30, 0x00, 0x0C, 0xFC, 0xBA, 0xDF, 0xF5, 0x00, 0x05, 0x10, 0x00, 0x05, 0xFE, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xAF, 0x40, 0x00, 0x04, 0x67, 0x88, 0xBF, 0x60, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0x70,
+        0x3F, 0xE6, 0x21, 0x00, 0x8F, 0x70, 0x8F, 0x70, 0x00, 0x00, 0xAF, 0x70, 0xAF, 0x50, 0x00, 0x01,
+        0xEF, 0x70, 0x8F, 0xB0, 0x00, 0x1B, 0xFF, 0x70, 0x1E, 0xFD, 0xAA, 0xEE, 0x9F, 0x70, 0x02, 0x9D,
+        0xFD, 0x91, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xDF, 0xC3, 0x00, 0x00,
+        0x00, 0x4F, 0x74, 0xAE, 0x10, 0x00, 0x00, 0x8C, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x5F, 0x51, 0x7F,
+        0x20, 0x00, 0x00, 0x09, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x13, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x04, 0x8C, 0xEF, 0xDA, 0x30, 0x00, 0x0C, 0xFC, 0xBA, 0xDF, 0xF5, 0x00,
+        0x05, 0x10, 0x00, 0x05, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x04, 0x67, 0x88,
+        0xBF, 0x60, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0x70, 0x3F, 0xE6, 0x21, 0x00, 0x8F, 0x70, 0x8F, 0x70,
+        0x00, 0x00, 0xAF, 0x70, 0xAF, 0x50, 0x00, 0x01, 0xEF, 0x70, 0x8F, 0xB0, 0x00, 0x1B, 0xFF, 0x70,
+        0x1E, 0xFD, 0xAA, 0xEE, 0x9F, 0x70, 0x02, 0x9D, 0xFD, 0x91, 0x8F, 0x70, 0x04, 0x8C, 0xEF, 0xD9,
+        0x30, 0x06, 0xCE, 0xFD, 0x81, 0x00, 0x0C, 0xFC, 0xBA, 0xDF, 0xF6, 0xCF, 0xEB, 0xBD, 0xFD, 0x20,
+        0x05, 0x10, 0x00, 0x05, 0xFF, 0xFA, 0x10, 0x00, 0x9F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xD0,
+        0x00, 0x00, 0x0D, 0xF2, 0x00, 0x04, 0x67, 0x88, 0xBF, 0x80, 0x00, 0x00, 0x0A, 0xF5, 0x05, 0xEF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x3F, 0xE6, 0x21, 0x00, 0x8F, 0xB8, 0x88, 0x88,
+        0x88, 0x83, 0x8F, 0x70, 0x00, 0x00, 0xAF, 0x90, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x50, 0x00, 0x01,
+        0xEF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x1B, 0xFC, 0xFB, 0x20, 0x00, 0x01, 0x70,
+        0x1E, 0xFD, 0xAA, 0xEF, 0x61, 0xCF, 0xEC, 0xAA, 0xCF, 0xF0, 0x02, 0x9D, 0xFE, 0xA4, 0x00, 0x06,
+        0xBE, 0xFE, 0xC8, 0x40, 0x00, 0x17, 0xCE, 0xFD, 0xA4, 0x02, 0xDF, 0xEB, 0xAC, 0xFB, 0x0C, 0xFA,
+        0x10, 0x00, 0x14, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x9F, 0x70, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00,
+        0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x9F, 0x70, 0x00, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00,
+        0x00, 0x0D, 0xFA, 0x10, 0x00, 0x14, 0x02, 0xDF, 0xEB, 0xAC, 0xEB, 0x00, 0x17, 0xCF, 0xFD, 0xA4,
+        0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0x65, 0xCF, 0x10, 0x00,
+        0x04, 0xEF, 0xD6, 0x00, 0x00, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF3, 0x00, 0x00, 0x00,
+        0x00, 0x01, 0xDD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD, 0x81, 0x00, 0x02, 0xDF,
+        0xEB, 0xBE, 0xFC, 0x10, 0x0C, 0xF9, 0x10, 0x01, 0xAF, 0xA0, 0x5F, 0xC0, 0x00, 0x00, 0x1E, 0xF1,
+        0x9F, 0x70, 0x00, 0x00, 0x0B, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xBF, 0xA8, 0x88, 0x88,
+        0x88, 0x83, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFA,
+        0x10, 0x00, 0x02, 0x70, 0x02, 0xDF, 0xEC, 0xAB, 0xDF, 0xE0, 0x00, 0x16, 0xBE, 0xFE, 0xC8, 0x30,
+        0x00, 0x00, 0x00, 0x05, 0x83, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x02, 0xEC,
+        0x10, 0x00, 0x00, 0x00, 0x0B, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x28, 0x30, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD, 0x81, 0x00, 0x02, 0xDF, 0xEB, 0xBE, 0xFC, 0x10,
+        0x0C, 0xF9, 0x10, 0x01, 0xAF, 0xA0, 0x5F, 0xC0, 0x00, 0x00, 0x1E, 0xF1, 0x9F, 0x70, 0x00, 0x00,
+        0x0B, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xBF, 0xA8, 0x88, 0x88, 0x88, 0x83, 0xAF, 0x80,
+        0x00, 0x00, 0x00, 0x00, 0x5F, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFA, 0x10, 0x00, 0x02, 0x70,
+        0x02, 0xDF, 0xEC, 0xAB, 0xDF, 0xE0, 0x00, 0x16, 0xBE, 0xFE, 0xC8, 0x30, 0x00, 0x00, 0x07, 0x70,
+        0x00, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x8E, 0x20, 0x00, 0x00, 0x0C,
+        0xC0, 0x0C, 0xB0, 0x00, 0x00, 0x28, 0x20, 0x02, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x17, 0xCE, 0xFD, 0x81, 0x00, 0x02, 0xDF, 0xEB, 0xBE, 0xFC, 0x10, 0x0C, 0xF9, 0x10, 0x01,
+        0xAF, 0xA0, 0x5F, 0xC0, 0x00, 0x00, 0x1E, 0xF1, 0x9F, 0x70, 0x00, 0x00, 0x0B, 0xF4, 0xBF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xF5, 0xBF, 0xA8, 0x88, 0x88, 0x88, 0x83, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0x5F, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFA, 0x10, 0x00, 0x02, 0x70, 0x02, 0xDF, 0xEC, 0xAB,
+        0xDF, 0xE0, 0x00, 0x16, 0xBE, 0xFE, 0xC8, 0x30, 0x00, 0x3F, 0xF0, 0x0F, 0xF3, 0x00, 0x00, 0x3F,
+        0xF0, 0x0F, 0xF3, 0x00, 0x00, 0x02, 0x20, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x17, 0xCE, 0xFD, 0x81, 0x00, 0x02, 0xDF, 0xEB, 0xBE, 0xFC, 0x10, 0x0C, 0xF9, 0x10, 0x01,
+        0xAF, 0xA0, 0x5F, 0xC0, 0x00, 0x00, 0x1E, 0xF1, 0x9F, 0x70, 0x00, 0x00, 0x0B, 0xF4, 0xBF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xF5, 0xBF, 0xA8, 0x88, 0x88, 0x88, 0x83, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0x5F, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFA, 0x10, 0x00, 0x02, 0x70, 0x02, 0xDF, 0xEC, 0xAB,
+        0xDF, 0xE0, 0x00, 0x16, 0xBE, 0xFE, 0xC8, 0x30, 0x3E, 0xD1, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x6F,
+        0x60, 0x00, 0x08, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1,
+        0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00,
+        0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0C, 0xF4, 0x00, 0x9F,
+        0x60, 0x05, 0xF7, 0x00, 0x2E, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00,
+        0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E,
+        0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x2E,
+        0xF3, 0x00, 0x00, 0xBD, 0xCC, 0x00, 0x06, 0xF4, 0x2E, 0x70, 0x1E, 0x70, 0x06, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E,
+        0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E,
+        0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E,
+        0xF1, 0x00, 0x2F, 0xF1, 0x0E, 0xF4, 0x2F, 0xF1, 0x0E, 0xF4, 0x02, 0x20, 0x02, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E,
+        0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E,
+        0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E,
+        0xF1, 0x00, 0x00, 0x3E, 0xF5, 0x01, 0x68, 0x00, 0x00, 0x03, 0xEF, 0xDD, 0x95, 0x00, 0x05, 0xBE,
+        0xAD, 0xF6, 0x00, 0x00, 0x03, 0x30, 0x01, 0xCF, 0x50, 0x00, 0x00, 0x29, 0xDF, 0xEF, 0xE3, 0x00,
+        0x03, 0xEF, 0xDA, 0x9C, 0xFD, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0xAF, 0x60, 0x5F, 0xD0, 0x00, 0x00,
+        0x3F, 0xC0, 0xAF, 0x70, 0x00, 0x00, 0x0E, 0xF1, 0xBF, 0x50, 0x00, 0x00, 0x0D, 0xF3, 0xBF, 0x50,
+        0x00, 0x00, 0x0E, 0xF3, 0x9F, 0x80, 0x00, 0x00, 0x1F, 0xF2, 0x5F, 0xD0, 0x00, 0x00, 0x7F, 0xD0,
+        0x0D, 0xF8, 0x00, 0x03, 0xEF, 0x60, 0x02, 0xEF, 0xDA, 0xBF, 0xF9, 0x00, 0x00, 0x18, 0xDF, 0xEB,
+        0x50, 0x00, 0x00, 0x9E, 0xD7, 0x2C, 0x90, 0x00, 0x04, 0xF7, 0x9F, 0xFE, 0x30, 0x00, 0x01, 0x40,
+        0x01, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x05, 0xCE, 0xEB, 0x30, 0x00,
+        0xFF, 0x8F, 0xDB, 0xDF, 0xF3, 0x00, 0xFF, 0xE4, 0x00, 0x0A, 0xFA, 0x00, 0xFF, 0x60, 0x00, 0x02,
+        0xFE, 0x00, 0xFF, 0x20, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00,
+        0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10,
+        0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00,
+        0xEF, 0x10, 0x00, 0x58, 0x30, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x03,
+        0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00, 0x04, 0xEF, 0xDA, 0xBF,
+        0xFA, 0x00, 0x1E, 0xF8, 0x00, 0x03, 0xEF, 0x60, 0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xD0, 0xAF, 0x70,
+        0x00, 0x00, 0x1F, 0xF2, 0xBF, 0x50, 0x00, 0x00, 0x0E, 0xF3, 0xBF, 0x50, 0x00, 0x00, 0x0E, 0xF3,
+        0xAF, 0x70, 0x00, 0x00, 0x1F, 0xF2, 0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xD0, 0x1E, 0xF8, 0x00, 0x03,
+        0xEF, 0x60, 0x04, 0xEF, 0xDA, 0xBF, 0xFA, 0x00, 0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x07, 0x71, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x04, 0xF9, 0x00, 0x00,
+        0x00, 0x00, 0x2E, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x47, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00, 0x04, 0xEF, 0xDA, 0xBF, 0xFA, 0x00, 0x1E, 0xF8,
+        0x00, 0x03, 0xEF, 0x60, 0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xD0, 0xAF, 0x70, 0x00, 0x00, 0x1F, 0xF2,
+        0xBF, 0x50, 0x00, 0x00, 0x0E, 0xF3, 0xBF, 0x50, 0x00, 0x00, 0x0E, 0xF3, 0xAF, 0x70, 0x00, 0x00,
+        0x1F, 0xF2, 0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xD0, 0x1E, 0xF8, 0x00, 0x03, 0xEF, 0x60, 0x04, 0xEF,
+        0xDA, 0xBF, 0xFA, 0x00, 0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00, 0x00, 0x00, 0x28, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xBF, 0xF3, 0x00, 0x00, 0x00, 0x06, 0xF5, 0xCC, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x2E,
+        0x70, 0x00, 0x00, 0x47, 0x00, 0x04, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+        0xDF, 0xEB, 0x50, 0x00, 0x04, 0xEF, 0xDA, 0xBF, 0xFA, 0x00, 0x1E, 0xF8, 0x00, 0x03, 0xEF, 0x60,
+        0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xD0, 0xAF, 0x70, 0x00, 0x00, 0x1F, 0xF2, 0xBF, 0x50, 0x00, 0x00,
+        0x0E, 0xF3, 0xBF, 0x50, 0x00, 0x00, 0x0E, 0xF3, 0xAF, 0x70, 0x00, 0x00, 0x1F, 0xF2, 0x6F, 0xD0,
+        0x00, 0x00, 0x6F, 0xD0, 0x1E, 0xF8, 0x00, 0x03, 0xEF, 0x60, 0x04, 0xEF, 0xDA, 0xBF, 0xFA, 0x00,
+        0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00, 0x00, 0x2C, 0xEB, 0x44, 0xF3, 0x00, 0x00, 0xAC, 0x6C, 0xFF,
+        0xB0, 0x00, 0x00, 0x32, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+        0xDF, 0xEB, 0x50, 0x00, 0x04, 0xEF, 0xDA, 0xBF, 0xFA, 0x00, 0x1E, 0xF8, 0x00, 0x03, 0xEF, 0x60,
+        0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xD0, 0xAF, 0x70, 0x00, 0x00, 0x1F, 0xF2, 0xBF, 0x50, 0x00, 0x00,
+        0x0E, 0xF3, 0xBF, 0x50, 0x00, 0x00, 0x0E, 0xF3, 0xAF, 0x70, 0x00, 0x00, 0x1F, 0xF2, 0x6F, 0xD0,
+        0x00, 0x00, 0x6F, 0xD0, 0x1E, 0xF8, 0x00, 0x03, 0xEF, 0x60, 0x04, 0xEF, 0xDA, 0xBF, 0xFA, 0x00,
+        0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00, 0x00, 0x7F, 0xB0, 0x4F, 0xE0, 0x00, 0x00, 0x7F, 0xB0, 0x4F,
+        0xE0, 0x00, 0x00, 0x12, 0x10, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+        0xDF, 0xEB, 0x50, 0x00, 0x04, 0xEF, 0xDA, 0xBF, 0xFA, 0x00, 0x1E, 0xF8, 0x00, 0x03, 0xEF, 0x60,
+        0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xD0, 0xAF, 0x70, 0x00, 0x00, 0x1F, 0xF2, 0xBF, 0x50, 0x00, 0x00,
+        0x0E, 0xF3, 0xBF, 0x50, 0x00, 0x00, 0x0E, 0xF3, 0xAF, 0x70, 0x00, 0x00, 0x1F, 0xF2, 0x6F, 0xD0,
+        0x00, 0x00, 0x6F, 0xD0, 0x1E, 0xF8, 0x00, 0x03, 0xEF, 0x60, 0x04, 0xEF, 0xDA, 0xBF, 0xFA, 0x00,
+        0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x10, 0xAF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x06, 0x10, 0x00, 0x02, 0x9D, 0xFE, 0xB5, 0x5F, 0x50, 0x00, 0x4E, 0xFD, 0xAC,
+        0xFF, 0xF8, 0x00, 0x01, 0xEF, 0x80, 0x00, 0x5F, 0xF6, 0x00, 0x06, 0xFD, 0x00, 0x01, 0xDB, 0xFD,
+        0x00, 0x0A, 0xF8, 0x00, 0x1C, 0xB0, 0xEF, 0x10, 0x0B, 0xF6, 0x00, 0xAD, 0x10, 0xDF, 0x30, 0x0B,
+        0xF5, 0x09, 0xE2, 0x00, 0xEF, 0x30, 0x0A, 0xF7, 0x7F, 0x40, 0x01, 0xFF, 0x20, 0x06, 0xFD, 0xF6,
+        0x00, 0x07, 0xFD, 0x00, 0x01, 0xDF, 0xB0, 0x00, 0x3E, 0xF6, 0x00, 0x02, 0xEF, 0xFD, 0xAB, 0xFF,
+        0xA0, 0x00, 0x1D, 0xC2, 0x9D, 0xFE, 0xB5, 0x00, 0x00, 0x06, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x58, 0x30, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEB, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x71, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0,
+        0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00,
+        0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xD0,
+        0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xF1, 0x00, 0x00, 0x7F, 0xE0, 0x0B, 0xF9, 0x00, 0x04, 0xEF, 0xE0,
+        0x04, 0xFF, 0xDB, 0xDF, 0x7F, 0xE0, 0x00, 0x4B, 0xEE, 0xC5, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07,
+        0x82, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x03, 0xFA, 0x00, 0x00, 0x00, 0x00,
+        0x1D, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x47, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00,
+        0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0,
+        0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0,
+        0x0F, 0xF1, 0x00, 0x00, 0x7F, 0xE0, 0x0B, 0xF9, 0x00, 0x04, 0xEF, 0xE0, 0x04, 0xFF, 0xDB, 0xDF,
+        0x7F, 0xE0, 0x00, 0x4B, 0xEE, 0xC5, 0x0F, 0xE0, 0x00, 0x00, 0x17, 0x60, 0x00, 0x00, 0x00, 0x00,
+        0x9F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xF6, 0xBD, 0x10, 0x00, 0x00, 0x1D, 0xA0, 0x1E, 0x90, 0x00,
+        0x00, 0x37, 0x10, 0x03, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
+        0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0,
+        0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0,
+        0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xF1, 0x00, 0x00,
+        0x7F, 0xE0, 0x0B, 0xF9, 0x00, 0x04, 0xEF, 0xE0, 0x04, 0xFF, 0xDB, 0xDF, 0x7F, 0xE0, 0x00, 0x4B,
+        0xEE, 0xC5, 0x0F, 0xE0, 0x00, 0x6F, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x6F, 0xC0, 0x3F, 0xF0, 0x00,
+        0x00, 0x12, 0x20, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
+        0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0,
+        0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0,
+        0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xF1, 0x00, 0x00,
+        0x7F, 0xE0, 0x0B, 0xF9, 0x00, 0x04, 0xEF, 0xE0, 0x04, 0xFF, 0xDB, 0xDF, 0x7F, 0xE0, 0x00, 0x4B,
+        0xEE, 0xC5, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
+        0x00, 0x00, 0x00, 0xEF, 0x20, 0x0B, 0xF6, 0x00, 0x00, 0x05, 0xFB, 0x00, 0x04, 0xFC, 0x00, 0x00,
+        0x0C, 0xF5, 0x00, 0x00, 0xDF, 0x30, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x9F, 0x70,
+        0x00, 0x00, 0x1E, 0xE1, 0x01, 0xEF, 0x10, 0x00, 0x00, 0x09, 0xF7, 0x06, 0xFA, 0x00, 0x00, 0x00,
+        0x02, 0xFD, 0x0D, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x4F,
+        0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0E, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB0, 0x00, 0x00, 0x00,
+        0x02, 0x9B, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x06, 0xCE, 0xEA, 0x30, 0x00, 0xFF, 0x9F, 0xBA, 0xCF,
+        0xE4, 0x00, 0xFF, 0xE3, 0x00, 0x07, 0xFD, 0x10, 0xFF, 0x80, 0x00, 0x00, 0xDF, 0x60, 0xFF, 0x30,
+        0x00, 0x00, 0x7F, 0x90, 0xFF, 0x10, 0x00, 0x00, 0x5F, 0xB0, 0xFF, 0x10, 0x00, 0x00, 0x5F, 0xB0,
+        0xFF, 0x30, 0x00, 0x00, 0x7F, 0x90, 0xFF, 0x80, 0x00, 0x00, 0xCF, 0x60, 0xFF, 0xE3, 0x00, 0x07,
+        0xFE, 0x10, 0xFF, 0x9F, 0xBA, 0xCF, 0xF4, 0x00, 0xFF, 0x06, 0xCE, 0xEA, 0x30, 0x00, 0xFF, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x07, 0xFB, 0x00, 0x00, 0x00, 0x0A, 0xF8,
+        0x07, 0xFB, 0x00, 0x00, 0x00, 0x01, 0x21, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xEF, 0x20, 0x0B, 0xF6, 0x00, 0x00, 0x05, 0xFB, 0x00,
+        0x04, 0xFC, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0xDF, 0x30, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x6F,
+        0x90, 0x00, 0x9F, 0x70, 0x00, 0x00, 0x1E, 0xE1, 0x01, 0xEF, 0x10, 0x00, 0x00, 0x09, 0xF7, 0x06,
+        0xFA, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x0D, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x8F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x4F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFE, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x09, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+        0xB0, 0x00, 0x00, 0x00, 0x02, 0x9B, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xC4, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x68, 0x88, 0x88, 0x60,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xE0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0xFB, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xB0, 0xBF, 0x70,
+        0x00, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x10, 0x0E, 0xF4,
+        0x00, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x0E, 0xF3, 0x00, 0x03, 0xFE,
+        0x10, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0xBF, 0xEC, 0xCC, 0xCC, 0xEF,
+        0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x07, 0xFB, 0x00, 0x00, 0x00, 0x0A,
+        0xF8, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x05, 0xFE, 0x00, 0x4F, 0xE1, 0x00, 0x00, 0x00, 0x00,
+        0xEF, 0x40, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0xEF, 0xFF, 0xFF, 0x80, 0x00,
+        0x00, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0x8C, 0xEF, 0xDA, 0x30, 0x00, 0x0C, 0xFC, 0xBA, 0xDF, 0xF5, 0x00, 0x05, 0x10,
+        0x00, 0x05, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x04, 0x67, 0x88, 0xBF, 0x60,
+        0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0x70, 0x3F, 0xE6, 0x21, 0x00, 0x8F, 0x70, 0x8F, 0x70, 0x00, 0x00,
+        0xAF, 0x70, 0xAF, 0x50, 0x00, 0x01, 0xEF, 0x70, 0x8F, 0xB0, 0x00, 0x1B, 0xFF, 0x70, 0x1E, 0xFD,
+        0xAA, 0xEE, 0x9F, 0x70, 0x02, 0x9D, 0xFD, 0x91, 0x8F, 0x70, 0x00, 0x00, 0x45, 0x00, 0x02, 0x70,
+        0x00, 0x00, 0x00, 0x00, 0x6F, 0x62, 0x4C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFD, 0x30,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x6F, 0xB0, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x5F, 0xD0,
+        0x00, 0x00, 0x00, 0x03, 0xFE, 0x10, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x09, 0xF9,
+        0x00, 0x00, 0x00, 0x0E, 0xF3, 0x00, 0x03, 0xFE, 0x10, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0xCF,
+        0x60, 0x00, 0x00, 0xBF, 0xEC, 0xCC, 0xCC, 0xEF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xF2, 0x00, 0x07, 0xFB, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x05,
+        0xFE, 0x00, 0x4F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+        0x9F, 0xA0, 0x00, 0xDA, 0x32, 0x4D, 0x90, 0x00, 0x00, 0x4E, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00,
+        0x34, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8C, 0xEF, 0xDA, 0x30, 0x00,
+        0x0C, 0xFC, 0xBA, 0xDF, 0xF5, 0x00, 0x05, 0x10, 0x00, 0x05, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xAF, 0x40, 0x00, 0x04, 0x67, 0x88, 0xBF, 0x60, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0x70, 0x3F, 0xE6,
+        0x21, 0x00, 0x8F, 0x70, 0x8F, 0x70, 0x00, 0x00, 0xAF, 0x70, 0xAF, 0x50, 0x00, 0x01, 0xEF, 0x70,
+        0x8F, 0xB0, 0x00, 0x1B, 0xFF, 0x70, 0x1E, 0xFD, 0xAA, 0xEE, 0x9F, 0x70, 0x02, 0x9D, 0xFD, 0x91,
+        0x8F, 0x70, 0x00, 0x00, 0x00, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0A, 0xFC, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0xEF, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x6F, 0xA0, 0x9F, 0x70, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x40, 0x4F, 0xD0,
+        0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x09, 0xF8, 0x00, 0x07, 0xF9,
+        0x00, 0x00, 0x00, 0x0E, 0xF2, 0x00, 0x02, 0xFE, 0x10, 0x00, 0x00, 0x5F, 0xC0, 0x00, 0x00, 0xBF,
+        0x60, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xCC, 0xCC, 0xCC, 0xCE,
+        0xF2, 0x00, 0x07, 0xFA, 0x00, 0x00, 0x00, 0x09, 0xF8, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x00, 0x04,
+        0xFE, 0x00, 0x4F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0xAF, 0x90, 0x00, 0x00, 0x00, 0x00,
+        0x8F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+        0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF7, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0xBE, 0xF7, 0x04, 0x8C, 0xEF, 0xDA, 0x30, 0x00, 0x0C, 0xFC, 0xBA, 0xDF, 0xF5, 0x00, 0x05, 0x10,
+        0x00, 0x05, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x04, 0x67, 0x88, 0xBF, 0x60,
+        0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0x70, 0x3F, 0xE6, 0x21, 0x00, 0x8F, 0x70, 0x8F, 0x70, 0x00, 0x00,
+        0xAF, 0x70, 0xAF, 0x50, 0x00, 0x01, 0xEF, 0x70, 0x8F, 0xB0, 0x00, 0x1B, 0xFF, 0x70, 0x1E, 0xFD,
+        0xAA, 0xEE, 0x9F, 0x70, 0x02, 0x9D, 0xFD, 0x91, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x01, 0xD7, 0x00,
+        0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF6, 0x53, 0x00, 0x00, 0x00, 0x02,
+        0xCE, 0xE5, 0x00, 0x00, 0x00, 0x02, 0xEC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xC1, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x47, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x4A, 0xDE, 0xFD, 0xA5, 0x00, 0x00, 0x1B, 0xFF, 0xEC, 0xCD, 0xFF, 0xD1, 0x01, 0xDF, 0xD4, 0x00,
+        0x00, 0x28, 0xF3, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x32, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x32, 0x01, 0xDF, 0xD4, 0x00, 0x00, 0x28, 0xF3,
+        0x00, 0x2C, 0xFF, 0xEC, 0xBD, 0xFF, 0xD1, 0x00, 0x00, 0x5A, 0xDE, 0xFD, 0xA5, 0x00, 0x00, 0x00,
+        0x00, 0x05, 0x83, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x02, 0xEC, 0x10, 0x00, 0x00, 0x0C,
+        0xD1, 0x00, 0x00, 0x00, 0x38, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD,
+        0xA4, 0x02, 0xDF, 0xEB, 0xAC, 0xFB, 0x0C, 0xFA, 0x10, 0x00, 0x14, 0x5F, 0xD0, 0x00, 0x00, 0x00,
+        0x9F, 0x70, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x9F,
+        0x70, 0x00, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xFA, 0x10, 0x00, 0x14, 0x02, 0xDF,
+        0xEB, 0xAC, 0xEB, 0x00, 0x17, 0xCE, 0xED, 0xA4, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00,
+        0x00, 0x05, 0xF5, 0x4E, 0x70, 0x00, 0x00, 0x00, 0x07, 0x40, 0x03, 0x71, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xDE, 0xFD, 0xA5, 0x00, 0x00, 0x1B, 0xFF, 0xEC, 0xCD,
+        0xFF, 0xD1, 0x01, 0xDF, 0xD4, 0x00, 0x00, 0x28, 0xF3, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x32,
+        0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xA0,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x32, 0x01,
+        0xDF, 0xD4, 0x00, 0x00, 0x28, 0xF3, 0x00, 0x2C, 0xFF, 0xEC, 0xBD, 0xFF, 0xD1, 0x00, 0x00, 0x5A,
+        0xDE, 0xFD, 0xA5, 0x00, 0x00, 0x00, 0x05, 0x82, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0x00, 0x00, 0x00,
+        0xCC, 0x5F, 0x60, 0x00, 0x08, 0xE2, 0x08, 0xE1, 0x00, 0x07, 0x40, 0x00, 0x74, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD, 0xA4, 0x02, 0xDF, 0xEB, 0xAC, 0xFB, 0x0C, 0xFA, 0x10, 0x00,
+        0x14, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x9F, 0x70, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00,
+        0xBF, 0x50, 0x00, 0x00, 0x00, 0x9F, 0x70, 0x00, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x0D,
+        0xFA, 0x10, 0x00, 0x14, 0x02, 0xDF, 0xEB, 0xAC, 0xEB, 0x00, 0x17, 0xCE, 0xED, 0xA4, 0x00, 0x00,
+        0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+        0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xDE, 0xFD, 0xA5,
+        0x00, 0x00, 0x1B, 0xFF, 0xEC, 0xCD, 0xFF, 0xD1, 0x01, 0xDF, 0xD4, 0x00, 0x00, 0x28, 0xF3, 0x0A,
+        0xFD, 0x10, 0x00, 0x00, 0x00, 0x32, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD,
+        0x10, 0x00, 0x00, 0x00, 0x32, 0x01, 0xDF, 0xD4, 0x00, 0x00, 0x28, 0xF3, 0x00, 0x2C, 0xFF, 0xEC,
+        0xBD, 0xFF, 0xD1, 0x00, 0x00, 0x5A, 0xDE, 0xFD, 0xA5, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
+        0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+        0xCE, 0xFD, 0xA4, 0x02, 0xDF, 0xEB, 0xAC, 0xFB, 0x0C, 0xFA, 0x10, 0x00, 0x14, 0x5F, 0xD0, 0x00,
+        0x00, 0x00, 0x9F, 0x70, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00,
+        0x00, 0x9F, 0x70, 0x00, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xFA, 0x10, 0x00, 0x14,
+        0x02, 0xDF, 0xEB, 0xAC, 0xEB, 0x00, 0x17, 0xCE, 0xED, 0xA4, 0x00, 0x00, 0x2E, 0x70, 0x2D, 0x80,
+        0x00, 0x00, 0x00, 0x03, 0xE9, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x70, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xDE, 0xFD, 0xA5, 0x00, 0x00, 0x1B, 0xFF,
+        0xEC, 0xCD, 0xFF, 0xD1, 0x01, 0xDF, 0xD4, 0x00, 0x00, 0x28, 0xF3, 0x0A, 0xFD, 0x10, 0x00, 0x00,
+        0x00, 0x32, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00,
+        0x32, 0x01, 0xDF, 0xD4, 0x00, 0x00, 0x28, 0xF3, 0x00, 0x2C, 0xFF, 0xEC, 0xBD, 0xFF, 0xD1, 0x00,
+        0x00, 0x5A, 0xDE, 0xFD, 0xA5, 0x00, 0x00, 0x28, 0x20, 0x02, 0x82, 0x00, 0x0C, 0xB0, 0x0C, 0xB0,
+        0x00, 0x03, 0xF8, 0x9E, 0x20, 0x00, 0x00, 0x7F, 0xF6, 0x00, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD, 0xA4, 0x02, 0xDF, 0xEB, 0xAC, 0xFB, 0x0C, 0xFA,
+        0x10, 0x00, 0x14, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x9F, 0x70, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00,
+        0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x9F, 0x70, 0x00, 0x00, 0x00, 0x5F, 0xD0, 0x00, 0x00,
+        0x00, 0x0D, 0xFA, 0x10, 0x00, 0x14, 0x02, 0xDF, 0xEB, 0xAC, 0xEB, 0x00, 0x17, 0xCE, 0xED, 0xA4,
+        0x00, 0x1C, 0xA0, 0x09, 0xD1, 0x00, 0x00, 0x00, 0x02, 0xE9, 0x8F, 0x30, 0x00, 0x00, 0x00, 0x00,
+        0x5F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFE, 0xDB,
+        0x83, 0x00, 0x00, 0xDF, 0xCB, 0xBC, 0xDF, 0xFF, 0xB1, 0x00, 0xDF, 0x50, 0x00, 0x01, 0x6E, 0xFD,
+        0x10, 0xDF, 0x50, 0x00, 0x00, 0x02, 0xEF, 0xA0, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x5F, 0xF2, 0xDF,
+        0x50, 0x00, 0x00, 0x00, 0x0E, 0xF5, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0xDF, 0x50, 0x00,
+        0x00, 0x00, 0x0A, 0xF9, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0xDF, 0x50, 0x00, 0x00, 0x00,
+        0x0B, 0xF8, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x0E, 0xF5, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x5F, 0xF2,
+        0xDF, 0x50, 0x00, 0x00, 0x02, 0xDF, 0xA0, 0xDF, 0x50, 0x00, 0x01, 0x6E, 0xFD, 0x10, 0xDF, 0xCB,
+        0xBC, 0xDF, 0xFF, 0xB1, 0x00, 0xDF, 0xFF, 0xFE, 0xDB, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0F, 0xF0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00,
+        0x0F, 0xF0, 0x8F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xAE, 0x00, 0x00, 0x3A, 0xEE, 0xC6,
+        0x0F, 0xF0, 0x00, 0x00, 0x04, 0xFF, 0xCA, 0xBF, 0x9F, 0xF0, 0x00, 0x00, 0x1E, 0xF7, 0x00, 0x04,
+        0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x9F, 0xF0, 0x00, 0x00, 0xAF, 0x70, 0x00, 0x00,
+        0x3F, 0xF0, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00,
+        0x1F, 0xF0, 0x00, 0x00, 0xAF, 0x70, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00,
+        0x8F, 0xF0, 0x00, 0x00, 0x1E, 0xF6, 0x00, 0x04, 0xEF, 0xF0, 0x00, 0x00, 0x04, 0xFF, 0xCA, 0xBF,
+        0x9F, 0xF0, 0x00, 0x00, 0x00, 0x3B, 0xEE, 0xC6, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE,
+        0xEB, 0x83, 0x00, 0x00, 0x00, 0xBF, 0xDB, 0xBB, 0xDF, 0xFF, 0xC2, 0x00, 0x00, 0xBF, 0x70, 0x00,
+        0x01, 0x5D, 0xFE, 0x20, 0x00, 0xBF, 0x70, 0x00, 0x00, 0x01, 0xDF, 0xB0, 0x00, 0xBF, 0x70, 0x00,
+        0x00, 0x00, 0x4F, 0xF3, 0x00, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x0D, 0xF7, 0x00, 0xBF, 0x70, 0x00,
+        0x00, 0x00, 0x0A, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x09, 0xFB, 0x78, 0xDF, 0xB8, 0x88,
+        0x00, 0x00, 0x09, 0xFB, 0x00, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0xBF, 0x70, 0x00,
+        0x00, 0x00, 0x0D, 0xF7, 0x00, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x4F, 0xF3, 0x00, 0xBF, 0x70, 0x00,
+        0x00, 0x01, 0xDF, 0xB0, 0x00, 0xBF, 0x70, 0x00, 0x01, 0x5D, 0xFE, 0x20, 0x00, 0xBF, 0xDB, 0xBB,
+        0xDF, 0xFF, 0xC2, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0xEB, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+        0x1F, 0xF1, 0x10, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x02, 0x44, 0x4F, 0xF4,
+        0x20, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3A, 0xEE, 0xC6, 0x0F, 0xF0, 0x00, 0x04,
+        0xFF, 0xCA, 0xBF, 0x9F, 0xF0, 0x00, 0x1E, 0xF7, 0x00, 0x04, 0xFF, 0xF0, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x9F, 0xF0, 0x00, 0xAF, 0x70, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x1F,
+        0xF0, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xAF, 0x70, 0x00, 0x00, 0x3F, 0xF0, 0x00,
+        0x6F, 0xC0, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x1E, 0xF6, 0x00, 0x04, 0xEF, 0xF0, 0x00, 0x04, 0xFF,
+        0xCA, 0xBF, 0x9F, 0xF0, 0x00, 0x00, 0x3B, 0xEE, 0xC6, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+        0x70, 0x00, 0x00, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0x40, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x30, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xDF, 0xDC,
+        0xCC, 0xCC, 0xCB, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x60, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F,
+        0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x18, 0x88, 0x88, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD, 0x81, 0x00, 0x02, 0xDF, 0xEB, 0xBE,
+        0xFC, 0x10, 0x0C, 0xF9, 0x10, 0x01, 0xAF, 0xA0, 0x5F, 0xC0, 0x00, 0x00, 0x1E, 0xF1, 0x9F, 0x70,
+        0x00, 0x00, 0x0B, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xBF, 0xA8, 0x88, 0x88, 0x88, 0x83,
+        0xAF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFA, 0x10, 0x00,
+        0x02, 0x70, 0x02, 0xDF, 0xEC, 0xAB, 0xDF, 0xE0, 0x00, 0x16, 0xBE, 0xFE, 0xC8, 0x30, 0x00, 0xE9,
+        0x22, 0x5E, 0x70, 0x00, 0x00, 0x5E, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x01, 0x34, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xDF, 0xDC, 0xCC, 0xCC,
+        0xCC, 0x30, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCB, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x60,
+        0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0x61, 0x04, 0xE5, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+        0xB0, 0x00, 0x00, 0x00, 0x36, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD, 0x81, 0x00, 0x02, 0xDF, 0xEB, 0xBE, 0xFC, 0x10,
+        0x0C, 0xF9, 0x10, 0x01, 0xAF, 0xA0, 0x5F, 0xC0, 0x00, 0x00, 0x1E, 0xF1, 0x9F, 0x70, 0x00, 0x00,
+        0x0B, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xBF, 0xA8, 0x88, 0x88, 0x88, 0x83, 0xAF, 0x80,
+        0x00, 0x00, 0x00, 0x00, 0x5F, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFA, 0x10, 0x00, 0x02, 0x70,
+        0x02, 0xDF, 0xEC, 0xAB, 0xDF, 0xE0, 0x00, 0x16, 0xBE, 0xFE, 0xC8, 0x30, 0x00, 0x00, 0xDF, 0x40,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x30,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCB, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x60, 0xDF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0D, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF1, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD,
+        0x81, 0x00, 0x02, 0xDF, 0xEB, 0xBE, 0xFC, 0x10, 0x0C, 0xF9, 0x10, 0x01, 0xAF, 0xA0, 0x5F, 0xC0,
+        0x00, 0x00, 0x1E, 0xF1, 0x9F, 0x70, 0x00, 0x00, 0x0B, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+        0xBF, 0xA8, 0x88, 0x88, 0x88, 0x83, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xD1, 0x00, 0x00,
+        0x00, 0x00, 0x0C, 0xFA, 0x10, 0x00, 0x02, 0x70, 0x02, 0xDF, 0xEC, 0xAB, 0xDF, 0xE0, 0x00, 0x16,
+        0xBE, 0xFE, 0xC8, 0x30, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x30,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCB, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x60, 0xDF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0x75, 0x40, 0x00, 0x00, 0x00, 0x1B, 0xEE, 0x70, 0x00, 0x17, 0xCE, 0xFD,
+        0x81, 0x00, 0x02, 0xDF, 0xEB, 0xBE, 0xFC, 0x10, 0x0C, 0xF9, 0x10, 0x01, 0xAF, 0xA0, 0x5F, 0xC0,
+        0x00, 0x00, 0x1E, 0xF1, 0x9F, 0x70, 0x00, 0x00, 0x0B, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+        0xBF, 0xA8, 0x88, 0x88, 0x88, 0x83, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xD1, 0x00, 0x00,
+        0x00, 0x00, 0x0C, 0xFA, 0x10, 0x00, 0x02, 0x70, 0x02, 0xDF, 0xEC, 0xAB, 0xDF, 0xE0, 0x00, 0x16,
+        0xBE, 0xFF, 0xF8, 0x30, 0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x5F, 0x85, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xEF, 0x80, 0x00, 0x9D, 0x10, 0x6F,
+        0x30, 0x00, 0x00, 0x1C, 0xC5, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x30,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCB, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x60, 0xDF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x18, 0x30, 0x01, 0x73, 0x00, 0x00, 0x0A, 0xD1, 0x0B, 0xC0, 0x00,
+        0x00, 0x01, 0xEA, 0x7F, 0x30, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0x71,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD, 0x81, 0x00, 0x02, 0xDF,
+        0xEB, 0xBE, 0xFC, 0x10, 0x0C, 0xF9, 0x10, 0x01, 0xAF, 0xA0, 0x5F, 0xC0, 0x00, 0x00, 0x1E, 0xF1,
+        0x9F, 0x70, 0x00, 0x00, 0x0B, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xBF, 0xA8, 0x88, 0x88,
+        0x88, 0x83, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFA,
+        0x10, 0x00, 0x02, 0x70, 0x02, 0xDF, 0xEC, 0xAB, 0xDF, 0xE0, 0x00, 0x16, 0xBE, 0xFE, 0xC8, 0x30,
+        0x00, 0x00, 0x00, 0x4F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE8, 0x2D, 0x90, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0x50, 0x02, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x49, 0xDE, 0xFE, 0xB8, 0x30, 0x00, 0x00, 0x1B, 0xFF, 0xEC, 0xBC, 0xFF, 0xF9, 0x00,
+        0x01, 0xDF, 0xD5, 0x00, 0x00, 0x15, 0xBC, 0x00, 0x0A, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00,
+        0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x5B, 0xBB, 0xBB, 0x30,
+        0xBF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40,
+        0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40,
+        0x0A, 0xFC, 0x10, 0x00, 0x00, 0x00, 0xEF, 0x40, 0x01, 0xDF, 0xD4, 0x00, 0x00, 0x05, 0xEF, 0x40,
+        0x00, 0x1B, 0xFF, 0xEC, 0xBC, 0xEF, 0xFA, 0x10, 0x00, 0x00, 0x49, 0xDE, 0xFE, 0xC8, 0x30, 0x00,
+        0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xE2, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xDB,
+        0x00, 0x00, 0x00, 0x3F, 0x60, 0x3F, 0x60, 0x00, 0x00, 0x57, 0x00, 0x05, 0x70, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xEE, 0xC6, 0x0F, 0xF0, 0x04, 0xFF, 0xCA, 0xBF, 0x8F, 0xF0,
+        0x1E, 0xF6, 0x00, 0x04, 0xEF, 0xF0, 0x6F, 0xC0, 0x00, 0x00, 0x8F, 0xF0, 0xAF, 0x70, 0x00, 0x00,
+        0x3F, 0xF0, 0xBF, 0x50, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x50, 0x00, 0x00, 0x1F, 0xF0, 0xAF, 0x60,
+        0x00, 0x00, 0x3F, 0xF0, 0x6F, 0xC0, 0x00, 0x00, 0x8F, 0xF0, 0x1E, 0xF6, 0x00, 0x03, 0xEF, 0xF0,
+        0x04, 0xFF, 0xC9, 0xBF, 0x8F, 0xE0, 0x00, 0x3B, 0xEE, 0xC6, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00,
+        0x5F, 0xA0, 0x01, 0x10, 0x00, 0x03, 0xEF, 0x40, 0x05, 0xFC, 0xAA, 0xCF, 0xF9, 0x00, 0x02, 0x9D,
+        0xEF, 0xEB, 0x50, 0x00, 0x00, 0x00, 0xAC, 0x32, 0x3B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF,
+        0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xDE, 0xFE, 0xB8, 0x30, 0x00, 0x00, 0x1B, 0xFF, 0xEC,
+        0xBC, 0xFF, 0xF9, 0x00, 0x01, 0xDF, 0xD5, 0x00, 0x00, 0x15, 0xBC, 0x00, 0x0A, 0xFC, 0x10, 0x00,
+        0x00, 0x00, 0x04, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
+        0x5B, 0xBB, 0xBB, 0x30, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0xAF, 0xA0, 0x00, 0x00,
+        0x00, 0x00, 0xEF, 0x40, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0x2F, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0xEF, 0x40, 0x0A, 0xFC, 0x10, 0x00, 0x00, 0x00, 0xEF, 0x40, 0x01, 0xDF, 0xD4, 0x00,
+        0x00, 0x05, 0xEF, 0x40, 0x00, 0x1B, 0xFF, 0xEC, 0xBC, 0xEF, 0xFA, 0x10, 0x00, 0x00, 0x49, 0xDE,
+        0xFE, 0xC8, 0x30, 0x00, 0x00, 0x27, 0x00, 0x00, 0x72, 0x00, 0x00, 0x2F, 0x71, 0x18, 0xF2, 0x00,
+        0x00, 0x08, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x36, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xEE, 0xC6, 0x0F, 0xF0, 0x04, 0xFF,
+        0xCA, 0xBF, 0x8F, 0xF0, 0x1E, 0xF6, 0x00, 0x04, 0xEF, 0xF0, 0x6F, 0xC0, 0x00, 0x00, 0x8F, 0xF0,
+        0xAF, 0x70, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0x50, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x50, 0x00, 0x00,
+        0x1F, 0xF0, 0xAF, 0x60, 0x00, 0x00, 0x3F, 0xF0, 0x6F, 0xC0, 0x00, 0x00, 0x8F, 0xF0, 0x1E, 0xF6,
+        0x00, 0x03, 0xEF, 0xF0, 0x04, 0xFF, 0xC9, 0xBF, 0x8F, 0xE0, 0x00, 0x3B, 0xEE, 0xC6, 0x2F, 0xD0,
+        0x00, 0x00, 0x00, 0x00, 0x5F, 0xA0, 0x01, 0x10, 0x00, 0x03, 0xEF, 0x40, 0x05, 0xFC, 0xAA, 0xCF,
+        0xF9, 0x00, 0x02, 0x9D, 0xEF, 0xEB, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xDE, 0xFE, 0xB8, 0x30, 0x00,
+        0x00, 0x1B, 0xFF, 0xEC, 0xBC, 0xFF, 0xF9, 0x00, 0x01, 0xDF, 0xD5, 0x00, 0x00, 0x15, 0xBC, 0x00,
+        0x0A, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xBF, 0x80, 0x00, 0x00, 0x5B, 0xBB, 0xBB, 0x30, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
+        0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40,
+        0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0x0A, 0xFC, 0x10, 0x00, 0x00, 0x00, 0xEF, 0x40,
+        0x01, 0xDF, 0xD4, 0x00, 0x00, 0x05, 0xEF, 0x40, 0x00, 0x1B, 0xFF, 0xEC, 0xBC, 0xEF, 0xFA, 0x10,
+        0x00, 0x00, 0x49, 0xDE, 0xFE, 0xC8, 0x30, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00,
+        0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x27, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x3B, 0xEE, 0xC6, 0x0F, 0xF0, 0x04, 0xFF, 0xCA, 0xBF, 0x8F, 0xF0, 0x1E, 0xF6, 0x00, 0x04,
+        0xEF, 0xF0, 0x6F, 0xC0, 0x00, 0x00, 0x8F, 0xF0, 0xAF, 0x70, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0x50,
+        0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x50, 0x00, 0x00, 0x1F, 0xF0, 0xAF, 0x60, 0x00, 0x00, 0x3F, 0xF0,
+        0x6F, 0xC0, 0x00, 0x00, 0x8F, 0xF0, 0x1E, 0xF6, 0x00, 0x03, 0xEF, 0xF0, 0x04, 0xFF, 0xC9, 0xBF,
+        0x8F, 0xE0, 0x00, 0x3B, 0xEE, 0xC6, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA0, 0x01, 0x10,
+        0x00, 0x03, 0xEF, 0x40, 0x05, 0xFC, 0xAA, 0xCF, 0xF9, 0x00, 0x02, 0x9D, 0xEF, 0xEB, 0x50, 0x00,
+        0x00, 0x00, 0x49, 0xDE, 0xFE, 0xB8, 0x30, 0x00, 0x00, 0x1B, 0xFF, 0xEC, 0xBC, 0xFF, 0xF9, 0x00,
+        0x01, 0xDF, 0xD5, 0x00, 0x00, 0x15, 0xBC, 0x00, 0x0A, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00,
+        0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x5B, 0xBB, 0xBB, 0x30,
+        0xBF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40,
+        0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x40,
+        0x0A, 0xFC, 0x10, 0x00, 0x00, 0x00, 0xEF, 0x40, 0x01, 0xDF, 0xD4, 0x00, 0x00, 0x05, 0xEF, 0x40,
+        0x00, 0x1B, 0xFF, 0xEC, 0xBC, 0xEF, 0xFA, 0x10, 0x00, 0x00, 0x49, 0xDE, 0xFE, 0xC8, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x54, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x00,
+        0x08, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x25, 0x40, 0x00, 0x00,
+        0x00, 0x3B, 0xEE, 0xC6, 0x0F, 0xF0, 0x04, 0xFF, 0xCA, 0xBF, 0x8F, 0xF0, 0x1E, 0xF6, 0x00, 0x04,
+        0xEF, 0xF0, 0x6F, 0xC0, 0x00, 0x00, 0x8F, 0xF0, 0xAF, 0x70, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0x50,
+        0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x50, 0x00, 0x00, 0x1F, 0xF0, 0xAF, 0x60, 0x00, 0x00, 0x3F, 0xF0,
+        0x6F, 0xC0, 0x00, 0x00, 0x8F, 0xF0, 0x1E, 0xF6, 0x00, 0x03, 0xEF, 0xF0, 0x04, 0xFF, 0xC9, 0xBF,
+        0x8F, 0xE0, 0x00, 0x3B, 0xEE, 0xC6, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA0, 0x01, 0x10,
+        0x00, 0x03, 0xEF, 0x40, 0x05, 0xFC, 0xAA, 0xCF, 0xF9, 0x00, 0x02, 0x9D, 0xEF, 0xEB, 0x50, 0x00,
+        0x00, 0x00, 0x2E, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCC, 0x5F, 0x60, 0x00, 0x00, 0x00, 0x09,
+        0xD1, 0x06, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF,
+        0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF,
+        0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0x60, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0xEF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00,
+        0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0xCF, 0x60, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x6F, 0xF6, 0x00,
+        0x00, 0x00, 0x00, 0x03, 0xF8, 0x9E, 0x30, 0x00, 0x00, 0x00, 0x1D, 0xA0, 0x0A, 0xD1, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x5C, 0xEE, 0xB3, 0x00, 0x00, 0x0F, 0xF8, 0xFD, 0xBD,
+        0xFF, 0x30, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0xAF, 0xA0, 0x00, 0x0F, 0xF6, 0x00, 0x00, 0x2F, 0xE0,
+        0x00, 0x0F, 0xF2, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x0F,
+        0xF0, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x0F, 0xF0, 0x00,
+        0x00, 0x0E, 0xF1, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0E,
+        0xF1, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x30,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x30,
+        0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0xBB, 0xFF, 0xCB,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x30,
+        0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF, 0x30,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x30,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x30,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x30,
+        0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x30, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+        0xFF, 0xF6, 0x00, 0x00, 0x8C, 0xFD, 0xBB, 0xB4, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00,
+        0x06, 0xF9, 0x18, 0xDF, 0xD9, 0x10, 0x06, 0xFA, 0xCE, 0xCB, 0xEF, 0xC0, 0x06, 0xFF, 0xB1, 0x00,
+        0x2E, 0xF5, 0x06, 0xFE, 0x20, 0x00, 0x07, 0xF9, 0x06, 0xFB, 0x00, 0x00, 0x05, 0xFA, 0x06, 0xFA,
+        0x00, 0x00, 0x04, 0xFB, 0x06, 0xF9, 0x00, 0x00, 0x04, 0xFB, 0x06, 0xF9, 0x00, 0x00, 0x04, 0xFB,
+        0x06, 0xF9, 0x00, 0x00, 0x04, 0xFB, 0x06, 0xF9, 0x00, 0x00, 0x04, 0xFB, 0x06, 0xF9, 0x00, 0x00,
+        0x04, 0xFB, 0x06, 0xF9, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x08, 0xED, 0x71, 0xBB,
+        0x3F, 0x66, 0xDF, 0xE4, 0x13, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF5, 0x00,
+        0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00,
+        0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00,
+        0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00,
+        0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x0A, 0xED, 0x62, 0xD8,
+        0x5F, 0x69, 0xFF, 0xE2, 0x23, 0x00, 0x13, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00,
+        0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00,
+        0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00,
+        0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0xFF, 0xFF, 0xFF, 0x70,
+        0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00,
+        0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00,
+        0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00,
+        0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00,
+        0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x18, 0x88, 0x88, 0x82,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00,
+        0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00,
+        0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00,
+        0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0x93, 0x24, 0xE7, 0x05, 0xEF, 0xFF, 0xB1,
+        0x00, 0x13, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00,
+        0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00,
+        0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00,
+        0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00,
+        0x00, 0x0D, 0xF5, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x2F, 0x61, 0x04, 0xF4, 0x09, 0xFF, 0xFF, 0xB0,
+        0x00, 0x36, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00,
+        0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00,
+        0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00,
+        0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x0D, 0xF5, 0x00, 0x0D,
+        0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5,
+        0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00,
+        0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x0D, 0xF5, 0x00, 0x05, 0xE1, 0x00, 0x0E,
+        0x70, 0x00, 0x1F, 0xB5, 0x60, 0x07, 0xDF, 0xC0, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x06, 0x70,
+        0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00,
+        0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E,
+        0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0E, 0xF1, 0x00, 0x0A, 0xB0, 0x00, 0x3F, 0x30, 0x00, 0x5F, 0x85,
+        0x40, 0x1A, 0xEF, 0x80, 0xDF, 0x50, 0xDF, 0x50, 0x22, 0x10, 0x00, 0x00, 0xDF, 0x50, 0xDF, 0x50,
+        0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50,
+        0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xDF, 0x50, 0xEF, 0x10, 0xEF, 0x10,
+        0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10,
+        0xEF, 0x10, 0xEF, 0x10, 0xDF, 0x50, 0x00, 0x5F, 0xC0, 0xDF, 0x50, 0x00, 0x5F, 0xC0, 0xDF, 0x50,
+        0x00, 0x5F, 0xC0, 0xDF, 0x50, 0x00, 0x5F, 0xC0, 0xDF, 0x50, 0x00, 0x5F, 0xC0, 0xDF, 0x50, 0x00,
+        0x5F, 0xC0, 0xDF, 0x50, 0x00, 0x5F, 0xC0, 0xDF, 0x50, 0x00, 0x5F, 0xC0, 0xDF, 0x50, 0x00, 0x5F,
+        0xC0, 0xDF, 0x50, 0x00, 0x5F, 0xC0, 0xDF, 0x50, 0x00, 0x5F, 0xC0, 0xDF, 0x50, 0x00, 0x5F, 0xC0,
+        0xDF, 0x50, 0x00, 0x5F, 0xC0, 0xDF, 0x50, 0x00, 0x5F, 0xC0, 0xDF, 0x50, 0x00, 0x5F, 0xC0, 0xDF,
+        0x50, 0x00, 0x6F, 0xB0, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0x03, 0xEF, 0x50, 0x00, 0x08,
+        0xDF, 0xFC, 0x00, 0x00, 0x0A, 0xFD, 0x81, 0x00, 0xEF, 0x10, 0x00, 0xCF, 0x20, 0xEF, 0x10, 0x00,
+        0xCF, 0x20, 0x67, 0x00, 0x00, 0x57, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, 0xCF,
+        0x20, 0xEF, 0x10, 0x00, 0xCF, 0x20, 0xEF, 0x10, 0x00, 0xCF, 0x20, 0xEF, 0x10, 0x00, 0xCF, 0x20,
+        0xEF, 0x10, 0x00, 0xCF, 0x20, 0xEF, 0x10, 0x00, 0xCF, 0x20, 0xEF, 0x10, 0x00, 0xCF, 0x20, 0xEF,
+        0x10, 0x00, 0xCF, 0x20, 0xEF, 0x10, 0x00, 0xCF, 0x20, 0xEF, 0x10, 0x00, 0xCF, 0x20, 0xEF, 0x10,
+        0x00, 0xCF, 0x20, 0xEF, 0x10, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0x01,
+        0xFE, 0x00, 0x00, 0x03, 0xAE, 0xF9, 0x00, 0x00, 0x04, 0xFD, 0x91, 0x00, 0x00, 0x04, 0xFF, 0xA0,
+        0x00, 0x00, 0x3E, 0x82, 0xD9, 0x00, 0x00, 0x66, 0x00, 0x27, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00,
+        0x00, 0x01, 0xFF, 0x20, 0x00, 0x00, 0x09, 0xFD, 0x00, 0x00, 0x2C, 0xEF, 0xF5, 0x00, 0x00, 0x2F,
+        0xEB, 0x40, 0x00, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x02, 0xE9, 0x7F, 0x30,
+        0x0B, 0xC1, 0x0B, 0xC0, 0x18, 0x20, 0x01, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00,
+        0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00,
+        0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00,
+        0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x0E, 0xF0, 0x00,
+        0x00, 0x3F, 0xD0, 0x00, 0x4A, 0xEF, 0x70, 0x00, 0x6F, 0xD8, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x2D, 0xFB, 0x10, 0xDF, 0x50, 0x00, 0x03, 0xDF, 0xA0, 0x00, 0xDF, 0x50, 0x00, 0x3E, 0xF9, 0x00,
+        0x00, 0xDF, 0x50, 0x04, 0xEF, 0x90, 0x00, 0x00, 0xDF, 0x50, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0xDF,
+        0x55, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xDF, 0xAF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x90,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0xBF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x57, 0xFF, 0x60, 0x00,
+        0x00, 0x00, 0xDF, 0x50, 0x7F, 0xF6, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x07, 0xFF, 0x60, 0x00, 0x00,
+        0xDF, 0x50, 0x00, 0x7F, 0xF6, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x07, 0xFF, 0x60, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x7F, 0xF6, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x07, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0A, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x90, 0x00, 0x00, 0x00, 0xFF,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0xFC, 0x10, 0xFF, 0x00, 0x01,
+        0xBF, 0xA0, 0x00, 0xFF, 0x00, 0x2D, 0xF8, 0x00, 0x00, 0xFF, 0x03, 0xEF, 0x70, 0x00, 0x00, 0xFF,
+        0x4E, 0xF5, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0xD2, 0x00, 0x00,
+        0x00, 0xFF, 0x09, 0xFD, 0x20, 0x00, 0x00, 0xFF, 0x00, 0x8F, 0xD2, 0x00, 0x00, 0xFF, 0x00, 0x08,
+        0xFE, 0x30, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xE3, 0x00, 0xFF, 0x00, 0x00, 0x06, 0xFE, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x70, 0x00,
+        0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+        0x0A, 0xFC, 0x10, 0xFF, 0x00, 0x01, 0xBF, 0xA0, 0x00, 0xFF, 0x00, 0x2C, 0xF9, 0x00, 0x00, 0xFF,
+        0x03, 0xDF, 0x70, 0x00, 0x00, 0xFF, 0x4E, 0xF5, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+        0x00, 0xFF, 0xAF, 0xC1, 0x00, 0x00, 0x00, 0xFF, 0x09, 0xFD, 0x20, 0x00, 0x00, 0xFF, 0x00, 0x8F,
+        0xD2, 0x00, 0x00, 0xFF, 0x00, 0x08, 0xFD, 0x20, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xE3, 0x00, 0xFF,
+        0x00, 0x00, 0x07, 0xFE, 0x30, 0x00, 0xCE, 0x20, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00,
+        0x00, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x20, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x02, 0xED, 0x10,
+        0x0B, 0xE2, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF,
+        0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10,
+        0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00,
+        0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDC, 0xCC,
+        0xCC, 0xCC, 0x20, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x35, 0x30, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00,
+        0x00, 0x00, 0x05, 0xF3, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x0E, 0xF1, 0x0E, 0xF1, 0x0E, 0xF1, 0x0E,
+        0xF1, 0x0E, 0xF1, 0x0E, 0xF1, 0x0E, 0xF1, 0x0E, 0xF1, 0x0E, 0xF1, 0x0E, 0xF1, 0x0E, 0xF1, 0x0E,
+        0xF1, 0x0E, 0xF1, 0x0E, 0xF1, 0x0E, 0xF1, 0x00, 0x00, 0x04, 0x53, 0x0D, 0xF2, 0x2F, 0x90, 0x6F,
+        0x20, 0xDF, 0x50, 0x0D, 0xF3, 0x00, 0x00, 0xDF, 0x50, 0x1F, 0xD0, 0x00, 0x00, 0xDF, 0x50, 0x4F,
+        0x80, 0x00, 0x00, 0xDF, 0x50, 0x6E, 0x30, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x20, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x20, 0xEF, 0x10, 0xFF, 0x10, 0xEF, 0x13, 0xFC, 0x00, 0xEF, 0x16, 0xF7, 0x00, 0xEF, 0x18, 0xE2,
+        0x00, 0xEF, 0x10, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0xEF, 0x10, 0x00,
+        0x00, 0xEF, 0x10, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0xEF, 0x10, 0x00,
+        0x00, 0xEF, 0x10, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0xEF, 0x10, 0x00,
+        0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x9F, 0xA0, 0x00, 0xDF, 0x50, 0x00, 0x9F, 0xA0,
+        0x00, 0xDF, 0x50, 0x00, 0x6A, 0x60, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDC, 0xCC, 0xCC, 0xCC, 0x20, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x20, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00,
+        0xEF, 0x10, 0x00, 0xEF, 0x6F, 0xE0, 0xEF, 0x6F, 0xE0, 0xEF, 0x4A, 0x90, 0xEF, 0x10, 0x00, 0xEF,
+        0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10, 0x00, 0xEF, 0x10,
+        0x00, 0x00, 0x0B, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0B, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7,
+        0x00, 0x71, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0x2C, 0xF6, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xEE, 0x40,
+        0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xF9, 0x00, 0x00, 0x00, 0x00,
+        0x09, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x7B, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+        0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0xCC, 0xCC, 0xCC, 0xC3, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xF4, 0x00, 0xDF, 0x20, 0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0xDF, 0x20,
+        0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0xDF, 0x47, 0x00, 0x00, 0xDF, 0xFD, 0x10, 0x02, 0xEF, 0x80,
+        0x00, 0x5E, 0xFF, 0x20, 0x00, 0x99, 0xDF, 0x20, 0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0xDF, 0x20,
+        0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0xDF, 0x20,
+        0x00, 0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xD1, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x8E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF5, 0x00,
+        0x00, 0x00, 0xCF, 0x40, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0xCF, 0x40, 0xDF, 0xEF, 0x60, 0x00, 0x00,
+        0xCF, 0x40, 0xDF, 0x8F, 0xD1, 0x00, 0x00, 0xCF, 0x40, 0xDF, 0x4B, 0xF7, 0x00, 0x00, 0xCF, 0x40,
+        0xDF, 0x43, 0xFE, 0x10, 0x00, 0xCF, 0x40, 0xDF, 0x40, 0xAF, 0x80, 0x00, 0xCF, 0x40, 0xDF, 0x40,
+        0x2F, 0xE1, 0x00, 0xCF, 0x40, 0xDF, 0x40, 0x09, 0xF9, 0x00, 0xCF, 0x40, 0xDF, 0x40, 0x02, 0xFF,
+        0x20, 0xCF, 0x40, 0xDF, 0x40, 0x00, 0x8F, 0xA0, 0xCF, 0x40, 0xDF, 0x40, 0x00, 0x1E, 0xF3, 0xCF,
+        0x40, 0xDF, 0x40, 0x00, 0x07, 0xFB, 0xCF, 0x40, 0xDF, 0x40, 0x00, 0x01, 0xEF, 0xEF, 0x40, 0xDF,
+        0x40, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0xDF, 0x40, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x0B,
+        0xF5, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x00, 0x00,
+        0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x05, 0xCE, 0xEB, 0x30,
+        0x00, 0xFF, 0x8F, 0xDB, 0xDF, 0xF3, 0x00, 0xFF, 0xE4, 0x00, 0x0A, 0xFA, 0x00, 0xFF, 0x60, 0x00,
+        0x02, 0xFE, 0x00, 0xFF, 0x20, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF,
+        0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF,
+        0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00,
+        0x00, 0xEF, 0x10, 0xDF, 0xF5, 0x00, 0x00, 0x00, 0xCF, 0x40, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0xCF,
+        0x40, 0xDF, 0xEF, 0x60, 0x00, 0x00, 0xCF, 0x40, 0xDF, 0x8F, 0xD1, 0x00, 0x00, 0xCF, 0x40, 0xDF,
+        0x4B, 0xF7, 0x00, 0x00, 0xCF, 0x40, 0xDF, 0x43, 0xFE, 0x10, 0x00, 0xCF, 0x40, 0xDF, 0x40, 0xAF,
+        0x80, 0x00, 0xCF, 0x40, 0xDF, 0x40, 0x2F, 0xE1, 0x00, 0xCF, 0x40, 0xDF, 0x40, 0x09, 0xF9, 0x00,
+        0xCF, 0x40, 0xDF, 0x40, 0x02, 0xFF, 0x20, 0xCF, 0x40, 0xDF, 0x40, 0x00, 0x8F, 0xA0, 0xCF, 0x40,
+        0xDF, 0x40, 0x00, 0x1E, 0xF3, 0xCF, 0x40, 0xDF, 0x40, 0x00, 0x07, 0xFB, 0xCF, 0x40, 0xDF, 0x40,
+        0x00, 0x01, 0xEF, 0xEF, 0x40, 0xDF, 0x40, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0xDF, 0x40, 0x00, 0x00,
+        0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x54, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0B, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x05, 0xCE, 0xEB, 0x30, 0x00, 0xFF, 0x8F, 0xDB, 0xDF,
+        0xF3, 0x00, 0xFF, 0xE4, 0x00, 0x0A, 0xFA, 0x00, 0xFF, 0x60, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x20,
+        0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10,
+        0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00,
+        0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x30, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x20, 0x00, 0x00,
+        0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x07, 0x50, 0x03,
+        0x71, 0x00, 0x00, 0x00, 0x04, 0xF6, 0x3E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF9, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF5, 0x00, 0x00, 0x00, 0xCF, 0x40, 0xDF,
+        0xFD, 0x00, 0x00, 0x00, 0xCF, 0x40, 0xDF, 0xEF, 0x60, 0x00, 0x00, 0xCF, 0x40, 0xDF, 0x8F, 0xD1,
+        0x00, 0x00, 0xCF, 0x40, 0xDF, 0x4B, 0xF7, 0x00, 0x00, 0xCF, 0x40, 0xDF, 0x43, 0xFE, 0x10, 0x00,
+        0xCF, 0x40, 0xDF, 0x40, 0xAF, 0x80, 0x00, 0xCF, 0x40, 0xDF, 0x40, 0x2F, 0xE1, 0x00, 0xCF, 0x40,
+        0xDF, 0x40, 0x09, 0xF9, 0x00, 0xCF, 0x40, 0xDF, 0x40, 0x02, 0xFF, 0x20, 0xCF, 0x40, 0xDF, 0x40,
+        0x00, 0x8F, 0xA0, 0xCF, 0x40, 0xDF, 0x40, 0x00, 0x1E, 0xF3, 0xCF, 0x40, 0xDF, 0x40, 0x00, 0x07,
+        0xFB, 0xCF, 0x40, 0xDF, 0x40, 0x00, 0x01, 0xEF, 0xEF, 0x40, 0xDF, 0x40, 0x00, 0x00, 0x6F, 0xFF,
+        0x40, 0xDF, 0x40, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x01, 0x20, 0x00, 0x02, 0x10, 0x00, 0x01, 0xE8,
+        0x00, 0x8E, 0x10, 0x00, 0x00, 0x5F, 0x54, 0xF5, 0x00, 0x00, 0x00, 0x0A, 0xEE, 0xA0, 0x00, 0x00,
+        0x00, 0x01, 0xBC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x05, 0xCE, 0xEB,
+        0x30, 0x00, 0xFF, 0x8F, 0xDB, 0xDF, 0xF3, 0x00, 0xFF, 0xE4, 0x00, 0x0A, 0xFA, 0x00, 0xFF, 0x60,
+        0x00, 0x02, 0xFE, 0x00, 0xFF, 0x20, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10,
+        0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00,
+        0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00,
+        0x00, 0x00, 0xEF, 0x10, 0x0E, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF5, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2F, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x9C, 0x05, 0xFA, 0x18, 0xDF, 0xD9, 0x10, 0x00, 0x05, 0xFA, 0xCE, 0xCB, 0xEF, 0xC0, 0x00, 0x05,
+        0xFF, 0xC2, 0x00, 0x2D, 0xF5, 0x00, 0x05, 0xFF, 0x20, 0x00, 0x07, 0xF9, 0x00, 0x05, 0xFC, 0x00,
+        0x00, 0x04, 0xFB, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x04,
+        0xFB, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x04, 0xFB, 0x00,
+        0x05, 0xFA, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x05, 0xFA,
+        0x00, 0x00, 0x04, 0xFB, 0xDF, 0x50, 0x5C, 0xEE, 0xC6, 0x00, 0x00, 0xDF, 0x59, 0xFF, 0xFF, 0xFF,
+        0x90, 0x00, 0xDF, 0xBF, 0x93, 0x13, 0xAF, 0xF4, 0x00, 0xDF, 0xF7, 0x00, 0x00, 0x0C, 0xFA, 0x00,
+        0xDF, 0xC0, 0x00, 0x00, 0x06, 0xFD, 0x00, 0xDF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x02, 0xFF, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0x02, 0xFF, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x02, 0xFF,
+        0x00, 0xDF, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xDF, 0x50, 0x00,
+        0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+        0xFD, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFD, 0x70, 0x00,
+        0xFF, 0x05, 0xCE, 0xEB, 0x30, 0x00, 0xFF, 0x8F, 0xDB, 0xDF, 0xF3, 0x00, 0xFF, 0xE4, 0x00, 0x0A,
+        0xFB, 0x00, 0xFF, 0x60, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x20, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00,
+        0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10,
+        0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00,
+        0xEF, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00,
+        0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0x99, 0xAE, 0xF8, 0x00, 0x00, 0x05, 0xFF, 0xFD, 0x80, 0x00,
+        0x00, 0x00, 0x48, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x6B, 0xEF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xDB, 0xCF, 0xFE, 0x50, 0x00,
+        0x01, 0xDF, 0xC3, 0x00, 0x01, 0x9F, 0xF4, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x08, 0xFE, 0x10,
+        0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x70, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0,
+        0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1,
+        0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0,
+        0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x70,
+        0x0A, 0xFC, 0x10, 0x00, 0x00, 0x08, 0xFE, 0x10, 0x01, 0xEF, 0xC3, 0x00, 0x01, 0x9F, 0xF5, 0x00,
+        0x00, 0x2C, 0xFF, 0xDB, 0xCF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x6B, 0xEF, 0xEC, 0x81, 0x00, 0x00,
+        0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x48, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00, 0x04, 0xEF,
+        0xDA, 0xBF, 0xFA, 0x00, 0x1E, 0xF8, 0x00, 0x03, 0xEF, 0x60, 0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xD0,
+        0xAF, 0x70, 0x00, 0x00, 0x1F, 0xF2, 0xBF, 0x50, 0x00, 0x00, 0x0E, 0xF3, 0xBF, 0x50, 0x00, 0x00,
+        0x0E, 0xF3, 0xAF, 0x70, 0x00, 0x00, 0x1F, 0xF2, 0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xD0, 0x1E, 0xF8,
+        0x00, 0x03, 0xEF, 0x60, 0x04, 0xEF, 0xDA, 0xBF, 0xFA, 0x00, 0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00,
+        0x00, 0x00, 0x8D, 0x42, 0x3A, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFE, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x24, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x6B, 0xEF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xDB, 0xCF, 0xFE, 0x50, 0x00,
+        0x01, 0xDF, 0xC3, 0x00, 0x01, 0x9F, 0xF4, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x08, 0xFE, 0x10,
+        0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x70, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0,
+        0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1,
+        0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0,
+        0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x70,
+        0x0A, 0xFC, 0x10, 0x00, 0x00, 0x08, 0xFE, 0x10, 0x01, 0xEF, 0xC3, 0x00, 0x01, 0x9F, 0xF5, 0x00,
+        0x00, 0x2C, 0xFF, 0xDB, 0xCF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x6B, 0xEF, 0xEC, 0x81, 0x00, 0x00,
+        0x00, 0x7D, 0x30, 0x18, 0xE0, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x46, 0x52,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+        0xDF, 0xEB, 0x50, 0x00, 0x04, 0xEF, 0xDA, 0xBF, 0xFA, 0x00, 0x1E, 0xF8, 0x00, 0x03, 0xEF, 0x60,
+        0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xD0, 0xAF, 0x70, 0x00, 0x00, 0x1F, 0xF2, 0xBF, 0x50, 0x00, 0x00,
+        0x0E, 0xF3, 0xBF, 0x50, 0x00, 0x00, 0x0E, 0xF3, 0xAF, 0x70, 0x00, 0x00, 0x1F, 0xF2, 0x6F, 0xD0,
+        0x00, 0x00, 0x6F, 0xD0, 0x1E, 0xF8, 0x00, 0x03, 0xEF, 0x60, 0x04, 0xEF, 0xDA, 0xBF, 0xFA, 0x00,
+        0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x52, 0xEC, 0x10, 0x00, 0x00, 0x00,
+        0x06, 0xF6, 0x0C, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x70, 0x5B, 0x30, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xEF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x2C,
+        0xFF, 0xDB, 0xCF, 0xFE, 0x50, 0x00, 0x01, 0xDF, 0xC3, 0x00, 0x01, 0x9F, 0xF4, 0x00, 0x0A, 0xFD,
+        0x10, 0x00, 0x00, 0x08, 0xFE, 0x10, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x70, 0x7F, 0xD0,
+        0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0xBF, 0x80,
+        0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0xAF, 0xA0,
+        0x00, 0x00, 0x00, 0x00, 0x5F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x2F, 0xF4,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0x70, 0x0A, 0xFC, 0x10, 0x00, 0x00, 0x08, 0xFE, 0x10, 0x01, 0xEF,
+        0xC3, 0x00, 0x01, 0x9F, 0xF5, 0x00, 0x00, 0x2C, 0xFF, 0xDB, 0xCF, 0xFE, 0x50, 0x00, 0x00, 0x00,
+        0x6B, 0xEF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x5F, 0x80, 0x00, 0x00, 0x7F, 0x41,
+        0xDC, 0x00, 0x00, 0x01, 0xEA, 0x07, 0xF3, 0x00, 0x00, 0x06, 0xD1, 0x1D, 0x70, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00, 0x04, 0xEF, 0xDA, 0xBF, 0xFA, 0x00,
+        0x1E, 0xF8, 0x00, 0x03, 0xEF, 0x60, 0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xD0, 0xAF, 0x70, 0x00, 0x00,
+        0x1F, 0xF2, 0xBF, 0x50, 0x00, 0x00, 0x0E, 0xF3, 0xBF, 0x50, 0x00, 0x00, 0x0E, 0xF3, 0xAF, 0x70,
+        0x00, 0x00, 0x1F, 0xF2, 0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xD0, 0x1E, 0xF8, 0x00, 0x03, 0xEF, 0x60,
+        0x04, 0xEF, 0xDA, 0xBF, 0xFA, 0x00, 0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00, 0x00, 0x00, 0x17, 0xAD,
+        0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x18, 0xFF, 0xFE, 0xDC, 0xCF, 0xFC, 0xCC, 0xCC,
+        0xCC, 0xB0, 0x01, 0xCF, 0xF8, 0x20, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFE, 0x30,
+        0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF5, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
+        0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xA0,
+        0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+        0xFF, 0xFF, 0xFF, 0x90, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0xCC, 0xCC, 0xCC, 0x70, 0xAF,
+        0xA0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F,
+        0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF5, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+        0x09, 0xFE, 0x30, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xF8, 0x20, 0x00,
+        0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFE, 0xDC, 0xCF, 0xFC, 0xCC, 0xCC, 0xCC,
+        0xC1, 0x00, 0x00, 0x17, 0xAD, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x29, 0xDF, 0xEB,
+        0x50, 0x01, 0x7C, 0xEE, 0xC7, 0x10, 0x00, 0x04, 0xEF, 0xDA, 0xBF, 0xF8, 0x2D, 0xFE, 0xBB, 0xEF,
+        0xC1, 0x00, 0x1E, 0xF8, 0x00, 0x03, 0xEF, 0xEF, 0x81, 0x00, 0x1A, 0xF9, 0x00, 0x6F, 0xD0, 0x00,
+        0x00, 0x6F, 0xFC, 0x00, 0x00, 0x01, 0xEF, 0x10, 0xAF, 0x70, 0x00, 0x00, 0x1F, 0xF7, 0x00, 0x00,
+        0x00, 0xBF, 0x40, 0xBF, 0x50, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0xBF, 0x50,
+        0x00, 0x00, 0x0E, 0xFA, 0x88, 0x88, 0x88, 0x88, 0x30, 0xAF, 0x70, 0x00, 0x00, 0x1F, 0xF7, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+        0xF8, 0x00, 0x03, 0xEF, 0xEF, 0xA1, 0x00, 0x00, 0x27, 0x00, 0x04, 0xEF, 0xDA, 0xBF, 0xF9, 0x2D,
+        0xFE, 0xCA, 0xBD, 0xFD, 0x00, 0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00, 0x7B, 0xEF, 0xEC, 0x83, 0x00,
+        0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x02,
+        0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xDA,
+        0x40, 0x00, 0x00, 0xDF, 0xCB, 0xBC, 0xEF, 0xF7, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x1A, 0xFF, 0x20,
+        0x00, 0xDF, 0x50, 0x00, 0x01, 0xFF, 0x60, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xCF, 0x70, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0xDF, 0x60, 0x00, 0xDF, 0x50, 0x00, 0x02, 0xFF, 0x20, 0x00, 0xDF, 0x50, 0x01,
+        0x4D, 0xF6, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xDF, 0xCB, 0xBC, 0xFF, 0xE2,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x2D, 0xFC, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x03, 0xFF, 0x60, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0x9F, 0xD0, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x1E, 0xF6, 0x00, 0xDF, 0x50,
+        0x00, 0x00, 0x07, 0xFD, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x01, 0xEF, 0x60, 0x00, 0x00, 0x0B, 0xF5,
+        0x00, 0x00, 0x9F, 0x50, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xFF, 0x05, 0xCE, 0xF0, 0xFF, 0x8F, 0xDB, 0xD1, 0xFF, 0xE4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+        0xFF, 0x20, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+        0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+        0xDF, 0xFF, 0xFF, 0xDA, 0x40, 0x00, 0x00, 0xDF, 0xCB, 0xBC, 0xEF, 0xF7, 0x00, 0x00, 0xDF, 0x50,
+        0x00, 0x1A, 0xFF, 0x20, 0x00, 0xDF, 0x50, 0x00, 0x01, 0xFF, 0x60, 0x00, 0xDF, 0x50, 0x00, 0x00,
+        0xCF, 0x70, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x60, 0x00, 0xDF, 0x50, 0x00, 0x02, 0xFF, 0x20,
+        0x00, 0xDF, 0x50, 0x01, 0x4D, 0xF6, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xDF,
+        0xCB, 0xBC, 0xFF, 0xE2, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x2D, 0xFC, 0x00, 0x00, 0xDF, 0x50, 0x00,
+        0x03, 0xFF, 0x60, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x9F, 0xD0, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x1E,
+        0xF6, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x07, 0xFD, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x01, 0xEF, 0x60,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x70,
+        0x00, 0x00, 0x00, 0x0F, 0xF0, 0x5C, 0xEF, 0x00, 0x0F, 0xF8, 0xFD, 0xBD, 0x10, 0x0F, 0xFE, 0x40,
+        0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+        0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+        0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x04, 0x52, 0x00, 0x00, 0x00, 0x0E, 0xF2, 0x00, 0x00, 0x00, 0x3F, 0x90,
+        0x00, 0x00, 0x00, 0x7E, 0x10, 0x00, 0x00, 0x00, 0x02, 0x72, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00,
+        0x8E, 0x37, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xDA, 0x40, 0x00, 0x00, 0xDF, 0xCB, 0xBC, 0xEF, 0xF7,
+        0x00, 0x00, 0xDF, 0x50, 0x00, 0x1A, 0xFF, 0x20, 0x00, 0xDF, 0x50, 0x00, 0x01, 0xFF, 0x60, 0x00,
+        0xDF, 0x50, 0x00, 0x00, 0xCF, 0x70, 0x00, 0xDF, 0x50, 0x00, 0x00, 0xDF, 0x60, 0x00, 0xDF, 0x50,
+        0x00, 0x02, 0xFF, 0x20, 0x00, 0xDF, 0x50, 0x01, 0x4D, 0xF6, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF,
+        0x40, 0x00, 0x00, 0xDF, 0xCB, 0xBC, 0xFF, 0xE2, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x2D, 0xFC, 0x00,
+        0x00, 0xDF, 0x50, 0x00, 0x03, 0xFF, 0x60, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x9F, 0xD0, 0x00, 0xDF,
+        0x50, 0x00, 0x00, 0x1E, 0xF6, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x07, 0xFD, 0x00, 0xDF, 0x50, 0x00,
+        0x00, 0x01, 0xEF, 0x60, 0x5F, 0x40, 0x0A, 0xD1, 0x0A, 0xD1, 0x6F, 0x40, 0x01, 0xEC, 0xE8, 0x00,
+        0x00, 0x5F, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x05, 0xCE, 0xF0, 0xFF, 0x8F, 0xDB, 0xD1,
+        0xFF, 0xE4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+        0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+        0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x30, 0x00, 0x00, 0x00,
+        0x09, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x39, 0xDE, 0xED, 0xB8, 0x30, 0x06, 0xFF, 0xEC, 0xBC, 0xFF, 0xC0, 0x2F, 0xF8, 0x10, 0x00,
+        0x15, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE2,
+        0x00, 0x00, 0x00, 0x00, 0x1E, 0xFE, 0xA6, 0x30, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0xFF, 0xB4, 0x00,
+        0x00, 0x03, 0x7A, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x03, 0xAF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+        0x0C, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x7A, 0x40,
+        0x00, 0x01, 0x7F, 0xF4, 0x7F, 0xFE, 0xCB, 0xCE, 0xFF, 0x80, 0x14, 0x9C, 0xDF, 0xED, 0x93, 0x00,
+        0x00, 0x00, 0x00, 0x48, 0x50, 0x00, 0x00, 0x02, 0xED, 0x10, 0x00, 0x00, 0x0C, 0xE2, 0x00, 0x00,
+        0x00, 0x8F, 0x40, 0x00, 0x00, 0x01, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9D,
+        0xEE, 0xDB, 0x50, 0x2E, 0xFD, 0xAA, 0xBE, 0xB0, 0x9F, 0x80, 0x00, 0x01, 0x30, 0xAF, 0x40, 0x00,
+        0x00, 0x00, 0x7F, 0xC4, 0x10, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x83, 0x00, 0x00, 0x38, 0xBE, 0xFF,
+        0x80, 0x00, 0x00, 0x00, 0x5F, 0xF3, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x62, 0x00, 0x00, 0x1D, 0xF3,
+        0xCF, 0xDA, 0x9B, 0xEF, 0xA0, 0x49, 0xCE, 0xFD, 0xB5, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00,
+        0x00, 0x05, 0xF6, 0x4E, 0x70, 0x00, 0x00, 0x07, 0x40, 0x03, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x39, 0xDE, 0xED, 0xB8, 0x30, 0x06, 0xFF, 0xEC, 0xBC, 0xFF, 0xC0, 0x2F, 0xF8,
+        0x10, 0x00, 0x15, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x00,
+        0x6F, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFE, 0xA6, 0x30, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0xFF,
+        0xB4, 0x00, 0x00, 0x03, 0x7A, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x03, 0xAF, 0xF5, 0x00, 0x00,
+        0x00, 0x00, 0x0C, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9,
+        0x7A, 0x40, 0x00, 0x01, 0x7F, 0xF4, 0x7F, 0xFE, 0xCB, 0xCE, 0xFF, 0x80, 0x14, 0x9C, 0xDF, 0xED,
+        0x93, 0x00, 0x00, 0x01, 0x76, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x3F, 0x7A, 0xE1,
+        0x00, 0x00, 0xDB, 0x01, 0xDA, 0x00, 0x03, 0x71, 0x00, 0x37, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x9D, 0xEE, 0xDB, 0x50, 0x2E, 0xFD, 0xAA, 0xBE, 0xB0, 0x9F, 0x80, 0x00, 0x01, 0x30, 0xAF,
+        0x40, 0x00, 0x00, 0x00, 0x7F, 0xC4, 0x10, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x83, 0x00, 0x00, 0x38,
+        0xBE, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5F, 0xF3, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x62, 0x00, 0x00,
+        0x1D, 0xF3, 0xCF, 0xDA, 0x9B, 0xEF, 0xA0, 0x49, 0xCE, 0xFD, 0xB5, 0x00, 0x00, 0x39, 0xDE, 0xED,
+        0xB8, 0x30, 0x06, 0xFF, 0xEC, 0xBC, 0xFF, 0xC0, 0x2F, 0xF8, 0x10, 0x00, 0x15, 0x80, 0x7F, 0xC0,
+        0x00, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE2, 0x00, 0x00, 0x00, 0x00,
+        0x1E, 0xFE, 0xA6, 0x30, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x03, 0x7A, 0xEF,
+        0xFF, 0x90, 0x00, 0x00, 0x00, 0x03, 0xAF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF9, 0x00, 0x00,
+        0x00, 0x00, 0x09, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x7A, 0x40, 0x00, 0x01, 0x7F, 0xF4,
+        0x7F, 0xFE, 0xCB, 0xCE, 0xFF, 0x80, 0x14, 0x9C, 0xDF, 0xFD, 0x93, 0x00, 0x00, 0x00, 0x00, 0xD7,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x03, 0x65, 0xCE, 0x00, 0x00, 0x00, 0x04,
+        0xEF, 0xD5, 0x00, 0x00, 0x02, 0x9D, 0xEE, 0xDB, 0x50, 0x2E, 0xFD, 0xAA, 0xBE, 0xB0, 0x9F, 0x80,
+        0x00, 0x01, 0x30, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xC4, 0x10, 0x00, 0x00, 0x0B, 0xFF, 0xFC,
+        0x83, 0x00, 0x00, 0x38, 0xBE, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5F, 0xF3, 0x00, 0x00, 0x00, 0x0B,
+        0xF5, 0x62, 0x00, 0x00, 0x1D, 0xF3, 0xCF, 0xDA, 0x9B, 0xEF, 0xA0, 0x49, 0xCE, 0xFF, 0xB5, 0x00,
+        0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x55, 0x6E, 0xB0, 0x00, 0x00,
+        0x8E, 0xFC, 0x30, 0x00, 0x00, 0x1C, 0xB1, 0x1B, 0xC1, 0x00, 0x00, 0x01, 0xDB, 0xBD, 0x10, 0x00,
+        0x00, 0x00, 0x28, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xDE, 0xED,
+        0xB8, 0x30, 0x06, 0xFF, 0xEC, 0xBC, 0xFF, 0xC0, 0x2F, 0xF8, 0x10, 0x00, 0x15, 0x80, 0x7F, 0xC0,
+        0x00, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE2, 0x00, 0x00, 0x00, 0x00,
+        0x1E, 0xFE, 0xA6, 0x30, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x03, 0x7A, 0xEF,
+        0xFF, 0x90, 0x00, 0x00, 0x00, 0x03, 0xAF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF9, 0x00, 0x00,
+        0x00, 0x00, 0x09, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x7A, 0x40, 0x00, 0x01, 0x7F, 0xF4,
+        0x7F, 0xFE, 0xCB, 0xCE, 0xFF, 0x80, 0x14, 0x9C, 0xDF, 0xED, 0x93, 0x00, 0x02, 0x82, 0x00, 0x28,
+        0x20, 0x00, 0xCB, 0x00, 0xCB, 0x00, 0x00, 0x3F, 0x89, 0xE2, 0x00, 0x00, 0x07, 0xFF, 0x60, 0x00,
+        0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9D, 0xEE, 0xDB, 0x50, 0x2E,
+        0xFD, 0xAA, 0xBE, 0xB0, 0x9F, 0x80, 0x00, 0x01, 0x30, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xC4,
+        0x10, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x83, 0x00, 0x00, 0x38, 0xBE, 0xFF, 0x80, 0x00, 0x00, 0x00,
+        0x5F, 0xF3, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x62, 0x00, 0x00, 0x1D, 0xF3, 0xCF, 0xDA, 0x9B, 0xEF,
+        0xA0, 0x49, 0xCE, 0xFD, 0xB5, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1C, 0xCC,
+        0xCC, 0xDF, 0xEC, 0xCC, 0xCC, 0x60, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x58, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0D, 0xFE, 0xA1, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00,
+        0x00, 0xEF, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0x10, 0x38, 0xFF, 0x88, 0x88, 0x10, 0x00,
+        0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF,
+        0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x10,
+        0x00, 0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x8F, 0xEA, 0x99, 0x10, 0x00, 0x08, 0xDF, 0xFF,
+        0x10, 0x00, 0x00, 0x0C, 0x70, 0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x26, 0x5A, 0xF2, 0x00,
+        0x00, 0x2D, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x27, 0x20, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0A,
+        0xD2, 0x8E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1C, 0xCC, 0xCC,
+        0xDF, 0xEC, 0xCC, 0xCC, 0x60, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x10, 0x00, 0x00, 0x03, 0xFB, 0x00, 0x00,
+        0x99, 0x06, 0xF6, 0x00, 0x00, 0xEF, 0x08, 0xE2, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x6F, 0xFF,
+        0xFF, 0xFF, 0x10, 0x38, 0xFF, 0x88, 0x88, 0x10, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00,
+        0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00,
+        0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0x00, 0xCF, 0x30, 0x00, 0x00,
+        0x00, 0x8F, 0xEA, 0x99, 0x10, 0x00, 0x08, 0xDF, 0xFF, 0x10, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x80, 0x1C, 0xCC, 0xCC, 0xDF, 0xEC, 0xCC, 0xCC, 0x60, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCC, 0xDF, 0xEC, 0xC8,
+        0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00,
+        0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0x10, 0x38, 0xFF,
+        0x88, 0x88, 0x10, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x12, 0xEF, 0x22, 0x22, 0x00, 0x6F, 0xFF, 0xFF,
+        0xFF, 0x10, 0x25, 0xFF, 0x55, 0x55, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00,
+        0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0x99, 0x10,
+        0x00, 0x07, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC6,
+        0x1D, 0x80, 0x00, 0x00, 0x05, 0xF4, 0x8E, 0xFD, 0x20, 0x00, 0x00, 0x01, 0x30, 0x00, 0x31, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F,
+        0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00,
+        0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00,
+        0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3,
+        0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF2,
+        0x00, 0x00, 0x00, 0x1F, 0xF2, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0x0A, 0xFA, 0x00, 0x00,
+        0x00, 0x8F, 0xC0, 0x03, 0xFF, 0x60, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x6F, 0xFE, 0xBB, 0xDF, 0xF8,
+        0x00, 0x00, 0x03, 0x9D, 0xEF, 0xDA, 0x40, 0x00, 0x00, 0x1B, 0xEC, 0x53, 0xF6, 0x00, 0x00, 0x7E,
+        0x6B, 0xFF, 0xD1, 0x00, 0x00, 0x23, 0x00, 0x23, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00,
+        0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0,
+        0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0,
+        0x0F, 0xF1, 0x00, 0x00, 0x7F, 0xE0, 0x0B, 0xF9, 0x00, 0x04, 0xEF, 0xE0, 0x04, 0xFF, 0xDB, 0xDF,
+        0x7F, 0xE0, 0x00, 0x4B, 0xEE, 0xC5, 0x0F, 0xE0, 0x00, 0x01, 0x88, 0x88, 0x88, 0x20, 0x00, 0x00,
+        0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00,
+        0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3,
+        0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1,
+        0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00,
+        0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF2, 0x00, 0x00, 0x00, 0x1F,
+        0xF2, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0x8F, 0xC0, 0x03,
+        0xFF, 0x60, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x6F, 0xFE, 0xBB, 0xDF, 0xF8, 0x00, 0x00, 0x03, 0x9D,
+        0xEF, 0xDA, 0x40, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x28, 0x88, 0x88, 0x81, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
+        0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0,
+        0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0,
+        0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xF1, 0x00, 0x00,
+        0x7F, 0xE0, 0x0B, 0xF9, 0x00, 0x04, 0xEF, 0xE0, 0x04, 0xFF, 0xDB, 0xDF, 0x7F, 0xE0, 0x00, 0x4B,
+        0xEE, 0xC5, 0x0F, 0xE0, 0x00, 0x02, 0xF7, 0x22, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF9,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1,
+        0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00,
+        0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F,
+        0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F,
+        0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF2, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0x0E, 0xF4, 0x00,
+        0x00, 0x00, 0x3F, 0xF1, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0x8F, 0xC0, 0x03, 0xFF, 0x60, 0x00, 0x05,
+        0xFF, 0x50, 0x00, 0x6F, 0xFE, 0xBB, 0xDF, 0xF8, 0x00, 0x00, 0x03, 0x9D, 0xEF, 0xDA, 0x40, 0x00,
+        0x00, 0x5E, 0x40, 0x16, 0xF2, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x46, 0x63,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
+        0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0,
+        0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00,
+        0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xF1,
+        0x00, 0x00, 0x7F, 0xE0, 0x0B, 0xF9, 0x00, 0x04, 0xEF, 0xE0, 0x04, 0xFF, 0xDB, 0xDF, 0x7F, 0xE0,
+        0x00, 0x4B, 0xEE, 0xC5, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+        0xEE, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x55, 0xDA, 0x00, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x5E,
+        0x00, 0x00, 0x00, 0x00, 0xAC, 0x21, 0xBD, 0x00, 0x00, 0x1F, 0xF1, 0x2E, 0xFF, 0xE4, 0x0F, 0xF3,
+        0x1F, 0xF1, 0x01, 0x56, 0x20, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1,
+        0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00,
+        0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F,
+        0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F,
+        0xF2, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0x0A, 0xFA, 0x00,
+        0x00, 0x00, 0x8F, 0xC0, 0x03, 0xFF, 0x60, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x6F, 0xFE, 0xBB, 0xDF,
+        0xF8, 0x00, 0x00, 0x03, 0x9D, 0xEF, 0xDA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0xBF, 0xE8, 0x00, 0x00, 0x00, 0x0C, 0xC4, 0x6E, 0x70, 0x00, 0x00, 0x1F, 0x40, 0x09, 0xB0,
+        0x00, 0x00, 0x0D, 0xA2, 0x3D, 0x80, 0x00, 0x00, 0x03, 0xDF, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x03,
+        0x20, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F,
+        0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F,
+        0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xD0, 0x00,
+        0x00, 0x2F, 0xE0, 0x0F, 0xF1, 0x00, 0x00, 0x7F, 0xE0, 0x0B, 0xF9, 0x00, 0x04, 0xEF, 0xE0, 0x04,
+        0xFF, 0xDB, 0xDF, 0x7F, 0xE0, 0x00, 0x4B, 0xEE, 0xC5, 0x0F, 0xE0, 0x00, 0x00, 0x04, 0xFA, 0x0A,
+        0xF4, 0x00, 0x00, 0x00, 0x1E, 0xB0, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x8B, 0x11, 0xB7, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1,
+        0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00,
+        0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F,
+        0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F,
+        0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF2, 0x00,
+        0x00, 0x00, 0x1F, 0xF2, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0x0A, 0xFA, 0x00, 0x00, 0x00,
+        0x8F, 0xC0, 0x03, 0xFF, 0x60, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x6F, 0xFE, 0xBB, 0xDF, 0xF8, 0x00,
+        0x00, 0x03, 0x9D, 0xEF, 0xDA, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xE1, 0x3F, 0xA0, 0x00, 0x00, 0x4F,
+        0x60, 0xBE, 0x10, 0x00, 0x00, 0xCC, 0x05, 0xF5, 0x00, 0x00, 0x04, 0xE3, 0x0C, 0x90, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F,
+        0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00,
+        0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x2F,
+        0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xF1, 0x00, 0x00, 0x7F, 0xE0, 0x0B, 0xF9, 0x00, 0x04, 0xEF,
+        0xE0, 0x04, 0xFF, 0xDB, 0xDF, 0x7F, 0xE0, 0x00, 0x4B, 0xEE, 0xC5, 0x0F, 0xE0, 0x1F, 0xF1, 0x00,
+        0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00,
+        0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3,
+        0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1,
+        0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x1F, 0xF1, 0x00, 0x00,
+        0x00, 0x0F, 0xF3, 0x1F, 0xF2, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x3F,
+        0xF1, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0x8F, 0xC0, 0x03, 0xFF, 0x60, 0x00, 0x05, 0xFF, 0x50, 0x00,
+        0x6F, 0xFE, 0xBB, 0xDF, 0xF8, 0x00, 0x00, 0x03, 0x9D, 0xFF, 0xDA, 0x40, 0x00, 0x00, 0x00, 0x03,
+        0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xE6, 0x62,
+        0x00, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xE3, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
+        0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xD0,
+        0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00,
+        0x0F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0,
+        0x00, 0x0F, 0xF1, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xF9, 0x00, 0x04, 0xEF, 0xE0, 0x00, 0x04,
+        0xFF, 0xDB, 0xDF, 0x7F, 0xE0, 0x00, 0x00, 0x4B, 0xEE, 0xC5, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+        0x75, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xEE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x7A, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xE8, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF1, 0x00, 0x00, 0x07, 0xFF, 0x30, 0x00, 0x00, 0x4F, 0xE0,
+        0x0D, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x70, 0x00, 0x00, 0x8F, 0xA0, 0x0A, 0xF8, 0x00, 0x00, 0x0E,
+        0xCF, 0xB0, 0x00, 0x00, 0xCF, 0x60, 0x06, 0xFC, 0x00, 0x00, 0x3F, 0x8C, 0xE0, 0x00, 0x01, 0xFF,
+        0x20, 0x02, 0xFF, 0x10, 0x00, 0x7F, 0x58, 0xF3, 0x00, 0x04, 0xFD, 0x00, 0x00, 0xDF, 0x40, 0x00,
+        0xBF, 0x14, 0xF7, 0x00, 0x08, 0xFA, 0x00, 0x00, 0xAF, 0x80, 0x00, 0xEC, 0x01, 0xFB, 0x00, 0x0C,
+        0xF6, 0x00, 0x00, 0x6F, 0xC0, 0x03, 0xF9, 0x00, 0xCE, 0x00, 0x1F, 0xF2, 0x00, 0x00, 0x2F, 0xF1,
+        0x07, 0xF5, 0x00, 0x8F, 0x30, 0x4F, 0xD0, 0x00, 0x00, 0x0D, 0xF4, 0x0B, 0xF1, 0x00, 0x5F, 0x70,
+        0x8F, 0xA0, 0x00, 0x00, 0x0A, 0xF8, 0x0E, 0xC0, 0x00, 0x1F, 0xB0, 0xCF, 0x60, 0x00, 0x00, 0x06,
+        0xFC, 0x3F, 0x90, 0x00, 0x0C, 0xE1, 0xFF, 0x20, 0x00, 0x00, 0x02, 0xFF, 0x8F, 0x50, 0x00, 0x09,
+        0xF7, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xEF, 0x10, 0x00, 0x05, 0xFE, 0xF9, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00,
+        0x00, 0xDF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x1D, 0xBB, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x11, 0xDA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0x82, 0x00, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0E, 0xF1, 0x00, 0x05, 0xFF, 0x40, 0x00, 0x1F, 0xE0, 0x0A, 0xF5, 0x00, 0x09, 0xFF,
+        0x80, 0x00, 0x5F, 0xA0, 0x06, 0xF8, 0x00, 0x0C, 0xEE, 0xC0, 0x00, 0x8F, 0x60, 0x02, 0xFC, 0x00,
+        0x1F, 0xAA, 0xF1, 0x00, 0xCF, 0x20, 0x00, 0xDF, 0x10, 0x5F, 0x66, 0xF5, 0x01, 0xFD, 0x00, 0x00,
+        0xAF, 0x50, 0x9F, 0x22, 0xF9, 0x05, 0xF9, 0x00, 0x00, 0x6F, 0x90, 0xDD, 0x00, 0xDD, 0x09, 0xF5,
+        0x00, 0x00, 0x2F, 0xD2, 0xF9, 0x00, 0x9F, 0x2D, 0xF1, 0x00, 0x00, 0x0D, 0xF8, 0xF5, 0x00, 0x5F,
+        0x8F, 0xD0, 0x00, 0x00, 0x09, 0xFF, 0xF1, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x05, 0xFF, 0xC0,
+        0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0xAF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF5, 0xCC, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x3F, 0x60, 0x1D, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9,
+        0x00, 0x00, 0x00, 0x03, 0xFF, 0x30, 0x01, 0xEF, 0x40, 0x00, 0x00, 0x0C, 0xF7, 0x00, 0x00, 0x5F,
+        0xE1, 0x00, 0x00, 0x8F, 0xC0, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x03, 0xFE, 0x20, 0x00, 0x00, 0x01,
+        0xEF, 0x50, 0x0D, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE1, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00,
+        0x0A, 0xFC, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x03, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x4E,
+        0x90, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x66, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xEF, 0x20, 0x0B,
+        0xF6, 0x00, 0x00, 0x05, 0xFB, 0x00, 0x04, 0xFC, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0xDF, 0x30,
+        0x00, 0x3F, 0xD0, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x9F, 0x70, 0x00, 0x00, 0x1E, 0xE1, 0x01, 0xEF,
+        0x10, 0x00, 0x00, 0x09, 0xF7, 0x06, 0xFA, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x0D, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0xBF, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+        0x0D, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF2,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB0, 0x00, 0x00, 0x00, 0x02, 0x9B, 0xFF, 0x30, 0x00, 0x00,
+        0x00, 0x04, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x10, 0x02, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x7F, 0xB0, 0x4F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB0, 0x4F, 0xE0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x30,
+        0x01, 0xEF, 0x40, 0x00, 0x00, 0x0C, 0xF7, 0x00, 0x00, 0x5F, 0xE1, 0x00, 0x00, 0x8F, 0xC0, 0x00,
+        0x00, 0x0A, 0xFA, 0x00, 0x03, 0xFE, 0x20, 0x00, 0x00, 0x01, 0xEF, 0x50, 0x0D, 0xF7, 0x00, 0x00,
+        0x00, 0x00, 0x5F, 0xE1, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFC, 0xFE, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xEF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEA, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+        0x09, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE3, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xF8, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0xCF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x7F, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2E, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x05, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFE, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x10,
+        0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0x50, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x06, 0x88, 0x88, 0x88,
+        0xEF, 0x90, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x5F, 0xE3, 0x00, 0x00, 0x00,
+        0x03, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x2D, 0xF6, 0x00, 0x00, 0x00, 0x01, 0xCF, 0x90, 0x00, 0x00,
+        0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xC1, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x20, 0x00,
+        0x00, 0x00, 0x1F, 0xFB, 0x88, 0x88, 0x88, 0x50, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+        0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x09, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0xFC, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x7F, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2E, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0xDF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+        0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFE,
+        0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x10, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+        0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x27, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x06, 0x88, 0x88, 0x88,
+        0xEF, 0x90, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x5F, 0xE3, 0x00, 0x00, 0x00,
+        0x03, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x2D, 0xF6, 0x00, 0x00, 0x00, 0x01, 0xCF, 0x90, 0x00, 0x00,
+        0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xC1, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x20, 0x00,
+        0x00, 0x00, 0x1F, 0xFB, 0x88, 0x88, 0x88, 0x50, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+        0x5F, 0x40, 0x3E, 0x60, 0x00, 0x00, 0x00, 0x00, 0x09, 0xE4, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xCF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x09, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0xFC, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x7F, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2E, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0xDF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+        0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFE,
+        0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x10, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x5F,
+        0x40, 0x0A, 0xD1, 0x00, 0x00, 0x0A, 0xD1, 0x6F, 0x40, 0x00, 0x00, 0x01, 0xEC, 0xE8, 0x00, 0x00,
+        0x00, 0x00, 0x5F, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x90, 0x06, 0x88, 0x88, 0x88, 0xEF, 0x90, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x20, 0x00, 0x00,
+        0x00, 0x5F, 0xE3, 0x00, 0x00, 0x00, 0x03, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x2D, 0xF6, 0x00, 0x00,
+        0x00, 0x01, 0xCF, 0x90, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xC1, 0x00,
+        0x00, 0x00, 0x06, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0x88, 0x88, 0x88, 0x50, 0x1F, 0xFF,
+        0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x05, 0xCE, 0xFF, 0x30, 0x00, 0x3F, 0xFB, 0x99, 0x20, 0x00, 0x7F,
+        0x90, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x8F, 0xFF, 0x60, 0x00, 0x00, 0x48, 0xCF, 0x60,
+        0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00,
+        0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00,
+        0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00,
+        0x9F, 0x60, 0x00, 0x00, 0x78, 0x88, 0x88, 0x88, 0x70, 0xEF, 0xFF, 0xFF, 0xFF, 0xE0, 0x78, 0x88,
+        0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFE, 0x00, 0xAD, 0x00, 0x03, 0xF9, 0x00, 0x0A, 0xF5, 0x00, 0x1F, 0xF2, 0x00, 0x2F, 0xF2,
+        0x00, 0x02, 0x20, 0x00, 0x03, 0xFF, 0x10, 0x03, 0xFF, 0x10, 0x07, 0xF9, 0x00, 0x0B, 0xE1, 0x00,
+        0x0D, 0x70, 0x00, 0x00, 0xAD, 0x00, 0x3F, 0x40, 0x03, 0xF9, 0x00, 0xBF, 0x10, 0x0A, 0xF5, 0x04,
+        0xFB, 0x00, 0x1F, 0xF2, 0x0A, 0xF8, 0x00, 0x2F, 0xF2, 0x0B, 0xF8, 0x00, 0x02, 0x20, 0x01, 0x21,
+        0x00, 0x04, 0xFF, 0x00, 0xDF, 0x60, 0x04, 0xFF, 0x00, 0xDF, 0x60, 0x07, 0xFA, 0x01, 0xFE, 0x10,
+        0x0A, 0xF2, 0x04, 0xF8, 0x00, 0x0E, 0x90, 0x08, 0xE1, 0x00, 0x02, 0x10, 0x01, 0x10, 0x00, 0x5A,
+        0x80, 0x00, 0x01, 0xAA, 0x10, 0x00, 0x08, 0xA5, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x0C,
+        0xF7, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x0C, 0xF7,
+};
+
+static const FontGlyph glyphs[] = {
+        {0x0020, 0, 0, 0, 0, 7, 0},
+        {0x0021, 3, 16, 3, 16, 9, 0},
+        {0x0022, 6, 6, 2, 16, 10, 32},
+        {0x0023, 16, 16, 1, 16, 18, 50},
+        {0x0024, 12, 19, 1, 16, 14, 178},
+        {0x0025, 19, 16, 1, 16, 21, 292},
+        {0x0026, 16, 16, 1, 16, 17, 452},
+        {0x0027, 2, 6, 2, 16, 6, 580},
+        {0x0028, 6, 19, 1, 16, 9, 586},
+        {0x0029, 6, 19, 1, 16, 9, 643},
+        {0x002A, 11, 10, 0, 16, 11, 700},
+        {0x002B, 15, 14, 2, 14, 18, 760},
+        {0x002C, 4, 6, 1, 4, 7, 872},
+        {0x002D, 6, 2, 1, 7, 8, 884},
+        {0x002E, 3, 3, 2, 3, 7, 890},
+        {0x002F, 8, 18, 0, 16, 7, 896},
+        {0x0030, 12, 16, 1, 16, 14, 968},
+        {0x0031, 10, 16, 2, 16, 14, 1064},
+        {0x0032, 11, 16, 1, 16, 14, 1144},
+        {0x0033, 12, 16, 1, 16, 14, 1240},
+        {0x0034, 12, 16, 1, 16, 14, 1336},
+        {0x0035, 12, 16, 1, 16, 14, 1432},
+        {0x0036, 12, 16, 1, 16, 14, 1528},
+        {0x0037, 12, 16, 1, 16, 14, 1624},
+        {0x0038, 12, 16, 1, 16, 14, 1720},
+        {0x0039, 12, 16, 1, 16, 14, 1816},
+        {0x003A, 3, 11, 2, 11, 7, 1912},
+        {0x003B, 4, 14, 1, 12, 7, 1934},
+        {0x003C, 15, 13, 2, 13, 18, 1962},
+        {0x003D, 15, 6, 2, 10, 18, 2066},
+        {0x003E, 15, 13, 2, 13, 18, 2114},
+        {0x003F, 10, 16, 1, 16, 12, 2218},
+        {0x0040, 20, 20, 1, 16, 22, 2298},
+        {0x0041, 15, 16, 0, 16, 15, 2498},
+        {0x0042, 12, 16, 2, 16, 15, 2626},
+        {0x0043, 14, 16, 1, 16, 15, 2722},
+        {0x0044, 14, 16, 2, 16, 17, 2834},
+        {0x0045, 11, 16, 2, 16, 14, 2946},
+        {0x0046, 10, 16, 2, 16, 13, 3042},
+        {0x0047, 15, 16, 1, 16, 17, 3122},
+        {0x0048, 13, 16, 2, 16, 17, 3250},
+        {0x0049, 3, 16, 2, 16, 6, 3362},
+        {0x004A, 7, 20, -2, 16, 6, 3394},
+        {0x004B, 13, 16, 2, 16, 14, 3474},
+        {0x004C, 11, 16, 2, 16, 12, 3586},
+        {0x004D, 15, 16, 2, 16, 19, 3682},
+        {0x004E, 13, 16, 2, 16, 16, 3810},
+        {0x004F, 16, 16, 1, 16, 17, 3922},
+        {0x0050, 11, 16, 2, 16, 13, 4050},
+        {0x0051, 16, 19, 1, 16, 17, 4146},
+        {0x0052, 13, 16, 2, 16, 15, 4298},
+        {0x0053, 12, 16, 1, 16, 14, 4410},
+        {0x0054, 15, 16, -1, 16, 13, 4506},
+        {0x0055, 14, 16, 1, 16, 16, 4634},
+        {0x0056, 15, 16, 0, 16, 15, 4746},
+        {0x0057, 22, 16, 0, 16, 22, 4874},
+        {0x0058, 15, 16, 0, 16, 15, 5050},
+        {0x0059, 15, 16, -1, 16, 13, 5178},
+        {0x005A, 15, 16, 0, 16, 15, 5306},
+        {0x005B, 6, 19, 1, 16, 9, 5434},
+        {0x005C, 8, 18, 0, 16, 7, 5491},
+        {0x005D, 5, 19, 2, 16, 9, 5563},
+        {0x005E, 15, 6, 2, 16, 18, 5620},
+        {0x005F, 13, 3, -1, -3, 11, 5668},
+        {0x0060, 6, 4, 1, 17, 11, 5689},
+        {0x0061, 11, 12, 1, 12, 13, 5701},
+        {0x0062, 11, 16, 2, 16, 14, 5773},
+        {0x0063, 10, 12, 1, 12, 12, 5869},
+        {0x0064, 11, 16, 1, 16, 14, 5929},
+        {0x0065, 12, 12, 1, 12, 14, 6025},
+        {0x0066, 9, 16, 0, 16, 8, 6097},
+        {0x0067, 11, 16, 1, 12, 14, 6177},
+        {0x0068, 11, 16, 2, 16, 14, 6273},
+        {0x0069, 3, 16, 2, 16, 6, 6369},
+        {0x006A, 6, 20, -1, 16, 6, 6401},
+        {0x006B, 11, 16, 2, 16, 13, 6461},
+        {0x006C, 3, 16, 2, 16, 6, 6557},
+        {0x006D, 18, 12, 2, 12, 21, 6589},
+        {0x006E, 11, 12, 2, 12, 14, 6697},
+        {0x006F, 12, 12, 1, 12, 13, 6769},
+        {0x0070, 11, 16, 2, 12, 14, 6841},
+        {0x0071, 11, 16, 1, 12, 14, 6937},
+        {0x0072, 8, 12, 2, 12, 9, 7033},
+        {0x0073, 10, 12, 1, 12, 11, 7081},
+        {0x0074, 9, 15, 0, 15, 9, 7141},
+        {0x0075, 11, 12, 1, 12, 14, 7216},
+        {0x0076, 13, 12, 0, 12, 13, 7288},
+        {0x0077, 18, 12, 0, 12, 18, 7372},
+        {0x0078, 13, 12, 0, 12, 13, 7480},
+        {0x0079, 13, 16, 0, 12, 13, 7564},
+        {0x007A, 11, 12, 0, 12, 12, 7676},
+        {0x007B, 10, 20, 2, 16, 14, 7748},
+        {0x007C, 3, 22, 2, 16, 7, 7848},
+        {0x007D, 10, 20, 2, 16, 14, 7892},
+        {0x007E, 15, 5, 2, 9, 18, 7992},
+        {0x00A0, 0, 0, 0, 0, 7, 8032},
+        {0x00A1, 3, 16, 3, 12, 9, 8032},
+        {0x00A2, 11, 19, 1, 15, 14, 8064},
+        {0x00A3, 12, 16, 1, 16, 14, 8178},
+        {0x00A4, 13, 13, 1, 13, 14, 8274},
+        {0x00A5, 14, 16, 0, 16, 14, 8365},
+        {0x00A6, 3, 19, 2, 15, 7, 8477},
+        {0x00A7, 10, 18, 0, 16, 11, 8515},
+        {0x00A8, 7, 3, 2, 17, 11, 8605},
+        {0x00A9, 16, 16, 3, 15, 22, 8617},
+        {0x00AA, 8, 11, 1, 16, 10, 8745},
+        {0x00AB, 11, 11, 1, 12, 13, 8789},
+        {0x00AC, 15, 6, 2, 9, 18, 8855},
+        {0x00AD, 6, 2, 1, 7, 8, 8903},
+        {0x00AE, 16, 16, 3, 15, 22, 8909},
+        {0x00AF, 7, 2, 2, 16, 11, 9037},
+        {0x00B0, 7, 8, 2, 17, 11, 9045},
+        {0x00B1, 15, 13, 2, 13, 18, 9077},
+        {0x00B2, 7, 9, 1, 16, 9, 9181},
+        {0x00B3, 7, 9, 1, 16, 9, 9217},
+        {0x00B4, 7, 4, 3, 17, 11, 9253},
+        {0x00B5, 13, 16, 1, 12, 14, 9269},
+        {0x00B6, 11, 18, 1, 16, 14, 9381},
+        {0x00B7, 3, 3, 2, 9, 7, 9489},
+        {0x00B8, 5, 5, 3, 0, 11, 9495},
+        {0x00B9, 7, 9, 1, 16, 9, 9510},
+        {0x00BA, 9, 11, 1, 16, 10, 9546},
+        {0x00BB, 10, 11, 2, 12, 13, 9601},
+        {0x00BC, 20, 17, 1, 16, 21, 9656},
+        {0x00BD, 19, 17, 1, 16, 21, 9826},
+        {0x00BE, 20, 17, 1, 16, 21, 9996},
+        {0x00BF, 10, 16, 1, 12, 12, 10166},
+        {0x00C0, 15, 20, 0, 20, 15, 10246},
+        {0x00C1, 15, 20, 0, 20, 15, 10406},
+        {0x00C2, 15, 20, 0, 20, 15, 10566},
+        {0x00C3, 15, 21, 0, 21, 15, 10726},
+        {0x00C4, 15, 20, 0, 20, 15, 10894},
+        {0x00C5, 15, 21, 0, 21, 15, 11054},
+        {0x00C6, 21, 16, 0, 16, 21, 11222},
+        {0x00C7, 14, 20, 1, 16, 15, 11398},
+        {0x00C8, 11, 20, 2, 20, 14, 11538},
+        {0x00C9, 11, 20, 2, 20, 14, 11658},
+        {0x00CA, 11, 20, 2, 20, 14, 11778},
+        {0x00CB, 11, 20, 2, 20, 14, 11898},
+        {0x00CC, 5, 20, 0, 20, 6, 12018},
+        {0x00CD, 5, 20, 1, 20, 6, 12078},
+        {0x00CE, 8, 20, -1, 20, 6, 12138},
+        {0x00CF, 7, 20, 0, 20, 6, 12218},
+        {0x00D0, 16, 16, 0, 16, 17, 12298},
+        {0x00D1, 13, 21, 2, 21, 16, 12426},
+        {0x00D2, 16, 20, 1, 20, 17, 12573},
+        {0x00D3, 16, 20, 1, 20, 17, 12733},
+        {0x00D4, 16, 20, 1, 20, 17, 12893},
+        {0x00D5, 16, 21, 1, 21, 17, 13053},
+        {0x00D6, 16, 20, 1, 20, 17, 13221},
+        {0x00D7, 13, 13, 3, 13, 18, 13381},
+        {0x00D8, 16, 18, 1, 17, 17, 13472},
+        {0x00D9, 14, 20, 1, 20, 16, 13616},
+        {0x00DA, 14, 20, 1, 20, 16, 13756},
+        {0x00DB, 14, 20, 1, 20, 16, 13896},
+        {0x00DC, 14, 20, 1, 20, 16, 14036},
+        {0x00DD, 15, 20, -1, 20, 13, 14176},
+        {0x00DE, 11, 16, 2, 16, 13, 14336},
+        {0x00DF, 11, 16, 2, 16, 14, 14432},
+        {0x00E0, 11, 18, 1, 18, 13, 14528},
+        {0x00E1, 11, 18, 1, 18, 13, 14636},
+        {0x00E2, 11, 18, 1, 18, 13, 14744},
+        {0x00E3, 11, 16, 1, 16, 13, 14852},
+        {0x00E4, 11, 16, 1, 16, 13, 14948},
+        {0x00E5, 11, 20, 1, 20, 13, 15044},
+        {0x00E6, 20, 12, 1, 12, 22, 15164},
+        {0x00E7, 10, 16, 1, 12, 12, 15284},
+        {0x00E8, 12, 18, 1, 18, 14, 15364},
+        {0x00E9, 12, 18, 1, 18, 14, 15472},
+        {0x00EA, 12, 18, 1, 18, 14, 15580},
+        {0x00EB, 12, 16, 1, 16, 14, 15688},
+        {0x00EC, 6, 17, -1, 17, 6, 15784},
+        {0x00ED, 6, 17, 1, 17, 6, 15835},
+        {0x00EE, 8, 17, -1, 17, 6, 15886},
+        {0x00EF, 8, 16, -1, 16, 6, 15954},
+        {0x00F0, 12, 16, 1, 16, 13, 16018},
+        {0x00F1, 11, 16, 2, 16, 14, 16114},
+        {0x00F2, 12, 18, 1, 18, 13, 16210},
+        {0x00F3, 12, 18, 1, 18, 13, 16318},
+        {0x00F4, 12, 18, 1, 18, 13, 16426},
+        {0x00F5, 12, 16, 1, 16, 13, 16534},
+        {0x00F6, 12, 16, 1, 16, 13, 16630},
+        {0x00F7, 15, 11, 2, 12, 18, 16726},
+        {0x00F8, 13, 14, 0, 13, 13, 16814},
+        {0x00F9, 11, 18, 1, 18, 14, 16912},
+        {0x00FA, 11, 18, 1, 18, 14, 17020},
+        {0x00FB, 11, 18, 1, 18, 14, 17128},
+        {0x00FC, 11, 16, 1, 16, 14, 17236},
+        {0x00FD, 13, 22, 0, 18, 13, 17332},
+        {0x00FE, 11, 20, 2, 16, 14, 17486},
+        {0x00FF, 13, 20, 0, 16, 13, 17606},
+        {0x0100, 15, 19, 0, 19, 15, 17746},
+        {0x0101, 11, 16, 1, 16, 13, 17898},
+        {0x0102, 15, 21, 0, 21, 15, 17994},
+        {0x0103, 11, 16, 1, 16, 13, 18162},
+        {0x0104, 16, 20, 0, 16, 15, 18258},
+        {0x0105, 12, 16, 1, 12, 13, 18418},
+        {0x0106, 14, 20, 1, 20, 15, 18514},
+        {0x0107, 10, 18, 1, 18, 12, 18654},
+        {0x0108, 14, 20, 1, 20, 15, 18744},
+        {0x0109, 10, 18, 1, 18, 12, 18884},
+        {0x010A, 14, 20, 1, 20, 15, 18974},
+        {0x010B, 10, 16, 1, 16, 12, 19114},
+        {0x010C, 14, 20, 1, 20, 15, 19194},
+        {0x010D, 10, 18, 1, 18, 12, 19334},
+        {0x010E, 14, 20, 2, 20, 17, 19424},
+        {0x010F, 16, 16, 1, 16, 14, 19564},
+        {0x0110, 16, 16, 0, 16, 17, 19692},
+        {0x0111, 13, 16, 1, 16, 14, 19820},
+        {0x0112, 11, 19, 2, 19, 14, 19932},
+        {0x0113, 12, 16, 1, 16, 14, 20046},
+        {0x0114, 11, 20, 2, 20, 14, 20142},
+        {0x0115, 12, 17, 1, 17, 14, 20262},
+        {0x0116, 11, 20, 2, 20, 14, 20364},
+        {0x0117, 12, 16, 1, 16, 14, 20484},
+        {0x0118, 11, 20, 2, 16, 14, 20580},
+        {0x0119, 12, 16, 1, 12, 14, 20700},
+        {0x011A, 11, 20, 2, 20, 14, 20796},
+        {0x011B, 12, 18, 1, 18, 14, 20916},
+        {0x011C, 15, 20, 1, 20, 17, 21024},
+        {0x011D, 11, 22, 1, 18, 14, 21184},
+        {0x011E, 15, 20, 1, 20, 17, 21316},
+        {0x011F, 11, 22, 1, 18, 14, 21476},
+        {0x0120, 15, 20, 1, 20, 17, 21608},
+        {0x0121, 11, 20, 1, 16, 14, 21768},
+        {0x0122, 15, 21, 1, 16, 17, 21888},
+        {0x0123, 11, 20, 1, 16, 14, 22056},
+        {0x0124, 13, 20, 2, 20, 17, 22176},
+        {0x0125, 14, 20, -1, 20, 14, 22316},
+        {0x0126, 16, 16, 2, 16, 20, 22456},
+        {0x0127, 12, 16, 1, 16, 15, 22584},
+        {0x0128, 8, 21, -1, 21, 6, 22680},
+        {0x0129, 8, 16, -1, 16, 6, 22764},
+        {0x012A, 7, 19, 0, 19, 6, 22828},
+        {0x012B, 8, 16, -1, 16, 6, 22904},
+        {0x012C, 8, 20, -1, 20, 6, 22968},
+        {0x012D, 8, 17, -1, 17, 6, 23048},
+        {0x012E, 5, 20, 1, 16, 6, 23116},
+        {0x012F, 5, 20, 1, 16, 6, 23176},
+        {0x0130, 3, 20, 2, 20, 6, 23236},
+        {0x0131, 3, 12, 2, 12, 6, 23276},
+        {0x0132, 9, 20, 2, 16, 13, 23300},
+        {0x0133, 9, 20, 2, 16, 12, 23400},
+        {0x0134, 9, 24, -2, 20, 6, 23500},
+        {0x0135, 8, 22, -1, 18, 6, 23620},
+        {0x0136, 13, 21, 2, 16, 14, 23708},
+        {0x0137, 11, 21, 2, 16, 13, 23855},
+        {0x0138, 11, 12, 2, 12, 13, 23981},
+        {0x0139, 11, 20, 2, 20, 12, 24053},
+        {0x013A, 5, 20, 2, 20, 6, 24173},
+        {0x013B, 11, 21, 2, 16, 12, 24233},
+        {0x013C, 4, 21, 1, 16, 6, 24359},
+        {0x013D, 11, 16, 2, 16, 12, 24401},
+        {0x013E, 7, 16, 2, 16, 8, 24497},
+        {0x013F, 11, 16, 2, 16, 12, 24561},
+        {0x0140, 5, 16, 2, 16, 8, 24657},
+        {0x0141, 14, 16, -1, 16, 12, 24705},
+        {0x0142, 7, 16, 0, 16, 6, 24817},
+        {0x0143, 13, 20, 2, 20, 16, 24881},
+        {0x0144, 11, 17, 2, 17, 14, 25021},
+        {0x0145, 13, 21, 2, 16, 16, 25123},
+        {0x0146, 11, 17, 2, 12, 14, 25270},
+        {0x0147, 13, 20, 2, 20, 16, 25372},
+        {0x0148, 11, 18, 2, 18, 14, 25512},
+        {0x0149, 14, 16, 2, 16, 18, 25620},
+        {0x014A, 13, 20, 2, 16, 16, 25732},
+        {0x014B, 11, 16, 2, 12, 14, 25872},
+        {0x014C, 16, 20, 1, 20, 17, 25968},
+        {0x014D, 12, 16, 1, 16, 13, 26128},
+        {0x014E, 16, 20, 1, 20, 17, 26224},
+        {0x014F, 12, 17, 1, 17, 13, 26384},
+        {0x0150, 16, 20, 1, 20, 17, 26486},
+        {0x0151, 12, 17, 1, 17, 13, 26646},
+        {0x0152, 22, 16, 1, 16, 24, 26748},
+        {0x0153, 21, 12, 1, 12, 23, 26924},
+        {0x0154, 13, 20, 2, 20, 15, 27056},
+        {0x0155, 8, 17, 2, 17, 9, 27196},
+        {0x0156, 13, 21, 2, 16, 15, 27264},
+        {0x0157, 9, 17, 1, 12, 9, 27411},
+        {0x0158, 13, 20, 2, 20, 15, 27496},
+        {0x0159, 8, 17, 2, 17, 9, 27636},
+        {0x015A, 12, 20, 1, 20, 14, 27704},
+        {0x015B, 10, 18, 1, 18, 11, 27824},
+        {0x015C, 12, 20, 1, 20, 14, 27914},
+        {0x015D, 10, 18, 1, 18, 11, 28034},
+        {0x015E, 12, 20, 1, 16, 14, 28124},
+        {0x015F, 10, 16, 1, 12, 11, 28244},
+        {0x0160, 12, 20, 1, 20, 14, 28324},
+        {0x0161, 10, 18, 1, 18, 11, 28444},
+        {0x0162, 15, 20, -1, 16, 13, 28534},
+        {0x0163, 9, 19, 0, 15, 9, 28694},
+        {0x0164, 15, 20, -1, 20, 13, 28789},
+        {0x0165, 9, 17, 0, 17, 9, 28949},
+        {0x0166, 15, 16, -1, 16, 13, 29034},
+        {0x0167, 9, 15, 0, 15, 9, 29162},
+        {0x0168, 14, 21, 1, 21, 16, 29237},
+        {0x0169, 11, 16, 1, 16, 14, 29384},
+        {0x016A, 14, 20, 1, 20, 16, 29480},
+        {0x016B, 11, 16, 1, 16, 14, 29620},
+        {0x016C, 14, 20, 1, 20, 16, 29716},
+        {0x016D, 11, 17, 1, 17, 14, 29856},
+        {0x016E, 14, 21, 1, 21, 16, 29958},
+        {0x016F, 11, 19, 1, 19, 14, 30105},
+        {0x0170, 14, 20, 1, 20, 16, 30219},
+        {0x0171, 12, 17, 1, 17, 14, 30359},
+        {0x0172, 14, 20, 1, 16, 16, 30461},
+        {0x0173, 13, 16, 1, 12, 14, 30601},
+        {0x0174, 22, 20, 0, 20, 22, 30713},
+        {0x0175, 18, 17, 0, 17, 18, 30933},
+        {0x0176, 15, 20, -1, 20, 13, 31086},
+        {0x0177, 13, 22, 0, 18, 13, 31246},
+        {0x0178, 15, 20, -1, 20, 13, 31400},
+        {0x0179, 15, 20, 0, 20, 15, 31560},
+        {0x017A, 11, 17, 0, 17, 12, 31720},
+        {0x017B, 15, 20, 0, 20, 15, 31822},
+        {0x017C, 11, 16, 0, 16, 12, 31982},
+        {0x017D, 15, 20, 0, 20, 15, 32078},
+        {0x017E, 11, 17, 0, 17, 12, 32238},
+        {0x017F, 9, 16, 0, 16, 8, 32340},
+        {0x2013, 9, 2, 1, 7, 11, 32420},
+        {0x2014, 20, 2, 1, 7, 22, 32430},
+        {0x2018, 5, 6, 1, 16, 7, 32450},
+        {0x2019, 5, 5, 1, 16, 7, 32468},
+        {0x201C, 9, 6, 1, 16, 11, 32483},
+        {0x201D, 9, 6, 1, 16, 11, 32513},
+        {0x2026, 18, 3, 2, 3, 22, 32543},
+};
+
+const Font font_sans_22 = {
+        .ascent = 21,
+        .height = 27,
+        .glyph_count = 326,
+        .glyphs = glyphs,
+        .bitmaps = bitmaps
+};
@@ -0,0 +1,87 @@
+#include <stdlib.h>
+
+#include "gesture.h"
+
+void gesture_init(GestureRecognizer *recognizer, int drag_x1, int drag_y1, int drag_x2, int drag_y2) {
+    *recognizer = (GestureRecognizer) {
+            .drag_x1 = (int16_t) drag_x1,
+            .drag_y1 = (int16_t) drag_y1,
+            .drag_x2 = (int16_t) drag_x2,
+            .drag_y2 = (int16_t) drag_y2
+    };
+}
+
+void gesture_reset(GestureRecognizer *recognizer) {
+    recognizer->down = false;
+    recognizer->dragging = false;
+}
+
+static bool is_in_drag_area(const GestureRecognizer *recognizer, const TouchEvent *event) {
+    return event->x >= recognizer->drag_x1 && event->x <= recognizer->drag_x2 &&
+           event->y >= recognizer->drag_y1 && event->y <= recognizer->drag_y2;
+}
+
+static bool emit(Gesture *gesture, GestureType type, const TouchEvent *position, const TouchEvent *time) {
+    *gesture = (Gesture) {
+            .type = type,
+            .x = (int16_t) position->x,
+            .y = (int16_t) position->y,
+            .cycles = time->cycles,
+            .tick = time->tick
+    };
+    return true;
+}
+
+static bool on_down(GestureRecognizer *recognizer, const TouchEvent *event, Gesture *gesture) {
+    recognizer->down = true;
+    recognizer->strayed = false;
+    recognizer->start = *event;
+    recognizer->last = *event;
+    recognizer->dragging = is_in_drag_area(recognizer, event);
+    return emit(gesture, recognizer->dragging ? GESTURE_DRAG : GESTURE_PRESS, event, event);
+}
+
+static bool on_move(GestureRecognizer *recognizer, const TouchEvent *event, Gesture *gesture) {
+    recognizer->last = *event;
+    if (recognizer->dragging) {
+        return emit(gesture, GESTURE_DRAG, event, event);
+    }
+    if (!recognizer->strayed && (abs(event->x - recognizer->start.x) > GESTURE_TAP_SLOP_PX ||
+                                 abs(event->y - recognizer->start.y) > GESTURE_TAP_SLOP_PX)) {
+        recognizer->strayed = true;
+        return emit(gesture, GESTURE_CANCEL, event, event);
+    }
+    return false;
+}
+
+static bool on_up(GestureRecognizer *recognizer, const TouchEvent *event, Gesture *gesture) {
+    recognizer->down = false;
+    if (recognizer->dragging) {
+        recognizer->dragging = false;
+        return emit(gesture, GESTURE_DRAG_END, &recognizer->last, event);
+    }
+    const int dx = recognizer->last.x - recognizer->start.x;
+    const int dy = recognizer->last.y - recognizer->start.y;
+    if (abs(dx) >= GESTURE_SWIPE_MIN_PX && abs(dx) > 2 * abs(dy) &&
+        event->tick - recognizer->start.tick <= GESTURE_SWIPE_MAX_MS) {
+        return emit(gesture, dx < 0 ? GESTURE_SWIPE_LEFT : GESTURE_SWIPE_RIGHT, &recognizer->last, event);
+    }
+    if (!recognizer->strayed) {
+        return emit(gesture, GESTURE_TAP, &recognizer->start, event);
+    }
+    return false;
+}
+
+bool gesture_feed(GestureRecognizer *recognizer, const TouchEvent *event, Gesture *gesture) {
+    if (event->type == TOUCH_DOWN) {
+        return on_down(recognizer, event, gesture);
+    }
+    // The rest of a touch that went down before a reset, or whose start was dropped from a full queue
+    if (!recognizer->down) {
+        return false;
+    }
+    if (event->type == TOUCH_MOVE) {
+        return on_move(recognizer, event, gesture);
+    }
+    return on_up(recognizer, event, gesture);
+}
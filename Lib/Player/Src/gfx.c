@@ -0,0 +1,160 @@
+#include <stdbool.h>
+#include "stm32f7xx_hal.h"
+#include "cmsis_os.h"
+
+#include "gfx.h"
+#include "logger.h"
+#include "profiler.h"
+
+extern DMA2D_HandleTypeDef hdma2d;
+
+// Taken by a transfer from its start until the completion interrupt
+static osSemaphoreId idle;
+osSemaphoreDef(gfx_idle);
+static GfxStats stats;
+
+static void transfer_complete(DMA2D_HandleTypeDef *handle) {
+    osSemaphoreRelease(idle);
+}
+
+static void transfer_error(DMA2D_HandleTypeDef *handle) {
+    stats.errors++;
+    osSemaphoreRelease(idle);
+}
+
+int gfx_init(void) {
+    if (idle == NULL) {
+        idle = osSemaphoreCreate(osSemaphore(gfx_idle), 1);
+    }
+    return idle == NULL;
+}
+
+static void acquire(void) {
+    const uint32_t start = profiler_cycles();
+    if (osSemaphoreWait(idle, GFX_TIMEOUT_MS) != osOK) {
+        log_error("DMA2D transfer timed out");
+        stats.errors++;
+        HAL_DMA2D_Abort(&hdma2d);
+    }
+    stats.wait_cycles += profiler_cycles() - start;
+}
+
+// The DMA2D does not clip: the rectangle is moved into surface coordinates and cut to the surface, and
+// the columns and rows cut off on the top left are returned, for the source to skip
+static bool clip(const GfxSurface *surface, int *x, int *y, int *width, int *height, int *skip_x, int *skip_y) {
+    *x -= surface->x;
+    *y -= surface->y;
+    *skip_x = *x < 0 ? -*x : 0;
+    *skip_y = *y < 0 ? -*y : 0;
+    *x += *skip_x;
+    *y += *skip_y;
+    *width -= *skip_x;
+    *height -= *skip_y;
+    if (*x + *width > surface->width) *width = surface->width - *x;
+    if (*y + *height > surface->height) *height = surface->height - *y;
+    return *width > 0 && *height > 0;
+}
+
+static uint32_t get_address(const GfxSurface *surface, int x, int y) {
+    const unsigned bytes_per_pixel = surface->format == GFX_FORMAT_RGB565 ? 2 : 4;
+    return (uint32_t) (uintptr_t) surface->pixels + (y * surface->width + x) * bytes_per_pixel;
+}
+
+static uint32_t get_input_mode(const GfxSurface *surface) {
+    return surface->format == GFX_FORMAT_RGB565 ? DMA2D_INPUT_RGB565 : DMA2D_INPUT_ARGB8888;
+}
+
+// Colors are always given as ARGB8888, in R2M mode the HAL converts them to the output format
+static void configure_output(const GfxSurface *target, uint32_t mode, uint32_t offset) {
+    hdma2d.Init.Mode = mode;
+    hdma2d.Init.ColorMode = target->format == GFX_FORMAT_RGB565 ? DMA2D_OUTPUT_RGB565 : DMA2D_OUTPUT_ARGB8888;
+    hdma2d.Init.OutputOffset = offset;
+    hdma2d.XferCpltCallback = transfer_complete;
+    hdma2d.XferErrorCallback = transfer_error;
+    HAL_DMA2D_Init(&hdma2d);
+}
+
+// Layer 1 is the foreground, 0 the background of a blend; for A8 the alpha argument holds the color
+static void configure_layer(uint32_t layer, uint32_t color_mode, uint32_t offset, uint32_t alpha) {
+    hdma2d.LayerCfg[layer].InputOffset = offset;
+    hdma2d.LayerCfg[layer].InputColorMode = color_mode;
+    hdma2d.LayerCfg[layer].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+    hdma2d.LayerCfg[layer].InputAlpha = alpha;
+    HAL_DMA2D_ConfigLayer(&hdma2d, layer);
+}
+
+static void account(HAL_StatusTypeDef status, int width, int height) {
+    if (status != HAL_OK) {
+        stats.errors++;
+        osSemaphoreRelease(idle);
+        return;
+    }
+    stats.transfers++;
+    stats.pixels += (uint32_t) (width * height);
+}
+
+void gfx_fill(const GfxSurface *target, int x, int y, int width, int height, uint32_t color) {
+    int skip_x, skip_y;
+    if (!clip(target, &x, &y, &width, &height, &skip_x, &skip_y)) {
+        return;
+    }
+    acquire();
+    configure_output(target, DMA2D_R2M, target->width - width);
+    account(HAL_DMA2D_Start_IT(&hdma2d, color, get_address(target, x, y), width, height), width, height);
+}
+
+void gfx_copy(const GfxSurface *source, const GfxSurface *target, int x, int y, int width, int height) {
+    int skip_x, skip_y;
+    if (!clip(target, &x, &y, &width, &height, &skip_x, &skip_y)) {
+        return;
+    }
+    acquire();
+    configure_output(target, DMA2D_M2M, target->width - width);
+    configure_layer(1, get_input_mode(source), source->width - width, 0);
+    account(HAL_DMA2D_Start_IT(&hdma2d, get_address(source, x, y), get_address(target, x, y), width, height),
+            width, height);
+}
+
+void gfx_blit(const GfxSurface *source, int source_x, int source_y, const GfxSurface *target, int x, int y,
+              int width, int height) {
+    int skip_x, skip_y;
+    if (!clip(target, &x, &y, &width, &height, &skip_x, &skip_y)) {
+        return;
+    }
+    source_x += skip_x - source->x;
+    source_y += skip_y - source->y;
+    if (source_x < 0 || source_y < 0 || source_x + width > source->width || source_y + height > source->height) {
+        stats.errors++;
+        return;
+    }
+    acquire();
+    configure_output(target, DMA2D_M2M, target->width - width);
+    configure_layer(1, get_input_mode(source), source->width - width, 0);
+    account(HAL_DMA2D_Start_IT(&hdma2d, get_address(source, source_x, source_y), get_address(target, x, y), width,
+                               height), width, height);
+}
+
+void gfx_draw_mask(const GfxSurface *target, const GfxMask *mask, int x, int y, uint32_t color) {
+    int width = mask->width;
+    int height = mask->height;
+    int skip_x, skip_y;
+    if (!clip(target, &x, &y, &width, &height, &skip_x, &skip_y)) {
+        return;
+    }
+    const uint32_t source = (uint32_t) (uintptr_t) &mask->alpha[skip_y * mask->width + skip_x];
+    const uint32_t destination = get_address(target, x, y);
+    acquire();
+    configure_output(target, DMA2D_M2M_BLEND, target->width - width);
+    configure_layer(1, DMA2D_INPUT_A8, mask->width - width, color);
+    configure_layer(0, get_input_mode(target), target->width - width, 0);
+    account(HAL_DMA2D_BlendingStart_IT(&hdma2d, source, destination, destination, width, height), width, height);
+}
+
+void gfx_wait(void) {
+    acquire();
+    osSemaphoreRelease(idle);
+}
+
+void gfx_get_stats(GfxStats *result) {
+    *result = stats;
+}
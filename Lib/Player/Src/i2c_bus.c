@@ -0,0 +1,21 @@
+#include "cmsis_os.h"
+
+#include "i2c_bus.h"
+
+static osSemaphoreId bus_lock;
+osSemaphoreDef(i2c_bus_lock);
+
+int i2c_bus_init(void) {
+    if (bus_lock == NULL) {
+        bus_lock = osSemaphoreCreate(osSemaphore(i2c_bus_lock), 1);
+    }
+    return bus_lock == NULL;
+}
+
+void i2c_bus_lock(void) {
+    osSemaphoreWait(bus_lock, osWaitForever);
+}
+
+void i2c_bus_unlock(void) {
+    osSemaphoreRelease(bus_lock);
+}
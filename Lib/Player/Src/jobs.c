@@ -0,0 +1,333 @@
+#include <string.h>
+#include "cmsis_os.h"
+#include "ff.h"
+
+#include "jobs.h"
+#include "logger.h"
+#include "profiler.h"
+#include "sd_async.h"
+#include "stream_cache.h"
+
+#define JOBS_MAGIC 0x424F4A46 // "FJOB"
+#define JOBS_VERSION 1
+#define JOBS_TASK_STACK_WORDS 1024
+// Wait before looking again when the stream cache was behind, the idle hook would wake the task at once
+#define JOBS_DEFER_MS 10
+
+typedef enum {
+    JOB_PENDING,
+    JOB_FINISHED,
+    JOB_ABANDONED,
+    JOB_STATE_COUNT
+} JobState;
+
+// Saved as is, one per job id
+typedef struct {
+    uint32_t id;
+    uint32_t progress;
+    uint32_t state;
+} JobRecord;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+} JobsFileHeader;
+
+// Records loaded from the card stay there until a job with their id is added, so their progress is kept
+static JobRecord records[JOBS_MAX];
+static const Job *jobs[JOBS_MAX];
+// Bumped by a restart, so a step that was running meanwhile does not write its progress back
+static uint32_t generations[JOBS_MAX];
+static unsigned record_count;
+static unsigned next_job;
+static volatile bool pending;
+static bool started = false;
+static bool dirty;
+static bool save_now;
+static uint32_t last_save_ms;
+static JobsStats stats;
+static FIL state_file;
+
+// lock guards the records, the controller adds and restarts jobs while the jobs task runs them
+static osMutexId lock;
+static osSemaphoreId idle_semaphore;
+
+osMutexDef(jobs_lock);
+osSemaphoreDef(jobs_idle);
+
+static uint32_t jobs_task_stack[JOBS_TASK_STACK_WORDS];
+static osStaticThreadDef_t jobs_task_control;
+
+// Called with the lock held
+static void update_pending(void) {
+    bool any = false;
+    for (unsigned i = 0; i < record_count; i++) {
+        any |= jobs[i] != NULL && records[i].state == JOB_PENDING;
+    }
+    pending = any;
+}
+
+static int find_record(uint32_t id) {
+    for (unsigned i = 0; i < record_count; i++) {
+        if (records[i].id == id) {
+            return (int) i;
+        }
+    }
+    return -1;
+}
+
+static int load_state(void) {
+    JobsFileHeader header;
+    UINT bytes_read;
+
+    if (f_open(&state_file, JOBS_STATE_PATH, FA_READ) != FR_OK) {
+        return 1;
+    }
+    int result = f_read(&state_file, &header, sizeof(header), &bytes_read) != FR_OK || bytes_read != sizeof(header) ||
+                 header.magic != JOBS_MAGIC || header.version != JOBS_VERSION || header.count > JOBS_MAX ||
+                 f_size(&state_file) != sizeof(header) + header.count * sizeof(JobRecord);
+    if (result == 0) {
+        result = f_read(&state_file, records, header.count * sizeof(JobRecord), &bytes_read) != FR_OK ||
+                 bytes_read != header.count * sizeof(JobRecord);
+    }
+    f_close(&state_file);
+    if (result != 0) {
+        log_warn("Job progress is invalid, starting over");
+        return 1;
+    }
+    // A record the firmware cannot tell the state of runs its job again from the start
+    for (unsigned i = 0; i < header.count; i++) {
+        if (records[i].state >= JOB_STATE_COUNT) {
+            log_warn("Job %lu has an unknown state, starting it over", (unsigned long) records[i].id);
+            records[i].state = JOB_PENDING;
+            records[i].progress = 0;
+            dirty = true;
+        }
+    }
+    record_count = header.count;
+    return 0;
+}
+
+// Written next to the old state and renamed over it, like the library index
+static int save_state(void) {
+    JobRecord copy[JOBS_MAX];
+    UINT bytes_written;
+
+    osMutexWait(lock, osWaitForever);
+    const JobsFileHeader header = {.magic = JOBS_MAGIC, .version = JOBS_VERSION, .count = record_count};
+    memcpy(copy, records, sizeof(copy));
+    dirty = false;
+    save_now = false;
+    osMutexRelease(lock);
+    last_save_ms = osKernelSysTick();
+
+    if (f_open(&state_file, JOBS_STATE_TEMP_PATH, FA_CREATE_ALWAYS | FA_WRITE) != FR_OK) {
+        log_error("Cannot create %s", JOBS_STATE_TEMP_PATH);
+        return 1;
+    }
+    int result = f_write(&state_file, &header, sizeof(header), &bytes_written) != FR_OK ||
+                 bytes_written != sizeof(header) ||
+                 f_write(&state_file, copy, header.count * sizeof(JobRecord), &bytes_written) != FR_OK ||
+                 bytes_written != header.count * sizeof(JobRecord);
+    if (f_close(&state_file) != FR_OK) {
+        result = 1;
+    }
+    if (result != 0) {
+        log_error("Cannot write the job progress");
+        f_unlink(JOBS_STATE_TEMP_PATH);
+        return 1;
+    }
+    f_unlink(JOBS_STATE_PATH);
+    if (f_rename(JOBS_STATE_TEMP_PATH, JOBS_STATE_PATH) != FR_OK) {
+        log_error("Cannot rename %s", JOBS_STATE_TEMP_PATH);
+        return 1;
+    }
+    stats.saves++;
+    return 0;
+}
+
+// Round robin over the pending jobs, -1 when there is none
+static int next_pending(void) {
+    int result = -1;
+    osMutexWait(lock, osWaitForever);
+    for (unsigned n = 0; n < record_count && result < 0; n++) {
+        const unsigned i = (next_job + n) % record_count;
+        if (jobs[i] != NULL && records[i].state == JOB_PENDING) {
+            result = (int) i;
+        }
+    }
+    osMutexRelease(lock);
+    return result;
+}
+
+// The step runs without the lock, a restart meanwhile wins over its progress
+static void run_step(unsigned index) {
+    osMutexWait(lock, osWaitForever);
+    const Job *job = jobs[index];
+    uint32_t progress = records[index].progress;
+    const uint32_t generation = generations[index];
+    osMutexRelease(lock);
+
+    const JobStepResult result = job->step(&progress, job->context);
+    stats.steps++;
+
+    osMutexWait(lock, osWaitForever);
+    if (generations[index] == generation && records[index].state == JOB_PENDING) {
+        records[index].progress = progress;
+        if (result != JOB_STEP_MORE) {
+            records[index].state = result == JOB_STEP_DONE ? JOB_FINISHED : JOB_ABANDONED;
+            save_now |= !job->transient;
+        }
+        dirty |= !job->transient;
+    }
+    next_job = index + 1;
+    update_pending();
+    osMutexRelease(lock);
+
+    if (result == JOB_STEP_DONE && !job->transient) {
+        log_info("Job %s finished", job->name);
+    } else if (result == JOB_STEP_FAILED) {
+        log_warn("Job %s failed at %lu", job->name, (unsigned long) progress);
+    }
+}
+
+// Ends when the time is up or the SD background bandwidth is used up, waiting for it happens before the slice
+static void run_slice(void) {
+    // Nothing holds the FatFs volume here, so waiting is safe
+    sd_async_throttle();
+
+    PROFILER_ZONE(PROFILER_ZONE_JOB_SLICE);
+    const uint32_t cycles_per_us = profiler_clock_hz() / 1000000;
+    const uint32_t start = profiler_cycles();
+    int index;
+    do {
+        if ((index = next_pending()) >= 0) {
+            run_step((unsigned) index);
+        }
+    } while (index >= 0 && profiler_cycles() - start < JOBS_SLICE_US * cycles_per_us && !sd_async_is_throttled());
+    const uint32_t elapsed_us = (profiler_cycles() - start) / cycles_per_us;
+    stats.slices++;
+    if (elapsed_us > stats.max_slice_us) {
+        stats.max_slice_us = elapsed_us;
+    }
+}
+
+static void jobs_task(void const *argument) {
+    sd_async_set_thread_class(SD_CLASS_BACKGROUND);
+    last_save_ms = osKernelSysTick();
+    while (true) {
+        osSemaphoreWait(idle_semaphore, osWaitForever);
+        if (!stream_cache_is_ahead()) {
+            stats.deferred++;
+            osDelay(JOBS_DEFER_MS);
+            continue;
+        }
+        run_slice();
+        if (save_now || (dirty && osKernelSysTick() - last_save_ms >= JOBS_SAVE_INTERVAL_MS)) {
+            save_state();
+        }
+    }
+}
+
+// CMSIS-RTOS creates binary semaphores already given, they are taken once so the first wait blocks
+static osSemaphoreId create_semaphore(const osSemaphoreDef_t *definition) {
+    osSemaphoreId semaphore = osSemaphoreCreate(definition, 1);
+    if (semaphore != NULL) {
+        osSemaphoreWait(semaphore, 0);
+    }
+    return semaphore;
+}
+
+int jobs_init(void) {
+    lock = osMutexCreate(osMutex(jobs_lock));
+    idle_semaphore = create_semaphore(osSemaphore(jobs_idle));
+    if (lock == NULL || idle_semaphore == NULL) {
+        log_error("Failed to initialize the jobs");
+        return 1;
+    }
+    if (load_state() == 0) {
+        log_info("Job progress loaded: %u jobs", record_count);
+    }
+
+    // Below the controller, it only gets the CPU the idle task would have had
+    osThreadStaticDef(jobs, jobs_task, osPriorityLow, 0, JOBS_TASK_STACK_WORDS, jobs_task_stack,
+                      &jobs_task_control);
+    if (osThreadCreate(osThread(jobs), NULL) == NULL) {
+        log_error("Failed to start the jobs task");
+        return 1;
+    }
+    started = true;
+    return 0;
+}
+
+int jobs_add(const Job *job) {
+    int result = 0;
+    osMutexWait(lock, osWaitForever);
+    int index = find_record(job->id);
+    if (index < 0 && record_count < JOBS_MAX) {
+        index = (int) record_count++;
+        records[index] = (JobRecord) {.id = job->id, .progress = 0, .state = JOB_PENDING};
+        dirty = true;
+    }
+    if (index >= 0) {
+        jobs[index] = job;
+        update_pending();
+    } else {
+        result = 1;
+    }
+    osMutexRelease(lock);
+    if (result != 0) {
+        log_error("No room for job %s", job->name);
+    }
+    return result;
+}
+
+void jobs_restart(uint32_t id) {
+    osMutexWait(lock, osWaitForever);
+    const int index = find_record(id);
+    if (index >= 0) {
+        records[index].progress = 0;
+        records[index].state = JOB_PENDING;
+        generations[index]++;
+        save_now |= jobs[index] == NULL || !jobs[index]->transient;
+        update_pending();
+    }
+    osMutexRelease(lock);
+}
+
+bool jobs_is_done(uint32_t id) {
+    osMutexWait(lock, osWaitForever);
+    const int index = find_record(id);
+    const bool done = index >= 0 && records[index].state != JOB_PENDING;
+    osMutexRelease(lock);
+    return done;
+}
+
+void jobs_idle_hook(void) {
+    if (started && pending) {
+        osSemaphoreRelease(idle_semaphore);
+    }
+}
+
+void jobs_get_stats(JobsStats *result) {
+    *result = stats;
+}
+
+void jobs_print_stats(void) {
+    static const char *const state_names[JOB_STATE_COUNT] = {"pending", "finished", "failed"};
+    if (!started) {
+        return;
+    }
+    log_info("Jobs: %lu slices (max %lu us), %lu steps, %lu deferred, %lu saves",
+             (unsigned long) stats.slices, (unsigned long) stats.max_slice_us, (unsigned long) stats.steps,
+             (unsigned long) stats.deferred, (unsigned long) stats.saves);
+    osMutexWait(lock, osWaitForever);
+    for (unsigned i = 0; i < record_count; i++) {
+        if (jobs[i] != NULL) {
+            log_info("  %s: %s at %lu", jobs[i]->name, state_names[records[i].state],
+                     (unsigned long) records[i].progress);
+        }
+    }
+    osMutexRelease(lock);
+}
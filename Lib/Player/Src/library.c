@@ -0,0 +1,833 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cmsis_os.h"
+#include "ff.h"
+
+#include "dir_walker.h"
+#include "flac_metadata.h"
+#include "library.h"
+#include "logger.h"
+#include "sdram.h"
+
+#define LIBRARY_MAGIC 0x58494C46 // "FLIX"
+#define LIBRARY_VERSION 2
+
+#define NO_PAGE UINT32_MAX
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+typedef struct {
+    LibraryTrack *tracks;
+    LibraryDirectory *directories;
+    char *strings;
+    uint32_t track_count;
+    uint32_t directory_count;
+    uint32_t strings_size;
+} LibraryIndex;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t track_count;
+    uint32_t directory_count;
+    uint32_t strings_size;
+    // FNV-1a of the directories, tracks and strings that follow
+    uint32_t checksum;
+} LibraryFileHeader;
+
+typedef struct {
+    uint8_t *data;
+    // File offset of the page, NO_PAGE when it holds nothing
+    uint32_t offset;
+    uint32_t size;
+    uint32_t last_use;
+} LibraryPage;
+
+// The only index in memory, a scan rebuilds it in place
+static LibraryIndex library;
+
+// The index on the card while a scan runs, it is what makes rescans incremental. Its directories and their paths
+// are kept in memory for the lookups by path, tracks and the other strings are read through a few cached pages.
+static struct {
+    bool open;
+    // FatFs fails every read of a file after a failed one, whatever the scan still had to reuse is lost
+    bool read_failed;
+    LibraryFileHeader header;
+    LibraryDirectory *directories;
+    char *paths;
+    uint32_t tracks_offset;
+    uint32_t strings_offset;
+    LibraryPage pages[LIBRARY_PAGE_COUNT];
+    uint32_t use_count;
+} previous;
+
+// Whether the index in memory is the one on the card, a cancelled scan restores it from there
+static bool library_saved;
+static bool library_scan_changed;
+
+// Pending directory paths of a scan
+static void *walker_memory;
+
+// Scratch used to sort a freshly scanned index
+static uint16_t *directory_order;
+static uint16_t *directory_rank;
+
+// Last artist and album interned by the scan, tracks of one album share the string
+static uint32_t last_artist;
+static uint32_t last_album;
+
+static FIL index_file;
+static FIL track_file;
+
+int library_init(void) {
+    if (library.tracks != NULL) {
+        return 0;
+    }
+    library = (LibraryIndex) {
+            .tracks = sdram_alloc(LIBRARY_MAX_TRACKS * sizeof(LibraryTrack)),
+            .directories = sdram_alloc(LIBRARY_MAX_DIRECTORIES * sizeof(LibraryDirectory)),
+            .strings = sdram_alloc(LIBRARY_STRINGS_SIZE),
+            .track_count = 0,
+            .directory_count = 0,
+            .strings_size = 1
+    };
+    if (library.tracks == NULL || library.directories == NULL || library.strings == NULL) {
+        return 1;
+    }
+    library.strings[0] = '\0';
+
+    previous.directories = sdram_alloc(LIBRARY_MAX_DIRECTORIES * sizeof(LibraryDirectory));
+    previous.paths = sdram_alloc(LIBRARY_PREVIOUS_PATHS_SIZE);
+    for (int i = 0; i < LIBRARY_PAGE_COUNT; i++) {
+        previous.pages[i].data = sdram_alloc(LIBRARY_PAGE_SIZE);
+        if (previous.pages[i].data == NULL) {
+            return 1;
+        }
+    }
+    directory_order = sdram_alloc(LIBRARY_MAX_DIRECTORIES * sizeof(uint16_t));
+    directory_rank = sdram_alloc(LIBRARY_MAX_DIRECTORIES * sizeof(uint16_t));
+    walker_memory = sdram_alloc(LIBRARY_WALKER_MEMORY_SIZE);
+    return previous.directories == NULL || previous.paths == NULL || directory_order == NULL ||
+           directory_rank == NULL || walker_memory == NULL;
+}
+
+// Byte order with '/' below every other character, so a directory is directly followed by everything inside it
+static int compare_paths(const char *a, const char *b) {
+    while (*a != '\0' && *a == *b) {
+        a++;
+        b++;
+    }
+    const int char_a = *a == '/' ? 1 : (unsigned char) *a;
+    const int char_b = *b == '/' ? 1 : (unsigned char) *b;
+    return char_a - char_b;
+}
+
+static const char *index_string(const LibraryIndex *index, uint32_t offset) {
+    return index->strings + offset;
+}
+
+static uint32_t intern_string(LibraryIndex *index, const char *string) {
+    const size_t length = strlen(string);
+    if (length == 0) {
+        return 0;
+    }
+    if (index->strings_size + length + 1 > LIBRARY_STRINGS_SIZE) {
+        log_error("Library string pool is full");
+        return 0;
+    }
+    const uint32_t offset = index->strings_size;
+    memcpy(index->strings + offset, string, length + 1);
+    index->strings_size += length + 1;
+    return offset;
+}
+
+static uint32_t intern_repeated_string(LibraryIndex *index, const char *string, uint32_t *last) {
+    if (*last != 0 && strcmp(index_string(index, *last), string) == 0) {
+        return *last;
+    }
+    *last = intern_string(index, string);
+    return *last;
+}
+
+static int find_directory(const LibraryDirectory *directories, uint32_t count, const char *strings,
+                          const char *path) {
+    int low = 0;
+    int high = (int) count - 1;
+    while (low <= high) {
+        const int middle = (low + high) / 2;
+        const int order = compare_paths(path, strings + directories[middle].path);
+        if (order == 0) {
+            return middle;
+        }
+        if (order < 0) {
+            high = middle - 1;
+        } else {
+            low = middle + 1;
+        }
+    }
+    return -1;
+}
+
+static const LibraryTrack *find_track(const LibraryIndex *index, int directory, const char *name) {
+    const LibraryDirectory *dir = &index->directories[directory];
+    int low = (int) dir->first_track;
+    int high = (int) (dir->first_track + dir->track_count) - 1;
+    while (low <= high) {
+        const int middle = (low + high) / 2;
+        const int order = compare_paths(name, index_string(index, index->tracks[middle].name));
+        if (order == 0) {
+            return &index->tracks[middle];
+        }
+        if (order < 0) {
+            high = middle - 1;
+        } else {
+            low = middle + 1;
+        }
+    }
+    return NULL;
+}
+
+static uint32_t hash_bytes(uint32_t hash, const void *buffer, uint32_t size) {
+    const uint8_t *bytes = buffer;
+    for (uint32_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t index_checksum(const LibraryIndex *index) {
+    uint32_t hash = 2166136261u;
+    hash = hash_bytes(hash, index->directories, index->directory_count * sizeof(LibraryDirectory));
+    hash = hash_bytes(hash, index->tracks, index->track_count * sizeof(LibraryTrack));
+    return hash_bytes(hash, index->strings, index->strings_size);
+}
+
+static int read_array(void *buffer, uint32_t size) {
+    UINT bytes_read;
+    return f_read(&index_file, buffer, size, &bytes_read) != FR_OK || bytes_read != size;
+}
+
+static int write_array(const void *buffer, uint32_t size) {
+    UINT bytes_written;
+    return f_write(&index_file, buffer, size, &bytes_written) != FR_OK || bytes_written != size;
+}
+
+static bool is_header_valid(const LibraryFileHeader *header) {
+    return header->magic == LIBRARY_MAGIC && header->version == LIBRARY_VERSION &&
+           header->track_count <= LIBRARY_MAX_TRACKS && header->directory_count <= LIBRARY_MAX_DIRECTORIES &&
+           header->directory_count != 0 && header->strings_size != 0 && header->strings_size <= LIBRARY_STRINGS_SIZE;
+}
+
+static bool are_directories_valid(const LibraryDirectory *directories, const LibraryFileHeader *header) {
+    for (uint32_t i = 0; i < header->directory_count; i++) {
+        if (directories[i].path >= header->strings_size ||
+            directories[i].first_track + directories[i].track_count > header->track_count) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Bytes of the previous index from a file offset to the end of the page holding it, pages are replaced least
+// recently used first
+static const uint8_t *read_previous_page(uint32_t offset, uint32_t *available) {
+    const uint32_t page_offset = offset - offset % LIBRARY_PAGE_SIZE;
+    LibraryPage *page = &previous.pages[0];
+    for (int i = 0; i < LIBRARY_PAGE_COUNT; i++) {
+        if (previous.pages[i].offset == page_offset) {
+            page = &previous.pages[i];
+            break;
+        }
+        if (previous.pages[i].last_use < page->last_use) {
+            page = &previous.pages[i];
+        }
+    }
+
+    if (page->offset != page_offset) {
+        UINT bytes_read;
+        page->offset = NO_PAGE;
+        if (f_lseek(&index_file, page_offset) != FR_OK ||
+            f_read(&index_file, page->data, LIBRARY_PAGE_SIZE, &bytes_read) != FR_OK) {
+            previous.read_failed = true;
+            return NULL;
+        }
+        page->offset = page_offset;
+        page->size = bytes_read;
+    }
+    page->last_use = ++previous.use_count;
+    if (offset - page_offset >= page->size) {
+        return NULL;
+    }
+    *available = page->size - (offset - page_offset);
+    return page->data + (offset - page_offset);
+}
+
+static int read_previous(uint32_t offset, void *buffer, uint32_t size) {
+    uint8_t *destination = buffer;
+    while (size > 0) {
+        uint32_t available;
+        const uint8_t *data = read_previous_page(offset, &available);
+        if (data == NULL) {
+            return 1;
+        }
+        const uint32_t length = MIN(size, available);
+        memcpy(destination, data, length);
+        destination += length;
+        offset += length;
+        size -= length;
+    }
+    return 0;
+}
+
+// A string of the previous index, truncated to the buffer. An offset outside of the pool reads as the empty
+// string, a corrupt index must not make the scan read past it.
+static const char *read_previous_string(uint32_t offset, char *buffer, size_t size) {
+    size_t length = 0;
+    if (offset < previous.header.strings_size) {
+        while (length + 1 < size) {
+            uint32_t available;
+            const uint8_t *data = read_previous_page(previous.strings_offset + offset + length, &available);
+            if (data == NULL) {
+                break;
+            }
+            const uint8_t *end = memchr(data, '\0', MIN(available, size - 1 - length));
+            const size_t copied = end != NULL ? (size_t) (end - data) : MIN(available, size - 1 - length);
+            memcpy(buffer + length, data, copied);
+            length += copied;
+            if (end != NULL) {
+                break;
+            }
+        }
+    }
+    buffer[length] = '\0';
+    return buffer;
+}
+
+static int read_previous_track(uint32_t index, LibraryTrack *track) {
+    return read_previous(previous.tracks_offset + index * sizeof(LibraryTrack), track, sizeof(LibraryTrack));
+}
+
+static int compare_previous_path_offsets(const void *a, const void *b) {
+    const uint32_t path_a = previous.directories[*(const uint16_t *) a].path;
+    const uint32_t path_b = previous.directories[*(const uint16_t *) b].path;
+    return (path_a > path_b) - (path_a < path_b);
+}
+
+// Copies the directory paths out of the string pool, in the order they are stored so the pages are read once
+static int load_previous_paths(void) {
+    const uint32_t count = previous.header.directory_count;
+    uint32_t size = 1;
+
+    previous.paths[0] = '\0';
+    for (uint32_t i = 0; i < count; i++) {
+        directory_order[i] = i;
+    }
+    qsort(directory_order, count, sizeof(uint16_t), compare_previous_path_offsets);
+    for (uint32_t i = 0; i < count; i++) {
+        LibraryDirectory *directory = &previous.directories[directory_order[i]];
+        if (directory->path == 0) {
+            continue;
+        }
+        if (LIBRARY_PREVIOUS_PATHS_SIZE - size <= LIBRARY_MAX_PATH_LENGTH) {
+            return 1;
+        }
+        read_previous_string(directory->path, previous.paths + size, LIBRARY_MAX_PATH_LENGTH + 1);
+        directory->path = size;
+        size += strlen(previous.paths + size) + 1;
+    }
+    return 0;
+}
+
+static void close_previous_library(void) {
+    if (previous.open) {
+        f_close(&index_file);
+        previous.open = false;
+    }
+    previous.header.directory_count = 0;
+}
+
+static void open_previous_library(void) {
+    previous.header.directory_count = 0;
+    previous.read_failed = false;
+    previous.use_count = 0;
+    for (int i = 0; i < LIBRARY_PAGE_COUNT; i++) {
+        previous.pages[i].offset = NO_PAGE;
+        previous.pages[i].last_use = 0;
+    }
+    if (f_open(&index_file, LIBRARY_INDEX_PATH, FA_READ) != FR_OK) {
+        return;
+    }
+    previous.open = true;
+
+    LibraryFileHeader *header = &previous.header;
+    int result = read_array(header, sizeof(LibraryFileHeader));
+    if (result == 0 && !is_header_valid(header)) {
+        result = 1;
+    }
+    if (result == 0) {
+        result = read_array(previous.directories, header->directory_count * sizeof(LibraryDirectory)) ||
+                 !are_directories_valid(previous.directories, header);
+    }
+    if (result == 0) {
+        previous.tracks_offset = sizeof(LibraryFileHeader) + header->directory_count * sizeof(LibraryDirectory);
+        previous.strings_offset = previous.tracks_offset + header->track_count * sizeof(LibraryTrack);
+        if (load_previous_paths() != 0) {
+            log_warn("Directory paths of the library index do not fit in memory, reading every directory");
+            result = 1;
+        }
+    }
+    if (result != 0 || previous.read_failed) {
+        log_warn("Library index is invalid, ignoring it");
+        close_previous_library();
+        previous.read_failed = false;
+    }
+}
+
+static int add_directory(LibraryIndex *index, const char *path, uint16_t date, uint16_t time) {
+    if (index->directory_count == LIBRARY_MAX_DIRECTORIES) {
+        log_error("Library is limited to %d directories, skipping %s", LIBRARY_MAX_DIRECTORIES, path);
+        return 1;
+    }
+    index->directories[index->directory_count++] = (LibraryDirectory) {
+            .path = intern_string(index, path),
+            .first_track = 0,
+            .track_count = 0,
+            .date = date,
+            .time = time
+    };
+    return 0;
+}
+
+static LibraryTrack *add_track(LibraryIndex *index, uint32_t directory) {
+    if (index->track_count == LIBRARY_MAX_TRACKS) {
+        log_error("Library is limited to %d tracks", LIBRARY_MAX_TRACKS);
+        return NULL;
+    }
+    LibraryTrack *track = &index->tracks[index->track_count++];
+    memset(track, 0, sizeof(LibraryTrack));
+    track->directory = directory;
+    return track;
+}
+
+static void copy_previous_track(uint32_t directory, const LibraryTrack *source_track) {
+    static char string[LIBRARY_MAX_PATH_LENGTH + 1];
+
+    LibraryTrack *track = add_track(&library, directory);
+    if (track == NULL) {
+        return;
+    }
+    *track = *source_track;
+    track->directory = directory;
+    track->name = intern_string(&library, read_previous_string(source_track->name, string, sizeof(string)));
+    track->title = intern_string(&library, read_previous_string(source_track->title, string, sizeof(string)));
+    track->artist = intern_repeated_string(&library, read_previous_string(source_track->artist, string,
+                                                                          sizeof(string)), &last_artist);
+    track->album = intern_repeated_string(&library, read_previous_string(source_track->album, string,
+                                                                         sizeof(string)), &last_album);
+}
+
+static bool find_previous_track(int directory, const char *name, LibraryTrack *track) {
+    static char track_name[LIBRARY_MAX_PATH_LENGTH + 1];
+
+    const LibraryDirectory *dir = &previous.directories[directory];
+    int low = (int) dir->first_track;
+    int high = (int) (dir->first_track + dir->track_count) - 1;
+    while (low <= high) {
+        const int middle = (low + high) / 2;
+        if (read_previous_track(middle, track) != 0) {
+            return false;
+        }
+        const int order = compare_paths(name, read_previous_string(track->name, track_name, sizeof(track_name)));
+        if (order == 0) {
+            return true;
+        }
+        if (order < 0) {
+            high = middle - 1;
+        } else {
+            low = middle + 1;
+        }
+    }
+    return false;
+}
+
+static int probe_track(LibraryIndex *index, uint32_t directory, const char *path, const FILINFO *file_info) {
+    static FlacFileInfo info;
+
+    if (f_open(&track_file, path, FA_READ) != FR_OK) {
+        log_warn("Cannot open %s", path);
+        return 1;
+    }
+    const int result = probe_flac_file(&track_file, &info);
+    f_close(&track_file);
+    if (result != 0 || info.sample_rate == 0) {
+        log_warn("Not a FLAC stream, skipping %s", path);
+        return 1;
+    }
+
+    LibraryTrack *track = add_track(index, directory);
+    if (track == NULL) {
+        return 1;
+    }
+    *track = (LibraryTrack) {
+            .name = intern_string(index, file_info->fname),
+            .title = intern_string(index, info.title),
+            .artist = intern_repeated_string(index, info.artist, &last_artist),
+            .album = intern_repeated_string(index, info.album, &last_album),
+            .file_size = (uint32_t) file_info->fsize,
+            .duration_ms = (uint32_t) (info.total_samples * 1000 / info.sample_rate),
+            .sample_rate = info.sample_rate,
+            .directory = directory,
+            .date = file_info->fdate,
+            .time = file_info->ftime,
+            .bits_per_sample = info.bits_per_sample,
+            .channels = info.channels,
+            .track_number = info.track_number
+    };
+    return 0;
+}
+
+// Unchanged directory: its tracks come from the previous index and its files are not listed. A leaf directory
+// is not read at all, the others only for the timestamps of their subdirectories.
+static void reuse_directory(DirWalker *walker, uint32_t directory, int previous_directory, LibraryScanStats *stats) {
+    const LibraryDirectory *directory_entry = &previous.directories[previous_directory];
+    for (uint32_t i = 0; i < directory_entry->track_count; i++) {
+        LibraryTrack track;
+        if (read_previous_track(directory_entry->first_track + i, &track) == 0) {
+            copy_previous_track(directory, &track);
+        }
+    }
+    stats->tracks_reused += directory_entry->track_count;
+    stats->directories_reused++;
+
+    // Everything inside a directory directly follows it in the sorted index
+    const char *path = previous.paths + directory_entry->path;
+    const size_t length = strlen(path);
+    const bool has_subdirectories = previous_directory + 1 < (int) previous.header.directory_count &&
+                                    strncmp(previous.paths + directory_entry[1].path, path, length) == 0 &&
+                                    previous.paths[directory_entry[1].path + length] == '/';
+    if (has_subdirectories) {
+        walker_skip_files(walker);
+    } else {
+        walker_skip_directory(walker);
+    }
+}
+
+static void scan_file(const DirWalker *walker, uint32_t directory, int previous_directory, LibraryScanMode mode,
+                      LibraryScanStats *stats) {
+    const FILINFO *file_info = &walker->info;
+    LibraryTrack previous_track;
+    const bool found = mode == LIBRARY_SCAN_INCREMENTAL && previous_directory >= 0 &&
+                       find_previous_track(previous_directory, file_info->fname, &previous_track);
+
+    if (found && previous_track.file_size == (uint32_t) file_info->fsize &&
+        previous_track.date == file_info->fdate && previous_track.time == file_info->ftime) {
+        copy_previous_track(directory, &previous_track);
+        stats->tracks_reused++;
+    } else if (probe_track(&library, directory, walker->file_path, file_info) == 0) {
+        stats->tracks_probed++;
+    }
+}
+
+static int compare_directory_order(const void *a, const void *b) {
+    const LibraryDirectory *directories = library.directories;
+    return compare_paths(index_string(&library, directories[*(const uint16_t *) a].path),
+                         index_string(&library, directories[*(const uint16_t *) b].path));
+}
+
+static int compare_tracks(const void *a, const void *b) {
+    const LibraryTrack *track_a = a;
+    const LibraryTrack *track_b = b;
+    if (track_a->directory != track_b->directory) {
+        return directory_rank[track_a->directory] - directory_rank[track_b->directory];
+    }
+    return compare_paths(index_string(&library, track_a->name), index_string(&library, track_b->name));
+}
+
+// Directories were added breadth first, sorting them by path and the tracks by (directory, name) makes lookups binary
+static void sort_library(void) {
+    LibraryIndex *index = &library;
+
+    for (uint32_t i = 0; i < index->directory_count; i++) {
+        directory_order[i] = i;
+    }
+    qsort(directory_order, index->directory_count, sizeof(uint16_t), compare_directory_order);
+    for (uint32_t i = 0; i < index->directory_count; i++) {
+        directory_rank[directory_order[i]] = i;
+    }
+    qsort(index->tracks, index->track_count, sizeof(LibraryTrack), compare_tracks);
+    for (uint32_t i = 0; i < index->track_count; i++) {
+        index->tracks[i].directory = directory_rank[index->tracks[i].directory];
+    }
+
+    // Moves every directory to its rank by following the cycles of the permutation
+    for (uint32_t i = 0; i < index->directory_count; i++) {
+        while (directory_rank[i] != i) {
+            const uint16_t target = directory_rank[i];
+            const LibraryDirectory directory = index->directories[target];
+            index->directories[target] = index->directories[i];
+            index->directories[i] = directory;
+            directory_rank[i] = directory_rank[target];
+            directory_rank[target] = target;
+        }
+    }
+
+    for (uint32_t i = 0; i < index->directory_count; i++) {
+        index->directories[i].first_track = 0;
+        index->directories[i].track_count = 0;
+    }
+    for (uint32_t i = 0; i < index->track_count; i++) {
+        LibraryDirectory *directory = &index->directories[index->tracks[i].directory];
+        if (directory->track_count++ == 0) {
+            directory->first_track = i;
+        }
+    }
+}
+
+// Compares the header of the index file, not the file itself, so an unchanged card is not read twice per boot
+static bool library_matches_previous(void) {
+    const LibraryFileHeader *header = &previous.header;
+    return previous.open && header->track_count == library.track_count &&
+           header->directory_count == library.directory_count && header->strings_size == library.strings_size &&
+           header->checksum == index_checksum(&library);
+}
+
+static void clear_library(void) {
+    library.track_count = 0;
+    library.directory_count = 0;
+    library.strings_size = 1;
+    library.strings[0] = '\0';
+}
+
+int scan_library(LibraryScanMode mode, const DirWalkerCallbacks *callbacks, LibraryScanStats *stats) {
+    static DirWalker walker;
+    uint32_t directory = 0;
+    int previous_directory = -1;
+
+    memset(stats, 0, sizeof(LibraryScanStats));
+
+    // The scan rebuilds the index in place, a cancelled or failed one restores it from the card
+    DirWalkerCallbacks scan_callbacks = {0};
+    if (callbacks != NULL) {
+        scan_callbacks = *callbacks;
+    }
+    if (!library_saved && library.directory_count != 0 && save_library() != 0) {
+        log_warn("The library index is not on the card, the scan cannot be cancelled");
+        scan_callbacks.cancelled = NULL;
+    }
+
+    log_info("Scanning library (%s)", mode == LIBRARY_SCAN_FULL ? "full" : "incremental");
+    open_previous_library();
+    clear_library();
+    library_saved = false;
+    last_artist = 0;
+    last_album = 0;
+
+    walker_init(&walker, "", "*.flac", walker_memory, LIBRARY_WALKER_MEMORY_SIZE, &scan_callbacks);
+    DirWalkerEvent event;
+    while ((event = walker_step(&walker)) == DIR_WALKER_DIRECTORY || event == DIR_WALKER_FILE) {
+        if (previous.read_failed) {
+            break;
+        }
+        if (event == DIR_WALKER_FILE) {
+            scan_file(&walker, directory, previous_directory, mode, stats);
+            continue;
+        }
+
+        if (add_directory(&library, walker.path, walker.date, walker.time) != 0) {
+            walker_skip_directory(&walker);
+            continue;
+        }
+        directory = library.directory_count - 1;
+        previous_directory = find_directory(previous.directories, previous.header.directory_count, previous.paths,
+                                            walker.path);
+
+        // The root has no timestamp and is always read
+        if (mode == LIBRARY_SCAN_INCREMENTAL && directory != 0 && previous_directory >= 0 &&
+            previous.directories[previous_directory].date == walker.date &&
+            previous.directories[previous_directory].time == walker.time) {
+            reuse_directory(&walker, directory, previous_directory, stats);
+        } else {
+            stats->directories_read++;
+        }
+    }
+    walker_close(&walker);
+    if (previous.read_failed) {
+        log_error("Cannot read %s", LIBRARY_INDEX_PATH);
+        event = DIR_WALKER_ERROR;
+    }
+
+    if (event != DIR_WALKER_DONE) {
+        close_previous_library();
+        log_warn("Library scan %s, restoring the previous index",
+                 event == DIR_WALKER_CANCELLED ? "cancelled" : "failed");
+        if (load_library() != 0) {
+            clear_library();
+        }
+        return 1;
+    }
+
+    sort_library();
+    library_scan_changed = !library_matches_previous();
+    library_saved = !library_scan_changed;
+    close_previous_library();
+
+    stats->elapsed_ms = walker.stats.elapsed_ms;
+    log_success("Library: %lu tracks in %lu directories, %lu read, %lu unchanged, %lu files probed, %lu ms",
+                (unsigned long) library.track_count, (unsigned long) library.directory_count,
+                (unsigned long) stats->directories_read, (unsigned long) stats->directories_reused,
+                (unsigned long) stats->tracks_probed, (unsigned long) stats->elapsed_ms);
+    return 0;
+}
+
+bool library_changed(void) {
+    return library_scan_changed;
+}
+
+// A corrupt index must not produce offsets outside of the pools
+static bool is_index_valid(const LibraryIndex *index) {
+    if (index->strings[0] != '\0' || index->strings[index->strings_size - 1] != '\0') {
+        return false;
+    }
+    for (uint32_t i = 0; i < index->track_count; i++) {
+        const LibraryTrack *track = &index->tracks[i];
+        if (track->name >= index->strings_size || track->title >= index->strings_size ||
+            track->artist >= index->strings_size || track->album >= index->strings_size ||
+            track->directory >= index->directory_count) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int load_library(void) {
+    LibraryFileHeader header;
+
+    if (f_open(&index_file, LIBRARY_INDEX_PATH, FA_READ) != FR_OK) {
+        log_info("No library index on the card");
+        return 1;
+    }
+
+    int result = read_array(&header, sizeof(header));
+    if (result == 0 && !is_header_valid(&header)) {
+        result = 1;
+    }
+    if (result == 0) {
+        library.track_count = header.track_count;
+        library.directory_count = header.directory_count;
+        library.strings_size = header.strings_size;
+        result = read_array(library.directories, header.directory_count * sizeof(LibraryDirectory)) ||
+                 read_array(library.tracks, header.track_count * sizeof(LibraryTrack)) ||
+                 read_array(library.strings, header.strings_size) ||
+                 header.checksum != index_checksum(&library) ||
+                 !are_directories_valid(library.directories, &header) || !is_index_valid(&library);
+    }
+    f_close(&index_file);
+
+    if (result != 0) {
+        log_warn("Library index is invalid, ignoring it");
+        clear_library();
+        return 1;
+    }
+
+    library_saved = true;
+    log_info("Library index loaded: %lu tracks", (unsigned long) library.track_count);
+    return 0;
+}
+
+// Written next to the old index and renamed over it, so power loss never leaves a torn index behind
+int save_library(void) {
+    const LibraryFileHeader header = {
+            .magic = LIBRARY_MAGIC,
+            .version = LIBRARY_VERSION,
+            .track_count = library.track_count,
+            .directory_count = library.directory_count,
+            .strings_size = library.strings_size,
+            .checksum = index_checksum(&library)
+    };
+
+    if (f_open(&index_file, LIBRARY_INDEX_TEMP_PATH, FA_CREATE_ALWAYS | FA_WRITE) != FR_OK) {
+        log_error("Cannot create %s", LIBRARY_INDEX_TEMP_PATH);
+        return 1;
+    }
+    int result = write_array(&header, sizeof(header)) ||
+                 write_array(library.directories, library.directory_count * sizeof(LibraryDirectory)) ||
+                 write_array(library.tracks, library.track_count * sizeof(LibraryTrack)) ||
+                 write_array(library.strings, library.strings_size);
+    if (f_close(&index_file) != FR_OK) {
+        result = 1;
+    }
+
+    if (result != 0) {
+        log_error("Cannot write the library index");
+        f_unlink(LIBRARY_INDEX_TEMP_PATH);
+        return 1;
+    }
+    f_unlink(LIBRARY_INDEX_PATH);
+    if (f_rename(LIBRARY_INDEX_TEMP_PATH, LIBRARY_INDEX_PATH) != FR_OK) {
+        log_error("Cannot rename %s", LIBRARY_INDEX_TEMP_PATH);
+        return 1;
+    }
+    library_saved = true;
+    log_success("Library index saved");
+    return 0;
+}
+
+// The index on the card is not loaded, the incremental scan reads what it reuses from it
+int open_library(const DirWalkerCallbacks *callbacks) {
+    LibraryScanStats stats;
+    const uint32_t start = osKernelSysTick();
+
+    if (scan_library(LIBRARY_SCAN_INCREMENTAL, callbacks, &stats) != 0) {
+        // A failed scan restores the index from the card, the player can still run on it
+        return !library_saved;
+    }
+    if (library_changed()) {
+        save_library();
+    }
+    log_info("Library ready after %lu ms", (unsigned long) (osKernelSysTick() - start));
+    return 0;
+}
+
+uint32_t library_track_count(void) {
+    return library.track_count;
+}
+
+const LibraryTrack *library_get_track(uint32_t index) {
+    return index < library.track_count ? &library.tracks[index] : NULL;
+}
+
+const char *library_string(uint32_t offset) {
+    return index_string(&library, offset);
+}
+
+int library_get_path(uint32_t index, char *path, size_t size) {
+    const LibraryTrack *track = library_get_track(index);
+    if (track == NULL) {
+        return 1;
+    }
+    const char *directory = index_string(&library, library.directories[track->directory].path);
+    const int length = snprintf(path, size, "%s/%s", directory, index_string(&library, track->name));
+    return length < 0 || (size_t) length >= size;
+}
+
+bool library_find(const char *path, uint32_t *index) {
+    char directory_path[LIBRARY_MAX_PATH_LENGTH + 1];
+    const char *name = strrchr(path, '/');
+    if (name == NULL || (size_t) (name - path) > LIBRARY_MAX_PATH_LENGTH) {
+        return false;
+    }
+    memcpy(directory_path, path, name - path);
+    directory_path[name - path] = '\0';
+
+    const int directory = find_directory(library.directories, library.directory_count, library.strings,
+                                         directory_path);
+    if (directory < 0) {
+        return false;
+    }
+    const LibraryTrack *track = find_track(&library, directory, name + 1);
+    if (track == NULL) {
+        return false;
+    }
+    *index = track - library.tracks;
+    return true;
+}
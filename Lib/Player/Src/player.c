@@ -1,41 +1,279 @@
 #include <assert.h>
+#include <string.h>
+#include "i2c_bus.h"
 #include "player.h"
-#include "files.h"
+#include "profiler.h"
+#include "rewind_buffer.h"
+#include "stream_cache.h"
+#include "visualizer.h"
+#include "waveform.h"
+
+// The SAI carries 16-bit stereo
+#define OUTPUT_FRAME_BYTES (2 * AUDIODATA_SIZE)
+#define CODEC_VOLUME 10
+
+extern SAI_HandleTypeDef haudio_out_sai;
 
 static uint8_t audio_buffer[AUDIO_BUFFER_SIZE];
-static uint8_t audio_buffer_state = BUFFER_OFFSET_NONE;
+static volatile uint8_t audio_buffer_state = BUFFER_OFFSET_NONE;
 static unsigned last_audio_buffer_state_change_time = 0;
 
-static PlayerState player_state = STOPPED;
+// Set when the DMA hands a half back for refilling, cleared once update_player has filled it
+static volatile bool refill_pending = false;
+static volatile unsigned underrun_count = 0;
+static unsigned reported_underrun_count = 0;
+
+static volatile PlayerState player_state = STOPPED;
 static uint64_t samples_played = 0;
 
-static FIL current_audio_file;
 static Flac *flac;
 static FlacReader *flac_reader;
 static FlacMetaData flac_metadata;
 
+// While replaying, the buffer halves are filled from the rewind buffer and the decoder waits where it stopped,
+// at the rewind buffer end, so live decoding resumes there without a seek
+static bool replaying = false;
+static uint64_t replay_position = 0;
+
+// The SAI DMA runs from the first start on and only stops for a sample rate change, so a track change
+// costs neither a codec power cycle over I2C nor the pop that comes with it
+static bool output_running = false;
+static bool output_paused = false;
+static uint32_t output_frequency = 0;
+static PlayerOutputStats output_stats;
+
+// Latency probe: cycles of the event a start answers, until the first non-silent sample of the track is found
+static bool probe_armed = false;
+static uint32_t probe_event_cycles;
+
+// The DMA moves on to the half it handed back at the previous callback, if that was not refilled yet
+// the stale samples are played again
+static void check_refill_deadline(void) {
+    if (refill_pending) {
+        underrun_count++;
+    }
+    refill_pending = true;
+}
+
+// A stopped player leaves the output running, the halves the DMA hands back are silenced right here so
+// the end of the last track is not repeated however long the controller is busy
+static void hand_back(BufferState half) {
+    if (player_state == STOPPED) {
+        memset(&audio_buffer[half == BUFFER_OFFSET_HALF ? 0 : AUDIO_BUFFER_SIZE / 2], 0, AUDIO_BUFFER_SIZE / 2);
+        refill_pending = false;
+        return;
+    }
+    check_refill_deadline();
+    audio_buffer_state = half;
+}
+
 void BSP_AUDIO_OUT_HalfTransfer_CallBack(void) {
-    audio_buffer_state = BUFFER_OFFSET_HALF;
+    hand_back(BUFFER_OFFSET_HALF);
     unsigned t = osKernelSysTick();
     log_debug("[%u] TransferredFirstHalf (%u)\n", t, t - last_audio_buffer_state_change_time);
     last_audio_buffer_state_change_time = t;
 }
 
 void BSP_AUDIO_OUT_TransferComplete_CallBack(void) {
-    audio_buffer_state = BUFFER_OFFSET_FULL;
+    hand_back(BUFFER_OFFSET_FULL);
     unsigned t = osKernelSysTick();
     log_debug("[%u] TransferredSecondHalf (%u)\n", t, t - last_audio_buffer_state_change_time);
     last_audio_buffer_state_change_time = t;
 }
 
-void initialize_codec(void) {
-    log_info("Initializing audio codec");
-    if (BSP_AUDIO_OUT_Init(OUTPUT_DEVICE_HEADPHONE1, 10, AUDIO_FREQUENCY_44K) == 0) {
-        log_success("Audio codec was successfully initialized");
+static unsigned get_frame_bytes(void) {
+    return flac_metadata.channels * (flac_metadata.bits_per_sample / 8);
+}
+
+static unsigned fill_buffer(uint8_t *buffer, unsigned size) {
+    unsigned filled = 0;
+    if (replaying) {
+        filled = rewind_buffer_read(replay_position, buffer, size);
+        replay_position += filled;
+        if (replay_position == rewind_buffer_end()) {
+            replaying = false;
+            log_info("Rewind caught up, decoding again");
+        }
+    }
+    if (filled < size) {
+        const unsigned decoded = read_flac(flac_reader, buffer + filled, size - filled);
+        rewind_buffer_append(buffer + filled, decoded);
+        filled += decoded;
+    }
+    return filled;
+}
+
+// Byte of the audio buffer the DMA reads next, NDTR counts the half-words left to the end of the buffer
+static unsigned get_output_position(void) {
+    const unsigned remaining = __HAL_DMA_GET_COUNTER(haudio_out_sai.hdmatx) * AUDIODATA_SIZE;
+    return (AUDIO_BUFFER_SIZE - remaining) % AUDIO_BUFFER_SIZE;
+}
+
+static uint32_t output_bytes_to_us(unsigned bytes) {
+    return (uint32_t) ((uint64_t) bytes * 1000000 / ((uint64_t) output_frequency * OUTPUT_FRAME_BYTES));
+}
+
+// The DMA sends a byte written ahead of it once it has read everything in between, so the time the first
+// non-silent sample goes out follows from the DMA position when it is written
+static void check_latency_probe(unsigned offset, unsigned size) {
+    if (!probe_armed) {
+        return;
+    }
+    for (unsigned i = 0; i + AUDIODATA_SIZE <= size; i += AUDIODATA_SIZE) {
+        int16_t sample;
+        memcpy(&sample, &audio_buffer[offset + i], sizeof(sample));
+        if (sample == 0) {
+            continue;
+        }
+        // Before the first start the DMA is about to begin at the start of the buffer
+        const unsigned position = output_running ? get_output_position() : 0;
+        const unsigned ahead = (offset + i - position + AUDIO_BUFFER_SIZE) % AUDIO_BUFFER_SIZE;
+        const uint32_t latency_us = (profiler_cycles() - probe_event_cycles) / (profiler_clock_hz() / 1000000) +
+                                    output_bytes_to_us(ahead);
+        probe_armed = false;
+        output_stats.probes++;
+        output_stats.last_latency_us = latency_us;
+        output_stats.total_latency_us += latency_us;
+        if (latency_us > output_stats.max_latency_us) {
+            output_stats.max_latency_us = latency_us;
+        }
+        log_info("First sound %lu us after the event", (unsigned long) latency_us);
+        return;
+    }
+}
+
+// Fills part of the audio buffer with the track, returns the bytes filled
+static unsigned fill_output(unsigned offset, unsigned size) {
+    const unsigned filled = fill_buffer(&audio_buffer[offset], size);
+    samples_played += filled / get_frame_bytes();
+    check_latency_probe(offset, filled);
+    visualizer_tap(&audio_buffer[offset], filled, flac_metadata.channels, flac_metadata.bits_per_sample / 8);
+    return filled;
+}
+
+static void add_frame_peaks(const FlacFrame *frame, void *context) {
+    waveform_add_frame(frame->sample_number, frame->samples, frame->min, frame->max);
+}
+
+static void init_codec(uint32_t frequency) {
+    i2c_bus_lock();
+    const uint8_t result = BSP_AUDIO_OUT_Init(OUTPUT_DEVICE_HEADPHONE1, CODEC_VOLUME, frequency);
+    i2c_bus_unlock();
+    if (result == 0) {
+        log_success("Audio codec was successfully initialized for %lu Hz", (unsigned long) frequency);
     } else {
         log_error("Failed to initialize audio codec");
     }
     BSP_AUDIO_OUT_SetAudioFrameSlot(CODEC_AUDIOFRAME_SLOT_02);
+    output_frequency = frequency;
+}
+
+void initialize_codec(void) {
+    log_info("Initializing audio codec");
+    if (i2c_bus_init() != 0) {
+        log_error("Failed to create the I2C bus lock");
+    }
+    init_codec(AUDIO_FREQUENCY_44K);
+}
+
+// Stops the DMA and sets the codec up again, only when the track's sample rate differs from the output's
+static void configure_output(uint32_t frequency) {
+    if (frequency == output_frequency) {
+        return;
+    }
+    log_info("Sample rate changes to %lu Hz, reconfiguring the audio codec", (unsigned long) frequency);
+    if (output_running) {
+        i2c_bus_lock();
+        BSP_AUDIO_OUT_Stop(CODEC_PDWN_SW);
+        i2c_bus_unlock();
+        output_running = false;
+        output_paused = false;
+    }
+    init_codec(frequency);
+    output_stats.codec_reconfigurations++;
+}
+
+// Starts the DMA on a buffer whose first half holds the start of the track
+static int start_output(void) {
+    unsigned bytes_read = fill_output(0, AUDIO_BUFFER_SIZE / 2);
+    memset(&audio_buffer[bytes_read], 0, AUDIO_BUFFER_SIZE - bytes_read);
+
+    // The second half is refilled at once, while the DMA sends the first
+    audio_buffer_state = BUFFER_OFFSET_FULL;
+    refill_pending = true;
+    last_audio_buffer_state_change_time = HAL_GetTick();
+
+    log_info("Starting audio output");
+    output_running = true;
+    output_stats.output_starts++;
+    i2c_bus_lock();
+    BSP_AUDIO_OUT_Play((uint16_t *) audio_buffer, AUDIO_BUFFER_SIZE);
+    BSP_AUDIO_OUT_Resume();
+    i2c_bus_unlock();
+    return bytes_read < AUDIO_BUFFER_SIZE / 2;
+}
+
+static void resume_output(void) {
+    i2c_bus_lock();
+    BSP_AUDIO_OUT_Resume();
+    i2c_bus_unlock();
+    output_paused = false;
+}
+
+// Writes the start of the track PLAYER_START_MARGIN bytes behind the DMA, in the half it is reading, then
+// fills the other half; from there on the half callbacks go on as usual
+static int join_output(void) {
+    const unsigned half_size = AUDIO_BUFFER_SIZE / 2;
+    audio_buffer_state = BUFFER_OFFSET_NONE;
+    refill_pending = false;
+
+    const unsigned position = get_output_position();
+    const unsigned half_end = (position / half_size + 1) * half_size;
+    unsigned start = position + PLAYER_START_MARGIN;
+    start -= start % OUTPUT_FRAME_BYTES;
+    // Too close to the end of the half, the track starts with the next one
+    const unsigned first_size = start < half_end ? half_end - start : half_size;
+    if (start >= half_end) {
+        start = half_end % AUDIO_BUFFER_SIZE;
+    }
+
+    output_stats.joined_starts++;
+    unsigned bytes_read = fill_output(start, first_size);
+    const unsigned passed = (get_output_position() - start + AUDIO_BUFFER_SIZE) % AUDIO_BUFFER_SIZE;
+    if (passed < first_size) {
+        // The DMA overtook the decoder, the start of the track was lost to silence
+        output_stats.late_joins++;
+        log_warn("Audio output passed the start of the track by %lu us", (unsigned long) output_bytes_to_us(passed));
+    }
+    if (first_size != half_size && bytes_read == first_size) {
+        bytes_read += fill_output(half_end % AUDIO_BUFFER_SIZE, half_size);
+    } else if (bytes_read < first_size) {
+        memset(&audio_buffer[start + bytes_read], 0, first_size - bytes_read);
+    }
+    return bytes_read < first_size + (first_size != half_size ? half_size : 0);
+}
+
+// The output keeps running, whatever is left of the track in the audio buffer plays out
+static void release_track(void) {
+    player_state = STOPPED;
+
+    log_info("Destroying flac reader");
+    free_flac_reader(flac_reader);
+    destroy_flac(flac);
+
+    // The stream cache keeps the file, and the prefetched next one, for the next start_player
+    samples_played = 0;
+}
+
+// The SAI sends 16-bit stereo frames and the decoder writes the samples as they are in the file, any other
+// layout would come out as noise
+static bool is_output_format(const FlacMetaData *format) {
+    if (format->bits_per_sample == 16 && format->channels == 2) {
+        return true;
+    }
+    log_warn("Cannot play %u-bit audio with %u channels, the output takes 16-bit stereo only",
+             format->bits_per_sample, format->channels);
+    return false;
 }
 
 void start_player(const char* file_path) {
@@ -43,43 +281,58 @@ void start_player(const char* file_path) {
 
     assert(player_state == STOPPED);
 
-    player_state = PLAYING;
-    open_file(file_path, &current_audio_file);
+    if (stream_cache_open(file_path) != 0) {
+        probe_armed = false;
+        return;
+    }
+    replaying = false;
+    rewind_buffer_reset();
 
     log_info("Creating FLAC reader");
-    flac = create_flac(&current_audio_file);
+    flac = create_flac_stream(stream_cache_read, NULL);
     flac_reader = create_flac_reader(flac);
+    set_flac_frame_callback(flac_reader, add_frame_peaks, NULL);
 
     log_info("Reading FLAC metadata");
-    // TODO - handle errors instead of returning from a function
-    if (read_metadata(flac, &flac_metadata) == 1) return;
+    if (read_metadata(flac, &flac_metadata) != 0 || !is_output_format(&flac_metadata)) {
+        log_warn("Not starting %s", file_path);
+        probe_armed = false;
+        release_track();
+        return;
+    }
+    waveform_start(file_path, stream_cache_file_size(), flac_metadata.total_samples, flac_metadata.bits_per_sample);
 
     log_info("Reading FLAC file into buffer");
-    // Fill the first half of the buffer
-    unsigned bytes_to_read = AUDIO_BUFFER_SIZE / 2;
-    unsigned bytes_read = read_flac(flac_reader, audio_buffer, bytes_to_read);
-    if (bytes_read < bytes_to_read) {
+    configure_output(flac_metadata.sample_rate);
+    // Until here the half callbacks kept silencing a running output and counted no missed refills
+    player_state = PLAYING;
+    const int reached_end = output_running ? join_output() : start_output();
+    if (output_paused) {
+        resume_output();
+    }
+    if (reached_end) {
+        // What was decoded still plays, the rest of the buffer is silence already
         log_info("Reached end of file");
-        stop_player();
+        release_track();
         return;
     }
 
-    audio_buffer_state = BUFFER_OFFSET_HALF;
-    last_audio_buffer_state_change_time = HAL_GetTick();
-
-    log_info("Starting playing audio file");
-    BSP_AUDIO_OUT_Play(audio_buffer, AUDIO_BUFFER_SIZE);
-    BSP_AUDIO_OUT_Resume();
-
     log_info("Started playing");
 }
 
+void prefetch_next_track(const char *file_path) {
+    stream_cache_prefetch(file_path);
+}
+
 void pause_player(void) {
     log_info("Pausing player");
 
     assert(player_state == PLAYING);
 
+    i2c_bus_lock();
     BSP_AUDIO_OUT_Pause();
+    i2c_bus_unlock();
+    output_paused = true;
     player_state = PAUSED;
 }
 
@@ -88,7 +341,7 @@ void resume_player(void) {
 
     assert(player_state == PAUSED);
 
-    BSP_AUDIO_OUT_Resume();
+    resume_output();
     player_state = PLAYING;
 }
 
@@ -97,19 +350,86 @@ void stop_player(void) {
 
     assert(player_state == PLAYING || player_state == PAUSED);
 
-    log_info("Stopping audio codec");
-    BSP_AUDIO_OUT_Stop(CODEC_PDWN_SW);
-    player_state = STOPPED;
+    // The DMA keeps going on silence, a paused output stays paused until the next start
+    memset(audio_buffer, 0, sizeof(audio_buffer));
+    release_track();
 
-    log_info("Destroying flac reader");
-    free_flac_reader(flac_reader);
-    destroy_flac(flac);
+    log_info("Stopped playing");
+}
 
-    log_info("Closing file");
-    f_close(&current_audio_file);
-    samples_played = 0;
+int rewind_player(unsigned seconds) {
+    const unsigned frame_bytes = get_frame_bytes();
+    if (player_state == STOPPED || frame_bytes == 0 || flac_metadata.sample_rate == 0) {
+        return 1;
+    }
+    const uint64_t current = replaying ? replay_position : rewind_buffer_end();
+    const uint64_t step = (uint64_t) seconds * flac_metadata.sample_rate * frame_bytes;
+
+    // Tracks above CD rate keep less than the full step, and a seek empties the buffer: the decoder seeks to
+    // what the buffer no longer holds
+    const uint64_t kept_samples = (current - rewind_buffer_start()) / frame_bytes;
+    const uint64_t step_samples = (uint64_t) seconds * flac_metadata.sample_rate;
+    if (kept_samples < step_samples && samples_played > kept_samples) {
+        const uint64_t target_sample = samples_played > step_samples ? samples_played - step_samples : 0;
+        log_info("Rewinding past the rewind buffer with a seek");
+        return seek_player((double) target_sample / (double) flac_metadata.total_samples);
+    }
 
-    log_info("Stopped playing");
+    uint64_t target = current > step ? current - step : 0;
+    if (target < rewind_buffer_start()) {
+        // The oldest bytes kept may start mid-frame
+        target = rewind_buffer_start() + (frame_bytes - rewind_buffer_start() % frame_bytes) % frame_bytes;
+    }
+    if (target >= current) {
+        log_warn("Nothing to rewind to");
+        return 1;
+    }
+    samples_played -= (current - target) / frame_bytes;
+    replay_position = target;
+    replaying = true;
+    log_info("Rewound %lu ms from memory", (unsigned long) ((current - target) / frame_bytes * 1000 /
+                                                             flac_metadata.sample_rate));
+    return 0;
+}
+
+int seek_player(double progress) {
+    if (player_state == STOPPED || flac_metadata.total_samples == 0) {
+        return 1;
+    }
+    const uint32_t size = stream_cache_file_size();
+    const uint64_t audio_offset = flac->audio_offset < size ? flac->audio_offset : 0;
+    progress = progress < 0 ? 0 : progress > 1 ? 1 : progress;
+    // Frames compress to similar sizes, the same share of the frame data lands close to the same share of
+    // the samples; the frame found tells exactly where
+    uint64_t offset = audio_offset + (uint64_t) ((double) (size - audio_offset) * progress);
+    if (offset >= size) {
+        offset = size - 1;
+    }
+    uint32_t start;
+    uint64_t sample_number;
+    if (stream_cache_seek((uint32_t) offset, &start) != 0) {
+        probe_armed = false;
+        stop_player();
+        return 1;
+    }
+    if (seek_flac(flac, start) != 0 || restart_flac_reader(flac_reader, &sample_number) != 0) {
+        log_warn("No frame to seek to, stopping");
+        probe_armed = false;
+        stop_player();
+        return 1;
+    }
+    // The rewind buffer holds what played before, it starts over at the new position
+    replaying = false;
+    rewind_buffer_reset();
+    samples_played = sample_number;
+    log_info("Seek to sample %lu of %lu", (unsigned long) sample_number, (unsigned long) flac_metadata.total_samples);
+
+    // A paused player stays paused with the new position queued
+    if (join_output()) {
+        log_info("Reached end of file");
+        release_track();
+    }
+    return 0;
 }
 
 static BufferState get_buffer_state() {
@@ -129,12 +449,18 @@ void update_player(void) {
                 offset = AUDIO_BUFFER_SIZE / 2;
             }
 
-            unsigned bytes_read = read_flac(flac_reader, &audio_buffer[offset], AUDIO_BUFFER_SIZE / 2);
-            samples_played += bytes_read / flac_metadata.channels / (flac_metadata.bits_per_sample / 8);
+            unsigned bytes_read = fill_output(offset, AUDIO_BUFFER_SIZE / 2);
+            refill_pending = false;
+
+            if (underrun_count != reported_underrun_count) {
+                reported_underrun_count = underrun_count;
+                log_warn("Audio buffer underrun, %u in total", reported_underrun_count);
+            }
 
             if (bytes_read < AUDIO_BUFFER_SIZE / 2) {
                 log_info("Stop at EOF");
-                stop_player();
+                memset(&audio_buffer[offset + bytes_read], 0, AUDIO_BUFFER_SIZE / 2 - bytes_read);
+                release_track();
             }
         }
     }
@@ -151,6 +477,30 @@ double get_playing_progress(void) {
     return progress;
 }
 
+void arm_latency_probe(uint32_t event_cycles) {
+    probe_event_cycles = event_cycles;
+    probe_armed = true;
+}
+
+void get_output_stats(PlayerOutputStats *stats) {
+    *stats = output_stats;
+}
+
+void print_output_stats(void) {
+    log_info("Audio output: %lu starts on the running output (%lu late), %lu output starts, "
+             "%lu codec reconfigurations",
+             (unsigned long) output_stats.joined_starts, (unsigned long) output_stats.late_joins,
+             (unsigned long) output_stats.output_starts, (unsigned long) output_stats.codec_reconfigurations);
+    log_info("  event to first sound: last %lu us, mean %lu us, max %lu us over %lu probes",
+             (unsigned long) output_stats.last_latency_us,
+             (unsigned long) (output_stats.probes != 0 ? output_stats.total_latency_us / output_stats.probes : 0),
+             (unsigned long) output_stats.max_latency_us, (unsigned long) output_stats.probes);
+}
+
+unsigned get_underrun_count(void) {
+    return underrun_count;
+}
+
 PlayerState get_player_state() {
     return player_state;
 }
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "profiler.h"
+
+// The cycle counter also times the skip latency and the job slices, so it runs with the zones compiled out
+void profiler_init(void) {
+#if defined(STM32F746xx)
+    // Enable the trace block and unlock the DWT registers before starting the cycle counter
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    profiler_reset();
+}
+
+uint32_t profiler_clock_hz(void) {
+#if defined(STM32F746xx)
+    return SystemCoreClock;
+#else
+    return 1000000000u;
+#endif
+}
+
+#if PROFILER_ENABLED
+
+#include <stdio.h>
+#include <string.h>
+#include "logger.h"
+
+static ProfilerZone zones[PROFILER_ZONES_COUNT];
+
+static const char *const zone_names[PROFILER_ZONES_COUNT] = {
+        [PROFILER_ZONE_READ_FRAME] = "read_frame",
+        [PROFILER_ZONE_RICE] = "rice",
+        [PROFILER_ZONE_LPC] = "lpc_restore",
+        [PROFILER_ZONE_INTERLEAVE] = "interleave",
+        [PROFILER_ZONE_F_READ] = "f_read",
+        [PROFILER_ZONE_RENDER] = "render_track_screen",
+        [PROFILER_ZONE_JOB_SLICE] = "job_slice",
+        [PROFILER_ZONE_VISUALIZER] = "visualizer",
+};
+
+void profiler_reset(void) {
+    memset(zones, 0, sizeof(zones));
+    for (int i = 0; i < PROFILER_ZONES_COUNT; i++) {
+        zones[i].name = zone_names[i];
+        zones[i].min = UINT32_MAX;
+    }
+}
+
+void profiler_record(ProfilerZoneId zone, uint32_t cycles) {
+    ProfilerZone *z = &zones[zone];
+    z->count++;
+    z->total += cycles;
+    if (cycles < z->min) z->min = cycles;
+    if (cycles > z->max) z->max = cycles;
+    // Bin k holds samples in [2^k, 2^(k+1)), zero lands in the first bin
+    unsigned bin = cycles ? 31 - __builtin_clz(cycles) : 0;
+    z->histogram[bin]++;
+}
+
+const ProfilerZone *profiler_get_zone(ProfilerZoneId zone) {
+    return &zones[zone];
+}
+
+void profiler_print(void) {
+    log_info("Profiler (%lu cycles/s)", (unsigned long) profiler_clock_hz());
+    for (int i = 0; i < PROFILER_ZONES_COUNT; i++) {
+        const ProfilerZone *z = &zones[i];
+        if (z->count == 0) {
+            log_info("%-20s no samples", z->name);
+            continue;
+        }
+        log_info("%-20s count %lu, min %lu, max %lu, mean %lu, total %llu",
+                 z->name, (unsigned long) z->count, (unsigned long) z->min, (unsigned long) z->max,
+                 (unsigned long) (z->total / z->count), (unsigned long long) z->total);
+
+        // Print only the populated part of the histogram as "2^bin:count" pairs
+        char line[256];
+        int length = 0;
+        for (int bin = 0; bin < PROFILER_HISTOGRAM_BINS && length < (int) sizeof(line); bin++) {
+            if (z->histogram[bin] == 0) continue;
+            length += snprintf(line + length, sizeof(line) - length, " 2^%d:%lu",
+                               bin, (unsigned long) z->histogram[bin]);
+        }
+        log_info("%-20s histogram%s", "", line);
+    }
+}
+
+#endif
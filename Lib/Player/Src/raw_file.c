@@ -0,0 +1,166 @@
+#include "cmsis_os.h"
+#include "diskio.h"
+
+#include "logger.h"
+#include "raw_file.h"
+
+#define SECTOR_SIZE _MIN_SS
+
+osSemaphoreDef(raw_file_benchmark_done);
+static osSemaphoreId benchmark_done_semaphore;
+
+int raw_file_probe(RawFile *raw, FIL *file) {
+    // The fast seek map lists the fragments of the cluster chain, a table with room for one fails on the second
+    DWORD link_map[RAW_FILE_LINK_MAP_SIZE] = {RAW_FILE_LINK_MAP_SIZE};
+    file->cltbl = link_map;
+    const FRESULT result = f_lseek(file, CREATE_LINKMAP);
+    file->cltbl = NULL;
+
+    FATFS *fs = file->obj.fs;
+    raw->fs = fs;
+    raw->size = f_size(file);
+    raw->contiguous = result == FR_OK && link_map[0] == RAW_FILE_LINK_MAP_SIZE;
+    raw->first_sector = raw->contiguous ? fs->database + (link_map[2] - 2) * fs->csize : 0;
+    if (result != FR_OK && result != FR_NOT_ENOUGH_CORE) {
+        log_error("Failed to map the clusters of a file (%d)", result);
+        return 1;
+    }
+    return 0;
+}
+
+static unsigned data_length(const RawFile *raw, FSIZE_t offset, unsigned size) {
+    if (offset >= raw->size) {
+        return 0;
+    }
+    return raw->size - offset < size ? (unsigned) (raw->size - offset) : size;
+}
+
+static DWORD sector_of(const RawFile *raw, FSIZE_t offset) {
+    return raw->first_sector + (DWORD) (offset / SECTOR_SIZE);
+}
+
+// The SD task orders these transfers with the ones FatFs makes, and FatFs only ever reaches the card through
+// it (SD_status answers from the state of the last initialization), so the volume mutex is not needed
+int raw_file_read(const RawFile *raw, FSIZE_t offset, uint8_t *buffer, unsigned size, unsigned *bytes_read) {
+    const unsigned length = data_length(raw, offset, size);
+    *bytes_read = 0;
+    if (length == 0) {
+        return 0;
+    }
+    if (disk_read(raw->fs->drv, buffer, sector_of(raw, offset), (length + SECTOR_SIZE - 1) / SECTOR_SIZE) != RES_OK) {
+        return 1;
+    }
+    *bytes_read = length;
+    return 0;
+}
+
+int raw_file_submit(const RawFile *raw, FSIZE_t offset, uint8_t *buffer, unsigned size, SdRequest *request,
+                    unsigned *length) {
+    *length = data_length(raw, offset, size);
+    if (*length == 0) {
+        return 1;
+    }
+    request->type = SD_REQUEST_READ;
+    request->buffer = buffer;
+    request->sector = sector_of(raw, offset);
+    request->count = (*length + SECTOR_SIZE - 1) / SECTOR_SIZE;
+    return sd_async_submit(request);
+}
+
+static void log_throughput(const char *method, uint32_t bytes, uint32_t calls, uint32_t elapsed_ms) {
+    log_info("  %s: %lu KB/s, %lu calls of %lu us", method,
+             (unsigned long) (elapsed_ms != 0 ? (uint64_t) bytes * 1000 / 1024 / elapsed_ms : 0),
+             (unsigned long) calls, (unsigned long) (calls != 0 ? (uint64_t) elapsed_ms * 1000 / calls : 0));
+}
+
+// The next transfer is armed while the previous buffer would be consumed
+static int benchmark_queued(const RawFile *raw, uint8_t *buffer, unsigned chunk, uint32_t *bytes, uint32_t *calls,
+                            uint32_t *start) {
+    if (benchmark_done_semaphore == NULL) {
+        benchmark_done_semaphore = osSemaphoreCreate(osSemaphore(raw_file_benchmark_done), 1);
+    }
+    SdRequest requests[2] = {{.done_semaphore = benchmark_done_semaphore},
+                             {.done_semaphore = benchmark_done_semaphore}};
+    unsigned lengths[2] = {0, 0};
+    FSIZE_t offset = 0;
+    *bytes = 0;
+    *calls = 0;
+    *start = osKernelSysTick();
+    for (int i = 0; i < 2; i++) {
+        if (raw_file_submit(raw, offset, buffer + i * chunk, chunk, &requests[i], &lengths[i]) == 0) {
+            offset += lengths[i];
+        } else {
+            lengths[i] = 0;
+        }
+    }
+    for (int i = 0; lengths[i] != 0; i = 1 - i) {
+        if (sd_async_wait(&requests[i]) != RES_OK) {
+            return 1;
+        }
+        *bytes += lengths[i];
+        (*calls)++;
+        if (raw_file_submit(raw, offset, buffer + i * chunk, chunk, &requests[i], &lengths[i]) == 0) {
+            offset += lengths[i];
+        } else {
+            lengths[i] = 0;
+        }
+    }
+    return 0;
+}
+
+int raw_file_benchmark(const char *path, uint8_t *buffer, unsigned chunk) {
+    FIL file;
+    RawFile raw;
+    if (f_open(&file, path, FA_READ) != FR_OK) {
+        log_error("Failed to open file %s", path);
+        return 1;
+    }
+    if (raw_file_probe(&raw, &file) != 0) {
+        f_close(&file);
+        return 1;
+    }
+    log_info("Reading %s, %lu KB, %s", path, (unsigned long) (raw.size / 1024),
+             raw.contiguous ? "contiguous" : "fragmented");
+
+    uint32_t calls = 0;
+    uint32_t bytes = 0;
+    UINT bytes_read;
+    uint32_t start = osKernelSysTick();
+    do {
+        if (f_read(&file, buffer, chunk, &bytes_read) != FR_OK) {
+            log_error("Failed to read file %s", path);
+            f_close(&file);
+            return 1;
+        }
+        bytes += bytes_read;
+        calls++;
+    } while (bytes_read == chunk);
+    log_throughput("f_read", bytes, calls, osKernelSysTick() - start);
+
+    if (raw.contiguous) {
+        calls = 0;
+        bytes = 0;
+        unsigned raw_bytes_read;
+        start = osKernelSysTick();
+        do {
+            if (raw_file_read(&raw, bytes, buffer, chunk, &raw_bytes_read) != 0) {
+                log_error("Failed to read file %s", path);
+                f_close(&file);
+                return 1;
+            }
+            bytes += raw_bytes_read;
+            calls++;
+        } while (raw_bytes_read == chunk);
+        log_throughput("disk_read", bytes, calls, osKernelSysTick() - start);
+
+        if (benchmark_queued(&raw, buffer, chunk, &bytes, &calls, &start) != 0) {
+            log_error("Failed to read file %s", path);
+            f_close(&file);
+            return 1;
+        }
+        log_throughput("2 queued", bytes, calls, osKernelSysTick() - start);
+    }
+
+    f_close(&file);
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include <string.h>
+
+#include "logger.h"
+#include "rewind_buffer.h"
+#include "sdram.h"
+
+// A variable rather than the macro, so a 0 depth does not turn the modulos into divisions by zero
+static const uint32_t capacity = REWIND_BUFFER_SIZE;
+static uint8_t *ring;
+static uint64_t end_position;
+
+int rewind_buffer_init(void) {
+    if (capacity == 0) {
+        return 1;
+    }
+    if (ring == NULL) {
+        ring = sdram_alloc(capacity);
+        if (ring == NULL) {
+            log_warn("No SDRAM for the rewind buffer, rewinding is disabled");
+            return 1;
+        }
+        log_info("Rewind buffer: %u s of CD audio in %u KB, %u KB of SDRAM left",
+                 (unsigned) REWIND_BUFFER_SECONDS, (unsigned) (capacity / 1024),
+                 (unsigned) ((SDRAM_HEAP_SIZE - sdram_used()) / 1024));
+    }
+    rewind_buffer_reset();
+    return 0;
+}
+
+void rewind_buffer_reset(void) {
+    end_position = 0;
+}
+
+// Only the last capacity bytes are kept, so at most that much is copied
+void rewind_buffer_append(const uint8_t *data, unsigned size) {
+    if (ring == NULL) {
+        return;
+    }
+    end_position += size;
+    if (size > capacity) {
+        data += size - capacity;
+        size = capacity;
+    }
+    const unsigned offset = (unsigned) ((end_position - size) % capacity);
+    const unsigned first = size < capacity - offset ? size : capacity - offset;
+    memcpy(ring + offset, data, first);
+    memcpy(ring, data + first, size - first);
+}
+
+uint64_t rewind_buffer_start(void) {
+    if (ring == NULL) {
+        return end_position;
+    }
+    return end_position > capacity ? end_position - capacity : 0;
+}
+
+uint64_t rewind_buffer_end(void) {
+    return end_position;
+}
+
+unsigned rewind_buffer_read(uint64_t position, uint8_t *buffer, unsigned size) {
+    if (position < rewind_buffer_start() || position >= end_position) {
+        return 0;
+    }
+    if (size > end_position - position) {
+        size = (unsigned) (end_position - position);
+    }
+    const unsigned offset = (unsigned) (position % capacity);
+    const unsigned first = size < capacity - offset ? size : capacity - offset;
+    memcpy(buffer, ring + offset, first);
+    memcpy(buffer + first, ring, size - first);
+    return size;
+}
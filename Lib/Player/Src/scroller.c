@@ -0,0 +1,100 @@
+#include <stdlib.h>
+
+#include "scroller.h"
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+static int32_t get_max_position(const Scroller *scroller) {
+    return MAX(0, scroller->content_height - scroller->viewport_height) * 256;
+}
+
+// Returns true when the position had to be clamped, at an end of the content
+static bool clamp_position(Scroller *scroller) {
+    const int32_t clamped = MAX(0, MIN(get_max_position(scroller), scroller->position));
+    const bool clamped_any = clamped != scroller->position;
+    scroller->position = clamped;
+    return clamped_any;
+}
+
+void scroller_init(Scroller *scroller, int32_t content_height, int32_t viewport_height, uint32_t tick) {
+    *scroller = (Scroller) {
+            .content_height = content_height,
+            .viewport_height = viewport_height,
+            .update_tick = tick
+    };
+}
+
+void scroller_set_content(Scroller *scroller, int32_t content_height) {
+    scroller->content_height = content_height;
+    if (clamp_position(scroller)) {
+        scroller->velocity = 0;
+    }
+}
+
+void scroller_jump(Scroller *scroller, int32_t offset) {
+    scroller->position = offset * 256;
+    scroller->velocity = 0;
+    clamp_position(scroller);
+}
+
+void scroller_press(Scroller *scroller, int y, uint32_t tick) {
+    scroller->held = true;
+    scroller->velocity = 0;
+    scroller->last_y = (int16_t) y;
+    scroller->sample_y = (int16_t) y;
+    scroller->sample_tick = tick;
+}
+
+// The content moves with the finger, the speed is the mean of the last sample and the one before
+void scroller_drag(Scroller *scroller, int y, uint32_t tick) {
+    if (!scroller->held) {
+        return;
+    }
+    scroller->position -= (y - scroller->last_y) * 256;
+    scroller->last_y = (int16_t) y;
+    clamp_position(scroller);
+    const uint32_t elapsed = tick - scroller->sample_tick;
+    if (elapsed >= SCROLLER_SAMPLE_MS) {
+        const int32_t speed = -(y - scroller->sample_y) * 256 * 1000 / (int32_t) elapsed;
+        const int32_t limit = SCROLLER_MAX_SPEED * 256;
+        scroller->velocity = MAX(-limit, MIN(limit, (scroller->velocity + speed) / 2));
+        scroller->sample_y = (int16_t) y;
+        scroller->sample_tick = tick;
+    }
+}
+
+void scroller_release(Scroller *scroller, uint32_t tick) {
+    if (!scroller->held) {
+        return;
+    }
+    scroller->held = false;
+    if (tick - scroller->sample_tick > SCROLLER_REST_MS) {
+        scroller->velocity = 0;
+    }
+    scroller->update_tick = tick;
+}
+
+// Stepped by the millisecond, the friction takes 1/SCROLLER_DECAY_MS of the speed every step
+void scroller_update(Scroller *scroller, uint32_t tick) {
+    const uint32_t elapsed = MIN(tick - scroller->update_tick, SCROLLER_MAX_STEP_MS);
+    scroller->update_tick = tick;
+    if (scroller->held) {
+        return;
+    }
+    for (uint32_t step = 0; step < elapsed && scroller->velocity != 0; step++) {
+        scroller->position += scroller->velocity / 1000;
+        scroller->velocity -= scroller->velocity / SCROLLER_DECAY_MS;
+        if (clamp_position(scroller) || abs(scroller->velocity) < SCROLLER_STOP_SPEED * 256) {
+            scroller->velocity = 0;
+        }
+    }
+}
+
+bool scroller_is_moving(const Scroller *scroller) {
+    return scroller->velocity != 0;
+}
+
+int32_t scroller_get_offset(const Scroller *scroller) {
+    return scroller->position / 256;
+}
@@ -0,0 +1,36 @@
+#include <stdint.h>
+#include "sdram.h"
+#include "logger.h"
+
+#define SDRAM_ALIGNMENT 8
+
+static uint8_t sdram_heap[SDRAM_HEAP_SIZE] __attribute__((aligned(SDRAM_ALIGNMENT))) SDRAM;
+static size_t sdram_heap_used = 0;
+static unsigned sdram_failures = 0;
+
+void *sdram_alloc(size_t size) {
+    size = (size + SDRAM_ALIGNMENT - 1) & ~(size_t) (SDRAM_ALIGNMENT - 1);
+    if (size > SDRAM_HEAP_SIZE - sdram_heap_used) {
+        sdram_failures++;
+        log_error("SDRAM heap exhausted, %u bytes requested, %u free",
+                  (unsigned) size, (unsigned) (SDRAM_HEAP_SIZE - sdram_heap_used));
+        return NULL;
+    }
+    void *block = &sdram_heap[sdram_heap_used];
+    sdram_heap_used += size;
+    return block;
+}
+
+size_t sdram_used(void) {
+    return sdram_heap_used;
+}
+
+int sdram_check(void) {
+    const size_t available = SDRAM_HEAP_SIZE - sdram_heap_used;
+    if (sdram_failures != 0 || available < SDRAM_RESERVE_SIZE) {
+        log_error("SDRAM budget exceeded: %u allocations failed, %u KB free of the %u KB to keep in reserve",
+                  sdram_failures, (unsigned) (available / 1024), (unsigned) (SDRAM_RESERVE_SIZE / 1024));
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,757 @@
+#include <stdbool.h>
+#include <string.h>
+#include "cmsis_os.h"
+#include "ff.h"
+
+#include "logger.h"
+#include "raw_file.h"
+#include "sdram.h"
+#include "stream_cache.h"
+
+#define MAX_PATH_LENGTH 255
+#define IO_TASK_STACK_WORDS 1024
+#define IO_TASK_IDLE_TIMEOUT_MS 100
+#define RATE_WINDOW_MS 500
+// Halving the histogram this often keeps the percentiles following the card as it ages or heats up
+#define LATENCY_DECAY_READS 256
+
+// Orders the ring contents before the position that publishes them, for the other task
+#define MEMORY_BARRIER() __sync_synchronize()
+
+typedef enum {
+    COMMAND_NONE,
+    COMMAND_OPEN,
+    COMMAND_PREFETCH,
+    COMMAND_WARM,
+    COMMAND_SEEK,
+    COMMAND_CLOSE
+} StreamCacheCommand;
+
+typedef struct {
+    char path[MAX_PATH_LENGTH + 1];
+    uint8_t *data;
+    uint32_t length;
+    bool wanted;
+    // The head is read, or the whole file when it is shorter than the slot
+    bool complete;
+} WarmSlot;
+
+static uint8_t *ring;
+
+// Byte counts that keep growing from stream to stream, the ring offset is position % STREAM_CACHE_SIZE.
+// The I/O task advances write_position, the decoder read_position, unsigned differences survive the wrap.
+static volatile uint32_t write_position;
+static volatile uint32_t read_position;
+// End of the track being decoded, valid once the I/O task has reached it
+static volatile uint32_t current_end;
+static volatile bool current_end_known;
+// The track being decoded, opened again by a seek
+static char current_path[MAX_PATH_LENGTH + 1];
+static volatile uint32_t current_size;
+static volatile uint32_t depth = STREAM_CACHE_MIN_DEPTH;
+static volatile bool io_idle;
+
+// Owned by the I/O task
+static FIL file;
+static RawFile raw_file;
+static bool file_open;
+// Ring position and file offset after the last read issued; ahead of write_position while raw reads are queued
+static uint32_t submit_position;
+static uint32_t submit_offset;
+static bool submit_done;
+static SdRequest requests[STREAM_CACHE_QUEUED_READS];
+static unsigned request_lengths[STREAM_CACHE_QUEUED_READS];
+static unsigned requests_head;
+static unsigned requests_pending;
+// The oldest pending reads belong to a stream that was replaced, they are waited for and dropped
+static unsigned requests_orphaned;
+static bool filling;
+static bool reading_next;
+static bool next_requested;
+static bool next_started;
+static char next_path[MAX_PATH_LENGTH + 1];
+static uint32_t next_size;
+static uint32_t next_start;
+static uint32_t next_end;
+static bool next_end_known;
+static uint32_t latency_histogram[STREAM_CACHE_LATENCY_BINS];
+static uint32_t latency_samples;
+static uint32_t rate_window_start;
+static uint32_t rate_window_position;
+static uint32_t bytes_per_second;
+static WarmSlot warm_slots[STREAM_CACHE_WARM_SLOTS];
+static FIL warm_file;
+// Slot whose file is open in warm_file, -1 when none
+static int warm_filling = -1;
+
+// Commands are issued by the controller task only, it waits until the I/O task has run them
+static volatile StreamCacheCommand command = COMMAND_NONE;
+static char command_path[MAX_PATH_LENGTH + 1];
+static char command_warm_paths[STREAM_CACHE_WARM_SLOTS][MAX_PATH_LENGTH + 1];
+static unsigned command_warm_count;
+static uint32_t command_offset;
+static int command_result;
+
+static osSemaphoreId wake_semaphore;
+static osSemaphoreId data_semaphore;
+static osSemaphoreId command_done_semaphore;
+static osSemaphoreId read_done_semaphore;
+
+static StreamCacheStats stats;
+
+osSemaphoreDef(stream_cache_wake);
+osSemaphoreDef(stream_cache_data);
+osSemaphoreDef(stream_cache_command_done);
+osSemaphoreDef(stream_cache_read_done);
+
+static uint32_t io_task_stack[IO_TASK_STACK_WORDS];
+static osStaticThreadDef_t io_task_control;
+
+static void record_latency(uint32_t latency_ms) {
+    unsigned bin = latency_ms == 0 ? 0 : 32 - __builtin_clz(latency_ms);
+    if (bin >= STREAM_CACHE_LATENCY_BINS) {
+        bin = STREAM_CACHE_LATENCY_BINS - 1;
+    }
+    latency_histogram[bin]++;
+    if (latency_ms > stats.latency_max_ms) {
+        stats.latency_max_ms = latency_ms;
+    }
+
+    if (++latency_samples == LATENCY_DECAY_READS) {
+        latency_samples = 0;
+        for (int i = 0; i < STREAM_CACHE_LATENCY_BINS; i++) {
+            latency_histogram[i] = (latency_histogram[i] + 1) / 2;
+        }
+    }
+}
+
+// Upper bound of the histogram bin holding the given percentile
+static uint32_t latency_percentile(unsigned percentile) {
+    uint32_t total = 0;
+    for (int i = 0; i < STREAM_CACHE_LATENCY_BINS; i++) {
+        total += latency_histogram[i];
+    }
+    uint32_t count = 0;
+    for (int i = 0; i < STREAM_CACHE_LATENCY_BINS; i++) {
+        count += latency_histogram[i];
+        if (total != 0 && count * 100 >= total * percentile) {
+            return (1u << i) - 1;
+        }
+    }
+    return 0;
+}
+
+// The ring keeps enough data to ride out the slowest recent reads at the rate the decoder consumes it
+static void update_depth(void) {
+    const uint32_t now = osKernelSysTick();
+    if (now - rate_window_start >= RATE_WINDOW_MS) {
+        bytes_per_second = (uint32_t) ((uint64_t) (read_position - rate_window_position) * 1000 /
+                                       (now - rate_window_start));
+        rate_window_start = now;
+        rate_window_position = read_position;
+    }
+
+    uint64_t new_depth = (uint64_t) bytes_per_second * latency_percentile(99) / 1000 * STREAM_CACHE_DEPTH_FACTOR +
+                         STREAM_CACHE_CHUNK_SIZE;
+    if (new_depth < STREAM_CACHE_MIN_DEPTH) {
+        new_depth = STREAM_CACHE_MIN_DEPTH;
+    }
+    if (new_depth > STREAM_CACHE_SIZE - 2 * STREAM_CACHE_CHUNK_SIZE) {
+        new_depth = STREAM_CACHE_SIZE - 2 * STREAM_CACHE_CHUNK_SIZE;
+    }
+    depth = (uint32_t) new_depth;
+}
+
+static void close_file(void) {
+    if (file_open) {
+        f_close(&file);
+        file_open = false;
+    }
+}
+
+// Contiguous files skip f_read, only fragmented ones need FatFs to follow the cluster chain
+static int open_file(const char *path) {
+    if (f_open(&file, path, FA_READ) != FR_OK) {
+        return 1;
+    }
+    if (raw_file_probe(&raw_file, &file) != 0) {
+        f_close(&file);
+        return 1;
+    }
+    if (raw_file.contiguous) {
+        stats.contiguous_files++;
+    }
+    submit_offset = 0;
+    submit_done = false;
+    file_open = true;
+    return 0;
+}
+
+static uint32_t chunk_align(uint32_t position) {
+    return position + (STREAM_CACHE_CHUNK_SIZE - position % STREAM_CACHE_CHUNK_SIZE) % STREAM_CACHE_CHUNK_SIZE;
+}
+
+// The new stream starts past the reads still in flight, so it does not wait for them and they land
+// where it will not look before they are done
+static void reset_stream(void) {
+    const uint32_t start = chunk_align(submit_position);
+    close_file();
+    requests_orphaned = requests_pending;
+    write_position = start;
+    submit_position = start;
+    read_position = start;
+    current_end = start;
+    current_end_known = false;
+    reading_next = false;
+    next_requested = false;
+    next_started = false;
+    filling = true;
+    rate_window_start = osKernelSysTick();
+    rate_window_position = start;
+}
+
+// Tracks start at a chunk boundary of the ring, so every f_read lands in one contiguous piece of it
+static void start_next(void) {
+    if (!next_requested || next_started) {
+        return;
+    }
+    next_requested = false;
+    if (open_file(next_path) != 0) {
+        log_warn("Cannot prefetch %s", next_path);
+        return;
+    }
+    write_position = chunk_align(write_position);
+    submit_position = write_position;
+    next_size = raw_file.size;
+    reading_next = true;
+    next_started = true;
+    next_start = write_position;
+    next_end_known = false;
+    filling = true;
+}
+
+static void finish_file(void) {
+    close_file();
+    if (reading_next) {
+        next_end = write_position;
+        next_end_known = true;
+    } else {
+        current_end = write_position;
+        MEMORY_BARRIER();
+        current_end_known = true;
+        start_next();
+    }
+}
+
+// Stops at the high watermark (no room for another chunk) and resumes below the low one (the prefetch depth)
+static bool should_read(void) {
+    if (!file_open) {
+        return false;
+    }
+    const uint32_t level = submit_position - read_position;
+    if (level + STREAM_CACHE_CHUNK_SIZE > STREAM_CACHE_SIZE) {
+        filling = false;
+    } else if (level < depth) {
+        filling = true;
+    }
+    return filling;
+}
+
+static void publish(unsigned bytes_read) {
+    stats.sd_reads++;
+    stats.sd_bytes += bytes_read;
+    MEMORY_BARRIER();
+    write_position += bytes_read;
+    osSemaphoreRelease(data_semaphore);
+}
+
+// Fragmented files, FatFs follows the cluster chain
+static void read_chunk(void) {
+    UINT bytes_read = 0;
+    const uint32_t start = osKernelSysTick();
+    const FRESULT result = f_read(&file, ring + write_position % STREAM_CACHE_SIZE, STREAM_CACHE_CHUNK_SIZE,
+                                  &bytes_read);
+    record_latency(osKernelSysTick() - start);
+    if (result != FR_OK) {
+        log_error("Failed to read the stream (%d), ending it", result);
+        bytes_read = 0;
+    }
+    publish(bytes_read);
+    submit_position = write_position;
+
+    if (bytes_read < STREAM_CACHE_CHUNK_SIZE) {
+        finish_file();
+    }
+    update_depth();
+}
+
+// Time the decoder takes to consume the data ahead of the position, 0 while the rate is not known yet
+static uint32_t drain_ms(uint32_t position) {
+    if (bytes_per_second == 0) {
+        return 0;
+    }
+    const uint64_t ms = (uint64_t) (position - read_position) * 1000 / bytes_per_second;
+    return ms != 0 ? (uint32_t) ms : 1;
+}
+
+// Contiguous files: reads go to the SD task directly, ahead of background work, and complete in order
+static void queue_read(void) {
+    const unsigned index = (requests_head + requests_pending) % STREAM_CACHE_QUEUED_READS;
+    SdRequest *request = &requests[index];
+    request->done_semaphore = read_done_semaphore;
+    request->priority_class = SD_CLASS_AUDIO;
+    request->deadline_ms = drain_ms(submit_position);
+    if (raw_file_submit(&raw_file, submit_offset, ring + submit_position % STREAM_CACHE_SIZE,
+                        STREAM_CACHE_CHUNK_SIZE, request, &request_lengths[index]) != 0) {
+        // The SD queue is full, the reads already queued are completed first
+        return;
+    }
+    requests_pending++;
+    submit_position += request_lengths[index];
+    submit_offset += request_lengths[index];
+    submit_done = submit_offset >= raw_file.size;
+}
+
+static void complete_read(void) {
+    SdRequest *request = &requests[requests_head];
+    const unsigned length = request_lengths[requests_head];
+    const DRESULT result = sd_async_wait(request);
+    requests_head = (requests_head + 1) % STREAM_CACHE_QUEUED_READS;
+    requests_pending--;
+    if (requests_orphaned != 0) {
+        requests_orphaned--;
+        return;
+    }
+    record_latency(request->end_ms - request->start_ms);
+    stats.raw_reads++;
+
+    if (result != RES_OK) {
+        log_error("Failed to read the stream (%d), ending it", result);
+        while (requests_pending != 0) {
+            sd_async_wait(&requests[requests_head]);
+            requests_head = (requests_head + 1) % STREAM_CACHE_QUEUED_READS;
+            requests_pending--;
+        }
+        submit_position = write_position;
+        publish(0);
+        finish_file();
+        return;
+    }
+    publish(length);
+    if (submit_done && requests_pending == 0) {
+        finish_file();
+    }
+    update_depth();
+}
+
+static void complete_queued_reads(void) {
+    while (requests_pending != 0) {
+        complete_read();
+    }
+}
+
+static bool can_queue_read(void) {
+    return file_open && raw_file.contiguous && !submit_done && requests_pending < STREAM_CACHE_QUEUED_READS &&
+           should_read();
+}
+
+static void copy_to_ring(uint32_t position, const uint8_t *data, unsigned size) {
+    const uint32_t offset = position % STREAM_CACHE_SIZE;
+    const uint32_t first_part = STREAM_CACHE_SIZE - offset < size ? STREAM_CACHE_SIZE - offset : size;
+    memcpy(ring + offset, data, first_part);
+    memcpy(ring, data + first_part, size - first_part);
+}
+
+static WarmSlot *find_warm(const char *path) {
+    for (int i = 0; i < STREAM_CACHE_WARM_SLOTS; i++) {
+        if (warm_slots[i].path[0] != '\0' && strcmp(warm_slots[i].path, path) == 0) {
+            return &warm_slots[i];
+        }
+    }
+    return NULL;
+}
+
+// The ring starts with the head kept in SDRAM and the file is read on from where the head ends.
+// Heads are whole chunks unless they hold the whole file, so the reads that follow stay chunk-aligned.
+static void start_from_warm_head(void) {
+    const WarmSlot *slot = find_warm(command_path);
+    if (slot == NULL || slot->length == 0) {
+        return;
+    }
+    if (!raw_file.contiguous && f_lseek(&file, slot->length) != FR_OK) {
+        // Reading from the start again costs only the time the head would have saved
+        f_lseek(&file, 0);
+        return;
+    }
+    copy_to_ring(write_position, slot->data, slot->length);
+    stats.warm_hits++;
+    submit_offset = slot->length;
+    submit_done = submit_offset >= raw_file.size;
+    submit_position = write_position + slot->length;
+    MEMORY_BARRIER();
+    write_position = submit_position;
+    if (slot->length >= raw_file.size) {
+        finish_file();
+    }
+}
+
+static void run_open(void) {
+    strcpy(current_path, command_path);
+    if (next_started && strcmp(command_path, next_path) == 0) {
+        // The decoder is waiting for the command, so its position can be moved here
+        current_size = next_size;
+        read_position = next_start;
+        current_end = next_end;
+        current_end_known = next_end_known;
+        reading_next = false;
+        next_started = false;
+        stats.prefetched_tracks++;
+        log_info("Playing prefetched %s", command_path);
+        return;
+    }
+
+    reset_stream();
+    if (open_file(command_path) != 0) {
+        log_error("Failed to open file %s", command_path);
+        current_end_known = true;
+        command_result = 1;
+        return;
+    }
+    current_size = raw_file.size;
+    start_from_warm_head();
+}
+
+// The file is opened again and read from the chunk holding the offset, the decoder finds the first frame in it.
+// The ring is emptied like for a new track, which drops the prefetched next one.
+static void run_seek(void) {
+    const uint32_t start = command_offset - command_offset % STREAM_CACHE_CHUNK_SIZE;
+    reset_stream();
+    if (open_file(current_path) != 0 || (!raw_file.contiguous && f_lseek(&file, start) != FR_OK)) {
+        log_error("Failed to seek in %s", current_path);
+        close_file();
+        current_end_known = true;
+        command_result = 1;
+        return;
+    }
+    submit_offset = start;
+    submit_done = submit_offset >= raw_file.size;
+    command_offset = start;
+    if (submit_done) {
+        finish_file();
+    }
+}
+
+static void run_prefetch(void) {
+    if (next_started) {
+        if (strcmp(command_path, next_path) == 0) {
+            return;
+        }
+        // Another track was being prefetched, the decoder never reads past the current end so it is dropped
+        if (reading_next) {
+            close_file();
+            reading_next = false;
+        }
+        next_started = false;
+        write_position = current_end;
+        submit_position = write_position;
+    }
+    strcpy(next_path, command_path);
+    next_requested = true;
+    if (current_end_known && !file_open) {
+        start_next();
+    }
+}
+
+static void close_warm_file(void) {
+    if (warm_filling >= 0) {
+        f_close(&warm_file);
+        warm_filling = -1;
+    }
+}
+
+// Slots keep their heads while their track stays in the set, the others take the new tracks
+static void run_warm(void) {
+    for (int i = 0; i < STREAM_CACHE_WARM_SLOTS; i++) {
+        warm_slots[i].wanted = false;
+        for (unsigned j = 0; j < command_warm_count; j++) {
+            warm_slots[i].wanted |= strcmp(warm_slots[i].path, command_warm_paths[j]) == 0;
+        }
+    }
+    for (unsigned j = 0; j < command_warm_count; j++) {
+        if (command_warm_paths[j][0] == '\0' || find_warm(command_warm_paths[j]) != NULL) {
+            continue;
+        }
+        for (int i = 0; i < STREAM_CACHE_WARM_SLOTS; i++) {
+            WarmSlot *slot = &warm_slots[i];
+            if (!slot->wanted) {
+                if (warm_filling == i) {
+                    close_warm_file();
+                }
+                strcpy(slot->path, command_warm_paths[j]);
+                slot->length = 0;
+                slot->complete = false;
+                slot->wanted = true;
+                break;
+            }
+        }
+    }
+}
+
+static int next_warm_fill(void) {
+    for (int i = 0; i < STREAM_CACHE_WARM_SLOTS; i++) {
+        if (warm_slots[i].wanted && !warm_slots[i].complete) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// One chunk of a missing head, only while the ring has nothing to read
+static void fill_warm(int index) {
+    WarmSlot *slot = &warm_slots[index];
+    UINT bytes_read = 0;
+    if (warm_filling != index) {
+        close_warm_file();
+        if (f_open(&warm_file, slot->path, FA_READ) != FR_OK || f_lseek(&warm_file, slot->length) != FR_OK) {
+            log_warn("Cannot warm %s", slot->path);
+            slot->complete = true;
+            return;
+        }
+        warm_filling = index;
+    }
+    if (f_read(&warm_file, slot->data + slot->length, STREAM_CACHE_CHUNK_SIZE, &bytes_read) != FR_OK) {
+        bytes_read = 0;
+    }
+    slot->length += bytes_read;
+    if (bytes_read < STREAM_CACHE_CHUNK_SIZE || slot->length == STREAM_CACHE_WARM_SIZE) {
+        close_warm_file();
+        slot->complete = true;
+        stats.warm_fills++;
+    }
+}
+
+static void run_command(void) {
+    switch (command) {
+        case COMMAND_OPEN:
+            run_open();
+            break;
+        case COMMAND_PREFETCH:
+            run_prefetch();
+            break;
+        case COMMAND_WARM:
+            run_warm();
+            break;
+        case COMMAND_SEEK:
+            run_seek();
+            break;
+        case COMMAND_CLOSE:
+            reset_stream();
+            current_end_known = true;
+            break;
+        default:
+            break;
+    }
+    command = COMMAND_NONE;
+    osSemaphoreRelease(command_done_semaphore);
+}
+
+static void io_task(void const *argument) {
+    // f_read of fragmented files included
+    sd_async_set_thread_class(SD_CLASS_AUDIO);
+    while (true) {
+        if (command != COMMAND_NONE) {
+            // Open and close leave reads in flight to complete_read, a prefetch may move the positions under them
+            if (command == COMMAND_PREFETCH) {
+                complete_queued_reads();
+            }
+            run_command();
+        } else if (can_queue_read()) {
+            queue_read();
+        } else if (requests_pending != 0) {
+            complete_read();
+        } else if (file_open && !raw_file.contiguous && should_read()) {
+            read_chunk();
+        } else if (next_warm_fill() >= 0) {
+            fill_warm(next_warm_fill());
+        } else {
+            io_idle = true;
+            osSemaphoreWait(wake_semaphore, IO_TASK_IDLE_TIMEOUT_MS);
+            io_idle = false;
+        }
+    }
+}
+
+static int send_command(StreamCacheCommand new_command, const char *path) {
+    strncpy(command_path, path != NULL ? path : "", MAX_PATH_LENGTH);
+    command_path[MAX_PATH_LENGTH] = '\0';
+    command_result = 0;
+    MEMORY_BARRIER();
+    command = new_command;
+    osSemaphoreRelease(wake_semaphore);
+    osSemaphoreWait(command_done_semaphore, osWaitForever);
+    return command_result;
+}
+
+// CMSIS-RTOS creates binary semaphores already given, they are taken once so the first wait blocks
+static osSemaphoreId create_semaphore(const osSemaphoreDef_t *definition) {
+    osSemaphoreId semaphore = osSemaphoreCreate(definition, 1);
+    if (semaphore != NULL) {
+        osSemaphoreWait(semaphore, 0);
+    }
+    return semaphore;
+}
+
+int stream_cache_init(void) {
+    ring = sdram_alloc(STREAM_CACHE_SIZE);
+    for (int i = 0; i < STREAM_CACHE_WARM_SLOTS; i++) {
+        warm_slots[i].data = sdram_alloc(STREAM_CACHE_WARM_SIZE);
+        if (warm_slots[i].data == NULL) {
+            log_error("Failed to allocate the warm track heads");
+            return 1;
+        }
+    }
+    wake_semaphore = create_semaphore(osSemaphore(stream_cache_wake));
+    data_semaphore = create_semaphore(osSemaphore(stream_cache_data));
+    command_done_semaphore = create_semaphore(osSemaphore(stream_cache_command_done));
+    read_done_semaphore = create_semaphore(osSemaphore(stream_cache_read_done));
+    if (ring == NULL || wake_semaphore == NULL || data_semaphore == NULL || command_done_semaphore == NULL ||
+        read_done_semaphore == NULL) {
+        log_error("Failed to initialize the stream cache");
+        return 1;
+    }
+    reset_stream();
+    current_end_known = true;
+
+    // Above the controller, so a refill is issued as soon as the decoder frees a chunk; it sleeps in SD transfers
+    osThreadStaticDef(stream_cache_io, io_task, osPriorityAboveNormal, 0, IO_TASK_STACK_WORDS,
+                      io_task_stack, &io_task_control);
+    if (osThreadCreate(osThread(stream_cache_io), NULL) == NULL) {
+        log_error("Failed to start the I/O task");
+        return 1;
+    }
+    return 0;
+}
+
+int stream_cache_open(const char *path) {
+    log_info("Opening file %s", path);
+    return send_command(COMMAND_OPEN, path);
+}
+
+void stream_cache_prefetch(const char *path) {
+    send_command(COMMAND_PREFETCH, path);
+}
+
+int stream_cache_seek(uint32_t offset, uint32_t *start) {
+    command_offset = offset;
+    const int result = send_command(COMMAND_SEEK, NULL);
+    *start = command_offset;
+    return result;
+}
+
+uint32_t stream_cache_file_size(void) {
+    return current_size;
+}
+
+void stream_cache_close(void) {
+    send_command(COMMAND_CLOSE, NULL);
+}
+
+void stream_cache_warm(const char *const *paths, unsigned count) {
+    command_warm_count = count < STREAM_CACHE_WARM_SLOTS ? count : STREAM_CACHE_WARM_SLOTS;
+    for (unsigned i = 0; i < command_warm_count; i++) {
+        strncpy(command_warm_paths[i], paths[i], MAX_PATH_LENGTH);
+        command_warm_paths[i][MAX_PATH_LENGTH] = '\0';
+    }
+    send_command(COMMAND_WARM, NULL);
+}
+
+static void copy_from_ring(uint32_t position, uint8_t *buffer, unsigned size) {
+    const uint32_t offset = position % STREAM_CACHE_SIZE;
+    const uint32_t first_part = STREAM_CACHE_SIZE - offset < size ? STREAM_CACHE_SIZE - offset : size;
+    memcpy(buffer, ring + offset, first_part);
+    memcpy(buffer + first_part, ring, size - first_part);
+}
+
+int stream_cache_read(void *context, uint8_t *buffer, unsigned size, unsigned *bytes_read) {
+    unsigned copied = 0;
+    bool waited = false;
+    uint32_t wait_start = 0;
+
+    while (copied < size) {
+        const uint32_t position = read_position;
+        // The end is read after the data position, so data of the next track is never taken for this one
+        uint32_t available = write_position - position;
+        MEMORY_BARRIER();
+        const bool end_known = current_end_known;
+        if (end_known && current_end - position < available) {
+            available = current_end - position;
+        }
+
+        if (available == 0) {
+            if (end_known) {
+                break;
+            }
+            if (!waited) {
+                waited = true;
+                wait_start = osKernelSysTick();
+            }
+            osSemaphoreRelease(wake_semaphore);
+            osSemaphoreWait(data_semaphore, IO_TASK_IDLE_TIMEOUT_MS);
+            continue;
+        }
+
+        const unsigned chunk = available < size - copied ? available : size - copied;
+        copy_from_ring(position, buffer + copied, chunk);
+        MEMORY_BARRIER();
+        read_position = position + chunk;
+        copied += chunk;
+    }
+
+    if (io_idle && write_position - read_position < depth) {
+        osSemaphoreRelease(wake_semaphore);
+    }
+    if (waited) {
+        const uint32_t wait_ms = osKernelSysTick() - wait_start;
+        stats.misses++;
+        stats.wait_ms += wait_ms;
+        if (wait_ms > stats.max_wait_ms) {
+            stats.max_wait_ms = wait_ms;
+        }
+    } else {
+        stats.hits++;
+    }
+
+    *bytes_read = copied;
+    return 0;
+}
+
+bool stream_cache_is_ahead(void) {
+    return io_idle || write_position - read_position >= depth;
+}
+
+void stream_cache_get_stats(StreamCacheStats *result) {
+    *result = stats;
+    result->latency_p50_ms = latency_percentile(50);
+    result->latency_p90_ms = latency_percentile(90);
+    result->latency_p99_ms = latency_percentile(99);
+    result->depth = depth;
+    result->level = write_position - read_position;
+}
+
+void stream_cache_print_stats(void) {
+    StreamCacheStats cache_stats;
+    stream_cache_get_stats(&cache_stats);
+    log_info("Stream cache: %lu hits, %lu misses, %lu ms waited (max %lu ms), %lu prefetched tracks, "
+             "%lu started from %lu warm heads",
+             (unsigned long) cache_stats.hits, (unsigned long) cache_stats.misses,
+             (unsigned long) cache_stats.wait_ms, (unsigned long) cache_stats.max_wait_ms,
+             (unsigned long) cache_stats.prefetched_tracks, (unsigned long) cache_stats.warm_hits,
+             (unsigned long) cache_stats.warm_fills);
+    log_info("  SD: %lu reads (%lu raw from %lu contiguous files), %lu KB, latency p50 <= %lu ms, p90 <= %lu ms, p99 <= %lu ms, max %lu ms",
+             (unsigned long) cache_stats.sd_reads, (unsigned long) cache_stats.raw_reads,
+             (unsigned long) cache_stats.contiguous_files, (unsigned long) (cache_stats.sd_bytes / 1024),
+             (unsigned long) cache_stats.latency_p50_ms, (unsigned long) cache_stats.latency_p90_ms,
+             (unsigned long) cache_stats.latency_p99_ms, (unsigned long) cache_stats.latency_max_ms);
+    log_info("  level %lu KB, prefetch depth %lu KB", (unsigned long) (cache_stats.level / 1024),
+             (unsigned long) (cache_stats.depth / 1024));
+}
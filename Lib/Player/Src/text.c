@@ -0,0 +1,270 @@
+#include <string.h>
+#include "ff.h"
+
+#include "logger.h"
+#include "profiler.h"
+#include "sdram.h"
+#include "text.h"
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+// What a code point without a glyph is drawn as
+#define REPLACEMENT_CHARACTER '?'
+
+// A8 glyphs of one font, indexed like its atlas, NULL until a glyph is first drawn
+typedef struct {
+    const Font *font;
+    const uint8_t **alpha;
+} GlyphCache;
+
+typedef struct {
+    const Font *font;
+    int max_width;
+    uint32_t hash;
+    // Empty when the text was too long to be looked up
+    char text[TEXT_RUN_TEXT_SIZE];
+    uint32_t last_used;
+    GfxMask mask;
+    uint8_t *alpha;
+} TextRun;
+
+static GlyphCache glyph_caches[TEXT_MAX_FONTS];
+static TextRun runs[TEXT_RUN_CACHE_SIZE];
+static uint32_t use_counter;
+static TextStats stats;
+
+int text_init(void) {
+    if (runs[0].alpha != NULL) {
+        return 0;
+    }
+    for (int i = 0; i < TEXT_RUN_CACHE_SIZE; i++) {
+        runs[i].alpha = sdram_alloc(TEXT_RUN_MAX_WIDTH * TEXT_RUN_MAX_HEIGHT);
+        if (runs[i].alpha == NULL) {
+            log_error("Failed to allocate the text run cache");
+            return 1;
+        }
+        stats.sdram_bytes += TEXT_RUN_MAX_WIDTH * TEXT_RUN_MAX_HEIGHT;
+    }
+    return 0;
+}
+
+// The code point starting at *text, which is moved past it. A byte that does not start a well-formed
+// sequence is one character of the OEM code page file names are in.
+static uint32_t next_codepoint(const char **text) {
+    const uint8_t *bytes = (const uint8_t *) *text;
+    unsigned length;
+    uint32_t codepoint;
+    uint32_t minimum;
+    if (bytes[0] < 0x80) {
+        *text += 1;
+        return bytes[0];
+    } else if ((bytes[0] & 0xE0) == 0xC0) {
+        length = 2, codepoint = bytes[0] & 0x1F, minimum = 0x80;
+    } else if ((bytes[0] & 0xF0) == 0xE0) {
+        length = 3, codepoint = bytes[0] & 0x0F, minimum = 0x800;
+    } else if ((bytes[0] & 0xF8) == 0xF0) {
+        length = 4, codepoint = bytes[0] & 0x07, minimum = 0x10000;
+    } else {
+        length = 0, codepoint = 0, minimum = 0;
+    }
+    unsigned i = 1;
+    while (i < length && (bytes[i] & 0xC0) == 0x80) {
+        codepoint = codepoint << 6 | (bytes[i++] & 0x3F);
+    }
+    if (length == 0 || i < length || codepoint < minimum || codepoint > 0x10FFFF) {
+        *text += 1;
+        return ff_convert(bytes[0], 1);
+    }
+    *text += length;
+    return codepoint;
+}
+
+static int find_glyph(const Font *font, uint32_t codepoint) {
+    int low = 0;
+    int high = font->glyph_count - 1;
+    while (low <= high) {
+        const int middle = (low + high) / 2;
+        if (font->glyphs[middle].codepoint == codepoint) {
+            return middle;
+        } else if (font->glyphs[middle].codepoint < codepoint) {
+            low = middle + 1;
+        } else {
+            high = middle - 1;
+        }
+    }
+    return -1;
+}
+
+static GlyphCache *get_glyph_cache(const Font *font) {
+    for (int i = 0; i < TEXT_MAX_FONTS; i++) {
+        if (glyph_caches[i].font == font) {
+            return &glyph_caches[i];
+        }
+        if (glyph_caches[i].font == NULL) {
+            glyph_caches[i].alpha = sdram_alloc(font->glyph_count * sizeof(glyph_caches[i].alpha[0]));
+            if (glyph_caches[i].alpha == NULL) {
+                return NULL;
+            }
+            memset(glyph_caches[i].alpha, 0, font->glyph_count * sizeof(glyph_caches[i].alpha[0]));
+            stats.sdram_bytes += font->glyph_count * sizeof(glyph_caches[i].alpha[0]);
+            glyph_caches[i].font = font;
+            return &glyph_caches[i];
+        }
+    }
+    return NULL;
+}
+
+// Expands the A4 bitmap of the glyph into the cache, NULL when there is no memory
+static const uint8_t *get_glyph_alpha(GlyphCache *cache, int index) {
+    if (cache->alpha[index] != NULL) {
+        return cache->alpha[index];
+    }
+    const FontGlyph *glyph = &cache->font->glyphs[index];
+    uint8_t *alpha = sdram_alloc(MAX(1, glyph->width * glyph->height));
+    if (alpha == NULL) {
+        return NULL;
+    }
+    const unsigned bytes_per_line = (glyph->width + 1) / 2;
+    const uint8_t *bitmap = &cache->font->bitmaps[glyph->offset];
+    for (unsigned y = 0; y < glyph->height; y++) {
+        for (unsigned x = 0; x < glyph->width; x++) {
+            const uint8_t pair = bitmap[y * bytes_per_line + x / 2];
+            alpha[y * glyph->width + x] = (x % 2 == 0 ? pair >> 4 : pair & 0x0F) * 0x11;
+        }
+    }
+    cache->alpha[index] = alpha;
+    stats.glyphs_expanded++;
+    stats.sdram_bytes += MAX(1, glyph->width * glyph->height);
+    return alpha;
+}
+
+// Coverage of overlapping glyphs is the larger of the two, so a kerned pair does not darken where it touches
+static void copy_glyph(const GfxMask *mask, const FontGlyph *glyph, const uint8_t *alpha, int x, int y) {
+    const int first_row = MAX(0, -y);
+    const int last_row = MIN(glyph->height, mask->height - y);
+    const int first_column = MAX(0, -x);
+    const int last_column = MIN(glyph->width, mask->width - x);
+    for (int row = first_row; row < last_row; row++) {
+        uint8_t *target = (uint8_t *) &mask->alpha[(y + row) * mask->width + x];
+        const uint8_t *source = &alpha[row * glyph->width];
+        for (int column = first_column; column < last_column; column++) {
+            target[column] = MAX(target[column], source[column]);
+        }
+    }
+}
+
+// Lays the glyphs out on the pen, up to the last one that fits in whole; fills the mask when it is not NULL
+static int layout(GlyphCache *cache, const char *text, int max_width, const GfxMask *mask) {
+    const Font *font = cache->font;
+    const int fallback = find_glyph(font, REPLACEMENT_CHARACTER);
+    int pen = 0;
+    int width = 0;
+    while (*text != '\0') {
+        int index = find_glyph(font, next_codepoint(&text));
+        if (index < 0 && (index = fallback) < 0) {
+            continue;
+        }
+        const FontGlyph *glyph = &font->glyphs[index];
+        const int right = MAX(pen + glyph->advance, pen + glyph->left + glyph->width);
+        if (right > max_width) {
+            break;
+        }
+        if (mask != NULL && glyph->width != 0) {
+            const uint8_t *alpha = get_glyph_alpha(cache, index);
+            if (alpha != NULL) {
+                copy_glyph(mask, glyph, alpha, pen + glyph->left, font->ascent - glyph->top);
+            }
+            stats.glyphs_drawn++;
+        }
+        pen += glyph->advance;
+        width = MAX(width, right);
+    }
+    return width;
+}
+
+static uint32_t hash_text(const char *text) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    while (*text != '\0') {
+        hash = (hash ^ (uint8_t) *text++) * 16777619u;
+    }
+    return hash;
+}
+
+static TextRun *find_run(const Font *font, const char *text, int max_width, uint32_t hash) {
+    for (int i = 0; i < TEXT_RUN_CACHE_SIZE; i++) {
+        TextRun *run = &runs[i];
+        if (run->font == font && run->max_width == max_width && run->hash == hash && run->text[0] != '\0' &&
+            strcmp(run->text, text) == 0) {
+            return run;
+        }
+    }
+    return NULL;
+}
+
+static TextRun *get_least_recently_used(void) {
+    TextRun *oldest = &runs[0];
+    for (int i = 1; i < TEXT_RUN_CACHE_SIZE; i++) {
+        if (runs[i].last_used < oldest->last_used) {
+            oldest = &runs[i];
+        }
+    }
+    return oldest;
+}
+
+const GfxMask *text_render(const Font *font, const char *text, int max_width) {
+    max_width = MIN(max_width, TEXT_RUN_MAX_WIDTH);
+    const uint32_t hash = hash_text(text);
+    TextRun *run = find_run(font, text, max_width, hash);
+    if (run != NULL) {
+        run->last_used = ++use_counter;
+        stats.run_hits++;
+        return &run->mask;
+    }
+
+    GlyphCache *cache = get_glyph_cache(font);
+    if (runs[0].alpha == NULL || cache == NULL || font->height > TEXT_RUN_MAX_HEIGHT) {
+        return NULL;
+    }
+    const uint32_t start = profiler_cycles();
+    run = get_least_recently_used();
+    run->font = font;
+    run->max_width = max_width;
+    run->hash = hash;
+    run->last_used = ++use_counter;
+    if (strlen(text) < sizeof(run->text)) {
+        strcpy(run->text, text);
+    } else {
+        run->text[0] = '\0';
+    }
+    // The mask is as wide as the text, its lines follow each other without padding
+    run->mask = (GfxMask) {.alpha = run->alpha, .width = layout(cache, text, max_width, NULL), .height = font->height};
+    memset(run->alpha, 0, run->mask.width * run->mask.height);
+    layout(cache, text, max_width, &run->mask);
+
+    const uint32_t render_us = (profiler_cycles() - start) / (profiler_clock_hz() / 1000000);
+    stats.runs_rendered++;
+    stats.last_render_us = render_us;
+    stats.total_render_us += render_us;
+    stats.max_render_us = MAX(stats.max_render_us, render_us);
+    log_debug("Text: rendered \"%s\", %u px wide, in %lu us", text, (unsigned) run->mask.width, (unsigned long) render_us);
+    return &run->mask;
+}
+
+void text_get_stats(TextStats *result) {
+    *result = stats;
+}
+
+void text_print_stats(void) {
+    const uint32_t runs_used = stats.run_hits + stats.runs_rendered;
+    log_info("Text: %lu runs rendered, %lu taken from the cache (%lu%%), %lu glyphs drawn, %lu expanded, %lu KB of SDRAM",
+             (unsigned long) stats.runs_rendered, (unsigned long) stats.run_hits,
+             (unsigned long) (runs_used != 0 ? (uint64_t) stats.run_hits * 100 / runs_used : 0),
+             (unsigned long) stats.glyphs_drawn, (unsigned long) stats.glyphs_expanded,
+             (unsigned long) (stats.sdram_bytes / 1024));
+    log_info("  render time per string: last %lu us, mean %lu us, max %lu us",
+             (unsigned long) stats.last_render_us,
+             (unsigned long) (stats.runs_rendered != 0 ? stats.total_render_us / stats.runs_rendered : 0),
+             (unsigned long) stats.max_render_us);
+}
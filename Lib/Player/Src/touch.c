@@ -0,0 +1,168 @@
+#include "stm32746g_discovery_ts.h"
+#include "cmsis_os.h"
+
+#include "i2c_bus.h"
+#include "logger.h"
+#include "profiler.h"
+#include "touch.h"
+
+// Orders the queued event before the index that publishes it, for the other task
+#define MEMORY_BARRIER() __sync_synchronize()
+
+// Written by the touch task only, the controller advances queue_tail
+static TouchEvent queue[TOUCH_QUEUE_SIZE];
+static volatile uint32_t queue_head;
+static volatile uint32_t queue_tail;
+static volatile bool down;
+
+// The first interrupt since the task last woke, later ones only find the semaphore given
+static volatile bool interrupt_pending;
+static volatile uint32_t interrupt_cycles;
+static volatile uint32_t interrupt_tick;
+
+static osSemaphoreId interrupt_semaphore;
+osSemaphoreDef(touch_interrupt);
+
+static uint32_t touch_task_stack[TOUCH_TASK_STACK_WORDS];
+static osStaticThreadDef_t touch_task_control;
+
+static TouchStats stats;
+
+// The panel pulls its interrupt line when it has new touch data
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
+    if (GPIO_Pin != TS_INT_PIN) {
+        return;
+    }
+    stats.interrupts++;
+    if (!interrupt_pending) {
+        interrupt_cycles = profiler_cycles();
+        interrupt_tick = osKernelSysTick();
+        interrupt_pending = true;
+    }
+    osSemaphoreRelease(interrupt_semaphore);
+}
+
+static void push(TouchEventType type, uint16_t x, uint16_t y, uint32_t cycles, uint32_t tick) {
+    const uint32_t head = queue_head;
+    if (head - queue_tail == TOUCH_QUEUE_SIZE) {
+        stats.dropped++;
+        return;
+    }
+    queue[head % TOUCH_QUEUE_SIZE] = (TouchEvent) {
+            .type = type,
+            .x = x,
+            .y = y,
+            .cycles = cycles,
+            .tick = tick
+    };
+    stats.events++;
+    MEMORY_BARRIER();
+    queue_head = head + 1;
+}
+
+static void touch_task(void const *argument) {
+    uint16_t x = 0, y = 0;
+
+    while (true) {
+        osSemaphoreWait(interrupt_semaphore, down ? TOUCH_POLL_MS : osWaitForever);
+        uint32_t cycles = profiler_cycles();
+        uint32_t tick = osKernelSysTick();
+        if (interrupt_pending) {
+            cycles = interrupt_cycles;
+            tick = interrupt_tick;
+            interrupt_pending = false;
+        }
+
+        TS_StateTypeDef state;
+        i2c_bus_lock();
+        const uint8_t result = BSP_TS_GetState(&state);
+        i2c_bus_unlock();
+        stats.reads++;
+        if (result != TS_OK) {
+            stats.read_errors++;
+            continue;
+        }
+
+        if (state.touchDetected == 0) {
+            if (down) {
+                down = false;
+                push(TOUCH_UP, x, y, cycles, tick);
+            }
+        } else if (!down) {
+            down = true;
+            x = state.touchX[0];
+            y = state.touchY[0];
+            push(TOUCH_DOWN, x, y, cycles, tick);
+        } else if (state.touchX[0] != x || state.touchY[0] != y) {
+            x = state.touchX[0];
+            y = state.touchY[0];
+            push(TOUCH_MOVE, x, y, cycles, tick);
+        }
+    }
+}
+
+// CMSIS-RTOS creates binary semaphores already given, it is taken once so the task sleeps until a touch
+int touch_init(uint16_t width, uint16_t height) {
+    interrupt_semaphore = osSemaphoreCreate(osSemaphore(touch_interrupt), 1);
+    if (interrupt_semaphore == NULL || i2c_bus_init() != 0) {
+        log_error("Failed to initialize the touch input");
+        return 1;
+    }
+    osSemaphoreWait(interrupt_semaphore, 0);
+
+    if (BSP_TS_Init(width, height) != TS_OK || BSP_TS_ITConfig() != TS_OK) {
+        log_error("Failed to initialize the touch panel");
+        return 1;
+    }
+
+    // Above the controller, so events carry the time of the touch rather than of the next decoder pause
+    osThreadStaticDef(touch, touch_task, osPriorityAboveNormal, 0, TOUCH_TASK_STACK_WORDS, touch_task_stack,
+                      &touch_task_control);
+    if (osThreadCreate(osThread(touch), NULL) == NULL) {
+        log_error("Failed to start the touch task");
+        return 1;
+    }
+    return 0;
+}
+
+bool touch_get_event(TouchEvent *event) {
+    const uint32_t tail = queue_tail;
+    if (queue_head == tail) {
+        return false;
+    }
+    MEMORY_BARRIER();
+    *event = queue[tail % TOUCH_QUEUE_SIZE];
+    MEMORY_BARRIER();
+    queue_tail = tail + 1;
+
+    const uint32_t latency_us = (profiler_cycles() - event->cycles) / (profiler_clock_hz() / 1000000);
+    stats.taken++;
+    stats.last_latency_us = latency_us;
+    stats.total_latency_us += latency_us;
+    if (latency_us > stats.max_latency_us) {
+        stats.max_latency_us = latency_us;
+    }
+    return true;
+}
+
+void touch_flush(void) {
+    queue_tail = queue_head;
+}
+
+bool touch_is_down(void) {
+    return down;
+}
+
+void touch_get_stats(TouchStats *result) {
+    *result = stats;
+}
+
+void touch_print_stats(void) {
+    log_info("Touch: %lu interrupts, %lu reads (%lu failed), %lu events, %lu dropped",
+             (unsigned long) stats.interrupts, (unsigned long) stats.reads, (unsigned long) stats.read_errors,
+             (unsigned long) stats.events, (unsigned long) stats.dropped);
+    log_info("  interrupt to controller: last %lu us, mean %lu us, max %lu us over %lu events",
+             (unsigned long) stats.last_latency_us,
+             (unsigned long) (stats.taken != 0 ? stats.total_latency_us / stats.taken : 0),
+             (unsigned long) stats.max_latency_us, (unsigned long) stats.taken);
+}
@@ -0,0 +1,255 @@
+#include <string.h>
+#include "cmsis_os.h"
+
+#include "logger.h"
+#include "profiler.h"
+#include "visualizer.h"
+
+// Orders the block before the flag that hands it over, and the frame before the index that publishes it
+#define MEMORY_BARRIER() __sync_synchronize()
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+// log2 in Q8 of the bin power of a full scale sine through the Hann window, and of the full scale sample
+// squared, the references of the levels
+#define FULL_SCALE_POWER_LOG2_Q8 (28 * 256)
+#define FULL_SCALE_SQUARE_LOG2_Q8 (30 * 256)
+// dB per unit of log2 of a power, in hundredths
+#define POWER_DB_PER_LOG2 301
+
+static volatile bool enabled = true;
+static bool started;
+
+// The block slot, written by the player while it is empty and read by the task while it is full
+static int16_t block[FFT_SIZE][2];
+static volatile bool block_full;
+// The CPU budget: no block is taken for hold_cycles from hold_start
+static volatile uint32_t hold_start;
+static volatile uint32_t hold_cycles;
+
+static osSemaphoreId block_semaphore;
+osSemaphoreDef(visualizer_block);
+
+static uint32_t visualizer_task_stack[VISUALIZER_TASK_STACK_WORDS];
+static osStaticThreadDef_t visualizer_task_control;
+
+// Analysis state, only touched by the task
+static uint16_t band_edges[VISUALIZER_BANDS + 1];
+static int16_t mix[FFT_SIZE];
+static uint32_t power[FFT_BINS];
+static VisualizerFrame levels;
+
+// Written by the task into the frame not published, then published by the index. The display task reading
+// it has the higher priority, so the task never writes while a read of the same frame is under way.
+static VisualizerFrame frames[2];
+static volatile int published;
+
+static VisualizerStats stats;
+
+// log2 in Q8, the mantissa taken as linear
+static int32_t log2_q8(uint32_t value) {
+    if (value == 0) {
+        return 0;
+    }
+    const int msb = 31 - __builtin_clz(value);
+    const uint32_t fraction = msb >= 8 ? value >> (msb - 8) : value << (8 - msb);
+    return msb * 256 + (int32_t) (fraction & 0xFF);
+}
+
+// From the log2 of a power against its full scale reference
+static uint8_t to_level(uint32_t value, int32_t full_scale_log2_q8) {
+    const int32_t db_q8 = (log2_q8(value) - full_scale_log2_q8) * POWER_DB_PER_LOG2 / 100;
+    const int32_t level = (db_q8 + VISUALIZER_RANGE_DB * 256) * VISUALIZER_LEVEL_MAX / (VISUALIZER_RANGE_DB * 256);
+    return (uint8_t) (value == 0 ? 0 : MAX(0, MIN(VISUALIZER_LEVEL_MAX, level)));
+}
+
+static uint8_t decay(uint8_t level, uint8_t previous) {
+    return (uint8_t) MAX(level, previous - VISUALIZER_DECAY);
+}
+
+static void measure_channels(void) {
+    for (int channel = 0; channel < 2; channel++) {
+        uint32_t peak = 0;
+        uint64_t sum = 0;
+        for (int i = 0; i < FFT_SIZE; i++) {
+            const int32_t sample = block[i][channel];
+            const uint32_t magnitude = (uint32_t) (sample < 0 ? -sample : sample);
+            peak = MAX(peak, magnitude);
+            sum += (uint64_t) (sample * sample);
+        }
+        // Squared like the mean square, so both take the power reference
+        levels.peak[channel] = decay(to_level(peak * peak, FULL_SCALE_SQUARE_LOG2_Q8), levels.peak[channel]);
+        levels.rms[channel] = decay(to_level((uint32_t) (sum / FFT_SIZE), FULL_SCALE_SQUARE_LOG2_Q8),
+                                    levels.rms[channel]);
+    }
+}
+
+static void measure_spectrum(void) {
+    for (int i = 0; i < FFT_SIZE; i++) {
+        mix[i] = (int16_t) ((block[i][0] + block[i][1]) >> 1);
+    }
+    fft_real_power(mix, power);
+    for (int band = 0; band < VISUALIZER_BANDS; band++) {
+        uint32_t band_power = 0;
+        for (int bin = band_edges[band]; bin < band_edges[band + 1]; bin++) {
+            band_power = MAX(band_power, power[bin]);
+        }
+        levels.bands[band] = decay(to_level(band_power, FULL_SCALE_POWER_LOG2_Q8), levels.bands[band]);
+    }
+}
+
+static void publish(void) {
+    levels.sequence++;
+    levels.tick = osKernelSysTick();
+    const int next = !published;
+    frames[next] = levels;
+    MEMORY_BARRIER();
+    published = next;
+}
+
+static void visualizer_task(void const *argument) {
+    while (true) {
+        osSemaphoreWait(block_semaphore, osWaitForever);
+        if (!block_full) {
+            continue;
+        }
+        MEMORY_BARRIER();
+        const uint32_t start = profiler_cycles();
+        {
+            PROFILER_ZONE(PROFILER_ZONE_VISUALIZER);
+            measure_channels();
+            measure_spectrum();
+        }
+        publish();
+        const uint32_t cycles = profiler_cycles() - start;
+        hold_start = start;
+        hold_cycles = (uint32_t) MIN(UINT32_MAX, (uint64_t) cycles * 100 / VISUALIZER_CPU_PERCENT);
+        MEMORY_BARRIER();
+        block_full = false;
+
+        const uint32_t analysis_us = cycles / (profiler_clock_hz() / 1000000);
+        stats.analyzed++;
+        stats.last_analysis_us = analysis_us;
+        stats.total_analysis_us += analysis_us;
+        stats.max_analysis_us = MAX(stats.max_analysis_us, analysis_us);
+    }
+}
+
+// Band edges spaced evenly in log frequency, each band a ratio whose power VISUALIZER_BANDS spans the bins,
+// with at least one bin per band
+static void init_bands(void) {
+    double low = 1.0;
+    double high = FFT_BINS;
+    for (int i = 0; i < 64; i++) {
+        const double ratio = (low + high) / 2;
+        double span = 1.0;
+        for (int band = 0; band < VISUALIZER_BANDS; band++) {
+            span *= ratio;
+        }
+        *(span < FFT_BINS ? &low : &high) = ratio;
+    }
+    double edge = 1.0;
+    band_edges[0] = 1;
+    for (int band = 1; band <= VISUALIZER_BANDS; band++) {
+        edge *= low;
+        band_edges[band] = MAX((uint16_t) (edge + 0.5), band_edges[band - 1] + 1);
+    }
+    band_edges[VISUALIZER_BANDS] = FFT_BINS;
+}
+
+// CMSIS-RTOS creates binary semaphores already given, it is taken once so the task sleeps until a block
+int visualizer_init(void) {
+    if (started) {
+        return 0;
+    }
+    block_semaphore = osSemaphoreCreate(osSemaphore(visualizer_block), 1);
+    if (block_semaphore == NULL) {
+        log_error("Failed to initialize the visualizer");
+        return 1;
+    }
+    osSemaphoreWait(block_semaphore, 0);
+    fft_init();
+    init_bands();
+
+    // With the idle jobs, below the display task that reads the frames
+    osThreadStaticDef(visualizer, visualizer_task, osPriorityLow, 0, VISUALIZER_TASK_STACK_WORDS,
+                      visualizer_task_stack, &visualizer_task_control);
+    if (osThreadCreate(osThread(visualizer), NULL) == NULL) {
+        log_error("Failed to start the visualizer task");
+        return 1;
+    }
+    started = true;
+    return 0;
+}
+
+void visualizer_set_enabled(bool value) {
+    enabled = value;
+}
+
+bool visualizer_is_enabled(void) {
+    return enabled;
+}
+
+// Only the last FFT_SIZE frames are copied, mono is copied to both channels
+void visualizer_tap(const uint8_t *pcm, unsigned bytes, unsigned channels, unsigned bytes_per_sample) {
+    if (!enabled || !started) {
+        return;
+    }
+    stats.tapped++;
+    if (bytes_per_sample != 2 || channels < 1 || channels > 2) {
+        stats.unsupported++;
+        return;
+    }
+    const unsigned frame_bytes = channels * bytes_per_sample;
+    if (bytes < FFT_SIZE * frame_bytes) {
+        return;
+    }
+    if (block_full) {
+        stats.dropped_busy++;
+        return;
+    }
+    const uint32_t start = profiler_cycles();
+    if (start - hold_start < hold_cycles) {
+        stats.dropped_budget++;
+        return;
+    }
+
+    const uint8_t *last = pcm + bytes - FFT_SIZE * frame_bytes;
+    if (channels == 2) {
+        memcpy(block, last, sizeof(block));
+    } else {
+        for (int i = 0; i < FFT_SIZE; i++) {
+            memcpy(&block[i][0], &last[i * frame_bytes], sizeof(block[i][0]));
+            block[i][1] = block[i][0];
+        }
+    }
+    MEMORY_BARRIER();
+    block_full = true;
+    osSemaphoreRelease(block_semaphore);
+    stats.tap_cycles += profiler_cycles() - start;
+}
+
+bool visualizer_get_frame(VisualizerFrame *frame) {
+    if (!enabled || !started) {
+        return false;
+    }
+    *frame = frames[published];
+    return frame->sequence != 0 && osKernelSysTick() - frame->tick < VISUALIZER_STALE_MS;
+}
+
+void visualizer_get_stats(VisualizerStats *result) {
+    *result = stats;
+}
+
+void visualizer_print_stats(void) {
+    log_info("Visualizer: %s, %lu refills tapped, %lu analyzed, dropped %lu busy, %lu over the %d%% CPU budget, "
+             "%lu not 16-bit",
+             enabled ? "on" : "off", (unsigned long) stats.tapped, (unsigned long) stats.analyzed,
+             (unsigned long) stats.dropped_busy, (unsigned long) stats.dropped_budget, VISUALIZER_CPU_PERCENT,
+             (unsigned long) stats.unsupported);
+    log_info("  analysis: last %lu us, mean %lu us, max %lu us; copying into the slot cost the player %lu us in total",
+             (unsigned long) stats.last_analysis_us,
+             (unsigned long) (stats.analyzed != 0 ? stats.total_analysis_us / stats.analyzed : 0),
+             (unsigned long) stats.max_analysis_us,
+             (unsigned long) (stats.tap_cycles / (profiler_clock_hz() / 1000000)));
+}
@@ -0,0 +1,296 @@
+#include <stdio.h>
+#include <string.h>
+#include "cmsis_os.h"
+#include "ff.h"
+
+#include "jobs.h"
+#include "logger.h"
+#include "profiler.h"
+#include "waveform.h"
+
+#define WAVEFORM_MAGIC 0x4B415050 // "PPAK"
+#define WAVEFORM_VERSION 1
+#define WAVEFORM_JOB_ID 0x45564157 // "WAVE"
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    // Of the path, which names the file, and the size of the track it was built from
+    uint32_t path_hash;
+    uint32_t file_size;
+    uint32_t buckets;
+} WaveformFileHeader;
+
+typedef struct {
+    WaveformFileHeader header;
+    int8_t min[WAVEFORM_BUCKETS];
+    int8_t max[WAVEFORM_BUCKETS];
+} WaveformFile;
+
+// lock guards the selected track and its peaks: the controller selects and adds frames, the display task
+// reads the peaks and the job loads them
+static osMutexId lock;
+osMutexDef(waveform_lock);
+
+static WaveformPeaks peaks;
+static uint32_t path_hash;
+static uint32_t track_size;
+// Samples of the track the player decodes, 0 while the frames it decodes are not of the selected track
+static uint64_t stream_samples;
+static unsigned stream_shift;
+// The peaks came from the cache or were handed over to be written to it
+static bool complete;
+static volatile bool load_requested;
+
+// Written by the controller while no save is pending, then by the job to the card
+static WaveformFile saving;
+static volatile bool save_pending;
+
+// Only touched by the job
+static WaveformFile loaded;
+static FIL cache_file;
+static bool directory_made;
+
+static WaveformStats stats;
+
+static JobStepResult run_io(uint32_t *progress, void *context);
+
+static const Job waveform_job = {
+        .name = "waveform cache",
+        .id = WAVEFORM_JOB_ID,
+        .step = run_io,
+        .context = NULL,
+        .transient = true
+};
+
+static uint32_t hash_path(const char *path) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    while (*path != '\0') {
+        hash = (hash ^ (uint8_t) *path++) * 16777619u;
+    }
+    return hash;
+}
+
+static void get_file_name(uint32_t hash, char *name, size_t size) {
+    snprintf(name, size, "%s/%08lX.PK", WAVEFORM_CACHE_DIRECTORY, (unsigned long) hash);
+}
+
+// Called with the lock held
+static void clear_peaks(void) {
+    memset(peaks.min, INT8_MAX, sizeof(peaks.min));
+    memset(peaks.max, (uint8_t) INT8_MIN, sizeof(peaks.max));
+    peaks.filled = 0;
+    peaks.version++;
+}
+
+static void load(void) {
+    char name[32];
+    UINT bytes_read;
+
+    osMutexWait(lock, osWaitForever);
+    const uint32_t hash = path_hash;
+    const uint32_t size = track_size;
+    load_requested = false;
+    osMutexRelease(lock);
+
+    get_file_name(hash, name, sizeof(name));
+    if (f_open(&cache_file, name, FA_READ) != FR_OK) {
+        stats.missed++;
+        return;
+    }
+    const int result = f_read(&cache_file, &loaded, sizeof(loaded), &bytes_read) != FR_OK ||
+                       bytes_read != sizeof(loaded) || loaded.header.magic != WAVEFORM_MAGIC ||
+                       loaded.header.version != WAVEFORM_VERSION || loaded.header.path_hash != hash ||
+                       loaded.header.file_size != size || loaded.header.buckets != WAVEFORM_BUCKETS;
+    f_close(&cache_file);
+    if (result != 0) {
+        stats.missed++;
+        return;
+    }
+
+    // Another track may have been selected meanwhile
+    osMutexWait(lock, osWaitForever);
+    if (path_hash == hash && track_size == size) {
+        memcpy(peaks.min, loaded.min, sizeof(peaks.min));
+        memcpy(peaks.max, loaded.max, sizeof(peaks.max));
+        peaks.filled = WAVEFORM_BUCKETS;
+        peaks.version++;
+        complete = true;
+        stats.loaded++;
+    }
+    osMutexRelease(lock);
+}
+
+// Written in place, a file cut short does not pass the size check
+static void save(void) {
+    char name[32];
+    UINT bytes_written;
+
+    if (!directory_made) {
+        const FRESULT made = f_mkdir(WAVEFORM_CACHE_DIRECTORY);
+        directory_made = made == FR_OK || made == FR_EXIST;
+    }
+    get_file_name(saving.header.path_hash, name, sizeof(name));
+    if (f_open(&cache_file, name, FA_CREATE_ALWAYS | FA_WRITE) != FR_OK) {
+        log_warn("Cannot create %s", name);
+        stats.save_errors++;
+        return;
+    }
+    int result = f_write(&cache_file, &saving, sizeof(saving), &bytes_written) != FR_OK ||
+                 bytes_written != sizeof(saving);
+    if (f_close(&cache_file) != FR_OK) {
+        result = 1;
+    }
+    if (result != 0) {
+        log_warn("Cannot write %s", name);
+        f_unlink(name);
+        stats.save_errors++;
+        return;
+    }
+    stats.saved++;
+}
+
+// One file per step
+static JobStepResult run_io(uint32_t *progress, void *context) {
+    if (save_pending) {
+        save();
+        save_pending = false;
+    } else if (load_requested) {
+        load();
+    }
+    return save_pending || load_requested ? JOB_STEP_MORE : JOB_STEP_DONE;
+}
+
+int waveform_init(void) {
+    if (lock != NULL) {
+        return 0;
+    }
+    lock = osMutexCreate(osMutex(waveform_lock));
+    if (lock == NULL) {
+        log_error("Failed to initialize the waveform");
+        return 1;
+    }
+    clear_peaks();
+    return jobs_add(&waveform_job);
+}
+
+void waveform_select(const char *path, uint32_t file_size) {
+    if (lock == NULL) {
+        return;
+    }
+    const uint32_t hash = hash_path(path);
+    osMutexWait(lock, osWaitForever);
+    const bool changed = hash != path_hash || file_size != track_size;
+    if (changed) {
+        path_hash = hash;
+        track_size = file_size;
+        stream_samples = 0;
+        complete = false;
+        load_requested = true;
+        clear_peaks();
+    }
+    osMutexRelease(lock);
+    if (changed) {
+        jobs_restart(WAVEFORM_JOB_ID);
+    }
+}
+
+void waveform_start(const char *path, uint32_t file_size, uint64_t total_samples, unsigned bits_per_sample) {
+    if (lock == NULL) {
+        return;
+    }
+    waveform_select(path, file_size);
+    osMutexWait(lock, osWaitForever);
+    stream_samples = total_samples;
+    stream_shift = bits_per_sample > 8 ? bits_per_sample - 8 : 0;
+    osMutexRelease(lock);
+}
+
+static int8_t scale(int32_t sample) {
+    return (int8_t) MAX(INT8_MIN, MIN(INT8_MAX, sample >> stream_shift));
+}
+
+// The frame goes into every bucket it overlaps, which is more than one only for tracks of a few hundred frames
+void waveform_add_frame(uint64_t sample_number, unsigned samples, int32_t min, int32_t max) {
+    if (lock == NULL) {
+        return;
+    }
+    const uint32_t start = profiler_cycles();
+    bool handed_over = false;
+    osMutexWait(lock, osWaitForever);
+    if (stream_samples != 0 && !complete && samples != 0 && sample_number < stream_samples) {
+        const unsigned first = (unsigned) (sample_number * WAVEFORM_BUCKETS / stream_samples);
+        const unsigned last = (unsigned) MIN(WAVEFORM_BUCKETS - 1, (sample_number + samples - 1) * WAVEFORM_BUCKETS /
+                                                                   stream_samples);
+        const int8_t low = scale(min);
+        const int8_t high = scale(max);
+        bool changed = false;
+        for (unsigned bucket = first; bucket <= last; bucket++) {
+            if (peaks.min[bucket] > peaks.max[bucket]) {
+                peaks.filled++;
+                changed = true;
+            }
+            peaks.min[bucket] = MIN(peaks.min[bucket], low);
+            peaks.max[bucket] = MAX(peaks.max[bucket], high);
+        }
+        peaks.version += changed;
+        if (peaks.filled == WAVEFORM_BUCKETS && !save_pending) {
+            saving.header = (WaveformFileHeader) {
+                    .magic = WAVEFORM_MAGIC,
+                    .version = WAVEFORM_VERSION,
+                    .path_hash = path_hash,
+                    .file_size = track_size,
+                    .buckets = WAVEFORM_BUCKETS
+            };
+            memcpy(saving.min, peaks.min, sizeof(saving.min));
+            memcpy(saving.max, peaks.max, sizeof(saving.max));
+            complete = true;
+            handed_over = true;
+            stats.built++;
+        }
+    }
+    osMutexRelease(lock);
+    if (handed_over) {
+        save_pending = true;
+        jobs_restart(WAVEFORM_JOB_ID);
+    }
+    stats.frames++;
+    stats.add_cycles += profiler_cycles() - start;
+}
+
+uint32_t waveform_get_version(void) {
+    if (lock == NULL) {
+        return 0;
+    }
+    osMutexWait(lock, osWaitForever);
+    const uint32_t version = peaks.version;
+    osMutexRelease(lock);
+    return version;
+}
+
+void waveform_get_peaks(WaveformPeaks *result) {
+    if (lock == NULL) {
+        memset(result, 0, sizeof(*result));
+        return;
+    }
+    osMutexWait(lock, osWaitForever);
+    *result = peaks;
+    osMutexRelease(lock);
+}
+
+void waveform_get_stats(WaveformStats *result) {
+    *result = stats;
+}
+
+void waveform_print_stats(void) {
+    log_info("Waveform: %lu frames, overviews %lu loaded from the cache, %lu not found there, %lu built by playing, "
+             "%lu written (%lu errors)",
+             (unsigned long) stats.frames, (unsigned long) stats.loaded, (unsigned long) stats.missed,
+             (unsigned long) stats.built, (unsigned long) stats.saved, (unsigned long) stats.save_errors);
+    log_info("  %u of %d buckets of the selected track known, %lu us spent adding frame peaks",
+             (unsigned) peaks.filled, WAVEFORM_BUCKETS,
+             (unsigned long) (stats.add_cycles / (profiler_clock_hz() / 1000000)));
+}